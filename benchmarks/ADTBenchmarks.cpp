@@ -0,0 +1,188 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/APInt.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Hashing.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+// Identifier-like keys, the common StringMap workload in the compiler
+// (symbol, type and intrinsic names).
+static std::vector<std::string> makeKeys(size_t NumKeys) {
+  std::vector<std::string> Keys;
+  Keys.reserve(NumKeys);
+  std::mt19937 Rng(42);
+  const char Chars[] = "abcdefghijklmnopqrstuvwxyz_0123456789";
+  std::uniform_int_distribution<size_t> Len(4, 24);
+  std::uniform_int_distribution<size_t> Chr(0, sizeof(Chars) - 2);
+  for (size_t I = 0; I != NumKeys; ++I) {
+    std::string K(1, 'a' + (I % 26));
+    for (size_t L = Len(Rng); L; --L)
+      K.push_back(Chars[Chr(Rng)]);
+    K += std::to_string(I); // Keys must be unique.
+    Keys.push_back(std::move(K));
+  }
+  return Keys;
+}
+
+static void BM_StringMapInsert(benchmark::State &State) {
+  const std::vector<std::string> Keys = makeKeys(State.range(0));
+  for (auto _ : State) {
+    StringMap<unsigned> Map;
+    for (const std::string &K : Keys)
+      Map[K] = 1;
+    benchmark::DoNotOptimize(Map.size());
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+BENCHMARK(BM_StringMapInsert)->Range(8, 1 << 16);
+
+static void BM_StringMapLookupHit(benchmark::State &State) {
+  const std::vector<std::string> Keys = makeKeys(State.range(0));
+  StringMap<unsigned> Map;
+  for (const std::string &K : Keys)
+    Map[K] = 1;
+  for (auto _ : State) {
+    unsigned Found = 0;
+    for (const std::string &K : Keys)
+      Found += Map.count(K);
+    benchmark::DoNotOptimize(Found);
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+BENCHMARK(BM_StringMapLookupHit)->Range(8, 1 << 16);
+
+static void BM_StringMapLookupMiss(benchmark::State &State) {
+  const std::vector<std::string> Keys = makeKeys(State.range(0));
+  StringMap<unsigned> Map;
+  for (const std::string &K : Keys)
+    Map[K + "_in_map"] = 1;
+  for (auto _ : State) {
+    unsigned Found = 0;
+    for (const std::string &K : Keys)
+      Found += Map.count(K);
+    benchmark::DoNotOptimize(Found);
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+BENCHMARK(BM_StringMapLookupMiss)->Range(8, 1 << 16);
+
+// Pointer-like keys with shuffled insertion order, the typical DenseMap
+// workload (value/instruction maps).
+static std::vector<uint64_t> makeIntKeys(size_t NumKeys) {
+  std::vector<uint64_t> Keys;
+  Keys.reserve(NumKeys);
+  for (size_t I = 0; I != NumKeys; ++I)
+    Keys.push_back((I + 1) * 16); // Pointer-ish: nonzero, aligned.
+  std::shuffle(Keys.begin(), Keys.end(), std::mt19937(42));
+  return Keys;
+}
+
+static void BM_DenseMapInsert(benchmark::State &State) {
+  const std::vector<uint64_t> Keys = makeIntKeys(State.range(0));
+  for (auto _ : State) {
+    DenseMap<uint64_t, unsigned> Map;
+    for (uint64_t K : Keys)
+      Map[K] = 1;
+    benchmark::DoNotOptimize(Map.size());
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+BENCHMARK(BM_DenseMapInsert)->Range(8, 1 << 16);
+
+static void BM_DenseMapLookupHit(benchmark::State &State) {
+  const std::vector<uint64_t> Keys = makeIntKeys(State.range(0));
+  DenseMap<uint64_t, unsigned> Map;
+  for (uint64_t K : Keys)
+    Map[K] = 1;
+  for (auto _ : State) {
+    unsigned Found = 0;
+    for (uint64_t K : Keys)
+      Found += Map.count(K);
+    benchmark::DoNotOptimize(Found);
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+BENCHMARK(BM_DenseMapLookupHit)->Range(8, 1 << 16);
+
+static void BM_DenseMapLookupMiss(benchmark::State &State) {
+  const std::vector<uint64_t> Keys = makeIntKeys(State.range(0));
+  DenseMap<uint64_t, unsigned> Map;
+  for (uint64_t K : Keys)
+    Map[K + 8] = 1; // Offset so every probe misses.
+  for (auto _ : State) {
+    unsigned Found = 0;
+    for (uint64_t K : Keys)
+      Found += Map.count(K);
+    benchmark::DoNotOptimize(Found);
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+BENCHMARK(BM_DenseMapLookupMiss)->Range(8, 1 << 16);
+
+// Growth from the inline buffer through repeated reallocation.
+static void BM_SmallVectorGrowth(benchmark::State &State) {
+  const unsigned NumElements = State.range(0);
+  for (auto _ : State) {
+    SmallVector<unsigned, 8> V;
+    for (unsigned I = 0; I != NumElements; ++I)
+      V.push_back(I);
+    benchmark::DoNotOptimize(V.data());
+  }
+  State.SetItemsProcessed(State.iterations() * NumElements);
+}
+BENCHMARK(BM_SmallVectorGrowth)->Range(4, 1 << 16);
+
+static void BM_StringRefHashing(benchmark::State &State) {
+  const std::vector<std::string> Keys = makeKeys(1024);
+  for (auto _ : State) {
+    hash_code Sum = hash_value(0);
+    for (const std::string &K : Keys)
+      Sum = hash_combine(Sum, hash_value(StringRef(K)));
+    benchmark::DoNotOptimize(Sum);
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+BENCHMARK(BM_StringRefHashing);
+
+// Arithmetic at the widths that matter: single-word fast paths (64), the
+// first multi-word case (128) and the wide cases constant folding hits.
+static void BM_APIntAdd(benchmark::State &State) {
+  const unsigned BitWidth = State.range(0);
+  APInt A(BitWidth, 0x0ddc0ffeebadf00dULL);
+  APInt B(BitWidth, 0x1234567890abcdefULL);
+  for (auto _ : State) {
+    A += B;
+    benchmark::DoNotOptimize(A.getRawData());
+  }
+}
+BENCHMARK(BM_APIntAdd)->Arg(64)->Arg(128)->Arg(512)->Arg(1024);
+
+static void BM_APIntMul(benchmark::State &State) {
+  const unsigned BitWidth = State.range(0);
+  const APInt A(BitWidth, 0x0ddc0ffeebadf00dULL);
+  const APInt B(BitWidth, 0x1234567890abcdefULL);
+  for (auto _ : State) {
+    APInt C = A * B;
+    benchmark::DoNotOptimize(C.getRawData());
+  }
+}
+BENCHMARK(BM_APIntMul)->Arg(64)->Arg(128)->Arg(512)->Arg(1024);
+
+static void BM_APIntUDiv(benchmark::State &State) {
+  const unsigned BitWidth = State.range(0);
+  const APInt A = APInt::getMaxValue(BitWidth);
+  const APInt B(BitWidth, 0x1234567890abcdefULL);
+  for (auto _ : State) {
+    APInt C = A.udiv(B);
+    benchmark::DoNotOptimize(C.getRawData());
+  }
+}
+BENCHMARK(BM_APIntUDiv)->Arg(64)->Arg(128)->Arg(512)->Arg(1024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,106 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Bitstream/BitstreamReader.h"
+#include "llvm/Bitstream/BitstreamWriter.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/raw_ostream.h"
+#include <random>
+
+using namespace llvm;
+
+static const size_t NumBitstreamValues = 4096;
+
+static std::vector<uint64_t> makeValues() {
+  std::vector<uint64_t> Values;
+  Values.reserve(NumBitstreamValues);
+  std::mt19937_64 Rng(42);
+  for (size_t I = 0; I != NumBitstreamValues; ++I) {
+    // Mostly small values, as in real bitcode, with the occasional wide one.
+    uint64_t V = Rng();
+    Values.push_back(I % 16 == 0 ? V : V % 64);
+  }
+  return Values;
+}
+
+static void BM_BitstreamVBRDecode(benchmark::State &State) {
+  const std::vector<uint64_t> Values = makeValues();
+  SmallString<0> Buffer;
+  {
+    BitstreamWriter Writer(Buffer);
+    for (uint64_t V : Values)
+      Writer.EmitVBR64(V, 6);
+    Writer.FlushToWord();
+  }
+  const StringRef Bytes = Buffer.str();
+  for (auto _ : State) {
+    SimpleBitstreamCursor Cursor(Bytes);
+    uint64_t Sum = 0;
+    for (size_t I = 0; I != Values.size(); ++I)
+      Sum += cantFail(Cursor.ReadVBR64(6));
+    benchmark::DoNotOptimize(Sum);
+  }
+  State.SetItemsProcessed(State.iterations() * Values.size());
+}
+BENCHMARK(BM_BitstreamVBRDecode);
+
+static void BM_BitstreamFixedDecode(benchmark::State &State) {
+  const std::vector<uint64_t> Values = makeValues();
+  SmallString<0> Buffer;
+  {
+    BitstreamWriter Writer(Buffer);
+    for (uint64_t V : Values)
+      Writer.Emit(V % 64, 6);
+    Writer.FlushToWord();
+  }
+  const StringRef Bytes = Buffer.str();
+  for (auto _ : State) {
+    SimpleBitstreamCursor Cursor(Bytes);
+    uint64_t Sum = 0;
+    for (size_t I = 0; I != Values.size(); ++I)
+      Sum += cantFail(Cursor.Read(6));
+    benchmark::DoNotOptimize(Sum);
+  }
+  State.SetItemsProcessed(State.iterations() * Values.size());
+}
+BENCHMARK(BM_BitstreamFixedDecode);
+
+static void BM_RawOstreamIntegers(benchmark::State &State) {
+  SmallString<256> Buffer;
+  raw_svector_ostream OS(Buffer);
+  for (auto _ : State) {
+    Buffer.clear();
+    for (int I = -128; I != 128; ++I)
+      OS << I << ' ' << static_cast<unsigned>(I * I) << '\n';
+    benchmark::DoNotOptimize(Buffer.size());
+  }
+  State.SetItemsProcessed(State.iterations() * 256);
+}
+BENCHMARK(BM_RawOstreamIntegers);
+
+static void BM_RawOstreamFormat(benchmark::State &State) {
+  SmallString<256> Buffer;
+  raw_svector_ostream OS(Buffer);
+  for (auto _ : State) {
+    Buffer.clear();
+    for (int I = 0; I != 256; ++I)
+      OS << format("%4d: %08x %+.3f\n", I, I * 0x01010101, I / 7.0);
+    benchmark::DoNotOptimize(Buffer.size());
+  }
+  State.SetItemsProcessed(State.iterations() * 256);
+}
+BENCHMARK(BM_RawOstreamFormat);
+
+static void BM_RawOstreamHex(benchmark::State &State) {
+  SmallString<256> Buffer;
+  raw_svector_ostream OS(Buffer);
+  for (auto _ : State) {
+    Buffer.clear();
+    for (uint64_t I = 0; I != 256; ++I)
+      OS.write_hex(I * 0x0101010101010101ULL);
+    benchmark::DoNotOptimize(Buffer.size());
+  }
+  State.SetItemsProcessed(State.iterations() * 256);
+}
+BENCHMARK(BM_RawOstreamHex);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,202 @@
+/*===---------------- llvm-c/Orc.h - OrcV2 C bindings -----------*- C++ -*-===*\
+|*                                                                            *|
+|* Part of the LLVM Project, under the Apache License v2.0 with LLVM          *|
+|* Exceptions.                                                                *|
+|* See https://llvm.org/LICENSE.txt for license information.                  *|
+|* SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception                    *|
+|*                                                                            *|
+|*===----------------------------------------------------------------------===*|
+|*                                                                            *|
+|* This header declares the C interface to the ORCv2 JIT APIs (LLJIT and the  *|
+|* underlying ExecutionSession), including asynchronous lookup and the        *|
+|* materialization dispatch hook that lets an embedder run compiles on its    *|
+|* own thread pool. The older llvm-c/OrcBindings.h header wraps the legacy    *|
+|* (synchronous, single-threaded) ORC stack.                                  *|
+|*                                                                            *|
+|* Note: This interface is experimental. It is *NOT* stable, and may be       *|
+|*       changed without warning.                                             *|
+|*                                                                            *|
+\*===----------------------------------------------------------------------===*/
+
+#ifndef LLVM_C_ORC_H
+#define LLVM_C_ORC_H
+
+#include "llvm-c/Error.h"
+#include "llvm-c/Types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Represents an address in the target process.
+ */
+typedef uint64_t LLVMOrcJITTargetAddress;
+
+/**
+ * A reference to an orc::ExecutionSession instance.
+ */
+typedef struct LLVMOrcOpaqueExecutionSession *LLVMOrcExecutionSessionRef;
+
+/**
+ * A reference to an orc::JITDylib instance.
+ */
+typedef struct LLVMOrcOpaqueJITDylib *LLVMOrcJITDylibRef;
+
+/**
+ * A reference to an orc::ThreadSafeContext instance.
+ */
+typedef struct LLVMOrcOpaqueThreadSafeContext *LLVMOrcThreadSafeContextRef;
+
+/**
+ * A reference to an orc::ThreadSafeModule instance.
+ */
+typedef struct LLVMOrcOpaqueThreadSafeModule *LLVMOrcThreadSafeModuleRef;
+
+/**
+ * A reference to an orc::MaterializationUnit that has been handed to a
+ * dispatch function (see LLVMOrcExecutionSessionSetDispatchMaterialization).
+ */
+typedef struct LLVMOrcOpaqueMaterializationUnit *LLVMOrcMaterializationUnitRef;
+
+/**
+ * A reference to an orc::LLJIT instance.
+ */
+typedef struct LLVMOrcOpaqueLLJIT *LLVMOrcLLJITRef;
+
+/**
+ * Callback type for asynchronous lookup. Err is LLVMErrorSuccess and Addr is
+ * the symbol's address on success; on failure Err describes the problem and
+ * Addr is zero. Ownership of Err passes to the callback.
+ */
+typedef void (*LLVMOrcLookupResultFn)(LLVMErrorRef Err,
+                                      LLVMOrcJITTargetAddress Addr, void *Ctx);
+
+/**
+ * Callback type for materialization dispatch. The callee must arrange for
+ * LLVMOrcMaterializationUnitMaterialize(MU, JD) to be called exactly once
+ * (typically from a worker owned by the embedder's thread pool).
+ */
+typedef void (*LLVMOrcDispatchMaterializationFn)(
+    void *Ctx, LLVMOrcJITDylibRef JD, LLVMOrcMaterializationUnitRef MU);
+
+/**
+ * Create a ThreadSafeContext containing a new LLVMContext.
+ *
+ * Ownership of the underlying ThreadSafeContext data is shared: the context
+ * stays alive while any ThreadSafeModule created against it is alive, so the
+ * client is free to dispose of this reference once its modules are created.
+ */
+LLVMOrcThreadSafeContextRef LLVMOrcCreateNewThreadSafeContext(void);
+
+/**
+ * Get a reference to the wrapped LLVMContext.
+ */
+LLVMContextRef
+LLVMOrcThreadSafeContextGetContext(LLVMOrcThreadSafeContextRef TSCtx);
+
+/**
+ * Dispose of a ThreadSafeContext.
+ */
+void LLVMOrcDisposeThreadSafeContext(LLVMOrcThreadSafeContextRef TSCtx);
+
+/**
+ * Create a ThreadSafeModule wrapper around the given module, associated with
+ * the given context. This takes ownership of the module.
+ */
+LLVMOrcThreadSafeModuleRef
+LLVMOrcCreateNewThreadSafeModule(LLVMModuleRef M,
+                                 LLVMOrcThreadSafeContextRef TSCtx);
+
+/**
+ * Dispose of a ThreadSafeModule that was not consumed by an add operation.
+ */
+void LLVMOrcDisposeThreadSafeModule(LLVMOrcThreadSafeModuleRef TSM);
+
+/**
+ * Create an LLJIT instance for the host, with NumCompileThreads dedicated
+ * compile threads. With NumCompileThreads == 0 all materialization runs on
+ * the thread performing the lookup; with a non-zero value modules are cloned
+ * onto private contexts at add time so they can be compiled concurrently.
+ * The resulting instance must be disposed of with LLVMOrcDisposeLLJIT.
+ */
+LLVMErrorRef LLVMOrcCreateLLJIT(LLVMOrcLLJITRef *Result,
+                                unsigned NumCompileThreads);
+
+/**
+ * Dispose of an LLJIT instance.
+ */
+LLVMErrorRef LLVMOrcDisposeLLJIT(LLVMOrcLLJITRef J);
+
+/**
+ * Get a reference to the ExecutionSession for this LLJIT instance. The
+ * session is owned by the LLJIT instance and must not be freed.
+ */
+LLVMOrcExecutionSessionRef LLVMOrcLLJITGetExecutionSession(LLVMOrcLLJITRef J);
+
+/**
+ * Get a reference to the main JITDylib. The JITDylib is owned by the LLJIT
+ * instance and must not be freed.
+ */
+LLVMOrcJITDylibRef LLVMOrcLLJITGetMainJITDylib(LLVMOrcLLJITRef J);
+
+/**
+ * Add an IR module to the given JITDylib. On success this takes ownership of
+ * the ThreadSafeModule; on failure ownership stays with the caller.
+ */
+LLVMErrorRef LLVMOrcLLJITAddLLVMIRModule(LLVMOrcLLJITRef J,
+                                         LLVMOrcJITDylibRef JD,
+                                         LLVMOrcThreadSafeModuleRef TSM);
+
+/**
+ * Look up the given symbol (by unmangled name) in the main JITDylib,
+ * blocking until it is ready.
+ */
+LLVMErrorRef LLVMOrcLLJITLookup(LLVMOrcLLJITRef J,
+                                LLVMOrcJITTargetAddress *Result,
+                                const char *Name);
+
+/**
+ * Asynchronous version of LLVMOrcLLJITLookup: returns immediately and calls
+ * NotifyComplete once the symbol (by unmangled name) is ready or the lookup
+ * has failed. The callback may run on a JIT thread; it must not block the
+ * session by issuing recursive blocking lookups.
+ */
+void LLVMOrcLLJITLookupAsync(LLVMOrcLLJITRef J, const char *Name,
+                             LLVMOrcLookupResultFn NotifyComplete, void *Ctx);
+
+/**
+ * Define absolute symbols (by unmangled name) in the given JITDylib. This
+ * registers a MaterializationUnit for the names, so the definitions are
+ * visible to lookups and to JIT'd code immediately; it is the usual way to
+ * expose host functions to the JIT.
+ */
+LLVMErrorRef LLVMOrcLLJITDefineAbsoluteSymbols(
+    LLVMOrcLLJITRef J, LLVMOrcJITDylibRef JD, const char **Names,
+    const LLVMOrcJITTargetAddress *Addrs, size_t NumSymbols);
+
+/**
+ * Set the session's materialization dispatch function, mirroring
+ * orc::ExecutionSession::setDispatchMaterialization. Each unit of
+ * outstanding materialization work is handed to Dispatch, which must arrange
+ * for LLVMOrcMaterializationUnitMaterialize to be invoked on it exactly
+ * once; running it from the embedder's own thread pool yields concurrent
+ * compilation. Passing a null Dispatch restores the default (materialize on
+ * the current thread).
+ */
+void LLVMOrcExecutionSessionSetDispatchMaterialization(
+    LLVMOrcExecutionSessionRef ES, LLVMOrcDispatchMaterializationFn Dispatch,
+    void *Ctx);
+
+/**
+ * Run a dispatched materialization unit against the given JITDylib. This
+ * consumes the MaterializationUnit reference.
+ */
+void LLVMOrcMaterializationUnitMaterialize(LLVMOrcMaterializationUnitRef MU,
+                                           LLVMOrcJITDylibRef JD);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* LLVM_C_ORC_H */
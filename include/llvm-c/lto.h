@@ -44,7 +44,7 @@ typedef bool lto_bool_t;
  * @{
  */
 
-#define LTO_API_VERSION 25
+#define LTO_API_VERSION 26
 
 /**
  * \since prior to LTO_API_VERSION=3
@@ -480,6 +480,40 @@ lto_codegen_compile(lto_code_gen_t cg, size_t* length);
 extern lto_bool_t
 lto_codegen_compile_to_file(lto_code_gen_t cg, const char** name);
 
+/**
+ * Sets the number of partitions/threads used for code generation by
+ * lto_codegen_compile_to_file(). At levels above 1 the merged module is
+ * split into that many linkable partitions and code generation runs in
+ * parallel, producing one object file per partition; use
+ * lto_codegen_get_num_object_files() and lto_codegen_get_object_file() to
+ * retrieve the additional outputs. A level of 0 or 1 preserves the previous
+ * single-threaded behavior.
+ *
+ * \since LTO_API_VERSION=26
+ */
+extern void
+lto_codegen_set_parallelism(lto_code_gen_t cg, unsigned parallelism);
+
+/**
+ * Returns the number of object files produced by the last successful call to
+ * lto_codegen_compile_to_file().
+ *
+ * \since LTO_API_VERSION=26
+ */
+extern unsigned int
+lto_codegen_get_num_object_files(lto_code_gen_t cg);
+
+/**
+ * Returns the path of the index-th object file produced by the last
+ * successful call to lto_codegen_compile_to_file(). Index 0 is the file
+ * whose name was returned via the name argument. It is up to the linker to
+ * remove the intermediate output files.
+ *
+ * \since LTO_API_VERSION=26
+ */
+extern const char *
+lto_codegen_get_object_file(lto_code_gen_t cg, unsigned int index);
+
 /**
  * Runs optimization for the merged module. Returns true on error.
  *
@@ -0,0 +1,156 @@
+//===- llvm/ADT/ConcurrentDenseMap.h - Sharded dense map --------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines the ConcurrentDenseMap class, a thread-safe wrapper over a
+// set of DenseMap shards with striped reader/writer locks.  It is intended for
+// caches that are shared between threads (ThinLTO backends, ORC
+// materialization) where a single mutex around one DenseMap becomes the
+// contention point.  Keys hash to a shard, so threads touching different keys
+// mostly take different locks.
+//
+// Because entries may be mutated or removed by other threads, the interface
+// deliberately trades iterators and references for value copies: lookup() and
+// try_emplace() return ValueT by value.  Use it for values that are cheap to
+// copy (pointers, small PODs), which is what analysis caches store anyway.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ADT_CONCURRENTDENSEMAP_H
+#define LLVM_ADT_CONCURRENTDENSEMAP_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Optional.h"
+#include "llvm/Support/RWMutex.h"
+#include <utility>
+
+namespace llvm {
+
+template <typename KeyT, typename ValueT,
+          typename KeyInfoT = DenseMapInfo<KeyT>, unsigned NumShardsLog2 = 4>
+class ConcurrentDenseMap {
+  static_assert(NumShardsLog2 < 16, "unreasonable shard count");
+
+  struct Shard {
+    mutable sys::SmartRWMutex<true> Lock;
+    DenseMap<KeyT, ValueT, KeyInfoT> Map;
+  };
+
+  static constexpr unsigned NumShards = 1u << NumShardsLog2;
+  Shard Shards[NumShards];
+
+  Shard &getShard(const KeyT &Key) {
+    // DenseMap consumes the low hash bits for its buckets, so derive the
+    // shard index from the high bits to keep the two uncorrelated.
+    unsigned Hash = KeyInfoT::getHashValue(Key);
+    return Shards[(Hash >> 16) & (NumShards - 1)];
+  }
+  const Shard &getShard(const KeyT &Key) const {
+    return const_cast<ConcurrentDenseMap *>(this)->getShard(Key);
+  }
+
+public:
+  ConcurrentDenseMap() = default;
+  ConcurrentDenseMap(const ConcurrentDenseMap &) = delete;
+  ConcurrentDenseMap &operator=(const ConcurrentDenseMap &) = delete;
+
+  /// Return a copy of the value for \p Key, or None if absent.
+  Optional<ValueT> lookup(const KeyT &Key) const {
+    const Shard &S = getShard(Key);
+    sys::SmartScopedReader<true> Guard(S.Lock);
+    auto I = S.Map.find(Key);
+    if (I == S.Map.end())
+      return None;
+    return I->second;
+  }
+
+  /// Return 1 if \p Key is present, 0 otherwise.  The result is only a
+  /// snapshot: another thread may insert or erase the key immediately after.
+  size_t count(const KeyT &Key) const {
+    const Shard &S = getShard(Key);
+    sys::SmartScopedReader<true> Guard(S.Lock);
+    return S.Map.count(Key);
+  }
+
+  /// Insert a value for \p Key if none is present.  Returns a copy of the
+  /// value now in the map and whether this call inserted it.
+  template <typename... Ts>
+  std::pair<ValueT, bool> try_emplace(const KeyT &Key, Ts &&... Args) {
+    Shard &S = getShard(Key);
+    sys::SmartScopedWriter<true> Guard(S.Lock);
+    auto R = S.Map.try_emplace(Key, std::forward<Ts>(Args)...);
+    return std::make_pair(R.first->second, R.second);
+  }
+
+  /// Insert or overwrite the value for \p Key.
+  void insert_or_assign(const KeyT &Key, ValueT Val) {
+    Shard &S = getShard(Key);
+    sys::SmartScopedWriter<true> Guard(S.Lock);
+    S.Map[Key] = std::move(Val);
+  }
+
+  /// Look up \p Key, running \p Create under the shard lock to build the
+  /// value on a miss.  This is the usual cache pattern: exactly one thread
+  /// constructs the value for a given key, the rest see its result.  \p Create
+  /// must not touch this map, or it will deadlock on the shard lock.
+  template <typename CallableT>
+  ValueT getOrCreate(const KeyT &Key, CallableT &&Create) {
+    Shard &S = getShard(Key);
+    {
+      sys::SmartScopedReader<true> Guard(S.Lock);
+      auto I = S.Map.find(Key);
+      if (I != S.Map.end())
+        return I->second;
+    }
+    sys::SmartScopedWriter<true> Guard(S.Lock);
+    auto R = S.Map.try_emplace(Key);
+    if (R.second)
+      R.first->second = Create();
+    return R.first->second;
+  }
+
+  /// Erase \p Key if present.  Returns true if an entry was removed.
+  bool erase(const KeyT &Key) {
+    Shard &S = getShard(Key);
+    sys::SmartScopedWriter<true> Guard(S.Lock);
+    return S.Map.erase(Key);
+  }
+
+  /// Total number of entries.  Shards are locked one at a time, so the result
+  /// is approximate while other threads are mutating the map.
+  size_t size() const {
+    size_t N = 0;
+    for (const Shard &S : Shards) {
+      sys::SmartScopedReader<true> Guard(S.Lock);
+      N += S.Map.size();
+    }
+    return N;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  void clear() {
+    for (Shard &S : Shards) {
+      sys::SmartScopedWriter<true> Guard(S.Lock);
+      S.Map.clear();
+    }
+  }
+
+  /// Apply \p Fn to a copy of every (key, value) pair.  Each shard is locked
+  /// for reading while it is walked; \p Fn must not touch this map.
+  template <typename CallableT> void forEach(CallableT Fn) const {
+    for (const Shard &S : Shards) {
+      sys::SmartScopedReader<true> Guard(S.Lock);
+      for (const auto &KV : S.Map)
+        Fn(KV.first, KV.second);
+    }
+  }
+};
+
+} // end namespace llvm
+
+#endif // LLVM_ADT_CONCURRENTDENSEMAP_H
@@ -502,6 +502,55 @@ public:
   FoldingSet &operator=(FoldingSet &&RHS) = default;
 };
 
+//===----------------------------------------------------------------------===//
+/// ArenaFoldingSet - A FoldingSet whose nodes live in a caller-supplied
+/// BumpPtrAllocator.  Nodes are created through createNode() and are never
+/// individually freed; tearing down the whole set is clear() plus a Reset()
+/// of the arena by its owner, which replaces the per-node walk-and-free that
+/// otherwise dominates teardown of large uniquing tables.
+///
+/// Because node destructors are never run, T must be trivially destructible.
+/// The arena must outlive the set (or at least every node handed out).
+template <class T> class ArenaFoldingSet final : public FoldingSetImpl<T> {
+  static_assert(std::is_trivially_destructible<T>::value,
+                "ArenaFoldingSet never runs node destructors");
+
+  using Super = FoldingSetImpl<T>;
+  using Node = typename Super::Node;
+
+  BumpPtrAllocator &Arena;
+
+  void GetNodeProfile(Node *N, FoldingSetNodeID &ID) const override {
+    T *TN = static_cast<T *>(N);
+    FoldingSetTrait<T>::Profile(*TN, ID);
+  }
+
+  bool NodeEquals(Node *N, const FoldingSetNodeID &ID, unsigned IDHash,
+                  FoldingSetNodeID &TempID) const override {
+    T *TN = static_cast<T *>(N);
+    return FoldingSetTrait<T>::Equals(*TN, ID, IDHash, TempID);
+  }
+
+  unsigned ComputeNodeHash(Node *N, FoldingSetNodeID &TempID) const override {
+    T *TN = static_cast<T *>(N);
+    return FoldingSetTrait<T>::ComputeHash(*TN, TempID);
+  }
+
+public:
+  explicit ArenaFoldingSet(BumpPtrAllocator &Arena, unsigned Log2InitSize = 6)
+      : Super(Log2InitSize), Arena(Arena) {}
+
+  BumpPtrAllocator &getArena() { return Arena; }
+
+  /// createNode - Construct a T in the arena.  The node is not inserted; use
+  /// this with FindNodeOrInsertPos/InsertNode, or hand the result to
+  /// GetOrInsertNode (an unused duplicate merely wastes arena space until the
+  /// next Reset()).
+  template <typename... ArgTys> T *createNode(ArgTys &&... Args) {
+    return new (Arena.Allocate<T>()) T(std::forward<ArgTys>(Args)...);
+  }
+};
+
 //===----------------------------------------------------------------------===//
 /// ContextualFoldingSet - This template class is a further refinement
 /// of FoldingSet which provides a context argument when calling
@@ -34,6 +34,20 @@
 
 namespace llvm {
 
+namespace detail {
+
+/// Out-of-line hook (defined in lib/Support/SmallVector.cpp) that records one
+/// grow() event for the instantiation identified by \p Site.  The counters are
+/// reported through the Statistic machinery under the "smallvector" debug
+/// type, so a -stats run shows, per instantiation, how many grows happened,
+/// how many of them spilled the inline buffer to the heap, and the high-water
+/// capacity in bytes.  This exists to tune inline capacities on hot paths;
+/// builds must opt in by defining LLVM_ENABLE_SMALLVECTOR_STATS globally.
+void recordSmallVectorGrow(const char *Site, bool SpilledFromInline,
+                           size_t NewCapacityInBytes);
+
+} // end namespace detail
+
 /// This is all the non-templated stuff common to all SmallVectors.
 class SmallVectorBase {
 protected:
@@ -95,7 +109,14 @@ protected:
       : SmallVectorBase(getFirstEl(), Size) {}
 
   void grow_pod(size_t MinCapacity, size_t TSize) {
+#ifdef LLVM_ENABLE_SMALLVECTOR_STATS
+    bool WasSmall = isSmall();
+#endif
     SmallVectorBase::grow_pod(getFirstEl(), MinCapacity, TSize);
+#ifdef LLVM_ENABLE_SMALLVECTOR_STATS
+    detail::recordSmallVectorGrow(LLVM_PRETTY_FUNCTION, WasSmall,
+                                  this->capacity() * TSize);
+#endif
   }
 
   /// Return true if this is a smallvector which has not had dynamic
@@ -239,6 +260,11 @@ void SmallVectorTemplateBase<T, TriviallyCopyable>::grow(size_t MinSize) {
   NewCapacity = std::min(std::max(NewCapacity, MinSize), size_t(UINT32_MAX));
   T *NewElts = static_cast<T*>(llvm::safe_malloc(NewCapacity*sizeof(T)));
 
+#ifdef LLVM_ENABLE_SMALLVECTOR_STATS
+  detail::recordSmallVectorGrow(LLVM_PRETTY_FUNCTION, this->isSmall(),
+                                NewCapacity * sizeof(T));
+#endif
+
   // Move the elements over.
   this->uninitialized_move(this->begin(), this->end(), NewElts);
 
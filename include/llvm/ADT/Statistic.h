@@ -187,6 +187,12 @@ void PrintStatistics();
 /// Print statistics to the given output stream.
 void PrintStatistics(raw_ostream &OS);
 
+/// Print statistics to the given output stream, grouped into one section per
+/// debug type (i.e. per pass), with a per-section total. This is the format
+/// selected by -stats-grouped and is easier to read when many passes
+/// contribute counters, e.g. under multi-threaded in-process LTO.
+void PrintStatisticsGrouped(raw_ostream &OS);
+
 /// Print statistics in JSON format. This does include all global timers (\see
 /// Timer, TimerGroup). Note that the timers are cleared after printing and will
 /// not be printed in human readable form or in a second call of
@@ -26,6 +26,7 @@
 #include <cstring>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <utility>
 
 namespace llvm {
@@ -73,6 +74,12 @@ protected:
   StringMapImpl(unsigned InitSize, unsigned ItemSize);
   unsigned RehashTable(unsigned BucketNo = 0);
 
+  /// ReserveTable - Grow the table so that it can hold \p NumEntries items in
+  /// total without needing another rehash.  Unlike RehashTable this grows
+  /// directly to the required size in a single step, which matters when
+  /// bulk-inserting millions of entries.
+  void ReserveTable(unsigned NumEntries);
+
   /// LookupBucketFor - Look up the bucket that the specified string should end
   /// up in.  If it already exists as a key in the map, the Item pointer for the
   /// specified bucket will be non-null.  Otherwise, it will be null.  In either
@@ -414,6 +421,25 @@ public:
     return try_emplace(KV.first, std::move(KV.second));
   }
 
+  /// insert - Range insertion of pairs convertible to
+  /// std::pair<StringRef, ValueTy>.  The table is pre-sized for the whole
+  /// batch, so at most one rehash happens regardless of the range length.
+  /// Requires forward iterators so the range can be measured up front.
+  template <typename InputIt> void insert(InputIt First, InputIt Last) {
+    size_t Distance = std::distance(First, Last);
+    if (Distance > std::numeric_limits<unsigned>::max() - NumItems)
+      report_bad_alloc_error("Range too large for StringMap");
+    reserve(NumItems + static_cast<unsigned>(Distance));
+    for (; First != Last; ++First)
+      insert(*First);
+  }
+
+  /// Grow the table so that it can hold at least \p NumEntries entries in
+  /// total (including those already present) without rehashing.  Useful when
+  /// several threads each build a private map of known size and the results
+  /// are merged afterwards.
+  void reserve(unsigned NumEntries) { ReserveTable(NumEntries); }
+
   /// Inserts an element or assigns to the current element if the key already
   /// exists. The return type is the same as try_emplace.
   template <typename V>
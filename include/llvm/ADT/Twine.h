@@ -241,6 +241,15 @@ namespace llvm {
     /// Get the NodeKind of the right-hand side.
     NodeKind getRHSKind() const { return RHSKind; }
 
+    /// Append this twine to \p Out if every node is a string or character,
+    /// i.e. rendering requires no number formatting. Returns false without
+    /// completing the append otherwise.
+    bool appendSimple(SmallVectorImpl<char> &Out) const;
+
+    /// Append one child to \p Out; see appendSimple.
+    static bool appendOneChildSimple(SmallVectorImpl<char> &Out, Child Ptr,
+                                     NodeKind Kind);
+
     /// Print one child from a twine.
     void printOneChild(raw_ostream &OS, Child Ptr, NodeKind Kind) const;
 
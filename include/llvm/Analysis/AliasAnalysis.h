@@ -303,7 +303,15 @@ public:
   using IsCapturedCacheT = SmallDenseMap<const Value *, bool, 8>;
   IsCapturedCacheT IsCapturedCache;
 
-  AAQueryInfo() : AliasCache(), IsCapturedCache() {}
+  /// Number uniquely identifying this query batch. AA implementations may
+  /// key private per-batch caches off it; see BasicAAResult's decomposed-GEP
+  /// cache.
+  uint64_t BatchID;
+
+  AAQueryInfo() : AliasCache(), IsCapturedCache(), BatchID(getNextBatchID()) {}
+
+private:
+  static uint64_t getNextBatchID();
 };
 
 class BatchAAResults;
@@ -135,16 +135,11 @@ public:
   }
 
   /// Access the list of assumptions which affect this value.
-  MutableArrayRef<WeakTrackingVH> assumptionsFor(const Value *V) {
-    if (!Scanned)
-      scanFunction();
-
-    auto AVI = AffectedValues.find_as(const_cast<Value *>(V));
-    if (AVI == AffectedValues.end())
-      return MutableArrayRef<WeakTrackingVH>();
-
-    return AVI->second;
-  }
+  ///
+  /// Dead assumptions leave null handles behind; the list is compacted here
+  /// so that assume-heavy functions do not pay for deleted entries on every
+  /// subsequent query.
+  MutableArrayRef<WeakTrackingVH> assumptionsFor(const Value *V);
 };
 
 /// A function analysis which provides an \c AssumptionCache.
@@ -163,6 +163,19 @@ private:
   /// Tracks instructions visited by pointsToConstantMemory.
   SmallPtrSet<const Value *, 16> Visited;
 
+  /// Cache of GEP decompositions for the current query batch, identified by
+  /// AAQueryInfo::BatchID and flushed when a batch with a different id
+  /// starts. Decompositions are only reusable while the IR is unchanged,
+  /// which is exactly the guarantee a batch gives; alias() query streams
+  /// against the same pointers decompose each GEP chain once per batch
+  /// instead of once per query pair. The value carries the decomposition
+  /// and whether it hit the lookup depth limit.
+  uint64_t DecompBatchID = 0;
+  DenseMap<const Value *, std::pair<DecomposedGEP, bool>> DecompCache;
+
+  bool decomposeGEPExpressionCached(const Value *V, DecomposedGEP &Decomposed,
+                                    AAQueryInfo &AAQI);
+
   static const Value *
   GetLinearExpression(const Value *V, APInt &Scale, APInt &Offset,
                       unsigned &ZExtBits, unsigned &SExtBits,
@@ -418,6 +418,20 @@ LazyCallGraph::SCC &updateCGAndAnalysisManagerForFunctionPass(
     LazyCallGraph &G, LazyCallGraph::SCC &C, LazyCallGraph::Node &N,
     CGSCCAnalysisManager &AM, CGSCCUpdateResult &UR);
 
+/// Precompute simple function analyses for every function in \p M before a
+/// post-order CGSCC walk begins, when enabled by the
+/// -cgscc-precompute-function-analyses flag (default off).
+///
+/// Analyses whose computation neither mutates the IR nor touches
+/// LLVMContext-global state (dominator trees and loop info) are computed in
+/// parallel and then seeded into \p FAM from the calling thread, so the
+/// sequential SCC traversal finds them already cached. Does nothing when the
+/// flag is off unless \p Force is set, which callers that are themselves
+/// explicitly requested (such as the precompute-function-analyses pass) use
+/// to bypass the flag.
+void precomputeFunctionAnalyses(Module &M, FunctionAnalysisManager &FAM,
+                                bool Force = false);
+
 /// Adaptor that maps from a SCC to its functions.
 ///
 /// Designed to allow composition of a FunctionPass(Manager) and
@@ -741,6 +755,11 @@ ModuleToPostOrderCGSCCPassAdaptor<CGSCCPassT>::run(Module &M,
   // Get the call graph for this module.
   LazyCallGraph &CG = AM.getResult<LazyCallGraphAnalysis>(M);
 
+  // Optionally warm the function analysis manager in parallel before the
+  // sequential SCC traversal starts.
+  precomputeFunctionAnalyses(
+      M, AM.getResult<FunctionAnalysisManagerModuleProxy>(M).getManager());
+
   // We keep worklists to allow us to push more work onto the pass manager as
   // the passes are run.
   SmallPriorityWorklist<LazyCallGraph::RefSCC *, 1> RCWorklist;
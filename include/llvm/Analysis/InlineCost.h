@@ -13,11 +13,14 @@
 #ifndef LLVM_ANALYSIS_INLINECOST_H
 #define LLVM_ANALYSIS_INLINECOST_H
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/Analysis/AssumptionCache.h"
 #include "llvm/Analysis/CallGraphSCCPass.h"
 #include "llvm/Analysis/OptimizationRemarkEmitter.h"
+#include "llvm/IR/ValueHandle.h"
 #include <cassert>
 #include <climits>
+#include <utility>
 
 namespace llvm {
 class AssumptionCacheTracker;
@@ -232,6 +235,43 @@ getInlineCost(CallBase &Call, Function *Callee, const InlineParams &Params,
 
 /// Minimal filter to detect invalid constructs for inlining.
 InlineResult isInlineViable(Function &Callee);
+
+/// Memoizes isInlineViable() across the call sites of a callee.
+///
+/// The viability walk inspects only the callee's body, so every call site of
+/// a callee gets the same answer until the body changes.  Entries are keyed
+/// on Function::getModificationEpoch() and recomputed once the callee has
+/// been mutated, e.g. by having another function inlined into it.  Deleted
+/// functions drop their entries through a callback value handle so that a
+/// later function allocated at the same address cannot alias a stale entry.
+class InlineViabilityCache {
+  /// Helper that clears the cache entry when the underlying function is
+  /// deleted.
+  class FunctionCallbackVH final : public CallbackVH {
+    InlineViabilityCache *IVC;
+
+    void deleted() override;
+
+  public:
+    using DMI = DenseMapInfo<Value *>;
+
+    FunctionCallbackVH(Value *V, InlineViabilityCache *IVC = nullptr)
+        : CallbackVH(V), IVC(IVC) {}
+  };
+
+  friend FunctionCallbackVH;
+
+  /// Maps a callee to the modification epoch at which the viability walk ran
+  /// and the result it produced.
+  DenseMap<FunctionCallbackVH, std::pair<uint64_t, InlineResult>,
+           FunctionCallbackVH::DMI>
+      Entries;
+
+public:
+  /// Return the viability of inlining \p Callee, re-running the body walk
+  /// only if there is no entry for the callee's current epoch.
+  InlineResult get(Function &Callee);
+};
 }
 
 #endif
@@ -0,0 +1,111 @@
+//===- llvm/Analysis/LoopNestSummary.h - Loop summary analysis --*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines a cheap per-loop summary analysis. Passes in the loop
+// pipeline (LICM, the vectorizer, the unroller) each re-derive the same
+// structural facts about a loop: its latch, its exiting and exit blocks,
+// which values flowing into it are loop-invariant, and which memory it
+// touches. The summary computes these once per loop and serves repeated
+// queries in O(1); the loop pass manager invalidates it like any other loop
+// analysis when a pass fails to preserve loop analyses.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ANALYSIS_LOOPNESTSUMMARY_H
+#define LLVM_ANALYSIS_LOOPNESTSUMMARY_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Analysis/LoopAnalysisManager.h"
+#include "llvm/Analysis/MemoryLocation.h"
+#include "llvm/IR/PassManager.h"
+
+namespace llvm {
+
+class BasicBlock;
+class Loop;
+class LPMUpdater;
+class raw_ostream;
+
+/// Summary of the structural facts about one loop that the loop pipeline
+/// queries repeatedly.
+class LoopNestSummary {
+public:
+  explicit LoopNestSummary(Loop &L);
+
+  /// The unique loop latch, or null if the loop has several.
+  BasicBlock *getLatch() const { return Latch; }
+
+  /// Whether all exit blocks are dominated by the loop, i.e. have no
+  /// predecessors outside it.
+  bool hasDedicatedExits() const { return DedicatedExits; }
+
+  /// Blocks inside the loop with a successor outside of it.
+  ArrayRef<BasicBlock *> getExitingBlocks() const { return ExitingBlocks; }
+
+  /// The unique blocks outside the loop that have a predecessor inside it.
+  ArrayRef<BasicBlock *> getExitBlocks() const { return ExitBlocks; }
+
+  /// Whether \p V is a loop-invariant value referenced by an instruction
+  /// inside the loop.
+  bool isInvariantOperand(const Value *V) const {
+    return InvariantOperands.count(V);
+  }
+
+  /// The set of loop-invariant values referenced inside the loop.
+  const SmallPtrSetImpl<const Value *> &getInvariantOperands() const {
+    return InvariantOperands;
+  }
+
+  /// The memory locations accessed by loads and stores in the loop.
+  ArrayRef<MemoryLocation> getMemoryFootprint() const {
+    return MemoryFootprint;
+  }
+
+  void print(raw_ostream &OS) const;
+
+private:
+  Loop &TheLoop;
+  BasicBlock *Latch;
+  bool DedicatedExits;
+  SmallVector<BasicBlock *, 4> ExitingBlocks;
+  SmallVector<BasicBlock *, 4> ExitBlocks;
+  SmallPtrSet<const Value *, 16> InvariantOperands;
+  SmallVector<MemoryLocation, 8> MemoryFootprint;
+};
+
+/// Analysis pass computing a \c LoopNestSummary for each loop.
+class LoopNestSummaryAnalysis
+    : public AnalysisInfoMixin<LoopNestSummaryAnalysis> {
+  friend AnalysisInfoMixin<LoopNestSummaryAnalysis>;
+
+  static AnalysisKey Key;
+
+public:
+  using Result = LoopNestSummary;
+
+  Result run(Loop &L, LoopAnalysisManager &AM,
+             LoopStandardAnalysisResults &AR);
+};
+
+/// Printer pass for the \c LoopNestSummary results.
+class LoopNestSummaryPrinterPass
+    : public PassInfoMixin<LoopNestSummaryPrinterPass> {
+  raw_ostream &OS;
+
+public:
+  explicit LoopNestSummaryPrinterPass(raw_ostream &OS) : OS(OS) {}
+
+  PreservedAnalyses run(Loop &L, LoopAnalysisManager &AM,
+                        LoopStandardAnalysisResults &AR, LPMUpdater &U);
+};
+
+} // namespace llvm
+
+#endif // LLVM_ANALYSIS_LOOPNESTSUMMARY_H
@@ -237,6 +237,15 @@ public:
       removeMemoryAccess(MA, OptimizePhis);
   }
 
+  /// Remove several MemoryAccesses in one shot. Equivalent to calling
+  /// removeMemoryAccess on each element of \p MAs, except that the phi
+  /// optimization pass implied by \p OptimizePhis runs once over the phis
+  /// touched by the whole batch instead of once per removed access. Passes
+  /// that delete many memory instructions at a time (e.g. dead store
+  /// elimination over a block) should prefer this entry point.
+  void removeMemoryAccesses(ArrayRef<MemoryAccess *> MAs,
+                            bool OptimizePhis = false);
+
   /// Remove all MemoryAcceses in a set of BasicBlocks about to be deleted.
   /// Assumption we make here: all uses of deleted defs and phi must either
   /// occur in blocks about to be deleted (thus will be deleted as well), or
@@ -275,6 +284,11 @@ private:
   getPreviousDefRecursive(BasicBlock *,
                           DenseMap<BasicBlock *, TrackingVH<MemoryAccess>> &);
   MemoryAccess *recursePhi(MemoryAccess *Phi);
+  // Shared core of removeMemoryAccess and removeMemoryAccesses: unhook and
+  // delete MA, collecting phis whose operands changed into PhisToCheck for
+  // the caller to optimize.
+  void removeSingleAccess(MemoryAccess *MA, bool OptimizePhis,
+                          SmallSetVector<MemoryPhi *, 4> &PhisToCheck);
   MemoryAccess *tryRemoveTrivialPhi(MemoryPhi *Phi);
   template <class RangeType>
   MemoryAccess *tryRemoveTrivialPhi(MemoryPhi *Phi, RangeType &Operands);
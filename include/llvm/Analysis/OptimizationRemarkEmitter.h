@@ -19,6 +19,7 @@
 #include "llvm/IR/DiagnosticInfo.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/PassManager.h"
+#include "llvm/IR/RemarkStreamer.h"
 #include "llvm/Pass.h"
 
 namespace llvm {
@@ -92,8 +93,10 @@ public:
   /// provide more context so that non-trivial false positives can be quickly
   /// detected by the user.
   bool allowExtraAnalysis(StringRef PassName) const {
-    return (F->getContext().getRemarkStreamer() ||
-            F->getContext().getDiagHandlerPtr()->isAnyRemarkEnabled(PassName));
+    if (RemarkStreamer *RS = F->getContext().getRemarkStreamer())
+      if (RS->matchesFilter(PassName))
+        return true;
+    return F->getContext().getDiagHandlerPtr()->isAnyRemarkEnabled(PassName);
   }
 
 private:
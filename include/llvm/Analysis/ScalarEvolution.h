@@ -1200,6 +1200,22 @@ private:
   /// Memoized values for the GetMinTrailingZeros
   DenseMap<const SCEV *, uint32_t> MinTrailingZerosCache;
 
+  /// Cache of extension folds, in front of the uniquing table. When an
+  /// extension of an operand folds to some other expression, the early
+  /// FindNodeOrInsertPos check in the extension routines never hits and the
+  /// full recursive analysis would otherwise rerun on every query. Keyed by
+  /// (scZeroExtend/scSignExtend, operand, type).
+  using ExtFoldKey = std::pair<std::pair<unsigned, const SCEV *>, Type *>;
+  DenseMap<ExtFoldKey, const SCEV *> ExtFoldCache;
+
+  /// Reverse mapping from a SCEV appearing in ExtFoldCache (as operand or
+  /// result) to the keys it appears under, for forgetMemoizedResults.
+  DenseMap<const SCEV *, SmallVector<ExtFoldKey, 2>> ExtFoldCacheUser;
+
+  const SCEV *getZeroExtendExprImpl(const SCEV *Op, Type *Ty, unsigned Depth);
+  const SCEV *getSignExtendExprImpl(const SCEV *Op, Type *Ty, unsigned Depth);
+  void insertExtFoldCacheEntry(const ExtFoldKey &Key, const SCEV *S);
+
   /// Return the Value set from which the SCEV expr is generated.
   SetVector<ValueOffsetPair> *getSCEVValues(const SCEV *S);
 
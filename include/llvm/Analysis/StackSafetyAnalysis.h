@@ -16,6 +16,8 @@
 #include "llvm/IR/PassManager.h"
 #include "llvm/Pass.h"
 
+#include <map>
+
 namespace llvm {
 
 /// Interface to access stack safety analysis results for single function.
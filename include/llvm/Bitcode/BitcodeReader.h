@@ -89,6 +89,12 @@ class Module;
 
     StringRef getStrtab() const { return Strtab; }
 
+    /// Override the string table used to interpret this module. Intended for
+    /// modules written against a shared external string table (see the
+    /// BitcodeWriter constructor taking a StringTableBuilder); must be called
+    /// before the module is parsed.
+    void setStrtab(StringRef S) { Strtab = S; }
+
     StringRef getModuleIdentifier() const { return ModuleIdentifier; }
 
     /// Read the bitcode module and prepare for lazy deserialization of function
@@ -118,6 +124,11 @@ class Module;
   struct BitcodeFileContents {
     std::vector<BitcodeModule> Mods;
     StringRef Symtab, StrtabForSymtab;
+
+    /// The last top-level string table in the file, if any. For
+    /// string-table-only files holding a table shared by several module
+    /// files, this is how the table is retrieved.
+    StringRef Strtab;
   };
 
   /// Returns the contents of a bitcode file. This includes the raw contents of
@@ -32,7 +32,12 @@ class raw_ostream;
     SmallVectorImpl<char> &Buffer;
     std::unique_ptr<BitstreamWriter> Stream;
 
-    StringTableBuilder StrtabBuilder{StringTableBuilder::RAW};
+    StringTableBuilder OwnedStrtabBuilder{StringTableBuilder::RAW};
+    StringTableBuilder &StrtabBuilder;
+
+    /// True if StrtabBuilder refers to a caller-owned table shared between
+    /// several writers; such a writer does not emit the table itself.
+    const bool UsesSharedStrtab;
 
     // Owns any strings created by the irsymtab writer until we create the
     // string table.
@@ -48,6 +53,18 @@ class raw_ostream;
     /// Create a BitcodeWriter that writes to Buffer.
     BitcodeWriter(SmallVectorImpl<char> &Buffer);
 
+    /// Create a BitcodeWriter that records its strings in \p SharedStrtab
+    /// instead of a table of its own. Several writers (one output file each)
+    /// may share one builder, deduplicating names across all of them; name
+    /// offsets stay valid because bitcode string tables are finalized in
+    /// insertion order. The caller must not call writeStrtab() on such a
+    /// writer unless it is the one designated to emit the table: once all
+    /// sharing writers have finished adding names, call writeStrtab() on
+    /// exactly one of them (typically one writing a string-table-only file)
+    /// and skip it on the rest. Readers attach the shared table to each
+    /// module with BitcodeModule::setStrtab() before parsing.
+    BitcodeWriter(SmallVectorImpl<char> &Buffer, StringTableBuilder &SharedStrtab);
+
     ~BitcodeWriter();
 
     /// Attempt to write a symbol table to the bitcode file. This must be called
@@ -0,0 +1,96 @@
+//===- SummaryGUIDTable.h - Flat GUID sidecar for summaries -----*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// A fixed-layout sidecar holding the sorted global value GUIDs of a module
+// summary index. The thin link phase frequently only needs to know whether a
+// module's summary mentions a GUID (e.g. to filter import candidates); the
+// sidecar answers that with a binary search over a memory-mapped buffer,
+// without decoding any bitcode records.
+//
+// Layout (all fields little-endian):
+//   uint32_t Magic;    // 'LLGT'
+//   uint32_t Version;  // currently 1
+//   uint64_t NumGUIDs;
+//   uint64_t GUIDs[NumGUIDs];  // sorted ascending
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_BITCODE_SUMMARYGUIDTABLE_H
+#define LLVM_BITCODE_SUMMARYGUIDTABLE_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/IR/GlobalValue.h"
+#include "llvm/Support/Endian.h"
+
+namespace llvm {
+
+class ModuleSummaryIndex;
+class raw_ostream;
+
+/// Write the sorted GUID table for \p Index to \p Out; a sidecar companion to
+/// WriteIndexToFile.
+void writeSummaryGUIDTable(const ModuleSummaryIndex &Index, raw_ostream &Out);
+
+/// Read-only view of a summary GUID table, typically over a memory-mapped
+/// file. Does not own the underlying buffer.
+class SummaryGUIDTableRef {
+  StringRef Data;
+  uint64_t NumGUIDs = 0;
+
+  static constexpr uint32_t Magic = 0x4C4C4754; // 'LLGT'
+  static constexpr uint32_t Version = 1;
+  static constexpr size_t HeaderSize = 16;
+
+  uint64_t getGUID(uint64_t I) const {
+    return support::endian::read64le(Data.data() + HeaderSize + I * 8);
+  }
+
+  friend void writeSummaryGUIDTable(const ModuleSummaryIndex &Index,
+                                    raw_ostream &Out);
+
+public:
+  SummaryGUIDTableRef() = default;
+
+  /// Validate \p Buffer as a GUID table and create a view of it. Returns
+  /// false on a malformed buffer, leaving the view empty.
+  bool init(StringRef Buffer) {
+    if (Buffer.size() < HeaderSize ||
+        support::endian::read32le(Buffer.data()) != Magic ||
+        support::endian::read32le(Buffer.data() + 4) != Version)
+      return false;
+    uint64_t N = support::endian::read64le(Buffer.data() + 8);
+    if (Buffer.size() < HeaderSize + N * 8)
+      return false;
+    Data = Buffer;
+    NumGUIDs = N;
+    return true;
+  }
+
+  uint64_t size() const { return NumGUIDs; }
+  bool empty() const { return NumGUIDs == 0; }
+
+  /// Binary-search the table for \p GUID.
+  bool contains(GlobalValue::GUID GUID) const {
+    uint64_t Lo = 0, Hi = NumGUIDs;
+    while (Lo < Hi) {
+      uint64_t Mid = Lo + (Hi - Lo) / 2;
+      uint64_t V = getGUID(Mid);
+      if (V < GUID)
+        Lo = Mid + 1;
+      else if (V > GUID)
+        Hi = Mid;
+      else
+        return true;
+    }
+    return false;
+  }
+};
+
+} // end namespace llvm
+
+#endif // LLVM_BITCODE_SUMMARYGUIDTABLE_H
@@ -229,55 +229,75 @@ public:
     return R;
   }
 
-  Expected<uint32_t> ReadVBR(unsigned NumBits) {
-    Expected<unsigned> MaybeRead = Read(NumBits);
-    if (!MaybeRead)
-      return MaybeRead;
-    uint32_t Piece = MaybeRead.get();
-
-    if ((Piece & (1U << (NumBits-1))) == 0)
-      return Piece;
+  /// The number of bits that readBitsFromCurrentWord() can consume before the
+  /// buffered word needs refilling through Read().
+  unsigned bitsInCurrentWord() const { return BitsInCurWord; }
+
+  /// Read \p NumBits straight out of the buffered word; the caller must have
+  /// checked bitsInCurrentWord() first. Lets decode loops extract several
+  /// small fields per buffered word without the cost of Read()'s boundary
+  /// handling.
+  word_t readBitsFromCurrentWord(unsigned NumBits) {
+    assert(NumBits && NumBits <= BitsInCurWord &&
+           "Field not contained in the buffered word");
+    word_t R = CurWord & (~word_t(0) >> (MaxChunkSize - NumBits));
+    // Use a mask to avoid undefined behavior; see Read().
+    CurWord >>= (NumBits & (sizeof(word_t) > 4 ? 0x3f : 0x1f));
+    BitsInCurWord -= NumBits;
+    return R;
+  }
 
+  Expected<uint32_t> ReadVBR(unsigned NumBits) {
+    const uint32_t HiMask = 1U << (NumBits - 1);
     uint32_t Result = 0;
     unsigned NextBit = 0;
     while (true) {
-      Result |= (Piece & ((1U << (NumBits-1))-1)) << NextBit;
+      uint32_t Piece;
+      // Decode chunks straight out of the buffered word when it has enough
+      // bits; the general Read() path is only needed at word boundaries.
+      // Multi-chunk VBRs are common enough that the per-chunk call overhead
+      // shows up in decode profiles.
+      if (LLVM_LIKELY(BitsInCurWord >= NumBits)) {
+        Piece = readBitsFromCurrentWord(NumBits);
+      } else {
+        Expected<word_t> MaybeRead = Read(NumBits);
+        if (!MaybeRead)
+          return MaybeRead.takeError();
+        Piece = MaybeRead.get();
+      }
 
-      if ((Piece & (1U << (NumBits-1))) == 0)
-        return Result;
+      if ((Piece & HiMask) == 0)
+        return Result | (Piece << NextBit);
 
-      NextBit += NumBits-1;
-      MaybeRead = Read(NumBits);
-      if (!MaybeRead)
-        return MaybeRead;
-      Piece = MaybeRead.get();
+      Result |= (Piece & (HiMask - 1)) << NextBit;
+      NextBit += NumBits - 1;
     }
   }
 
   // Read a VBR that may have a value up to 64-bits in size. The chunk size of
   // the VBR must still be <= 32 bits though.
   Expected<uint64_t> ReadVBR64(unsigned NumBits) {
-    Expected<uint64_t> MaybeRead = Read(NumBits);
-    if (!MaybeRead)
-      return MaybeRead;
-    uint32_t Piece = MaybeRead.get();
-
-    if ((Piece & (1U << (NumBits-1))) == 0)
-      return uint64_t(Piece);
-
+    const uint32_t HiMask = 1U << (NumBits - 1);
     uint64_t Result = 0;
     unsigned NextBit = 0;
     while (true) {
-      Result |= uint64_t(Piece & ((1U << (NumBits-1))-1)) << NextBit;
+      uint32_t Piece;
+      // See ReadVBR() for why chunks are pulled out of the buffered word
+      // directly.
+      if (LLVM_LIKELY(BitsInCurWord >= NumBits)) {
+        Piece = readBitsFromCurrentWord(NumBits);
+      } else {
+        Expected<word_t> MaybeRead = Read(NumBits);
+        if (!MaybeRead)
+          return MaybeRead.takeError();
+        Piece = MaybeRead.get();
+      }
 
-      if ((Piece & (1U << (NumBits-1))) == 0)
-        return Result;
+      if ((Piece & HiMask) == 0)
+        return Result | (uint64_t(Piece) << NextBit);
 
-      NextBit += NumBits-1;
-      MaybeRead = Read(NumBits);
-      if (!MaybeRead)
-        return MaybeRead;
-      Piece = MaybeRead.get();
+      Result |= uint64_t(Piece & (HiMask - 1)) << NextBit;
+      NextBit += NumBits - 1;
     }
   }
 
@@ -15,6 +15,7 @@
 #ifndef LLVM_CODEGEN_ASMPRINTER_H
 #define LLVM_CODEGEN_ASMPRINTER_H
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
@@ -185,6 +186,14 @@ private:
   /// If the current module uses dwarf CFI annotations strictly for debugging.
   bool isCFIMoveForDebugging = false;
 
+  /// Constant pool entries already emitted into a given section, with the
+  /// symbol and alignment of the first copy. Identical entries spilled by
+  /// later functions are emitted as aliases of the first copy instead of
+  /// duplicating the data. \see EmitConstantPool.
+  DenseMap<std::pair<const MCSection *, const Constant *>,
+           std::pair<MCSymbol *, unsigned>>
+      EmittedConstantPoolEntries;
+
 protected:
   explicit AsmPrinter(TargetMachine &TM, std::unique_ptr<MCStreamer> Streamer);
 
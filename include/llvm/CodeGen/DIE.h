@@ -798,6 +798,28 @@ public:
   unsigned computeOffsetsAndAbbrevs(const AsmPrinter *AP,
                                     DIEAbbrevSet &AbbrevSet, unsigned CUOffset);
 
+  /// Unique the abbreviations for this DIE and all its children and fill in
+  /// their abbreviation codes, without computing offsets.
+  ///
+  /// This is the only part of offset computation that touches shared state
+  /// (the abbreviation set is shared by all units in a DwarfFile). Running it
+  /// up front for every unit allows \a computeOffsets() to size the units in
+  /// parallel afterwards.
+  void assignAbbrevs(DIEAbbrevSet &AbbrevSet);
+
+  /// Compute the offset and size of this DIE and all its children.
+  ///
+  /// Requires abbreviation numbers to have been filled in already, either by
+  /// \a computeOffsetsAndAbbrevs() or \a assignAbbrevs(); the abbreviation
+  /// code's ULEB size contributes to each DIE's size. Touches no state outside
+  /// the DIE tree, so distinct units may be sized concurrently.
+  ///
+  /// \param AP AsmPrinter to use when calculating sizes.
+  /// \param CUOffset the compile/type unit relative offset in bytes.
+  /// \returns the offset for the DIE that follows this DIE within the
+  /// current compile/type unit.
+  unsigned computeOffsets(const AsmPrinter *AP, unsigned CUOffset);
+
   /// Climb up the parent chain to get the compile unit or type unit DIE that
   /// this DIE belongs to.
   ///
@@ -82,19 +82,20 @@ private:
     inline const_vreg_iterator vregs_end() const { return ValToVRegs.end(); }
 
     VRegListT *getVRegs(const Value &V) {
-      auto It = ValToVRegs.find(&V);
-      if (It != ValToVRegs.end())
-        return It->second;
-
-      return insertVRegs(V);
+      // Single probe: try_emplace both finds the existing list and claims the
+      // slot for a new one, which matters on huge functions where this is
+      // called for every operand.
+      auto P = ValToVRegs.try_emplace(&V, nullptr);
+      if (P.second)
+        P.first->second = new (VRegAlloc.Allocate()) VRegListT();
+      return P.first->second;
     }
 
     OffsetListT *getOffsets(const Value &V) {
-      auto It = TypeToOffsets.find(V.getType());
-      if (It != TypeToOffsets.end())
-        return It->second;
-
-      return insertOffsets(V);
+      auto P = TypeToOffsets.try_emplace(V.getType(), nullptr);
+      if (P.second)
+        P.first->second = new (OffsetAlloc.Allocate()) OffsetListT();
+      return P.first->second;
     }
 
     const_vreg_iterator findVRegs(const Value &V) const {
@@ -105,6 +106,10 @@ private:
       return ValToVRegs.find(&V) != ValToVRegs.end();
     }
 
+    /// Pre-size the value map for \p NumValues entries so that translating a
+    /// huge function does not repeatedly rehash it as it grows.
+    void reserve(size_t NumValues) { ValToVRegs.reserve(NumValues); }
+
     void reset() {
       ValToVRegs.clear();
       TypeToOffsets.clear();
@@ -113,24 +118,8 @@ private:
     }
 
   private:
-    VRegListT *insertVRegs(const Value &V) {
-      assert(ValToVRegs.find(&V) == ValToVRegs.end() && "Value already exists");
-
-      // We placement new using our fast allocator since we never try to free
-      // the vectors until translation is finished.
-      auto *VRegList = new (VRegAlloc.Allocate()) VRegListT();
-      ValToVRegs[&V] = VRegList;
-      return VRegList;
-    }
-
-    OffsetListT *insertOffsets(const Value &V) {
-      assert(TypeToOffsets.find(V.getType()) == TypeToOffsets.end() &&
-             "Type already exists");
-
-      auto *OffsetList = new (OffsetAlloc.Allocate()) OffsetListT();
-      TypeToOffsets[V.getType()] = OffsetList;
-      return OffsetList;
-    }
+    // We placement new using our fast allocator since we never try to free
+    // the vectors until translation is finished.
     SpecificBumpPtrAllocator<VRegListT> VRegAlloc;
     SpecificBumpPtrAllocator<OffsetListT> OffsetAlloc;
 
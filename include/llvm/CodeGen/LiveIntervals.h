@@ -310,6 +310,15 @@ class VirtRegMap;
     /// \param UpdateFlags Update live intervals for nonallocatable physregs.
     void handleMove(MachineInstr &MI, bool UpdateFlags = false);
 
+    /// Call this method to notify LiveIntervals that instruction \p MI has
+    /// been moved across basic block boundaries. Unlike handleMove, no attempt
+    /// is made to patch segments in place; the slot index maps are updated and
+    /// each virtual register the instruction touches is recomputed from its
+    /// uses, since a cross-block move can extend a range into blocks it did
+    /// not previously reach. Cached register unit ranges for any physical
+    /// register operands are discarded and recomputed lazily.
+    void handleMoveAcrossBlocks(MachineInstr &MI);
+
     /// Update intervals for operands of \p MI so that they begin/end on the
     /// SlotIndex for \p BundleStart.
     ///
@@ -80,6 +80,12 @@ public:
   /// caches are invalidated.
   void invalidateVirtRegs() { ++UserTag; }
 
+  /// Return an opaque value that changes whenever virtual registers may have
+  /// been modified. Interference results stamped with this value and the
+  /// relevant union tags (see LiveIntervalUnion::getTag) remain valid until
+  /// either changes.
+  unsigned getUserTag() const { return UserTag; }
+
   enum InterferenceKind {
     /// No interference, go ahead and assign.
     IK_Free = 0,
@@ -0,0 +1,51 @@
+//===- MIRSnapshot.h - Binary MachineFunction snapshots ---------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// A compact binary serialization of MachineFunction state, intended for
+// checkpointing a post-ISel pipeline and restoring it elsewhere. Unlike the
+// textual MIR format, the encoding is fixed-width and string-table backed, so
+// writing is a single pass over the function and reading works directly out
+// of a memory-mapped buffer without lexing.
+//
+// The format is explicitly NOT stable across LLVM revisions: opcode and
+// register numbers are target-generated, so writer and reader must be built
+// from the same sources and configured for the same target. The reader
+// assumes the IR module (for global and external symbol resolution) is
+// available on the restoring side.
+//
+// Fidelity limitations, diagnosed as errors where they would otherwise be
+// silent: operands that reference in-memory IR objects other than globals
+// (block addresses, metadata, CFI indices, ...) are not encoded. Memory
+// operands and debug locations are dropped, which is conservative for
+// correctness but loses alias precision and line info.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CODEGEN_MIRSNAPSHOT_H
+#define LLVM_CODEGEN_MIRSNAPSHOT_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Error.h"
+
+namespace llvm {
+
+class MachineFunction;
+class raw_ostream;
+
+/// Serialize \p MF into the binary snapshot format. Returns an error if the
+/// function contains state the format cannot represent.
+Error writeMIRSnapshot(raw_ostream &OS, const MachineFunction &MF);
+
+/// Restore \p MF from a binary snapshot in \p Buffer. The existing body of
+/// \p MF is discarded. \p Buffer must stay alive for the duration of the
+/// call only; no references into it are retained.
+Error readMIRSnapshot(StringRef Buffer, MachineFunction &MF);
+
+} // end namespace llvm
+
+#endif // LLVM_CODEGEN_MIRSNAPSHOT_H
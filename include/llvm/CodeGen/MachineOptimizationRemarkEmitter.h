@@ -17,6 +17,7 @@
 
 #include "llvm/Analysis/OptimizationRemarkEmitter.h"
 #include "llvm/CodeGen/MachineFunctionPass.h"
+#include "llvm/IR/RemarkStreamer.h"
 
 namespace llvm {
 class MachineBasicBlock;
@@ -158,10 +159,11 @@ public:
   /// (1) to filter trivial false positives or (2) to provide more context so
   /// that non-trivial false positives can be quickly detected by the user.
   bool allowExtraAnalysis(StringRef PassName) const {
-    return (
-        MF.getFunction().getContext().getRemarkStreamer() ||
-        MF.getFunction().getContext().getDiagHandlerPtr()->isAnyRemarkEnabled(
-            PassName));
+    LLVMContext &Ctx = MF.getFunction().getContext();
+    if (RemarkStreamer *RS = Ctx.getRemarkStreamer())
+      if (RS->matchesFilter(PassName))
+        return true;
+    return Ctx.getDiagHandlerPtr()->isAnyRemarkEnabled(PassName);
   }
 
   /// Take a lambda that returns a remark which will be emitted.  Second
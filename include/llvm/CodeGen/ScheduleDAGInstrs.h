@@ -40,6 +40,7 @@ namespace llvm {
   class MachineFunction;
   class MachineInstr;
   class MachineLoopInfo;
+  class MachineMemOperand;
   class MachineOperand;
   struct MCSchedClassDesc;
   class PressureDiffs;
@@ -176,6 +177,14 @@ namespace llvm {
 
     AAResults *AAForDep = nullptr;
 
+    /// Memoized verdicts of the alias queries made while adding chain
+    /// dependencies, keyed on the pair of memory operands involved. The same
+    /// SUnit pair is re-queried once per underlying value the instructions
+    /// share, and instructions cloned from the same access share their memory
+    /// operands, so the verdict can be reused. Cleared per buildSchedGraph.
+    DenseMap<std::pair<const MachineMemOperand *, const MachineMemOperand *>,
+             bool> AliasCache;
+
     /// Remember a generic side-effecting instruction as we proceed.
     /// No other SU ever gets scheduled around it (except in the special
     /// case of a huge region that gets reduced).
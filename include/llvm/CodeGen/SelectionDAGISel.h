@@ -120,6 +120,11 @@ public:
   // Opcodes used by the DAG state machine:
   enum BuiltinOpcodes {
     OPC_Scope,
+    // Unconditional transfer to a shared subtree emitted earlier in the
+    // table (absolute VBR index). Matcher subtrees always terminate in a
+    // completion or a failure that unwinds through the scope stack, so
+    // shared bodies need no return address.
+    OPC_Jump,
     OPC_RecordNode,
     OPC_RecordChild0, OPC_RecordChild1, OPC_RecordChild2, OPC_RecordChild3,
     OPC_RecordChild4, OPC_RecordChild5, OPC_RecordChild6, OPC_RecordChild7,
@@ -140,6 +145,7 @@ public:
     OPC_CheckType,
     OPC_CheckTypeRes,
     OPC_SwitchType,
+    OPC_CheckOpcodeAndType,
     OPC_CheckChild0Type, OPC_CheckChild1Type, OPC_CheckChild2Type,
     OPC_CheckChild3Type, OPC_CheckChild4Type, OPC_CheckChild5Type,
     OPC_CheckChild6Type, OPC_CheckChild7Type,
@@ -40,6 +40,14 @@ class TargetSchedModel {
   unsigned MicroOpFactor; // Multiply to normalize microops to resource units.
   unsigned ResourceLCM;   // Resource units per cycle. Latency normalization factor.
 
+  // Flattened per-sched-class latency table, filled lazily. Non-variant
+  // scheduling classes produce the same latency for every instance, so the
+  // write-resource walk in MCSchedModel::computeInstrLatency only needs to
+  // happen once per class. Variant classes depend on the instruction and are
+  // never cached; their entries stay InvalidLatency.
+  enum : unsigned { InvalidLatency = ~0u };
+  mutable std::vector<unsigned> SchedClassLatencyTable;
+
   unsigned computeInstrLatency(const MCSchedClassDesc &SCDesc) const;
 
 public:
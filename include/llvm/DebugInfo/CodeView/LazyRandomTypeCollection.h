@@ -70,6 +70,13 @@ public:
 
   uint32_t getOffsetOfType(TypeIndex Index);
 
+  /// Materialize every record in the stream with a single sequential pass.
+  /// The random access interface scans a chunk of the stream per query, which
+  /// is the right trade-off for sparse access patterns.  A caller that knows
+  /// it is going to touch every record anyway can use this to decode the
+  /// whole stream up front instead of one chunk at a time.
+  void visitAllRecords();
+
   Optional<CVType> tryGetType(TypeIndex Index);
 
   CVType getType(TypeIndex Index) override;
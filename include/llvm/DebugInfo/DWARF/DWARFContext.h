@@ -40,6 +40,7 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace llvm {
 
@@ -91,6 +92,21 @@ class DWARFContext : public DIContext {
 
   std::unique_ptr<MCRegisterInfo> RegInfo;
 
+  /// Locks that allow one DWARFContext to be shared between threads issuing
+  /// symbolization queries (getLineInfoForAddress and friends). They guard
+  /// the lazily constructed unit lists, unit indexes, abbreviation tables,
+  /// line tables, location lists and address range table; DIE extraction
+  /// within a unit is
+  /// guarded by a per-unit lock in DWARFUnit. dump() and verify() remain
+  /// single-threaded.
+  std::mutex UnitsMutex;
+  std::mutex IndexMutex;
+  std::mutex AbbrevMutex;
+  std::mutex LineMutex;
+  std::mutex LocMutex;
+  std::mutex ArangesMutex;
+  std::mutex DWOFilesMutex;
+
   /// Read compile units from the debug_info section (if necessary)
   /// and type units from the debug_types sections (if necessary)
   /// and store them in NormalUnits.
@@ -266,6 +282,18 @@ public:
   /// Get a pointer to the parsed DebugAranges object.
   const DWARFDebugAranges *getDebugAranges();
 
+  /// Populate the address range table from a buffer previously produced by
+  /// writeArangesCache(), avoiding the DIE walk that building the table
+  /// normally requires. Returns false if the buffer is not a valid cache, in
+  /// which case the table is built from debug info on first use as usual.
+  /// The caller must ensure the cache was produced from this binary, e.g. by
+  /// comparing file modification times.
+  bool loadArangesCache(StringRef Data);
+
+  /// Build the address range table if necessary and write it in the
+  /// serialized form accepted by loadArangesCache().
+  void writeArangesCache(raw_ostream &OS);
+
   /// Get a pointer to the parsed frame information object.
   const DWARFDebugFrame *getDebugFrame();
 
@@ -13,6 +13,7 @@
 #include "llvm/Support/DataExtractor.h"
 #include <cstdint>
 #include <map>
+#include <mutex>
 #include <vector>
 
 namespace llvm {
@@ -58,6 +59,10 @@ class DWARFDebugAbbrev {
   mutable DWARFAbbreviationDeclarationSetMap AbbrDeclSets;
   mutable DWARFAbbreviationDeclarationSetMap::const_iterator PrevAbbrOffsetPos;
   mutable Optional<DataExtractor> Data;
+  /// Guards the lazily parsed state above. One abbreviation table is shared
+  /// by all units of a context, so concurrent DIE extraction from different
+  /// units must serialize here.
+  mutable std::mutex ParseMutex;
 
 public:
   DWARFDebugAbbrev();
@@ -10,6 +10,7 @@
 #define LLVM_DEBUGINFO_DWARFDEBUGARANGES_H
 
 #include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/Support/DataExtractor.h"
 #include <cstdint>
 #include <vector>
@@ -17,12 +18,25 @@
 namespace llvm {
 
 class DWARFContext;
+class raw_ostream;
 
 class DWARFDebugAranges {
 public:
   void generate(DWARFContext *CTX);
   uint32_t findAddress(uint64_t Address) const;
 
+  /// Write the constructed range index in a stable little-endian format, so
+  /// that a later process can rebuild it with deserialize() instead of
+  /// re-walking every DIE. Must be called after generate().
+  void serialize(raw_ostream &OS) const;
+
+  /// Populate the range index from a buffer produced by serialize().
+  /// Returns false (leaving the index empty) if the buffer is not a valid
+  /// serialized index. The caller is responsible for checking that the
+  /// buffer was produced from the same binary, e.g. by comparing file
+  /// modification times.
+  bool deserialize(StringRef Data);
+
 private:
   void clear();
   void extract(DataExtractor DebugArangesData);
@@ -126,6 +126,38 @@ private:
                     uint64_t Operand) const;
 };
 
+/// The rule for computing the Canonical Frame Address (CFA) over a range of
+/// program counters. Nearly all CFA definitions reduce to the value of a
+/// register plus a constant offset, which a consumer can evaluate with a
+/// single register read instead of re-interpreting CFI (or DWARF expression)
+/// operations on every evaluation; definitions that do not reduce keep the
+/// defining expression instead.
+struct CFARule {
+  enum RuleKind : uint8_t {
+    /// No CFA has been established at this program point.
+    Undefined,
+    /// The CFA is the value of Register plus Offset.
+    RegisterPlusOffset,
+    /// The CFA is the result of evaluating Expr.
+    Expression
+  };
+
+  RuleKind Kind = Undefined;
+  uint64_t Register = 0;
+  int64_t Offset = 0;
+  /// Set when the CFA is defined by a DWARF expression that could not be
+  /// reduced to a register + offset pair.
+  Optional<DWARFExpression> Expr;
+};
+
+/// A row of the CFA table synthesized from an FDE. The rule is in effect
+/// from Address up to the Address of the next row, or up to the end of the
+/// FDE's address range for the last row.
+struct CFARow {
+  uint64_t Address;
+  CFARule Rule;
+};
+
 /// An entry in either debug_frame or eh_frame. This entry can be a CIE or an
 /// FDE.
 class FrameEntry {
@@ -248,6 +280,18 @@ public:
 
   static bool classof(const FrameEntry *FE) { return FE->getKind() == FK_FDE; }
 
+  /// Return the CFA table for this FDE. The table is synthesized from the
+  /// linked CIE's initial instructions followed by this FDE's instructions on
+  /// the first call and then cached, so clients that evaluate the same FDE
+  /// many times (e.g. a profiler unwinding hot stacks) pay for the CFI
+  /// interpretation only once. Rows are sorted by address.
+  ArrayRef<CFARow> getCFATable() const;
+
+  /// Find the CFA rule in effect at \p Address with a binary search of the
+  /// precomputed CFA table. Returns None if the address is outside this FDE's
+  /// address range or precedes the first table row.
+  Optional<CFARule> getCFARuleForAddress(uint64_t Address) const;
+
 private:
   /// The following fields are defined in section 6.4.1 of the DWARF standard v3
   const uint64_t LinkedCIEOffset;
@@ -255,6 +299,9 @@ private:
   const uint64_t AddressRange;
   const CIE *LinkedCIE;
   const Optional<uint64_t> LSDAAddress;
+
+  /// Lazily computed cache for getCFATable().
+  mutable Optional<std::vector<CFARow>> CFATable;
 };
 
 } // end namespace dwarf
@@ -314,6 +314,12 @@ public:
       const DWARFContext &Ctx, const DWARFUnit *U,
       std::function<void(Error)> RecoverableErrorCallback);
 
+  /// Cache a line table that was parsed with LineTable::parse outside this
+  /// object. If a table is already cached at \p Offset, the new table is
+  /// discarded and the cached one returned. This lets callers parse tables
+  /// for different units concurrently and publish the results under a lock.
+  const LineTable *addLineTable(uint64_t Offset, LineTable &&LT);
+
   /// Helper to allow for parsing of an entire .debug_line section in sequence.
   class SectionParser {
   public:
@@ -10,9 +10,11 @@
 #define LLVM_DEBUGINFO_DWARFEXPRESSION_H
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/Optional.h"
 #include "llvm/ADT/iterator.h"
 #include "llvm/ADT/iterator_range.h"
 #include "llvm/Support/DataExtractor.h"
+#include <utility>
 
 namespace llvm {
 class DWARFUnit;
@@ -140,6 +142,14 @@ public:
 
   bool verify(DWARFUnit *U);
 
+  /// If the expression consists of exactly one operation computing a register
+  /// plus a constant offset (DW_OP_bregN or DW_OP_bregx), return the register
+  /// number and the offset. Frequently evaluated expressions, most notably
+  /// CFA definitions, almost always take this form; a client can compute the
+  /// pair once and then evaluate the expression with a single register read
+  /// and an addition instead of interpreting it operation by operation.
+  Optional<std::pair<uint64_t, int64_t>> getAsRegisterPlusOffset() const;
+
 private:
   DataExtractor Data;
   uint16_t Version;
@@ -30,6 +30,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -231,6 +232,12 @@ class DWARFUnit {
   /// std::map::upper_bound for address range lookup.
   std::map<uint64_t, std::pair<uint64_t, DWARFDie>> AddrDieMap;
 
+  /// Guards lazy extraction of DieArray, the population of AddrDieMap, and
+  /// the loading of the split-DWARF unit, so that one DWARFContext can serve
+  /// symbolization queries from multiple threads. Recursive because DIE
+  /// extraction re-enters the unit through DWARFDie helpers.
+  std::recursive_mutex ExtractionMutex;
+
   using die_iterator_range =
       iterator_range<std::vector<DWARFDebugInfoEntry>::iterator>;
 
@@ -9,6 +9,7 @@
 #ifndef LLVM_DEBUGINFO_DWARF_DWARFVERIFIER_H
 #define LLVM_DEBUGINFO_DWARF_DWARFVERIFIER_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/DebugInfo/DIContext.h"
 #include "llvm/DebugInfo/DWARF/DWARFAcceleratorTable.h"
 #include "llvm/DebugInfo/DWARF/DWARFAddressRange.h"
@@ -158,6 +159,16 @@ private:
   /// \returns The number of errors that occurred during verification.
   unsigned verifyUnitContents(DWARFUnit &Unit);
 
+  /// Verifies the contents of each unit in \p Units, in parallel when several
+  /// units are present.
+  ///
+  /// Each unit's diagnostics are buffered and emitted in unit order, so the
+  /// output is deterministic regardless of scheduling. References collected
+  /// while verifying each unit are merged into ReferenceToDIEOffsets.
+  ///
+  /// \returns The number of errors that occurred during verification.
+  unsigned verifyUnits(ArrayRef<DWARFUnit *> Units);
+
   /// Verifies the unit headers and contents in a .debug_info or .debug_types
   /// section.
   ///
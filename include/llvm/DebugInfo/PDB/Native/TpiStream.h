@@ -9,6 +9,7 @@
 #ifndef LLVM_DEBUGINFO_PDB_RAW_PDBTPISTREAM_H
 #define LLVM_DEBUGINFO_PDB_RAW_PDBTPISTREAM_H
 
+#include "llvm/DebugInfo/CodeView/TypeHashing.h"
 #include "llvm/DebugInfo/CodeView/TypeRecord.h"
 #include "llvm/DebugInfo/PDB/Native/HashTable.h"
 #include "llvm/DebugInfo/PDB/Native/RawConstants.h"
@@ -70,6 +71,15 @@ public:
 
   void buildHashMap();
 
+  /// Decode every record in the stream and compute its global hash (see
+  /// GloballyHashedType) in one bulk pass, caching the result.  For the IPI
+  /// stream, pass the TPI stream's hashes as \p TypeHashes so that item
+  /// records which refer back to type records hash correctly; for the TPI
+  /// stream leave it empty.  The returned array is indexed by array index,
+  /// i.e. TypeIndex minus TypeIndexBegin().
+  ArrayRef<codeview::GloballyHashedType>
+  getGlobalHashes(ArrayRef<codeview::GloballyHashedType> TypeHashes = {});
+
   bool supportsTypeLookup() const;
 
 private:
@@ -89,6 +99,8 @@ private:
 
   std::vector<std::vector<codeview::TypeIndex>> HashMap;
 
+  std::vector<codeview::GloballyHashedType> GlobalHashes;
+
   const TpiStreamHeader *Header;
 };
 }
@@ -44,6 +44,10 @@ public:
     std::vector<std::string> DsymHints;
     std::string FallbackDebugPath;
     std::string DWPName;
+    /// Cache the DWARF address-range index in a sidecar file next to each
+    /// binary and reuse it across invocations instead of re-walking every
+    /// DIE. The cache is ignored if it is older than the binary.
+    bool UseArangesCache = false;
   };
 
   LLVMSymbolizer() = default;
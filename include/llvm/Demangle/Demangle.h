@@ -11,6 +11,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace llvm {
 /// This is a llvm local version of __cxa_demangle. Other than the name and
@@ -31,6 +32,18 @@ enum : int {
 char *itaniumDemangle(const char *mangled_name, char *buf, size_t *n,
                       int *status);
 
+/// Demangle a batch of Itanium-mangled names in one go. A single parser
+/// context and output buffer are reused for the whole batch, so the per-name
+/// setup and teardown cost of itaniumDemangle is paid only once.
+///
+/// For each entry of MangledNames a string is appended to Demangled: the
+/// demangled name on success, or a verbatim copy of the input if it does not
+/// demangle (mirroring llvm::demangle).
+///
+/// \returns the number of names that were successfully demangled.
+size_t itaniumDemangleBatch(const char *const *MangledNames, size_t NumNames,
+                            std::vector<std::string> &Demangled);
+
 
 enum MSDemangleFlags {
   MSDF_None = 0,
@@ -0,0 +1,66 @@
+//===- SharedObjectCache.h - Cross-process JIT object cache -----*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// An ObjectCache that shares finalized relocatable objects between processes
+// through content-addressed files in a cache directory.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_EXECUTIONENGINE_ORC_SHAREDOBJECTCACHE_H
+#define LLVM_EXECUTIONENGINE_ORC_SHAREDOBJECTCACHE_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
+#include "llvm/Support/Error.h"
+
+#include <mutex>
+#include <string>
+
+namespace llvm {
+namespace orc {
+
+/// A cross-process object cache for ORC.
+///
+/// Entries are keyed by a hash of the module's bitcode, so any process that
+/// JITs an identical module (same IR, triple and data layout) for the same
+/// cache directory reuses the relocatable object produced by the first one.
+/// Cached objects are returned as memory-mapped buffers and committed with a
+/// write-to-temporary-then-rename, so concurrent readers and writers never
+/// observe a partial entry. Plug it into SimpleCompiler /
+/// ConcurrentIRCompiler via setObjectCache(); RTDyldObjectLinkingLayer then
+/// maps and relocates cache hits instead of recompiling.
+class SharedObjectCache : public ObjectCache {
+public:
+  /// Create a cache backed by \p CacheDirectoryPath, creating the directory
+  /// if necessary.
+  static Expected<std::unique_ptr<SharedObjectCache>>
+  Create(StringRef CacheDirectoryPath);
+
+  void notifyObjectCompiled(const Module *M, MemoryBufferRef Obj) override;
+  std::unique_ptr<MemoryBuffer> getObject(const Module *M) override;
+
+private:
+  SharedObjectCache(std::string CacheDirectoryPath)
+      : CacheDirectoryPath(std::move(CacheDirectoryPath)) {}
+
+  std::string getEntryPath(const Module &M);
+
+  std::string CacheDirectoryPath;
+
+  // getObject and notifyObjectCompiled both need the module's content hash;
+  // remember it across the getObject -> compile -> notifyObjectCompiled
+  // round trip so the bitcode is only serialized once per module.
+  std::mutex KeysMutex;
+  DenseMap<const Module *, SmallString<32>> Keys;
+};
+
+} // end namespace orc
+} // end namespace llvm
+
+#endif // LLVM_EXECUTIONENGINE_ORC_SHAREDOBJECTCACHE_H
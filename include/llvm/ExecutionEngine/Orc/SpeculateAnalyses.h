@@ -13,10 +13,13 @@
 #ifndef LLVM_EXECUTIONENGINE_ORC_SPECULATEANALYSES_H
 #define LLVM_EXECUTIONENGINE_ORC_SPECULATEANALYSES_H
 
+#include "llvm/ADT/StringMap.h"
 #include "llvm/Analysis/BranchProbabilityInfo.h"
 #include "llvm/ExecutionEngine/Orc/Core.h"
 #include "llvm/ExecutionEngine/Orc/Speculation.h"
 
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace llvm {
@@ -78,6 +81,34 @@ public:
   ResultTy operator()(Function &F);
 };
 
+// Replays a call-order profile gathered on a previous run. The profile lists
+// one function name per line, in first-call order; for each function the
+// query nominates the next few functions in the sequence, so compilation is
+// warmed just ahead of the call front instead of being guessed from the CFG.
+class CallOrderQuery : public SpeculateQuery {
+  // Shared so that copies of the query (e.g. inside std::function) reuse the
+  // loaded profile rather than duplicating it.
+  struct Profile {
+    std::vector<std::string> Sequence;
+    StringMap<size_t> Position;
+  };
+
+  CallOrderQuery(std::shared_ptr<Profile> P, size_t LookaheadCount)
+      : P(std::move(P)), LookaheadCount(LookaheadCount) {}
+
+public:
+  /// Load a call-order profile from \p ProfilePath. \p LookaheadCount
+  /// controls how far ahead of each function the query nominates candidates.
+  static Expected<CallOrderQuery> load(StringRef ProfilePath,
+                                       size_t LookaheadCount = 8);
+
+  ResultTy operator()(Function &F);
+
+private:
+  std::shared_ptr<Profile> P;
+  size_t LookaheadCount;
+};
+
 } // namespace orc
 } // namespace llvm
 
@@ -22,6 +22,7 @@
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Support/Debug.h"
 
+#include <atomic>
 #include <mutex>
 #include <type_traits>
 #include <utility>
@@ -109,19 +110,34 @@ private:
 
     // for a given symbol, there may be no symbol qualified for speculatively
     // compile try to fix this before jumping to this code if possible.
-    for (auto &LookupPair : SpeculativeLookUpImpls)
+    for (auto &LookupPair : SpeculativeLookUpImpls) {
+      // Back-pressure: speculation shares the compile threads with demand
+      // compiles, so once too many speculative lookups are outstanding new
+      // ones are dropped. A dropped candidate simply compiles on first call,
+      // as it would without speculation.
+      if (++InFlightSpeculations > MaxInFlightSpeculations) {
+        --InFlightSpeculations;
+        continue;
+      }
       ES.lookup(JITDylibSearchList({{LookupPair.first, true}}),
                 LookupPair.second, SymbolState::Ready,
                 [this](Expected<SymbolMap> Result) {
+                  --InFlightSpeculations;
                   if (auto Err = Result.takeError())
                     ES.reportError(std::move(Err));
                 },
                 NoDependenciesToRegister);
+    }
   }
 
 public:
-  Speculator(ImplSymbolMap &Impl, ExecutionSession &ref)
-      : AliaseeImplTable(Impl), ES(ref), GlobalSpecMap(0) {}
+  /// \p MaxInFlightSpeculations bounds the number of outstanding speculative
+  /// lookups; candidates beyond the bound are dropped rather than queued so
+  /// that speculation never starves demand compiles.
+  Speculator(ImplSymbolMap &Impl, ExecutionSession &ref,
+             uint64_t MaxInFlightSpeculations = 32)
+      : AliaseeImplTable(Impl), ES(ref), GlobalSpecMap(0),
+        MaxInFlightSpeculations(MaxInFlightSpeculations) {}
   Speculator(const Speculator &) = delete;
   Speculator(Speculator &&) = delete;
   Speculator &operator=(const Speculator &) = delete;
@@ -164,6 +180,8 @@ private:
   ImplSymbolMap &AliaseeImplTable;
   ExecutionSession &ES;
   StubAddrLikelies GlobalSpecMap;
+  uint64_t MaxInFlightSpeculations;
+  std::atomic<uint64_t> InFlightSpeculations{0};
 };
 
 class IRSpeculationLayer : public IRLayer {
@@ -42,8 +42,23 @@ private:
   using RefCountType = std::atomic<size_t>;
   using PoolMap = StringMap<RefCountType>;
   using PoolMapEntry = StringMapEntry<RefCountType>;
-  mutable std::mutex PoolMutex;
-  PoolMap Pool;
+
+  // The pool is sharded by string hash to reduce lock contention: interning
+  // happens on every symbol lookup and materialization path, and a single
+  // pool mutex serializes all materializer threads. Reference count updates
+  // on SymbolStringPtr are atomic and never take a shard lock.
+  static const size_t NumPoolShards = 16;
+
+  struct PoolShard {
+    mutable std::mutex PoolMutex;
+    PoolMap Pool;
+  };
+
+  PoolShard &getShardFor(StringRef S) {
+    return Shards[hash_value(S) & (NumPoolShards - 1)];
+  }
+
+  PoolShard Shards[NumPoolShards];
 };
 
 /// Pointer to a pooled string representing a symbol name.
@@ -143,30 +158,37 @@ private:
 inline SymbolStringPool::~SymbolStringPool() {
 #ifndef NDEBUG
   clearDeadEntries();
-  assert(Pool.empty() && "Dangling references at pool destruction time");
+  assert(empty() && "Dangling references at pool destruction time");
 #endif // NDEBUG
 }
 
 inline SymbolStringPtr SymbolStringPool::intern(StringRef S) {
-  std::lock_guard<std::mutex> Lock(PoolMutex);
+  PoolShard &Shard = getShardFor(S);
+  std::lock_guard<std::mutex> Lock(Shard.PoolMutex);
   PoolMap::iterator I;
   bool Added;
-  std::tie(I, Added) = Pool.try_emplace(S, 0);
+  std::tie(I, Added) = Shard.Pool.try_emplace(S, 0);
   return SymbolStringPtr(&*I);
 }
 
 inline void SymbolStringPool::clearDeadEntries() {
-  std::lock_guard<std::mutex> Lock(PoolMutex);
-  for (auto I = Pool.begin(), E = Pool.end(); I != E;) {
-    auto Tmp = I++;
-    if (Tmp->second == 0)
-      Pool.erase(Tmp);
+  for (PoolShard &Shard : Shards) {
+    std::lock_guard<std::mutex> Lock(Shard.PoolMutex);
+    for (auto I = Shard.Pool.begin(), E = Shard.Pool.end(); I != E;) {
+      auto Tmp = I++;
+      if (Tmp->second == 0)
+        Shard.Pool.erase(Tmp);
+    }
   }
 }
 
 inline bool SymbolStringPool::empty() const {
-  std::lock_guard<std::mutex> Lock(PoolMutex);
-  return Pool.empty();
+  for (const PoolShard &Shard : Shards) {
+    std::lock_guard<std::mutex> Lock(Shard.PoolMutex);
+    if (!Shard.Pool.empty())
+      return false;
+  }
+  return true;
 }
 
 } // end namespace orc
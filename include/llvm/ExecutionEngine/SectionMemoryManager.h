@@ -19,6 +19,7 @@
 #include "llvm/ExecutionEngine/RTDyldMemoryManager.h"
 #include "llvm/Support/Memory.h"
 #include <cstdint>
+#include <mutex>
 #include <string>
 #include <system_error>
 
@@ -102,10 +103,50 @@ public:
     virtual ~MemoryMapper();
   };
 
+  /// A pool of memory reservations shared between SectionMemoryManager
+  /// instances.
+  ///
+  /// When a manager created with a pool is destroyed, its slabs are handed to
+  /// the pool rather than returned to the operating system, and managers
+  /// drawing from the same pool will reuse them for subsequent objects.  This
+  /// avoids re-mapping (and re-faulting) pages when many short-lived managers
+  /// are created, as happens when loading one object per manager.
+  ///
+  /// Pooled slabs are released by the pool's destructor via sys::Memory, so a
+  /// pool must only be shared between managers using the default memory
+  /// mapper (or a mapper whose memory sys::Memory::releaseMappedMemory can
+  /// release).  The pool may outlive the managers using it, not vice versa.
+  class ReservationPool {
+  public:
+    ~ReservationPool();
+
+  private:
+    friend class SectionMemoryManager;
+
+    /// Take a slab of at least \p NumBytes from the pool if one is
+    /// available, returning true and assigning it to \p Result.
+    bool take(size_t NumBytes, sys::MemoryBlock &Result);
+
+    /// Return a slab to the pool for reuse.
+    void give(sys::MemoryBlock MB);
+
+    std::mutex PoolMutex;
+    SmallVector<sys::MemoryBlock, 16> FreeSlabs;
+  };
+
   /// Creates a SectionMemoryManager instance with \p MM as the associated
   /// memory mapper.  If \p MM is nullptr then a default memory mapper is used
   /// that directly calls into the operating system.
-  SectionMemoryManager(MemoryMapper *MM = nullptr);
+  ///
+  /// If \p Pool is non-null, memory reservations are drawn from (and, on
+  /// destruction, returned to) the given pool, allowing reuse across the
+  /// managers sharing it.  If \p UseHugeCodePages is true, code reservations
+  /// are sized in 2 MiB units and the operating system is asked to back them
+  /// with huge pages where supported, reducing iTLB pressure for large
+  /// amounts of JITed code.
+  SectionMemoryManager(MemoryMapper *MM = nullptr,
+                       ReservationPool *Pool = nullptr,
+                       bool UseHugeCodePages = false);
   SectionMemoryManager(const SectionMemoryManager &) = delete;
   void operator=(const SectionMemoryManager &) = delete;
   ~SectionMemoryManager() override;
@@ -187,6 +228,8 @@ private:
   MemoryGroup RWDataMem;
   MemoryGroup RODataMem;
   MemoryMapper &MMapper;
+  ReservationPool *Pool;
+  bool UseHugeCodePages;
 };
 
 } // end namespace llvm
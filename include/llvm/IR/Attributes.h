@@ -19,6 +19,7 @@
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/FoldingSet.h"
 #include "llvm/ADT/Optional.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/iterator_range.h"
 #include "llvm/Config/llvm-config.h"
@@ -27,7 +28,6 @@
 #include <bitset>
 #include <cassert>
 #include <cstdint>
-#include <map>
 #include <string>
 #include <utility>
 
@@ -705,7 +705,7 @@ template <> struct DenseMapInfo<AttributeList> {
 /// equality, presence of attributes, etc.
 class AttrBuilder {
   std::bitset<Attribute::EndAttrKinds> Attrs;
-  std::map<std::string, std::string, std::less<>> TargetDepAttrs;
+  SmallVector<std::pair<std::string, std::string>, 0> TargetDepAttrs;
   MaybeAlign Alignment;
   MaybeAlign StackAlignment;
   uint64_t DerefBytes = 0;
@@ -841,10 +841,13 @@ public:
   /// attributes.
   bool empty() const { return Attrs.none(); }
 
-  // Iterators for target-dependent attributes.
+  // Iterators for target-dependent attributes. The attributes are kept in a
+  // vector sorted by name, which moves cheaply and avoids a heap node per
+  // attribute.
   using td_type = std::pair<std::string, std::string>;
-  using td_iterator = std::map<std::string, std::string>::iterator;
-  using td_const_iterator = std::map<std::string, std::string>::const_iterator;
+  using td_vector = SmallVector<td_type, 0>;
+  using td_iterator = td_vector::iterator;
+  using td_const_iterator = td_vector::const_iterator;
   using td_range = iterator_range<td_iterator>;
   using td_const_range = iterator_range<td_const_iterator>;
 
@@ -91,6 +91,18 @@ public:
   using reverse_iterator = InstListType::reverse_iterator;
   using const_reverse_iterator = InstListType::const_reverse_iterator;
 
+  /// BasicBlock storage comes from a per-context arena, so the blocks of a
+  /// function end up adjacent in memory. Deleted blocks are recycled by later
+  /// creations; the underlying slabs are reclaimed with the context.
+  void *operator new(size_t Size, LLVMContext &C);
+  void *operator new(size_t Size) = delete;
+
+  void operator delete(void *Ptr);
+
+  /// Placement-delete counterpart of the arena operator new, used if the
+  /// constructor unwinds.
+  void operator delete(void *Ptr, LLVMContext &C) { operator delete(Ptr); }
+
   /// Creates a new BasicBlock.
   ///
   /// If the Parent parameter is specified, the basic block is automatically
@@ -99,7 +111,7 @@ public:
   static BasicBlock *Create(LLVMContext &Context, const Twine &Name = "",
                             Function *Parent = nullptr,
                             BasicBlock *InsertBefore = nullptr) {
-    return new BasicBlock(Context, Name, Parent, InsertBefore);
+    return new (Context) BasicBlock(Context, Name, Parent, InsertBefore);
   }
 
   /// Return the enclosing method, or null if none.
@@ -0,0 +1,65 @@
+//===- CFGUpdateJournal.h - Record CFG edge updates -------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines the CFGUpdateJournal class, which records CFG edge
+// insertions and deletions performed on a function.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_IR_CFGUPDATEJOURNAL_H
+#define LLVM_IR_CFGUPDATEJOURNAL_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/CFGUpdate.h"
+
+namespace llvm {
+
+class BasicBlock;
+
+/// Journal of CFG edge updates for incremental dominator tree maintenance.
+///
+/// DominatorTree::applyUpdates already handles edge batches, but collecting
+/// the edges by hand at every mutation site is awkward enough that passes
+/// often recompute the tree wholesale instead. While a journal is attached to
+/// a function (Function::setCFGUpdateJournal), the common IR utilities
+/// (BasicBlock::removePredecessor, Instruction::replaceSuccessorWith) record
+/// the edges they change; the pass hands updates() to the tree's
+/// applyUpdates and then clears the journal. Mutation sites not covered by
+/// those utilities record edges manually. Every recorded update must
+/// describe a real transition in the CFG's edge set, as applyUpdates
+/// requires; the covered utilities check the terminator before recording.
+///
+/// The journal is not owned by the function: the attaching pass keeps it
+/// alive and must detach it (attach nullptr) before it is destroyed.
+class CFGUpdateJournal {
+  SmallVector<cfg::Update<BasicBlock *>, 8> Updates;
+
+public:
+  /// Record the insertion of an edge from \p From to \p To.
+  void recordInsert(BasicBlock *From, BasicBlock *To) {
+    Updates.emplace_back(cfg::UpdateKind::Insert, From, To);
+  }
+
+  /// Record the deletion of the edge from \p From to \p To.
+  void recordDelete(BasicBlock *From, BasicBlock *To) {
+    Updates.emplace_back(cfg::UpdateKind::Delete, From, To);
+  }
+
+  /// The recorded updates, in the order they were made. Suitable for
+  /// DominatorTree::applyUpdates and PostDominatorTree::applyUpdates.
+  ArrayRef<cfg::Update<BasicBlock *>> updates() const { return Updates; }
+
+  bool empty() const { return Updates.empty(); }
+
+  void clear() { Updates.clear(); }
+};
+
+} // end namespace llvm
+
+#endif // LLVM_IR_CFGUPDATEJOURNAL_H
@@ -199,6 +199,15 @@ public:
   /// Initialize target data from properties stored in the module.
   explicit DataLayout(const Module *M);
 
+  /// Return a process-wide shared DataLayout parsed from
+  /// \p LayoutDescription. Identical strings share one immutable instance,
+  /// so repeated module loads against the same target skip re-parsing the
+  /// specification. The returned object lives until llvm_shutdown(); callers
+  /// that want a struct layout cache of their own (getStructLayout() on the
+  /// shared instance is not thread-safe) should copy it, e.g. via
+  /// Module::setDataLayout().
+  static const DataLayout &get(StringRef LayoutDescription);
+
   DataLayout(const DataLayout &DL) { *this = DL; }
 
   ~DataLayout(); // Not virtual, do not subclass this class
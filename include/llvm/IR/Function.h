@@ -47,6 +47,7 @@ enum ID : unsigned;
 }
 
 class AssemblyAnnotationWriter;
+class CFGUpdateJournal;
 class Constant;
 class DISubprogram;
 class LLVMContext;
@@ -72,6 +73,16 @@ private:
   BasicBlockListType BasicBlocks;         ///< The basic blocks
   mutable Argument *Arguments = nullptr;  ///< The formal arguments
   size_t NumArgs;
+
+  /// Bumped whenever the structure of the function changes, i.e. a basic
+  /// block or instruction is attached or detached. Lets incremental
+  /// consumers such as the verifier skip functions that have not changed
+  /// since they last ran.
+  uint64_t ModificationEpoch = 0;
+
+  /// Journal that CFG-mutating IR utilities record edge updates into while
+  /// one is attached; not owned. See CFGUpdateJournal.
+  CFGUpdateJournal *UpdateJournal = nullptr;
   std::unique_ptr<ValueSymbolTable>
       SymTab;                             ///< Symbol table of args/instructions
   AttributeList AttributeSets;            ///< Parameter attributes
@@ -159,6 +170,27 @@ public:
   /// within this function.
   unsigned getInstructionCount() const;
 
+  /// Returns the counter tracking structural changes to this function; see
+  /// noteModification().
+  uint64_t getModificationEpoch() const { return ModificationEpoch; }
+
+  /// Record that this function changed. Attaching and detaching blocks and
+  /// instructions bump the epoch automatically; transformations that rewrite
+  /// a function in place without changing its structure (e.g. only operands
+  /// or attributes) must call this themselves to be seen by incremental
+  /// consumers.
+  void noteModification() { ++ModificationEpoch; }
+
+  /// Attach (or, with nullptr, detach) a journal that CFG-mutating IR
+  /// utilities record edge updates into; see CFGUpdateJournal. The journal
+  /// is not owned and must outlive the attachment.
+  void setCFGUpdateJournal(CFGUpdateJournal *Journal) {
+    UpdateJournal = Journal;
+  }
+
+  /// The currently attached CFG update journal, or null.
+  CFGUpdateJournal *getCFGUpdateJournal() const { return UpdateJournal; }
+
   /// Returns the FunctionType for me.
   FunctionType *getFunctionType() const {
     return cast<FunctionType>(getValueType());
@@ -17,11 +17,13 @@
 #ifndef LLVM_IR_GVMATERIALIZER_H
 #define LLVM_IR_GVMATERIALIZER_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include <vector>
 
 namespace llvm {
 
 class Error;
+class Function;
 class GlobalValue;
 class StructType;
 
@@ -36,6 +38,13 @@ public:
   ///
   virtual Error materialize(GlobalValue *GV) = 0;
 
+  /// Hint that the given functions are likely to be materialized soon, in
+  /// the given order. This does not materialize anything; materializers
+  /// backed by slow media may use it to start paging in the relevant parts
+  /// of their backing store ahead of the materialize() calls. The default
+  /// implementation does nothing.
+  virtual void prefetch(ArrayRef<Function *> Fns) {}
+
   /// Make sure the entire Module has been completely read.
   ///
   virtual Error materializeModule() = 0;
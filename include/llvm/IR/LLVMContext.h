@@ -134,6 +134,20 @@ public:
   /// especially in release mode.
   void setDiscardValueNames(bool Discard);
 
+  /// Return true if the Context is configured to keep uses of ConstantData
+  /// values (ConstantInt, ConstantFP, UndefValue, ...) off the constant's
+  /// use-list. Off by default.
+  bool shouldDiscardConstantDataUseLists() const;
+
+  /// Set whether uses of ConstantData values are linked into the constant's
+  /// use-list. Widely shared constants like i32 0 otherwise accumulate huge
+  /// use-lists that make RAUW and use scans on them quadratic. Enable this
+  /// before building IR; with it enabled, use_empty() and users() on
+  /// ConstantData report no uses, and replaceAllUsesWith() on such constants
+  /// is invalid. The rare pass that truly needs the users of a ConstantData
+  /// must find them by scanning instruction operands instead.
+  void setDiscardConstantDataUseLists(bool Discard);
+
   /// Whether there is a string map for uniquing debug info
   /// identifiers across the context.  Off by default.
   bool isODRUniquingDebugTypes() const;
@@ -920,6 +920,17 @@ public:
   /// references will be reset.
   static void deleteTemporary(MDNode *N);
 
+  /// Pre-size \p Context's uniquing table for nodes of \p MDKind (one of the
+  /// Metadata::MetadataKind values) to hold \p NumNodes additional nodes.
+  ///
+  /// Rehashing a uniquing table recomputes the key hash of every node already
+  /// in it, which for debug-info nodes means re-combining all operands, so a
+  /// bulk importer (ThinLTO, lazy bitcode loading) that knows roughly how
+  /// many DISubprogram/DIType nodes are coming should reserve up front.
+  /// Kinds that are not uniqued are ignored.
+  static void reserveUniquingCapacity(LLVMContext &Context, unsigned MDKind,
+                                      unsigned NumNodes);
+
   LLVMContext &getContext() const { return Context.getContext(); }
 
   /// Replace a specific operand.
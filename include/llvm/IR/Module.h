@@ -511,6 +511,11 @@ public:
   /// Make sure the GlobalValue is fully read.
   llvm::Error materialize(GlobalValue *GV);
 
+  /// Hint that the given functions are likely to be materialized soon, in
+  /// the given order, so the materializer can prepare (e.g. page in their
+  /// bodies on a background thread). No-op on a materialized module.
+  void prefetchFunctions(ArrayRef<Function *> Fns);
+
   /// Make sure all GlobalValues in this Module are fully read and clear the
   /// Materializer.
   llvm::Error materializeAll();
@@ -14,7 +14,9 @@
 #ifndef LLVM_IR_OPTBISECT_H
 #define LLVM_IR_OPTBISECT_H
 
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Mutex.h"
 
 namespace llvm {
 
@@ -73,6 +75,16 @@ private:
 
   bool BisectEnabled = false;
   unsigned LastBisectNum = 0;
+
+  /// Per-IR-unit bisect numbers, used instead of LastBisectNum when
+  /// -opt-bisect-per-unit is given. Keyed by the textual IR unit description,
+  /// so each module/function/loop gets its own deterministic stream that does
+  /// not depend on how units from parallel backends interleave.
+  StringMap<unsigned> UnitBisectNums;
+
+  /// The OptBisect instance is shared by every LLVMContext in the process;
+  /// serialize the counter updates.
+  sys::SmartMutex<true> BisectMutex;
 };
 
 } // end namespace llvm
@@ -80,6 +80,9 @@ public:
   using AfterPassInvalidatedFunc = void(StringRef);
   using BeforeAnalysisFunc = void(StringRef, Any);
   using AfterAnalysisFunc = void(StringRef, Any);
+  // Invalidation can happen while the IR unit is being destroyed, so the
+  // callback identifies the unit by name rather than by wrapped pointer.
+  using AnalysisInvalidatedFunc = void(StringRef, StringRef);
 
 public:
   PassInstrumentationCallbacks() {}
@@ -111,6 +114,11 @@ public:
     AfterAnalysisCallbacks.emplace_back(std::move(C));
   }
 
+  template <typename CallableT>
+  void registerAnalysisInvalidatedCallback(CallableT C) {
+    AnalysisInvalidatedCallbacks.emplace_back(std::move(C));
+  }
+
 private:
   friend class PassInstrumentation;
 
@@ -122,6 +130,8 @@ private:
       BeforeAnalysisCallbacks;
   SmallVector<llvm::unique_function<AfterAnalysisFunc>, 4>
       AfterAnalysisCallbacks;
+  SmallVector<llvm::unique_function<AnalysisInvalidatedFunc>, 4>
+      AnalysisInvalidatedCallbacks;
 };
 
 /// This class provides instrumentation entry points for the Pass Manager,
@@ -189,6 +199,15 @@ public:
         C(Analysis.name(), llvm::Any(&IR));
   }
 
+  /// AnalysisInvalidated instrumentation point - takes the name of the
+  /// analysis whose cached result is being dropped and the name of the IR
+  /// unit it was cached for.
+  void runAnalysisInvalidated(StringRef AnalysisName, StringRef IRName) const {
+    if (Callbacks)
+      for (auto &C : Callbacks->AnalysisInvalidatedCallbacks)
+        C(AnalysisName, IRName);
+  }
+
   /// Handle invalidation from the pass manager when PassInstrumentation
   /// is used as the result of PassInstrumentationAnalysis.
   ///
@@ -808,6 +808,38 @@ public:
     return &static_cast<ResultModelT *>(ResultConcept)->Result;
   }
 
+  /// Insert an externally computed result for an analysis pass.
+  ///
+  /// This is an advanced API: the analysis must have been registered with
+  /// this manager, no result for \p IR may be cached yet, and \p Result must
+  /// be exactly what running the pass on \p IR would have produced. The
+  /// inserted result participates in invalidation like any result the
+  /// manager computed itself. The intended use is precomputing results for
+  /// many IR units up front (possibly concurrently) and then handing them to
+  /// the manager from the main thread.
+  template <typename PassT>
+  void cacheResult(IRUnitT &IR, typename PassT::Result Result) {
+    assert(AnalysisPasses.count(PassT::ID()) &&
+           "This analysis pass was not registered prior to being cached");
+    AnalysisKey *ID = PassT::ID();
+
+    typename AnalysisResultMapT::iterator RI;
+    bool Inserted;
+    std::tie(RI, Inserted) = AnalysisResults.insert(std::make_pair(
+        std::make_pair(ID, &IR), typename AnalysisResultListT::iterator()));
+    assert(Inserted && "A result for this analysis is already cached");
+    (void)Inserted;
+
+    using ResultModelT =
+        detail::AnalysisResultModel<IRUnitT, PassT, typename PassT::Result,
+                                    PreservedAnalyses, Invalidator>;
+
+    AnalysisResultListT &ResultList = AnalysisResultLists[&IR];
+    ResultList.emplace_back(ID,
+                            std::make_unique<ResultModelT>(std::move(Result)));
+    RI->second = std::prev(ResultList.end());
+  }
+
   /// Register an analysis pass with the manager.
   ///
   /// The parameter is a callable whose result is an analysis pass. This allows
@@ -898,6 +930,10 @@ public:
 
     // Now erase the results that were marked above as invalidated.
     if (!IsResultInvalidated.empty()) {
+      // The PassInstrumentationAnalysis result itself is never invalidated,
+      // so it stays valid while entries are erased below.
+      PassInstrumentation *PI =
+          getCachedResult<PassInstrumentationAnalysis>(IR);
       for (auto I = ResultsList.begin(), E = ResultsList.end(); I != E;) {
         AnalysisKey *ID = I->first;
         if (!IsResultInvalidated.lookup(ID)) {
@@ -909,6 +945,10 @@ public:
           dbgs() << "Invalidating analysis: " << this->lookUpPass(ID).name()
                  << " on " << IR.getName() << "\n";
 
+        if (PI)
+          PI->runAnalysisInvalidated(this->lookUpPass(ID).name(),
+                                     IR.getName());
+
         I = ResultsList.erase(I);
         AnalysisResults.erase({ID, &IR});
       }
@@ -990,6 +1030,9 @@ private:
     if (DebugLogging)
       dbgs() << "Invalidating analysis: " << this->lookUpPass(ID).name()
              << " on " << IR.getName() << "\n";
+    if (PassInstrumentation *PI =
+            getCachedResult<PassInstrumentationAnalysis>(IR))
+      PI->runAnalysisInvalidated(this->lookUpPass(ID).name(), IR.getName());
     AnalysisResultLists[&IR].erase(RI->second);
     AnalysisResults.erase(RI);
   }
@@ -51,6 +51,10 @@ public:
   /// Set a pass filter based on a regex \p Filter.
   /// Returns an error if the regex is invalid.
   Error setFilter(StringRef Filter);
+  /// Check wether the string matches the filter set for the streamer.
+  /// Remark emitters can use this to avoid materializing a remark for a pass
+  /// that the streamer is going to drop anyway.
+  bool matchesFilter(StringRef Str) const;
   /// Emit a diagnostic through the streamer.
   void emit(const DiagnosticInfoOptimizationBase &Diag);
 };
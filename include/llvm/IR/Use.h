@@ -154,10 +154,19 @@ private:
 
   void removeFromList() {
     Use **StrippedPrev = Prev.getPointer();
+    if (!StrippedPrev)
+      return; // Never linked into a use-list; see Value::addUse().
     *StrippedPrev = Next;
     if (Next)
       Next->setPrev(StrippedPrev);
   }
+
+  /// Leave this use off every use-list. Used by Value::addUse() for values
+  /// that do not track their uses; removeFromList() then becomes a no-op.
+  void markUnlisted() {
+    Next = nullptr;
+    Prev.setPointer(nullptr);
+  }
 };
 
 /// Allow clients to treat uses just like values when using
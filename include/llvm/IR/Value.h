@@ -259,6 +259,11 @@ private:
   void doRAUW(Value *New, ReplaceMetadataUses);
   void setNameImpl(const Twine &Name);
 
+  /// Whether the owning context discards this value's use-list. Only called
+  /// for ConstantData values; out of line because LLVMContext is incomplete
+  /// here.
+  bool useListDiscarded() const;
+
 public:
   /// Return a constant reference to the value's name.
   ///
@@ -454,7 +459,16 @@ public:
   unsigned getNumUses() const;
 
   /// This method should only be used by the Use class.
-  void addUse(Use &U) { U.addToList(&UseList); }
+  ///
+  /// When the owning context discards ConstantData use-lists (see
+  /// LLVMContext::setDiscardConstantDataUseLists()), uses of ConstantData
+  /// values are not linked anywhere and use_empty() on them stays true.
+  void addUse(Use &U) {
+    if (SubclassID >= ConstantDataFirstVal &&
+        SubclassID <= ConstantDataLastVal && useListDiscarded())
+      return U.markUnlisted();
+    U.addToList(&UseList);
+  }
 
   /// Concrete subclass of this.
   ///
@@ -102,6 +102,28 @@ bool verifyModule(const Module &M, raw_ostream *OS = nullptr,
 
 FunctionPass *createVerifierPass(bool FatalErrors = true);
 
+/// Incremental verification driver for pipelines that verify the same module
+/// repeatedly, e.g. a JIT verifying after every pass group. The driver
+/// remembers the modification epoch at which each function last verified
+/// cleanly and re-checks only functions whose epoch has moved since, plus
+/// the module-level tables, which are always verified.
+///
+/// Epochs track structural changes (see Function::noteModification);
+/// transformations that rewrite a function without changing its structure
+/// must call noteModification to be re-verified. The recorded state is keyed
+/// on Function identity, so call clear() after deleting functions from the
+/// module.
+class IncrementalVerifier {
+  DenseMap<const Function *, uint64_t> VerifiedEpochs;
+
+public:
+  /// \return true if the module is broken, like llvm::verifyModule.
+  bool verifyModule(const Module &M, raw_ostream *OS = nullptr);
+
+  /// Drop all recorded epochs; the next run verifies everything.
+  void clear() { VerifiedEpochs.clear(); }
+};
+
 /// Check a module for errors, and report separate error states for IR
 /// and debug info errors.
 class VerifierAnalysis : public AnalysisInfoMixin<VerifierAnalysis> {
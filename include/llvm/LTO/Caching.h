@@ -30,8 +30,15 @@ using AddBufferFn =
 /// Create a local file system cache which uses the given cache directory and
 /// file callback. This function also creates the cache directory if it does not
 /// already exist.
+///
+/// If \p Compress is true and zlib is available, new cache entries are
+/// stored compressed on disk; the buffers handed to \p AddBuffer are always
+/// uncompressed. Compressed and uncompressed entries can coexist in the same
+/// cache directory, so the flag can be toggled without invalidating the
+/// cache.
 Expected<NativeObjectCache> localCache(StringRef CacheDirectoryPath,
-                                       AddBufferFn AddBuffer);
+                                       AddBufferFn AddBuffer,
+                                       bool Compress = false);
 
 } // namespace lto
 } // namespace llvm
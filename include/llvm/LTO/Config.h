@@ -117,6 +117,16 @@ struct Config {
   /// Statistics output file path.
   std::string StatsFile;
 
+  /// If this field is set, the ThinLTO backends cache the post-import
+  /// optimized IR for each module in this directory, keyed on a hash that
+  /// excludes the codegen-only parts of the configuration (see
+  /// computeLTOCacheKey). This forms a second cache level in front of the
+  /// native object cache: when only backend configuration changed, the
+  /// import and optimization pipeline is skipped and code generation is
+  /// re-run from the cached IR. Entries use the "llvmcache-" prefix so the
+  /// directory can be pruned with pruneCache().
+  std::string IRCacheDir;
+
   bool ShouldDiscardValueNames = true;
   DiagnosticHandlerFunction DiagHandler;
 
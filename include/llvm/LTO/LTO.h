@@ -66,6 +66,11 @@ void thinLTOInternalizeAndPromoteInIndex(
 /// Computes a unique hash for the Module considering the current list of
 /// export/import and other global analysis results.
 /// The hash is produced in \p Key.
+/// If \p SkipCodeGenOptions is true, configuration that only affects the
+/// final code generation step (object file format, section splitting, ...)
+/// is left out of the hash. The resulting key identifies the post-import
+/// optimized IR rather than the native object and is used for the IR-stage
+/// cache level (see Config::IRCacheDir).
 void computeLTOCacheKey(
     SmallString<40> &Key, const lto::Config &Conf,
     const ModuleSummaryIndex &Index, StringRef ModuleID,
@@ -74,7 +79,8 @@ void computeLTOCacheKey(
     const std::map<GlobalValue::GUID, GlobalValue::LinkageTypes> &ResolvedODR,
     const GVSummaryMapTy &DefinedGlobals,
     const std::set<GlobalValue::GUID> &CfiFunctionDefs = {},
-    const std::set<GlobalValue::GUID> &CfiFunctionDecls = {});
+    const std::set<GlobalValue::GUID> &CfiFunctionDecls = {},
+    bool SkipCodeGenOptions = false);
 
 namespace lto {
 
@@ -39,12 +39,16 @@ Error backend(Config &C, AddStreamFn AddStream,
               unsigned ParallelCodeGenParallelismLevel,
               std::unique_ptr<Module> M, ModuleSummaryIndex &CombinedIndex);
 
-/// Runs a ThinLTO backend.
+/// Runs a ThinLTO backend. If \p IRCacheKey is non-empty and
+/// Config::IRCacheDir is set, the post-import optimized IR is cached under
+/// that key: on a hit the import and optimization pipeline is skipped and
+/// only code generation runs.
 Error thinBackend(Config &C, unsigned Task, AddStreamFn AddStream, Module &M,
                   const ModuleSummaryIndex &CombinedIndex,
                   const FunctionImporter::ImportMapTy &ImportList,
                   const GVSummaryMapTy &DefinedGlobals,
-                  MapVector<StringRef, BitcodeModule> &ModuleMap);
+                  MapVector<StringRef, BitcodeModule> &ModuleMap,
+                  StringRef IRCacheKey = {});
 }
 }
 
@@ -97,6 +97,22 @@ struct LTOCodeGenerator {
   void setShouldInternalize(bool Value) { ShouldInternalize = Value; }
   void setShouldEmbedUselists(bool Value) { ShouldEmbedUselists = Value; }
 
+  /// Set the number of code generation partitions/threads used by
+  /// compile_to_file(). At levels above 1 the merged module is split into
+  /// that many linkable partitions and code generation runs in parallel,
+  /// producing one object file per partition; see getNativeObjectPaths().
+  void setParallelismLevel(unsigned Level) {
+    ParallelismLevel = std::max(1u, Level);
+  }
+
+  /// Paths of the object files produced by the last successful
+  /// compile_to_file(). The first element is the path that was returned via
+  /// the \p Name argument; additional elements are present at parallelism
+  /// levels above 1.
+  ArrayRef<std::string> getNativeObjectPaths() const {
+    return NativeObjectPaths;
+  }
+
   /// Restore linkage of globals
   ///
   /// When set, the linkage of globals will be restored prior to code
@@ -228,6 +244,8 @@ private:
   std::string MCpu;
   std::string MAttr;
   std::string NativeObjectPath;
+  std::vector<std::string> NativeObjectPaths;
+  unsigned ParallelismLevel = 1;
   TargetOptions Options;
   CodeGenOpt::Level CGOptLevel = CodeGenOpt::Default;
   const Target *MArch = nullptr;
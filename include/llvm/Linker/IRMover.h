@@ -81,6 +81,12 @@ private:
   Module &Composite;
   IdentifiedStructTypeSet IdentifiedStructTypes;
   MDMapT SharedMDs; ///< A Metadata map to use for all calls to \a move().
+  /// A type map to reuse for all calls to \a move(). Types are owned by the
+  /// LLVMContext rather than by any module, so mappings established by
+  /// earlier imports remain valid for the whole link session and save
+  /// re-running the isomorphism check on types shared between source
+  /// modules.
+  DenseMap<Type *, Type *> SharedTypes;
 };
 
 } // End llvm namespace
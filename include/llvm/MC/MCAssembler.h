@@ -190,6 +190,10 @@ private:
   /// if any offsets were adjusted.
   bool layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec);
 
+  /// Iterate layout to a fixpoint, revisiting only the sections whose
+  /// relaxation inputs (symbol offsets in other sections) have changed.
+  void layoutViaWorklist(MCAsmLayout &Layout);
+
   bool relaxInstruction(MCAsmLayout &Layout, MCRelaxableFragment &IF);
 
   bool relaxPaddingFragment(MCAsmLayout &Layout, MCPaddingFragment &PF);
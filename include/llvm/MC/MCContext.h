@@ -120,6 +120,11 @@ namespace llvm {
     /// a given prefix.
     StringMap<unsigned> NextID;
 
+    /// The next ID for the default "<priv>tmp" temporary symbols. These are
+    /// numbered from a plain counter rather than through \a NextID so the
+    /// hot createTempSymbol() path never hashes the shared prefix.
+    unsigned NextTmpID = 0;
+
     /// Instances of directional local labels.
     DenseMap<unsigned, MCLabel *> Instances;
     /// NextInstance() creates the next instance of the directional local label
@@ -9,16 +9,19 @@
 #ifndef LLVM_MC_MCDISASSEMBLER_MCDISASSEMBLER_H
 #define LLVM_MC_MCDISASSEMBLER_MCDISASSEMBLER_H
 
+#include "llvm/ADT/Optional.h"
 #include "llvm/MC/MCDisassembler/MCSymbolizer.h"
+#include "llvm/MC/MCInst.h"
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace llvm {
 
 template <typename T> class ArrayRef;
 class StringRef;
 class MCContext;
-class MCInst;
+class MCInstrAnalysis;
 class MCSubtargetInfo;
 class raw_ostream;
 
@@ -97,6 +100,32 @@ public:
                                      raw_ostream &VStream,
                                      raw_ostream &CStream) const;
 
+  /// A single instruction decoded by decodeRange().
+  struct DecodedInst {
+    MCInst Inst;
+    uint64_t Address = 0;
+    uint64_t Size = 0;
+    DecodeStatus Status = Fail;
+    /// The absolute target if the instruction is a branch or call whose
+    /// target could be computed while decoding, otherwise None.
+    Optional<uint64_t> BranchTarget;
+  };
+
+  /// Decode an entire byte range into \p Insts, appending one entry per
+  /// decode attempt. Decoding always makes progress: a failed decode consumes
+  /// at least one byte. If \p MIA is given, branch and call targets are
+  /// resolved in the same pass and recorded on the entries, saving callers a
+  /// second walk over the instructions.
+  ///
+  /// The base implementation loops over getInstruction(); targets with
+  /// table-driven decoders may override it to amortize per-call setup.
+  /// Diagnostics and comments are discarded, so this is intended for bulk
+  /// consumers (disassembly tools, binary analysis) rather than for printing
+  /// paths that need per-instruction annotation.
+  virtual void decodeRange(ArrayRef<uint8_t> Bytes, uint64_t Address,
+                           std::vector<DecodedInst> &Insts,
+                           const MCInstrAnalysis *MIA = nullptr) const;
+
 private:
   MCContext &Ctx;
 
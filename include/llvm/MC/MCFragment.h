@@ -197,6 +197,14 @@ protected:
 public:
   SmallVectorImpl<char> &getContents() { return Contents; }
   const SmallVectorImpl<char> &getContents() const { return Contents; }
+
+  /// Drop the contents and release any heap storage backing them. Only valid
+  /// once the fragment's bytes have been written to the output; the layout
+  /// offset cached on the fragment is unaffected.
+  void releaseContents() {
+    // Moving into a temporary steals the heap buffer, which dies with it.
+    SmallVector<char, ContentsSize> Discard(std::move(Contents));
+  }
 };
 
 /// Interface implemented by fragments that contain encoded instructions and/or
@@ -131,6 +131,12 @@ protected: // Can only create subclasses.
 
   bool ShowParsedOperands = false;
 
+  /// When true, the input is trusted machine-generated assembly using a
+  /// restricted dialect: no macro instantiations and no conditional
+  /// assembly. The parser skips the corresponding per-statement machinery
+  /// and diagnoses such constructs as unknown directives.
+  bool FastParse = false;
+
 public:
   MCAsmParser(const MCAsmParser &) = delete;
   MCAsmParser &operator=(const MCAsmParser &) = delete;
@@ -162,6 +168,9 @@ public:
   bool getShowParsedOperands() const { return ShowParsedOperands; }
   void setShowParsedOperands(bool Value) { ShowParsedOperands = Value; }
 
+  bool getFastParse() const { return FastParse; }
+  void setFastParse(bool Value) { FastParse = Value; }
+
   /// Run the parser on the input source buffer.
   virtual bool Run(bool NoInitialTextSection, bool NoFinalize = false) = 0;
 
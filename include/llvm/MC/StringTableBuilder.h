@@ -52,6 +52,17 @@ public:
   /// returned by add will still be valid.
   void finalizeInOrder();
 
+  /// Add a string after the table has been finalized. Strings already in the
+  /// table keep their existing offset; new strings are appended to the end of
+  /// the table without suffix merging. Returns the position of S. This serves
+  /// accumulation patterns that interleave emission with further additions
+  /// (dsymutil), where re-finalizing would invalidate offsets already
+  /// written out.
+  size_t addIncremental(CachedHashStringRef S);
+  size_t addIncremental(StringRef S) {
+    return addIncremental(CachedHashStringRef(S));
+  }
+
   /// Get the offest of a string in the string table. Can only be used
   /// after the table is finalized.
   size_t getOffset(CachedHashStringRef S) const;
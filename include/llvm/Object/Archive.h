@@ -13,6 +13,8 @@
 #ifndef LLVM_OBJECT_ARCHIVE_H
 #define LLVM_OBJECT_ARCHIVE_H
 
+#include "llvm/ADT/CachedHashString.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/fallible_iterator.h"
@@ -275,6 +277,12 @@ private:
   uint16_t FirstRegularStartOfFile = -1;
   void setFirstRegular(const Child &C);
 
+  /// Lazily built index over the symbol table for findSym(); keys reference
+  /// the mmapped member names directly. Built on the first lookup so callers
+  /// that only iterate pay nothing.
+  mutable DenseMap<CachedHashStringRef, Symbol> SymbolIndex;
+  mutable bool SymbolIndexBuilt = false;
+
   unsigned Format : 3;
   unsigned IsThin : 1;
   mutable std::vector<std::unique_ptr<MemoryBuffer>> ThinBuffers;
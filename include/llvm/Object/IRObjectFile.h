@@ -26,6 +26,7 @@ class GlobalValue;
 class Triple;
 
 namespace object {
+class Archive;
 class ObjectFile;
 
 class IRObjectFile : public SymbolicFile {
@@ -69,6 +70,14 @@ public:
   static Expected<MemoryBufferRef>
   findBitcodeInMemBuffer(MemoryBufferRef Object);
 
+  /// Finds the bitcode of every member of \p A, whether a raw bitcode file
+  /// or a native object with embedded bitcode. The returned modules
+  /// reference the archive's mapped buffer and are only valid for its
+  /// lifetime; no member contents are copied. Members containing no bitcode
+  /// are skipped.
+  static Expected<std::vector<BitcodeModule>>
+  findBitcodeInArchive(const Archive &A);
+
   static Expected<std::unique_ptr<IRObjectFile>> create(MemoryBufferRef Object,
                                                         LLVMContext &Context);
 };
@@ -84,6 +93,16 @@ struct IRSymtabFile {
 /// Reads a bitcode file, creating its irsymtab if necessary.
 Expected<IRSymtabFile> readIRSymtab(MemoryBufferRef MBRef);
 
+/// Reads the symbol tables of every bitcode member of \p A in one pass,
+/// returning one IRSymtabFile per member (non-bitcode members are skipped).
+/// When the archive is backed by a file on disk, the symbol tables are
+/// served from a "<archive>.symtab" cache next to it if one matches the
+/// archive's size and modification time, and the cache is (re)written on a
+/// miss; members then need no bitcode parsing at all. The returned modules
+/// reference the archive's mapped buffer and are only valid for its
+/// lifetime.
+Expected<std::vector<IRSymtabFile>> readIRSymtabsFromArchive(const Archive &A);
+
 }
 
 }
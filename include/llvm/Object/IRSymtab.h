@@ -367,6 +367,23 @@ struct FileContents {
 /// Reads the contents of a bitcode file, creating its irsymtab if necessary.
 Expected<FileContents> readBitcode(const BitcodeFileContents &BFC);
 
+/// Write a symbol table cache for an archive of bitcode files to \p Path.
+/// \p Members holds one (symtab, strtab) byte pair per bitcode member, in
+/// member order. \p ArchiveSize and \p ArchiveModTime identify the archive
+/// revision the cache was built from and invalidate the cache when the
+/// archive changes.
+Error writeSymtabCache(StringRef Path,
+                       ArrayRef<std::pair<StringRef, StringRef>> Members,
+                       uint64_t ArchiveSize, uint64_t ArchiveModTime);
+
+/// Read a symbol table cache previously written by writeSymtabCache().
+/// Returns an error if the cache is missing, malformed, produced by a
+/// different irsymtab format version, or does not match \p ArchiveSize and
+/// \p ArchiveModTime; callers are expected to fall back to readBitcode().
+Expected<std::vector<FileContents>> readSymtabCache(StringRef Path,
+                                                    uint64_t ArchiveSize,
+                                                    uint64_t ArchiveModTime);
+
 } // end namespace irsymtab
 } // end namespace llvm
 
@@ -16,8 +16,11 @@
 #define LLVM_PASSES_STANDARDINSTRUMENTATIONS_H
 
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/IR/PassInstrumentation.h"
 #include "llvm/IR/PassTimingInfo.h"
+#include "llvm/Support/Timer.h"
 
 #include <string>
 #include <utility>
@@ -53,11 +56,58 @@ private:
   bool StoreModuleDesc = false;
 };
 
+/// Instrumentation to profile analysis invalidation and recomputation.
+///
+/// Tracks, per analysis, how often cached results are dropped and how much
+/// time is spent recomputing results that had already been computed once for
+/// the same IR unit, attributing each invalidation to the pass that was
+/// running when it happened. A report ranking analyses by wasted
+/// recomputation time is printed when the instrumentation is destroyed.
+class AnalysisInvalidationProfiler {
+public:
+  AnalysisInvalidationProfiler() = default;
+  ~AnalysisInvalidationProfiler();
+
+  void registerCallbacks(PassInstrumentationCallbacks &PIC);
+
+  void print(raw_ostream &OS) const;
+
+private:
+  void handleBeforePass(StringRef PassID);
+  void handleAfterPass(StringRef PassID);
+  void handleBeforeAnalysis(StringRef AnalysisID, Any IR);
+  void handleAfterAnalysis(StringRef AnalysisID, Any IR);
+  void handleAnalysisInvalidated(StringRef AnalysisID, StringRef IRName);
+
+  struct AnalysisStats {
+    unsigned Computations = 0;
+    unsigned Recomputations = 0;
+    unsigned Invalidations = 0;
+    /// Wall time, in seconds, spent recomputing previously computed results.
+    /// Time of analyses run transitively is included.
+    double RecomputeTime = 0.0;
+    /// How often each pass triggered an invalidation of this analysis.
+    StringMap<unsigned> InvalidatingPasses;
+  };
+
+  bool Enabled = false;
+  /// Names of the passes currently running, innermost last. Used to
+  /// attribute invalidations.
+  SmallVector<std::string, 8> PassStack;
+  /// Analyses currently being computed, with their start times.
+  SmallVector<std::pair<std::string, TimeRecord>, 4> AnalysisStack;
+  /// (Analysis, IR unit) pairs that have been computed at least once, used
+  /// to tell first computations from recomputations.
+  StringSet<> EverComputed;
+  StringMap<AnalysisStats> Stats;
+};
+
 /// This class provides an interface to register all the standard pass
 /// instrumentations and manages their state (if any).
 class StandardInstrumentations {
   PrintIRInstrumentation PrintIR;
   TimePassesHandler TimePasses;
+  AnalysisInvalidationProfiler AnalysisInvalidation;
 
 public:
   StandardInstrumentations() = default;
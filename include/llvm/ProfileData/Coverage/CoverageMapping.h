@@ -518,9 +518,12 @@ class CoverageMapping {
 
   CoverageMapping() = default;
 
-  /// Add a function record corresponding to \p Record.
+  /// Add a function record corresponding to \p Record. If \p MaterializeRegions
+  /// is false, only look up the function's profile counts (so counter
+  /// mismatches are diagnosed) without materializing its regions.
   Error loadFunctionRecord(const CoverageMappingRecord &Record,
-                           IndexedInstrProfReader &ProfileReader);
+                           IndexedInstrProfReader &ProfileReader,
+                           bool MaterializeRegions = true);
 
   /// Look up the indices for function records which are at least partially
   /// defined in the specified file. This is guaranteed to return a superset of
@@ -534,16 +537,29 @@ public:
   CoverageMapping &operator=(const CoverageMapping &) = delete;
 
   /// Load the coverage mapping using the given readers.
+  ///
+  /// If \p SourceFiles is non-empty, only function records touching one of
+  /// the named files have their regions materialized; records for unrelated
+  /// files still get their profile counts looked up, so counter mismatches
+  /// are diagnosed exactly as in an unrestricted load. The
+  /// match is on the last path component, so path remappings applied by
+  /// clients afterwards cannot exclude wanted records; extra records sharing
+  /// a filename with a requested source may still be loaded.
   static Expected<std::unique_ptr<CoverageMapping>>
   load(ArrayRef<std::unique_ptr<CoverageMappingReader>> CoverageReaders,
-       IndexedInstrProfReader &ProfileReader);
+       IndexedInstrProfReader &ProfileReader,
+       ArrayRef<StringRef> SourceFiles = None);
 
   /// Load the coverage mapping from the given object files and profile. If
   /// \p Arches is non-empty, it must specify an architecture for each object.
   /// Ignores non-instrumented object files unless all are not instrumented.
+  /// \p SourceFiles optionally restricts decoding as described above; if it
+  /// matches no records at all, the restriction is dropped and everything is
+  /// loaded.
   static Expected<std::unique_ptr<CoverageMapping>>
   load(ArrayRef<StringRef> ObjectFilenames, StringRef ProfileFilename,
-       ArrayRef<StringRef> Arches = None);
+       ArrayRef<StringRef> Arches = None,
+       ArrayRef<StringRef> SourceFiles = None);
 
   /// The number of functions that couldn't have their profiles mapped.
   ///
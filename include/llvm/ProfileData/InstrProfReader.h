@@ -126,7 +126,17 @@ public:
 
   /// Factory method to create an appropriately typed reader for the given
   /// instrprof file.
-  static Expected<std::unique_ptr<InstrProfReader>> create(const Twine &Path);
+  ///
+  /// When \p IsLive is true, \p Path is treated as a snapshot of a profile
+  /// that a running instrumented process is still updating in place (e.g. a
+  /// memory-mapped raw profile with continuously merged counters). The file
+  /// is copied into memory up front instead of being memory-mapped, so that
+  /// concurrent counter updates by the producer cannot change the data under
+  /// the reader. Individual counters in the snapshot may be slightly stale
+  /// relative to each other, but each one is a value the producer actually
+  /// stored.
+  static Expected<std::unique_ptr<InstrProfReader>> create(const Twine &Path,
+                                                           bool IsLive = false);
 
   static Expected<std::unique_ptr<InstrProfReader>>
   create(std::unique_ptr<MemoryBuffer> Buffer);
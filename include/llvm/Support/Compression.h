@@ -32,6 +32,17 @@ bool isAvailable();
 Error compress(StringRef InputBuffer, SmallVectorImpl<char> &CompressedBuffer,
                int Level = DefaultCompression);
 
+/// Compresses \p InputBuffer using every available core by deflating
+/// \p ChunkSize slices independently and stitching the pieces together with
+/// zlib full-flush blocks. The output is a single well-formed zlib stream
+/// that any inflater (including uncompress below) accepts. Chunks start with
+/// a fresh dictionary, so the ratio is marginally worse than compress; inputs
+/// no larger than one chunk fall back to the serial path.
+Error compressParallel(StringRef InputBuffer,
+                       SmallVectorImpl<char> &CompressedBuffer,
+                       int Level = DefaultCompression,
+                       size_t ChunkSize = 1 << 20);
+
 Error uncompress(StringRef InputBuffer, char *UncompressedBuffer,
                  size_t &UncompressedSize);
 
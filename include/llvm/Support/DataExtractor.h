@@ -9,6 +9,7 @@
 #ifndef LLVM_SUPPORT_DATAEXTRACTOR_H
 #define LLVM_SUPPORT_DATAEXTRACTOR_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/DataTypes.h"
 #include "llvm/Support/Error.h"
@@ -526,6 +527,28 @@ public:
   /// state, zero is returned.
   uint64_t getULEB128(Cursor &C) const { return getULEB128(&C.Offset, &C.Err); }
 
+  /// Extract \p Dst.size() consecutive unsigned ULEB128 values starting at
+  /// the offset given by \p offset_ptr, using the bulk decoder.  This is the
+  /// preferred way to read runs of LEB values (line tables, coverage
+  /// counters): it avoids per-value call and bounds-check overhead.
+  ///
+  /// @param[in,out] offset_ptr
+  ///     A pointer to an offset within the data that will be advanced past
+  ///     the values actually extracted, even on partial failure.
+  ///
+  /// @param[out] Dst
+  ///     The destination for the decoded values.
+  ///
+  /// @param[in,out] Err
+  ///     A pointer to an Error object, set on malformed input or if the data
+  ///     runs out before \p Dst is full. If the Error object is already set
+  ///     when calling this function, no extraction is performed.
+  ///
+  /// @return
+  ///     The number of values extracted; equal to Dst.size() on success.
+  size_t getULEB128Array(uint64_t *offset_ptr, MutableArrayRef<uint64_t> Dst,
+                         llvm::Error *Err = nullptr) const;
+
   /// Advance the Cursor position by the given number of bytes. No-op if the
   /// cursor is in an error state.
   void skip(Cursor &C, uint64_t Length) const;
@@ -47,6 +47,7 @@
 #include "llvm/ADT/UniqueVector.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/Mutex.h"
 #include "llvm/Support/raw_ostream.h"
 #include <string>
 
@@ -75,6 +76,7 @@ public:
       return true;
 
     auto &Us = instance();
+    sys::SmartScopedLock<true> Lock(Us.CounterLock);
     auto Result = Us.Counters.find(CounterName);
     if (Result != Us.Counters.end()) {
       auto &CounterInfo = Result->second;
@@ -105,6 +107,7 @@ public:
   // Return the Count for a counter. This only works for set counters.
   static int64_t getCounterValue(unsigned ID) {
     auto &Us = instance();
+    sys::SmartScopedLock<true> Lock(Us.CounterLock);
     auto Result = Us.Counters.find(ID);
     assert(Result != Us.Counters.end() && "Asking about a non-set counter");
     return Result->second.Count;
@@ -113,6 +116,7 @@ public:
   // Set a registered counter to a given Count value.
   static void setCounterValue(unsigned ID, int64_t Count) {
     auto &Us = instance();
+    sys::SmartScopedLock<true> Lock(Us.CounterLock);
     Us.Counters[ID].Count = Count;
   }
 
@@ -175,8 +179,15 @@ private:
   DenseMap<unsigned, CounterInfo> Counters;
   CounterVector RegisteredCounters;
 
-  // Whether we should do DebugCounting at all. DebugCounters aren't
-  // thread-safe, so this should always be false in multithreaded scenarios.
+  // Serializes count updates from concurrent threads. The counts themselves
+  // remain process-global, so under threading the events interleave into one
+  // stream in a nondeterministic order; the lock only keeps the counts from
+  // being corrupted.
+  mutable sys::SmartMutex<true> CounterLock;
+
+  // Whether we should do DebugCounting at all. Counting in multithreaded
+  // scenarios does not race, but the resulting stream is not reproducible, so
+  // this should generally stay false there.
   bool Enabled = false;
 };
 
@@ -679,6 +679,38 @@ private:
 /// to the original source).
 llvm::Expected<Value> parse(llvm::StringRef JSON);
 
+/// Callback interface for the streaming (SAX-style) parser overload of parse.
+///
+/// The parser invokes one callback per event, in document order, without
+/// materializing a Value tree, so memory use stays constant regardless of
+/// document size. Strings passed to callbacks are unescaped but only valid
+/// for the duration of the call; copy them if needed.
+///
+/// Every callback returns true to continue parsing; returning false aborts
+/// the parse, which then fails with a ParseError at the current position.
+class ParseHandler {
+public:
+  virtual ~ParseHandler();
+
+  virtual bool onNull() { return true; }
+  virtual bool onBool(bool Value) { return true; }
+  /// Numbers that are exactly representable as a signed 64-bit integer.
+  virtual bool onInteger(int64_t Value) { return true; }
+  /// All other numbers.
+  virtual bool onNumber(double Value) { return true; }
+  virtual bool onString(StringRef Value) { return true; }
+  virtual bool onObjectBegin() { return true; }
+  virtual bool onObjectKey(StringRef Key) { return true; }
+  virtual bool onObjectEnd() { return true; }
+  virtual bool onArrayBegin() { return true; }
+  virtual bool onArrayEnd() { return true; }
+};
+
+/// Parses the provided JSON source, delivering events to \p Handler instead
+/// of building a Value. Returns a ParseError on malformed input or when a
+/// callback aborts the parse.
+llvm::Error parse(llvm::StringRef JSON, ParseHandler &Handler);
+
 class ParseError : public llvm::ErrorInfo<ParseError> {
   const char *Msg;
   unsigned Line, Column, Offset;
@@ -14,6 +14,7 @@
 #ifndef LLVM_SUPPORT_LEB128_H
 #define LLVM_SUPPORT_LEB128_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/Support/raw_ostream.h"
 
 namespace llvm {
@@ -187,6 +188,61 @@ inline int64_t decodeSLEB128(const uint8_t *p, unsigned *n = nullptr,
   return Value;
 }
 
+/// Utility function to decode an array of consecutive ULEB128 values.
+///
+/// Decodes until \p Values is full, the input is exhausted, or a value is
+/// malformed, and returns the number of values decoded; \p p is advanced
+/// past the last byte consumed.  This is noticeably faster than calling
+/// decodeULEB128 in a loop: one-byte encodings (the common case in bitcode
+/// and DWARF) take an early-out path, and the per-byte end-of-buffer check
+/// is skipped whenever a maximal 10-byte encoding cannot cross \p end.
+inline size_t decodeULEB128Array(const uint8_t *&p, const uint8_t *end,
+                                 MutableArrayRef<uint64_t> Values,
+                                 const char **error = nullptr) {
+  if (error)
+    *error = nullptr;
+  size_t I = 0, E = Values.size();
+  while (I != E && p != end) {
+    // Fast path: single-byte value.
+    if (*p < 0x80) {
+      Values[I++] = *p++;
+      continue;
+    }
+    if (end - p >= 10) {
+      // A ULEB128 of a uint64_t is at most ten bytes, so no end checks are
+      // needed inside this value.
+      uint64_t Value = 0;
+      unsigned Shift = 0;
+      const uint8_t *q = p;
+      do {
+        uint64_t Slice = *q & 0x7f;
+        if (Shift >= 64 || Slice << Shift >> Shift != Slice) {
+          if (error)
+            *error = "uleb128 too big for uint64";
+          return I;
+        }
+        Value += Slice << Shift;
+        Shift += 7;
+      } while (*q++ >= 128);
+      p = q;
+      Values[I++] = Value;
+      continue;
+    }
+    // Near the end of the buffer, use the checked scalar decoder.
+    const char *ValueError = nullptr;
+    unsigned N;
+    uint64_t Value = decodeULEB128(p, &N, end, &ValueError);
+    p += N;
+    if (ValueError) {
+      if (error)
+        *error = ValueError;
+      return I;
+    }
+    Values[I++] = Value;
+  }
+  return I;
+}
+
 /// Utility function to get the size of the ULEB128-encoded value.
 extern unsigned getULEB128Size(uint64_t Value);
 
@@ -131,6 +131,29 @@ public:
   getFileSlice(const Twine &Filename, uint64_t MapSize, uint64_t Offset,
                bool IsVolatile = false);
 
+  /// Memory access patterns that can be hinted to the operating system for a
+  /// buffer's pages. These map onto madvise(2) advice values where available.
+  enum class AccessPattern {
+    Normal,     ///< No special treatment (MADV_NORMAL).
+    Sequential, ///< Expect in-order reads; enables aggressive readahead.
+    WillNeed,   ///< Pages will be needed soon; start asynchronous prefetch.
+    Hugepage    ///< Back the mapping with transparent huge pages if possible.
+  };
+
+  /// Advise the operating system how this buffer's memory will be accessed.
+  /// Purely a performance hint: it only takes effect for mmap'ed buffers and
+  /// on platforms with madvise support, and failure is always harmless.
+  /// Returns true if the hint was delivered to the OS.
+  bool adviseAccessPattern(AccessPattern Pattern) const;
+
+  /// Open the specified file as with getFile, then hint to the OS that the
+  /// contents will be read sequentially and soon (madvise MADV_SEQUENTIAL and
+  /// MADV_WILLNEED). For large mmap'ed inputs that are parsed front to back,
+  /// such as bitcode files, this lets the kernel overlap disk readahead with
+  /// parsing. The resulting buffer is not null terminated.
+  static ErrorOr<std::unique_ptr<MemoryBuffer>>
+  getFileWithReadahead(const Twine &Filename, int64_t FileSize = -1);
+
   //===--------------------------------------------------------------------===//
   // Provided for performance analysis.
   //===--------------------------------------------------------------------===//
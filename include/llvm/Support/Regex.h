@@ -93,6 +93,16 @@ namespace llvm {
     std::string sub(StringRef Repl, StringRef String,
                     std::string *Error = nullptr) const;
 
+    /// Return a process-wide cached compiled form of \p Regex. Callers that
+    /// repeatedly match the same pattern (FileCheck-style matching loops,
+    /// TargetLibraryInfo queries) should prefer this over reconstructing a
+    /// Regex, which recompiles the pattern every time.
+    ///
+    /// The returned object is shared: matching through it is thread-safe, and
+    /// it lives until llvm_shutdown. Invalid patterns are cached too; check
+    /// isValid on first use as with an ordinary Regex.
+    static const Regex &getCached(StringRef Regex, unsigned Flags = NoFlags);
+
     /// If this function returns true, ^Str$ is an extended regular
     /// expression that matches Str and only Str.
     static bool isLiteralERE(StringRef Str);
@@ -18,13 +18,14 @@
 
 #include <future>
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <utility>
+#include <vector>
 
 namespace llvm {
 
@@ -64,6 +65,17 @@ public:
     return asyncImpl(std::forward<Function>(F));
   }
 
+  /// Asynchronous submission of a task with a scheduling weight. When several
+  /// tasks are queued, heavier ones are dispatched first; equal weights run in
+  /// submission order. Callers with uneven task costs (e.g. ThinLTO backends)
+  /// should pass an estimate such as the module size so that the biggest work
+  /// items are not left for last, which wrecks tail latency. Tasks submitted
+  /// through the unweighted async() have weight 0.
+  template <typename Function>
+  inline std::shared_future<void> asyncWeighted(uint64_t Weight, Function &&F) {
+    return asyncImpl(std::forward<Function>(F), Weight);
+  }
+
   /// Blocking wait for all the threads to complete and the queue to be empty.
   /// It is an error to try to add new tasks while blocking on this call.
   void wait();
@@ -71,13 +83,47 @@ public:
 private:
   /// Asynchronous submission of a task to the pool. The returned future can be
   /// used to wait for the task to finish and is *non-blocking* on destruction.
-  std::shared_future<void> asyncImpl(TaskTy F);
+  std::shared_future<void> asyncImpl(TaskTy F, uint64_t Weight = 0);
+
+  /// A queued task together with its scheduling weight and a sequence number
+  /// that keeps equal-weight tasks in FIFO order.
+  struct WeightedTask {
+    uint64_t Weight;
+    uint64_t Seq;
+    PackagedTaskTy Task;
+  };
+
+  /// Heap order: a task sorts below another if it is lighter, or at equal
+  /// weight if it was submitted later.
+  static bool taskHeapOrder(const WeightedTask &L, const WeightedTask &R) {
+    if (L.Weight != R.Weight)
+      return L.Weight < R.Weight;
+    return L.Seq > R.Seq;
+  }
+
+  /// Push a task onto the scheduling heap. The queue lock must be held.
+  void pushTask(PackagedTaskTy Task, uint64_t Weight) {
+    Tasks.push_back(WeightedTask{Weight, NextTaskSeq++, std::move(Task)});
+    std::push_heap(Tasks.begin(), Tasks.end(), taskHeapOrder);
+  }
+
+  /// Pop the heaviest queued task. The queue lock must be held and the heap
+  /// must not be empty.
+  PackagedTaskTy popTask() {
+    std::pop_heap(Tasks.begin(), Tasks.end(), taskHeapOrder);
+    PackagedTaskTy Task = std::move(Tasks.back().Task);
+    Tasks.pop_back();
+    return Task;
+  }
 
   /// Threads in flight
   std::vector<llvm::thread> Threads;
 
-  /// Tasks waiting for execution in the pool.
-  std::queue<PackagedTaskTy> Tasks;
+  /// Tasks waiting for execution in the pool, kept as a max-heap on weight.
+  std::vector<WeightedTask> Tasks;
+
+  /// Sequence number for the next submitted task.
+  uint64_t NextTaskSeq = 0;
 
   /// Locking and signaling for accessing the Tasks queue.
   std::mutex QueueLock;
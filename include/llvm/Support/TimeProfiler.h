@@ -9,21 +9,29 @@
 #ifndef LLVM_SUPPORT_TIME_PROFILER_H
 #define LLVM_SUPPORT_TIME_PROFILER_H
 
+#include "llvm/Support/Compiler.h"
 #include "llvm/Support/raw_ostream.h"
 
 namespace llvm {
 
 struct TimeTraceProfiler;
-extern TimeTraceProfiler *TimeTraceProfilerInstance;
+extern LLVM_THREAD_LOCAL TimeTraceProfiler *TimeTraceProfilerInstance;
 
-/// Initialize the time trace profiler.
-/// This sets up the global \p TimeTraceProfilerInstance
-/// variable to be the profiler instance.
+/// Initialize the time trace profiler for the calling thread.
+/// This sets up the thread-local \p TimeTraceProfilerInstance
+/// variable to be the profiler instance. Events on each thread are
+/// recorded into that thread's own buffer without any locking.
 void timeTraceProfilerInitialize(unsigned TimeTraceGranularity);
 
-/// Cleanup the time trace profiler, if it was initialized.
+/// Cleanup the main thread's time trace profiler, if it was initialized,
+/// together with any events parked by finished threads.
 void timeTraceProfilerCleanup();
 
+/// Finish a time trace profiler running on a worker thread. The thread's
+/// events are parked until the thread that calls timeTraceProfilerWrite
+/// merges them into the final report under this thread's id.
+void timeTraceProfilerFinishThread();
+
 /// Is the time trace profiler enabled, i.e. initialized?
 inline bool timeTraceProfilerEnabled() {
   return TimeTraceProfilerInstance != nullptr;
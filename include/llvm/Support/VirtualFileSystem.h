@@ -18,13 +18,16 @@
 #include "llvm/ADT/None.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Support/Chrono.h"
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/RWMutex.h"
 #include "llvm/Support/SourceMgr.h"
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <ctime>
@@ -404,6 +407,45 @@ private:
   virtual void anchor();
 };
 
+/// A file system that forwards all operations to another and caches the
+/// result of \p status calls - including negative results - so repeated
+/// lookups of the same (often nonexistent) path become a hash probe instead
+/// of a stat syscall per layer. Header-search-heavy workloads stat the same
+/// missing paths millions of times.
+///
+/// The cache is thread-safe. Invalidation is generation-based: bumping the
+/// generation with \p invalidateStatCache makes all existing entries stale in
+/// O(1), without touching the map. Changing the working directory also bumps
+/// the generation since it can alter what relative paths refer to. The cache
+/// cannot observe modifications made behind its back (e.g. by other
+/// processes); callers that expect such changes must invalidate explicitly.
+class StatCachingFileSystem : public ProxyFileSystem {
+public:
+  explicit StatCachingFileSystem(IntrusiveRefCntPtr<FileSystem> FS)
+      : ProxyFileSystem(std::move(FS)) {}
+
+  llvm::ErrorOr<Status> status(const Twine &Path) override;
+  std::error_code setCurrentWorkingDirectory(const Twine &Path) override;
+
+  /// Make all currently cached entries stale.
+  void invalidateStatCache() {
+    Generation.fetch_add(1, std::memory_order_release);
+  }
+
+private:
+  struct CachedStat {
+    uint64_t Generation = 0;
+    /// Set for negative entries; cleared when a status is cached.
+    std::error_code EC;
+    /// Set for positive entries.
+    Optional<Status> Stat;
+  };
+
+  std::atomic<uint64_t> Generation{1};
+  llvm::sys::SmartRWMutex<true> CacheMutex;
+  llvm::StringMap<CachedStat> StatCache;
+};
+
 namespace detail {
 
 class InMemoryDirectory;
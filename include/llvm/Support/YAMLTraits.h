@@ -10,6 +10,7 @@
 #define LLVM_SUPPORT_YAMLTRAITS_H
 
 #include "llvm/ADT/Optional.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringMap.h"
@@ -1491,7 +1492,11 @@ private:
     using NameToNode = StringMap<std::unique_ptr<HNode>>;
 
     NameToNode Mapping;
-    SmallVector<std::string, 6> ValidKeys;
+    /// Values handed out by preflightKey() since the last beginMapping().
+    /// endMapping() reports any mapping entry absent from this set as an
+    /// unknown key. Tracking visited value nodes instead of key strings keeps
+    /// each key probe O(1) and allocation-free.
+    SmallPtrSet<HNode *, 16> VisitedValues;
   };
 
   class SequenceHNode : public HNode {
@@ -0,0 +1,82 @@
+//===- raw_mmap_ostream.h - mmap-backed raw_ostream -------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// A raw_pwrite_stream that writes directly into a memory-mapped view of the
+// destination file, so large outputs (bitcode, object files) land in the page
+// cache without going through an intermediate stream buffer and write(2).
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_RAW_MMAP_OSTREAM_H
+#define LLVM_SUPPORT_RAW_MMAP_OSTREAM_H
+
+#include "llvm/Support/Error.h"
+#include "llvm/Support/raw_ostream.h"
+#include <memory>
+#include <string>
+
+namespace llvm {
+
+namespace sys {
+namespace fs {
+class TempFile;
+class mapped_file_region;
+} // end namespace fs
+} // end namespace sys
+
+/// A raw_pwrite_stream over a memory-mapped temporary file.  Writes are plain
+/// memcpys into the mapping; when the mapping fills up the file is extended
+/// with ftruncate and remapped at twice the size.  Like FileOutputBuffer, the
+/// data is written to a temporary next to the destination and commit()
+/// truncates it to the bytes actually written and atomically renames it into
+/// place.  If the stream is destroyed without commit(), the temporary is
+/// deleted and the destination is left untouched.
+///
+/// create() fails (rather than silently degrading) on targets or filesystems
+/// where mmap of the destination is not possible; callers should fall back to
+/// raw_fd_ostream in that case.
+class raw_mmap_ostream : public raw_pwrite_stream {
+public:
+  /// Create a stream for \p Path.  \p SizeHint is the initial mapping size;
+  /// passing a good estimate (e.g. the input size for a link) avoids remaps.
+  static Expected<std::unique_ptr<raw_mmap_ostream>>
+  create(StringRef Path, uint64_t SizeHint = 1 << 20);
+
+  ~raw_mmap_ostream() override;
+
+  /// Truncate the file to the final size and move it to its destination.
+  /// No further writes are allowed afterwards.
+  Error commit();
+
+  /// Return the first error encountered while writing, if any.  Writes after
+  /// an error are dropped.
+  std::error_code error() const { return EC; }
+
+private:
+  raw_mmap_ostream(StringRef Path,
+                   std::unique_ptr<sys::fs::TempFile> Temp,
+                   std::unique_ptr<sys::fs::mapped_file_region> Map);
+
+  void write_impl(const char *Ptr, size_t Size) override;
+  void pwrite_impl(const char *Ptr, size_t Size, uint64_t Offset) override;
+  uint64_t current_pos() const override { return Pos; }
+
+  /// Extend the file and remap it so at least \p MinSize bytes fit.
+  void grow(uint64_t MinSize);
+
+  std::string FinalPath;
+  std::unique_ptr<sys::fs::TempFile> Temp;
+  std::unique_ptr<sys::fs::mapped_file_region> Map;
+  uint64_t Pos = 0;
+  bool Committed = false;
+  std::error_code EC;
+};
+
+} // end namespace llvm
+
+#endif // LLVM_SUPPORT_RAW_MMAP_OSTREAM_H
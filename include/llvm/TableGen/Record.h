@@ -1441,6 +1441,10 @@ class Record {
   // Tracks Record instances. Not owned by Record.
   RecordKeeper &TrackedRecords;
 
+  // Lazily built index from field name to position in Values, to avoid
+  // scanning the field list on every lookup. Not copied; rebuilt on demand.
+  mutable DenseMap<const Init *, unsigned> ValueIndex;
+
   DefInit *TheInit = nullptr;
 
   // Unique record ID.
@@ -1520,6 +1524,19 @@ public:
   }
 
   const RecordVal *getValue(const Init *Name) const {
+    // Field lookups are hot in the backends and records routinely carry
+    // dozens of fields, so index larger records rather than scanning. Every
+    // append changes the size of Values, which invalidates the index here;
+    // removeValue() clears it explicitly.
+    if (Values.size() > 8) {
+      if (ValueIndex.size() != Values.size()) {
+        ValueIndex.clear();
+        for (unsigned I = 0, E = Values.size(); I != E; ++I)
+          ValueIndex[Values[I].getNameInit()] = I;
+      }
+      auto It = ValueIndex.find(Name);
+      return It == ValueIndex.end() ? nullptr : &Values[It->second];
+    }
     for (const RecordVal &Val : Values)
       if (Val.Name == Name) return &Val;
     return nullptr;
@@ -1548,6 +1565,9 @@ public:
   }
 
   void removeValue(Init *Name) {
+    // A removal followed by an append can restore the old size, so the size
+    // check in getValue() would not catch the stale index.
+    ValueIndex.clear();
     for (unsigned i = 0, e = Values.size(); i != e; ++i)
       if (Values[i].getNameInit() == Name) {
         Values.erase(Values.begin()+i);
@@ -1692,6 +1712,9 @@ class RecordKeeper {
   RecordMap Classes, Defs;
   FoldingSet<RecordRecTy> RecordTypePool;
   std::map<std::string, Init *, std::less<>> ExtraGlobals;
+  // Memoized getAllDerivedDefinitions() results; invalidated by addDef().
+  mutable std::map<std::string, std::vector<Record *>, std::less<>>
+      DerivedDefsCache;
   unsigned AnonCounter = 0;
 
 public:
@@ -1723,6 +1746,7 @@ public:
   }
 
   void addDef(std::unique_ptr<Record> R) {
+    DerivedDefsCache.clear();
     bool Ins = Defs.insert(std::make_pair(R->getName(),
                                           std::move(R))).second;
     (void)Ins;
@@ -76,10 +76,17 @@ public:
     WorklistMap.erase(It);
   }
 
+  /// RemoveOne - Pop the next live instruction, skipping over any slots that
+  /// were nulled out by Remove(). Returns null once only dead slots remain.
   Instruction *RemoveOne() {
-    Instruction *I = Worklist.pop_back_val();
-    WorklistMap.erase(I);
-    return I;
+    while (!Worklist.empty()) {
+      Instruction *I = Worklist.pop_back_val();
+      if (!I)
+        continue;
+      WorklistMap.erase(I);
+      return I;
+    }
+    return nullptr;
   }
 
   /// AddUsersToWorkList - When an instruction is simplified, add all users of
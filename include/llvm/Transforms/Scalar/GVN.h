@@ -185,6 +185,11 @@ private:
   // find back edge easily.
   DenseMap<AssertingVH<BasicBlock>, uint32_t> BlockRPONumber;
 
+  // Blocks in reverse postorder, computed together with BlockRPONumber. This
+  // only depends on the CFG, so it is kept across fixpoint iterations and
+  // recomputed when InvalidBlockRPONumbers says the CFG has changed.
+  SmallVector<BasicBlock *, 64> BlockRPOOrder;
+
   // This is set 'true' initially and also when new blocks have been added to
   // the function being analyzed. This boolean is used to control the updating
   // of BlockRPONumber prior to accessing the contents of BlockRPONumber.
@@ -91,6 +91,10 @@ class JumpThreadingPass : public PassInfoMixin<JumpThreadingPass> {
 
   unsigned BBDupThreshold;
 
+  /// Running total of instruction duplication cost spent on the current
+  /// function, used to enforce -jump-threading-total-threshold.
+  unsigned DuplicationCostLedger = 0;
+
 public:
   JumpThreadingPass(int T = -1);
 
@@ -149,6 +153,9 @@ public:
   bool ThreadGuard(BasicBlock *BB, IntrinsicInst *Guard, BranchInst *BI);
 
 private:
+  /// Charge \p Cost against the per-function duplication budget. Returns
+  /// false (leaving the ledger untouched) if the budget is exhausted.
+  bool chargeDuplicationCost(unsigned Cost);
   BasicBlock *SplitBlockPreds(BasicBlock *BB, ArrayRef<BasicBlock *> Preds,
                               const char *Suffix);
   void UpdateBlockFreqAndEdgeWeight(BasicBlock *PredBB, BasicBlock *BB,
@@ -0,0 +1,67 @@
+//===- BatchRAUW.h - Bulk replaceAllUsesWith helper -------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the BatchRAUW class.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TRANSFORMS_UTILS_BATCHRAUW_H
+#define LLVM_TRANSFORMS_UTILS_BATCHRAUW_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+
+namespace llvm {
+
+class Value;
+
+/// Helper class for replacing many values at once.
+///
+/// Passes that rewrite large numbers of values (LowerTypeTests-style
+/// transformations, instrumentation) often build replacement chains: a is
+/// replaced by b, and b in turn by c. Performing those as individual
+/// replaceAllUsesWith calls rewrites the same uses repeatedly and fires a
+/// ValueHandle callback for every intermediate step. BatchRAUW collects
+/// (from, to) pairs, resolves chains up front, and then rewrites each
+/// affected use-list exactly once, so ValueHandles observe a single
+/// replacement with the final value.
+class BatchRAUW {
+  /// Values to be replaced, in insertion order; execute() processes them in
+  /// this order so diagnostics stay deterministic.
+  SmallVector<Value *, 16> FromValues;
+
+  /// The (possibly chained) replacement target for each recorded value.
+  DenseMap<Value *, Value *> Targets;
+
+public:
+  BatchRAUW() = default;
+  BatchRAUW(const BatchRAUW &) = delete;
+  BatchRAUW &operator=(const BatchRAUW &) = delete;
+
+  /// Record that all uses of \p From should refer to \p To once execute()
+  /// runs. Recording the same \p From again overwrites the earlier target.
+  /// The two values must have the same type, and the recorded pairs must not
+  /// form a cycle.
+  void addReplacement(Value *From, Value *To);
+
+  /// Apply all recorded replacements and reset the book-keeping so the
+  /// object can be reused.
+  void execute();
+
+  /// Discard all recorded replacements without applying them.
+  void clear() {
+    FromValues.clear();
+    Targets.clear();
+  }
+
+  bool empty() const { return FromValues.empty(); }
+};
+
+} // end namespace llvm
+
+#endif // LLVM_TRANSFORMS_UTILS_BATCHRAUW_H
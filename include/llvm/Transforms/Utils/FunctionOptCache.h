@@ -0,0 +1,40 @@
+//===- FunctionOptCache.h - Reuse optimized bodies of identical functions -===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// A module-to-function pass adaptor that avoids re-running its function
+// pipeline on functions that are identical to one it has already optimized.
+// Template-heavy code can produce many identical linkonce_odr functions per
+// module; this adaptor optimizes one representative of each equivalence class
+// and clones the optimized body into the duplicates.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TRANSFORMS_UTILS_FUNCTIONOPTCACHE_H
+#define LLVM_TRANSFORMS_UTILS_FUNCTIONOPTCACHE_H
+
+#include "llvm/IR/PassManager.h"
+
+namespace llvm {
+
+/// Runs a function pass pipeline over a module like
+/// ModuleToFunctionPassAdaptor, but groups functions that are identical
+/// before optimization and runs the pipeline only on the first member of
+/// each group, splicing its optimized body into the remaining members.
+class FunctionOptCachePass : public PassInfoMixin<FunctionOptCachePass> {
+  FunctionPassManager FPM;
+
+public:
+  explicit FunctionOptCachePass(FunctionPassManager FPM)
+      : FPM(std::move(FPM)) {}
+
+  PreservedAnalyses run(Module &M, ModuleAnalysisManager &AM);
+};
+
+} // end namespace llvm
+
+#endif // LLVM_TRANSFORMS_UTILS_FUNCTIONOPTCACHE_H
@@ -77,6 +77,16 @@ public:
   /// Sets the runtime SCEV checks for versioning the loop.
   void setSCEVChecks(SCEVUnionPredicate Check);
 
+  /// Unions \p Checks into the alias checks for versioning the loop,
+  /// dropping pairs of checking groups that are already covered in either
+  /// order.  This lets a client coordinating several transforms accumulate
+  /// their memcheck sets and emit one combined guard instead of a chain of
+  /// redundant ones.
+  void addAliasChecks(ArrayRef<RuntimePointerChecking::PointerCheck> Checks);
+
+  /// Unions \p Check into the SCEV checks for versioning the loop.
+  void addSCEVChecks(const SCEVUnionPredicate &Check);
+
   /// Annotate memory instructions in the versioned loop with no-alias
   /// metadata based on the memchecks issued.
   ///
@@ -49,6 +49,7 @@
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/CommandLine.h"
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <iterator>
@@ -60,6 +61,11 @@ using namespace llvm;
 static cl::opt<bool> DisableBasicAA("disable-basicaa", cl::Hidden,
                                     cl::init(false));
 
+uint64_t AAQueryInfo::getNextBatchID() {
+  static std::atomic<uint64_t> NextBatchID{1};
+  return NextBatchID.fetch_add(1, std::memory_order_relaxed);
+}
+
 AAResults::AAResults(AAResults &&Arg)
     : TLI(Arg.TLI), AAs(std::move(Arg.AAs)), AADeps(std::move(Arg.AADeps)) {
   for (auto &AA : AAs)
@@ -15,6 +15,7 @@
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/IR/BasicBlock.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/InstrTypes.h"
@@ -35,6 +36,13 @@
 using namespace llvm;
 using namespace llvm::PatternMatch;
 
+#define DEBUG_TYPE "assumption-cache"
+
+STATISTIC(NumAssumeQueries,
+          "Number of per-value assumption list queries");
+STATISTIC(NumAssumeHandlesScanned,
+          "Number of assumption handles returned by per-value queries");
+
 static cl::opt<bool>
     VerifyAssumptionCache("verify-assumption-cache", cl::Hidden,
                           cl::desc("Enable verification of assumption cache"),
@@ -53,6 +61,29 @@ AssumptionCache::getOrInsertAffectedValues(Value *V) {
   return AVIP.first->second;
 }
 
+MutableArrayRef<WeakTrackingVH>
+AssumptionCache::assumptionsFor(const Value *V) {
+  if (!Scanned)
+    scanFunction();
+
+  ++NumAssumeQueries;
+
+  auto AVI = AffectedValues.find_as(const_cast<Value *>(V));
+  if (AVI == AffectedValues.end())
+    return MutableArrayRef<WeakTrackingVH>();
+
+  // Deleted assumptions leave null handles behind. Compact them out so
+  // repeated queries against assume-heavy functions do not keep re-visiting
+  // dead entries.
+  auto &Handles = AVI->second;
+  Handles.erase(std::remove_if(Handles.begin(), Handles.end(),
+                               [](const WeakTrackingVH &VH) { return !VH; }),
+                Handles.end());
+
+  NumAssumeHandlesScanned += Handles.size();
+  return Handles;
+}
+
 static void findAffectedValues(CallInst *CI,
                                SmallVectorImpl<Value *> &Affected) {
   // Note: This code must be kept in-sync with the code in
@@ -647,6 +647,27 @@ bool BasicAAResult::DecomposeGEPExpression(const Value *V,
   return true;
 }
 
+/// Memoizing wrapper around DecomposeGEPExpression for the current query
+/// batch. \p Decomposed must be initialized as for DecomposeGEPExpression.
+bool BasicAAResult::decomposeGEPExpressionCached(const Value *V,
+                                                 DecomposedGEP &Decomposed,
+                                                 AAQueryInfo &AAQI) {
+  if (DecompBatchID != AAQI.BatchID) {
+    DecompCache.clear();
+    DecompBatchID = AAQI.BatchID;
+  }
+
+  auto It = DecompCache.find(V);
+  if (It != DecompCache.end()) {
+    Decomposed = It->second.first;
+    return It->second.second;
+  }
+
+  bool MaxLookupReached = DecomposeGEPExpression(V, Decomposed, DL, &AC, DT);
+  DecompCache.try_emplace(V, Decomposed, MaxLookupReached);
+  return MaxLookupReached;
+}
+
 /// Returns whether the given pointer value points to memory that is local to
 /// the function, with global constants being considered local to all
 /// functions.
@@ -1317,9 +1338,9 @@ AliasResult BasicAAResult::aliasGEP(
   DecompGEP2.StructOffset = DecompGEP2.OtherOffset = APInt(MaxPointerSize, 0);
 
   bool GEP1MaxLookupReached =
-    DecomposeGEPExpression(GEP1, DecompGEP1, DL, &AC, DT);
+    decomposeGEPExpressionCached(GEP1, DecompGEP1, AAQI);
   bool GEP2MaxLookupReached =
-    DecomposeGEPExpression(V2, DecompGEP2, DL, &AC, DT);
+    decomposeGEPExpressionCached(V2, DecompGEP2, AAQI);
 
   APInt GEP1BaseOffset = DecompGEP1.StructOffset + DecompGEP1.OtherOffset;
   APInt GEP2BaseOffset = DecompGEP2.StructOffset + DecompGEP2.OtherOffset;
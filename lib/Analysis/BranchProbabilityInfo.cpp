@@ -251,6 +251,43 @@ bool BranchProbabilityInfo::calcUnreachableHeuristics(const BasicBlock *BB) {
 // 'expect' intrinsic processing. Examine metadata against unreachable
 // heuristic. The probability of the edge coming to unreachable block is
 // set to min of metadata and unreachable heuristic.
+/// Whether weight metadata alone decides every edge probability in \p F.
+///
+/// That is the case when every branch with two or more successors carries a
+/// complete, well-formed branch_weights annotation and nothing feeds the
+/// PostDominatedByUnreachable set that calcMetadataWeights refines its
+/// weights against (no unreachable terminators and no terminating deoptimize
+/// calls). Under these conditions running only calcMetadataWeights over the
+/// blocks produces exactly the probabilities of the full calculation, and
+/// the SCC and post-dominance bookkeeping is dead work.
+bool BranchProbabilityInfo::hasCompleteProfileCoverage(
+    const Function &F) const {
+  for (const BasicBlock &BB : F) {
+    const Instruction *TI = BB.getTerminator();
+    unsigned NumSucc = TI->getNumSuccessors();
+    if (NumSucc == 0) {
+      if (isa<UnreachableInst>(TI) || BB.getTerminatingDeoptimizeCall())
+        return false;
+      continue;
+    }
+    if (NumSucc < 2)
+      continue;
+    // These are the same conditions calcMetadataWeights requires to accept
+    // the annotation; an invoke or a malformed node there would fall back to
+    // the heuristics.
+    if (!(isa<BranchInst>(TI) || isa<SwitchInst>(TI) ||
+          isa<IndirectBrInst>(TI)))
+      return false;
+    MDNode *WeightsNode = TI->getMetadata(LLVMContext::MD_prof);
+    if (!WeightsNode || WeightsNode->getNumOperands() != NumSucc + 1)
+      return false;
+    for (unsigned I = 1, E = WeightsNode->getNumOperands(); I != E; ++I)
+      if (!mdconst::dyn_extract<ConstantInt>(WeightsNode->getOperand(I)))
+        return false;
+  }
+  return true;
+}
+
 bool BranchProbabilityInfo::calcMetadataWeights(const BasicBlock *BB) {
   const Instruction *TI = BB->getTerminator();
   assert(TI->getNumSuccessors() > 1 && "expected more than one successor!");
@@ -954,6 +991,26 @@ void BranchProbabilityInfo::calculate(const Function &F, const LoopInfo &LI,
   assert(PostDominatedByUnreachable.empty());
   assert(PostDominatedByColdCall.empty());
 
+  // Fast path for fully profiled functions: the weight metadata decides
+  // every edge and none of the heuristics below can fire, so skip the SCC
+  // and post-dominance bookkeeping they need. This is the common shape for
+  // PGO-annotated IR.
+  if (hasCompleteProfileCoverage(F)) {
+    for (auto BB : post_order(&F.getEntryBlock())) {
+      if (BB->getTerminator()->getNumSuccessors() < 2)
+        continue;
+      bool FromMetadata = calcMetadataWeights(BB);
+      (void)FromMetadata;
+      assert(FromMetadata && "coverage check guarantees metadata weights");
+    }
+
+    if (PrintBranchProb &&
+        (PrintBranchProbFuncName.empty() ||
+         F.getName().equals(PrintBranchProbFuncName)))
+      print(dbgs());
+    return;
+  }
+
   // Record SCC numbers of blocks in the CFG to identify irreducible loops.
   // FIXME: We could only calculate this if the CFG is known to be irreducible
   // (perhaps cache this info in LoopInfo if we can easily calculate it there?).
@@ -15,13 +15,17 @@
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/iterator_range.h"
 #include "llvm/Analysis/LazyCallGraph.h"
+#include "llvm/Analysis/LoopInfo.h"
 #include "llvm/IR/CallSite.h"
 #include "llvm/IR/Constant.h"
+#include "llvm/IR/Dominators.h"
 #include "llvm/IR/InstIterator.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/PassManager.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
@@ -31,6 +35,11 @@
 
 using namespace llvm;
 
+static cl::opt<bool> PrecomputeFunctionAnalysesFlag(
+    "cgscc-precompute-function-analyses", cl::Hidden, cl::init(false),
+    cl::desc("Compute dominator trees and loop info for all functions in "
+             "parallel before the post-order CGSCC walk begins"));
+
 // Explicit template instantiations and specialization definitions for core
 // template typedefs.
 namespace llvm {
@@ -707,3 +716,40 @@ LazyCallGraph::SCC &llvm::updateCGAndAnalysisManagerForFunctionPass(
 
   return *C;
 }
+
+void llvm::precomputeFunctionAnalyses(Module &M, FunctionAnalysisManager &FAM,
+                                      bool Force) {
+  if (!Force && !PrecomputeFunctionAnalysesFlag)
+    return;
+
+  // Only consider function definitions with no result cached yet; seeding a
+  // cached analysis is not allowed, and declarations have no bodies to
+  // analyze.
+  std::vector<Function *> Fns;
+  for (Function &F : M)
+    if (!F.isDeclaration() && !FAM.getCachedResult<DominatorTreeAnalysis>(F) &&
+        !FAM.getCachedResult<LoopAnalysis>(F))
+      Fns.push_back(&F);
+  if (Fns.empty())
+    return;
+
+  // Dominator tree and loop info construction only read the IR and touch no
+  // LLVMContext-global state (in particular, they register no value handles),
+  // so they are safe to compute concurrently. Analyses like AssumptionCache
+  // or BlockFrequencyInfo are not: the former registers callback handles in
+  // the context-wide value handle table and the latter pulls further analyses
+  // out of the manager while running.
+  std::vector<std::unique_ptr<DominatorTree>> DTs(Fns.size());
+  std::vector<std::unique_ptr<LoopInfo>> LIs(Fns.size());
+  parallel::for_each_n(parallel::par, size_t(0), Fns.size(), [&](size_t I) {
+    DTs[I] = std::make_unique<DominatorTree>(*Fns[I]);
+    LIs[I] = std::make_unique<LoopInfo>(*DTs[I]);
+  });
+
+  // Hand the results to the manager from this thread; from here on they are
+  // invalidated exactly like results the manager computed itself.
+  for (size_t I = 0, E = Fns.size(); I != E; ++I) {
+    FAM.cacheResult<DominatorTreeAnalysis>(*Fns[I], std::move(*DTs[I]));
+    FAM.cacheResult<LoopAnalysis>(*Fns[I], std::move(*LIs[I]));
+  }
+}
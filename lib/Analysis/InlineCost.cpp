@@ -44,6 +44,10 @@ using namespace llvm;
 #define DEBUG_TYPE "inline-cost"
 
 STATISTIC(NumCallsAnalyzed, "Number of call sites analyzed");
+STATISTIC(NumViabilityCacheHits,
+          "Number of inline viability queries served from the cache");
+STATISTIC(NumViabilityCacheMisses,
+          "Number of inline viability queries that walked the callee");
 
 static cl::opt<int> InlineThreshold(
     "inline-threshold", cl::Hidden, cl::init(225), cl::ZeroOrMore,
@@ -2139,6 +2143,26 @@ InlineResult llvm::isInlineViable(Function &F) {
   return true;
 }
 
+void InlineViabilityCache::FunctionCallbackVH::deleted() {
+  // RAUW does not change what the viability walk would conclude, so only
+  // deletion needs handling here.
+  IVC->Entries.erase(cast<Function>(getValPtr()));
+  // 'this' now dangles!
+}
+
+InlineResult InlineViabilityCache::get(Function &Callee) {
+  uint64_t Epoch = Callee.getModificationEpoch();
+  auto I = Entries.find(FunctionCallbackVH(&Callee));
+  if (I != Entries.end() && I->second.first == Epoch) {
+    ++NumViabilityCacheHits;
+    return I->second.second;
+  }
+  ++NumViabilityCacheMisses;
+  InlineResult Viable = isInlineViable(Callee);
+  Entries[FunctionCallbackVH(&Callee, this)] = {Epoch, Viable};
+  return Viable;
+}
+
 // APIs to create InlineParams based on command line flags and/or other
 // parameters.
 
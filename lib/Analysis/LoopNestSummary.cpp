@@ -0,0 +1,74 @@
+//===- LoopNestSummary.cpp - Loop summary analysis ------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the per-loop summary analysis. See the header for the
+// motivation.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Analysis/LoopNestSummary.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/IR/Argument.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+
+#define DEBUG_TYPE "loop-nest-summary"
+
+LoopNestSummary::LoopNestSummary(Loop &L) : TheLoop(L) {
+  Latch = L.getLoopLatch();
+  DedicatedExits = L.hasDedicatedExits();
+  L.getExitingBlocks(ExitingBlocks);
+  L.getUniqueExitBlocks(ExitBlocks);
+
+  for (BasicBlock *BB : L.blocks())
+    for (Instruction &I : *BB) {
+      // Record the loop-invariant inputs of the loop body. Only instructions
+      // and arguments are interesting; constants and globals are trivially
+      // invariant and would bloat the set.
+      for (Value *Op : I.operands())
+        if ((isa<Instruction>(Op) || isa<Argument>(Op)) &&
+            L.isLoopInvariant(Op))
+          InvariantOperands.insert(Op);
+
+      if (isa<LoadInst>(I) || isa<StoreInst>(I))
+        MemoryFootprint.push_back(MemoryLocation::get(&I));
+    }
+}
+
+void LoopNestSummary::print(raw_ostream &OS) const {
+  OS << "Loop '" << TheLoop.getHeader()->getName() << "':\n";
+  OS << "  latch: "
+     << (Latch ? Latch->getName() : StringRef("<multiple>")) << "\n";
+  OS << "  dedicated exits: " << (DedicatedExits ? "yes" : "no") << "\n";
+  OS << "  exiting blocks:";
+  for (BasicBlock *BB : ExitingBlocks)
+    OS << " " << BB->getName();
+  OS << "\n  exit blocks:";
+  for (BasicBlock *BB : ExitBlocks)
+    OS << " " << BB->getName();
+  OS << "\n  invariant operands: " << InvariantOperands.size() << "\n";
+  OS << "  memory accesses: " << MemoryFootprint.size() << "\n";
+}
+
+AnalysisKey LoopNestSummaryAnalysis::Key;
+
+LoopNestSummary LoopNestSummaryAnalysis::run(Loop &L, LoopAnalysisManager &AM,
+                                             LoopStandardAnalysisResults &AR) {
+  return LoopNestSummary(L);
+}
+
+PreservedAnalyses LoopNestSummaryPrinterPass::run(Loop &L,
+                                                  LoopAnalysisManager &AM,
+                                                  LoopStandardAnalysisResults &AR,
+                                                  LPMUpdater &U) {
+  AM.getResult<LoopNestSummaryAnalysis>(L, AR).print(OS);
+  return PreservedAnalyses::all();
+}
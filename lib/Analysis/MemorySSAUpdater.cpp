@@ -1271,6 +1271,37 @@ void MemorySSAUpdater::wireOldPredecessorsToNewImmediatePredecessor(
 }
 
 void MemorySSAUpdater::removeMemoryAccess(MemoryAccess *MA, bool OptimizePhis) {
+  SmallSetVector<MemoryPhi *, 4> PhisToCheck;
+  removeSingleAccess(MA, OptimizePhis, PhisToCheck);
+
+  // Optionally optimize Phi uses. This will recursively remove trivial phis.
+  if (!PhisToCheck.empty()) {
+    SmallVector<WeakVH, 16> PhisToOptimize{PhisToCheck.begin(),
+                                           PhisToCheck.end()};
+    tryRemoveTrivialPhis(PhisToOptimize);
+  }
+}
+
+void MemorySSAUpdater::removeMemoryAccesses(ArrayRef<MemoryAccess *> MAs,
+                                            bool OptimizePhis) {
+  // Accumulate the phis touched while re-pointing uses across the whole batch
+  // so each one is only examined once, after all removals are done. Running
+  // tryRemoveTrivialPhi per removal would re-walk the same phis repeatedly
+  // when a pass deletes many accesses with common users.
+  SmallSetVector<MemoryPhi *, 4> PhisToCheck;
+  for (MemoryAccess *MA : MAs)
+    removeSingleAccess(MA, OptimizePhis, PhisToCheck);
+
+  if (!PhisToCheck.empty()) {
+    SmallVector<WeakVH, 16> PhisToOptimize{PhisToCheck.begin(),
+                                           PhisToCheck.end()};
+    tryRemoveTrivialPhis(PhisToOptimize);
+  }
+}
+
+void MemorySSAUpdater::removeSingleAccess(
+    MemoryAccess *MA, bool OptimizePhis,
+    SmallSetVector<MemoryPhi *, 4> &PhisToCheck) {
   assert(!MSSA->isLiveOnEntryDef(MA) &&
          "Trying to remove the live on entry def");
   // We can only delete phi nodes if they have no uses, or we can replace all
@@ -1289,8 +1320,6 @@ void MemorySSAUpdater::removeMemoryAccess(MemoryAccess *MA, bool OptimizePhis) {
     NewDefTarget = cast<MemoryUseOrDef>(MA)->getDefiningAccess();
   }
 
-  SmallSetVector<MemoryPhi *, 4> PhisToCheck;
-
   // Re-point the uses at our defining access
   if (!isa<MemoryUse>(MA) && !MA->use_empty()) {
     // Reset optimized on users of this store, and reset the uses.
@@ -1317,23 +1346,15 @@ void MemorySSAUpdater::removeMemoryAccess(MemoryAccess *MA, bool OptimizePhis) {
     }
   }
 
+  // MA may have been queued by an earlier removal in the same batch; drop it
+  // so the caller does not visit a deleted phi.
+  if (MemoryPhi *MP = dyn_cast<MemoryPhi>(MA))
+    PhisToCheck.remove(MP);
+
   // The call below to erase will destroy MA, so we can't change the order we
   // are doing things here
   MSSA->removeFromLookups(MA);
   MSSA->removeFromLists(MA);
-
-  // Optionally optimize Phi uses. This will recursively remove trivial phis.
-  if (!PhisToCheck.empty()) {
-    SmallVector<WeakVH, 16> PhisToOptimize{PhisToCheck.begin(),
-                                           PhisToCheck.end()};
-    PhisToCheck.clear();
-
-    unsigned PhisSize = PhisToOptimize.size();
-    while (PhisSize-- > 0)
-      if (MemoryPhi *MP =
-              cast_or_null<MemoryPhi>(PhisToOptimize.pop_back_val()))
-        tryRemoveTrivialPhi(MP);
-  }
 }
 
 void MemorySSAUpdater::removeBlocks(
@@ -1634,8 +1634,38 @@ static APInt extractConstantWithoutWrapping(ScalarEvolution &SE,
   return APInt(BitWidth, 0);
 }
 
+void ScalarEvolution::insertExtFoldCacheEntry(const ExtFoldKey &Key,
+                                              const SCEV *S) {
+  auto I = ExtFoldCache.insert({Key, S});
+  if (!I.second)
+    return;
+  // Register both the operand and the result so that forgetting either
+  // drops the entry.
+  ExtFoldCacheUser[Key.first.second].push_back(Key);
+  if (S != Key.first.second)
+    ExtFoldCacheUser[S].push_back(Key);
+}
+
 const SCEV *
 ScalarEvolution::getZeroExtendExpr(const SCEV *Op, Type *Ty, unsigned Depth) {
+  ExtFoldKey Key({scZeroExtend, Op}, Ty);
+  auto Iter = ExtFoldCache.find(Key);
+  if (Iter != ExtFoldCache.end())
+    return Iter->second;
+
+  const SCEV *S = getZeroExtendExprImpl(Op, Ty, Depth);
+  // A plain zext node is already found cheaply by the FindNodeOrInsertPos
+  // check in the impl; only cache the expensive folds. A depth-limited
+  // conservative fold may be cached, which is sound, just not maximally
+  // precise.
+  if (!isa<SCEVZeroExtendExpr>(S))
+    insertExtFoldCacheEntry(Key, S);
+  return S;
+}
+
+const SCEV *
+ScalarEvolution::getZeroExtendExprImpl(const SCEV *Op, Type *Ty,
+                                       unsigned Depth) {
   assert(getTypeSizeInBits(Op->getType()) < getTypeSizeInBits(Ty) &&
          "This is not an extending conversion!");
   assert(isSCEVable(Ty) &&
@@ -1942,6 +1972,20 @@ ScalarEvolution::getZeroExtendExpr(const SCEV *Op, Type *Ty, unsigned Depth) {
 
 const SCEV *
 ScalarEvolution::getSignExtendExpr(const SCEV *Op, Type *Ty, unsigned Depth) {
+  ExtFoldKey Key({scSignExtend, Op}, Ty);
+  auto Iter = ExtFoldCache.find(Key);
+  if (Iter != ExtFoldCache.end())
+    return Iter->second;
+
+  const SCEV *S = getSignExtendExprImpl(Op, Ty, Depth);
+  if (!isa<SCEVSignExtendExpr>(S))
+    insertExtFoldCacheEntry(Key, S);
+  return S;
+}
+
+const SCEV *
+ScalarEvolution::getSignExtendExprImpl(const SCEV *Op, Type *Ty,
+                                       unsigned Depth) {
   assert(getTypeSizeInBits(Op->getType()) < getTypeSizeInBits(Ty) &&
          "This is not an extending conversion!");
   assert(isSCEVable(Ty) &&
@@ -6777,6 +6821,8 @@ void ScalarEvolution::forgetAllLoops() {
   HasRecMap.clear();
   MinTrailingZerosCache.clear();
   PredicatedSCEVRewrites.clear();
+  ExtFoldCache.clear();
+  ExtFoldCacheUser.clear();
 }
 
 void ScalarEvolution::forgetLoop(const Loop *L) {
@@ -11846,6 +11892,13 @@ ScalarEvolution::forgetMemoizedResults(const SCEV *S) {
   HasRecMap.erase(S);
   MinTrailingZerosCache.erase(S);
 
+  auto ExtFoldUser = ExtFoldCacheUser.find(S);
+  if (ExtFoldUser != ExtFoldCacheUser.end()) {
+    for (const ExtFoldKey &Key : ExtFoldUser->second)
+      ExtFoldCache.erase(Key);
+    ExtFoldCacheUser.erase(ExtFoldUser);
+  }
+
   for (auto I = PredicatedSCEVRewrites.begin();
        I != PredicatedSCEVRewrites.end();) {
     std::pair<const SCEV *, const Loop *> Entry = I->first;
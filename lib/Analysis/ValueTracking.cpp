@@ -120,6 +120,17 @@ struct Query {
   /// If true, it is safe to use metadata during simplification.
   InstrInfoQuery IIQ;
 
+  /// Memoized known-bits results for this query session, keyed on the value
+  /// and the depth it was queried at. Everything a result depends on besides
+  /// the key (the context instruction, dominator tree, metadata flags) is
+  /// fixed for the lifetime of the Query, and the IR cannot change while a
+  /// query is in flight, so no external invalidation is needed. Derived
+  /// queries with extra excluded assumptions deliberately start with an
+  /// empty table; their results are computed with less information and must
+  /// not be mixed with the parent's.
+  mutable DenseMap<std::pair<const Value *, unsigned>, KnownBits>
+      KnownBitsMemo;
+
   unsigned NumExcluded = 0;
 
   Query(const DataLayout &DL, AssumptionCache *AC, const Instruction *CxtI,
@@ -1708,6 +1719,19 @@ void computeKnownBits(const Value *V, KnownBits &Known, unsigned Depth,
   if (Depth == MaxDepth)
     return;
 
+  // Everything below (the operator walk, pointer alignment and assume
+  // refinement) depends only on state that is fixed for the lifetime of Q,
+  // so shared subdags reached again at the same depth can reuse the memoized
+  // result instead of being re-walked. Top-level queries (Depth == 0) are
+  // never revisited and are not worth an insertion.
+  if (Depth > 0) {
+    auto MemoIt = Q.KnownBitsMemo.find({V, Depth});
+    if (MemoIt != Q.KnownBitsMemo.end()) {
+      Known = MemoIt->second;
+      return;
+    }
+  }
+
   // A weak GlobalAlias is totally unknown. A non-weak GlobalAlias has
   // the bits of its aliasee.
   if (const GlobalAlias *GA = dyn_cast<GlobalAlias>(V)) {
@@ -1732,6 +1756,9 @@ void computeKnownBits(const Value *V, KnownBits &Known, unsigned Depth,
   // Check whether a nearby assume intrinsic can determine some known bits.
   computeKnownBitsFromAssume(V, Known, Depth, Q);
 
+  if (Depth > 0)
+    Q.KnownBitsMemo.try_emplace(std::make_pair(V, Depth), Known);
+
   assert((Known.Zero & Known.One) == 0 && "Bits known to be one AND zero?");
 }
 
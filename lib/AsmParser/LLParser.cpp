@@ -202,10 +202,16 @@ bool LLParser::ValidateEndOfModule() {
                  "use of undefined comdat '$" +
                      ForwardRefComdats.begin()->first + "'");
 
-  if (!ForwardRefVals.empty())
-    return Error(ForwardRefVals.begin()->second.second,
-                 "use of undefined value '@" + ForwardRefVals.begin()->first +
-                 "'");
+  if (!ForwardRefVals.empty()) {
+    // Pick the lexicographically smallest name so the diagnostic does not
+    // depend on hash table order.
+    auto *FRV = &*ForwardRefVals.begin();
+    for (auto &Entry : ForwardRefVals)
+      if (Entry.first() < FRV->first())
+        FRV = &Entry;
+    return Error(FRV->second.second,
+                 "use of undefined value '@" + Twine(FRV->first()) + "'");
+  }
 
   if (!ForwardRefValIDs.empty())
     return Error(ForwardRefValIDs.begin()->second.second,
@@ -2855,10 +2861,16 @@ LLParser::PerFunctionState::~PerFunctionState() {
 }
 
 bool LLParser::PerFunctionState::FinishFunction() {
-  if (!ForwardRefVals.empty())
-    return P.Error(ForwardRefVals.begin()->second.second,
-                   "use of undefined value '%" + ForwardRefVals.begin()->first +
-                   "'");
+  if (!ForwardRefVals.empty()) {
+    // Pick the lexicographically smallest name so the diagnostic does not
+    // depend on hash table order.
+    auto *FRV = &*ForwardRefVals.begin();
+    for (auto &Entry : ForwardRefVals)
+      if (Entry.first() < FRV->first())
+        FRV = &Entry;
+    return P.Error(FRV->second.second,
+                   "use of undefined value '%" + Twine(FRV->first()) + "'");
+  }
   if (!ForwardRefValIDs.empty())
     return P.Error(ForwardRefValIDs.begin()->second.second,
                    "use of undefined value '%" +
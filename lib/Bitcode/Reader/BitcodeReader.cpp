@@ -70,7 +70,9 @@
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/MathExtras.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/thread.h"
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
@@ -566,13 +568,23 @@ class BitcodeReader : public BitcodeReaderBase, public GVMaterializer {
   std::vector<std::string> BundleTags;
   SmallVector<SyncScope::ID, 8> SSIDs;
 
+  /// Background thread paging in the bodies of functions named in the last
+  /// prefetch() call. Joined before starting a new request and on
+  /// destruction; it only ever reads the bitcode buffer.
+  Optional<llvm::thread> PrefetchThread;
+
 public:
   BitcodeReader(BitstreamCursor Stream, StringRef Strtab,
                 StringRef ProducerIdentification, LLVMContext &Context);
+  ~BitcodeReader() override {
+    if (PrefetchThread)
+      PrefetchThread->join();
+  }
 
   Error materializeForwardReferencedFunctions();
 
   Error materialize(GlobalValue *GV) override;
+  void prefetch(ArrayRef<Function *> Fns) override;
   Error materializeModule() override;
   std::vector<StructType *> getIdentifiedStructTypes() const override;
 
@@ -5284,6 +5296,54 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
   return materializeForwardReferencedFunctions();
 }
 
+void BitcodeReader::prefetch(ArrayRef<Function *> Fns) {
+  // Decoding bodies off-thread is not an option: parsing mutates the module
+  // and uniques constants and metadata through context-owned tables. What we
+  // can do safely is warm the pages holding the predicted bodies, which is
+  // where the first-call latency of a lazily loaded module on a memory-mapped
+  // file comes from. The buffer is only read, so this needs no locking.
+  //
+  // A body's end is not recorded anywhere, so approximate it with the start
+  // of the next function block in the stream (function blocks dominate the
+  // tail of the file). Functions whose deferred offset is still zero have not
+  // been discovered in the stream yet and are skipped.
+  SmallVector<uint64_t, 16> BodyStarts;
+  for (const auto &Entry : DeferredFunctionInfo)
+    if (Entry.second)
+      BodyStarts.push_back(Entry.second);
+  llvm::sort(BodyStarts);
+
+  ArrayRef<uint8_t> Bytes = Stream.getBitcodeBytes();
+  SmallVector<std::pair<const uint8_t *, const uint8_t *>, 16> Ranges;
+  for (Function *F : Fns) {
+    if (!F->isMaterializable())
+      continue;
+    uint64_t BitPos = DeferredFunctionInfo.lookup(F);
+    if (!BitPos)
+      continue;
+    auto Next = std::upper_bound(BodyStarts.begin(), BodyStarts.end(), BitPos);
+    uint64_t End = Next != BodyStarts.end() ? *Next / 8 + 1 : Bytes.size();
+    Ranges.push_back({Bytes.data() + BitPos / 8,
+                      Bytes.data() + std::min<uint64_t>(End, Bytes.size())});
+  }
+  if (Ranges.empty())
+    return;
+
+  // One request in flight at a time; a new prediction supersedes the old one.
+  if (PrefetchThread)
+    PrefetchThread->join();
+  PrefetchThread.emplace([Ranges = std::move(Ranges)] {
+    // Touching one byte per page is enough to fault it in; the volatile sink
+    // keeps the loads from being optimized away.
+    const size_t PageSize = sys::Process::getPageSizeEstimate();
+    volatile unsigned Sink = 0;
+    for (const auto &R : Ranges)
+      for (const uint8_t *P = R.first; P < R.second; P += PageSize)
+        Sink = Sink + *P;
+    (void)Sink;
+  });
+}
+
 Error BitcodeReader::materializeModule() {
   if (Error Err = materializeMetadata())
     return Err;
@@ -5291,10 +5351,27 @@ Error BitcodeReader::materializeModule() {
   // Promise to materialize all forward references.
   WillMaterializeAllForwardRefs = true;
 
-  // Iterate over the module, deserializing any functions that are still on
-  // disk.
-  for (Function &F : *TheModule) {
-    if (Error Err = materialize(&F))
+  // Deserialize any functions that are still on disk, in ascending bit
+  // stream offset order rather than module order. On huge modules the bodies
+  // dominate I/O, and module order does not always match stream order (lazily
+  // discovered bodies are recorded at offset zero until found), so jumping
+  // around the stream defeats OS readahead.
+  SmallVector<Function *, 64> Deferred;
+  for (Function &F : *TheModule)
+    if (F.isMaterializable())
+      Deferred.push_back(&F);
+  llvm::stable_sort(Deferred, [this](Function *L, Function *R) {
+    uint64_t LBit = DeferredFunctionInfo.lookup(L);
+    uint64_t RBit = DeferredFunctionInfo.lookup(R);
+    // Bodies still at offset zero have not been discovered in the stream yet
+    // and therefore lie beyond every known body; keep them last, in module
+    // order, so findFunctionInStream walks the stream forward.
+    if (!LBit || !RBit)
+      return LBit && !RBit;
+    return LBit < RBit;
+  });
+  for (Function *F : Deferred) {
+    if (Error Err = materialize(F))
       return Err;
   }
   // At this point, if there are any function bodies, parse the rest of
@@ -6398,6 +6475,9 @@ llvm::getBitcodeFileContents(MemoryBufferRef Buffer) {
         // by binary concatenation.
         if (!F.Symtab.empty() && F.StrtabForSymtab.empty())
           F.StrtabForSymtab = *Strtab;
+        // Also surface the table itself, so string-table-only files holding a
+        // table shared by several module files can be read back.
+        F.Strtab = *Strtab;
         continue;
       }
 
@@ -27,6 +27,7 @@
 #include "llvm/Bitstream/BitCodes.h"
 #include "llvm/Bitstream/BitstreamWriter.h"
 #include "llvm/Bitcode/LLVMBitCodes.h"
+#include "llvm/Bitcode/SummaryGUIDTable.h"
 #include "llvm/Config/llvm-config.h"
 #include "llvm/IR/Attributes.h"
 #include "llvm/IR/BasicBlock.h"
@@ -62,6 +63,7 @@
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Endian.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MathExtras.h"
@@ -90,6 +92,11 @@ static cl::opt<bool> WriteRelBFToSummary(
     "write-relbf-to-summary", cl::Hidden, cl::init(false),
     cl::desc("Write relative block frequency to function summary "));
 
+static cl::opt<bool> TuneAbbrevWidths(
+    "bitcode-tune-abbrevs", cl::Hidden, cl::init(false),
+    cl::desc("Take a measurement pass over the module and size the blockinfo "
+             "abbreviation operand widths from its operand histograms"));
+
 extern FunctionSummary::ForceSummaryHotnessType ForceSummaryEdgesCold;
 
 namespace {
@@ -257,6 +264,12 @@ class ModuleBitcodeWriter : public ModuleBitcodeWriterBase {
   /// The start bit of the identification block.
   uint64_t BitcodeStartBit;
 
+  /// VBR chunk widths for the relative-value-id and integer-constant operand
+  /// fields of the blockinfo abbreviations. The defaults match the historical
+  /// hard-coded widths; tuneAbbrevWidths() may retune them for this module.
+  unsigned ValueVBRWidth = 6;
+  unsigned ConstIntVBRWidth = 8;
+
 public:
   /// Constructs a ModuleBitcodeWriter object for the given Module,
   /// writing to the provided \p Buffer.
@@ -388,6 +401,7 @@ private:
   void
   writeFunction(const Function &F,
                 DenseMap<const Function *, uint64_t> &FunctionToBitcodeIndex);
+  void tuneAbbrevWidths();
   void writeBlockInfo();
   void writeModuleHash(size_t BlockStartPos);
 
@@ -3242,10 +3256,95 @@ void ModuleBitcodeWriter::writeFunction(
 }
 
 // Emit blockinfo, which defines the standard abbreviations etc.
+/// Number of bits a VBR with \p W-bit chunks (W-1 payload bits per chunk)
+/// spends on a value whose magnitude needs \p Bits bits.
+static uint64_t vbrCost(unsigned Bits, unsigned W) {
+  return uint64_t((std::max(Bits, 1u) + W - 2) / (W - 1)) * W;
+}
+
+/// Pick the VBR chunk width in [4,8] minimizing the total encoded size of the
+/// histogrammed magnitudes, keeping \p Default on a tie.
+static unsigned chooseVBRWidth(ArrayRef<uint64_t> Hist, unsigned Default) {
+  auto Cost = [&](unsigned W) {
+    uint64_t C = 0;
+    for (unsigned Bits = 0, E = Hist.size(); Bits != E; ++Bits)
+      if (Hist[Bits])
+        C += Hist[Bits] * vbrCost(Bits, W);
+    return C;
+  };
+  unsigned Best = Default;
+  uint64_t BestCost = Cost(Default);
+  for (unsigned W = 4; W <= 8; ++W) {
+    if (W == Default)
+      continue;
+    uint64_t C = Cost(W);
+    if (C < BestCost) {
+      BestCost = C;
+      Best = W;
+    }
+  }
+  return Best;
+}
+
+void ModuleBitcodeWriter::tuneAbbrevWidths() {
+  // Histograms indexed by the number of significant bits in the encoded
+  // magnitude: instruction operands as their distance from the instruction
+  // (most operands are encoded relative to the instruction id), and integer
+  // constants as their sign-rotated value.
+  uint64_t RelOpHist[65] = {};
+  uint64_t IntHist[65] = {};
+
+  auto CountInt = [&IntHist](const Value *V) {
+    const auto *CI = dyn_cast<ConstantInt>(V);
+    if (!CI || CI->getBitWidth() > 64)
+      return;
+    int64_t SV = CI->getSExtValue();
+    uint64_t Enc = SV >= 0 ? uint64_t(SV) << 1 : (uint64_t(-SV) << 1) | 1;
+    ++IntHist[Enc ? 64 - countLeadingZeros(Enc) : 0];
+  };
+
+  for (const auto &P : VE.getValues())
+    CountInt(P.first);
+
+  // Replay the id assignment writeFunction() will perform so operand
+  // distances match what pushValue() is going to emit.
+  for (const Function &F : M) {
+    if (F.isDeclaration())
+      continue;
+    VE.incorporateFunction(F);
+    unsigned CstStart, CstEnd;
+    VE.getFunctionConstantRange(CstStart, CstEnd);
+    for (unsigned I = CstStart; I != CstEnd; ++I)
+      CountInt(VE.getValues()[I].first);
+    unsigned InstID = CstEnd;
+    for (const BasicBlock &BB : F) {
+      for (const Instruction &I : BB) {
+        for (const Value *Op : I.operands()) {
+          // Forward references and blocks are not encoded as plain relative
+          // ids; leave them out of the histogram.
+          if (isa<MetadataAsValue>(Op) || isa<BasicBlock>(Op))
+            continue;
+          unsigned ValID = VE.getValueID(Op);
+          if (ValID < InstID)
+            ++RelOpHist[64 - countLeadingZeros(uint64_t(InstID - ValID))];
+        }
+        if (!I.getType()->isVoidTy())
+          ++InstID;
+      }
+    }
+    VE.purgeFunction();
+  }
+
+  ValueVBRWidth = chooseVBRWidth(RelOpHist, ValueVBRWidth);
+  ConstIntVBRWidth = chooseVBRWidth(IntHist, ConstIntVBRWidth);
+}
+
 void ModuleBitcodeWriter::writeBlockInfo() {
   // We only want to emit block info records for blocks that have multiple
   // instances: CONSTANTS_BLOCK, FUNCTION_BLOCK and VALUE_SYMTAB_BLOCK.
   // Other blocks can define their abbrevs inline.
+  if (TuneAbbrevWidths)
+    tuneAbbrevWidths();
   Stream.EnterBlockInfoBlock();
 
   { // 8-bit fixed-width VST_CODE_ENTRY/VST_CODE_BBENTRY strings.
@@ -3303,7 +3402,7 @@ void ModuleBitcodeWriter::writeBlockInfo() {
   { // INTEGER abbrev for CONSTANTS_BLOCK.
     auto Abbv = std::make_shared<BitCodeAbbrev>();
     Abbv->Add(BitCodeAbbrevOp(bitc::CST_CODE_INTEGER));
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 8));
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ConstIntVBRWidth));
     if (Stream.EmitBlockInfoAbbrev(bitc::CONSTANTS_BLOCK_ID, Abbv) !=
         CONSTANTS_INTEGER_ABBREV)
       llvm_unreachable("Unexpected abbrev ordering!");
@@ -3334,7 +3433,7 @@ void ModuleBitcodeWriter::writeBlockInfo() {
   { // INST_LOAD abbrev for FUNCTION_BLOCK.
     auto Abbv = std::make_shared<BitCodeAbbrev>();
     Abbv->Add(BitCodeAbbrevOp(bitc::FUNC_CODE_INST_LOAD));
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6)); // Ptr
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth)); // Ptr
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed,    // dest ty
                               VE.computeBitsRequiredForTypeIndicies()));
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 4)); // Align
@@ -3346,7 +3445,7 @@ void ModuleBitcodeWriter::writeBlockInfo() {
   { // INST_UNOP abbrev for FUNCTION_BLOCK.
     auto Abbv = std::make_shared<BitCodeAbbrev>();
     Abbv->Add(BitCodeAbbrevOp(bitc::FUNC_CODE_INST_UNOP));
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6)); // LHS
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth)); // LHS
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed, 4)); // opc
     if (Stream.EmitBlockInfoAbbrev(bitc::FUNCTION_BLOCK_ID, Abbv) !=
         FUNCTION_INST_UNOP_ABBREV)
@@ -3355,7 +3454,7 @@ void ModuleBitcodeWriter::writeBlockInfo() {
   { // INST_UNOP_FLAGS abbrev for FUNCTION_BLOCK.
     auto Abbv = std::make_shared<BitCodeAbbrev>();
     Abbv->Add(BitCodeAbbrevOp(bitc::FUNC_CODE_INST_UNOP));
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6)); // LHS
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth)); // LHS
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed, 4)); // opc
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed, 8)); // flags
     if (Stream.EmitBlockInfoAbbrev(bitc::FUNCTION_BLOCK_ID, Abbv) !=
@@ -3365,8 +3464,8 @@ void ModuleBitcodeWriter::writeBlockInfo() {
   { // INST_BINOP abbrev for FUNCTION_BLOCK.
     auto Abbv = std::make_shared<BitCodeAbbrev>();
     Abbv->Add(BitCodeAbbrevOp(bitc::FUNC_CODE_INST_BINOP));
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6)); // LHS
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6)); // RHS
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth)); // LHS
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth)); // RHS
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed, 4)); // opc
     if (Stream.EmitBlockInfoAbbrev(bitc::FUNCTION_BLOCK_ID, Abbv) !=
         FUNCTION_INST_BINOP_ABBREV)
@@ -3375,8 +3474,8 @@ void ModuleBitcodeWriter::writeBlockInfo() {
   { // INST_BINOP_FLAGS abbrev for FUNCTION_BLOCK.
     auto Abbv = std::make_shared<BitCodeAbbrev>();
     Abbv->Add(BitCodeAbbrevOp(bitc::FUNC_CODE_INST_BINOP));
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6)); // LHS
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6)); // RHS
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth)); // LHS
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth)); // RHS
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed, 4)); // opc
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed, 8)); // flags
     if (Stream.EmitBlockInfoAbbrev(bitc::FUNCTION_BLOCK_ID, Abbv) !=
@@ -3386,7 +3485,7 @@ void ModuleBitcodeWriter::writeBlockInfo() {
   { // INST_CAST abbrev for FUNCTION_BLOCK.
     auto Abbv = std::make_shared<BitCodeAbbrev>();
     Abbv->Add(BitCodeAbbrevOp(bitc::FUNC_CODE_INST_CAST));
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6));    // OpVal
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth)); // OpVal
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed,       // dest ty
                               VE.computeBitsRequiredForTypeIndicies()));
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed, 4));  // opc
@@ -3405,7 +3504,7 @@ void ModuleBitcodeWriter::writeBlockInfo() {
   { // INST_RET abbrev for FUNCTION_BLOCK.
     auto Abbv = std::make_shared<BitCodeAbbrev>();
     Abbv->Add(BitCodeAbbrevOp(bitc::FUNC_CODE_INST_RET));
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6)); // ValID
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth)); // ValID
     if (Stream.EmitBlockInfoAbbrev(bitc::FUNCTION_BLOCK_ID, Abbv) !=
         FUNCTION_INST_RET_VAL_ABBREV)
       llvm_unreachable("Unexpected abbrev ordering!");
@@ -3424,7 +3523,7 @@ void ModuleBitcodeWriter::writeBlockInfo() {
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Fixed, // dest ty
                               Log2_32_Ceil(VE.getTypes().size() + 1)));
     Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::Array));
-    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, 6));
+    Abbv->Add(BitCodeAbbrevOp(BitCodeAbbrevOp::VBR, ValueVBRWidth));
     if (Stream.EmitBlockInfoAbbrev(bitc::FUNCTION_BLOCK_ID, Abbv) !=
         FUNCTION_INST_GEP_ABBREV)
       llvm_unreachable("Unexpected abbrev ordering!");
@@ -4356,11 +4455,22 @@ static void writeBitcodeHeader(BitstreamWriter &Stream) {
 }
 
 BitcodeWriter::BitcodeWriter(SmallVectorImpl<char> &Buffer)
-    : Buffer(Buffer), Stream(new BitstreamWriter(Buffer)) {
+    : Buffer(Buffer), Stream(new BitstreamWriter(Buffer)),
+      StrtabBuilder(OwnedStrtabBuilder), UsesSharedStrtab(false) {
   writeBitcodeHeader(*Stream);
 }
 
-BitcodeWriter::~BitcodeWriter() { assert(WroteStrtab); }
+BitcodeWriter::BitcodeWriter(SmallVectorImpl<char> &Buffer,
+                             StringTableBuilder &SharedStrtab)
+    : Buffer(Buffer), Stream(new BitstreamWriter(Buffer)),
+      StrtabBuilder(SharedStrtab), UsesSharedStrtab(true) {
+  writeBitcodeHeader(*Stream);
+}
+
+BitcodeWriter::~BitcodeWriter() {
+  assert((WroteStrtab || UsesSharedStrtab) &&
+         "Forgot to write the string table");
+}
 
 void BitcodeWriter::writeBlob(unsigned Block, unsigned Record, StringRef Blob) {
   Stream->EnterSubblock(Block, 3);
@@ -4511,6 +4621,18 @@ void llvm::WriteIndexToFile(
   Out.write((char *)&Buffer.front(), Buffer.size());
 }
 
+void llvm::writeSummaryGUIDTable(const ModuleSummaryIndex &Index,
+                                 raw_ostream &Out) {
+  support::endian::Writer W(Out, support::little);
+  W.write<uint32_t>(SummaryGUIDTableRef::Magic);
+  W.write<uint32_t>(SummaryGUIDTableRef::Version);
+  W.write<uint64_t>(Index.size());
+  // The index's global value map is an ordered map keyed by GUID, so
+  // iteration already yields the sorted order the reader binary-searches.
+  for (const auto &GlobalList : Index)
+    W.write<uint64_t>(GlobalList.first);
+}
+
 namespace {
 
 /// Class to manage the bitcode writing for a thin link bitcode file.
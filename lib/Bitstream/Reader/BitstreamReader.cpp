@@ -8,6 +8,7 @@
 
 #include "llvm/Bitstream/BitstreamReader.h"
 #include "llvm/ADT/StringRef.h"
+#include <algorithm>
 #include <cassert>
 #include <string>
 
@@ -306,14 +307,28 @@ Expected<unsigned> BitstreamCursor::readRecord(unsigned AbbrevID,
       switch (EltEnc.getEncoding()) {
       default:
         report_fatal_error("Array element type can't be an Array or a Blob");
-      case BitCodeAbbrevOp::Fixed:
-        for (; NumElts; --NumElts)
-          if (Expected<SimpleBitstreamCursor::word_t> MaybeVal =
-                  Read((unsigned)EltEnc.getEncodingData()))
+      case BitCodeAbbrevOp::Fixed: {
+        const unsigned Width = (unsigned)EltEnc.getEncodingData();
+        while (NumElts) {
+          // Pull as many elements as fit out of the buffered word at once;
+          // Read() is only needed when an element straddles a word boundary.
+          if (unsigned Bulk =
+                  Width ? std::min<uint32_t>(NumElts,
+                                             bitsInCurrentWord() / Width)
+                        : 0) {
+            NumElts -= Bulk;
+            for (; Bulk; --Bulk)
+              Vals.push_back(readBitsFromCurrentWord(Width));
+            continue;
+          }
+          if (Expected<SimpleBitstreamCursor::word_t> MaybeVal = Read(Width))
             Vals.push_back(MaybeVal.get());
           else
             return MaybeVal.takeError();
+          --NumElts;
+        }
         break;
+      }
       case BitCodeAbbrevOp::VBR:
         for (; NumElts; --NumElts)
           if (Expected<uint64_t> MaybeVal =
@@ -323,11 +338,23 @@ Expected<unsigned> BitstreamCursor::readRecord(unsigned AbbrevID,
             return MaybeVal.takeError();
         break;
       case BitCodeAbbrevOp::Char6:
-        for (; NumElts; --NumElts)
+        // A 64-bit buffered word holds up to ten 6-bit chars; decode them in
+        // bulk, falling back to Read() only at word boundaries.
+        while (NumElts) {
+          if (unsigned Bulk =
+                  std::min<uint32_t>(NumElts, bitsInCurrentWord() / 6)) {
+            NumElts -= Bulk;
+            for (; Bulk; --Bulk)
+              Vals.push_back(
+                  BitCodeAbbrevOp::DecodeChar6(readBitsFromCurrentWord(6)));
+            continue;
+          }
           if (Expected<SimpleBitstreamCursor::word_t> MaybeVal = Read(6))
             Vals.push_back(BitCodeAbbrevOp::DecodeChar6(MaybeVal.get()));
           else
             return MaybeVal.takeError();
+          --NumElts;
+        }
       }
       continue;
     }
@@ -151,6 +151,12 @@ static cl::opt<bool> EnableRemarksSection(
     cl::desc("Emit a section containing remark diagnostics metadata"),
     cl::init(false));
 
+static cl::opt<bool> MergeConstantPoolEntries(
+    "merge-constant-pool-entries",
+    cl::desc("Emit identical constant pool entries from different functions "
+             "only once, aliasing the remaining symbols to the first copy"),
+    cl::init(true), cl::Hidden);
+
 char AsmPrinter::ID = 0;
 
 using gcp_map_type = DenseMap<GCStrategy *, std::unique_ptr<GCMetadataPrinter>>;
@@ -1654,6 +1660,7 @@ bool AsmPrinter::doFinalization(Module &M) {
   OutStreamer->reset();
   OwnedMLI.reset();
   OwnedMDT.reset();
+  EmittedConstantPoolEntries.clear();
 
   return false;
 }
@@ -1769,6 +1776,24 @@ void AsmPrinter::EmitConstantPool() {
       if (!Sym->isUndefined())
         continue;
 
+      MachineConstantPoolEntry CPE = CP[CPI];
+
+      // MachineConstantPool uniques identical constants within a function,
+      // but a constant spilled by many functions is still materialized once
+      // per function. If an equal entry has already been emitted into this
+      // section, define this function's label as an alias of the first copy
+      // instead of duplicating the data.
+      std::pair<MCSymbol *, unsigned> *Emitted = nullptr;
+      if (MergeConstantPoolEntries && !CPE.isMachineConstantPoolEntry()) {
+        Emitted =
+            &EmittedConstantPoolEntries[{CPSections[i].S, CPE.Val.ConstVal}];
+        if (Emitted->first && Emitted->second >= CPE.getAlignment()) {
+          OutStreamer->EmitAssignment(
+              Sym, MCSymbolRefExpr::create(Emitted->first, OutContext));
+          continue;
+        }
+      }
+
       if (CurSection != CPSections[i].S) {
         OutStreamer->SwitchSection(CPSections[i].S);
         EmitAlignment(Align(CPSections[i].Alignment));
@@ -1776,8 +1801,6 @@ void AsmPrinter::EmitConstantPool() {
         Offset = 0;
       }
 
-      MachineConstantPoolEntry CPE = CP[CPI];
-
       // Emit inter-object padding for alignment.
       unsigned AlignMask = CPE.getAlignment() - 1;
       unsigned NewOffset = (Offset + AlignMask) & ~AlignMask;
@@ -1791,6 +1814,11 @@ void AsmPrinter::EmitConstantPool() {
         EmitMachineConstantPoolValue(CPE.Val.MachineCPVal);
       else
         EmitGlobalConstant(getDataLayout(), CPE.Val.ConstVal);
+
+      // Remember this copy so later functions can alias it. Keep the copy
+      // with the largest alignment, which can satisfy all later uses.
+      if (Emitted)
+        *Emitted = std::make_pair(Sym, CPE.getAlignment());
     }
   }
 }
@@ -310,6 +310,35 @@ unsigned DIE::computeOffsetsAndAbbrevs(const AsmPrinter *AP,
   return CUOffset;
 }
 
+void DIE::assignAbbrevs(DIEAbbrevSet &AbbrevSet) {
+  AbbrevSet.uniqueAbbreviation(*this);
+  for (auto &Child : children())
+    Child.assignAbbrevs(AbbrevSet);
+}
+
+unsigned DIE::computeOffsets(const AsmPrinter *AP, unsigned CUOffset) {
+  assert(getAbbrevNumber() && "Abbreviation not assigned yet");
+  setOffset(CUOffset);
+
+  // Add the byte size of the abbreviation code.
+  CUOffset += getULEB128Size(getAbbrevNumber());
+
+  // Add the byte size of all the DIE attribute values.
+  for (const auto &V : values())
+    CUOffset += V.SizeOf(AP);
+
+  if (hasChildren()) {
+    for (auto &Child : children())
+      CUOffset = Child.computeOffsets(AP, CUOffset);
+
+    // Each child chain is terminated with a zero byte, adjust the offset.
+    CUOffset += sizeof(int8_t);
+  }
+
+  setSize(CUOffset - getOffset());
+  return CUOffset;
+}
+
 //===----------------------------------------------------------------------===//
 // DIEUnit Implementation
 //===----------------------------------------------------------------------===//
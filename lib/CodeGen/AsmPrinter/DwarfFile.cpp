@@ -15,11 +15,22 @@
 #include "llvm/CodeGen/DIE.h"
 #include "llvm/IR/DebugInfoMetadata.h"
 #include "llvm/MC/MCStreamer.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Parallel.h"
 #include <algorithm>
 #include <cstdint>
 
 using namespace llvm;
 
+// Sizing a unit is a full traversal of its DIE tree and units are independent
+// once abbreviations are assigned, so debug-heavy multi-CU compiles (LTO in
+// particular) can size units concurrently. Off by default: it only pays off
+// with several large units and it spawns threads inside codegen.
+static cl::opt<bool> ParallelCUSizing(
+    "dwarf-parallel-cu-sizing", cl::Hidden, cl::init(false),
+    cl::desc("Assign DIE abbreviations serially, then compute per-CU sizes "
+             "and offsets in parallel"));
+
 DwarfFile::DwarfFile(AsmPrinter *AP, StringRef Pref, BumpPtrAllocator &DA)
     : Asm(AP), Abbrevs(AbbrevAllocator), StrPool(DA, *Asm, Pref) {}
 
@@ -61,8 +72,8 @@ void DwarfFile::computeSizeAndOffsets() {
   // Offset from the first CU in the debug info section is 0 initially.
   unsigned SecOffset = 0;
 
-  // Iterate over each compile unit and set the size and offsets for each
-  // DIE within each compile unit. All offsets are CU relative.
+  // Gather the units that actually get emitted.
+  SmallVector<DwarfUnit *, 4> Units;
   for (const auto &TheU : CUs) {
     if (TheU->getCUNode()->isDebugDirectivesOnly())
       continue;
@@ -72,8 +83,37 @@ void DwarfFile::computeSizeAndOffsets() {
     if (llvm::empty(TheU->getUnitDie().values()))
       return;
 
+    Units.push_back(TheU.get());
+  }
+
+  if (ParallelCUSizing && Units.size() > 1) {
+    // Abbreviation assignment is the only part of unit sizing that touches
+    // shared state, so run it serially up front (it also keeps abbreviation
+    // numbering identical to the single-threaded order) and size the unit
+    // trees concurrently afterwards. Emission remains a later serial phase.
+    for (DwarfUnit *TheU : Units)
+      TheU->getUnitDie().assignAbbrevs(Abbrevs);
+
+    SmallVector<unsigned, 4> UnitSizes(Units.size());
+    parallel::for_each_n(parallel::par, size_t(0), Units.size(), [&](size_t I) {
+      DwarfUnit *TheU = Units[I];
+      unsigned Offset = sizeof(int32_t) +      // Length of Unit Info
+                        TheU->getHeaderSize(); // Unit-specific headers
+      UnitSizes[I] = TheU->getUnitDie().computeOffsets(Asm, Offset);
+    });
+
+    for (size_t I = 0, E = Units.size(); I != E; ++I) {
+      Units[I]->setDebugSectionOffset(SecOffset);
+      SecOffset += UnitSizes[I];
+    }
+    return;
+  }
+
+  // Iterate over each compile unit and set the size and offsets for each
+  // DIE within each compile unit. All offsets are CU relative.
+  for (DwarfUnit *TheU : Units) {
     TheU->setDebugSectionOffset(SecOffset);
-    SecOffset += computeSizeAndOffsetsForUnit(TheU.get());
+    SecOffset += computeSizeAndOffsetsForUnit(TheU);
   }
 }
 
@@ -145,6 +145,7 @@ class TargetRegisterInfo;
                                   const BlockFrequency Freq) const;
       void view(const Twine &Name, bool isSimple = true);
       uint64_t getEntryFreq() const;
+      const MachineBlockFrequencyInfo &getMBFI() const { return MBFI; }
 
     private:
       const MachineBlockFrequencyInfo &MBFI;
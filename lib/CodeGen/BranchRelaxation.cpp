@@ -160,8 +160,15 @@ void BranchRelaxation::scanFunction() {
   for (MachineBasicBlock &MBB : *MF)
     BlockInfo[MBB.getNumber()].Size = computeBlockSize(MBB);
 
-  // Compute block offsets and known bits.
-  adjustBlockOffsets(*MF->begin());
+  // Compute block offsets and known bits. Every offset starts out stale, so
+  // walk the whole function instead of going through adjustBlockOffsets,
+  // whose early exit assumes the tail of the function is still consistent.
+  unsigned PrevNum = MF->begin()->getNumber();
+  for (auto &MBB : make_range(std::next(MF->begin()), MF->end())) {
+    unsigned Num = MBB.getNumber();
+    BlockInfo[Num].Offset = BlockInfo[PrevNum].postOffset(MBB);
+    PrevNum = Num;
+  }
 }
 
 /// computeBlockSize - Compute the size for MBB.
@@ -181,26 +188,43 @@ unsigned BranchRelaxation::getInstrOffset(const MachineInstr &MI) const {
   // The offset is composed of two things: the sum of the sizes of all MBB's
   // before this instruction's block, and the offset from the start of the block
   // it is in.
-  unsigned Offset = BlockInfo[MBB->getNumber()].Offset;
-
-  // Sum instructions before MI in MBB.
-  for (MachineBasicBlock::const_iterator I = MBB->begin(); &*I != &MI; ++I) {
-    assert(I != MBB->end() && "Didn't find MI in its own basic block?");
-    Offset += TII->getInstSizeInBytes(*I);
+  const BasicBlockInfo &BBI = BlockInfo[MBB->getNumber()];
+
+  // The branches we measure live in the terminator sequence at the end of the
+  // block, so summing the instructions behind MI from the block end is far
+  // cheaper than walking a large block from the front.
+  unsigned Offset = BBI.Offset + BBI.Size;
+  for (MachineBasicBlock::const_iterator I = std::prev(MBB->end());; --I) {
+    Offset -= TII->getInstSizeInBytes(*I);
+    if (&*I == &MI)
+      break;
+    assert(I != MBB->begin() && "Didn't find MI in its own basic block?");
   }
 
   return Offset;
 }
 
 void BranchRelaxation::adjustBlockOffsets(MachineBasicBlock &Start) {
+  // Start's own offset is unaffected by changes to its contents; only the
+  // blocks laid out after it need updating.
   unsigned PrevNum = Start.getNumber();
-  for (auto &MBB : make_range(MachineFunction::iterator(Start), MF->end())) {
+  for (auto &MBB :
+       make_range(std::next(MachineFunction::iterator(Start)), MF->end())) {
     unsigned Num = MBB.getNumber();
     if (!Num) // block zero is never changed from offset zero.
       continue;
     // Get the offset and known bits at the end of the layout predecessor.
     // Include the alignment of the current block.
-    BlockInfo[Num].Offset = BlockInfo[PrevNum].postOffset(MBB);
+    unsigned Offset = BlockInfo[PrevNum].postOffset(MBB);
+
+    // Once a block's offset is unchanged, every later offset is unchanged
+    // too: it only depends on earlier offsets and the (unmodified) sizes.
+    // This commonly happens when an aligned block absorbs a small size
+    // change into its padding, and saves walking the rest of the function
+    // for every relaxed branch.
+    if (BlockInfo[Num].Offset == Offset)
+      return;
+    BlockInfo[Num].Offset = Offset;
 
     PrevNum = Num;
   }
@@ -115,6 +115,10 @@ STATISTIC(NumMemoryInsts, "Number of memory instructions whose address "
 STATISTIC(NumMemoryInstsPhiCreated,
           "Number of phis created when address "
           "computations were sunk to memory instructions");
+STATISTIC(NumAddrModeCacheHits,
+          "Number of addressing-mode matches served from the cache");
+STATISTIC(NumAddrModeCacheMisses,
+          "Number of addressing-mode matches computed from scratch");
 STATISTIC(NumMemoryInstsSelectCreated,
           "Number of select created when address "
           "computations were sunk to memory instructions");
@@ -263,6 +267,13 @@ class TypePromotionTransaction;
     /// invalidated if a sunken address computation has been erased.
     ValueMap<Value*, WeakTrackingVH> SunkAddrs;
 
+    /// Memoized AddressingModeMatcher results, keyed on the queried address
+    /// value together with the access type and address space. Defined out of
+    /// line because ExtAddrMode is declared later in this file; see
+    /// optimizeMemoryInst for the validity rules.
+    struct AddrModeCacheTy;
+    std::unique_ptr<AddrModeCacheTy> AddrModeCache;
+
     /// Keeps track of all instructions inserted for the current function.
     SetOfInstrs InsertedInsts;
 
@@ -310,6 +321,10 @@ class TypePromotionTransaction;
       initializeCodeGenPreparePass(*PassRegistry::getPassRegistry());
     }
 
+    // Out of line so AddrModeCacheTy is complete where the unique_ptr is
+    // destroyed.
+    ~CodeGenPrepare() override;
+
     bool runOnFunction(Function &F) override;
 
     StringRef getPassName() const override { return "CodeGen Prepare"; }
@@ -359,6 +374,7 @@ class TypePromotionTransaction;
     bool optimizeInst(Instruction *I, bool &ModifiedDT);
     bool optimizeMemoryInst(Instruction *MemoryInst, Value *Addr,
                             Type *AccessTy, unsigned AddrSpace);
+    void clearAddrModeCache();
     bool optimizeInlineAsmInst(CallInst *CS);
     bool optimizeCallInst(CallInst *CI, bool &ModifiedDT);
     bool optimizeExt(Instruction *&I);
@@ -417,6 +433,8 @@ bool CodeGenPrepare::runOnFunction(Function &F) {
   // Clear per function information.
   InsertedInsts.clear();
   PromotedInsts.clear();
+  if (AddrModeCache)
+    clearAddrModeCache();
 
   if (auto *TPC = getAnalysisIfAvailable<TargetPassConfig>()) {
     TM = &TPC->getTM<TargetMachine>();
@@ -2197,8 +2215,28 @@ struct ExtAddrMode : public TargetLowering::AddrMode {
   }
 };
 
+/// Memoized AddressingModeMatcher results. A hit is only trusted when every
+/// value the cached mode refers to is still alive: the weak handles go null
+/// (or start tracking a replacement) when an instruction is erased or RAUW'd,
+/// and a failed check simply falls back to re-matching.
+struct CodeGenPrepare::AddrModeCacheTy {
+  struct Entry {
+    WeakTrackingVH Key;
+    WeakTrackingVH BaseReg;
+    WeakTrackingVH ScaledReg;
+    ExtAddrMode AM;
+    SmallVector<WeakTrackingVH, 4> AddrModeInsts;
+  };
+  using KeyTy = std::pair<Value *, std::pair<Type *, unsigned>>;
+  DenseMap<KeyTy, Entry> Map;
+};
+
 } // end anonymous namespace
 
+CodeGenPrepare::~CodeGenPrepare() = default;
+
+void CodeGenPrepare::clearAddrModeCache() { AddrModeCache->Map.clear(); }
+
 #ifndef NDEBUG
 static inline raw_ostream &operator<<(raw_ostream &OS, const ExtAddrMode &AM) {
   AM.print(OS);
@@ -4710,20 +4748,61 @@ bool CodeGenPrepare::optimizeMemoryInst(Instruction *MemoryInst, Value *Addr,
     // the result may differ depending on what other uses our candidate
     // addressing instructions might have.
     AddrModeInsts.clear();
-    std::pair<AssertingVH<GetElementPtrInst>, int64_t> LargeOffsetGEP(nullptr,
-                                                                      0);
-    ExtAddrMode NewAddrMode = AddressingModeMatcher::Match(
-        V, AccessTy, AddrSpace, MemoryInst, AddrModeInsts, *TLI, *TRI,
-        InsertedInsts, PromotedInsts, TPT, LargeOffsetGEP);
+    if (!AddrModeCache)
+      AddrModeCache.reset(new AddrModeCacheTy());
+    AddrModeCacheTy::KeyTy CacheKey(V, std::make_pair(AccessTy, AddrSpace));
+    ExtAddrMode NewAddrMode;
+    bool CacheHit = false;
+    auto CacheIt = AddrModeCache->Map.find(CacheKey);
+    if (CacheIt != AddrModeCache->Map.end()) {
+      AddrModeCacheTy::Entry &E = CacheIt->second;
+      bool Alive = E.Key == V && E.BaseReg == E.AM.BaseReg &&
+                   E.ScaledReg == E.AM.ScaledReg &&
+                   llvm::all_of(E.AddrModeInsts, [](const WeakTrackingVH &VH) {
+                     return VH.pointsToAliveValue();
+                   });
+      if (Alive) {
+        NewAddrMode = E.AM;
+        for (const WeakTrackingVH &VH : E.AddrModeInsts)
+          AddrModeInsts.push_back(cast<Instruction>((Value *)VH));
+        ++NumAddrModeCacheHits;
+        CacheHit = true;
+      } else {
+        AddrModeCache->Map.erase(CacheIt);
+      }
+    }
+    if (!CacheHit) {
+      ++NumAddrModeCacheMisses;
+      std::pair<AssertingVH<GetElementPtrInst>, int64_t> LargeOffsetGEP(
+          nullptr, 0);
+      TypePromotionTransaction::ConstRestorationPt PtBeforeMatch =
+          TPT.getRestorationPoint();
+      NewAddrMode = AddressingModeMatcher::Match(
+          V, AccessTy, AddrSpace, MemoryInst, AddrModeInsts, *TLI, *TRI,
+          InsertedInsts, PromotedInsts, TPT, LargeOffsetGEP);
+
+      GetElementPtrInst *GEP = LargeOffsetGEP.first;
+      if (GEP && !NewGEPBases.count(GEP)) {
+        // If splitting the underlying data structure can reduce the offset of
+        // a GEP, collect the GEP.  Skip the GEPs that are the new bases of
+        // previously split data structures.
+        LargeOffsetGEPMap[GEP->getPointerOperand()].push_back(LargeOffsetGEP);
+        if (LargeOffsetGEPID.find(GEP) == LargeOffsetGEPID.end())
+          LargeOffsetGEPID[GEP] = LargeOffsetGEPID.size();
+      }
 
-    GetElementPtrInst *GEP = LargeOffsetGEP.first;
-    if (GEP && !NewGEPBases.count(GEP)) {
-      // If splitting the underlying data structure can reduce the offset of a
-      // GEP, collect the GEP.  Skip the GEPs that are the new bases of
-      // previously split data structures.
-      LargeOffsetGEPMap[GEP->getPointerOperand()].push_back(LargeOffsetGEP);
-      if (LargeOffsetGEPID.find(GEP) == LargeOffsetGEPID.end())
-        LargeOffsetGEPID[GEP] = LargeOffsetGEPID.size();
+      // Only memoize side-effect-free matches: replaying a match that
+      // recorded type-promotion actions or collected a large-offset GEP would
+      // skip those effects. The payload is revalidated on every hit, so going
+      // stale only costs a re-match.
+      if (TPT.getRestorationPoint() == PtBeforeMatch && !GEP) {
+        AddrModeCacheTy::Entry &E = AddrModeCache->Map[CacheKey];
+        E.Key = V;
+        E.BaseReg = NewAddrMode.BaseReg;
+        E.ScaledReg = NewAddrMode.ScaledReg;
+        E.AM = NewAddrMode;
+        E.AddrModeInsts.assign(AddrModeInsts.begin(), AddrModeInsts.end());
+      }
     }
 
     NewAddrMode.OriginalValue = V;
@@ -115,45 +115,44 @@ bool Combiner::combineMachineInstrs(MachineFunction &MF,
   MachineOptimizationRemarkEmitter MORE(MF, /*MBFI=*/nullptr);
 
   bool MFChanged = false;
-  bool Changed;
   MachineIRBuilder &B = *Builder.get();
 
-  do {
-    // Collect all instructions. Do a post order traversal for basic blocks and
-    // insert with list bottom up, so while we pop_back_val, we'll traverse top
-    // down RPOT.
-    Changed = false;
-    GISelWorkList<512> WorkList;
-    WorkListMaintainer Observer(WorkList);
-    GISelObserverWrapper WrapperObserver(&Observer);
-    if (CSEInfo)
-      WrapperObserver.addObserver(CSEInfo);
-    RAIIDelegateInstaller DelInstall(MF, &WrapperObserver);
-    for (MachineBasicBlock *MBB : post_order(&MF)) {
-      if (MBB->empty())
+  // Collect all instructions once. Do a post order traversal for basic blocks
+  // and insert with list bottom up, so while we pop_back_val, we'll traverse
+  // top down RPOT. The WorkListMaintainer mirrors the InstCombine worklist
+  // discipline: created and changed instructions are re-inserted (the worklist
+  // deduplicates them) and erased ones are removed, so draining the worklist
+  // to a fixpoint visits everything a whole-function rescan would without
+  // repopulating per iteration.
+  GISelWorkList<512> WorkList;
+  WorkListMaintainer Observer(WorkList);
+  GISelObserverWrapper WrapperObserver(&Observer);
+  if (CSEInfo)
+    WrapperObserver.addObserver(CSEInfo);
+  RAIIDelegateInstaller DelInstall(MF, &WrapperObserver);
+  for (MachineBasicBlock *MBB : post_order(&MF)) {
+    if (MBB->empty())
+      continue;
+    for (auto MII = MBB->rbegin(), MIE = MBB->rend(); MII != MIE;) {
+      MachineInstr *CurMI = &*MII;
+      ++MII;
+      // Erase dead insts before even adding to the list.
+      if (isTriviallyDead(*CurMI, *MRI)) {
+        LLVM_DEBUG(dbgs() << *CurMI << "Is dead; erasing.\n");
+        CurMI->eraseFromParentAndMarkDBGValuesForRemoval();
         continue;
-      for (auto MII = MBB->rbegin(), MIE = MBB->rend(); MII != MIE;) {
-        MachineInstr *CurMI = &*MII;
-        ++MII;
-        // Erase dead insts before even adding to the list.
-        if (isTriviallyDead(*CurMI, *MRI)) {
-          LLVM_DEBUG(dbgs() << *CurMI << "Is dead; erasing.\n");
-          CurMI->eraseFromParentAndMarkDBGValuesForRemoval();
-          continue;
-        }
-        WorkList.deferred_insert(CurMI);
       }
+      WorkList.deferred_insert(CurMI);
     }
-    WorkList.finalize();
-    // Main Loop. Process the instructions here.
-    while (!WorkList.empty()) {
-      MachineInstr *CurrInst = WorkList.pop_back_val();
-      LLVM_DEBUG(dbgs() << "\nTry combining " << *CurrInst;);
-      Changed |= CInfo.combine(WrapperObserver, *CurrInst, B);
-      Observer.reportFullyCreatedInstrs();
-    }
-    MFChanged |= Changed;
-  } while (Changed);
+  }
+  WorkList.finalize();
+  // Main Loop. Process the instructions here.
+  while (!WorkList.empty()) {
+    MachineInstr *CurrInst = WorkList.pop_back_val();
+    LLVM_DEBUG(dbgs() << "\nTry combining " << *CurrInst;);
+    MFChanged |= CInfo.combine(WrapperObserver, *CurrInst, B);
+    Observer.reportFullyCreatedInstrs();
+  }
 
   return MFChanged;
 }
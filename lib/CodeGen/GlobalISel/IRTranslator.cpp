@@ -2266,6 +2266,15 @@ bool IRTranslator::runOnMachineFunction(MachineFunction &CurMF) {
   bool IsVarArg = F.isVarArg();
   bool HasMustTailInVarArgFn = false;
 
+  // Pre-size the per-function maps. On huge machine-generated functions,
+  // growing them incrementally rehashes hundreds of thousands of entries;
+  // one entry per instruction is a good upper bound for the value map.
+  BBToMBB.reserve(F.size());
+  size_t NumValues = F.arg_size();
+  for (const BasicBlock &BB : F)
+    NumValues += BB.size();
+  VMap.reserve(NumValues);
+
   // Create all blocks, in IR order, to preserve the layout.
   for (const BasicBlock &BB: F) {
     auto *&MBB = BBToMBB[&BB];
@@ -15,6 +15,7 @@
 #include "llvm/CodeGen/GlobalISel/Legalizer.h"
 #include "llvm/ADT/PostOrderIterator.h"
 #include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/CodeGen/GlobalISel/CSEInfo.h"
 #include "llvm/CodeGen/GlobalISel/CSEMIRBuilder.h"
 #include "llvm/CodeGen/GlobalISel/GISelChangeObserver.h"
@@ -86,6 +87,13 @@ namespace {
 class LegalizerWorkListManager : public GISelChangeObserver {
   InstListTy &InstList;
   ArtifactListTy &ArtifactList;
+  /// Running count of artifacts ever inserted. Unlike ArtifactList.size(),
+  /// this is monotonic, so it can tell "new artifacts appeared" apart from
+  /// "as many artifacts were erased as created".
+  unsigned NumArtifactsCreated = 0;
+  /// Artifacts that most recently failed legalizeInstrStep and have not been
+  /// touched since. For those, re-running the legality query is pointless.
+  SmallPtrSet<const MachineInstr *, 8> FailedArtifacts;
 #ifndef NDEBUG
   SmallVector<MachineInstr *, 4> NewMIs;
 #endif
@@ -94,16 +102,28 @@ public:
   LegalizerWorkListManager(InstListTy &Insts, ArtifactListTy &Arts)
       : InstList(Insts), ArtifactList(Arts) {}
 
+  unsigned getNumArtifactsCreated() const { return NumArtifactsCreated; }
+
+  void markArtifactFailedToLegalize(const MachineInstr &MI) {
+    FailedArtifacts.insert(&MI);
+  }
+
+  bool isUnchangedSinceFailedLegalize(const MachineInstr &MI) const {
+    return FailedArtifacts.count(&MI);
+  }
+
   void createdOrChangedInstr(MachineInstr &MI) {
     // Only legalize pre-isel generic instructions.
     // Legalization process could generate Target specific pseudo
     // instructions with generic types. Don't record them
     if (isPreISelGenericOpcode(MI.getOpcode())) {
-      if (isArtifact(MI))
+      if (isArtifact(MI)) {
         ArtifactList.insert(&MI);
-      else
+        ++NumArtifactsCreated;
+      } else
         InstList.insert(&MI);
     }
+    FailedArtifacts.erase(&MI);
   }
 
   void createdInstr(MachineInstr &MI) override {
@@ -124,6 +144,7 @@ public:
     LLVM_DEBUG(dbgs() << ".. .. Erasing: " << MI);
     InstList.remove(&MI);
     ArtifactList.remove(&MI);
+    FailedArtifacts.erase(&MI);
   }
 
   void changingInstr(MachineInstr &MI) override {
@@ -215,7 +236,7 @@ bool Legalizer::runOnMachineFunction(MachineFunction &MF) {
   SmallVector<MachineInstr *, 128> RetryList;
   do {
     assert(RetryList.empty() && "Expected no instructions in RetryList");
-    unsigned NumArtifacts = ArtifactList.size();
+    unsigned NumArtifactsCreated = WorkListObserver.getNumArtifactsCreated();
     while (!InstList.empty()) {
       MachineInstr &MI = *InstList.pop_back_val();
       assert(isPreISelGenericOpcode(MI.getOpcode()) && "Expecting generic opcode");
@@ -225,6 +246,14 @@ bool Legalizer::runOnMachineFunction(MachineFunction &MF) {
         continue;
       }
 
+      // An artifact that already failed to legalize and has not been touched
+      // since will fail again; route it straight to the retry list rather
+      // than recomputing the legality query every round.
+      if (WorkListObserver.isUnchangedSinceFailedLegalize(MI)) {
+        RetryList.push_back(&MI);
+        continue;
+      }
+
       // Do the legalization for this instruction.
       auto Res = Helper.legalizeInstrStep(MI);
       // Error out if we couldn't legalize this instruction. We may want to
@@ -234,6 +263,7 @@ bool Legalizer::runOnMachineFunction(MachineFunction &MF) {
         // legalizing InstList may generate artifacts that allow
         // ArtifactCombiner to combine away them.
         if (isArtifact(MI)) {
+          WorkListObserver.markArtifactFailedToLegalize(MI);
           RetryList.push_back(&MI);
           continue;
         }
@@ -244,9 +274,12 @@ bool Legalizer::runOnMachineFunction(MachineFunction &MF) {
       Changed |= Res == LegalizerHelper::Legalized;
     }
     // Try to combine the instructions in RetryList again if there
-    // are new artifacts. If not, stop legalizing.
+    // are new artifacts. If not, stop legalizing. Compare against the
+    // monotonic creation count rather than the live list size: combines and
+    // DCE can shrink the artifact list in the same round that produced the
+    // new artifacts a retry needs.
     if (!RetryList.empty()) {
-      if (ArtifactList.size() > NumArtifacts) {
+      if (WorkListObserver.getNumArtifactsCreated() > NumArtifactsCreated) {
         while (!RetryList.empty())
           ArtifactList.insert(RetryList.pop_back_val());
       } else {
@@ -636,7 +636,24 @@ bool RegBankSelect::assignInstr(MachineInstr &MI) {
         RBI->getInstrPossibleMappings(MI);
     if (PossibleMappings.empty())
       return false;
-    BestMapping = &findBestMapping(MI, PossibleMappings, RepairPts);
+    if (PossibleMappings.size() == 1) {
+      // Unambiguous mapping: there is nothing to compare it against, so skip
+      // the cost evaluation. This avoids the repair-cost model (and its block
+      // frequency queries) for the common case where the target offers no
+      // alternative mappings.
+      BestMapping = *PossibleMappings.begin();
+      MappingCost Cost = computeMapping(MI, *BestMapping, RepairPts);
+      if (Cost == MappingCost::ImpossibleCost()) {
+        assert(!TPC->isGlobalISelAbortEnabled() &&
+               "No suitable mapping for instruction");
+        // Set an impossible repairing point to trigger the failed isel mode,
+        // as findBestMapping does when all the mappings are impossible.
+        RepairPts.clear();
+        RepairPts.emplace_back(RepairingPlacement(
+            MI, 0, *TRI, *this, RepairingPlacement::Impossible));
+      }
+    } else
+      BestMapping = &findBestMapping(MI, PossibleMappings, RepairPts);
   }
   // Make sure the mapping is valid for MI.
   assert(BestMapping->verify(MI) && "Invalid instruction mapping");
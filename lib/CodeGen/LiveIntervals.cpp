@@ -1469,6 +1469,36 @@ void LiveIntervals::handleMove(MachineInstr &MI, bool UpdateFlags) {
   HME.updateAllRanges(&MI);
 }
 
+void LiveIntervals::handleMoveAcrossBlocks(MachineInstr &MI) {
+  assert(!MI.isBundled() && "Cannot handle bundled instructions");
+  Indexes->removeMachineInstrFromMaps(MI);
+  Indexes->insertMachineInstrInMaps(MI);
+
+  // Recompute each affected virtual register from scratch and drop cached
+  // register unit ranges for physical register operands. This is heavier than
+  // handleMove's in-place repair, but an in-place repair cannot grow a range
+  // into blocks it did not previously reach.
+  SmallVector<Register, 8> VRegs;
+  for (const MachineOperand &MO : MI.operands()) {
+    if (!MO.isReg() || MO.getReg() == 0)
+      continue;
+    Register Reg = MO.getReg();
+    if (Register::isVirtualRegister(Reg)) {
+      if (!llvm::is_contained(VRegs, Reg))
+        VRegs.push_back(Reg);
+    } else {
+      for (MCRegUnitIterator Units(Reg, TRI); Units.isValid(); ++Units)
+        removeRegUnit(*Units);
+    }
+  }
+  for (Register Reg : VRegs) {
+    if (hasInterval(Reg))
+      removeInterval(Reg);
+    if (!MRI->reg_empty(Reg))
+      createAndComputeVirtRegInterval(Reg);
+  }
+}
+
 void LiveIntervals::handleMoveIntoBundle(MachineInstr &MI,
                                          MachineInstr &BundleStart,
                                          bool UpdateFlags) {
@@ -0,0 +1,645 @@
+//===- MIRSnapshot.cpp - Binary MachineFunction snapshots -----------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Implementation of the binary MachineFunction snapshot format. See
+// MIRSnapshot.h for the contract and the fidelity limitations.
+//
+// File layout (all integers little-endian):
+//   magic "MIRB", u32 version
+//   string table:  u32 count, then per entry u32 length + bytes
+//   regmask table: u32 words-per-mask, u32 count, then count * words u32s
+//   body:          function header, frame info, jump tables, blocks
+//
+// Operands use a fixed 17-byte encoding (kind, flags, subreg/target-flags,
+// 32-bit payload, 64-bit payload) so the reader can walk a mapped buffer
+// without any per-operand branching on size.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/CodeGen/MIRSnapshot.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/CodeGen/MachineBasicBlock.h"
+#include "llvm/CodeGen/MachineBranchProbabilityInfo.h"
+#include "llvm/CodeGen/MachineConstantPool.h"
+#include "llvm/CodeGen/MachineFrameInfo.h"
+#include "llvm/CodeGen/MachineFunction.h"
+#include "llvm/CodeGen/MachineInstr.h"
+#include "llvm/CodeGen/MachineJumpTableInfo.h"
+#include "llvm/CodeGen/MachineRegisterInfo.h"
+#include "llvm/CodeGen/TargetInstrInfo.h"
+#include "llvm/CodeGen/TargetRegisterInfo.h"
+#include "llvm/CodeGen/TargetSubtargetInfo.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/EndianStream.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+
+static const char SnapshotMagic[4] = {'M', 'I', 'R', 'B'};
+static const uint32_t SnapshotVersion = 1;
+
+// Operand kind bytes. These deliberately do not reuse
+// MachineOperand::MachineOperandType so that unsupported kinds cannot slip
+// through a cast.
+enum SnapshotOperandKind : uint8_t {
+  SOK_Register = 0,
+  SOK_Immediate,
+  SOK_MachineBasicBlock,
+  SOK_FrameIndex,
+  SOK_JumpTableIndex,
+  SOK_GlobalAddress,
+  SOK_ExternalSymbol,
+  SOK_RegisterMask,
+};
+
+// Register operand flag bits.
+enum : uint16_t {
+  SRF_Def = 1 << 0,
+  SRF_Implicit = 1 << 1,
+  SRF_Kill = 1 << 2,
+  SRF_Dead = 1 << 3,
+  SRF_Undef = 1 << 4,
+  SRF_EarlyClobber = 1 << 5,
+  SRF_Debug = 1 << 6,
+  SRF_InternalRead = 1 << 7,
+  SRF_Renamable = 1 << 8,
+};
+
+// Frame object flag bits.
+enum : uint8_t {
+  SFF_Fixed = 1 << 0,
+  SFF_Immutable = 1 << 1,
+  SFF_Aliased = 1 << 2,
+  SFF_SpillSlot = 1 << 3,
+  SFF_Dead = 1 << 4,
+};
+
+static Error makeSnapshotError(const Twine &Msg) {
+  return createStringError(inconvertibleErrorCode(), "MIR snapshot: %s",
+                           Msg.str().c_str());
+}
+
+namespace {
+
+/// Accumulates the deduplicated string and register-mask tables while the
+/// body is serialized into a scratch buffer, then emits everything in file
+/// order.
+class SnapshotWriter {
+public:
+  SmallString<4096> Body;
+  raw_svector_ostream BodyOS;
+  support::endian::Writer W;
+
+  std::vector<StringRef> Strings;
+  DenseMap<StringRef, uint32_t> StringIdx;
+  std::vector<const uint32_t *> RegMasks;
+  DenseMap<const uint32_t *, uint32_t> RegMaskIdx;
+
+  SnapshotWriter() : BodyOS(Body), W(BodyOS, support::little) {}
+
+  uint32_t getStringIdx(StringRef S) {
+    auto Ins = StringIdx.try_emplace(S, Strings.size());
+    if (Ins.second)
+      Strings.push_back(S);
+    return Ins.first->second;
+  }
+
+  uint32_t getRegMaskIdx(const uint32_t *Mask) {
+    auto Ins = RegMaskIdx.try_emplace(Mask, RegMasks.size());
+    if (Ins.second)
+      RegMasks.push_back(Mask);
+    return Ins.first->second;
+  }
+};
+
+} // end anonymous namespace
+
+/// Serialize one operand into the fixed-width encoding, or explain why it
+/// cannot be represented.
+static Error writeOperand(SnapshotWriter &SW, const MachineOperand &MO) {
+  uint8_t Kind;
+  uint16_t Flags = 0, SubOrTF = 0;
+  uint32_t A = 0;
+  int64_t C = 0;
+
+  switch (MO.getType()) {
+  case MachineOperand::MO_Register:
+    Kind = SOK_Register;
+    A = MO.getReg();
+    SubOrTF = MO.getSubReg();
+    Flags = (MO.isDef() ? SRF_Def : 0) | (MO.isImplicit() ? SRF_Implicit : 0) |
+            (MO.isKill() ? SRF_Kill : 0) | (MO.isDead() ? SRF_Dead : 0) |
+            (MO.isUndef() ? SRF_Undef : 0) |
+            (MO.isEarlyClobber() ? SRF_EarlyClobber : 0) |
+            (MO.isDebug() ? SRF_Debug : 0) |
+            (MO.isInternalRead() ? SRF_InternalRead : 0) |
+            (MO.isRenamable() ? SRF_Renamable : 0);
+    break;
+  case MachineOperand::MO_Immediate:
+    Kind = SOK_Immediate;
+    C = MO.getImm();
+    break;
+  case MachineOperand::MO_MachineBasicBlock:
+    Kind = SOK_MachineBasicBlock;
+    A = MO.getMBB()->getNumber();
+    SubOrTF = MO.getTargetFlags();
+    break;
+  case MachineOperand::MO_FrameIndex:
+    Kind = SOK_FrameIndex;
+    C = MO.getIndex();
+    break;
+  case MachineOperand::MO_JumpTableIndex:
+    Kind = SOK_JumpTableIndex;
+    A = MO.getIndex();
+    SubOrTF = MO.getTargetFlags();
+    break;
+  case MachineOperand::MO_GlobalAddress: {
+    const GlobalValue *GV = MO.getGlobal();
+    if (!GV->hasName())
+      return makeSnapshotError("unnamed global cannot be encoded");
+    Kind = SOK_GlobalAddress;
+    A = SW.getStringIdx(GV->getName());
+    C = MO.getOffset();
+    SubOrTF = MO.getTargetFlags();
+    break;
+  }
+  case MachineOperand::MO_ExternalSymbol:
+    Kind = SOK_ExternalSymbol;
+    A = SW.getStringIdx(MO.getSymbolName());
+    C = MO.getOffset();
+    SubOrTF = MO.getTargetFlags();
+    break;
+  case MachineOperand::MO_RegisterMask:
+    Kind = SOK_RegisterMask;
+    A = SW.getRegMaskIdx(MO.getRegMask());
+    break;
+  default:
+    return makeSnapshotError("unsupported operand kind " +
+                             Twine(unsigned(MO.getType())));
+  }
+
+  SW.W.write<uint8_t>(Kind);
+  SW.W.write<uint16_t>(Flags);
+  SW.W.write<uint16_t>(SubOrTF);
+  SW.W.write<uint32_t>(A);
+  SW.W.write<int64_t>(C);
+  return Error::success();
+}
+
+Error llvm::writeMIRSnapshot(raw_ostream &OS, const MachineFunction &MF) {
+  const MachineRegisterInfo &MRI = MF.getRegInfo();
+  const MachineFrameInfo &MFI = MF.getFrameInfo();
+  const TargetRegisterInfo *TRI = MF.getSubtarget().getRegisterInfo();
+
+  if (MFI.hasVarSizedObjects())
+    return makeSnapshotError("variable-sized stack objects are not encoded");
+  if (MF.getConstantPool() && !MF.getConstantPool()->getConstants().empty())
+    return makeSnapshotError("constant pool entries are not encoded");
+
+  SnapshotWriter SW;
+
+  // Function header.
+  SW.W.write<uint32_t>(SW.getStringIdx(MF.getName()));
+  uint32_t Props = 0;
+  for (unsigned P = 0,
+                PE = unsigned(MachineFunctionProperties::Property::LastProperty);
+       P <= PE; ++P)
+    if (MF.getProperties().hasProperty(
+            MachineFunctionProperties::Property(P)))
+      Props |= 1u << P;
+  SW.W.write<uint32_t>(Props);
+
+  // Virtual register classes.
+  unsigned NumVRegs = MRI.getNumVirtRegs();
+  SW.W.write<uint32_t>(NumVRegs);
+  for (unsigned I = 0; I != NumVRegs; ++I) {
+    unsigned Reg = Register::index2VirtReg(I);
+    const TargetRegisterClass *RC = MRI.getRegClassOrNull(Reg);
+    if (!RC)
+      return makeSnapshotError("generic virtual registers are not encoded");
+    SW.W.write<uint16_t>(RC->getID());
+  }
+
+  // Function live-ins.
+  SW.W.write<uint32_t>(std::distance(MRI.livein_begin(), MRI.livein_end()));
+  for (auto LI = MRI.livein_begin(), LE = MRI.livein_end(); LI != LE; ++LI) {
+    SW.W.write<uint32_t>(LI->first);
+    SW.W.write<uint32_t>(LI->second);
+  }
+
+  // Frame objects, in index order.
+  SW.W.write<uint32_t>(MFI.getNumFixedObjects());
+  SW.W.write<uint32_t>(MFI.getNumObjects() - MFI.getNumFixedObjects());
+  for (int FI = MFI.getObjectIndexBegin(), FE = MFI.getObjectIndexEnd();
+       FI != FE; ++FI) {
+    bool Dead = MFI.isDeadObjectIndex(FI);
+    SW.W.write<uint64_t>(Dead ? 0 : MFI.getObjectSize(FI));
+    SW.W.write<uint32_t>(Dead ? 1 : MFI.getObjectAlignment(FI));
+    SW.W.write<int64_t>(FI < 0 ? MFI.getObjectOffset(FI) : 0);
+    uint8_t Flags = (FI < 0 ? SFF_Fixed : 0) | (Dead ? SFF_Dead : 0);
+    if (!Dead) {
+      Flags |= (MFI.isImmutableObjectIndex(FI) ? SFF_Immutable : 0) |
+               (MFI.isAliasedObjectIndex(FI) ? SFF_Aliased : 0) |
+               (MFI.isSpillSlotObjectIndex(FI) ? SFF_SpillSlot : 0);
+    }
+    SW.W.write<uint8_t>(Flags);
+  }
+  SW.W.write<uint8_t>((MFI.hasCalls() ? 1 : 0) |
+                      (MFI.adjustsStack() ? 2 : 0) |
+                      (MFI.isFrameAddressTaken() ? 4 : 0) |
+                      (MFI.isReturnAddressTaken() ? 8 : 0));
+  SW.W.write<uint32_t>(MFI.isMaxCallFrameSizeComputed()
+                           ? MFI.getMaxCallFrameSize()
+                           : ~0u);
+
+  // Number the blocks densely in layout order.
+  DenseMap<const MachineBasicBlock *, uint32_t> BlockIdx;
+  for (const MachineBasicBlock &MBB : MF) {
+    if (MBB.hasAddressTaken())
+      return makeSnapshotError("address-taken blocks are not encoded");
+    BlockIdx[&MBB] = BlockIdx.size();
+  }
+
+  // Jump tables.
+  const MachineJumpTableInfo *JTI = MF.getJumpTableInfo();
+  SW.W.write<uint8_t>(JTI ? 1 : 0);
+  if (JTI) {
+    SW.W.write<uint32_t>(unsigned(JTI->getEntryKind()));
+    SW.W.write<uint32_t>(JTI->getJumpTables().size());
+    for (const MachineJumpTableEntry &JT : JTI->getJumpTables()) {
+      SW.W.write<uint32_t>(JT.MBBs.size());
+      for (const MachineBasicBlock *MBB : JT.MBBs)
+        SW.W.write<uint32_t>(BlockIdx.lookup(MBB));
+    }
+  }
+
+  // Blocks and instructions. Successor probabilities are private to
+  // MachineBasicBlock; MachineBranchProbabilityInfo is the sanctioned
+  // accessor and carries no state of its own.
+  MachineBranchProbabilityInfo MBPI;
+  SW.W.write<uint32_t>(MF.size());
+  for (const MachineBasicBlock &MBB : MF) {
+    SW.W.write<uint8_t>(MBB.isEHPad() ? 1 : 0);
+    SW.W.write<uint8_t>(Log2(MBB.getAlignment()));
+
+    SW.W.write<uint32_t>(std::distance(MBB.livein_begin(), MBB.livein_end()));
+    for (const auto &LI : MBB.liveins()) {
+      SW.W.write<uint32_t>(LI.PhysReg);
+      SW.W.write<uint32_t>(LI.LaneMask.getAsInteger());
+    }
+
+    SW.W.write<uint32_t>(MBB.succ_size());
+    for (auto SI = MBB.succ_begin(), SE = MBB.succ_end(); SI != SE; ++SI) {
+      SW.W.write<uint32_t>(BlockIdx.lookup(*SI));
+      SW.W.write<uint32_t>(MBPI.getEdgeProbability(&MBB, SI).getNumerator());
+    }
+
+    uint32_t NumInstrs = 0;
+    for (const MachineInstr &MI : MBB)
+      if (!MI.isDebugInstr())
+        ++NumInstrs;
+    SW.W.write<uint32_t>(NumInstrs);
+
+    for (const MachineInstr &MI : MBB) {
+      // Debug values reference metadata; they are dropped along with debug
+      // locations.
+      if (MI.isDebugInstr())
+        continue;
+
+      SmallVector<std::pair<uint16_t, uint16_t>, 2> TiedPairs;
+      for (unsigned I = 0, E = MI.getNumOperands(); I != E; ++I) {
+        const MachineOperand &MO = MI.getOperand(I);
+        if (MO.isReg() && MO.isUse() && MO.isTied())
+          TiedPairs.push_back({uint16_t(MI.findTiedOperandIdx(I)), uint16_t(I)});
+      }
+
+      SW.W.write<uint16_t>(MI.getOpcode());
+      SW.W.write<uint16_t>(MI.getFlags());
+      SW.W.write<uint16_t>(MI.getNumOperands());
+      SW.W.write<uint16_t>(TiedPairs.size());
+      for (const MachineOperand &MO : MI.operands())
+        if (Error E = writeOperand(SW, MO))
+          return E;
+      for (const auto &TP : TiedPairs) {
+        SW.W.write<uint16_t>(TP.first);
+        SW.W.write<uint16_t>(TP.second);
+      }
+    }
+  }
+
+  // Emit the file: header, tables, body.
+  support::endian::Writer HW(OS, support::little);
+  OS.write(SnapshotMagic, sizeof(SnapshotMagic));
+  HW.write<uint32_t>(SnapshotVersion);
+
+  HW.write<uint32_t>(SW.Strings.size());
+  for (StringRef S : SW.Strings) {
+    HW.write<uint32_t>(S.size());
+    OS << S;
+  }
+
+  unsigned MaskWords = (TRI->getNumRegs() + 31) / 32;
+  HW.write<uint32_t>(MaskWords);
+  HW.write<uint32_t>(SW.RegMasks.size());
+  for (const uint32_t *Mask : SW.RegMasks)
+    for (unsigned I = 0; I != MaskWords; ++I)
+      HW.write<uint32_t>(Mask[I]);
+
+  OS << SW.Body;
+  return Error::success();
+}
+
+Error llvm::readMIRSnapshot(StringRef Buffer, MachineFunction &MF) {
+  MachineRegisterInfo &MRI = MF.getRegInfo();
+  MachineFrameInfo &MFI = MF.getFrameInfo();
+  const TargetSubtargetInfo &ST = MF.getSubtarget();
+  const TargetInstrInfo *TII = ST.getInstrInfo();
+  const TargetRegisterInfo *TRI = ST.getRegisterInfo();
+
+  DataExtractor DE(Buffer, /*IsLittleEndian=*/true, /*AddressSize=*/8);
+  DataExtractor::Cursor C(0);
+
+  // This DataExtractor has no getBytes; slice the buffer directly and let
+  // the extractor record the overrun if the slice is short.
+  auto GetBytes = [&](uint32_t Len) -> StringRef {
+    uint64_t Off = C.tell();
+    StringRef Result;
+    if (DE.isValidOffsetForDataOfSize(Off, Len))
+      Result = Buffer.substr(Off, Len);
+    for (uint32_t I = 0; C && I != Len; ++I)
+      DE.getU8(C);
+    return Result;
+  };
+
+  StringRef Magic = GetBytes(sizeof(SnapshotMagic));
+  uint32_t Version = DE.getU32(C);
+  if (!C)
+    return C.takeError();
+  if (Magic != StringRef(SnapshotMagic, sizeof(SnapshotMagic)))
+    return makeSnapshotError("bad magic");
+  if (Version != SnapshotVersion)
+    return makeSnapshotError("version mismatch");
+
+  // String table. The entries alias the input buffer; everything read out of
+  // them below is copied into function-owned storage.
+  std::vector<StringRef> Strings(DE.getU32(C));
+  for (StringRef &S : Strings)
+    S = GetBytes(DE.getU32(C));
+
+  // Register mask table.
+  uint32_t MaskWords = DE.getU32(C);
+  if (C && MaskWords != (TRI->getNumRegs() + 31) / 32)
+    return makeSnapshotError("register mask width mismatch");
+  std::vector<uint32_t *> Masks(DE.getU32(C));
+  for (uint32_t *&Mask : Masks) {
+    Mask = MF.allocateRegMask();
+    for (unsigned I = 0; I != MaskWords; ++I)
+      Mask[I] = DE.getU32(C);
+  }
+
+  uint32_t NameIdx = DE.getU32(C);
+  if (!C)
+    return C.takeError();
+  if (NameIdx >= Strings.size() || Strings[NameIdx] != MF.getName())
+    return makeSnapshotError("snapshot is for a different function");
+
+  // Discard the current body.
+  while (!MF.empty())
+    MF.erase(&MF.front());
+
+  uint32_t Props = DE.getU32(C);
+  for (unsigned P = 0,
+                PE = unsigned(MachineFunctionProperties::Property::LastProperty);
+       P <= PE; ++P) {
+    auto Prop = MachineFunctionProperties::Property(P);
+    if (Props & (1u << P))
+      MF.getProperties().set(Prop);
+    else
+      MF.getProperties().reset(Prop);
+  }
+
+  // Virtual registers. The function is expected to have none yet, so created
+  // registers get the same dense numbering the writer saw.
+  if (MRI.getNumVirtRegs() != 0)
+    return makeSnapshotError("cannot restore into a function with virtual "
+                             "registers");
+  uint32_t NumVRegs = DE.getU32(C);
+  for (uint32_t I = 0; C && I != NumVRegs; ++I) {
+    const TargetRegisterClass *RC = TRI->getRegClass(DE.getU16(C));
+    MRI.createVirtualRegister(RC);
+  }
+
+  uint32_t NumLiveIns = DE.getU32(C);
+  for (uint32_t I = 0; C && I != NumLiveIns; ++I) {
+    uint32_t PhysReg = DE.getU32(C);
+    uint32_t VReg = DE.getU32(C);
+    MRI.addLiveIn(PhysReg, VReg);
+  }
+
+  // Frame objects. Fixed objects are serialized in index order
+  // (-NumFixed .. -1) but must be created innermost-first to reproduce the
+  // same indices.
+  uint32_t NumFixed = DE.getU32(C);
+  uint32_t NumOrdinary = DE.getU32(C);
+  struct ObjectInfo {
+    uint64_t Size;
+    uint32_t Align;
+    int64_t Offset;
+    uint8_t Flags;
+  };
+  std::vector<ObjectInfo> FixedObjects(NumFixed);
+  for (ObjectInfo &O : FixedObjects) {
+    O.Size = DE.getU64(C);
+    O.Align = DE.getU32(C);
+    O.Offset = int64_t(DE.getU64(C));
+    O.Flags = DE.getU8(C);
+  }
+  if (!C)
+    return C.takeError();
+  for (uint32_t I = 0; I != NumFixed; ++I) {
+    const ObjectInfo &O = FixedObjects[NumFixed - 1 - I];
+    int FI = MFI.CreateFixedObject(O.Size ? O.Size : 1, O.Offset,
+                                   O.Flags & SFF_Immutable,
+                                   O.Flags & SFF_Aliased);
+    if (O.Flags & SFF_Dead)
+      MFI.RemoveStackObject(FI);
+  }
+  for (uint32_t I = 0; C && I != NumOrdinary; ++I) {
+    ObjectInfo O;
+    O.Size = DE.getU64(C);
+    O.Align = DE.getU32(C);
+    O.Offset = int64_t(DE.getU64(C));
+    O.Flags = DE.getU8(C);
+    int FI = MFI.CreateStackObject(O.Size ? O.Size : 1, O.Align ? O.Align : 1,
+                                   O.Flags & SFF_SpillSlot);
+    if (O.Flags & SFF_Dead)
+      MFI.RemoveStackObject(FI);
+  }
+  uint8_t FrameFlags = DE.getU8(C);
+  MFI.setHasCalls(FrameFlags & 1);
+  MFI.setAdjustsStack(FrameFlags & 2);
+  MFI.setFrameAddressIsTaken(FrameFlags & 4);
+  MFI.setReturnAddressIsTaken(FrameFlags & 8);
+  uint32_t MaxCallFrameSize = DE.getU32(C);
+  if (C && MaxCallFrameSize != ~0u)
+    MFI.setMaxCallFrameSize(MaxCallFrameSize);
+
+  // Jump table headers are read before the blocks exist; buffer the block
+  // indices and resolve them once the blocks are created.
+  std::vector<std::vector<uint32_t>> JumpTables;
+  uint32_t JTEntryKind = 0;
+  if (DE.getU8(C)) {
+    JTEntryKind = DE.getU32(C);
+    JumpTables.resize(DE.getU32(C));
+    for (auto &JT : JumpTables) {
+      JT.resize(DE.getU32(C));
+      for (uint32_t &Idx : JT)
+        Idx = DE.getU32(C);
+    }
+  }
+
+  uint32_t NumBlocks = DE.getU32(C);
+  if (!C)
+    return C.takeError();
+  std::vector<MachineBasicBlock *> Blocks(NumBlocks);
+  for (MachineBasicBlock *&MBB : Blocks) {
+    MBB = MF.CreateMachineBasicBlock();
+    MF.push_back(MBB);
+  }
+
+  for (uint32_t B = 0; C && B != NumBlocks; ++B) {
+    MachineBasicBlock &MBB = *Blocks[B];
+    if (DE.getU8(C))
+      MBB.setIsEHPad();
+    MBB.setAlignment(Align(1ull << DE.getU8(C)));
+
+    uint32_t NumBlockLiveIns = DE.getU32(C);
+    for (uint32_t I = 0; C && I != NumBlockLiveIns; ++I) {
+      uint32_t Reg = DE.getU32(C);
+      LaneBitmask Mask(DE.getU32(C));
+      MBB.addLiveIn(Reg, Mask);
+    }
+
+    uint32_t NumSuccs = DE.getU32(C);
+    for (uint32_t I = 0; C && I != NumSuccs; ++I) {
+      uint32_t Succ = DE.getU32(C);
+      uint32_t Prob = DE.getU32(C);
+      if (Succ >= NumBlocks)
+        return makeSnapshotError("successor index out of range");
+      MBB.addSuccessor(Blocks[Succ], BranchProbability::getRaw(Prob));
+    }
+
+    uint32_t NumInstrs = DE.getU32(C);
+    for (uint32_t I = 0; C && I != NumInstrs; ++I) {
+      uint16_t Opcode = DE.getU16(C);
+      uint16_t Flags = DE.getU16(C);
+      uint16_t NumOps = DE.getU16(C);
+      uint16_t NumTied = DE.getU16(C);
+      if (!C)
+        return C.takeError();
+
+      MachineInstr *MI =
+          MF.CreateMachineInstr(TII->get(Opcode), DebugLoc(), /*NoImp=*/true);
+      MBB.push_back(MI);
+      MI->setFlags(Flags);
+
+      for (uint16_t Op = 0; C && Op != NumOps; ++Op) {
+        uint8_t Kind = DE.getU8(C);
+        uint16_t OpFlags = DE.getU16(C);
+        uint16_t SubOrTF = DE.getU16(C);
+        uint32_t A = DE.getU32(C);
+        int64_t Payload = int64_t(DE.getU64(C));
+        if (!C)
+          return C.takeError();
+
+        switch (Kind) {
+        case SOK_Register:
+          MI->addOperand(
+              MF, MachineOperand::CreateReg(
+                      A, OpFlags & SRF_Def, OpFlags & SRF_Implicit,
+                      OpFlags & SRF_Kill, OpFlags & SRF_Dead,
+                      OpFlags & SRF_Undef, OpFlags & SRF_EarlyClobber, SubOrTF,
+                      OpFlags & SRF_Debug, OpFlags & SRF_InternalRead,
+                      OpFlags & SRF_Renamable));
+          break;
+        case SOK_Immediate:
+          MI->addOperand(MF, MachineOperand::CreateImm(Payload));
+          break;
+        case SOK_MachineBasicBlock:
+          if (A >= NumBlocks)
+            return makeSnapshotError("block operand index out of range");
+          MI->addOperand(MF, MachineOperand::CreateMBB(Blocks[A], SubOrTF));
+          break;
+        case SOK_FrameIndex:
+          MI->addOperand(MF, MachineOperand::CreateFI(Payload));
+          break;
+        case SOK_JumpTableIndex:
+          MI->addOperand(MF, MachineOperand::CreateJTI(A, SubOrTF));
+          break;
+        case SOK_GlobalAddress: {
+          if (A >= Strings.size())
+            return makeSnapshotError("string index out of range");
+          const GlobalValue *GV =
+              MF.getFunction().getParent()->getNamedValue(Strings[A]);
+          if (!GV)
+            return makeSnapshotError("global '" + Strings[A] +
+                                     "' not found in module");
+          MI->addOperand(MF, MachineOperand::CreateGA(GV, Payload, SubOrTF));
+          break;
+        }
+        case SOK_ExternalSymbol: {
+          if (A >= Strings.size())
+            return makeSnapshotError("string index out of range");
+          MachineOperand MO = MachineOperand::CreateES(
+              MF.createExternalSymbolName(Strings[A]), SubOrTF);
+          MO.setOffset(Payload);
+          MI->addOperand(MF, MO);
+          break;
+        }
+        case SOK_RegisterMask:
+          if (A >= Masks.size())
+            return makeSnapshotError("register mask index out of range");
+          MI->addOperand(MF, MachineOperand::CreateRegMask(Masks[A]));
+          break;
+        default:
+          return makeSnapshotError("unknown operand kind " + Twine(Kind));
+        }
+      }
+
+      for (uint16_t T = 0; C && T != NumTied; ++T) {
+        uint16_t DefIdx = DE.getU16(C);
+        uint16_t UseIdx = DE.getU16(C);
+        if (!C)
+          return C.takeError();
+        if (DefIdx >= MI->getNumOperands() || UseIdx >= MI->getNumOperands())
+          return makeSnapshotError("tied operand index out of range");
+        MI->tieOperands(DefIdx, UseIdx);
+      }
+    }
+  }
+
+  if (!JumpTables.empty()) {
+    MachineJumpTableInfo *JTI = MF.getOrCreateJumpTableInfo(JTEntryKind);
+    for (auto &JT : JumpTables) {
+      std::vector<MachineBasicBlock *> MBBs;
+      MBBs.reserve(JT.size());
+      for (uint32_t Idx : JT) {
+        if (Idx >= NumBlocks)
+          return makeSnapshotError("jump table block index out of range");
+        MBBs.push_back(Blocks[Idx]);
+      }
+      JTI->createJumpTableIndex(MBBs);
+    }
+  }
+
+  if (!C)
+    return C.takeError();
+  return Error::success();
+}
@@ -33,6 +33,7 @@
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/BlockFrequencyInfoImpl.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/CodeGen/MachineBasicBlock.h"
 #include "llvm/CodeGen/MachineBlockFrequencyInfo.h"
 #include "llvm/CodeGen/MachineBranchProbabilityInfo.h"
@@ -40,6 +41,7 @@
 #include "llvm/CodeGen/MachineFunctionPass.h"
 #include "llvm/CodeGen/MachineLoopInfo.h"
 #include "llvm/CodeGen/MachineModuleInfo.h"
+#include "llvm/CodeGen/MachineOptimizationRemarkEmitter.h"
 #include "llvm/CodeGen/MachinePostDominators.h"
 #include "llvm/CodeGen/TailDuplicator.h"
 #include "llvm/CodeGen/TargetInstrInfo.h"
@@ -113,6 +115,12 @@ static cl::opt<bool> ForceLoopColdBlock(
     cl::desc("Force outlining cold blocks from loops."),
     cl::init(false), cl::Hidden);
 
+static cl::opt<bool> SinkColdBlocks(
+    "sink-cold-blocks",
+    cl::desc("When profile data is available, place blocks the profile "
+             "considers cold after all blocks that execute."),
+    cl::init(true), cl::Hidden);
+
 static cl::opt<bool>
     PreciseRotationCost("precise-rotation-cost",
                         cl::desc("Model the cost of loop rotation more "
@@ -174,6 +182,27 @@ static cl::opt<unsigned> TailDupPlacementPenalty(
     cl::init(2),
     cl::Hidden);
 
+// Run the ext-TSP layout algorithm as a post-processing step on top of the
+// chain-based placement. The regular algorithm makes greedy local decisions;
+// ext-TSP scores the whole layout (fallthrough count plus distance-decayed
+// credit for short jumps) and so can recover I-cache locality the greedy
+// pass gives up.
+static cl::opt<bool> EnableExtTspBlockPlacement(
+    "enable-ext-tsp-block-placement",
+    cl::desc("Re-optimize the final block layout with the ext-TSP model"),
+    cl::init(false), cl::Hidden);
+
+static cl::opt<bool> ExtTspWithoutProfile(
+    "ext-tsp-apply-without-profile",
+    cl::desc("Apply ext-TSP placement to functions without profile data"),
+    cl::init(false), cl::Hidden);
+
+static cl::opt<unsigned> ExtTspMaxBlocks(
+    "ext-tsp-max-blocks",
+    cl::desc("Maximum number of basic blocks in a function for which the "
+             "ext-TSP layout is applied"),
+    cl::init(512), cl::Hidden);
+
 // Heuristic for triangle chains.
 static cl::opt<unsigned> TriangleChainCount(
     "triangle-chain-count",
@@ -331,6 +360,7 @@ class MachineBlockPlacement : public MachineFunctionPass {
 
   /// work lists of blocks that are ready to be laid out
   SmallVector<MachineBasicBlock *, 16> BlockWorkList;
+  SmallVector<MachineBasicBlock *, 16> ColdBlockWorkList;
   SmallVector<MachineBasicBlock *, 16> EHPadWorkList;
 
   /// Edges that have already been computed as optimal.
@@ -342,6 +372,9 @@ class MachineBlockPlacement : public MachineFunctionPass {
   /// A handle to the branch probability pass.
   const MachineBranchProbabilityInfo *MBPI;
 
+  /// A handle to the profile summary, for classifying blocks as cold.
+  ProfileSummaryInfo *PSI;
+
   /// A handle to the function-wide block frequency pass.
   std::unique_ptr<BranchFolder::MBFIWrapper> MBFI;
 
@@ -449,6 +482,7 @@ class MachineBlockPlacement : public MachineFunctionPass {
   void fillWorkLists(const MachineBasicBlock *MBB,
                      SmallPtrSetImpl<BlockChain *> &UpdatedPreds,
                      const BlockFilterSet *BlockFilter);
+  bool isBlockCold(const MachineBasicBlock *MBB);
 
   void buildChain(const MachineBasicBlock *BB, BlockChain &Chain,
                   BlockFilterSet *BlockFilter = nullptr);
@@ -478,6 +512,8 @@ class MachineBlockPlacement : public MachineFunctionPass {
       BlockChain &LoopChain, const MachineLoop &L,
       const BlockFilterSet &LoopBlockSet);
   void buildCFGChains();
+  /// Re-optimize the final layout globally using the ext-TSP scoring model.
+  void applyExtTsp();
   void optimizeBranches();
   void alignBlocks();
   /// Returns true if a block should be tail-duplicated to increase fallthrough
@@ -537,6 +573,7 @@ public:
     if (TailDupPlacement)
       AU.addRequired<MachinePostDominatorTree>();
     AU.addRequired<MachineLoopInfo>();
+    AU.addRequired<ProfileSummaryInfoWrapperPass>();
     AU.addRequired<TargetPassConfig>();
     MachineFunctionPass::getAnalysisUsage(AU);
   }
@@ -554,6 +591,7 @@ INITIALIZE_PASS_DEPENDENCY(MachineBranchProbabilityInfo)
 INITIALIZE_PASS_DEPENDENCY(MachineBlockFrequencyInfo)
 INITIALIZE_PASS_DEPENDENCY(MachinePostDominatorTree)
 INITIALIZE_PASS_DEPENDENCY(MachineLoopInfo)
+INITIALIZE_PASS_DEPENDENCY(ProfileSummaryInfoWrapperPass)
 INITIALIZE_PASS_END(MachineBlockPlacement, DEBUG_TYPE,
                     "Branch Probability Basic Block Placement", false, false)
 
@@ -1505,6 +1543,12 @@ MachineBlockPlacement::selectBestSuccessor(
   SmallVector<std::tuple<BranchProbability, MachineBasicBlock *>, 4>
       DupCandidates;
   for (MachineBasicBlock *Succ : Successors) {
+    // Never extend a hot chain with a cold block; leave it on the cold work
+    // list so it sinks behind everything that executes. Cold blocks may still
+    // chain onto other cold blocks to keep the cold tail itself ordered.
+    if (isBlockCold(Succ) && !isBlockCold(BB))
+      continue;
+
     auto RealSuccProb = MBPI->getEdgeProbability(BB, Succ);
     BranchProbability SuccProb =
         getAdjustedProbability(RealSuccProb, AdjustedSumProb);
@@ -1695,10 +1739,22 @@ void MachineBlockPlacement::fillWorkLists(
   MachineBasicBlock *BB = *Chain.begin();
   if (BB->isEHPad())
     EHPadWorkList.push_back(BB);
+  else if (isBlockCold(BB))
+    ColdBlockWorkList.push_back(BB);
   else
     BlockWorkList.push_back(BB);
 }
 
+/// Check whether profile data says \p MBB never executes. Such blocks are kept
+/// out of the main work list so they sink past every block that does execute,
+/// keeping cold code off the hot path in the final layout.
+bool MachineBlockPlacement::isBlockCold(const MachineBasicBlock *MBB) {
+  if (!SinkColdBlocks || !F->getFunction().hasProfileData())
+    return false;
+  Optional<uint64_t> Count = MBFI->getMBFI().getBlockProfileCount(MBB);
+  return Count && PSI->isColdCount(*Count);
+}
+
 void MachineBlockPlacement::buildChain(
     const MachineBasicBlock *HeadBB, BlockChain &Chain,
     BlockFilterSet *BlockFilter) {
@@ -1728,6 +1784,8 @@ void MachineBlockPlacement::buildChain(
     // this point. This won't be a fallthrough, but it will increase locality.
     if (!BestSucc)
       BestSucc = selectBestCandidateBlock(Chain, BlockWorkList);
+    if (!BestSucc)
+      BestSucc = selectBestCandidateBlock(Chain, ColdBlockWorkList);
     if (!BestSucc)
       BestSucc = selectBestCandidateBlock(Chain, EHPadWorkList);
 
@@ -2469,6 +2527,8 @@ void MachineBlockPlacement::buildLoopChains(const MachineLoop &L) {
 
   assert(BlockWorkList.empty() &&
          "BlockWorkList not empty when starting to build loop chains.");
+  assert(ColdBlockWorkList.empty() &&
+         "ColdBlockWorkList not empty when starting to build loop chains.");
   assert(EHPadWorkList.empty() &&
          "EHPadWorkList not empty when starting to build loop chains.");
   BlockFilterSet LoopBlockSet = collectLoopBlockSet(L);
@@ -2551,6 +2611,7 @@ void MachineBlockPlacement::buildLoopChains(const MachineLoop &L) {
   });
 
   BlockWorkList.clear();
+  ColdBlockWorkList.clear();
   EHPadWorkList.clear();
 }
 
@@ -2595,6 +2656,8 @@ void MachineBlockPlacement::buildCFGChains() {
 
   assert(BlockWorkList.empty() &&
          "BlockWorkList should be empty before building final chain.");
+  assert(ColdBlockWorkList.empty() &&
+         "ColdBlockWorkList should be empty before building final chain.");
   assert(EHPadWorkList.empty() &&
          "EHPadWorkList should be empty before building final chain.");
 
@@ -2699,9 +2762,248 @@ void MachineBlockPlacement::buildCFGChains() {
     F->back().updateTerminator();
 
   BlockWorkList.clear();
+  ColdBlockWorkList.clear();
   EHPadWorkList.clear();
 }
 
+// Parameters of the ext-TSP scoring model. A jump is worth its full execution
+// count when the target is the fallthrough successor. Short forward and
+// backward jumps earn a fraction of the count, decaying linearly with the
+// distance to the target; jumps beyond these windows score nothing. The
+// constants follow the published ext-TSP model.
+static constexpr double ExtTspFallthroughWeight = 1.0;
+static constexpr double ExtTspForwardWeight = 0.1;
+static constexpr double ExtTspBackwardWeight = 0.1;
+static constexpr uint64_t ExtTspForwardDistance = 1024;
+static constexpr uint64_t ExtTspBackwardDistance = 640;
+
+/// Score one jump with the ext-TSP model given the code offsets of the end of
+/// the source block and the start of the destination block.
+static double extTspJumpScore(uint64_t SrcEndOffset, uint64_t DstOffset,
+                              uint64_t Count) {
+  if (SrcEndOffset == DstOffset)
+    return ExtTspFallthroughWeight * Count;
+  if (SrcEndOffset < DstOffset) {
+    uint64_t Dist = DstOffset - SrcEndOffset;
+    if (Dist < ExtTspForwardDistance)
+      return ExtTspForwardWeight * Count *
+             (1.0 - double(Dist) / ExtTspForwardDistance);
+    return 0.0;
+  }
+  uint64_t Dist = SrcEndOffset - DstOffset;
+  if (Dist < ExtTspBackwardDistance)
+    return ExtTspBackwardWeight * Count *
+           (1.0 - double(Dist) / ExtTspBackwardDistance);
+  return 0.0;
+}
+
+void MachineBlockPlacement::applyExtTsp() {
+  // Group runs of blocks with unanalyzable fallthrough into single nodes so
+  // they are reordered as a unit, mirroring the pre-merge in buildCFGChains.
+  std::vector<SmallVector<MachineBasicBlock *, 2>> Nodes;
+  DenseMap<const MachineBasicBlock *, unsigned> NodeIndex;
+  SmallVector<MachineOperand, 4> Cond; // For AnalyzeBranch.
+  for (MachineFunction::iterator FI = F->begin(), FE = F->end(); FI != FE;
+       ++FI) {
+    Nodes.emplace_back();
+    while (true) {
+      Nodes.back().push_back(&*FI);
+      NodeIndex[&*FI] = Nodes.size() - 1;
+      Cond.clear();
+      MachineBasicBlock *TBB = nullptr, *FBB = nullptr; // For AnalyzeBranch.
+      if (!TII->analyzeBranch(*FI, TBB, FBB, Cond) || !FI->canFallThrough())
+        break;
+      assert(std::next(FI) != FE && "Can't fallthrough past the last block.");
+      ++FI;
+    }
+  }
+  unsigned NumNodes = Nodes.size();
+  if (NumNodes < 3)
+    return;
+
+  // Estimate code size and execution frequency per node. The size estimate is
+  // deliberately crude (four bytes per real instruction); the model only
+  // needs relative distances, not exact encodings.
+  std::vector<uint64_t> NodeSize(NumNodes, 0);
+  std::vector<uint64_t> NodeFreq(NumNodes, 0);
+  for (unsigned I = 0; I != NumNodes; ++I) {
+    for (MachineBasicBlock *MBB : Nodes[I]) {
+      for (MachineInstr &MI : *MBB)
+        if (!MI.isDebugInstr())
+          NodeSize[I] += 4;
+      NodeFreq[I] += MBFI->getBlockFreq(MBB).getFrequency();
+    }
+    NodeSize[I] = std::max<uint64_t>(NodeSize[I], 1);
+  }
+
+  // Collect the inter-node jumps with their execution counts.
+  struct JumpT {
+    unsigned Src;
+    unsigned Dst;
+    uint64_t Count;
+  };
+  std::vector<JumpT> Jumps;
+  DenseMap<std::pair<unsigned, unsigned>, unsigned> JumpIdx;
+  for (unsigned I = 0; I != NumNodes; ++I) {
+    for (MachineBasicBlock *MBB : Nodes[I]) {
+      for (MachineBasicBlock *Succ : MBB->successors()) {
+        unsigned J = NodeIndex.lookup(Succ);
+        if (J == I)
+          continue;
+        uint64_t Count =
+            (MBFI->getBlockFreq(MBB) * MBPI->getEdgeProbability(MBB, Succ))
+                .getFrequency();
+        auto Ins = JumpIdx.try_emplace(std::make_pair(I, J), Jumps.size());
+        if (Ins.second)
+          Jumps.push_back({I, J, Count});
+        else
+          Jumps[Ins.first->second].Count += Count;
+      }
+    }
+  }
+
+  std::vector<SmallVector<std::pair<unsigned, uint64_t>, 4>> OutJumps(NumNodes);
+  for (const JumpT &J : Jumps)
+    OutJumps[J.Src].push_back(std::make_pair(J.Dst, J.Count));
+
+  // Score a sequence of nodes: lay them out back to back and sum the score of
+  // every jump whose source and destination both lie in the sequence.
+  auto ScoreSequence = [&](ArrayRef<unsigned> Seq) {
+    DenseMap<unsigned, uint64_t> Offset;
+    uint64_t Pos = 0;
+    for (unsigned N : Seq) {
+      Offset[N] = Pos;
+      Pos += NodeSize[N];
+    }
+    double Score = 0.0;
+    for (unsigned N : Seq) {
+      uint64_t SrcEnd = Offset[N] + NodeSize[N];
+      for (const auto &J : OutJumps[N]) {
+        auto It = Offset.find(J.first);
+        if (It != Offset.end())
+          Score += extTspJumpScore(SrcEnd, It->second, J.second);
+      }
+    }
+    return Score;
+  };
+
+  // Greedy chain merging: start with one chain per node and repeatedly
+  // concatenate the pair of chains whose merge increases the global score the
+  // most. Only chains connected by at least one jump are worth considering,
+  // and nothing may be placed ahead of the chain holding the entry block.
+  std::vector<std::vector<unsigned>> Chains(NumNodes);
+  std::vector<unsigned> ChainOf(NumNodes);
+  std::vector<double> ChainScore(NumNodes, 0.0);
+  for (unsigned I = 0; I != NumNodes; ++I) {
+    Chains[I].push_back(I);
+    ChainOf[I] = I;
+  }
+
+  std::vector<unsigned> Merged;
+  while (true) {
+    double BestGain = 0.0, BestScore = 0.0;
+    unsigned BestX = 0, BestY = 0;
+    for (const JumpT &J : Jumps) {
+      unsigned A = ChainOf[J.Src], B = ChainOf[J.Dst];
+      if (A == B)
+        continue;
+      for (unsigned Dir = 0; Dir != 2; ++Dir) {
+        unsigned X = Dir ? B : A, Y = Dir ? A : B;
+        if (Y == ChainOf[0])
+          continue;
+        Merged.assign(Chains[X].begin(), Chains[X].end());
+        Merged.insert(Merged.end(), Chains[Y].begin(), Chains[Y].end());
+        double Score = ScoreSequence(Merged);
+        double Gain = Score - ChainScore[X] - ChainScore[Y];
+        if (Gain > BestGain) {
+          BestGain = Gain;
+          BestScore = Score;
+          BestX = X;
+          BestY = Y;
+        }
+      }
+    }
+    if (BestGain <= 0.0)
+      break;
+    for (unsigned N : Chains[BestY])
+      ChainOf[N] = BestX;
+    Chains[BestX].insert(Chains[BestX].end(), Chains[BestY].begin(),
+                         Chains[BestY].end());
+    Chains[BestY].clear();
+    ChainScore[BestX] = BestScore;
+  }
+
+  // Concatenate the chains: the entry chain first, then the rest by
+  // decreasing execution density, the heuristic ext-TSP uses for cold code.
+  std::vector<double> Density(NumNodes, 0.0);
+  std::vector<unsigned> ChainOrder;
+  for (unsigned C = 0; C != NumNodes; ++C) {
+    if (Chains[C].empty() || C == ChainOf[0])
+      continue;
+    uint64_t Freq = 0, Size = 0;
+    for (unsigned N : Chains[C]) {
+      Freq += NodeFreq[N];
+      Size += NodeSize[N];
+    }
+    Density[C] = double(Freq) / Size;
+    ChainOrder.push_back(C);
+  }
+  llvm::stable_sort(ChainOrder,
+                    [&](unsigned L, unsigned R) { return Density[L] > Density[R]; });
+
+  std::vector<unsigned> NewOrder(Chains[ChainOf[0]]);
+  for (unsigned C : ChainOrder)
+    NewOrder.insert(NewOrder.end(), Chains[C].begin(), Chains[C].end());
+
+  // Compare against the layout the chain-based algorithm produced, and only
+  // rewrite the function when the model predicts an improvement. Report the
+  // estimated I-cache benefit either way.
+  std::vector<unsigned> OldOrder(NumNodes);
+  for (unsigned I = 0; I != NumNodes; ++I)
+    OldOrder[I] = I;
+  double OldScore = ScoreSequence(OldOrder);
+  double NewScore = ScoreSequence(NewOrder);
+
+  MachineOptimizationRemarkEmitter MORE(*F, nullptr);
+  if (NewScore <= OldScore || !(OldScore > 0.0)) {
+    MORE.emit([&]() {
+      MachineOptimizationRemarkAnalysis R(DEBUG_TYPE, "ExtTspLayout",
+                                          DiagnosticLocation(), &F->front());
+      R << "ext-TSP found no better layout; keeping the original one";
+      return R;
+    });
+    return;
+  }
+
+  int Improvement = int((NewScore - OldScore) * 100.0 / OldScore);
+  MORE.emit([&]() {
+    MachineOptimizationRemarkAnalysis R(DEBUG_TYPE, "ExtTspLayout",
+                                        DiagnosticLocation(), &F->front());
+    R << "applied ext-TSP block layout; estimated I-cache score improved by "
+      << ore::NV("Improvement", Improvement) << "% (from "
+      << ore::NV("ScoreBefore", int64_t(OldScore)) << " to "
+      << ore::NV("ScoreAfter", int64_t(NewScore)) << ")";
+    return R;
+  });
+
+  // Place the blocks in the new order and rewrite the affected terminators.
+  MachineFunction::iterator InsertPos = F->begin();
+  for (unsigned C : NewOrder) {
+    for (MachineBasicBlock *MBB : Nodes[C]) {
+      if (InsertPos != MachineFunction::iterator(MBB))
+        F->splice(InsertPos, MBB);
+      else
+        ++InsertPos;
+    }
+  }
+  for (MachineBasicBlock &MBB : *F) {
+    Cond.clear();
+    MachineBasicBlock *TBB = nullptr, *FBB = nullptr; // For AnalyzeBranch.
+    if (!TII->analyzeBranch(MBB, TBB, FBB, Cond))
+      MBB.updateTerminator();
+  }
+}
+
 void MachineBlockPlacement::optimizeBranches() {
   BlockChain &FunctionChain = *BlockToChain[&F->front()];
   SmallVector<MachineOperand, 4> Cond; // For AnalyzeBranch.
@@ -2982,6 +3284,7 @@ bool MachineBlockPlacement::runOnMachineFunction(MachineFunction &MF) {
 
   F = &MF;
   MBPI = &getAnalysis<MachineBranchProbabilityInfo>();
+  PSI = &getAnalysis<ProfileSummaryInfoWrapperPass>().getPSI();
   MBFI = std::make_unique<BranchFolder::MBFIWrapper>(
       getAnalysis<MachineBlockFrequencyInfo>());
   MLI = &getAnalysis<MachineLoopInfo>();
@@ -3054,6 +3357,13 @@ bool MachineBlockPlacement::runOnMachineFunction(MachineFunction &MF) {
     }
   }
 
+  // Optionally re-optimize the final layout with the global ext-TSP model.
+  // This is a post-processing step: the chain-based layout above remains the
+  // starting point and is only replaced when the model predicts a win.
+  if (EnableExtTspBlockPlacement && MF.size() <= ExtTspMaxBlocks &&
+      (ExtTspWithoutProfile || MF.getFunction().hasProfileData()))
+    applyExtTsp();
+
   optimizeBranches();
   alignBlocks();
 
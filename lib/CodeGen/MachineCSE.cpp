@@ -520,7 +520,11 @@ bool MachineCSE::ProcessBlockCSE(MachineBasicBlock *MBB) {
     if (!isCSECandidate(MI))
       continue;
 
-    bool FoundCSE = VNT.count(MI);
+    // Probe the value number table through an iterator and hold on to it:
+    // every probe re-hashes the whole instruction expression, and the CSE
+    // path below needs the matched value number again.
+    auto VNTIt = VNT.begin(MI);
+    bool FoundCSE = VNTIt != VNT.end();
     if (!FoundCSE) {
       // Using trivial copy propagation to find more CSE opportunities.
       if (PerformTrivialCopyPropagation(MI, MBB)) {
@@ -531,7 +535,8 @@ bool MachineCSE::ProcessBlockCSE(MachineBasicBlock *MBB) {
           continue;
 
         // Try again to see if CSE is possible.
-        FoundCSE = VNT.count(MI);
+        VNTIt = VNT.begin(MI);
+        FoundCSE = VNTIt != VNT.end();
       }
     }
 
@@ -540,11 +545,14 @@ bool MachineCSE::ProcessBlockCSE(MachineBasicBlock *MBB) {
     if (!FoundCSE && MI->isCommutable()) {
       if (MachineInstr *NewMI = TII->commuteInstruction(*MI)) {
         Commuted = true;
-        FoundCSE = VNT.count(NewMI);
+        VNTIt = VNT.begin(NewMI);
+        FoundCSE = VNTIt != VNT.end();
         if (NewMI != MI) {
           // New instruction. It doesn't need to be kept.
           NewMI->eraseFromParent();
           Changed = true;
+          // The value number uses below key off MI, not the erased copy.
+          VNTIt = VNT.begin(MI);
         } else if (!FoundCSE)
           // MI was changed but it didn't help, commute it back!
           (void)TII->commuteInstruction(*MI);
@@ -558,6 +566,8 @@ bool MachineCSE::ProcessBlockCSE(MachineBasicBlock *MBB) {
     SmallSet<unsigned, 8> PhysRefs;
     PhysDefVector PhysDefs;
     bool PhysUseDef = false;
+    // Matches VNT.lookup(MI): a missed probe yields the default value number.
+    unsigned CSVN = VNTIt != VNT.end() ? *VNTIt : 0;
     if (FoundCSE && hasLivePhysRegDefUses(MI, MBB, PhysRefs,
                                           PhysDefs, PhysUseDef)) {
       FoundCSE = false;
@@ -568,7 +578,6 @@ bool MachineCSE::ProcessBlockCSE(MachineBasicBlock *MBB) {
       // This can never be the case if the instruction both uses and
       // defines the same physical register, which was detected above.
       if (!PhysUseDef) {
-        unsigned CSVN = VNT.lookup(MI);
         MachineInstr *CSMI = Exps[CSVN];
         if (PhysRegDefsReach(CSMI, MI, PhysRefs, PhysDefs, CrossMBBPhysDef))
           FoundCSE = true;
@@ -582,7 +591,6 @@ bool MachineCSE::ProcessBlockCSE(MachineBasicBlock *MBB) {
     }
 
     // Found a common subexpression, eliminate it.
-    unsigned CSVN = VNT.lookup(MI);
     MachineInstr *CSMI = Exps[CSVN];
     LLVM_DEBUG(dbgs() << "Examining: " << *MI);
     LLVM_DEBUG(dbgs() << "*** Found a common subexpression: " << *CSMI);
@@ -798,12 +806,13 @@ bool MachineCSE::ProcessBlockPRE(MachineDominatorTree *DT,
     if (!isPRECandidate(MI))
       continue;
 
-    if (!PREMap.count(MI)) {
-      PREMap[MI] = MBB;
+    // A single probe both finds the prior occurrence and records this one:
+    // each PREMap probe hashes the whole instruction expression.
+    auto MapEntry = PREMap.try_emplace(MI, MBB);
+    if (MapEntry.second)
       continue;
-    }
 
-    auto MBB1 = PREMap[MI];
+    auto MBB1 = MapEntry.first->second;
     assert(
         !DT->properlyDominates(MBB, MBB1) &&
         "MBB cannot properly dominate MBB1 while DFS through dominators tree!");
@@ -832,7 +841,9 @@ bool MachineCSE::ProcessBlockPRE(MachineDominatorTree *DT,
             TII->duplicate(*CMBB, CMBB->getFirstTerminator(), *MI);
         NewMI.getOperand(0).setReg(NewReg);
 
-        PREMap[MI] = CMBB;
+        // No PREMap insertions happened since the probe above, so the
+        // iterator is still valid.
+        MapEntry.first->second = CMBB;
         ++NumPREs;
         Changed = true;
       }
@@ -58,6 +58,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/CodeGen/MachineFunction.h"
 #include "llvm/CodeGen/MachineModuleInfo.h"
 #include "llvm/CodeGen/MachineOptimizationRemarkEmitter.h"
@@ -96,6 +97,26 @@ static cl::opt<bool> EnableLinkOnceODROutlining(
     cl::desc("Enable the machine outliner on linkonceodr functions"),
     cl::init(false));
 
+// When profile information is available, skip functions with a hot entry
+// count. Outlining trades speed for size, which is the wrong trade on the
+// paths the profile says are hot; restricting the outliner to cold code also
+// shrinks the instruction mapping and thus the suffix tree.
+static cl::opt<bool> OutlinerSkipHotFunctions(
+    "outliner-skip-hot-functions", cl::Hidden,
+    cl::desc("Do not outline from functions that profile data marks as hot"),
+    cl::init(true));
+
+// A budget on the number of outlined functions created per module. The suffix
+// tree can produce a very large number of profitable repeated sequences in big
+// modules, and each one costs candidate pruning, function creation, and call
+// rewriting time. Candidates found after the limit is reached are dropped, so
+// this trades some size savings for a bound on compile time.
+static cl::opt<unsigned> OutlinerCandidateLimit(
+    "outliner-candidate-limit", cl::Hidden,
+    cl::desc("Stop searching for outlining candidates after finding this many "
+             "profitable ones (0 = no limit)"),
+    cl::init(0));
+
 namespace {
 
 /// Represents an undefined index in the suffix tree.
@@ -843,10 +864,15 @@ struct MachineOutliner : public ModulePass {
   /// Set when the pass is constructed in TargetPassConfig.
   bool RunOnAllFunctions = true;
 
+  /// Profile summary for the module, used to avoid outlining from hot
+  /// functions when profile data is available.
+  ProfileSummaryInfo *PSI = nullptr;
+
   StringRef getPassName() const override { return "Machine Outliner"; }
 
   void getAnalysisUsage(AnalysisUsage &AU) const override {
     AU.addRequired<MachineModuleInfoWrapperPass>();
+    AU.addRequired<ProfileSummaryInfoWrapperPass>();
     AU.addPreserved<MachineModuleInfoWrapperPass>();
     AU.setPreservesAll();
     ModulePass::getAnalysisUsage(AU);
@@ -941,8 +967,11 @@ ModulePass *createMachineOutlinerPass(bool RunOnAllFunctions) {
 
 } // namespace llvm
 
-INITIALIZE_PASS(MachineOutliner, DEBUG_TYPE, "Machine Function Outliner", false,
-                false)
+INITIALIZE_PASS_BEGIN(MachineOutliner, DEBUG_TYPE, "Machine Function Outliner",
+                      false, false)
+INITIALIZE_PASS_DEPENDENCY(ProfileSummaryInfoWrapperPass)
+INITIALIZE_PASS_END(MachineOutliner, DEBUG_TYPE, "Machine Function Outliner",
+                    false, false)
 
 void MachineOutliner::emitNotOutliningCheaperRemark(
     unsigned StringLen, std::vector<Candidate> &CandidatesForRepeatedSeq,
@@ -1084,6 +1113,11 @@ MachineOutliner::findCandidates(InstructionMapper &Mapper,
     }
 
     FunctionList.push_back(OF);
+
+    // Respect the candidate budget if one was set. This bounds the time spent
+    // creating outlined functions and rewriting call sites in large modules.
+    if (OutlinerCandidateLimit && FunctionList.size() >= OutlinerCandidateLimit)
+      return;
   }
 }
 
@@ -1309,6 +1343,13 @@ void MachineOutliner::populateMapper(InstructionMapper &Mapper, Module &M,
     if (F.hasFnAttribute(Attribute::NoReturn))
       continue;
 
+    // With profile data, don't outline from hot functions. The call overhead
+    // lands exactly where the program spends its time, and the size savings
+    // are still available in the cold portion of the module.
+    if (OutlinerSkipHotFunctions && PSI && PSI->hasProfileSummary() &&
+        PSI->isFunctionEntryHot(&F))
+      continue;
+
     // There's something in F. Check if it has a MachineFunction associated with
     // it.
     MachineFunction *MF = MMI.getMachineFunction(F);
@@ -1428,6 +1469,7 @@ bool MachineOutliner::runOnModule(Module &M) {
     return false;
 
   MachineModuleInfo &MMI = getAnalysis<MachineModuleInfoWrapperPass>().getMMI();
+  PSI = &getAnalysis<ProfileSummaryInfoWrapperPass>().getPSI();
 
   // If the user passed -enable-machine-outliner=always or
   // -enable-machine-outliner, the pass will run on all functions in the module.
@@ -21,6 +21,7 @@
 #include "llvm/ADT/SparseBitVector.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/AliasAnalysis.h"
+#include "llvm/CodeGen/LiveIntervals.h"
 #include "llvm/CodeGen/MachineBasicBlock.h"
 #include "llvm/CodeGen/MachineBlockFrequencyInfo.h"
 #include "llvm/CodeGen/MachineBranchProbabilityInfo.h"
@@ -88,6 +89,7 @@ namespace {
     MachineDominatorTree *DT;      // Machine dominator tree
     MachinePostDominatorTree *PDT; // Machine post dominator tree
     MachineLoopInfo *LI;
+    LiveIntervals *LIS;       // Non-null when intervals are to be preserved.
     const MachineBlockFrequencyInfo *MBFI;
     const MachineBranchProbabilityInfo *MBPI;
     AliasAnalysis *AA;
@@ -122,6 +124,8 @@ namespace {
       AU.addRequired<MachineLoopInfo>();
       AU.addRequired<MachineBranchProbabilityInfo>();
       AU.addPreserved<MachineLoopInfo>();
+      AU.addPreserved<SlotIndexes>();
+      AU.addPreserved<LiveIntervals>();
       if (UseBlockFreqInfo)
         AU.addRequired<MachineBlockFrequencyInfo>();
     }
@@ -210,7 +214,18 @@ bool MachineSinking::PerformTrivialForwardCoalescing(MachineInstr &MI,
   LLVM_DEBUG(dbgs() << "Coalescing: " << *DefMI);
   LLVM_DEBUG(dbgs() << "*** to: " << MI);
   MRI->replaceRegWith(DstReg, SrcReg);
+  if (LIS)
+    LIS->RemoveMachineInstrFromMaps(MI);
   MI.eraseFromParent();
+  if (LIS) {
+    // DstReg has no uses left; SrcReg inherited them and must be recomputed.
+    if (LIS->hasInterval(DstReg))
+      LIS->removeInterval(DstReg);
+    if (LIS->hasInterval(SrcReg)) {
+      LIS->removeInterval(SrcReg);
+      LIS->createAndComputeVirtRegInterval(SrcReg);
+    }
+  }
 
   // Conservatively, clear any kill flags, since it's possible that they are no
   // longer correct.
@@ -302,6 +317,9 @@ bool MachineSinking::runOnMachineFunction(MachineFunction &MF) {
   MBFI = UseBlockFreqInfo ? &getAnalysis<MachineBlockFrequencyInfo>() : nullptr;
   MBPI = &getAnalysis<MachineBranchProbabilityInfo>();
   AA = &getAnalysis<AAResultsWrapperPass>().getAAResults();
+  // Keep live intervals up to date if they were computed earlier in the
+  // pipeline instead of forcing a recomputation.
+  LIS = getAnalysisIfAvailable<LiveIntervals>();
 
   bool EverMadeChange = false;
 
@@ -883,6 +901,8 @@ bool MachineSinking::SinkInstruction(MachineInstr &MI, bool &SawStore,
     ++InsertPos;
 
   performSink(MI, *SuccToSinkTo, InsertPos);
+  if (LIS)
+    LIS->handleMoveAcrossBlocks(MI);
 
   // Conservatively, clear any kill flags, since it's possible that they are no
   // longer correct.
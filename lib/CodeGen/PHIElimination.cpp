@@ -417,11 +417,16 @@ void PHIElimination::LowerPHINode(MachineBasicBlock &MBB,
       }
     }
 
+    // Check whether this was the last PHI use of SrcReg on this CFG edge. Both
+    // the LiveVariables and LiveIntervals updates below key off this, so look
+    // it up once rather than rehashing the pair for each of them.
+    bool EdgeHasOtherPHIUses =
+        VRegPHIUseCount.lookup(BBVRegPair(opBlock.getNumber(), SrcReg)) != 0;
+
     // We only need to update the LiveVariables kill of SrcReg if this was the
     // last PHI use of SrcReg to be lowered on this CFG edge and it is not live
     // out of the predecessor. We can also ignore undef sources.
-    if (LV && !SrcUndef &&
-        !VRegPHIUseCount[BBVRegPair(opBlock.getNumber(), SrcReg)] &&
+    if (LV && !SrcUndef && !EdgeHasOtherPHIUses &&
         !LV->isLiveOut(SrcReg, opBlock)) {
       // We want to be able to insert a kill of the register if this PHI (aka,
       // the copy we just inserted) is the last use of the source value. Live
@@ -481,8 +486,7 @@ void PHIElimination::LowerPHINode(MachineBasicBlock &MBB,
         LIS->addSegmentToEndOfBlock(IncomingReg, *NewSrcInstr);
       }
 
-      if (!SrcUndef &&
-          !VRegPHIUseCount[BBVRegPair(opBlock.getNumber(), SrcReg)]) {
+      if (!SrcUndef && !EdgeHasOtherPHIUses) {
         LiveInterval &SrcLI = LIS->getInterval(SrcReg);
 
         bool isLiveOut = false;
@@ -549,6 +553,18 @@ void PHIElimination::LowerPHINode(MachineBasicBlock &MBB,
 /// used in a PHI node. We map that to the BB the vreg is coming from. This is
 /// used later to determine when the vreg is killed in the BB.
 void PHIElimination::analyzePHINodes(const MachineFunction& MF) {
+  // Pre-size the map to avoid repeated rehashing on PHI-heavy functions such
+  // as lowered switches. The number of distinct (block, vreg) pairs is bounded
+  // by the total number of PHI sources.
+  unsigned NumPHISrcs = 0;
+  for (const auto &MBB : MF)
+    for (const auto &BBI : MBB) {
+      if (!BBI.isPHI())
+        break;
+      NumPHISrcs += (BBI.getNumOperands() - 1) / 2;
+    }
+  VRegPHIUseCount.reserve(NumPHISrcs);
+
   for (const auto &MBB : MF)
     for (const auto &BBI : MBB) {
       if (!BBI.isPHI())
@@ -84,6 +84,8 @@ using namespace llvm;
 STATISTIC(NumGlobalSplits, "Number of split global live ranges");
 STATISTIC(NumLocalSplits,  "Number of split local live ranges");
 STATISTIC(NumEvicted,      "Number of interferences evicted");
+STATISTIC(NumEvictionChains, "Number of eviction chains started");
+STATISTIC(NumChainedEvictions, "Number of evictions extending a chain");
 
 static cl::opt<SplitEditor::ComplementSpillMode> SplitSpillMode(
     "split-spill-mode", cl::Hidden,
@@ -252,6 +254,18 @@ class RAGreedy : public MachineFunctionPass,
 
   IndexedMap<RegInfo, VirtReg2IndexFunctor> ExtraRegInfo;
 
+  // Cached interference tests for checkPhysRegInterference(). Keyed by
+  // (virtual register, physical register) and stamped with the matrix user
+  // tag plus the version tags of the physreg's register unit unions, so an
+  // entry survives evictions that don't touch those units and is discarded
+  // whenever virtual registers may have been modified.
+  struct InterfCacheEntry {
+    unsigned UserTag = 0;
+    SmallVector<unsigned, 4> UnionTags;
+    bool Interference = false;
+  };
+  DenseMap<std::pair<unsigned, unsigned>, InterfCacheEntry> InterfCache;
+
   LiveRangeStage getStage(const LiveInterval &VirtReg) const {
     return ExtraRegInfo[VirtReg.reg].Stage;
   }
@@ -463,6 +477,7 @@ private:
   void splitAroundRegion(LiveRangeEdit&, ArrayRef<unsigned>);
   void calcGapWeights(unsigned, SmallVectorImpl<float>&);
   unsigned canReassign(LiveInterval &VirtReg, unsigned PrevReg);
+  bool checkPhysRegInterference(LiveInterval &VirtReg, unsigned PhysReg);
   bool shouldEvict(LiveInterval &A, bool, LiveInterval &B, bool);
   bool canEvictInterference(LiveInterval&, unsigned, bool, EvictionCost&,
                             const SmallVirtRegSet&);
@@ -675,6 +690,7 @@ void RAGreedy::LRE_DidCloneVirtReg(unsigned New, unsigned Old) {
 void RAGreedy::releaseMemory() {
   SpillerInstance.reset();
   ExtraRegInfo.clear();
+  InterfCache.clear();
   GlobalCand.clear();
 }
 
@@ -806,6 +822,41 @@ unsigned RAGreedy::tryAssign(LiveInterval &VirtReg,
 //                         Interference eviction
 //===----------------------------------------------------------------------===//
 
+/// Test VirtReg for interference on PhysReg's register units. Results are
+/// cached with LiveIntervalUnion version stamps so that repeated tests for
+/// the same (VirtReg, PhysReg) pair don't rescan unchanged unions.
+bool RAGreedy::checkPhysRegInterference(LiveInterval &VirtReg,
+                                        unsigned PhysReg) {
+  auto Ins = InterfCache.try_emplace(std::make_pair(VirtReg.reg, PhysReg));
+  InterfCacheEntry &Entry = Ins.first->second;
+  if (!Ins.second && Entry.UserTag == Matrix->getUserTag()) {
+    bool Valid = true;
+    unsigned I = 0;
+    for (MCRegUnitIterator Units(PhysReg, TRI); Units.isValid(); ++Units, ++I)
+      if (Matrix->getLiveUnions()[*Units].changedSince(Entry.UnionTags[I])) {
+        Valid = false;
+        break;
+      }
+    if (Valid)
+      return Entry.Interference;
+  }
+
+  Entry.UserTag = Matrix->getUserTag();
+  Entry.UnionTags.clear();
+  Entry.Interference = false;
+  for (MCRegUnitIterator Units(PhysReg, TRI); Units.isValid(); ++Units) {
+    LiveIntervalUnion &LIU = Matrix->getLiveUnions()[*Units];
+    Entry.UnionTags.push_back(LIU.getTag());
+    if (!Entry.Interference) {
+      // Instantiate a "subquery", not to be confused with the Queries array.
+      LiveIntervalUnion::Query subQ(VirtReg, LIU);
+      if (subQ.checkInterference())
+        Entry.Interference = true;
+    }
+  }
+  return Entry.Interference;
+}
+
 unsigned RAGreedy::canReassign(LiveInterval &VirtReg, unsigned PrevReg) {
   AllocationOrder Order(VirtReg.reg, *VRM, RegClassInfo, Matrix);
   unsigned PhysReg;
@@ -813,15 +864,8 @@ unsigned RAGreedy::canReassign(LiveInterval &VirtReg, unsigned PrevReg) {
     if (PhysReg == PrevReg)
       continue;
 
-    MCRegUnitIterator Units(PhysReg, TRI);
-    for (; Units.isValid(); ++Units) {
-      // Instantiate a "subquery", not to be confused with the Queries array.
-      LiveIntervalUnion::Query subQ(VirtReg, Matrix->getLiveUnions()[*Units]);
-      if (subQ.checkInterference())
-        break;
-    }
     // If no units have interference, break out with the current PhysReg.
-    if (!Units.isValid())
+    if (!checkPhysRegInterference(VirtReg, PhysReg))
       break;
   }
   if (PhysReg)
@@ -1051,8 +1095,14 @@ void RAGreedy::evictInterference(LiveInterval &VirtReg, unsigned PhysReg,
   // number to every evicted register. These live ranges than then only be
   // evicted by a newer cascade, preventing infinite loops.
   unsigned Cascade = ExtraRegInfo[VirtReg.reg].Cascade;
-  if (!Cascade)
+  if (!Cascade) {
     Cascade = ExtraRegInfo[VirtReg.reg].Cascade = NextCascade++;
+    ++NumEvictionChains;
+  } else {
+    // VirtReg already has a cascade number: it was evicted or evicted others
+    // before, so this eviction extends an existing chain.
+    ++NumChainedEvictions;
+  }
 
   LLVM_DEBUG(dbgs() << "evicting " << printReg(PhysReg, TRI)
                     << " interference: Cascade " << Cascade << '\n');
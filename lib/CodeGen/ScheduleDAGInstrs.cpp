@@ -538,7 +538,24 @@ static inline bool isGlobalMemoryObject(AAResults *AA, MachineInstr *MI) {
 
 void ScheduleDAGInstrs::addChainDependency (SUnit *SUa, SUnit *SUb,
                                             unsigned Latency) {
-  if (SUa->getInstr()->mayAlias(AAForDep, *SUb->getInstr(), UseTBAA)) {
+  MachineInstr &MIa = *SUa->getInstr();
+  MachineInstr &MIb = *SUb->getInstr();
+  bool MayAlias;
+  if (MIa.hasOneMemOperand() && MIb.hasOneMemOperand()) {
+    // When both accesses are described by a single memory operand, the alias
+    // verdict is a function of the operand pair, so memoize it. The same pair
+    // recurs whenever the instructions share more than one underlying value.
+    auto Ins = AliasCache.try_emplace(
+        std::make_pair(*MIa.memoperands_begin(), *MIb.memoperands_begin()),
+        false);
+    if (Ins.second)
+      Ins.first->second = MIa.mayAlias(AAForDep, MIb, UseTBAA);
+    MayAlias = Ins.first->second;
+  } else {
+    MayAlias = MIa.mayAlias(AAForDep, MIb, UseTBAA);
+  }
+
+  if (MayAlias) {
     SDep Dep(SUa, SDep::MayAliasMem);
     Dep.setLatency(Latency);
     SUb->addPred(Dep);
@@ -727,6 +744,7 @@ void ScheduleDAGInstrs::buildSchedGraph(AAResults *AA,
   bool UseAA = EnableAASchedMI.getNumOccurrences() > 0 ? EnableAASchedMI
                                                        : ST.useAA();
   AAForDep = UseAA ? AA : nullptr;
+  AliasCache.clear();
 
   BarrierChain = nullptr;
 
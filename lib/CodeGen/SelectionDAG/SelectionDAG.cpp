@@ -1014,6 +1014,12 @@ void SelectionDAG::init(MachineFunction &NewMF,
   LibInfo = LibraryInfo;
   Context = &MF->getFunction().getContext();
   DA = Divergence;
+
+  // Operand memory is recycled across the blocks of a function (see clear()).
+  // Release it when starting a new function so the retained high-water mark
+  // is bounded by a single function.
+  OperandRecycler.clear(OperandAllocator);
+  OperandAllocator.Reset();
 }
 
 SelectionDAG::~SelectionDAG() {
@@ -1075,8 +1081,10 @@ SDNode *SelectionDAG::FindNodeOrInsertPos(const FoldingSetNodeID &ID,
 
 void SelectionDAG::clear() {
   allnodes_clear();
-  OperandRecycler.clear(OperandAllocator);
-  OperandAllocator.Reset();
+  // Do not release operand memory here: allnodes_clear() put every operand
+  // array on the recycler's free lists, and keeping them (and the allocator's
+  // slabs) hot lets the next block of this function allocate without going
+  // back to malloc. init() frees the memory when a new function starts.
   CSEMap.clear();
 
   ExtendedValueTypeNodes.clear();
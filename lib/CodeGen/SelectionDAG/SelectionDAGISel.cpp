@@ -2512,6 +2512,18 @@ CheckType(const unsigned char *MatcherTable, unsigned &MatcherIndex, SDValue N,
   return VT == MVT::iPTR && N.getValueType() == TLI->getPointerTy(DL);
 }
 
+/// CheckOpcodeAndType - Implements OPC_CheckOpcodeAndType, the fused form of
+/// OPC_CheckOpcode followed by OPC_CheckType on result #0.
+LLVM_ATTRIBUTE_ALWAYS_INLINE static inline bool
+CheckOpcodeAndType(const unsigned char *MatcherTable, unsigned &MatcherIndex,
+                   SDValue N, const TargetLowering *TLI,
+                   const DataLayout &DL) {
+  // Consume both operands even on failure so callers that scan past the
+  // predicate (e.g. IsPredicateKnownToFail) see a consistent MatcherIndex.
+  bool OpcodeMatches = ::CheckOpcode(MatcherTable, MatcherIndex, N.getNode());
+  return ::CheckType(MatcherTable, MatcherIndex, N, TLI, DL) && OpcodeMatches;
+}
+
 LLVM_ATTRIBUTE_ALWAYS_INLINE static inline bool
 CheckChildType(const unsigned char *MatcherTable, unsigned &MatcherIndex,
                SDValue N, const TargetLowering *TLI, const DataLayout &DL,
@@ -2637,6 +2649,10 @@ static unsigned IsPredicateKnownToFail(const unsigned char *Table,
                           SDISel.CurDAG->getDataLayout());
     return Index;
   }
+  case SelectionDAGISel::OPC_CheckOpcodeAndType:
+    Result = !::CheckOpcodeAndType(Table, Index, N, SDISel.TLI,
+                                   SDISel.CurDAG->getDataLayout());
+    return Index;
   case SelectionDAGISel::OPC_CheckChild0Type:
   case SelectionDAGISel::OPC_CheckChild1Type:
   case SelectionDAGISel::OPC_CheckChild2Type:
@@ -2935,6 +2951,16 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       MatchScopes.push_back(NewEntry);
       continue;
     }
+    case OPC_Jump: {
+      // Continue at a shared subtree emitted earlier in the table. Shared
+      // subtrees always end in a completion or a failure that pops a scope,
+      // so there is no return address to track.
+      unsigned Target = MatcherTable[MatcherIndex++];
+      if (Target & 128)
+        Target = GetVBR(Target, MatcherTable, MatcherIndex);
+      MatcherIndex = Target;
+      continue;
+    }
     case OPC_RecordNode: {
       // Remember this node, it may end up being an operand in the pattern.
       SDNode *Parent = nullptr;
@@ -3068,6 +3094,12 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       continue;
     }
 
+    case OPC_CheckOpcodeAndType:
+      if (!::CheckOpcodeAndType(MatcherTable, MatcherIndex, N, TLI,
+                                CurDAG->getDataLayout()))
+        break;
+      continue;
+
     case OPC_SwitchOpcode: {
       unsigned CurNodeOpcode = N.getOpcode();
       unsigned SwitchStart = MatcherIndex-1; (void)SwitchStart;
@@ -61,6 +61,7 @@ namespace {
     LiveStacks* LS;
     MachineFrameInfo *MFI;
     const TargetInstrInfo  *TII;
+    const TargetRegisterInfo *TRI;
     const MachineBlockFrequencyInfo *MBFI;
 
     // SSIntervals - Spill slot intervals.
@@ -416,9 +417,10 @@ void StackSlotColoring::RewriteInstruction(MachineInstr &MI,
 
 /// RemoveDeadStores - Scan through a basic block and look for loads followed
 /// by stores.  If they're both using the same stack slot, then the store is
-/// definitely dead.  This could obviously be much more aggressive (consider
-/// pairs with instructions between them), but such extensions might have a
-/// considerable compile time impact.
+/// definitely dead.  Likewise, a reload immediately following a store of the
+/// same register to the same slot is redundant.  This could obviously be much
+/// more aggressive (consider pairs with instructions between them), but such
+/// extensions might have a considerable compile time impact.
 bool StackSlotColoring::RemoveDeadStores(MachineBasicBlock* MBB) {
   // FIXME: This could be much more aggressive, but we need to investigate
   // the compile time impact of doing so.
@@ -446,8 +448,34 @@ bool StackSlotColoring::RemoveDeadStores(MachineBasicBlock* MBB) {
     unsigned StoreReg = 0;
     unsigned LoadSize = 0;
     unsigned StoreSize = 0;
-    if (!(LoadReg = TII->isLoadFromStackSlot(*I, FirstSS, LoadSize)))
+    if (!(LoadReg = TII->isLoadFromStackSlot(*I, FirstSS, LoadSize))) {
+      // Not a load; check for a store immediately followed by a reload of the
+      // same register from the same slot. The reload is redundant since the
+      // register still holds the value that was just stored.
+      if (!(StoreReg = TII->isStoreToStackSlot(*I, FirstSS, StoreSize)))
+        continue;
+      MachineBasicBlock::iterator StoreMI = I;
+      while ((NextMI != E) && NextMI->isDebugInstr()) {
+        ++NextMI;
+        ++I;
+      }
+      if (NextMI == E) continue;
+      if (!(LoadReg = TII->isLoadFromStackSlot(*NextMI, SecondSS, LoadSize)))
+        continue;
+      if (FirstSS != SecondSS || LoadReg != StoreReg || FirstSS == -1 ||
+          LoadSize != StoreSize)
+        continue;
+
+      ++NumDead;
+      changed = true;
+
+      // The register stays live past the point of the erased reload, so the
+      // store (and anything before it) may no longer kill it.
+      StoreMI->clearRegisterKills(StoreReg, TRI);
+      toErase.push_back(&*NextMI);
+      ++I;
       continue;
+    }
     // Skip the ...pseudo debugging... instructions between a load and store.
     while ((NextMI != E) && NextMI->isDebugInstr()) {
       ++NextMI;
@@ -490,6 +518,7 @@ bool StackSlotColoring::runOnMachineFunction(MachineFunction &MF) {
 
   MFI = &MF.getFrameInfo();
   TII = MF.getSubtarget().getInstrInfo();
+  TRI = MF.getSubtarget().getRegisterInfo();
   LS = &getAnalysis<LiveStacks>();
   MBFI = &getAnalysis<MachineBlockFrequencyInfo>();
 
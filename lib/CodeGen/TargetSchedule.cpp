@@ -79,6 +79,9 @@ void TargetSchedModel::init(const TargetSubtargetInfo *TSInfo) {
     unsigned NumUnits = SchedModel.getProcResource(Idx)->NumUnits;
     ResourceFactors[Idx] = NumUnits ? (ResourceLCM / NumUnits) : 0;
   }
+
+  SchedClassLatencyTable.assign(
+      hasInstrSchedModel() ? SchedModel.NumSchedClasses : 0, InvalidLatency);
 }
 
 /// Returns true only if instruction is specified as single issue.
@@ -260,7 +263,14 @@ TargetSchedModel::computeInstrLatency(const MCSchedClassDesc &SCDesc) const {
 unsigned TargetSchedModel::computeInstrLatency(unsigned Opcode) const {
   assert(hasInstrSchedModel() && "Only call this function with a SchedModel");
   unsigned SCIdx = TII->get(Opcode).getSchedClass();
-  return capLatency(SchedModel.computeInstrLatency(*STI, SCIdx));
+  if (SCIdx < SchedClassLatencyTable.size() &&
+      SchedClassLatencyTable[SCIdx] != InvalidLatency)
+    return SchedClassLatencyTable[SCIdx];
+  unsigned Latency = capLatency(SchedModel.computeInstrLatency(*STI, SCIdx));
+  if (SCIdx < SchedClassLatencyTable.size() &&
+      !SchedModel.getSchedClassDesc(SCIdx)->isVariant())
+    SchedClassLatencyTable[SCIdx] = Latency;
+  return Latency;
 }
 
 unsigned TargetSchedModel::computeInstrLatency(const MCInst &Inst) const {
@@ -279,9 +289,22 @@ TargetSchedModel::computeInstrLatency(const MachineInstr *MI,
     return TII->getInstrLatency(&InstrItins, *MI);
 
   if (hasInstrSchedModel()) {
+    // Fast path: for a non-variant scheduling class, every instruction with
+    // the class has the same latency, and the table has already been filled
+    // in by an earlier query.
+    unsigned SCIdx = MI->getDesc().getSchedClass();
+    if (SCIdx < SchedClassLatencyTable.size() &&
+        SchedClassLatencyTable[SCIdx] != InvalidLatency)
+      return SchedClassLatencyTable[SCIdx];
+
     const MCSchedClassDesc *SCDesc = resolveSchedClass(MI);
-    if (SCDesc->isValid())
-      return computeInstrLatency(*SCDesc);
+    if (SCDesc->isValid()) {
+      unsigned Latency = computeInstrLatency(*SCDesc);
+      if (SCIdx < SchedClassLatencyTable.size() &&
+          !SchedModel.getSchedClassDesc(SCIdx)->isVariant())
+        SchedClassLatencyTable[SCIdx] = Latency;
+      return Latency;
+    }
   }
   return TII->defaultDefLatency(SchedModel, *MI);
 }
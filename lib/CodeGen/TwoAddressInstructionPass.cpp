@@ -73,6 +73,8 @@ STATISTIC(NumConvertedTo3Addr, "Number of instructions promoted to 3-address");
 STATISTIC(Num3AddrSunk,        "Number of 3-address instructions sunk");
 STATISTIC(NumReSchedUps,       "Number of instructions re-scheduled up");
 STATISTIC(NumReSchedDowns,     "Number of instructions re-scheduled down");
+STATISTIC(NumKillFastPath,     "Number of conversions fast-pathed on a kill "
+                               "flag");
 
 // Temporary flag to disable rescheduling.
 static cl::opt<bool>
@@ -80,6 +82,18 @@ EnableRescheduling("twoaddr-reschedule",
                    cl::desc("Coalesce copies by rescheduling (default=true)"),
                    cl::init(true), cl::Hidden);
 
+// Fast-path conversions whose tied use already carries a kill flag: the
+// inserted copy ends the source's live range at the instruction, so it is
+// trivially coalescable and the commute/reschedule/3-addr analysis in
+// tryInstructionTransform is skipped. This trades a small amount of
+// optimization opportunity (mostly commutes done for scheduling reasons) for
+// compile time, so it is off by default.
+static cl::opt<bool> EnableKillFastPath(
+    "twoaddr-kill-fast-path",
+    cl::desc("Skip the transform analysis for tied uses that are plain kills "
+             "(default=false)"),
+    cl::init(false), cl::Hidden);
+
 // Limit the number of dataflow edges to traverse when evaluating the benefit
 // of commuting operands.
 static cl::opt<unsigned> MaxDataFlowEdge(
@@ -1741,7 +1755,21 @@ bool TwoAddressInstructionPass::runOnMachineFunction(MachineFunction &Func) {
           unsigned DstIdx = TiedPairs[0].second;
           Register SrcReg = mi->getOperand(SrcIdx).getReg();
           Register DstReg = mi->getOperand(DstIdx).getReg();
-          if (SrcReg != DstReg &&
+          // Cheap pre-check: if the tied use is already a plain kill, the
+          // copy inserted by processTiedPairs dies immediately and will be
+          // coalesced away, so the transform analysis below has nothing to
+          // buy back. Only trust the kill flag when there is no
+          // LiveIntervals analysis that could contradict it.
+          bool PlainKill = EnableKillFastPath && !LIS &&
+                           OptLevel != CodeGenOpt::None && SrcReg != DstReg &&
+                           Register::isVirtualRegister(SrcReg) &&
+                           mi->getOperand(SrcIdx).isKill() &&
+                           !mi->getOperand(SrcIdx).getSubReg() &&
+                           MRI->hasOneDef(SrcReg) &&
+                           !MRI->getVRegDef(SrcReg)->isCopyLike();
+          if (PlainKill)
+            ++NumKillFastPath;
+          else if (SrcReg != DstReg &&
               tryInstructionTransform(mi, nmi, SrcIdx, DstIdx, Dist, false)) {
             // The tied operands have been eliminated or shifted further down
             // the block to ease elimination. Continue processing with 'nmi'.
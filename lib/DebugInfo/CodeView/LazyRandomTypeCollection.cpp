@@ -87,6 +87,23 @@ uint32_t LazyRandomTypeCollection::getOffsetOfType(TypeIndex Index) {
   return Records[Index.toArrayIndex()].Offset;
 }
 
+void LazyRandomTypeCollection::visitAllRecords() {
+  TypeIndex CurrentTI = TypeIndex::fromArrayIndex(0);
+  for (auto Begin = Types.begin(), End = Types.end(); Begin != End; ++Begin) {
+    ensureCapacityFor(CurrentTI);
+    LargestTypeIndex = std::max(LargestTypeIndex, CurrentTI);
+    auto Idx = CurrentTI.toArrayIndex();
+    // Some ranges may have been visited already through the random access
+    // interface; only count records that are seen for the first time.
+    if (!Records[Idx].Type.valid()) {
+      Records[Idx].Type = *Begin;
+      Records[Idx].Offset = Begin.offset();
+      ++Count;
+    }
+    ++CurrentTI;
+  }
+}
+
 CVType LazyRandomTypeCollection::getType(TypeIndex Index) {
   assert(!Index.isSimple());
 
@@ -51,6 +51,7 @@
 #include <cstdint>
 #include <deque>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -612,9 +613,12 @@ DWARFCompileUnit *DWARFContext::getDWOCompileUnitForHash(uint64_t Hash) {
   parseDWOUnits(LazyParse);
 
   if (const auto &CUI = getCUIndex()) {
-    if (const auto *R = CUI.getFromHash(Hash))
+    if (const auto *R = CUI.getFromHash(Hash)) {
+      // getUnitForIndexEntry materializes lazily parsed units.
+      std::lock_guard<std::mutex> Lock(UnitsMutex);
       return dyn_cast_or_null<DWARFCompileUnit>(
           DWOUnits.getUnitForIndexEntry(*R));
+    }
     return nullptr;
   }
 
@@ -659,6 +663,7 @@ bool DWARFContext::verify(raw_ostream &OS, DIDumpOptions DumpOpts) {
 }
 
 const DWARFUnitIndex &DWARFContext::getCUIndex() {
+  std::lock_guard<std::mutex> Lock(IndexMutex);
   if (CUIndex)
     return *CUIndex;
 
@@ -670,6 +675,7 @@ const DWARFUnitIndex &DWARFContext::getCUIndex() {
 }
 
 const DWARFUnitIndex &DWARFContext::getTUIndex() {
+  std::lock_guard<std::mutex> Lock(IndexMutex);
   if (TUIndex)
     return *TUIndex;
 
@@ -691,6 +697,7 @@ DWARFGdbIndex &DWARFContext::getGdbIndex() {
 }
 
 const DWARFDebugAbbrev *DWARFContext::getDebugAbbrev() {
+  std::lock_guard<std::mutex> Lock(AbbrevMutex);
   if (Abbrev)
     return Abbrev.get();
 
@@ -702,6 +709,7 @@ const DWARFDebugAbbrev *DWARFContext::getDebugAbbrev() {
 }
 
 const DWARFDebugAbbrev *DWARFContext::getDebugAbbrevDWO() {
+  std::lock_guard<std::mutex> Lock(AbbrevMutex);
   if (AbbrevDWO)
     return AbbrevDWO.get();
 
@@ -712,6 +720,7 @@ const DWARFDebugAbbrev *DWARFContext::getDebugAbbrevDWO() {
 }
 
 const DWARFDebugLoc *DWARFContext::getDebugLoc() {
+  std::lock_guard<std::mutex> Lock(LocMutex);
   if (Loc)
     return Loc.get();
 
@@ -726,6 +735,7 @@ const DWARFDebugLoc *DWARFContext::getDebugLoc() {
 }
 
 const DWARFDebugLoclists *DWARFContext::getDebugLocDWO() {
+  std::lock_guard<std::mutex> Lock(LocMutex);
   if (LocDWO)
     return LocDWO.get();
 
@@ -742,6 +752,7 @@ const DWARFDebugLoclists *DWARFContext::getDebugLocDWO() {
 }
 
 const DWARFDebugAranges *DWARFContext::getDebugAranges() {
+  std::lock_guard<std::mutex> Lock(ArangesMutex);
   if (Aranges)
     return Aranges.get();
 
@@ -750,6 +761,20 @@ const DWARFDebugAranges *DWARFContext::getDebugAranges() {
   return Aranges.get();
 }
 
+bool DWARFContext::loadArangesCache(StringRef Data) {
+  auto Cached = std::make_unique<DWARFDebugAranges>();
+  if (!Cached->deserialize(Data))
+    return false;
+  std::lock_guard<std::mutex> Lock(ArangesMutex);
+  if (!Aranges)
+    Aranges = std::move(Cached);
+  return true;
+}
+
+void DWARFContext::writeArangesCache(raw_ostream &OS) {
+  getDebugAranges()->serialize(OS);
+}
+
 const DWARFDebugFrame *DWARFContext::getDebugFrame() {
   if (DebugFrame)
     return DebugFrame.get();
@@ -844,9 +869,6 @@ DWARFContext::getLineTableForUnit(DWARFUnit *U) {
 
 Expected<const DWARFDebugLine::LineTable *> DWARFContext::getLineTableForUnit(
     DWARFUnit *U, std::function<void(Error)> RecoverableErrorCallback) {
-  if (!Line)
-    Line.reset(new DWARFDebugLine);
-
   auto UnitDIE = U->getUnitDIE();
   if (!UnitDIE)
     return nullptr;
@@ -856,22 +878,41 @@ Expected<const DWARFDebugLine::LineTable *> DWARFContext::getLineTableForUnit(
     return nullptr; // No line table for this compile unit.
 
   uint64_t stmtOffset = *Offset + U->getLineTableOffset();
-  // See if the line table is cached.
-  if (const DWARFLineTable *lt = Line->getLineTable(stmtOffset))
-    return lt;
+  // See if the line table is cached. The lock is taken only after the unit
+  // DIE has been extracted above, so that the per-unit extraction lock is
+  // never requested while LineMutex is held.
+  {
+    std::lock_guard<std::mutex> Lock(LineMutex);
+    if (!Line)
+      Line.reset(new DWARFDebugLine);
+    if (const DWARFLineTable *lt = Line->getLineTable(stmtOffset))
+      return lt;
+  }
 
   // Make sure the offset is good before we try to parse.
   if (stmtOffset >= U->getLineSection().Data.size())
     return nullptr;
 
-  // We have to parse it first.
+  // Parse outside the lock so that line tables for different units can be
+  // parsed concurrently; whichever thread publishes a table for this offset
+  // first wins, and the table is cached even if parsing reported an error so
+  // that later callers see the partial result, as getOrParseLineTable does.
   DWARFDataExtractor lineData(*DObj, U->getLineSection(), isLittleEndian(),
                               U->getAddressByteSize());
-  return Line->getOrParseLineTable(lineData, stmtOffset, *this, U,
-                                   RecoverableErrorCallback);
+  DWARFDebugLine::LineTable LT;
+  uint64_t ParseOffset = stmtOffset;
+  Error ParseErr =
+      LT.parse(lineData, &ParseOffset, *this, U, RecoverableErrorCallback);
+
+  std::lock_guard<std::mutex> Lock(LineMutex);
+  const DWARFLineTable *Result = Line->addLineTable(stmtOffset, std::move(LT));
+  if (ParseErr)
+    return std::move(ParseErr);
+  return Result;
 }
 
 void DWARFContext::parseNormalUnits() {
+  std::lock_guard<std::mutex> Lock(UnitsMutex);
   if (!NormalUnits.empty())
     return;
   DObj->forEachInfoSections([&](const DWARFSection &S) {
@@ -884,6 +925,7 @@ void DWARFContext::parseNormalUnits() {
 }
 
 void DWARFContext::parseDWOUnits(bool Lazy) {
+  std::lock_guard<std::mutex> Lock(UnitsMutex);
   if (!DWOUnits.empty())
     return;
   DObj->forEachInfoDWOSections([&](const DWARFSection &S) {
@@ -1223,6 +1265,7 @@ DWARFContext::getInliningInfoForAddress(object::SectionedAddress Address,
 
 std::shared_ptr<DWARFContext>
 DWARFContext::getDWOContext(StringRef AbsolutePath) {
+  std::lock_guard<std::mutex> Lock(DWOFilesMutex);
   if (auto S = DWP.lock()) {
     DWARFContext *Ctxt = S->Context.get();
     return std::shared_ptr<DWARFContext>(std::move(S), Ctxt);
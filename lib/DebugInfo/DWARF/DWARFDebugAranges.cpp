@@ -11,6 +11,8 @@
 #include "llvm/DebugInfo/DWARF/DWARFContext.h"
 #include "llvm/DebugInfo/DWARF/DWARFDebugArangeSet.h"
 #include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/WithColor.h"
 #include <algorithm>
 #include <cassert>
@@ -20,6 +22,13 @@
 
 using namespace llvm;
 
+/// Header of the serialized range index: an 8-byte magic, a format version
+/// and the number of entries. Each entry is the raw LowPC/Length/CUOffset
+/// triple of a Range, in little-endian byte order.
+static const char ArangesIndexMagic[8] = {'L', 'L', 'V', 'M',
+                                          'A', 'R', 'N', 'G'};
+static const uint32_t ArangesIndexVersion = 1;
+
 void DWARFDebugAranges::extract(DataExtractor DebugArangesData) {
   if (!DebugArangesData.isValidOffset(0))
     return;
@@ -113,6 +122,52 @@ void DWARFDebugAranges::construct() {
   Endpoints.shrink_to_fit();
 }
 
+void DWARFDebugAranges::serialize(raw_ostream &OS) const {
+  assert(Endpoints.empty() && "serializing an unconstructed range index");
+  OS.write(ArangesIndexMagic, sizeof(ArangesIndexMagic));
+  support::endian::Writer W(OS, support::little);
+  W.write<uint32_t>(ArangesIndexVersion);
+  W.write<uint64_t>(Aranges.size());
+  for (const Range &R : Aranges) {
+    W.write<uint64_t>(R.LowPC);
+    W.write<uint32_t>(R.Length);
+    W.write<uint32_t>(R.CUOffset);
+  }
+}
+
+bool DWARFDebugAranges::deserialize(StringRef Data) {
+  const size_t HeaderSize = sizeof(ArangesIndexMagic) + 4 + 8;
+  const size_t EntrySize = 8 + 4 + 4;
+  if (Data.size() < HeaderSize ||
+      !Data.startswith(StringRef(ArangesIndexMagic, sizeof(ArangesIndexMagic))))
+    return false;
+  const char *P = Data.data() + sizeof(ArangesIndexMagic);
+  if (support::endian::read32le(P) != ArangesIndexVersion)
+    return false;
+  uint64_t Count = support::endian::read64le(P + 4);
+  if (Data.size() != HeaderSize + Count * EntrySize)
+    return false;
+
+  clear();
+  Aranges.reserve(Count);
+  P = Data.data() + HeaderSize;
+  uint64_t PrevLowPC = 0;
+  for (uint64_t I = 0; I != Count; ++I, P += EntrySize) {
+    Range R;
+    R.LowPC = support::endian::read64le(P);
+    R.Length = support::endian::read32le(P + 8);
+    R.CUOffset = support::endian::read32le(P + 12);
+    // findAddress relies on the ranges being sorted; reject corrupt input.
+    if (I != 0 && R.LowPC < PrevLowPC) {
+      clear();
+      return false;
+    }
+    PrevLowPC = R.LowPC;
+    Aranges.push_back(R);
+  }
+  return true;
+}
+
 uint32_t DWARFDebugAranges::findAddress(uint64_t Address) const {
   RangeCollIterator It =
       partition_point(Aranges, [=](Range R) { return R.HighPC() <= Address; });
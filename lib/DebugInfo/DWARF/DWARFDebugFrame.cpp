@@ -312,6 +312,129 @@ void CIE::dump(raw_ostream &OS, const MCRegisterInfo *MRI, bool IsEH) const {
   OS << "\n";
 }
 
+ArrayRef<CFARow> FDE::getCFATable() const {
+  if (CFATable)
+    return *CFATable;
+  CFATable.emplace();
+  std::vector<CFARow> &Rows = *CFATable;
+
+  const uint64_t CodeAlign = LinkedCIE ? LinkedCIE->getCodeAlignmentFactor() : 1;
+  const int64_t DataAlign = LinkedCIE ? LinkedCIE->getDataAlignmentFactor() : 1;
+
+  CFARule Rule;
+  uint64_t Location = InitialLocation;
+  std::vector<CFARule> RememberedRules;
+  bool RuleChanged = false;
+
+  // Commit the rule accumulated for the current location before the location
+  // advances. Rows are only emitted when the rule actually changed, so runs
+  // of instructions that only affect register rules do not produce rows.
+  auto CommitRow = [&]() {
+    if (!RuleChanged && !Rows.empty())
+      return;
+    Rows.push_back({Location, Rule});
+    RuleChanged = false;
+  };
+
+  auto ProcessProgram = [&](const CFIProgram &P) {
+    for (const CFIProgram::Instruction &Instr : P) {
+      switch (Instr.Opcode) {
+      case DW_CFA_advance_loc:
+      case DW_CFA_advance_loc1:
+      case DW_CFA_advance_loc2:
+      case DW_CFA_advance_loc4:
+        CommitRow();
+        Location += Instr.Ops[0] * CodeAlign;
+        break;
+      case DW_CFA_set_loc:
+        CommitRow();
+        Location = Instr.Ops[0];
+        break;
+      case DW_CFA_def_cfa:
+        Rule.Kind = CFARule::RegisterPlusOffset;
+        Rule.Register = Instr.Ops[0];
+        Rule.Offset = int64_t(Instr.Ops[1]);
+        Rule.Expr.reset();
+        RuleChanged = true;
+        break;
+      case DW_CFA_def_cfa_sf:
+        Rule.Kind = CFARule::RegisterPlusOffset;
+        Rule.Register = Instr.Ops[0];
+        Rule.Offset = int64_t(Instr.Ops[1]) * DataAlign;
+        Rule.Expr.reset();
+        RuleChanged = true;
+        break;
+      case DW_CFA_def_cfa_register:
+        Rule.Kind = CFARule::RegisterPlusOffset;
+        Rule.Register = Instr.Ops[0];
+        Rule.Expr.reset();
+        RuleChanged = true;
+        break;
+      case DW_CFA_def_cfa_offset:
+        Rule.Kind = CFARule::RegisterPlusOffset;
+        Rule.Offset = int64_t(Instr.Ops[0]);
+        Rule.Expr.reset();
+        RuleChanged = true;
+        break;
+      case DW_CFA_def_cfa_offset_sf:
+        Rule.Kind = CFARule::RegisterPlusOffset;
+        Rule.Offset = int64_t(Instr.Ops[0]) * DataAlign;
+        Rule.Expr.reset();
+        RuleChanged = true;
+        break;
+      case DW_CFA_def_cfa_expression:
+        // Most CFA expressions are a single register + offset operation;
+        // reduce those so evaluating the rule needs no interpretation.
+        if (Instr.Expression) {
+          if (auto RegOff = Instr.Expression->getAsRegisterPlusOffset()) {
+            Rule.Kind = CFARule::RegisterPlusOffset;
+            Rule.Register = RegOff->first;
+            Rule.Offset = RegOff->second;
+            Rule.Expr.reset();
+          } else {
+            Rule.Kind = CFARule::Expression;
+            Rule.Expr = Instr.Expression;
+          }
+          RuleChanged = true;
+        }
+        break;
+      case DW_CFA_remember_state:
+        RememberedRules.push_back(Rule);
+        break;
+      case DW_CFA_restore_state:
+        if (!RememberedRules.empty()) {
+          Rule = RememberedRules.back();
+          RememberedRules.pop_back();
+          RuleChanged = true;
+        }
+        break;
+      default:
+        // All remaining instructions describe register rules, which do not
+        // affect the CFA.
+        break;
+      }
+    }
+  };
+
+  if (LinkedCIE)
+    ProcessProgram(LinkedCIE->cfis());
+  ProcessProgram(CFIs);
+  CommitRow();
+
+  return Rows;
+}
+
+Optional<CFARule> FDE::getCFARuleForAddress(uint64_t Address) const {
+  if (Address < InitialLocation || Address >= InitialLocation + AddressRange)
+    return None;
+  ArrayRef<CFARow> Rows = getCFATable();
+  auto It = partition_point(
+      Rows, [=](const CFARow &Row) { return Row.Address <= Address; });
+  if (It == Rows.begin())
+    return None;
+  return std::prev(It)->Rule;
+}
+
 void FDE::dump(raw_ostream &OS, const MCRegisterInfo *MRI, bool IsEH) const {
   OS << format("%08x %08x %08x FDE ", (uint32_t)Offset, (uint32_t)Length,
                (int32_t)LinkedCIEOffset);
@@ -528,6 +528,13 @@ Expected<const DWARFDebugLine::LineTable *> DWARFDebugLine::getOrParseLineTable(
   return LT;
 }
 
+const DWARFDebugLine::LineTable *
+DWARFDebugLine::addLineTable(uint64_t Offset, LineTable &&LT) {
+  auto Pos =
+      LineTableMap.insert(LineTableMapTy::value_type(Offset, std::move(LT)));
+  return &Pos.first->second;
+}
+
 Error DWARFDebugLine::LineTable::parse(
     DWARFDataExtractor &DebugLineData, uint64_t *OffsetPtr,
     const DWARFContext &Ctx, const DWARFUnit *U,
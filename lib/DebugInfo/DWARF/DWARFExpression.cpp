@@ -341,4 +341,34 @@ bool DWARFExpression::verify(DWARFUnit *U) {
   return true;
 }
 
+Optional<std::pair<uint64_t, int64_t>>
+DWARFExpression::getAsRegisterPlusOffset() const {
+  auto I = begin(), E = end();
+  if (I == E)
+    return None;
+  Operation &Op = *I;
+  if (Op.isError())
+    return None;
+
+  uint64_t Reg;
+  int64_t Offset;
+  uint8_t Opcode = Op.getCode();
+  if (Opcode >= DW_OP_breg0 && Opcode <= DW_OP_breg31) {
+    Reg = Opcode - DW_OP_breg0;
+    Offset = static_cast<int64_t>(Op.getRawOperand(0));
+  } else if (Opcode == DW_OP_bregx) {
+    Reg = Op.getRawOperand(0);
+    Offset = static_cast<int64_t>(Op.getRawOperand(1));
+  } else {
+    return None;
+  }
+
+  // Any trailing operation means the register + offset value is only an
+  // intermediate result, not the value of the expression.
+  ++I;
+  if (I != E)
+    return None;
+  return std::make_pair(Reg, Offset);
+}
+
 } // namespace llvm
@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -409,6 +410,7 @@ void DWARFUnit::extractDIEsIfNeeded(bool CUDieOnly) {
 }
 
 Error DWARFUnit::tryExtractDIEsIfNeeded(bool CUDieOnly) {
+  std::lock_guard<std::recursive_mutex> Lock(ExtractionMutex);
   if ((CUDieOnly && !DieArray.empty()) ||
       DieArray.size() > 1)
     return Error::success(); // Already parsed.
@@ -495,6 +497,7 @@ Error DWARFUnit::tryExtractDIEsIfNeeded(bool CUDieOnly) {
 bool DWARFUnit::parseDWO() {
   if (IsDWO)
     return false;
+  std::lock_guard<std::recursive_mutex> Lock(ExtractionMutex);
   if (DWO.get())
     return false;
   DWARFDie UnitDie = getUnitDIE();
@@ -545,6 +548,7 @@ bool DWARFUnit::parseDWO() {
 }
 
 void DWARFUnit::clearDIEs(bool KeepCUDie) {
+  std::lock_guard<std::recursive_mutex> Lock(ExtractionMutex);
   if (DieArray.size() > (unsigned)KeepCUDie) {
     DieArray.resize((unsigned)KeepCUDie);
     DieArray.shrink_to_fit();
@@ -631,6 +635,7 @@ void DWARFUnit::updateAddressDieMap(DWARFDie Die) {
 }
 
 DWARFDie DWARFUnit::getSubroutineForAddress(uint64_t Address) {
+  std::lock_guard<std::recursive_mutex> Lock(ExtractionMutex);
   extractDIEsIfNeeded(false);
   if (AddrDieMap.empty())
     updateAddressDieMap(getUnitDIE());
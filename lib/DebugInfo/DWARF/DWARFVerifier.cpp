@@ -16,6 +16,7 @@
 #include "llvm/DebugInfo/DWARF/DWARFSection.h"
 #include "llvm/Support/DJB.h"
 #include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/WithColor.h"
 #include "llvm/Support/raw_ostream.h"
 #include <map>
@@ -282,6 +283,7 @@ unsigned DWARFVerifier::verifyUnitSection(const DWARFSection &S,
   bool hasDIE = DebugInfoData.isValidOffset(Offset);
   DWARFUnitVector TypeUnitVector;
   DWARFUnitVector CompileUnitVector;
+  SmallVector<DWARFUnit *, 8> UnitsToVerify;
   while (hasDIE) {
     OffsetStart = Offset;
     if (!verifyUnitHeader(DebugInfoData, &Offset, UnitIdx, UnitType,
@@ -320,11 +322,12 @@ unsigned DWARFVerifier::verifyUnitSection(const DWARFSection &S,
       }
       default: { llvm_unreachable("Invalid UnitType."); }
       }
-      NumDebugInfoErrors += verifyUnitContents(*Unit);
+      UnitsToVerify.push_back(Unit);
     }
     hasDIE = DebugInfoData.isValidOffset(Offset);
     ++UnitIdx;
   }
+  NumDebugInfoErrors += verifyUnits(UnitsToVerify);
   if (UnitIdx == 0 && !hasDIE) {
     warn() << "Section is empty.\n";
     isHeaderChainValid = true;
@@ -335,6 +338,47 @@ unsigned DWARFVerifier::verifyUnitSection(const DWARFSection &S,
   return NumDebugInfoErrors;
 }
 
+unsigned DWARFVerifier::verifyUnits(ArrayRef<DWARFUnit *> Units) {
+  // With a single unit there is nothing to overlap, so avoid the cost of
+  // buffering the diagnostics.
+  if (Units.size() < 2) {
+    unsigned NumErrors = 0;
+    for (DWARFUnit *Unit : Units)
+      NumErrors += verifyUnitContents(*Unit);
+    return NumErrors;
+  }
+
+  // Verify the units in parallel. Each unit gets its own verifier writing to
+  // a string buffer so that diagnostics from different units do not
+  // interleave; the buffers are emitted in unit order once all tasks finish,
+  // and the references each sub-verifier collected are merged so that
+  // verifyDebugInfoReferences sees them all.
+  std::vector<std::string> UnitOutputs(Units.size());
+  std::vector<unsigned> UnitErrors(Units.size(), 0);
+  std::vector<std::map<uint64_t, std::set<uint64_t>>> UnitRefs(Units.size());
+  ThreadPool Pool;
+  for (size_t I = 0, E = Units.size(); I != E; ++I) {
+    Pool.async([&, I] {
+      raw_string_ostream StringStream(UnitOutputs[I]);
+      DWARFVerifier UnitVerifier(StringStream, DCtx, DumpOpts);
+      UnitErrors[I] = UnitVerifier.verifyUnitContents(*Units[I]);
+      StringStream.flush();
+      UnitRefs[I] = std::move(UnitVerifier.ReferenceToDIEOffsets);
+    });
+  }
+  Pool.wait();
+
+  unsigned NumErrors = 0;
+  for (size_t I = 0, E = Units.size(); I != E; ++I) {
+    OS << UnitOutputs[I];
+    NumErrors += UnitErrors[I];
+    for (const auto &KV : UnitRefs[I])
+      ReferenceToDIEOffsets[KV.first].insert(KV.second.begin(),
+                                             KV.second.end());
+  }
+  return NumErrors;
+}
+
 bool DWARFVerifier::handleDebugInfo() {
   const DWARFObject &DObj = DCtx.getDWARFObj();
   unsigned NumErrors = 0;
@@ -0,0 +1,76 @@
+//===- DwarfTransformer.cpp -----------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/DebugInfo/GSYM/DwarfTransformer.h"
+#include "llvm/DebugInfo/DIContext.h"
+#include "llvm/DebugInfo/DWARF/DWARFContext.h"
+#include "llvm/DebugInfo/GSYM/FunctionInfo.h"
+#include "llvm/DebugInfo/GSYM/GsymCreator.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+using namespace gsym;
+
+void DwarfTransformer::handleDie(DWARFUnit &CU,
+                                 const DWARFDebugLine::LineTable *LT,
+                                 DWARFDie Die) {
+  if (Die.getTag() == dwarf::DW_TAG_subprogram) {
+    uint64_t LowPC, HighPC, SectionIndex;
+    if (Die.getLowAndHighPC(LowPC, HighPC, SectionIndex) && HighPC > LowPC) {
+      // Prefer the mangled name since consumers can demangle on their own.
+      const char *Name = Die.getSubroutineName(DINameKind::LinkageName);
+      if (!Name)
+        Name = Die.getSubroutineName(DINameKind::ShortName);
+      if (Name) {
+        FunctionInfo FI(LowPC, HighPC - LowPC, Gsym.insertString(Name));
+        if (LT) {
+          std::vector<uint32_t> RowIndexes;
+          if (LT->lookupAddressRange({LowPC, SectionIndex}, HighPC - LowPC,
+                                     RowIndexes)) {
+            gsym::LineTable FuncLines;
+            for (uint32_t RowIndex : RowIndexes) {
+              const DWARFDebugLine::Row &Row = LT->Rows[RowIndex];
+              if (Row.EndSequence)
+                continue;
+              std::string Path;
+              if (!LT->getFileNameByIndex(
+                      Row.File, CU.getCompilationDir(),
+                      DILineInfoSpecifier::FileLineInfoKind::AbsoluteFilePath,
+                      Path)) {
+                Log << "warning: cannot get the path for file index "
+                    << Row.File << ", line entry will be skipped.\n";
+                continue;
+              }
+              FuncLines.push(LineEntry(Row.Address.Address,
+                                       Gsym.insertFile(Path), Row.Line));
+            }
+            if (!FuncLines.empty())
+              FI.OptLineTable = std::move(FuncLines);
+          }
+        }
+        Gsym.addFunctionInfo(std::move(FI));
+      }
+    }
+  }
+  for (DWARFDie Child : Die.children())
+    handleDie(CU, LT, Child);
+}
+
+Error DwarfTransformer::convert() {
+  for (const auto &CU : DICtx.compile_units()) {
+    DWARFDie CUDie = CU->getUnitDIE(/*ExtractUnitDIEOnly=*/false);
+    if (!CUDie)
+      continue;
+    // A missing or corrupt line table degrades the output to address and
+    // name only, it is not a reason to fail the whole conversion.
+    const DWARFDebugLine::LineTable *LT =
+        DICtx.getLineTableForUnit(CU.get());
+    handleDie(*CU, LT, CUDie);
+  }
+  return Error::success();
+}
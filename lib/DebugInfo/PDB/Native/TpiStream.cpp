@@ -157,6 +157,21 @@ void TpiStream::buildHashMap() {
   }
 }
 
+ArrayRef<GloballyHashedType>
+TpiStream::getGlobalHashes(ArrayRef<GloballyHashedType> TypeHashes) {
+  if (GlobalHashes.empty() && getNumTypeRecords() > 0) {
+    // Hashing is inherently sequential within a stream because each record's
+    // hash folds in the hashes of the records it refers back to, so all we
+    // can do is a single bulk pass.  Different streams can be hashed on
+    // different threads, TPI before IPI.
+    if (TypeHashes.empty())
+      GlobalHashes = GloballyHashedType::hashTypes(TypeRecords);
+    else
+      GlobalHashes = GloballyHashedType::hashIds(TypeRecords, TypeHashes);
+  }
+  return GlobalHashes;
+}
+
 std::vector<TypeIndex> TpiStream::findRecordsByName(StringRef Name) const {
   if (!supportsTypeLookup())
     const_cast<TpiStream*>(this)->buildHashMap();
@@ -15,6 +15,7 @@
 #include "SymbolizableObjectFile.h"
 
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/BinaryFormat/COFF.h"
 #include "llvm/DebugInfo/DWARF/DWARFContext.h"
 #include "llvm/DebugInfo/PDB/PDB.h"
@@ -31,6 +32,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
 #include <cstring>
@@ -422,6 +424,38 @@ LLVMSymbolizer::createModuleInfo(const ObjectFile *Obj,
   return InsertResult.first->second.get();
 }
 
+// Best-effort sidecar cache for the DWARF address-range index. The cache is
+// used only if it is at least as new as the binary; failure to read or write
+// it simply falls back to building the index from debug info, and a cache
+// that cannot be written completely is removed.
+static void loadOrWriteArangesCache(DWARFContext &DICtx,
+                                    StringRef BinaryPath) {
+  SmallString<256> CachePath(BinaryPath);
+  CachePath += ".aranges-cache";
+
+  sys::fs::file_status BinStat, CacheStat;
+  if (!sys::fs::status(BinaryPath, BinStat) &&
+      !sys::fs::status(CachePath, CacheStat) &&
+      BinStat.getLastModificationTime() <=
+          CacheStat.getLastModificationTime()) {
+    if (auto BufOrErr = MemoryBuffer::getFile(CachePath))
+      if (DICtx.loadArangesCache((*BufOrErr)->getBuffer()))
+        return;
+  }
+
+  // No usable cache: build the index now and write it for the next run.
+  std::error_code EC;
+  raw_fd_ostream OS(CachePath, EC, sys::fs::OF_None);
+  if (EC)
+    return;
+  DICtx.writeArangesCache(OS);
+  OS.close();
+  if (OS.has_error()) {
+    OS.clear_error();
+    sys::fs::remove(CachePath);
+  }
+}
+
 Expected<SymbolizableModule *>
 LLVMSymbolizer::getOrCreateModuleInfo(const std::string &ModuleName) {
   auto I = Modules.find(ModuleName);
@@ -466,10 +500,14 @@ LLVMSymbolizer::getOrCreateModuleInfo(const std::string &ModuleName) {
       Context.reset(new PDBContext(*CoffObject, std::move(Session)));
     }
   }
-  if (!Context)
-    Context =
+  if (!Context) {
+    std::unique_ptr<DWARFContext> DICtx =
         DWARFContext::create(*Objects.second, nullptr,
                              DWARFContext::defaultErrorHandler, Opts.DWPName);
+    if (Opts.UseArangesCache)
+      loadOrWriteArangesCache(*DICtx, Objects.second->getFileName());
+    Context = std::move(DICtx);
+  }
   return createModuleInfo(Objects.first, std::move(Context), ModuleName);
 }
 
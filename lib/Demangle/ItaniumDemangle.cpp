@@ -365,6 +365,46 @@ char *llvm::itaniumDemangle(const char *MangledName, char *Buf,
   return InternalStatus == demangle_success ? Buf : nullptr;
 }
 
+size_t llvm::itaniumDemangleBatch(const char *const *MangledNames,
+                                  size_t NumNames,
+                                  std::vector<std::string> &Demangled) {
+  Demangled.reserve(Demangled.size() + NumNames);
+
+  // One parser and one output buffer serve the whole batch: reset() recycles
+  // the arena's inline block, and the output buffer only ever grows.
+  Demangler Parser(nullptr, nullptr);
+  char *Buf = nullptr;
+  size_t BufSize = 0;
+  size_t NumDemangled = 0;
+
+  for (size_t I = 0; I != NumNames; ++I) {
+    const char *Name = MangledNames[I];
+    if (Name == nullptr) {
+      Demangled.emplace_back();
+      continue;
+    }
+
+    Parser.reset(Name, Name + std::strlen(Name));
+    Node *AST = Parser.parse();
+    OutputStream S;
+    if (AST == nullptr || !initializeOutputStream(Buf, &BufSize, S, 1024)) {
+      // Pass names that do not demangle through verbatim, like llvm::demangle.
+      Demangled.emplace_back(Name);
+      continue;
+    }
+
+    assert(Parser.ForwardTemplateRefs.empty());
+    AST->print(S);
+    Demangled.emplace_back(S.getBuffer(), S.getCurrentPosition());
+    Buf = S.getBuffer();
+    BufSize = S.getBufferCapacity();
+    ++NumDemangled;
+  }
+
+  std::free(Buf);
+  return NumDemangled;
+}
+
 ItaniumPartialDemangler::ItaniumPartialDemangler()
     : RootNode(nullptr), Context(new Demangler{nullptr, nullptr}) {}
 
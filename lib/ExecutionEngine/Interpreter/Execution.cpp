@@ -1168,6 +1168,13 @@ void Interpreter::visitCallSite(CallSite CS) {
     ArgVals.push_back(getOperandValue(V, SF));
   }
 
+  // Direct calls need no callee operand evaluation; the target is the
+  // Function itself.
+  if (F) {
+    callFunction(F, ArgVals);
+    return;
+  }
+
   // To handle indirect calls, we must get the pointer value from the argument
   // and treat it as a function pointer.
   GenericValue SRC = getOperandValue(SF.Caller.getCalledValue(), SF);
@@ -2102,10 +2109,23 @@ GenericValue Interpreter::getConstantExprValue (ConstantExpr *CE,
 }
 
 GenericValue Interpreter::getOperandValue(Value *V, ExecutionContext &SF) {
-  if (ConstantExpr *CE = dyn_cast<ConstantExpr>(V)) {
-    return getConstantExprValue(CE, SF);
-  } else if (Constant *CPV = dyn_cast<Constant>(V)) {
-    return getConstantValue(CPV);
+  if (Constant *CPV = dyn_cast<Constant>(V)) {
+    // Constant operands (including constant expressions and global
+    // addresses) evaluate to the same value for the whole execution, but
+    // re-evaluating them on every visit is expensive: constant expressions
+    // are interpreted recursively and globals go through pointer lookup.
+    // Resolve each one once and serve repeat executions from the cache.
+    auto It = CachedConstantValues.find(CPV);
+    if (It != CachedConstantValues.end())
+      return It->second;
+
+    GenericValue Result;
+    if (ConstantExpr *CE = dyn_cast<ConstantExpr>(CPV))
+      Result = getConstantExprValue(CE, SF);
+    else
+      Result = getConstantValue(CPV);
+    CachedConstantValues[CPV] = Result;
+    return Result;
   } else if (GlobalValue *GV = dyn_cast<GlobalValue>(V)) {
     return PTOGV(getPointerToGlobal(GV));
   } else {
@@ -15,6 +15,8 @@
 
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ExecutionEngine/JITLink/JITLink.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
 
 #define DEBUG_TYPE "jitlink"
 
@@ -148,6 +150,11 @@ private:
   copyAndFixUpBlocks(const SegmentLayoutMap &Layout,
                      JITLinkMemoryManager::Allocation &Alloc) const override {
     LLVM_DEBUG(dbgs() << "Copying and fixing up blocks:\n");
+
+    // Pass 1: assign every content block its destination in working memory.
+    // The running-pointer walk below is inherently serial, so it also writes
+    // the zero padding between blocks while it is at it.
+    std::vector<std::pair<Block *, char *>> BlockDests;
     for (auto &KV : Layout) {
       auto &Prot = KV.first;
       auto &SegLayout = KV.second;
@@ -188,30 +195,7 @@ private:
         while (LastBlockEnd != BlockDataPtr)
           *LastBlockEnd++ = 0;
 
-        // Copy initial block content.
-        LLVM_DEBUG({
-          dbgs() << "      Copying block " << *B << " content, "
-                 << B->getContent().size() << " bytes, from "
-                 << (const void *)B->getContent().data() << " to "
-                 << (const void *)BlockDataPtr << "\n";
-        });
-        memcpy(BlockDataPtr, B->getContent().data(), B->getContent().size());
-
-        // Copy Block data and apply fixups.
-        LLVM_DEBUG(dbgs() << "      Applying fixups.\n");
-        for (auto &E : B->edges()) {
-
-          // Skip non-relocation edges.
-          if (!E.isRelocation())
-            continue;
-
-          // Dispatch to LinkerImpl for fixup.
-          if (auto Err = impl().applyFixup(*B, E, BlockDataPtr))
-            return Err;
-        }
-
-        // Point the block's content to the fixed up buffer.
-        B->setContent(StringRef(BlockDataPtr, B->getContent().size()));
+        BlockDests.push_back(std::make_pair(B, BlockDataPtr));
 
         // Update block end pointer.
         LastBlockEnd = BlockDataPtr + B->getContent().size();
@@ -228,7 +212,72 @@ private:
         *LastBlockEnd++ = 0;
     }
 
-    return Error::success();
+    // Pass 2: copy block content and apply fixups. Each block writes only
+    // its own destination range and fixups read addresses assigned during
+    // layout (never other blocks' content), so blocks can be processed
+    // independently.
+    auto CopyAndFixUp = [this](Block *B, char *BlockDataPtr) -> Error {
+      // Copy initial block content.
+      LLVM_DEBUG({
+        dbgs() << "      Copying block " << *B << " content, "
+               << B->getContent().size() << " bytes, from "
+               << (const void *)B->getContent().data() << " to "
+               << (const void *)BlockDataPtr << "\n";
+      });
+      memcpy(BlockDataPtr, B->getContent().data(), B->getContent().size());
+
+      // Copy Block data and apply fixups.
+      LLVM_DEBUG(dbgs() << "      Applying fixups.\n");
+      for (auto &E : B->edges()) {
+
+        // Skip non-relocation edges.
+        if (!E.isRelocation())
+          continue;
+
+        // Dispatch to LinkerImpl for fixup.
+        if (auto Err = impl().applyFixup(*B, E, BlockDataPtr))
+          return Err;
+      }
+
+      // Point the block's content to the fixed up buffer.
+      B->setContent(StringRef(BlockDataPtr, B->getContent().size()));
+      return Error::success();
+    };
+
+    // Small graphs are not worth a thread pool.
+    constexpr size_t ParallelFixUpThreshold = 128;
+    if (BlockDests.size() < ParallelFixUpThreshold) {
+      for (auto &BD : BlockDests)
+        if (auto Err = CopyAndFixUp(BD.first, BD.second))
+          return Err;
+      return Error::success();
+    }
+
+    ThreadPool Pool;
+    size_t NumChunks = std::max(1u, hardware_concurrency());
+    size_t ChunkSize = (BlockDests.size() + NumChunks - 1) / NumChunks;
+    std::vector<Error> ChunkErrs;
+    ChunkErrs.reserve(NumChunks);
+    for (size_t C = 0; C != NumChunks; ++C)
+      ChunkErrs.push_back(Error::success());
+    for (size_t C = 0; C != NumChunks; ++C) {
+      Pool.async([&, C] {
+        Error Err = Error::success();
+        for (size_t I = C * ChunkSize,
+                    E = std::min(BlockDests.size(), (C + 1) * ChunkSize);
+             I != E; ++I) {
+          if ((Err = CopyAndFixUp(BlockDests[I].first, BlockDests[I].second)))
+            break;
+        }
+        ChunkErrs[C] = std::move(Err);
+      });
+    }
+    Pool.wait();
+
+    Error Err = Error::success();
+    for (auto &CE : ChunkErrs)
+      Err = joinErrors(std::move(Err), std::move(CE));
+    return Err;
   }
 };
 
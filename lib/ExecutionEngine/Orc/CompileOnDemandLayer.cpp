@@ -208,28 +208,54 @@ void CompileOnDemandLayer::expandPartition(GlobalValueSet &Partition) {
   // (1) If any alias is in the partition, its aliasee is also in the partition.
   // (2) If any aliasee is in the partition, its aliases are also in the
   //     partiton.
-  // (3) If any global variable is in the partition then all global variables
-  //     are in the partition.
+  // (3) If any global variable is in the partition then so is every global
+  //     variable transitively referenced by its initializer.
   assert(!Partition.empty() && "Unexpected empty partition");
 
   const Module &M = *(*Partition.begin())->getParent();
-  bool ContainsGlobalVariables = false;
   std::vector<const GlobalValue *> GVsToAdd;
 
+  // Global variables referenced from the partition's initializers are pulled
+  // in by walking their constant operand trees. Globals (and functions) that
+  // are referenced but not pulled in are emitted as external declarations
+  // and materialized from the implementation dylib on demand, just like
+  // callees, so extracting one global no longer drags the module's entire
+  // data segment into the partition.
+  SmallVector<const Constant *, 16> ConstantWorklist;
+  DenseSet<const Constant *> VisitedConstants;
+  auto AddInitializer = [&](const GlobalVariable &G) {
+    if (G.hasInitializer() &&
+        VisitedConstants.insert(G.getInitializer()).second)
+      ConstantWorklist.push_back(G.getInitializer());
+  };
+
   for (auto *GV : Partition)
     if (isa<GlobalAlias>(GV))
       GVsToAdd.push_back(
           cast<GlobalValue>(cast<GlobalAlias>(GV)->getAliasee()));
-    else if (isa<GlobalVariable>(GV))
-      ContainsGlobalVariables = true;
+    else if (auto *G = dyn_cast<GlobalVariable>(GV))
+      AddInitializer(*G);
 
   for (auto &A : M.aliases())
     if (Partition.count(cast<GlobalValue>(A.getAliasee())))
       GVsToAdd.push_back(&A);
 
-  if (ContainsGlobalVariables)
-    for (auto &G : M.globals())
-      GVsToAdd.push_back(&G);
+  while (!ConstantWorklist.empty()) {
+    const Constant *C = ConstantWorklist.pop_back_val();
+    if (auto *G = dyn_cast<GlobalVariable>(C)) {
+      GVsToAdd.push_back(G);
+      AddInitializer(*G);
+      continue;
+    }
+    // Functions and aliases referenced by address stay behind as
+    // declarations; only constant expression trees are walked further.
+    if (isa<GlobalValue>(C))
+      continue;
+    for (const Use &U : C->operands())
+      if (auto *Op = dyn_cast<Constant>(U.get()))
+        if (VisitedConstants.insert(Op).second)
+          ConstantWorklist.push_back(Op);
+  }
 
   for (auto *GV : GVsToAdd)
     Partition.insert(GV);
@@ -0,0 +1,169 @@
+//===--------- OrcV2CBindings.cpp - C bindings OrcV2 APIs -----------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm-c/Orc.h"
+#include "llvm/ExecutionEngine/Orc/Core.h"
+#include "llvm/ExecutionEngine/Orc/LLJIT.h"
+#include "llvm/IR/Mangler.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/CBindingWrapping.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+using namespace llvm::orc;
+
+DEFINE_SIMPLE_CONVERSION_FUNCTIONS(ExecutionSession,
+                                   LLVMOrcExecutionSessionRef)
+DEFINE_SIMPLE_CONVERSION_FUNCTIONS(JITDylib, LLVMOrcJITDylibRef)
+DEFINE_SIMPLE_CONVERSION_FUNCTIONS(ThreadSafeContext,
+                                   LLVMOrcThreadSafeContextRef)
+DEFINE_SIMPLE_CONVERSION_FUNCTIONS(ThreadSafeModule, LLVMOrcThreadSafeModuleRef)
+DEFINE_SIMPLE_CONVERSION_FUNCTIONS(MaterializationUnit,
+                                   LLVMOrcMaterializationUnitRef)
+DEFINE_SIMPLE_CONVERSION_FUNCTIONS(LLJIT, LLVMOrcLLJITRef)
+
+// LLJIT's own mangle member is not exposed; apply the same global-prefix
+// mangling against the instance's data layout.
+static std::string mangle(LLJIT &J, StringRef UnmangledName) {
+  std::string MangledName;
+  {
+    raw_string_ostream MangledNameStream(MangledName);
+    Mangler::getNameWithPrefix(MangledNameStream, UnmangledName,
+                               J.getDataLayout());
+  }
+  return MangledName;
+}
+
+LLVMOrcThreadSafeContextRef LLVMOrcCreateNewThreadSafeContext(void) {
+  return wrap(new ThreadSafeContext(std::make_unique<LLVMContext>()));
+}
+
+LLVMContextRef
+LLVMOrcThreadSafeContextGetContext(LLVMOrcThreadSafeContextRef TSCtx) {
+  return wrap(unwrap(TSCtx)->getContext());
+}
+
+void LLVMOrcDisposeThreadSafeContext(LLVMOrcThreadSafeContextRef TSCtx) {
+  delete unwrap(TSCtx);
+}
+
+LLVMOrcThreadSafeModuleRef
+LLVMOrcCreateNewThreadSafeModule(LLVMModuleRef M,
+                                 LLVMOrcThreadSafeContextRef TSCtx) {
+  return wrap(
+      new ThreadSafeModule(std::unique_ptr<Module>(unwrap(M)), *unwrap(TSCtx)));
+}
+
+void LLVMOrcDisposeThreadSafeModule(LLVMOrcThreadSafeModuleRef TSM) {
+  delete unwrap(TSM);
+}
+
+LLVMErrorRef LLVMOrcCreateLLJIT(LLVMOrcLLJITRef *Result,
+                                unsigned NumCompileThreads) {
+  auto J = LLJITBuilder().setNumCompileThreads(NumCompileThreads).create();
+  if (!J) {
+    *Result = nullptr;
+    return wrap(J.takeError());
+  }
+
+  *Result = wrap(J->release());
+  return LLVMErrorSuccess;
+}
+
+LLVMErrorRef LLVMOrcDisposeLLJIT(LLVMOrcLLJITRef J) {
+  delete unwrap(J);
+  return LLVMErrorSuccess;
+}
+
+LLVMOrcExecutionSessionRef LLVMOrcLLJITGetExecutionSession(LLVMOrcLLJITRef J) {
+  return wrap(&unwrap(J)->getExecutionSession());
+}
+
+LLVMOrcJITDylibRef LLVMOrcLLJITGetMainJITDylib(LLVMOrcLLJITRef J) {
+  return wrap(&unwrap(J)->getMainJITDylib());
+}
+
+LLVMErrorRef LLVMOrcLLJITAddLLVMIRModule(LLVMOrcLLJITRef J,
+                                         LLVMOrcJITDylibRef JD,
+                                         LLVMOrcThreadSafeModuleRef TSM) {
+  if (Error Err = unwrap(J)->addIRModule(*unwrap(JD), std::move(*unwrap(TSM))))
+    return wrap(std::move(Err));
+  delete unwrap(TSM);
+  return LLVMErrorSuccess;
+}
+
+LLVMErrorRef LLVMOrcLLJITLookup(LLVMOrcLLJITRef J,
+                                LLVMOrcJITTargetAddress *Result,
+                                const char *Name) {
+  auto Sym = unwrap(J)->lookup(Name);
+  if (!Sym) {
+    *Result = 0;
+    return wrap(Sym.takeError());
+  }
+
+  *Result = Sym->getAddress();
+  return LLVMErrorSuccess;
+}
+
+void LLVMOrcLLJITLookupAsync(LLVMOrcLLJITRef J, const char *Name,
+                             LLVMOrcLookupResultFn NotifyComplete, void *Ctx) {
+  LLJIT &Jit = *unwrap(J);
+  auto &ES = Jit.getExecutionSession();
+  SymbolStringPtr MangledName = ES.intern(mangle(Jit, Name));
+
+  ES.lookup(JITDylibSearchList({{&Jit.getMainJITDylib(), true}}),
+            SymbolNameSet({MangledName}), SymbolState::Ready,
+            [NotifyComplete, Ctx, MangledName](Expected<SymbolMap> Result) {
+              if (!Result) {
+                NotifyComplete(wrap(Result.takeError()), 0, Ctx);
+                return;
+              }
+              NotifyComplete(LLVMErrorSuccess,
+                             (*Result)[MangledName].getAddress(), Ctx);
+            },
+            NoDependenciesToRegister);
+}
+
+LLVMErrorRef LLVMOrcLLJITDefineAbsoluteSymbols(
+    LLVMOrcLLJITRef J, LLVMOrcJITDylibRef JD, const char **Names,
+    const LLVMOrcJITTargetAddress *Addrs, size_t NumSymbols) {
+  LLJIT &Jit = *unwrap(J);
+  auto &ES = Jit.getExecutionSession();
+
+  SymbolMap Symbols;
+  for (size_t I = 0; I != NumSymbols; ++I)
+    Symbols[ES.intern(mangle(Jit, Names[I]))] =
+        JITEvaluatedSymbol(Addrs[I], JITSymbolFlags::Exported);
+
+  return wrap(unwrap(JD)->define(absoluteSymbols(std::move(Symbols))));
+}
+
+void LLVMOrcExecutionSessionSetDispatchMaterialization(
+    LLVMOrcExecutionSessionRef ES, LLVMOrcDispatchMaterializationFn Dispatch,
+    void *Ctx) {
+  if (!Dispatch) {
+    unwrap(ES)->setDispatchMaterialization(
+        [](JITDylib &JD, std::unique_ptr<MaterializationUnit> MU) {
+          MU->doMaterialize(JD);
+        });
+    return;
+  }
+
+  unwrap(ES)->setDispatchMaterialization(
+      [Dispatch, Ctx](JITDylib &JD, std::unique_ptr<MaterializationUnit> MU) {
+        // Ownership of the unit passes to the C callback, which gives it
+        // back by calling LLVMOrcMaterializationUnitMaterialize.
+        Dispatch(Ctx, wrap(&JD), wrap(MU.release()));
+      });
+}
+
+void LLVMOrcMaterializationUnitMaterialize(LLVMOrcMaterializationUnitRef MU,
+                                           LLVMOrcJITDylibRef JD) {
+  std::unique_ptr<MaterializationUnit> TmpMU(unwrap(MU));
+  TmpMU->doMaterialize(*unwrap(JD));
+}
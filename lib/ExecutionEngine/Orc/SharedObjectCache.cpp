@@ -0,0 +1,106 @@
+//===- SharedObjectCache.cpp - Cross-process JIT object cache -------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ExecutionEngine/Orc/SharedObjectCache.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+using namespace llvm::orc;
+
+Expected<std::unique_ptr<SharedObjectCache>>
+SharedObjectCache::Create(StringRef CacheDirectoryPath) {
+  if (std::error_code EC = sys::fs::create_directories(CacheDirectoryPath))
+    return errorCodeToError(EC);
+  return std::unique_ptr<SharedObjectCache>(
+      new SharedObjectCache(CacheDirectoryPath.str()));
+}
+
+std::string SharedObjectCache::getEntryPath(const Module &M) {
+  SmallString<32> Key;
+  {
+    std::lock_guard<std::mutex> Lock(KeysMutex);
+    auto It = Keys.find(&M);
+    if (It != Keys.end())
+      Key = It->second;
+  }
+
+  if (Key.empty()) {
+    // Content-address the module: hash its bitcode, which covers the IR as
+    // well as the target triple and data layout.
+    SmallString<0> Bitcode;
+    {
+      raw_svector_ostream BCOS(Bitcode);
+      WriteBitcodeToFile(M, BCOS);
+    }
+    MD5 Hasher;
+    Hasher.update(Bitcode);
+    MD5::MD5Result Result;
+    Hasher.final(Result);
+    MD5::stringifyResult(Result, Key);
+
+    std::lock_guard<std::mutex> Lock(KeysMutex);
+    Keys[&M] = Key;
+  }
+
+  SmallString<128> EntryPath;
+  sys::path::append(EntryPath, CacheDirectoryPath, "orccache-" + Key + ".o");
+  return std::string(EntryPath.str());
+}
+
+void SharedObjectCache::notifyObjectCompiled(const Module *M,
+                                             MemoryBufferRef Obj) {
+  std::string EntryPath = getEntryPath(*M);
+  {
+    std::lock_guard<std::mutex> Lock(KeysMutex);
+    Keys.erase(M);
+  }
+
+  // Write to a temporary in the cache directory and rename it into place so
+  // that a concurrent reader (or a racing writer in another process) never
+  // sees a partial entry. Failing to populate the cache only costs the next
+  // process a recompile, so nothing here is fatal.
+  SmallString<128> TempFilenameModel;
+  sys::path::append(TempFilenameModel, CacheDirectoryPath,
+                    "orccache-%%%%%%.tmp.o");
+  Expected<sys::fs::TempFile> Temp = sys::fs::TempFile::create(
+      TempFilenameModel, sys::fs::owner_read | sys::fs::owner_write);
+  if (!Temp) {
+    consumeError(Temp.takeError());
+    return;
+  }
+
+  {
+    raw_fd_ostream OS(Temp->FD, /*shouldClose=*/false);
+    OS << Obj.getBuffer();
+  }
+
+  if (Error E = Temp->keep(EntryPath)) {
+    consumeError(std::move(E));
+    consumeError(Temp->discard());
+  }
+}
+
+std::unique_ptr<MemoryBuffer> SharedObjectCache::getObject(const Module *M) {
+  std::string EntryPath = getEntryPath(*M);
+  ErrorOr<std::unique_ptr<MemoryBuffer>> MBOrErr =
+      MemoryBuffer::getFile(EntryPath, /*FileSize=*/-1,
+                            /*RequiresNullTerminator=*/false);
+  if (!MBOrErr)
+    return nullptr;
+  {
+    std::lock_guard<std::mutex> Lock(KeysMutex);
+    Keys.erase(M);
+  }
+  return std::move(*MBOrErr);
+}
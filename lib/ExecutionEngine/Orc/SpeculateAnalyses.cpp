@@ -18,6 +18,8 @@
 #include "llvm/IR/PassManager.h"
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/LineIterator.h"
+#include "llvm/Support/MemoryBuffer.h"
 
 #include <algorithm>
 
@@ -303,5 +305,48 @@ SpeculateQuery::ResultTy SequenceBBQuery::operator()(Function &F) {
   return CallerAndCalles;
 }
 
+// CallOrderQuery Implementation
+
+Expected<CallOrderQuery> CallOrderQuery::load(StringRef ProfilePath,
+                                              size_t LookaheadCount) {
+  auto BufOrErr = MemoryBuffer::getFile(ProfilePath);
+  if (!BufOrErr)
+    return errorCodeToError(BufOrErr.getError());
+
+  auto P = std::make_shared<Profile>();
+  for (line_iterator LI(**BufOrErr, /*SkipBlanks=*/true, '#'); !LI.is_at_eof();
+       ++LI) {
+    StringRef Name = LI->trim();
+    if (Name.empty())
+      continue;
+    // Only the first call of a function is interesting; repeated entries
+    // would make every later occurrence shadow the recorded order.
+    if (P->Position.try_emplace(Name, P->Sequence.size()).second)
+      P->Sequence.push_back(Name.str());
+  }
+
+  return CallOrderQuery(std::move(P), LookaheadCount);
+}
+
+SpeculateQuery::ResultTy CallOrderQuery::operator()(Function &F) {
+  auto It = P->Position.find(F.getName());
+  if (It == P->Position.end())
+    return None;
+
+  DenseSet<StringRef> Candidates;
+  for (size_t I = It->second + 1,
+              E = std::min(It->second + 1 + LookaheadCount,
+                           P->Sequence.size());
+       I != E; ++I)
+    Candidates.insert(P->Sequence[I]);
+
+  if (Candidates.empty())
+    return None;
+
+  DenseMap<StringRef, DenseSet<StringRef>> CallerAndCalles;
+  CallerAndCalles.insert({F.getName(), std::move(Candidates)});
+  return CallerAndCalles;
+}
+
 } // namespace orc
 } // namespace llvm
@@ -15,22 +15,29 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/BinaryFormat/Dwarf.h"
 #include "llvm/Config/config.h"
 #include "llvm/DebugInfo/DWARF/DWARFContext.h"
+#include "llvm/DebugInfo/DWARF/DWARFDebugFrame.h"
 #include "llvm/ExecutionEngine/JITEventListener.h"
 #include "llvm/Object/ObjectFile.h"
 #include "llvm/Object/SymbolSize.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Errno.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Mutex.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
 #include "llvm/Support/Threading.h"
 #include "llvm/Support/raw_ostream.h"
+#include <atomic>
 #include <mutex>
+#include <vector>
 
 #include <sys/mman.h>  // mmap()
 #include <sys/types.h> // getpid()
@@ -75,9 +82,15 @@ private:
   void CloseMarker();
   static bool FillMachine(LLVMPerfJitHeader &hdr);
 
+  // The Notify* helpers append records to Buf, which is local to the
+  // notifying thread; notifyObjectLoaded() writes the whole buffer to the
+  // dump file with a single locked stream operation.
   void NotifyCode(Expected<llvm::StringRef> &Symbol, uint64_t CodeAddr,
-                  uint64_t CodeSize);
-  void NotifyDebug(uint64_t CodeAddr, DILineInfoTable Lines);
+                  uint64_t CodeSize, SmallVectorImpl<char> &Buf);
+  void NotifyDebug(uint64_t CodeAddr, DILineInfoTable Lines,
+                   SmallVectorImpl<char> &Buf);
+  void NotifyUnwinding(const ObjectFile &Obj, DWARFContext &DwCtx,
+                       SmallVectorImpl<char> &Buf);
 
   // cache lookups
   pid_t Pid;
@@ -101,7 +114,7 @@ private:
   bool SuccessfullyInitialized = false;
 
   // identifier for functions, primarily to identify when moving them around
-  uint64_t CodeGeneration = 1;
+  std::atomic<uint64_t> CodeGeneration{1};
 };
 
 // The following are POD struct definitions from the perf jit specification
@@ -110,8 +123,8 @@ enum LLVMPerfJitRecordType {
   JIT_CODE_LOAD = 0,
   JIT_CODE_MOVE = 1, // not emitted, code isn't moved
   JIT_CODE_DEBUG_INFO = 2,
-  JIT_CODE_CLOSE = 3,          // not emitted, unnecessary
-  JIT_CODE_UNWINDING_INFO = 4, // not emitted
+  JIT_CODE_CLOSE = 3, // not emitted, unnecessary
+  JIT_CODE_UNWINDING_INFO = 4,
 
   JIT_CODE_MAX
 };
@@ -160,6 +173,23 @@ struct LLVMPerfJitRecordDebugInfo {
   // followed by NrEntry LLVMPerfJitDebugEntry records
 };
 
+struct LLVMPerfJitRecordUnwindingInfo {
+  LLVMPerfJitRecordPrefix Prefix;
+
+  uint64_t UnwindingSize;
+  uint64_t EHFrameHdrSize;
+  uint64_t MappedSize;
+  // followed by UnwindingSize bytes of unwinding data: the raw .eh_frame
+  // section with the eh_frame header in the last EHFrameHdrSize bytes
+};
+
+// append raw bytes to a record buffer
+static inline void AppendRaw(SmallVectorImpl<char> &Buf, const void *Data,
+                             size_t Size) {
+  Buf.append(reinterpret_cast<const char *>(Data),
+             reinterpret_cast<const char *>(Data) + Size);
+}
+
 static inline uint64_t timespec_to_ns(const struct timespec *ts) {
   const uint64_t NanoSecPerSec = 1000000000;
   return ((uint64_t)ts->tv_sec * NanoSecPerSec) + ts->tv_nsec;
@@ -237,7 +267,17 @@ void PerfJITEventListener::notifyObjectLoaded(
   const ObjectFile &DebugObj = *DebugObjOwner.getBinary();
 
   // Get the address of the object image for use as a unique identifier
-  std::unique_ptr<DIContext> Context = DWARFContext::create(DebugObj);
+  std::unique_ptr<DWARFContext> Context = DWARFContext::create(DebugObj);
+
+  // Records for the whole object are staged in a buffer private to this
+  // thread and written out with a single locked stream operation, so
+  // concurrent loads don't intersperse and we take the lock once per object
+  // rather than once per record.
+  SmallVector<char, 0> Buffer;
+
+  // Unwinding info applies to all functions in the object and has to come
+  // before the corresponding code loads.
+  NotifyUnwinding(DebugObj, *Context, Buffer);
 
   // Use symbol info to iterate over functions in the object.
   for (const std::pair<SymbolRef, uint64_t> &P : computeSymbolSizes(DebugObj)) {
@@ -279,10 +319,14 @@ void PerfJITEventListener::notifyObjectLoaded(
     DILineInfoTable Lines = Context->getLineInfoForAddressRange(
         {*AddrOrErr, SectionIndex}, Size, FileLineInfoKind::AbsoluteFilePath);
 
-    NotifyDebug(*AddrOrErr, Lines);
-    NotifyCode(Name, *AddrOrErr, Size);
+    NotifyDebug(*AddrOrErr, Lines, Buffer);
+    NotifyCode(Name, *AddrOrErr, Size, Buffer);
   }
 
+  // avoid interspersing output
+  std::lock_guard<sys::Mutex> Guard(Mutex);
+
+  Dumpstream->write(Buffer.data(), Buffer.size());
   Dumpstream->flush();
 }
 
@@ -399,7 +443,8 @@ bool PerfJITEventListener::FillMachine(LLVMPerfJitHeader &hdr) {
 }
 
 void PerfJITEventListener::NotifyCode(Expected<llvm::StringRef> &Symbol,
-                                      uint64_t CodeAddr, uint64_t CodeSize) {
+                                      uint64_t CodeAddr, uint64_t CodeSize,
+                                      SmallVectorImpl<char> &Buf) {
   assert(SuccessfullyInitialized);
 
   // 0 length functions can't have samples.
@@ -418,19 +463,15 @@ void PerfJITEventListener::NotifyCode(Expected<llvm::StringRef> &Symbol,
   rec.CodeAddr = CodeAddr;
   rec.Pid = Pid;
   rec.Tid = get_threadid();
+  rec.CodeIndex = CodeGeneration++;
 
-  // avoid interspersing output
-  std::lock_guard<sys::Mutex> Guard(Mutex);
-
-  rec.CodeIndex = CodeGeneration++; // under lock!
-
-  Dumpstream->write(reinterpret_cast<const char *>(&rec), sizeof(rec));
-  Dumpstream->write(Symbol->data(), Symbol->size() + 1);
-  Dumpstream->write(reinterpret_cast<const char *>(CodeAddr), CodeSize);
+  AppendRaw(Buf, &rec, sizeof(rec));
+  AppendRaw(Buf, Symbol->data(), Symbol->size() + 1);
+  AppendRaw(Buf, reinterpret_cast<const char *>(CodeAddr), CodeSize);
 }
 
-void PerfJITEventListener::NotifyDebug(uint64_t CodeAddr,
-                                       DILineInfoTable Lines) {
+void PerfJITEventListener::NotifyDebug(uint64_t CodeAddr, DILineInfoTable Lines,
+                                       SmallVectorImpl<char> &Buf) {
   assert(SuccessfullyInitialized);
 
   // Didn't get useful debug info.
@@ -461,10 +502,7 @@ void PerfJITEventListener::NotifyDebug(uint64_t CodeAddr,
   // * uint32_t discrim  : column discriminator, 0 is default
   // * char name[n]      : source file name in ASCII, including null termination
 
-  // avoid interspersing output
-  std::lock_guard<sys::Mutex> Guard(Mutex);
-
-  Dumpstream->write(reinterpret_cast<const char *>(&rec), sizeof(rec));
+  AppendRaw(Buf, &rec, sizeof(rec));
 
   for (DILineInfoTable::iterator It = Begin; It != End; ++It) {
     LLVMPerfJitDebugEntry LineInfo;
@@ -478,12 +516,92 @@ void PerfJITEventListener::NotifyDebug(uint64_t CodeAddr,
     LineInfo.Lineno = Line.Line;
     LineInfo.Discrim = Line.Discriminator;
 
-    Dumpstream->write(reinterpret_cast<const char *>(&LineInfo),
-                      sizeof(LineInfo));
-    Dumpstream->write(Line.FileName.c_str(), Line.FileName.size() + 1);
+    AppendRaw(Buf, &LineInfo, sizeof(LineInfo));
+    AppendRaw(Buf, Line.FileName.c_str(), Line.FileName.size() + 1);
   }
 }
 
+void PerfJITEventListener::NotifyUnwinding(const ObjectFile &Obj,
+                                           DWARFContext &DwCtx,
+                                           SmallVectorImpl<char> &Buf) {
+  assert(SuccessfullyInitialized);
+
+  // Without frame data there is nothing to hand to the unwinder.
+  StringRef EHFrame;
+  for (const SectionRef &Section : Obj.sections()) {
+    Expected<StringRef> SecNameOrErr = Section.getName();
+    if (!SecNameOrErr) {
+      consumeError(SecNameOrErr.takeError());
+      continue;
+    }
+    if (*SecNameOrErr != ".eh_frame")
+      continue;
+    Expected<StringRef> ContentsOrErr = Section.getContents();
+    if (!ContentsOrErr) {
+      consumeError(ContentsOrErr.takeError());
+      return;
+    }
+    EHFrame = *ContentsOrErr;
+    break;
+  }
+  if (EHFrame.empty())
+    return;
+
+  const DWARFDebugFrame *Frame = DwCtx.getEHFrame();
+  if (!Frame || Frame->empty())
+    return;
+  uint64_t EHFrameAddr = Frame->getEHFrameAddress();
+
+  // The binary search table of the eh_frame header, sorted by initial
+  // location as the format requires.
+  std::vector<std::pair<uint64_t, uint64_t>> Table;
+  for (const dwarf::FrameEntry &Entry : Frame->entries())
+    if (const auto *F = dyn_cast<dwarf::FDE>(&Entry))
+      Table.push_back({F->getInitialLocation(), EHFrameAddr + F->getOffset()});
+  llvm::sort(Table);
+
+  // Synthesize an eh_frame header. Absolute 8-byte encodings are used for the
+  // frame pointer and the table because perf decides where the header ends up
+  // in the ELF image it writes, so self-relative offsets cannot be computed
+  // here.
+  const uint8_t HdrPreamble[4] = {
+      /*version*/ 1,
+      /*eh_frame_ptr_enc*/ dwarf::DW_EH_PE_absptr | dwarf::DW_EH_PE_udata8,
+      /*fde_count_enc*/ dwarf::DW_EH_PE_absptr | dwarf::DW_EH_PE_udata4,
+      /*table_enc*/ dwarf::DW_EH_PE_absptr | dwarf::DW_EH_PE_udata8};
+  uint32_t FDECount = Table.size();
+
+  SmallVector<char, 128> Hdr;
+  AppendRaw(Hdr, HdrPreamble, sizeof(HdrPreamble));
+  AppendRaw(Hdr, &EHFrameAddr, sizeof(EHFrameAddr));
+  AppendRaw(Hdr, &FDECount, sizeof(FDECount));
+  for (const std::pair<uint64_t, uint64_t> &Ent : Table) {
+    AppendRaw(Hdr, &Ent.first, sizeof(Ent.first));
+    AppendRaw(Hdr, &Ent.second, sizeof(Ent.second));
+  }
+
+  LLVMPerfJitRecordUnwindingInfo rec;
+  rec.UnwindingSize = EHFrame.size() + Hdr.size();
+  rec.EHFrameHdrSize = Hdr.size();
+  // The frame data mirrors what is mapped in this process; the synthesized
+  // header is accounted for by perf when it rewrites the image.
+  rec.MappedSize = rec.UnwindingSize;
+
+  // pad the record so the next one stays 8-byte aligned
+  uint64_t Padding = alignTo(rec.UnwindingSize, 8) - rec.UnwindingSize;
+
+  rec.Prefix.Id = JIT_CODE_UNWINDING_INFO;
+  rec.Prefix.TotalSize = sizeof(rec) + rec.UnwindingSize + Padding;
+  rec.Prefix.Timestamp = perf_get_timestamp();
+
+  AppendRaw(Buf, &rec, sizeof(rec));
+  AppendRaw(Buf, EHFrame.data(), EHFrame.size());
+  AppendRaw(Buf, Hdr.data(), Hdr.size());
+
+  const char Zeros[8] = {};
+  AppendRaw(Buf, Zeros, Padding);
+}
+
 // There should be only a single event listener per process, otherwise perf gets
 // confused.
 llvm::ManagedStatic<PerfJITEventListener> PerfListener;
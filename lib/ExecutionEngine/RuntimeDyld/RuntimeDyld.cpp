@@ -646,26 +646,37 @@ unsigned RuntimeDyldImpl::computeSectionStubBufSize(const ObjectFile &Obj,
   if (StubSize == 0) {
     return 0;
   }
-  // FIXME: this is an inefficient way to handle this. We should computed the
-  // necessary section allocation size in loadObject by walking all the sections
-  // once.
-  unsigned StubBufSize = 0;
-  for (section_iterator SI = Obj.section_begin(), SE = Obj.section_end();
-       SI != SE; ++SI) {
 
-    Expected<section_iterator> RelSecOrErr = SI->getRelocatedSection();
-    if (!RelSecOrErr)
-      report_fatal_error(toString(RelSecOrErr.takeError()));
+  // Walk the object's relocation sections once, attributing stub space to
+  // the section each of them relocates, and reuse the result for the other
+  // sections of the same object. This sizes every section's stub area
+  // exactly before any section memory is allocated, and avoids rescanning
+  // every relocation section once per loaded section.
+  if (StubBufSizesObj != &Obj) {
+    StubBufSizes.clear();
+    for (section_iterator SI = Obj.section_begin(), SE = Obj.section_end();
+         SI != SE; ++SI) {
 
-    section_iterator RelSecI = *RelSecOrErr;
-    if (!(RelSecI == Section))
-      continue;
+      Expected<section_iterator> RelSecOrErr = SI->getRelocatedSection();
+      if (!RelSecOrErr)
+        report_fatal_error(toString(RelSecOrErr.takeError()));
 
-    for (const RelocationRef &Reloc : SI->relocations())
-      if (relocationNeedsStub(Reloc))
-        StubBufSize += StubSize;
+      section_iterator RelSecI = *RelSecOrErr;
+      if (RelSecI == Obj.section_end())
+        continue;
+
+      unsigned NumStubs = 0;
+      for (const RelocationRef &Reloc : SI->relocations())
+        if (relocationNeedsStub(Reloc))
+          ++NumStubs;
+      if (NumStubs != 0)
+        StubBufSizes[RelSecI->getIndex()] += NumStubs * StubSize;
+    }
+    StubBufSizesObj = &Obj;
   }
 
+  unsigned StubBufSize = StubBufSizes.lookup(Section.getIndex());
+
   // Get section data size and alignment
   uint64_t DataSize = Section.getSize();
   uint64_t Alignment64 = Section.getAlignment();
@@ -931,6 +931,52 @@ void RuntimeDyldELF::resolveRelocation(const RelocationEntry &RE,
                            RE.SymOffset, RE.SectionID);
 }
 
+void RuntimeDyldELF::resolveRelocationList(const RelocationList &Relocs,
+                                           uint64_t Value) {
+  // Relocation lists are applied in one tight per-architecture loop; this
+  // hoists the virtual call and the architecture switch that the generic
+  // per-entry path pays for every relocation.
+  switch (Arch) {
+  case Triple::x86_64:
+    for (const RelocationEntry &RE : Relocs) {
+      const SectionEntry &Section = Sections[RE.SectionID];
+      if (Section.getAddress() == nullptr)
+        continue;
+      resolveX86_64Relocation(Section, RE.Offset, Value, RE.RelType, RE.Addend,
+                              RE.SymOffset);
+    }
+    break;
+  case Triple::aarch64:
+  case Triple::aarch64_be:
+    for (const RelocationEntry &RE : Relocs) {
+      const SectionEntry &Section = Sections[RE.SectionID];
+      if (Section.getAddress() == nullptr)
+        continue;
+      resolveAArch64Relocation(Section, RE.Offset, Value, RE.RelType,
+                               RE.Addend);
+    }
+    break;
+  case Triple::arm: // Fall through.
+  case Triple::armeb:
+  case Triple::thumb:
+  case Triple::thumbeb:
+    for (const RelocationEntry &RE : Relocs) {
+      const SectionEntry &Section = Sections[RE.SectionID];
+      if (Section.getAddress() == nullptr)
+        continue;
+      resolveARMRelocation(Section, RE.Offset,
+                           (uint32_t)(Value & 0xffffffffL), RE.RelType,
+                           (uint32_t)(RE.Addend & 0xffffffffL));
+    }
+    break;
+  default:
+    // The remaining architectures (including the MIPS subclass, which
+    // overrides resolveRelocation) take the generic per-entry path.
+    RuntimeDyldImpl::resolveRelocationList(Relocs, Value);
+    break;
+  }
+}
+
 void RuntimeDyldELF::resolveRelocation(const SectionEntry &Section,
                                        uint64_t Offset, uint64_t Value,
                                        uint32_t Type, int64_t Addend,
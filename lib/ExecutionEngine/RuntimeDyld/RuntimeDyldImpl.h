@@ -13,6 +13,7 @@
 #ifndef LLVM_LIB_EXECUTIONENGINE_RUNTIMEDYLD_RUNTIMEDYLDIMPL_H
 #define LLVM_LIB_EXECUTIONENGINE_RUNTIMEDYLD_RUNTIMEDYLDIMPL_H
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/Triple.h"
@@ -407,8 +408,11 @@ protected:
   /// \return Pointer to the memory area for emitting target address.
   uint8_t *createStubFunction(uint8_t *Addr, unsigned AbiVariant = 0);
 
-  /// Resolves relocations from Relocs list with address from Value.
-  void resolveRelocationList(const RelocationList &Relocs, uint64_t Value);
+  /// Resolves relocations from Relocs list with address from Value. Targets
+  /// may override this to batch the list instead of dispatching through
+  /// resolveRelocation for every entry.
+  virtual void resolveRelocationList(const RelocationList &Relocs,
+                                     uint64_t Value);
 
   /// A object file specific relocation resolver
   /// \param RE The relocation to be resolved
@@ -444,6 +448,12 @@ protected:
   unsigned computeSectionStubBufSize(const ObjectFile &Obj,
                                      const SectionRef &Section);
 
+  // Per-section stub buffer sizes for the object currently being loaded,
+  // built by computeSectionStubBufSize in a single pass over the object's
+  // relocation sections and keyed by section index.
+  const ObjectFile *StubBufSizesObj = nullptr;
+  DenseMap<uint64_t, unsigned> StubBufSizes;
+
   // Implementation of the generic part of the loadObject algorithm.
   Expected<ObjSectionToIDMap> loadObjectImpl(const object::ObjectFile &Obj);
 
@@ -16,8 +16,15 @@
 #include "llvm/Support/MathExtras.h"
 #include "llvm/Support/Process.h"
 
+#ifdef __linux__
+#include <sys/mman.h> // madvise()
+#endif
+
 namespace llvm {
 
+// Granularity of code reservations when huge pages are requested.
+static const size_t HugePageSize = 0x200000; // 2 MiB
+
 uint8_t *SectionMemoryManager::allocateDataSection(uintptr_t Size,
                                                    unsigned Alignment,
                                                    unsigned SectionID,
@@ -91,7 +98,8 @@ uint8_t *SectionMemoryManager::allocateSection(
     }
   }
 
-  // No pre-allocated free block was large enough. Allocate a new memory region.
+  // No pre-allocated free block was large enough. Reuse a slab from the
+  // shared pool if we have one, otherwise allocate a new memory region.
   // Note that all sections get allocated as read-write.  The permissions will
   // be updated later based on memory group.
   //
@@ -100,13 +108,34 @@ uint8_t *SectionMemoryManager::allocateSection(
   //
   // FIXME: Initialize the Near member for each memory group to avoid
   // interleaving.
-  std::error_code ec;
-  sys::MemoryBlock MB = MMapper.allocateMappedMemory(
-      Purpose, RequiredSize, &MemGroup.Near,
-      sys::Memory::MF_READ | sys::Memory::MF_WRITE, ec);
-  if (ec) {
-    // FIXME: Add error propagation to the interface.
-    return nullptr;
+  sys::MemoryBlock MB;
+  if (Pool && Pool->take(RequiredSize, MB)) {
+    // Pooled slabs may still carry the permissions they were finalized with;
+    // reset them to read-write before handing memory out.
+    if (MMapper.protectMappedMemory(
+            MB, sys::Memory::MF_READ | sys::Memory::MF_WRITE)) {
+      Pool->give(MB);
+      return nullptr;
+    }
+  } else {
+    // Size code reservations in huge-page units so the kernel can back their
+    // interior with large mappings.
+    if (Purpose == AllocationPurpose::Code && UseHugeCodePages)
+      RequiredSize = alignTo(RequiredSize, HugePageSize);
+
+    std::error_code ec;
+    MB = MMapper.allocateMappedMemory(
+        Purpose, RequiredSize, &MemGroup.Near,
+        sys::Memory::MF_READ | sys::Memory::MF_WRITE, ec);
+    if (ec) {
+      // FIXME: Add error propagation to the interface.
+      return nullptr;
+    }
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (Purpose == AllocationPurpose::Code && UseHugeCodePages)
+      madvise(MB.base(), MB.allocatedSize(), MADV_HUGEPAGE);
+#endif
   }
 
   // Save this address as the basis for our next request
@@ -195,16 +224,46 @@ static sys::MemoryBlock trimBlockToPageSize(sys::MemoryBlock M) {
 std::error_code
 SectionMemoryManager::applyMemoryGroupPermissions(MemoryGroup &MemGroup,
                                                   unsigned Permissions) {
-  for (sys::MemoryBlock &MB : MemGroup.PendingMem)
+  // Batch the permission flips: coalesce the pending sub-blocks of each slab
+  // into one range covering all of them, so we issue a single protection call
+  // per slab rather than one per section.
+  SmallVector<sys::MemoryBlock, 16> Ranges;
+  for (const sys::MemoryBlock &Slab : MemGroup.AllocatedMem) {
+    uintptr_t SlabBase = (uintptr_t)Slab.base();
+    uintptr_t SlabEnd = SlabBase + Slab.allocatedSize();
+    uintptr_t Lo = SlabEnd, Hi = SlabBase;
+    for (const sys::MemoryBlock &MB : MemGroup.PendingMem) {
+      uintptr_t Base = (uintptr_t)MB.base();
+      if (Base < SlabBase || Base >= SlabEnd)
+        continue;
+      Lo = std::min(Lo, Base);
+      Hi = std::max(Hi, Base + MB.allocatedSize());
+    }
+    if (Lo < Hi)
+      Ranges.push_back(sys::MemoryBlock((void *)Lo, Hi - Lo));
+  }
+
+  for (sys::MemoryBlock &MB : Ranges)
     if (std::error_code EC = MMapper.protectMappedMemory(MB, Permissions))
       return EC;
 
   MemGroup.PendingMem.clear();
 
-  // Now go through free blocks and trim any of them that don't span the entire
-  // page because one of the pending blocks may have overlapped it.
+  // Now go through free blocks and trim away any part whose permissions were
+  // applied above: a coalesced range may have swallowed a free block that sat
+  // between two pending blocks, and pending blocks may share its edge pages.
   for (FreeMemBlock &FreeMB : MemGroup.FreeMem) {
-    FreeMB.Free = trimBlockToPageSize(FreeMB.Free);
+    uintptr_t Base = (uintptr_t)FreeMB.Free.base();
+    uintptr_t End = Base + FreeMB.Free.allocatedSize();
+    for (const sys::MemoryBlock &R : Ranges) {
+      uintptr_t RBase = (uintptr_t)R.base();
+      uintptr_t REnd = RBase + R.allocatedSize();
+      if (End <= RBase || Base >= REnd)
+        continue;
+      // Only the tail past the protected range stays usable.
+      Base = std::min(std::max(Base, REnd), End);
+    }
+    FreeMB.Free = trimBlockToPageSize(sys::MemoryBlock((void *)Base, End - Base));
     // We cleared the PendingMem list, so all these pointers are now invalid
     FreeMB.PendingPrefixIndex = (unsigned)-1;
   }
@@ -227,13 +286,40 @@ void SectionMemoryManager::invalidateInstructionCache() {
 
 SectionMemoryManager::~SectionMemoryManager() {
   for (MemoryGroup *Group : {&CodeMem, &RWDataMem, &RODataMem}) {
-    for (sys::MemoryBlock &Block : Group->AllocatedMem)
-      MMapper.releaseMappedMemory(Block);
+    for (sys::MemoryBlock &Block : Group->AllocatedMem) {
+      if (Pool)
+        Pool->give(Block);
+      else
+        MMapper.releaseMappedMemory(Block);
+    }
   }
 }
 
 SectionMemoryManager::MemoryMapper::~MemoryMapper() {}
 
+bool SectionMemoryManager::ReservationPool::take(size_t NumBytes,
+                                                 sys::MemoryBlock &Result) {
+  std::lock_guard<std::mutex> Lock(PoolMutex);
+  for (auto I = FreeSlabs.begin(), E = FreeSlabs.end(); I != E; ++I) {
+    if (I->allocatedSize() < NumBytes)
+      continue;
+    Result = *I;
+    FreeSlabs.erase(I);
+    return true;
+  }
+  return false;
+}
+
+void SectionMemoryManager::ReservationPool::give(sys::MemoryBlock MB) {
+  std::lock_guard<std::mutex> Lock(PoolMutex);
+  FreeSlabs.push_back(MB);
+}
+
+SectionMemoryManager::ReservationPool::~ReservationPool() {
+  for (sys::MemoryBlock &MB : FreeSlabs)
+    sys::Memory::releaseMappedMemory(MB);
+}
+
 void SectionMemoryManager::anchor() {}
 
 namespace {
@@ -261,7 +347,10 @@ public:
 DefaultMMapper DefaultMMapperInstance;
 } // namespace
 
-SectionMemoryManager::SectionMemoryManager(MemoryMapper *MM)
-    : MMapper(MM ? *MM : DefaultMMapperInstance) {}
+SectionMemoryManager::SectionMemoryManager(MemoryMapper *MM,
+                                           ReservationPool *Pool,
+                                           bool UseHugeCodePages)
+    : MMapper(MM ? *MM : DefaultMMapperInstance), Pool(Pool),
+      UseHugeCodePages(UseHugeCodePages) {}
 
 } // namespace llvm
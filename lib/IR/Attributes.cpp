@@ -947,6 +947,17 @@ AttributeList AttributeList::getImpl(LLVMContext &C,
   assert(!AttrSets.empty() && "pointless AttributeListImpl");
 
   LLVMContextImpl *pImpl = C.pImpl;
+
+  // Lists holding only function attributes dominate call-site creation;
+  // serve repeats of those from the flyweight cache instead of re-profiling
+  // them for the folding set.
+  AttributeListImpl **Cached = nullptr;
+  if (AttrSets.size() == 1) {
+    Cached = &pImpl->FnOnlyAttrsLists[AttrSets[0]];
+    if (*Cached)
+      return AttributeList(*Cached);
+  }
+
   FoldingSetNodeID ID;
   AttributeListImpl::Profile(ID, AttrSets);
 
@@ -964,6 +975,9 @@ AttributeList AttributeList::getImpl(LLVMContext &C,
     pImpl->AttrsLists.InsertNode(PA, InsertPoint);
   }
 
+  if (Cached)
+    *Cached = PA;
+
   // Return the AttributesList that we found or created.
   return AttributeList(PA);
 }
@@ -1476,8 +1490,21 @@ AttrBuilder &AttrBuilder::addAttribute(Attribute Attr) {
   return *this;
 }
 
+/// TargetDepAttrs is kept sorted by attribute name.
+template <typename VectorTy>
+static auto lowerBoundTD(VectorTy &Attrs, StringRef Name)
+    -> decltype(Attrs.begin()) {
+  return llvm::lower_bound(Attrs, Name,
+                           [](const AttrBuilder::td_type &Entry,
+                              StringRef Name) { return Entry.first < Name; });
+}
+
 AttrBuilder &AttrBuilder::addAttribute(StringRef A, StringRef V) {
-  TargetDepAttrs[A] = V;
+  auto I = lowerBoundTD(TargetDepAttrs, A);
+  if (I != TargetDepAttrs.end() && I->first == A)
+    I->second = V.str();
+  else
+    TargetDepAttrs.insert(I, std::make_pair(A.str(), V.str()));
   return *this;
 }
 
@@ -1507,8 +1534,8 @@ AttrBuilder &AttrBuilder::removeAttributes(AttributeList A, uint64_t Index) {
 }
 
 AttrBuilder &AttrBuilder::removeAttribute(StringRef A) {
-  auto I = TargetDepAttrs.find(A);
-  if (I != TargetDepAttrs.end())
+  auto I = lowerBoundTD(TargetDepAttrs, A);
+  if (I != TargetDepAttrs.end() && I->first == A)
     TargetDepAttrs.erase(I);
   return *this;
 }
@@ -1601,8 +1628,8 @@ AttrBuilder &AttrBuilder::merge(const AttrBuilder &B) {
 
   Attrs |= B.Attrs;
 
-  for (auto I : B.td_attrs())
-    TargetDepAttrs[I.first] = I.second;
+  for (const auto &I : B.td_attrs())
+    addAttribute(I.first, I.second);
 
   return *this;
 }
@@ -1629,8 +1656,8 @@ AttrBuilder &AttrBuilder::remove(const AttrBuilder &B) {
 
   Attrs &= ~B.Attrs;
 
-  for (auto I : B.td_attrs())
-    TargetDepAttrs.erase(I.first);
+  for (const auto &I : B.td_attrs())
+    removeAttribute(I.first);
 
   return *this;
 }
@@ -1649,7 +1676,8 @@ bool AttrBuilder::overlaps(const AttrBuilder &B) const {
 }
 
 bool AttrBuilder::contains(StringRef A) const {
-  return TargetDepAttrs.find(A) != TargetDepAttrs.end();
+  auto I = lowerBoundTD(TargetDepAttrs, A);
+  return I != TargetDepAttrs.end() && I->first == A;
 }
 
 bool AttrBuilder::hasAttributes() const {
@@ -1682,7 +1710,7 @@ bool AttrBuilder::operator==(const AttrBuilder &B) {
 
   for (td_const_iterator I = TargetDepAttrs.begin(),
          E = TargetDepAttrs.end(); I != E; ++I)
-    if (B.TargetDepAttrs.find(I->first) == B.TargetDepAttrs.end())
+    if (!B.contains(I->first))
       return false;
 
   return Alignment == B.Alignment && StackAlignment == B.StackAlignment &&
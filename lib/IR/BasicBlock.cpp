@@ -11,9 +11,11 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/IR/BasicBlock.h"
+#include "LLVMContextImpl.h"
 #include "SymbolTableListTraitsImpl.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/IR/CFG.h"
+#include "llvm/IR/CFGUpdateJournal.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
@@ -37,6 +39,16 @@ LLVMContext &BasicBlock::getContext() const {
 // are not in the public header file...
 template class llvm::SymbolTableListTraits<Instruction>;
 
+void *BasicBlock::operator new(size_t Size, LLVMContext &C) {
+  assert(Size == sizeof(BasicBlock) && "unexpected BasicBlock allocation");
+  (void)Size;
+  return C.pImpl->allocateBasicBlock();
+}
+
+void BasicBlock::operator delete(void *Ptr) {
+  LLVMContextImpl::deallocateBasicBlock(Ptr);
+}
+
 BasicBlock::BasicBlock(LLVMContext &C, const Twine &Name, Function *NewParent,
                        BasicBlock *InsertBefore)
   : Value(Type::getLabelTy(C), Value::BasicBlockVal), Parent(nullptr) {
@@ -85,6 +97,12 @@ BasicBlock::~BasicBlock() {
 }
 
 void BasicBlock::setParent(Function *parent) {
+  // Both the old and the new function change structurally.
+  if (Parent)
+    Parent->noteModification();
+  if (parent)
+    parent->noteModification();
+
   // Set Parent=parent, updating instruction symtab entries as appropriate.
   InstList.setSymTabObject(&Parent, parent);
 }
@@ -311,6 +329,14 @@ void BasicBlock::removePredecessor(BasicBlock *Pred,
           find(pred_begin(this), pred_end(this), Pred) != pred_end(this)) &&
          "removePredecessor: BB is not a predecessor!");
 
+  // Record the deletion only once Pred's terminator has really dropped the
+  // edge; when the caller redirects the terminator afterwards through
+  // Instruction::replaceSuccessorWith, that utility records it instead.
+  if (Parent)
+    if (CFGUpdateJournal *Journal = Parent->getCFGUpdateJournal())
+      if (!llvm::is_contained(successors(Pred), this))
+        Journal->recordDelete(Pred, this);
+
   if (InstList.empty()) return;
   PHINode *APN = dyn_cast<PHINode>(&front());
   if (!APN) return;   // Quick exit.
@@ -638,15 +638,28 @@ Constant *ConstantInt::getFalse(Type *Ty) {
 
 // Get a ConstantInt from an APInt.
 ConstantInt *ConstantInt::get(LLVMContext &Context, const APInt &V) {
-  // get an existing value or the insertion position
   LLVMContextImpl *pImpl = Context.pImpl;
-  std::unique_ptr<ConstantInt> &Slot = pImpl->IntConstants[V];
-  if (!Slot) {
-    // Get the corresponding integer type for the bit width of the value.
-    IntegerType *ITy = IntegerType::get(Context, V.getBitWidth());
-    Slot.reset(new ConstantInt(ITy, V));
+  auto &Shard =
+      pImpl->IntConstants.getShard(DenseMapAPIntKeyInfo::getHashValue(V));
+
+  // In the common case the constant already exists and a shared lock
+  // suffices.
+  {
+    sys::SmartScopedReader<true> Guard(Shard.Lock);
+    auto I = Shard.Map.find(V);
+    if (I != Shard.Map.end())
+      return I->second.get();
   }
-  assert(Slot->getType() == IntegerType::get(Context, V.getBitWidth()));
+
+  // Get the corresponding integer type for the bit width of the value before
+  // taking the writer lock; the type tables have their own synchronization.
+  IntegerType *ITy = IntegerType::get(Context, V.getBitWidth());
+
+  sys::SmartScopedWriter<true> Guard(Shard.Lock);
+  std::unique_ptr<ConstantInt> &Slot = Shard.Map[V];
+  if (!Slot)
+    Slot.reset(new ConstantInt(ITy, V));
+  assert(Slot->getType() == ITy);
   return Slot.get();
 }
 
@@ -810,29 +823,39 @@ Constant *ConstantFP::getZeroValueForNegation(Type *Ty) {
 // ConstantFP accessors.
 ConstantFP* ConstantFP::get(LLVMContext &Context, const APFloat& V) {
   LLVMContextImpl* pImpl = Context.pImpl;
-
-  std::unique_ptr<ConstantFP> &Slot = pImpl->FPConstants[V];
-
-  if (!Slot) {
-    Type *Ty;
-    if (&V.getSemantics() == &APFloat::IEEEhalf())
-      Ty = Type::getHalfTy(Context);
-    else if (&V.getSemantics() == &APFloat::IEEEsingle())
-      Ty = Type::getFloatTy(Context);
-    else if (&V.getSemantics() == &APFloat::IEEEdouble())
-      Ty = Type::getDoubleTy(Context);
-    else if (&V.getSemantics() == &APFloat::x87DoubleExtended())
-      Ty = Type::getX86_FP80Ty(Context);
-    else if (&V.getSemantics() == &APFloat::IEEEquad())
-      Ty = Type::getFP128Ty(Context);
-    else {
-      assert(&V.getSemantics() == &APFloat::PPCDoubleDouble() &&
-             "Unknown FP format");
-      Ty = Type::getPPC_FP128Ty(Context);
-    }
-    Slot.reset(new ConstantFP(Ty, V));
+  auto &Shard =
+      pImpl->FPConstants.getShard(DenseMapAPFloatKeyInfo::getHashValue(V));
+
+  // In the common case the constant already exists and a shared lock
+  // suffices.
+  {
+    sys::SmartScopedReader<true> Guard(Shard.Lock);
+    auto I = Shard.Map.find(V);
+    if (I != Shard.Map.end())
+      return I->second.get();
+  }
+
+  Type *Ty;
+  if (&V.getSemantics() == &APFloat::IEEEhalf())
+    Ty = Type::getHalfTy(Context);
+  else if (&V.getSemantics() == &APFloat::IEEEsingle())
+    Ty = Type::getFloatTy(Context);
+  else if (&V.getSemantics() == &APFloat::IEEEdouble())
+    Ty = Type::getDoubleTy(Context);
+  else if (&V.getSemantics() == &APFloat::x87DoubleExtended())
+    Ty = Type::getX86_FP80Ty(Context);
+  else if (&V.getSemantics() == &APFloat::IEEEquad())
+    Ty = Type::getFP128Ty(Context);
+  else {
+    assert(&V.getSemantics() == &APFloat::PPCDoubleDouble() &&
+           "Unknown FP format");
+    Ty = Type::getPPC_FP128Ty(Context);
   }
 
+  sys::SmartScopedWriter<true> Guard(Shard.Lock);
+  std::unique_ptr<ConstantFP> &Slot = Shard.Map[V];
+  if (!Slot)
+    Slot.reset(new ConstantFP(Ty, V));
   return Slot.get();
 }
 
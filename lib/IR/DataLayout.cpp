@@ -17,6 +17,7 @@
 
 #include "llvm/IR/DataLayout.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/IR/Constants.h"
@@ -28,7 +29,9 @@
 #include "llvm/IR/Value.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Mutex.h"
 #include "llvm/Support/TypeSize.h"
 #include <algorithm>
 #include <cassert>
@@ -194,6 +197,38 @@ void DataLayout::reset(StringRef Desc) {
   parseSpecifier(Desc);
 }
 
+namespace {
+
+/// Process-wide cache of parsed DataLayouts, keyed by specification string.
+struct ParsedLayoutCache {
+  sys::SmartMutex<true> Lock;
+  StringMap<std::unique_ptr<DataLayout>> Layouts;
+};
+
+} // end anonymous namespace
+
+static ManagedStatic<ParsedLayoutCache> ParsedLayouts;
+
+const DataLayout &DataLayout::get(StringRef LayoutDescription) {
+  {
+    sys::SmartScopedLock<true> Guard(ParsedLayouts->Lock);
+    auto It = ParsedLayouts->Layouts.find(LayoutDescription);
+    if (It != ParsedLayouts->Layouts.end())
+      return *It->second;
+  }
+
+  // Parse outside the lock: malformed strings call report_fatal_error, and
+  // holding the lock across parsing would serialize concurrent first-time
+  // lookups of different strings.
+  auto Parsed = std::make_unique<DataLayout>(LayoutDescription);
+
+  sys::SmartScopedLock<true> Guard(ParsedLayouts->Lock);
+  auto &Slot = ParsedLayouts->Layouts[LayoutDescription];
+  if (!Slot)
+    Slot = std::move(Parsed);
+  return *Slot;
+}
+
 /// Checked version of split, to ensure mandatory subparts.
 static std::pair<StringRef, StringRef> split(StringRef Str, char Separator) {
   assert(!Str.empty() && "parse error, string can't be empty here");
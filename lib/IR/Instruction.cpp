@@ -13,6 +13,7 @@
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/IntrinsicInst.h"
 #include "llvm/ADT/DenseSet.h"
+#include "llvm/IR/CFGUpdateJournal.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/MDBuilder.h"
@@ -49,7 +50,15 @@ Instruction::~Instruction() {
 
 
 void Instruction::setParent(BasicBlock *P) {
+  // Attaching or detaching an instruction structurally changes the enclosing
+  // function; keep its modification epoch current.
+  if (Parent)
+    if (Function *F = Parent->getParent())
+      F->noteModification();
   Parent = P;
+  if (P)
+    if (Function *F = P->getParent())
+      F->noteModification();
 }
 
 const Module *Instruction::getModule() const {
@@ -678,10 +687,27 @@ void Instruction::setSuccessor(unsigned idx, BasicBlock *B) {
 }
 
 void Instruction::replaceSuccessorWith(BasicBlock *OldBB, BasicBlock *NewBB) {
+  bool Replaced = false;
+  bool HadNewBB = false;
   for (unsigned Idx = 0, NumSuccessors = Instruction::getNumSuccessors();
-       Idx != NumSuccessors; ++Idx)
-    if (getSuccessor(Idx) == OldBB)
+       Idx != NumSuccessors; ++Idx) {
+    if (getSuccessor(Idx) == NewBB)
+      HadNewBB = true;
+    if (getSuccessor(Idx) == OldBB) {
       setSuccessor(Idx, NewBB);
+      Replaced = true;
+    }
+  }
+
+  // Only record transitions in the edge set: every occurrence of OldBB was
+  // just replaced, so Parent->OldBB is gone, but Parent->NewBB is new only if
+  // NewBB was not already a successor.
+  if (Replaced && OldBB != NewBB && Parent)
+    if (CFGUpdateJournal *Journal = getFunction()->getCFGUpdateJournal()) {
+      Journal->recordDelete(Parent, OldBB);
+      if (!HadNewBB)
+        Journal->recordInsert(Parent, NewBB);
+    }
 }
 
 Instruction *Instruction::cloneImpl() const {
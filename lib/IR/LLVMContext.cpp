@@ -309,6 +309,14 @@ void LLVMContext::setDiscardValueNames(bool Discard) {
   pImpl->DiscardValueNames = Discard;
 }
 
+bool LLVMContext::shouldDiscardConstantDataUseLists() const {
+  return pImpl->DiscardConstantDataUseLists;
+}
+
+void LLVMContext::setDiscardConstantDataUseLists(bool Discard) {
+  pImpl->DiscardConstantDataUseLists = Discard;
+}
+
 OptPassGate &LLVMContext::getOptPassGate() const {
   return pImpl->getOptPassGate();
 }
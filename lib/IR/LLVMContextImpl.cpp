@@ -141,6 +141,32 @@ LLVMContextImpl::~LLVMContextImpl() {
     delete Pair.second;
 }
 
+// Each BasicBlock allocation is prefixed with a pointer back to the owning
+// context so that deallocateBasicBlock can find the right arena from nothing
+// but the memory being freed.
+static constexpr size_t BBHeaderSize =
+    alignof(BasicBlock) > sizeof(void *) ? alignof(BasicBlock)
+                                         : sizeof(void *);
+
+void *LLVMContextImpl::allocateBasicBlock() {
+  void *Raw = BBFreeList;
+  if (Raw)
+    BBFreeList = *static_cast<void **>(Raw);
+  else
+    Raw = BBAlloc.Allocate(BBHeaderSize + sizeof(BasicBlock), BBHeaderSize);
+  *static_cast<LLVMContextImpl **>(Raw) = this;
+  return static_cast<char *>(Raw) + BBHeaderSize;
+}
+
+void LLVMContextImpl::deallocateBasicBlock(void *Mem) {
+  // Thread the storage onto the owning context's free list; the slab itself
+  // stays with the context.
+  void *Raw = static_cast<char *>(Mem) - BBHeaderSize;
+  LLVMContextImpl *Impl = *static_cast<LLVMContextImpl **>(Raw);
+  *static_cast<void **>(Raw) = Impl->BBFreeList;
+  Impl->BBFreeList = Raw;
+}
+
 void LLVMContextImpl::dropTriviallyDeadConstantArrays() {
   bool Changed;
   do {
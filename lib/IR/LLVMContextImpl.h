@@ -40,6 +40,8 @@
 #include "llvm/IR/TrackingMDRef.h"
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/Mutex.h"
+#include "llvm/Support/RWMutex.h"
 #include "llvm/Support/StringSaver.h"
 #include "llvm/Support/YAMLTraits.h"
 #include <algorithm>
@@ -1257,16 +1259,47 @@ public:
   LLVMContext::YieldCallbackTy YieldCallback = nullptr;
   void *YieldOpaqueHandle = nullptr;
 
+  /// The hot integer/FP uniquing tables are sharded by value hash, with a
+  /// reader/writer lock per shard, so threads sharing one context can unique
+  /// constants concurrently instead of needing a context per thread.
+  template <typename MapTy> struct ConstantUniquingShards {
+    static constexpr unsigned NumShards = 16;
+
+    struct Shard {
+      sys::SmartRWMutex<true> Lock;
+      MapTy Map;
+    };
+    Shard Shards[NumShards];
+
+    /// The buckets inside each DenseMap consume the low hash bits; take the
+    /// shard index from the top bits so the two do not correlate.
+    Shard &getShard(unsigned Hash) {
+      return Shards[Hash >> (32 - 4)];
+    }
+
+    void clear() {
+      for (Shard &S : Shards)
+        S.Map.clear();
+    }
+  };
+
   using IntMapTy =
       DenseMap<APInt, std::unique_ptr<ConstantInt>, DenseMapAPIntKeyInfo>;
-  IntMapTy IntConstants;
+  ConstantUniquingShards<IntMapTy> IntConstants;
 
   using FPMapTy =
       DenseMap<APFloat, std::unique_ptr<ConstantFP>, DenseMapAPFloatKeyInfo>;
-  FPMapTy FPConstants;
+  ConstantUniquingShards<FPMapTy> FPConstants;
 
   FoldingSet<AttributeImpl> AttrsSet;
   FoldingSet<AttributeListImpl> AttrsLists;
+
+  /// Flyweight cache for attribute lists that consist of nothing but one
+  /// function attribute set, the shape produced for the vast majority of
+  /// call sites (nounwind+willreturn and friends). Maps the lone set to its
+  /// uniqued list, replacing the FoldingSet profile-and-probe with a single
+  /// hash lookup. Entries alias AttrsLists and share its lifetime.
+  DenseMap<AttributeSet, AttributeListImpl *> FnOnlyAttrsLists;
   FoldingSet<AttributeSetNode> AttrsSetNodes;
 
   StringMap<MDString, BumpPtrAllocator> MDStringCache;
@@ -1324,6 +1357,18 @@ public:
   BumpPtrAllocator Alloc;
   UniqueStringSaver Saver{Alloc};
 
+  /// Arena storage for BasicBlock objects. Deleted blocks go on a free list
+  /// and are reused by later creations; the slabs themselves are reclaimed
+  /// only when the context is destroyed.
+  BumpPtrAllocator BBAlloc;
+  void *BBFreeList = nullptr;
+
+  void *allocateBasicBlock();
+  static void deallocateBasicBlock(void *Mem);
+
+  /// Guards IntegerTypes, which concurrent ConstantInt uniquing can reach
+  /// for non-built-in bit widths.
+  sys::SmartMutex<true> IntegerTypesLock;
   DenseMap<unsigned, IntegerType*> IntegerTypes;
 
   using FunctionTypeSet = DenseSet<FunctionType *, FunctionTypeKeyInfo>;
@@ -1402,6 +1447,11 @@ public:
   /// not.
   bool DiscardValueNames = false;
 
+  /// Flag to indicate that uses of ConstantData values are kept off the
+  /// constant's use-list. See
+  /// LLVMContext::setDiscardConstantDataUseLists().
+  bool DiscardConstantDataUseLists = false;
+
   LLVMContextImpl(LLVMContext &C);
   ~LLVMContextImpl();
 
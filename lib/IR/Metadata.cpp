@@ -797,6 +797,22 @@ MDNode *MDNode::uniquify() {
   }
 }
 
+void MDNode::reserveUniquingCapacity(LLVMContext &Context, unsigned MDKind,
+                                     unsigned NumNodes) {
+  switch (MDKind) {
+  default:
+    // Not a uniquable kind; there is no store to grow.
+    break;
+#define HANDLE_MDNODE_LEAF_UNIQUABLE(CLASS)                                    \
+  case CLASS##Kind: {                                                          \
+    auto &Store = Context.pImpl->CLASS##s;                                     \
+    Store.reserve(Store.size() + NumNodes);                                    \
+    break;                                                                     \
+  }
+#include "llvm/IR/Metadata.def"
+  }
+}
+
 void MDNode::eraseFromStore() {
   switch (getMetadataID()) {
   default:
@@ -361,7 +361,10 @@ void Module::addModuleFlag(MDNode *Node) {
 }
 
 void Module::setDataLayout(StringRef Desc) {
-  DL.reset(Desc);
+  // Copying from the shared parsed instance skips re-parsing the string when
+  // many modules target the same layout; the copy gives this module its own
+  // struct layout cache.
+  DL = DataLayout::get(Desc);
 }
 
 void Module::setDataLayout(const DataLayout &Other) { DL = Other; }
@@ -398,6 +401,11 @@ Error Module::materialize(GlobalValue *GV) {
   return Materializer->materialize(GV);
 }
 
+void Module::prefetchFunctions(ArrayRef<Function *> Fns) {
+  if (Materializer)
+    Materializer->prefetch(Fns);
+}
+
 Error Module::materializeAll() {
   if (!Materializer)
     return Error::success();
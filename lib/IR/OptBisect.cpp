@@ -28,6 +28,12 @@ static cl::opt<int> OptBisectLimit("opt-bisect-limit", cl::Hidden,
                                    cl::Optional,
                                    cl::desc("Maximum optimization to perform"));
 
+static cl::opt<bool> OptBisectPerUnit(
+    "opt-bisect-per-unit", cl::Hidden, cl::init(false), cl::Optional,
+    cl::desc("Assign bisect numbers from an independent deterministic stream "
+             "per IR unit instead of one global sequence, so results are "
+             "reproducible under parallel (e.g. ThinLTO) backends"));
+
 OptBisect::OptBisect() : OptPassGate() {
   BisectEnabled = OptBisectLimit != std::numeric_limits<int>::max();
 }
@@ -49,7 +55,11 @@ bool OptBisect::checkPass(const StringRef PassName,
                           const StringRef TargetDesc) {
   assert(BisectEnabled);
 
-  int CurBisectNum = ++LastBisectNum;
+  // The singleton is shared by all contexts in the process, so parallel
+  // backends end up in here concurrently.
+  sys::SmartScopedLock<true> Lock(BisectMutex);
+  int CurBisectNum =
+      OptBisectPerUnit ? ++UnitBisectNums[TargetDesc] : ++LastBisectNum;
   bool ShouldRun = (OptBisectLimit == -1 || CurBisectNum <= OptBisectLimit);
   printPassMessage(PassName, CurBisectNum, TargetDesc, ShouldRun);
   return ShouldRun;
@@ -37,6 +37,13 @@ Error RemarkStreamer::setFilter(StringRef Filter) {
   return Error::success();
 }
 
+bool RemarkStreamer::matchesFilter(StringRef Str) const {
+  if (PassFilter)
+    return PassFilter->match(Str);
+  // No filter means all strings pass.
+  return true;
+}
+
 /// DiagnosticKind -> remarks::Type
 static remarks::Type toRemarkType(enum DiagnosticKind Kind) {
   switch (Kind) {
@@ -94,9 +101,8 @@ RemarkStreamer::toRemark(const DiagnosticInfoOptimizationBase &Diag) {
 }
 
 void RemarkStreamer::emit(const DiagnosticInfoOptimizationBase &Diag) {
-  if (Optional<Regex> &Filter = PassFilter)
-    if (!Filter->match(Diag.getPassName()))
-      return;
+  if (!matchesFilter(Diag.getPassName()))
+    return;
 
   // First, convert the diagnostic to a remark.
   remarks::Remark R = toRemark(Diag);
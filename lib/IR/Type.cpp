@@ -257,6 +257,9 @@ IntegerType *IntegerType::get(LLVMContext &C, unsigned NumBits) {
     break;
   }
 
+  // Non-built-in widths go through the context's side table, which can be
+  // reached concurrently via ConstantInt uniquing.
+  sys::SmartScopedLock<true> Guard(C.pImpl->IntegerTypesLock);
   IntegerType *&Entry = C.pImpl->IntegerTypes[NumBits];
 
   if (!Entry)
@@ -395,8 +395,16 @@ static bool contains(Value *Expr, Value *V) {
 }
 #endif // NDEBUG
 
+bool Value::useListDiscarded() const {
+  assert(isa<ConstantData>(this) &&
+         "Only ConstantData use-lists may be discarded");
+  return getContext().shouldDiscardConstantDataUseLists();
+}
+
 void Value::doRAUW(Value *New, ReplaceMetadataUses ReplaceMetaUses) {
   assert(New && "Value::replaceAllUsesWith(<null>) is invalid!");
+  assert((!isa<ConstantData>(this) || !useListDiscarded()) &&
+         "Cannot RAUW a ConstantData whose use-list was discarded!");
   assert(!contains(New, this) &&
          "this->replaceAllUsesWith(expr(this)) is NOT valid!");
   assert(New->getType() == getType() &&
@@ -43,6 +43,8 @@ ValueSymbolTable::~ValueSymbolTable() {
 ValueName *ValueSymbolTable::makeUniqueName(Value *V,
                                             SmallString<256> &UniqueName) {
   unsigned BaseSize = UniqueName.size();
+  uint32_t &LastUnique =
+      UniqueSuffixes[StringRef(UniqueName.data(), BaseSize)];
   while (true) {
     // Trim any suffix off and append the next number.
     UniqueName.resize(BaseSize);
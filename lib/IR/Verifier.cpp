@@ -5128,6 +5128,31 @@ bool llvm::verifyModule(const Module &M, raw_ostream *OS,
   return Broken;
 }
 
+bool IncrementalVerifier::verifyModule(const Module &M, raw_ostream *OS) {
+  // Don't use a raw_null_ostream.  Printing IR is expensive.
+  Verifier V(OS, /*ShouldTreatBrokenDebugInfoAsError=*/true, M);
+
+  bool Broken = false;
+  for (const Function &F : M) {
+    uint64_t Epoch = F.getModificationEpoch();
+    auto It = VerifiedEpochs.find(&F);
+    if (It != VerifiedEpochs.end() && It->second == Epoch)
+      continue;
+    if (V.verify(F))
+      VerifiedEpochs[&F] = Epoch;
+    else {
+      // Keep broken functions dirty so they are re-checked next time.
+      VerifiedEpochs.erase(&F);
+      Broken = true;
+    }
+  }
+
+  // The module-level tables are cheap relative to function bodies and have
+  // no epoch; always verify them.
+  Broken |= !V.verify();
+  return Broken;
+}
+
 namespace {
 
 struct VerifierLegacyPass : public FunctionPass {
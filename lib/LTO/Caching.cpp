@@ -12,6 +12,8 @@
 
 #include "llvm/LTO/Caching.h"
 #include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/Compression.h"
+#include "llvm/Support/Endian.h"
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
@@ -27,11 +29,43 @@
 using namespace llvm;
 using namespace llvm::lto;
 
+// Compressed cache entries start with this magic followed by the
+// little-endian uncompressed size, then the zlib stream. Entries without the
+// magic are plain objects, so compressed and uncompressed entries can share
+// a cache directory.
+static const char CacheCompressionMagic[4] = {'L', 'L', 'C', 'Z'};
+static const size_t CacheCompressionHeaderSize =
+    sizeof(CacheCompressionMagic) + sizeof(uint64_t);
+
+/// If \p MB holds a compressed cache entry, replace it with the uncompressed
+/// contents; plain entries are passed through untouched.
+static std::unique_ptr<MemoryBuffer>
+decompressCacheEntry(std::unique_ptr<MemoryBuffer> MB, StringRef EntryPath) {
+  StringRef Buf = MB->getBuffer();
+  if (Buf.size() < CacheCompressionHeaderSize ||
+      Buf.substr(0, sizeof(CacheCompressionMagic)) !=
+          StringRef(CacheCompressionMagic, sizeof(CacheCompressionMagic)))
+    return MB;
+  uint64_t UncompressedSize = support::endian::read64le(
+      Buf.data() + sizeof(CacheCompressionMagic));
+  SmallString<0> Uncompressed;
+  if (Error E = zlib::uncompress(Buf.substr(CacheCompressionHeaderSize),
+                                 Uncompressed, UncompressedSize))
+    report_fatal_error(Twine("Failed to decompress cache file ") + EntryPath +
+                       ": " + toString(std::move(E)) + "\n");
+  return MemoryBuffer::getMemBufferCopy(Uncompressed, EntryPath);
+}
+
 Expected<NativeObjectCache> lto::localCache(StringRef CacheDirectoryPath,
-                                            AddBufferFn AddBuffer) {
+                                            AddBufferFn AddBuffer,
+                                            bool Compress) {
   if (std::error_code EC = sys::fs::create_directories(CacheDirectoryPath))
     return errorCodeToError(EC);
 
+  // Silently fall back to uncompressed entries when zlib is not built in.
+  if (!zlib::isAvailable())
+    Compress = false;
+
   return [=](unsigned Task, StringRef Key) -> AddStreamFn {
     // This choice of file name allows the cache to be pruned (see pruneCache()
     // in include/llvm/Support/CachePruning.h).
@@ -49,7 +83,7 @@ Expected<NativeObjectCache> lto::localCache(StringRef CacheDirectoryPath,
                                     /*RequiresNullTerminator=*/false);
       sys::fs::closeFile(*FDOrErr);
       if (MBOrErr) {
-        AddBuffer(Task, std::move(*MBOrErr));
+        AddBuffer(Task, decompressCacheEntry(std::move(*MBOrErr), EntryPath));
         return AddStreamFn();
       }
       EC = MBOrErr.getError();
@@ -74,13 +108,14 @@ Expected<NativeObjectCache> lto::localCache(StringRef CacheDirectoryPath,
       sys::fs::TempFile TempFile;
       std::string EntryPath;
       unsigned Task;
+      bool Compress;
 
       CacheStream(std::unique_ptr<raw_pwrite_stream> OS, AddBufferFn AddBuffer,
                   sys::fs::TempFile TempFile, std::string EntryPath,
-                  unsigned Task)
+                  unsigned Task, bool Compress)
           : NativeObjectStream(std::move(OS)), AddBuffer(std::move(AddBuffer)),
             TempFile(std::move(TempFile)), EntryPath(std::move(EntryPath)),
-            Task(Task) {}
+            Task(Task), Compress(Compress) {}
 
       ~CacheStream() {
         // Make sure the stream is closed before committing it.
@@ -96,6 +131,47 @@ Expected<NativeObjectCache> lto::localCache(StringRef CacheDirectoryPath,
                              TempFile.TmpName + ": " +
                              MBOrErr.getError().message() + "\n");
 
+        if (Compress) {
+          // Commit a compressed copy of the object as the cache entry and
+          // hand the uncompressed bytes to the link. Failing to populate the
+          // cache only loses the entry, so it is not fatal.
+          StringRef Object = (*MBOrErr)->getBuffer();
+          SmallString<0> Compressed;
+          if (Error E = zlib::compressParallel(Object, Compressed)) {
+            consumeError(std::move(E));
+          } else {
+            SmallString<64> TempFilenameModel;
+            sys::path::append(TempFilenameModel,
+                              sys::path::parent_path(EntryPath),
+                              "Thin-%%%%%%.tmp.oz");
+            Expected<sys::fs::TempFile> CompressedTemp =
+                sys::fs::TempFile::create(TempFilenameModel,
+                                          sys::fs::owner_read |
+                                              sys::fs::owner_write);
+            if (CompressedTemp) {
+              {
+                raw_fd_ostream CompressedOS(CompressedTemp->FD,
+                                            /*shouldClose=*/false);
+                char SizeBytes[sizeof(uint64_t)];
+                support::endian::write64le(SizeBytes, Object.size());
+                CompressedOS.write(CacheCompressionMagic,
+                                   sizeof(CacheCompressionMagic));
+                CompressedOS.write(SizeBytes, sizeof(SizeBytes));
+                CompressedOS << Compressed;
+              }
+              if (Error E = CompressedTemp->keep(EntryPath)) {
+                consumeError(std::move(E));
+                consumeError(CompressedTemp->discard());
+              }
+            } else {
+              consumeError(CompressedTemp.takeError());
+            }
+          }
+          AddBuffer(Task, MemoryBuffer::getMemBufferCopy(Object, EntryPath));
+          consumeError(TempFile.discard());
+          return;
+        }
+
         // On POSIX systems, this will atomically replace the destination if
         // it already exists. We try to emulate this on Windows, but this may
         // fail with a permission denied error (for example, if the destination
@@ -144,7 +220,7 @@ Expected<NativeObjectCache> lto::localCache(StringRef CacheDirectoryPath,
       // This CacheStream will move the temporary file into the cache when done.
       return std::make_unique<CacheStream>(
           std::make_unique<raw_fd_ostream>(Temp->FD, /* ShouldClose */ false),
-          AddBuffer, std::move(*Temp), EntryPath.str(), Task);
+          AddBuffer, std::move(*Temp), EntryPath.str(), Task, Compress);
     };
   };
 }
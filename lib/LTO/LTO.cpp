@@ -65,6 +65,40 @@ cl::opt<bool> EnableLTOInternalization(
     "enable-lto-internalization", cl::init(true), cl::Hidden,
     cl::desc("Enable global value internalization in LTO"));
 
+static cl::opt<std::string> ForceInternalizeSymbolsFile(
+    "lto-force-internalize-symbols-file", cl::Hidden,
+    cl::value_desc("filename"),
+    cl::desc("File listing symbol names (one per line, '#' comments) to "
+             "internalize even if the symbol resolution marks them as "
+             "exported"));
+
+// Lazily read -lto-force-internalize-symbols-file into a GUID set. The usual
+// internalization safety checks (interposable non-prevailing copies,
+// appending or available_externally linkage) still apply to listed symbols.
+static const DenseSet<GlobalValue::GUID> &getForceInternalizeGUIDs() {
+  static const DenseSet<GlobalValue::GUID> GUIDs = [] {
+    DenseSet<GlobalValue::GUID> Set;
+    if (ForceInternalizeSymbolsFile.empty())
+      return Set;
+    ErrorOr<std::unique_ptr<MemoryBuffer>> BufferOrErr =
+        MemoryBuffer::getFile(ForceInternalizeSymbolsFile);
+    if (!BufferOrErr)
+      report_fatal_error(Twine("Failed to open symbol file ") +
+                         ForceInternalizeSymbolsFile + ": " +
+                         BufferOrErr.getError().message());
+    SmallVector<StringRef, 32> Lines;
+    (*BufferOrErr)->getBuffer().split(Lines, '\n');
+    for (StringRef Line : Lines) {
+      Line = Line.trim();
+      if (Line.empty() || Line.startswith("#"))
+        continue;
+      Set.insert(GlobalValue::getGUID(Line));
+    }
+    return Set;
+  }();
+  return GUIDs;
+}
+
 // Computes a unique hash for the Module considering the current list of
 // export/import and other global analysis results.
 // The hash is produced in \p Key.
@@ -75,7 +109,8 @@ void llvm::computeLTOCacheKey(
     const std::map<GlobalValue::GUID, GlobalValue::LinkageTypes> &ResolvedODR,
     const GVSummaryMapTy &DefinedGlobals,
     const std::set<GlobalValue::GUID> &CfiFunctionDefs,
-    const std::set<GlobalValue::GUID> &CfiFunctionDecls) {
+    const std::set<GlobalValue::GUID> &CfiFunctionDecls,
+    bool SkipCodeGenOptions) {
   // Compute the unique hash for this entry.
   // This is based on the current compiler version, the module itself, the
   // export list, the hash for every single module in the import list, the
@@ -114,14 +149,22 @@ void llvm::computeLTOCacheKey(
     Hasher.update(ArrayRef<uint8_t>{Data, 8});
   };
   AddString(Conf.CPU);
-  // FIXME: Hash more of Options. For now all clients initialize Options from
-  // command-line flags (which is unsupported in production), but may set
-  // RelaxELFRelocations. The clang driver can also pass FunctionSections,
-  // DataSections and DebuggerTuning via command line flags.
-  AddUnsigned(Conf.Options.RelaxELFRelocations);
-  AddUnsigned(Conf.Options.FunctionSections);
-  AddUnsigned(Conf.Options.DataSections);
-  AddUnsigned((unsigned)Conf.Options.DebuggerTuning);
+  // The following configuration is only consumed by the final code generation
+  // step; the CPU, attributes, relocation/code models and optimization levels
+  // above/below are kept in both keys since the mid-level optimizations query
+  // the target machine as well. Excluding the codegen-only pieces yields a
+  // key that identifies the post-import optimized IR, so backend-only
+  // configuration changes can still reuse the IR-stage cache.
+  if (!SkipCodeGenOptions) {
+    // FIXME: Hash more of Options. For now all clients initialize Options from
+    // command-line flags (which is unsupported in production), but may set
+    // RelaxELFRelocations. The clang driver can also pass FunctionSections,
+    // DataSections and DebuggerTuning via command line flags.
+    AddUnsigned(Conf.Options.RelaxELFRelocations);
+    AddUnsigned(Conf.Options.FunctionSections);
+    AddUnsigned(Conf.Options.DataSections);
+    AddUnsigned((unsigned)Conf.Options.DebuggerTuning);
+  }
   for (auto &A : Conf.MAttrs)
     AddString(A);
   if (Conf.RelocModel)
@@ -133,7 +176,8 @@ void llvm::computeLTOCacheKey(
   else
     AddUnsigned(-1);
   AddUnsigned(Conf.CGOptLevel);
-  AddUnsigned(Conf.CGFileType);
+  if (!SkipCodeGenOptions)
+    AddUnsigned(Conf.CGFileType);
   AddUnsigned(Conf.OptLevel);
   AddUnsigned(Conf.UseNewPM);
   AddUnsigned(Conf.Freestanding);
@@ -141,7 +185,8 @@ void llvm::computeLTOCacheKey(
   AddString(Conf.AAPipeline);
   AddString(Conf.OverrideTriple);
   AddString(Conf.DefaultTriple);
-  AddString(Conf.DwoDir);
+  if (!SkipCodeGenOptions)
+    AddString(Conf.DwoDir);
 
   // Include the hash for the current module
   auto ModHash = Index.getModuleHash(ModuleID);
@@ -387,8 +432,9 @@ static void thinLTOInternalizeAndPromoteGUID(
     function_ref<bool(StringRef, GlobalValue::GUID)> isExported,
     function_ref<bool(GlobalValue::GUID, const GlobalValueSummary *)>
         isPrevailing) {
+  bool ForceInternalize = getForceInternalizeGUIDs().count(GUID);
   for (auto &S : GVSummaryList) {
-    if (isExported(S->modulePath(), GUID)) {
+    if (!ForceInternalize && isExported(S->modulePath(), GUID)) {
       if (GlobalValue::isLocalLinkage(S->linkage()))
         S->setLinkage(GlobalValue::ExternalLinkage);
     } else if (EnableLTOInternalization &&
@@ -1083,6 +1129,21 @@ public:
       const std::map<GlobalValue::GUID, GlobalValue::LinkageTypes> &ResolvedODR,
       const GVSummaryMapTy &DefinedGlobals,
       MapVector<StringRef, BitcodeModule> &ModuleMap) {
+    auto ModuleID = BM.getModuleIdentifier();
+
+    // When an IR-stage cache is configured, hand thinBackend a key that
+    // excludes the codegen-only parts of the configuration, so that the
+    // post-import optimized IR can be reused across backend-only changes.
+    SmallString<40> IRKey;
+    if (!Conf.IRCacheDir.empty() &&
+        CombinedIndex.modulePaths().count(ModuleID) &&
+        !all_of(CombinedIndex.getModuleHash(ModuleID),
+                [](uint32_t V) { return V == 0; }))
+      computeLTOCacheKey(IRKey, Conf, CombinedIndex, ModuleID, ImportList,
+                         ExportList, ResolvedODR, DefinedGlobals,
+                         CfiFunctionDefs, CfiFunctionDecls,
+                         /*SkipCodeGenOptions=*/true);
+
     auto RunThinBackend = [&](AddStreamFn AddStream) {
       LTOLLVMContext BackendContext(Conf);
       Expected<std::unique_ptr<Module>> MOrErr = BM.parseModule(BackendContext);
@@ -1090,11 +1151,9 @@ public:
         return MOrErr.takeError();
 
       return thinBackend(Conf, Task, AddStream, **MOrErr, CombinedIndex,
-                         ImportList, DefinedGlobals, ModuleMap);
+                         ImportList, DefinedGlobals, ModuleMap, IRKey);
     };
 
-    auto ModuleID = BM.getModuleIdentifier();
-
     if (!Cache || !CombinedIndex.modulePaths().count(ModuleID) ||
         all_of(CombinedIndex.getModuleHash(ModuleID),
                [](uint32_t V) { return V == 0; }))
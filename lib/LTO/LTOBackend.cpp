@@ -482,7 +482,8 @@ Error lto::thinBackend(Config &Conf, unsigned Task, AddStreamFn AddStream,
                        Module &Mod, const ModuleSummaryIndex &CombinedIndex,
                        const FunctionImporter::ImportMapTy &ImportList,
                        const GVSummaryMapTy &DefinedGlobals,
-                       MapVector<StringRef, BitcodeModule> &ModuleMap) {
+                       MapVector<StringRef, BitcodeModule> &ModuleMap,
+                       StringRef IRCacheKey) {
   Expected<const Target *> TOrErr = initAndLookupTarget(Conf, Mod);
   if (!TOrErr)
     return TOrErr.takeError();
@@ -505,6 +506,27 @@ Error lto::thinBackend(Config &Conf, unsigned Task, AddStreamFn AddStream,
   if (Conf.PreOptModuleHook && !Conf.PreOptModuleHook(Task, Mod))
     return finalizeOptimizationRemarks(std::move(DiagnosticOutputFile));
 
+  // Second cache level: check for previously imported and optimized IR. On a
+  // hit the whole import and optimization pipeline is skipped and code
+  // generation runs on the cached module.
+  SmallString<128> IRCacheEntryPath;
+  if (!Conf.IRCacheDir.empty() && !IRCacheKey.empty()) {
+    sys::path::append(IRCacheEntryPath, Conf.IRCacheDir,
+                      "llvmcache-" + IRCacheKey);
+    ErrorOr<std::unique_ptr<MemoryBuffer>> MBOrErr =
+        MemoryBuffer::getFile(IRCacheEntryPath);
+    if (MBOrErr) {
+      Expected<std::unique_ptr<Module>> OptModOrErr =
+          parseBitcodeFile((*MBOrErr)->getMemBufferRef(), Mod.getContext());
+      if (OptModOrErr) {
+        codegen(Conf, TM.get(), AddStream, Task, **OptModOrErr);
+        return finalizeOptimizationRemarks(std::move(DiagnosticOutputFile));
+      }
+      // Treat a corrupt entry like a miss and regenerate it below.
+      consumeError(OptModOrErr.takeError());
+    }
+  }
+
   renameModuleForThinLTO(Mod, CombinedIndex);
 
   dropDeadSymbols(Mod, DefinedGlobals, CombinedIndex);
@@ -542,6 +564,29 @@ Error lto::thinBackend(Config &Conf, unsigned Task, AddStreamFn AddStream,
            /*ExportSummary=*/nullptr, /*ImportSummary=*/&CombinedIndex))
     return finalizeOptimizationRemarks(std::move(DiagnosticOutputFile));
 
+  // Commit the optimized IR to the cache through a temporary file so that we
+  // never race with other backend threads or a concurrent pruner. Failing to
+  // populate the cache is not an error.
+  if (!IRCacheEntryPath.empty()) {
+    (void)sys::fs::create_directories(Conf.IRCacheDir);
+    SmallString<128> TempFilenameModel;
+    sys::path::append(TempFilenameModel, Conf.IRCacheDir, "Thin-%%%%%%.tmp.bc");
+    Expected<sys::fs::TempFile> Temp = sys::fs::TempFile::create(
+        TempFilenameModel, sys::fs::owner_read | sys::fs::owner_write);
+    if (Temp) {
+      {
+        raw_fd_ostream OS(Temp->FD, /*shouldClose=*/false);
+        WriteBitcodeToFile(Mod, OS);
+      }
+      if (Error E = Temp->keep(IRCacheEntryPath)) {
+        consumeError(std::move(E));
+        consumeError(Temp->discard());
+      }
+    } else {
+      consumeError(Temp.takeError());
+    }
+  }
+
   codegen(Conf, TM.get(), AddStream, Task, Mod);
   return finalizeOptimizationRemarks(std::move(DiagnosticOutputFile));
 }
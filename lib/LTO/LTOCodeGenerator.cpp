@@ -254,47 +254,67 @@ bool LTOCodeGenerator::writeMergedModules(StringRef Path) {
 }
 
 bool LTOCodeGenerator::compileOptimizedToFile(const char **Name) {
-  // make unique temp output file to put generated code
-  SmallString<128> Filename;
-  int FD;
-
   StringRef Extension
       (FileType == TargetMachine::CGFT_AssemblyFile ? "s" : "o");
 
-  std::error_code EC =
-      sys::fs::createTemporaryFile("lto-llvm", Extension, FD, Filename);
-  if (EC) {
-    emitError(EC.message());
-    return false;
+  // make one unique temp output file per code generation partition
+  SmallVector<std::unique_ptr<ToolOutputFile>, 4> ObjFiles;
+  std::vector<raw_pwrite_stream *> Streams;
+  std::vector<std::string> Paths;
+  for (unsigned I = 0; I != ParallelismLevel; ++I) {
+    SmallString<128> Filename;
+    int FD;
+    std::error_code EC =
+        sys::fs::createTemporaryFile("lto-llvm", Extension, FD, Filename);
+    if (EC) {
+      emitError(EC.message());
+      return false;
+    }
+    ObjFiles.push_back(std::make_unique<ToolOutputFile>(Filename, FD));
+    Streams.push_back(&ObjFiles.back()->os());
+    Paths.push_back(std::string(Filename.str()));
   }
 
-  // generate object file
-  ToolOutputFile objFile(Filename, FD);
-
-  bool genResult = compileOptimized(&objFile.os());
-  objFile.os().close();
-  if (objFile.os().has_error()) {
-    emitError((Twine("could not write object file: ") + Filename + ": " +
-               objFile.os().error().message())
-                  .str());
-    objFile.os().clear_error();
-    sys::fs::remove(Twine(Filename));
-    return false;
+  // generate object file(s)
+  bool genResult = compileOptimized(Streams);
+
+  bool hasWriteError = false;
+  for (unsigned I = 0; I != ParallelismLevel; ++I) {
+    ToolOutputFile &objFile = *ObjFiles[I];
+    objFile.os().close();
+    if (objFile.os().has_error()) {
+      emitError((Twine("could not write object file: ") + Paths[I] + ": " +
+                 objFile.os().error().message())
+                    .str());
+      objFile.os().clear_error();
+      hasWriteError = true;
+      continue;
+    }
+    objFile.keep();
   }
 
-  objFile.keep();
-  if (!genResult) {
-    sys::fs::remove(Twine(Filename));
+  if (hasWriteError || !genResult) {
+    for (const std::string &Path : Paths)
+      sys::fs::remove(Twine(Path));
     return false;
   }
 
-  NativeObjectPath = Filename.c_str();
+  NativeObjectPaths = std::move(Paths);
+  NativeObjectPath = NativeObjectPaths.front();
   *Name = NativeObjectPath.c_str();
   return true;
 }
 
 std::unique_ptr<MemoryBuffer>
 LTOCodeGenerator::compileOptimized() {
+  // The buffer-returning interface can only surface a single object file;
+  // parallel code generation requires compiling to files.
+  if (ParallelismLevel > 1) {
+    emitError("parallel LTO code generation is only supported when compiling "
+              "to files");
+    return nullptr;
+  }
+
   const char *name;
   if (!compileOptimizedToFile(&name))
     return nullptr;
@@ -889,6 +889,24 @@ ThinLTOCodeGenerator::writeGeneratedObject(int count, StringRef CacheEntryPath,
   return OutputPath.str();
 }
 
+/// Estimate the backend cost of a module from its summary data. The
+/// instruction counts of the defined functions dominate both the optimizer
+/// and code generation time, and correlate much better with backend wall
+/// time than the bitcode buffer size, which also counts metadata.
+static uint64_t
+estimateModuleBackendCost(const GVSummaryMapTy &DefinedGVSummaries) {
+  uint64_t Cost = 0;
+  for (const auto &GVS : DefinedGVSummaries) {
+    if (const auto *FS =
+            dyn_cast<FunctionSummary>(GVS.second->getBaseObject()))
+      Cost += FS->instCount();
+    // Every summary contributes a small constant so that modules consisting
+    // mostly of global variables are not treated as free.
+    ++Cost;
+  }
+  return Cost;
+}
+
 // Main entry point for the ThinLTO processing
 void ThinLTOCodeGenerator::run() {
   // Prepare the resulting object vector
@@ -1019,13 +1037,24 @@ void ThinLTOCodeGenerator::run() {
     ModuleToDefinedGVSummaries[ModuleIdentifier];
   }
 
-  // Compute the ordering we will process the inputs: the rough heuristic here
-  // is to sort them per size so that the largest module get schedule as soon as
-  // possible. This is purely a compile-time optimization.
+  // Compute the ordering we will process the inputs: schedule the most
+  // expensive modules first (longest processing time first), which evens out
+  // the per-thread cost as the pool drains the queue and keeps straggler
+  // modules from dominating the tail of the build. The cost is estimated
+  // from the summary instruction counts; ties (e.g. modules with no summary
+  // data) fall back to the bitcode size. This is purely a compile-time
+  // optimization.
+  std::vector<uint64_t> ModuleCosts(Modules.size());
+  for (size_t I = 0, E = Modules.size(); I != E; ++I)
+    ModuleCosts[I] =
+        estimateModuleBackendCost(ModuleToDefinedGVSummaries[Modules[I]->getName()]);
+
   std::vector<int> ModulesOrdering;
   ModulesOrdering.resize(Modules.size());
   std::iota(ModulesOrdering.begin(), ModulesOrdering.end(), 0);
   llvm::sort(ModulesOrdering, [&](int LeftIndex, int RightIndex) {
+    if (ModuleCosts[LeftIndex] != ModuleCosts[RightIndex])
+      return ModuleCosts[LeftIndex] > ModuleCosts[RightIndex];
     auto LSize =
         Modules[LeftIndex]->getSingleBitcodeModule().getBuffer().size();
     auto RSize =
@@ -28,8 +28,11 @@ using namespace llvm;
 
 namespace {
 class TypeMapTy : public ValueMapTypeRemapper {
-  /// This is a mapping from a source type to a destination type to use.
-  DenseMap<Type *, Type *> MappedTypes;
+  /// This is a mapping from a source type to a destination type to use. It is
+  /// owned by IRMover so that mappings persist across calls to \a
+  /// IRMover::move(); types are uniqued in the LLVMContext, so source modules
+  /// linked in sequence frequently share types.
+  DenseMap<Type *, Type *> &MappedTypes;
 
   /// When checking to see if two subgraphs are isomorphic, we speculatively
   /// add types to MappedTypes, but keep track of them here in case we need to
@@ -47,8 +50,9 @@ class TypeMapTy : public ValueMapTypeRemapper {
   SmallPtrSet<StructType *, 16> DstResolvedOpaqueTypes;
 
 public:
-  TypeMapTy(IRMover::IdentifiedStructTypeSet &DstStructTypesSet)
-      : DstStructTypesSet(DstStructTypesSet) {}
+  TypeMapTy(IRMover::IdentifiedStructTypeSet &DstStructTypesSet,
+            DenseMap<Type *, Type *> &SharedTypes)
+      : MappedTypes(SharedTypes), DstStructTypesSet(DstStructTypesSet) {}
 
   IRMover::IdentifiedStructTypeSet &DstStructTypesSet;
   /// Indicate that the specified type in the destination module is conceptually
@@ -517,12 +521,14 @@ class IRLinker {
 
 public:
   IRLinker(Module &DstM, MDMapT &SharedMDs,
-           IRMover::IdentifiedStructTypeSet &Set, std::unique_ptr<Module> SrcM,
+           IRMover::IdentifiedStructTypeSet &Set,
+           DenseMap<Type *, Type *> &SharedTypes, std::unique_ptr<Module> SrcM,
            ArrayRef<GlobalValue *> ValuesToLink,
            std::function<void(GlobalValue &, IRMover::ValueAdder)> AddLazyFor,
            bool IsPerformingImport)
       : DstM(DstM), SrcM(std::move(SrcM)), AddLazyFor(std::move(AddLazyFor)),
-        TypeMap(Set), GValMaterializer(*this), LValMaterializer(*this),
+        TypeMap(Set, SharedTypes), GValMaterializer(*this),
+        LValMaterializer(*this),
         SharedMDs(SharedMDs), IsPerformingImport(IsPerformingImport),
         Mapper(ValueMap, RF_MoveDistinctMDs | RF_IgnoreMissingLocals, &TypeMap,
                &GValMaterializer),
@@ -1557,8 +1563,8 @@ Error IRMover::move(
     std::function<void(GlobalValue &, ValueAdder Add)> AddLazyFor,
     bool IsPerformingImport) {
   IRLinker TheIRLinker(Composite, SharedMDs, IdentifiedStructTypes,
-                       std::move(Src), ValuesToLink, std::move(AddLazyFor),
-                       IsPerformingImport);
+                       SharedTypes, std::move(Src), ValuesToLink,
+                       std::move(AddLazyFor), IsPerformingImport);
   Error E = TheIRLinker.run();
   Composite.dropTriviallyDeadConstantArrays();
   return E;
@@ -863,6 +863,33 @@ bool ELFWriter::maybeWriteCompression(
   return true;
 }
 
+// Once a section's bytes are on the output stream its fragment contents are
+// dead weight: relocations were recorded during layout and writing the symbol
+// table only reads fragment offsets, never contents. Dropping the buffers as
+// sections are written keeps peak assembler memory closer to the largest
+// section than to the whole object, which matters for fat debug objects.
+// Virtual sections are exempt since their size is still computed from the
+// fragments when the headers are emitted.
+static void releaseSectionContents(MCSection &Sec) {
+  if (Sec.isVirtualSection())
+    return;
+  for (MCFragment &F : Sec) {
+    switch (F.getKind()) {
+    case MCFragment::FT_Data:
+      cast<MCDataFragment>(F).releaseContents();
+      break;
+    case MCFragment::FT_Relaxable:
+      cast<MCRelaxableFragment>(F).releaseContents();
+      break;
+    case MCFragment::FT_CompactEncodedInst:
+      cast<MCCompactEncodedInstFragment>(F).releaseContents();
+      break;
+    default:
+      break;
+    }
+  }
+}
+
 void ELFWriter::writeSectionData(const MCAssembler &Asm, MCSection &Sec,
                                  const MCAsmLayout &Layout) {
   MCSectionELF &Section = static_cast<MCSectionELF &>(Sec);
@@ -879,6 +906,7 @@ void ELFWriter::writeSectionData(const MCAssembler &Asm, MCSection &Sec,
   if (!CompressionEnabled || !SectionName.startswith(".debug_") ||
       SectionName == ".debug_frame") {
     Asm.writeSectionData(W.OS, &Section, Layout);
+    releaseSectionContents(Section);
     return;
   }
 
@@ -889,6 +917,9 @@ void ELFWriter::writeSectionData(const MCAssembler &Asm, MCSection &Sec,
   SmallVector<char, 128> UncompressedData;
   raw_svector_ostream VecOS(UncompressedData);
   Asm.writeSectionData(VecOS, &Section, Layout);
+  // The uncompressed copy supersedes the fragment buffers; drop them before
+  // the compressed copy is allocated on top.
+  releaseSectionContents(Section);
 
   SmallVector<char, 128> CompressedContents;
   if (Error E = zlib::compress(
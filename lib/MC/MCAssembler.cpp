@@ -8,6 +8,9 @@
 
 #include "llvm/MC/MCAssembler.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Statistic.h"
@@ -32,6 +35,7 @@
 #include "llvm/MC/MCValue.h"
 #include "llvm/Support/Alignment.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/LEB128.h"
@@ -68,6 +72,7 @@ STATISTIC(FragmentLayouts, "Number of fragment layouts");
 STATISTIC(ObjectBytes, "Number of emitted object file bytes");
 STATISTIC(RelaxationSteps, "Number of assembler layout and relaxation steps");
 STATISTIC(RelaxedInstructions, "Number of relaxed instructions");
+STATISTIC(SectionRelaxations, "Number of section relaxation scans");
 STATISTIC(PaddingFragmentsRelaxations,
           "Number of Padding Fragments relaxations");
 STATISTIC(PaddingFragmentsBytes,
@@ -76,6 +81,16 @@ STATISTIC(PaddingFragmentsBytes,
 } // end namespace stats
 } // end anonymous namespace
 
+// Relaxing a fragment can only change relaxation decisions elsewhere through
+// the symbol offsets it shifts, so layout() can revisit just the sections
+// whose inputs changed instead of rescanning the whole object until one full
+// pass is quiet. This is an escape hatch in case a target's expressions
+// confuse the dependency scan.
+static cl::opt<bool> RelaxViaWorklist(
+    "mc-relax-via-worklist", cl::init(true), cl::Hidden,
+    cl::desc("Drive assembler relaxation with a section worklist instead of "
+             "whole-object fixpoint passes"));
+
 // FIXME FIXME FIXME: There are number of places in this file where we convert
 // what is a 64-bit assembler value used for computation into a value in the
 // object file, which may truncate it. We should detect that truncation where
@@ -783,9 +798,12 @@ void MCAssembler::layout(MCAsmLayout &Layout) {
   }
 
   // Layout until everything fits.
-  while (layoutOnce(Layout))
-    if (getContext().hadError())
-      return;
+  if (RelaxViaWorklist)
+    layoutViaWorklist(Layout);
+  else
+    while (layoutOnce(Layout))
+      if (getContext().hadError())
+        return;
 
   DEBUG_WITH_TYPE("mc-dump", {
       errs() << "assembler backend - post-relaxation\n--\n";
@@ -1119,6 +1137,117 @@ bool MCAssembler::layoutOnce(MCAsmLayout &Layout) {
   return WasRelaxed;
 }
 
+/// Collect the sections whose symbol offsets can influence the value of
+/// \p Expr. Returns false if the expression contains a node the scan cannot
+/// see through (a target-specific expression).
+static bool gatherExprDeps(const MCExpr *Expr,
+                           SmallPtrSetImpl<MCSection *> &Deps) {
+  switch (Expr->getKind()) {
+  case MCExpr::Constant:
+    return true;
+  case MCExpr::SymbolRef: {
+    const MCSymbol &Sym = cast<MCSymbolRefExpr>(Expr)->getSymbol();
+    if (Sym.isVariable())
+      return gatherExprDeps(Sym.getVariableValue(/*SetUsed=*/false), Deps);
+    if (Sym.isInSection())
+      Deps.insert(&Sym.getSection());
+    return true;
+  }
+  case MCExpr::Unary:
+    return gatherExprDeps(cast<MCUnaryExpr>(Expr)->getSubExpr(), Deps);
+  case MCExpr::Binary: {
+    const MCBinaryExpr *BE = cast<MCBinaryExpr>(Expr);
+    return gatherExprDeps(BE->getLHS(), Deps) &&
+           gatherExprDeps(BE->getRHS(), Deps);
+  }
+  case MCExpr::Target:
+    return false;
+  }
+  llvm_unreachable("Invalid expression kind");
+}
+
+/// Collect the sections \p F reads symbol offsets from when it is relaxed.
+/// Returns false if those inputs cannot be enumerated.
+static bool gatherFragmentDeps(const MCFragment &F,
+                               SmallPtrSetImpl<MCSection *> &Deps) {
+  switch (F.getKind()) {
+  case MCFragment::FT_Relaxable:
+    for (const MCFixup &Fixup : cast<MCRelaxableFragment>(F).getFixups())
+      if (!gatherExprDeps(Fixup.getValue(), Deps))
+        return false;
+    return true;
+  case MCFragment::FT_Dwarf:
+    return gatherExprDeps(&cast<MCDwarfLineAddrFragment>(F).getAddrDelta(),
+                          Deps);
+  case MCFragment::FT_DwarfFrame:
+    return gatherExprDeps(&cast<MCDwarfCallFrameFragment>(F).getAddrDelta(),
+                          Deps);
+  case MCFragment::FT_LEB:
+    return gatherExprDeps(&cast<MCLEBFragment>(F).getValue(), Deps);
+  // CodeView tables are encoded from line entries held by the CodeView
+  // context, not from expressions reachable through the fragment, so their
+  // inputs cannot be enumerated here.
+  case MCFragment::FT_CVInlineLines:
+  case MCFragment::FT_CVDefRange:
+    return false;
+  // Everything else (including padding relaxation) only reads offsets within
+  // its own section, which the per-section rescan below already covers.
+  default:
+    return true;
+  }
+}
+
+void MCAssembler::layoutViaWorklist(MCAsmLayout &Layout) {
+  // Invert the dependencies: for each section, the sections that must be
+  // rescanned when its layout changes. Sections with inputs we cannot
+  // enumerate are rescanned whenever anything changes.
+  DenseMap<const MCSection *, SmallVector<MCSection *, 4>> Dependents;
+  SmallVector<MCSection *, 4> GlobalDependents;
+  for (MCSection &Sec : *this) {
+    SmallPtrSet<MCSection *, 8> Sources;
+    bool Opaque = false;
+    for (const MCFragment &F : Sec)
+      if (!gatherFragmentDeps(F, Sources)) {
+        Opaque = true;
+        break;
+      }
+    if (Opaque) {
+      GlobalDependents.push_back(&Sec);
+      continue;
+    }
+    for (MCSection *Source : Sources)
+      if (Source != &Sec)
+        Dependents[Source].push_back(&Sec);
+  }
+
+  // Visit every section at least once; the order of visits does not affect
+  // the fixpoint since a section is re-queued whenever any of its inputs
+  // changes after it was last scanned.
+  SetVector<MCSection *> Worklist;
+  for (MCSection *Sec : Layout.getSectionOrder())
+    Worklist.insert(Sec);
+
+  while (!Worklist.empty()) {
+    if (getContext().hadError())
+      return;
+    MCSection *Sec = Worklist.pop_back_val();
+    ++stats::SectionRelaxations;
+
+    bool Changed = false;
+    while (layoutSectionOnce(Layout, *Sec))
+      Changed = true;
+    if (!Changed)
+      continue;
+
+    auto It = Dependents.find(Sec);
+    if (It != Dependents.end())
+      for (MCSection *Dep : It->second)
+        Worklist.insert(Dep);
+    for (MCSection *Dep : GlobalDependents)
+      Worklist.insert(Dep);
+  }
+}
+
 void MCAssembler::finishLayout(MCAsmLayout &Layout) {
   assert(getBackendPtr() && "Expected assembler backend");
   // The layout is done. Mark every fragment as valid.
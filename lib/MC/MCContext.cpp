@@ -114,6 +114,7 @@ void MCContext::reset() {
   XCOFFUniquingMap.clear();
 
   NextID.clear();
+  NextTmpID = 0;
   AllowTemporaryLabels = true;
   DwarfLocSeen = false;
   GenDwarfForAssembly = false;
@@ -223,7 +224,31 @@ MCSymbol *MCContext::createLinkerPrivateTempSymbol() {
 }
 
 MCSymbol *MCContext::createTempSymbol(bool CanBeUnnamed) {
-  return createTempSymbol("tmp", true, CanBeUnnamed);
+  // Fast path for the default "<priv>tmpN" labels, which dominate symbol
+  // creation when assembling compiler output. Unnamed symbols skip string
+  // materialization entirely; named ones are numbered from a dedicated
+  // counter so neither the prefix formatting nor the NextID lookup of the
+  // generic createSymbol() path is paid per label.
+  if (CanBeUnnamed && !UseNamesOnTempLabels)
+    return createSymbolImpl(nullptr, true);
+
+  bool IsTemporary = CanBeUnnamed || AllowTemporaryLabels;
+  SmallString<128> NameSV;
+  raw_svector_ostream OS(NameSV);
+  OS << MAI->getPrivateGlobalPrefix() << "tmp";
+  size_t PrefixLen = NameSV.size();
+  while (true) {
+    NameSV.resize(PrefixLen);
+    OS << NextTmpID++;
+    auto NameEntry = UsedNames.insert(std::make_pair(NameSV, true));
+    if (NameEntry.second || !NameEntry.first->second) {
+      // Mark it as used for a non-section symbol.
+      NameEntry.first->second = true;
+      return createSymbolImpl(&*NameEntry.first, IsTemporary);
+    }
+    // The name collided with a user-written label of the same shape; keep
+    // bumping the counter until we find a free one.
+  }
 }
 
 unsigned MCContext::NextInstance(unsigned LocalLabelVal) {
@@ -387,7 +412,8 @@ MCSectionELF *MCContext::getELFSection(const Twine &Section, unsigned Type,
                                        const Twine &Group, unsigned UniqueID,
                                        const MCSymbolELF *Associated) {
   MCSymbolELF *GroupSym = nullptr;
-  if (!Group.isTriviallyEmpty() && !Group.str().empty())
+  SmallString<64> GroupSV;
+  if (!Group.isTriviallyEmpty() && !Group.toStringRef(GroupSV).empty())
     GroupSym = cast<MCSymbolELF>(getOrCreateSymbol(Group));
 
   return getELFSection(Section, Type, Flags, EntrySize, GroupSym, UniqueID,
@@ -496,7 +522,8 @@ MCSectionWasm *MCContext::getWasmSection(const Twine &Section, SectionKind K,
                                          const Twine &Group, unsigned UniqueID,
                                          const char *BeginSymName) {
   MCSymbolWasm *GroupSym = nullptr;
-  if (!Group.isTriviallyEmpty() && !Group.str().empty()) {
+  SmallString<64> GroupSV;
+  if (!Group.isTriviallyEmpty() && !Group.toStringRef(GroupSV).empty()) {
     GroupSym = cast<MCSymbolWasm>(getOrCreateSymbol(Group));
     GroupSym->setComdat(true);
   }
@@ -9,6 +9,7 @@
 #include "llvm/MC/MCDisassembler/MCDisassembler.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/MC/MCInstrAnalysis.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 
@@ -16,6 +17,36 @@ using namespace llvm;
 
 MCDisassembler::~MCDisassembler() = default;
 
+void MCDisassembler::decodeRange(ArrayRef<uint8_t> Bytes, uint64_t Address,
+                                 std::vector<DecodedInst> &Insts,
+                                 const MCInstrAnalysis *MIA) const {
+  // A rough lower bound on entries, so bulk callers do not pay repeated
+  // reallocation of the arena for dense code.
+  Insts.reserve(Insts.size() + Bytes.size() / 8);
+
+  uint64_t Index = 0;
+  while (Index < Bytes.size()) {
+    Insts.emplace_back();
+    DecodedInst &DI = Insts.back();
+    DI.Address = Address + Index;
+    DI.Status = getInstruction(DI.Inst, DI.Size, Bytes.slice(Index),
+                               DI.Address, nulls(), nulls());
+    // Skip illegible bytes rather than spinning on them.
+    if (DI.Size == 0)
+      DI.Size = 1;
+
+    if (MIA && DI.Status != Fail &&
+        (MIA->isCall(DI.Inst) || MIA->isUnconditionalBranch(DI.Inst) ||
+         MIA->isConditionalBranch(DI.Inst))) {
+      uint64_t Target;
+      if (MIA->evaluateBranch(DI.Inst, DI.Address, DI.Size, Target))
+        DI.BranchTarget = Target;
+    }
+
+    Index += DI.Size;
+  }
+}
+
 MCDisassembler::DecodeStatus MCDisassembler::onSymbolStart(
     StringRef Name, uint64_t &Size, ArrayRef<uint8_t> Bytes, uint64_t Address,
     raw_ostream &VStream, raw_ostream &CStream) const {
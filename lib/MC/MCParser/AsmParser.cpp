@@ -1750,56 +1750,104 @@ bool AsmParser::parseStatement(ParseStatementInfo &Info,
     IDVal = "";
   }
 
+  // Every directive name starts with a dot, so for anything else (in
+  // particular every instruction) the map lookup below cannot succeed and
+  // is skipped.
+  DirectiveKind DirKind = DK_NO_DIRECTIVE;
+  if (IDVal.startswith(".")) {
+    StringMap<DirectiveKind>::const_iterator DirKindIt =
+        DirectiveKindMap.find(IDVal);
+    if (DirKindIt != DirectiveKindMap.end())
+      DirKind = DirKindIt->getValue();
+  }
+
   // Handle conditional assembly here before checking for skipping.  We
   // have to do this so that .endif isn't skipped in a ".if 0" block for
-  // example.
-  StringMap<DirectiveKind>::const_iterator DirKindIt =
-      DirectiveKindMap.find(IDVal);
-  DirectiveKind DirKind = (DirKindIt == DirectiveKindMap.end())
-
-                              ? DK_NO_DIRECTIVE
-                              : DirKindIt->getValue();
-  switch (DirKind) {
-  default:
-    break;
-  case DK_IF:
-  case DK_IFEQ:
-  case DK_IFGE:
-  case DK_IFGT:
-  case DK_IFLE:
-  case DK_IFLT:
-  case DK_IFNE:
-    return parseDirectiveIf(IDLoc, DirKind);
-  case DK_IFB:
-    return parseDirectiveIfb(IDLoc, true);
-  case DK_IFNB:
-    return parseDirectiveIfb(IDLoc, false);
-  case DK_IFC:
-    return parseDirectiveIfc(IDLoc, true);
-  case DK_IFEQS:
-    return parseDirectiveIfeqs(IDLoc, true);
-  case DK_IFNC:
-    return parseDirectiveIfc(IDLoc, false);
-  case DK_IFNES:
-    return parseDirectiveIfeqs(IDLoc, false);
-  case DK_IFDEF:
-    return parseDirectiveIfdef(IDLoc, true);
-  case DK_IFNDEF:
-  case DK_IFNOTDEF:
-    return parseDirectiveIfdef(IDLoc, false);
-  case DK_ELSEIF:
-    return parseDirectiveElseIf(IDLoc);
-  case DK_ELSE:
-    return parseDirectiveElse(IDLoc);
-  case DK_ENDIF:
-    return parseDirectiveEndIf(IDLoc);
-  }
+  // example. Fast-parse mode excludes the macro and conditional-assembly
+  // machinery from the dialect entirely; diagnose rather than quietly
+  // assemble something the mode cannot track.
+  if (FastParse) {
+    switch (DirKind) {
+    default:
+      break;
+    case DK_IF:
+    case DK_IFEQ:
+    case DK_IFGE:
+    case DK_IFGT:
+    case DK_IFLE:
+    case DK_IFLT:
+    case DK_IFNE:
+    case DK_IFB:
+    case DK_IFNB:
+    case DK_IFC:
+    case DK_IFEQS:
+    case DK_IFNC:
+    case DK_IFNES:
+    case DK_IFDEF:
+    case DK_IFNDEF:
+    case DK_IFNOTDEF:
+    case DK_ELSEIF:
+    case DK_ELSE:
+    case DK_ENDIF:
+    case DK_MACRO:
+    case DK_EXITM:
+    case DK_ENDM:
+    case DK_ENDMACRO:
+    case DK_PURGEM:
+    case DK_MACROS_ON:
+    case DK_MACROS_OFF:
+    case DK_ALTMACRO:
+    case DK_NOALTMACRO:
+    case DK_REPT:
+    case DK_IRP:
+    case DK_IRPC:
+    case DK_ENDR:
+      return Error(IDLoc, "macros and conditional assembly are not "
+                          "available in fast-parse mode");
+    }
+  } else {
+    switch (DirKind) {
+    default:
+      break;
+    case DK_IF:
+    case DK_IFEQ:
+    case DK_IFGE:
+    case DK_IFGT:
+    case DK_IFLE:
+    case DK_IFLT:
+    case DK_IFNE:
+      return parseDirectiveIf(IDLoc, DirKind);
+    case DK_IFB:
+      return parseDirectiveIfb(IDLoc, true);
+    case DK_IFNB:
+      return parseDirectiveIfb(IDLoc, false);
+    case DK_IFC:
+      return parseDirectiveIfc(IDLoc, true);
+    case DK_IFEQS:
+      return parseDirectiveIfeqs(IDLoc, true);
+    case DK_IFNC:
+      return parseDirectiveIfc(IDLoc, false);
+    case DK_IFNES:
+      return parseDirectiveIfeqs(IDLoc, false);
+    case DK_IFDEF:
+      return parseDirectiveIfdef(IDLoc, true);
+    case DK_IFNDEF:
+    case DK_IFNOTDEF:
+      return parseDirectiveIfdef(IDLoc, false);
+    case DK_ELSEIF:
+      return parseDirectiveElseIf(IDLoc);
+    case DK_ELSE:
+      return parseDirectiveElse(IDLoc);
+    case DK_ENDIF:
+      return parseDirectiveEndIf(IDLoc);
+    }
 
-  // Ignore the statement if in the middle of inactive conditional
-  // (e.g. ".if 0").
-  if (TheCondState.Ignore) {
-    eatToEndOfStatement();
-    return false;
+    // Ignore the statement if in the middle of inactive conditional
+    // (e.g. ".if 0").
+    if (TheCondState.Ignore) {
+      eatToEndOfStatement();
+      return false;
+    }
   }
 
   // FIXME: Recurse on local labels?
@@ -1884,7 +1932,9 @@ bool AsmParser::parseStatement(ParseStatementInfo &Info,
   }
 
   // If macros are enabled, check to see if this is a macro instantiation.
-  if (areMacrosEnabled())
+  // Fast-parse mode excludes macros from the dialect, so the per-statement
+  // lookup is skipped; .macro itself is diagnosed as unknown below.
+  if (!FastParse && areMacrosEnabled())
     if (const MCAsmMacro *M = getContext().lookupMacro(IDVal)) {
       return handleMacroEntry(M, IDLoc);
     }
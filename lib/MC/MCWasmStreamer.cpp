@@ -173,22 +173,21 @@ void MCWasmStreamer::EmitInstToFragment(const MCInst &Inst,
 void MCWasmStreamer::EmitInstToData(const MCInst &Inst,
                                     const MCSubtargetInfo &STI) {
   MCAssembler &Assembler = getAssembler();
-  SmallVector<MCFixup, 4> Fixups;
-  SmallString<256> Code;
-  raw_svector_ostream VecOS(Code);
-  Assembler.getEmitter().encodeInstruction(Inst, VecOS, Fixups, STI);
 
-  // Append the encoded instruction to the current data fragment (or create a
-  // new such fragment if the current fragment is not a data fragment).
+  // Encode the instruction directly into the current data fragment (or a new
+  // such fragment if the current fragment is not a data fragment), avoiding a
+  // copy of the encoded bytes through a temporary buffer.
   MCDataFragment *DF = getOrCreateDataFragment();
+  SmallVectorImpl<MCFixup> &Fixups = DF->getFixups();
+  unsigned FixupStart = Fixups.size();
+  uint64_t CodeOffset = DF->getContents().size();
+  raw_svector_ostream VecOS(DF->getContents());
+  Assembler.getEmitter().encodeInstruction(Inst, VecOS, Fixups, STI);
 
-  // Add the fixups and data.
-  for (unsigned I = 0, E = Fixups.size(); I != E; ++I) {
-    Fixups[I].setOffset(Fixups[I].getOffset() + DF->getContents().size());
-    DF->getFixups().push_back(Fixups[I]);
-  }
+  // Fix up the fixup offsets to be relative to the start of the fragment.
+  for (unsigned I = FixupStart, E = Fixups.size(); I != E; ++I)
+    Fixups[I].setOffset(Fixups[I].getOffset() + CodeOffset);
   DF->setHasInstructions(STI);
-  DF->getContents().append(Code.begin(), Code.end());
 }
 
 void MCWasmStreamer::FinishImpl() {
@@ -52,18 +52,18 @@ void MCWinCOFFStreamer::EmitInstToData(const MCInst &Inst,
                                        const MCSubtargetInfo &STI) {
   MCDataFragment *DF = getOrCreateDataFragment();
 
-  SmallVector<MCFixup, 4> Fixups;
-  SmallString<256> Code;
-  raw_svector_ostream VecOS(Code);
+  // Encode directly into the fragment to avoid copying the encoded bytes
+  // through a temporary buffer.
+  SmallVectorImpl<MCFixup> &Fixups = DF->getFixups();
+  unsigned FixupStart = Fixups.size();
+  uint64_t CodeOffset = DF->getContents().size();
+  raw_svector_ostream VecOS(DF->getContents());
   getAssembler().getEmitter().encodeInstruction(Inst, VecOS, Fixups, STI);
 
-  // Add the fixups and data.
-  for (unsigned i = 0, e = Fixups.size(); i != e; ++i) {
-    Fixups[i].setOffset(Fixups[i].getOffset() + DF->getContents().size());
-    DF->getFixups().push_back(Fixups[i]);
-  }
+  // Fix up the fixup offsets to be relative to the start of the fragment.
+  for (unsigned i = FixupStart, e = Fixups.size(); i != e; ++i)
+    Fixups[i].setOffset(Fixups[i].getOffset() + CodeOffset);
   DF->setHasInstructions(STI);
-  DF->getContents().append(Code.begin(), Code.end());
 }
 
 void MCWinCOFFStreamer::InitSections(bool NoExecStack) {
@@ -71,15 +71,15 @@ void MCXCOFFStreamer::EmitInstToData(const MCInst &Inst,
                                      const MCSubtargetInfo &STI) {
   MCAssembler &Assembler = getAssembler();
   SmallVector<MCFixup, 4> Fixups;
-  SmallString<256> Code;
-  raw_svector_ostream VecOS(Code);
-  Assembler.getEmitter().encodeInstruction(Inst, VecOS, Fixups, STI);
 
   // TODO: Handle Fixups later
 
+  // Encode directly into the fragment to avoid copying the encoded bytes
+  // through a temporary buffer.
   MCDataFragment *DF = getOrCreateDataFragment(&STI);
+  raw_svector_ostream VecOS(DF->getContents());
+  Assembler.getEmitter().encodeInstruction(Inst, VecOS, Fixups, STI);
   DF->setHasInstructions(STI);
-  DF->getContents().append(Code.begin(), Code.end());
 }
 
 MCStreamer *llvm::createXCOFFStreamer(MCContext &Context,
@@ -13,7 +13,9 @@
 #include "llvm/BinaryFormat/COFF.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -119,6 +121,35 @@ tailcall:
   }
 }
 
+// Tables below this size sort faster serially; the bucketing pass and task
+// spawning would dominate.
+static const size_t ParallelSortThreshold = 1 << 16;
+
+// Sort strings for tail merging. Large tables are radix-partitioned by their
+// last character and the buckets are sorted concurrently. multikeySort orders
+// greater tail characters first and strings exhausted at the current position
+// last, so concatenating the buckets from 0xff down to the exhausted bucket
+// reproduces the serial order exactly.
+static void sortStrings(std::vector<StringPair *> &Strings) {
+  if (Strings.size() < ParallelSortThreshold) {
+    multikeySort(Strings, 0);
+    return;
+  }
+
+  // Bucket 0 holds strings with no character at position 0 (there can be at
+  // most one, the empty string); character C goes to bucket C + 1.
+  std::array<std::vector<StringPair *>, 257> Buckets;
+  for (StringPair *P : Strings)
+    Buckets[charTailAt(P, 0) + 1].push_back(P);
+
+  parallel::for_each_n(parallel::par, size_t(1), Buckets.size(),
+                       [&](size_t I) { multikeySort(Buckets[I], 1); });
+
+  Strings.clear();
+  for (size_t I = Buckets.size(); I > 0; --I)
+    Strings.insert(Strings.end(), Buckets[I - 1].begin(), Buckets[I - 1].end());
+}
+
 void StringTableBuilder::finalize() {
   assert(K != DWARF);
   finalizeStringTable(/*Optimize=*/true);
@@ -137,7 +168,7 @@ void StringTableBuilder::finalizeStringTable(bool Optimize) {
     for (StringPair &P : StringIndexMap)
       Strings.push_back(&P);
 
-    multikeySort(Strings, 0);
+    sortStrings(Strings);
     initSize();
 
     StringRef Previous;
@@ -197,3 +228,23 @@ size_t StringTableBuilder::add(CachedHashStringRef S) {
   }
   return P.first->second;
 }
+
+size_t StringTableBuilder::addIncremental(CachedHashStringRef S) {
+  if (K == WinCOFF)
+    assert(S.size() > COFF::NameSize && "Short string in COFF string table!");
+
+  assert(isFinalized() && "Use add() before the table is finalized");
+  auto P = StringIndexMap.insert(std::make_pair(S, 0));
+  if (P.second) {
+    // Append without suffix merging; offsets handed out earlier must not
+    // move.
+    size_t Start = alignTo(Size, Alignment);
+    P.first->second = Start;
+    Size = Start + S.size() + (K != RAW);
+    // Keep the invariant established by finalize() that a MachO table is
+    // padded to a multiple of 4.
+    if (K == MachO)
+      Size = alignTo(Size, 4);
+  }
+  return P.first->second;
+}
@@ -974,19 +974,25 @@ uint32_t Archive::getNumberOfSymbols() const {
 }
 
 Expected<Optional<Archive::Child>> Archive::findSym(StringRef name) const {
-  Archive::symbol_iterator bs = symbol_begin();
-  Archive::symbol_iterator es = symbol_end();
-
-  for (; bs != es; ++bs) {
-    StringRef SymName = bs->getName();
-    if (SymName == name) {
-      if (auto MemberOrErr = bs->getMember())
-        return Child(*MemberOrErr);
-      else
-        return MemberOrErr.takeError();
-    }
-  }
-  return Optional<Child>();
+  if (!hasSymbolTable())
+    return Optional<Child>();
+
+  // Index the symbol table on the first lookup; subsequent lookups are a
+  // hash probe rather than a scan of all symbols. try_emplace keeps the
+  // first definition of a name, matching the old scan.
+  if (!SymbolIndexBuilt) {
+    for (const Symbol &S : symbols())
+      SymbolIndex.try_emplace(CachedHashStringRef(S.getName()), S);
+    SymbolIndexBuilt = true;
+  }
+
+  auto I = SymbolIndex.find(CachedHashStringRef(name));
+  if (I == SymbolIndex.end())
+    return Optional<Child>();
+  if (auto MemberOrErr = I->second.getMember())
+    return Child(*MemberOrErr);
+  else
+    return MemberOrErr.takeError();
 }
 
 // Returns true if archive file contains no member file.
@@ -18,7 +18,10 @@
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Mangler.h"
 #include "llvm/IR/Module.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Object/Archive.h"
 #include "llvm/Object/ObjectFile.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/raw_ostream.h"
@@ -106,6 +109,32 @@ IRObjectFile::findBitcodeInMemBuffer(MemoryBufferRef Object) {
   }
 }
 
+Expected<std::vector<BitcodeModule>>
+IRObjectFile::findBitcodeInArchive(const Archive &A) {
+  std::vector<BitcodeModule> Mods;
+  Error Err = Error::success();
+  for (const Archive::Child &C : A.children(Err)) {
+    Expected<MemoryBufferRef> MemberOrErr = C.getMemoryBufferRef();
+    if (!MemberOrErr)
+      return MemberOrErr.takeError();
+    Expected<MemoryBufferRef> BCOrErr = findBitcodeInMemBuffer(*MemberOrErr);
+    if (!BCOrErr) {
+      // Fat archives mix bitcode with data files and ordinary objects;
+      // members without bitcode are expected, not an error.
+      consumeError(BCOrErr.takeError());
+      continue;
+    }
+    Expected<std::vector<BitcodeModule>> BMsOrErr =
+        getBitcodeModuleList(*BCOrErr);
+    if (!BMsOrErr)
+      return BMsOrErr.takeError();
+    Mods.insert(Mods.end(), BMsOrErr->begin(), BMsOrErr->end());
+  }
+  if (Err)
+    return std::move(Err);
+  return std::move(Mods);
+}
+
 Expected<std::unique_ptr<IRObjectFile>>
 IRObjectFile::create(MemoryBufferRef Object, LLVMContext &Context) {
   Expected<MemoryBufferRef> BCOrErr = findBitcodeInMemBuffer(Object);
@@ -153,3 +182,110 @@ Expected<IRSymtabFile> object::readIRSymtab(MemoryBufferRef MBRef) {
   F.TheReader = std::move(FCOrErr->TheReader);
   return std::move(F);
 }
+
+Expected<std::vector<IRSymtabFile>>
+object::readIRSymtabsFromArchive(const Archive &A) {
+  // Collect each member's bitcode contents first so the cache can be
+  // validated against the member count before any symbol table is built.
+  std::vector<BitcodeFileContents> BFCs;
+  Error Err = Error::success();
+  for (const Archive::Child &C : A.children(Err)) {
+    Expected<MemoryBufferRef> MemberOrErr = C.getMemoryBufferRef();
+    if (!MemberOrErr)
+      return MemberOrErr.takeError();
+    Expected<MemoryBufferRef> BCOrErr =
+        IRObjectFile::findBitcodeInMemBuffer(*MemberOrErr);
+    if (!BCOrErr) {
+      // Fat archives mix bitcode with data files and ordinary objects;
+      // members without bitcode are expected, not an error.
+      consumeError(BCOrErr.takeError());
+      continue;
+    }
+    Expected<BitcodeFileContents> BFCOrErr = getBitcodeFileContents(*BCOrErr);
+    if (!BFCOrErr)
+      return BFCOrErr.takeError();
+    BFCs.push_back(std::move(*BFCOrErr));
+  }
+  if (Err)
+    return std::move(Err);
+
+  // Identify the archive revision for cache validation when the archive is
+  // backed by a file on disk.
+  SmallString<128> CachePath;
+  uint64_t ArchiveSize = 0, ArchiveModTime = 0;
+  if (!A.getFileName().empty()) {
+    sys::fs::file_status Status;
+    if (!sys::fs::status(A.getFileName(), Status)) {
+      CachePath = A.getFileName();
+      CachePath += ".symtab";
+      ArchiveSize = Status.getSize();
+      ArchiveModTime =
+          Status.getLastModificationTime().time_since_epoch().count();
+    }
+  }
+
+  std::vector<irsymtab::FileContents> FCs;
+  bool FromCache = false;
+  if (!CachePath.empty()) {
+    Expected<std::vector<irsymtab::FileContents>> CachedOrErr =
+        irsymtab::readSymtabCache(CachePath, ArchiveSize, ArchiveModTime);
+    if (CachedOrErr) {
+      if (CachedOrErr->size() == BFCs.size()) {
+        bool Valid = true;
+        for (size_t I = 0; I != BFCs.size(); ++I)
+          if ((*CachedOrErr)[I].TheReader.getNumModules() !=
+              BFCs[I].Mods.size())
+            Valid = false;
+        if (Valid) {
+          FCs = std::move(*CachedOrErr);
+          FromCache = true;
+        }
+      }
+    } else {
+      // A missing or stale cache is expected; it is rebuilt below.
+      consumeError(CachedOrErr.takeError());
+    }
+  }
+
+  if (!FromCache) {
+    FCs.reserve(BFCs.size());
+    for (BitcodeFileContents &BFC : BFCs) {
+      Expected<irsymtab::FileContents> FCOrErr = irsymtab::readBitcode(BFC);
+      if (!FCOrErr)
+        return FCOrErr.takeError();
+      FCs.push_back(std::move(*FCOrErr));
+    }
+
+    if (!CachePath.empty()) {
+      std::vector<std::pair<StringRef, StringRef>> Blobs;
+      Blobs.reserve(FCs.size());
+      for (size_t I = 0; I != FCs.size(); ++I) {
+        // Members with an embedded symbol table leave the FileContents
+        // vectors empty and read directly out of the bitcode; serialize
+        // whichever copy the reader is using.
+        if (FCs[I].Symtab.empty())
+          Blobs.emplace_back(BFCs[I].Symtab, BFCs[I].StrtabForSymtab);
+        else
+          Blobs.emplace_back(
+              StringRef(FCs[I].Symtab.data(), FCs[I].Symtab.size()),
+              StringRef(FCs[I].Strtab.data(), FCs[I].Strtab.size()));
+      }
+      // Failing to populate the cache only loses the speedup next time.
+      if (Error E = irsymtab::writeSymtabCache(CachePath, Blobs, ArchiveSize,
+                                               ArchiveModTime))
+        consumeError(std::move(E));
+    }
+  }
+
+  std::vector<IRSymtabFile> Files;
+  Files.reserve(BFCs.size());
+  for (size_t I = 0; I != BFCs.size(); ++I) {
+    IRSymtabFile F;
+    F.Mods = std::move(BFCs[I].Mods);
+    F.Symtab = std::move(FCs[I].Symtab);
+    F.Strtab = std::move(FCs[I].Strtab);
+    F.TheReader = std::move(FCs[I].TheReader);
+    Files.push_back(std::move(F));
+  }
+  return std::move(Files);
+}
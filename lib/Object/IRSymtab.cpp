@@ -29,7 +29,11 @@
 #include "llvm/Object/SymbolicFile.h"
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/StringSaver.h"
 #include "llvm/Support/VCSRevision.h"
 #include "llvm/Support/raw_ostream.h"
@@ -407,3 +411,115 @@ Expected<FileContents> irsymtab::readBitcode(const BitcodeFileContents &BFC) {
 
   return std::move(FC);
 }
+
+// The archive symbol table cache is a flat little-endian container: magic,
+// container version, irsymtab format version, archive size and mtime,
+// producer string, then a (symtab, strtab) byte pair per bitcode member.
+static const char SymtabCacheMagic[8] = {'L', 'L', 'S', 'Y', 'M', 'T', 'A', 'B'};
+static const uint64_t SymtabCacheVersion = 1;
+
+Error irsymtab::writeSymtabCache(
+    StringRef Path, ArrayRef<std::pair<StringRef, StringRef>> Members,
+    uint64_t ArchiveSize, uint64_t ArchiveModTime) {
+  // Write to a temporary and rename into place so a concurrent reader never
+  // sees a partially written cache.
+  SmallString<128> TempModel(Path);
+  TempModel += "-%%%%%%";
+  Expected<sys::fs::TempFile> Temp = sys::fs::TempFile::create(TempModel);
+  if (!Temp)
+    return Temp.takeError();
+
+  {
+    raw_fd_ostream OS(Temp->FD, /*shouldClose=*/false);
+    support::endian::Writer W(OS, support::little);
+    OS.write(SymtabCacheMagic, sizeof(SymtabCacheMagic));
+    W.write<uint64_t>(SymtabCacheVersion);
+    W.write<uint64_t>(storage::Header::kCurrentVersion);
+    W.write<uint64_t>(ArchiveSize);
+    W.write<uint64_t>(ArchiveModTime);
+    StringRef Producer(kExpectedProducerName);
+    W.write<uint64_t>(Producer.size());
+    OS << Producer;
+    W.write<uint64_t>(Members.size());
+    for (const std::pair<StringRef, StringRef> &M : Members) {
+      W.write<uint64_t>(M.first.size());
+      W.write<uint64_t>(M.second.size());
+      OS << M.first << M.second;
+    }
+    if (OS.has_error()) {
+      std::error_code EC = OS.error();
+      OS.clear_error();
+      consumeError(Temp->discard());
+      return errorCodeToError(EC);
+    }
+  }
+
+  return Temp->keep(Path);
+}
+
+Expected<std::vector<FileContents>>
+irsymtab::readSymtabCache(StringRef Path, uint64_t ArchiveSize,
+                          uint64_t ArchiveModTime) {
+  auto StaleError = [] {
+    return make_error<StringError>("Symbol table cache is stale or malformed",
+                                   inconvertibleErrorCode());
+  };
+
+  ErrorOr<std::unique_ptr<MemoryBuffer>> MBOrErr = MemoryBuffer::getFile(Path);
+  if (!MBOrErr)
+    return errorCodeToError(MBOrErr.getError());
+  StringRef Buf = (*MBOrErr)->getBuffer();
+
+  auto ReadU64 = [&Buf](uint64_t &V) -> bool {
+    if (Buf.size() < sizeof(uint64_t))
+      return false;
+    V = support::endian::read64le(Buf.data());
+    Buf = Buf.drop_front(sizeof(uint64_t));
+    return true;
+  };
+  auto ReadBytes = [&Buf](uint64_t Size, StringRef &Bytes) -> bool {
+    if (Buf.size() < Size)
+      return false;
+    Bytes = Buf.take_front(Size);
+    Buf = Buf.drop_front(Size);
+    return true;
+  };
+
+  if (Buf.size() < sizeof(SymtabCacheMagic) ||
+      Buf.take_front(sizeof(SymtabCacheMagic)) !=
+          StringRef(SymtabCacheMagic, sizeof(SymtabCacheMagic)))
+    return StaleError();
+  Buf = Buf.drop_front(sizeof(SymtabCacheMagic));
+
+  uint64_t Version, IrsymtabVersion, Size, ModTime, ProducerSize, NumMembers;
+  StringRef Producer;
+  if (!ReadU64(Version) || !ReadU64(IrsymtabVersion) || !ReadU64(Size) ||
+      !ReadU64(ModTime) || !ReadU64(ProducerSize) ||
+      !ReadBytes(ProducerSize, Producer) || !ReadU64(NumMembers))
+    return StaleError();
+  if (Version != SymtabCacheVersion ||
+      IrsymtabVersion != storage::Header::kCurrentVersion ||
+      Producer != kExpectedProducerName || Size != ArchiveSize ||
+      ModTime != ArchiveModTime)
+    return StaleError();
+
+  std::vector<FileContents> Members;
+  Members.reserve(std::min<uint64_t>(NumMembers, Buf.size()));
+  for (uint64_t I = 0; I != NumMembers; ++I) {
+    uint64_t SymtabSize, StrtabSize;
+    StringRef Symtab, Strtab;
+    if (!ReadU64(SymtabSize) || !ReadU64(StrtabSize) ||
+        !ReadBytes(SymtabSize, Symtab) || !ReadBytes(StrtabSize, Strtab))
+      return StaleError();
+    // Copy the ranges out of the mapped cache; the reader requires aligned
+    // storage, which the heap-allocated vectors provide.
+    Members.emplace_back();
+    FileContents &FC = Members.back();
+    FC.Symtab.append(Symtab.begin(), Symtab.end());
+    FC.Strtab.append(Strtab.begin(), Strtab.end());
+    FC.TheReader = {{FC.Symtab.data(), FC.Symtab.size()},
+                    {FC.Strtab.data(), FC.Strtab.size()}};
+  }
+
+  return std::move(Members);
+}
@@ -38,6 +38,7 @@
 #include "llvm/Analysis/LoopAccessAnalysis.h"
 #include "llvm/Analysis/LoopCacheAnalysis.h"
 #include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/LoopNestSummary.h"
 #include "llvm/Analysis/MemoryDependenceAnalysis.h"
 #include "llvm/Analysis/MemorySSA.h"
 #include "llvm/Analysis/ModuleSummaryAnalysis.h"
@@ -77,6 +78,7 @@
 #include "llvm/Transforms/IPO/ForceFunctionAttrs.h"
 #include "llvm/Transforms/IPO/FunctionAttrs.h"
 #include "llvm/Transforms/IPO/FunctionImport.h"
+#include "llvm/Transforms/IPO/FunctionSpecialization.h"
 #include "llvm/Transforms/IPO/GlobalDCE.h"
 #include "llvm/Transforms/IPO/GlobalOpt.h"
 #include "llvm/Transforms/IPO/GlobalSplit.h"
@@ -169,6 +171,7 @@
 #include "llvm/Transforms/Utils/BreakCriticalEdges.h"
 #include "llvm/Transforms/Utils/CanonicalizeAliases.h"
 #include "llvm/Transforms/Utils/EntryExitInstrumenter.h"
+#include "llvm/Transforms/Utils/FunctionOptCache.h"
 #include "llvm/Transforms/Utils/LCSSA.h"
 #include "llvm/Transforms/Utils/LibCallsShrinkWrap.h"
 #include "llvm/Transforms/Utils/LoopSimplify.h"
@@ -202,6 +205,23 @@ static cl::opt<bool> EnableGVNSink(
     "enable-npm-gvn-sink", cl::init(false), cl::Hidden,
     cl::desc("Enable the GVN hoisting pass for the new PM (default = off)"));
 
+static cl::opt<bool> EnableFunctionSpecialization(
+    "enable-npm-function-specialization", cl::init(false), cl::Hidden,
+    cl::desc("Enable specializing functions on frequent constant arguments "
+             "for the new PM (default = off)"));
+
+static cl::opt<bool> EnableHotColdPipelines(
+    "enable-npm-hot-cold-pipelines", cl::init(false), cl::Hidden,
+    cl::desc("With profile data, run the full function optimization pipeline "
+             "only on functions that are not cold in the call graph and a "
+             "cheap cleanup pipeline on the cold ones (default = off)"));
+
+static cl::opt<bool> EnableFunctionOptCache(
+    "enable-npm-function-opt-cache", cl::init(false), cl::Hidden,
+    cl::desc("Run the function optimization pipeline on one representative "
+             "of each group of identical functions and reuse its optimized "
+             "body for the others (default = off)"));
+
 static cl::opt<bool> EnableUnrollAndJam(
     "enable-npm-unroll-and-jam", cl::init(false), cl::Hidden,
     cl::desc("Enable the Unroll and Jam pass for the new PM (default = off)"));
@@ -260,6 +280,21 @@ struct NoOpModulePass {
   static StringRef name() { return "NoOpModulePass"; }
 };
 
+/// Module pass that seeds CFG-derived function analyses, computed in
+/// parallel, into the function analysis manager before a sequential function
+/// pipeline runs. Running whole function passes concurrently is not possible
+/// because LLVMContext is shared mutable state, but the analyses handled by
+/// precomputeFunctionAnalyses only read the IR and so can be built off-thread.
+struct PrecomputeFunctionAnalysesPass {
+  PreservedAnalyses run(Module &M, ModuleAnalysisManager &AM) {
+    auto &FAM =
+        AM.getResult<FunctionAnalysisManagerModuleProxy>(M).getManager();
+    precomputeFunctionAnalyses(M, FAM, /*Force=*/true);
+    return PreservedAnalyses::all();
+  }
+  static StringRef name() { return "PrecomputeFunctionAnalysesPass"; }
+};
+
 /// No-op module analysis.
 class NoOpModuleAnalysis : public AnalysisInfoMixin<NoOpModuleAnalysis> {
   friend AnalysisInfoMixin<NoOpModuleAnalysis>;
@@ -339,6 +374,55 @@ AnalysisKey NoOpCGSCCAnalysis::Key;
 AnalysisKey NoOpFunctionAnalysis::Key;
 AnalysisKey NoOpLoopAnalysis::Key;
 
+/// Adaptor that runs one of two function pipelines on each function in the
+/// module depending on profile hotness: functions that are cold in the call
+/// graph get the cheap pipeline, everything else the full one. Without
+/// profile data every function gets the full pipeline.
+class HotColdFunctionPassAdaptor
+    : public PassInfoMixin<HotColdFunctionPassAdaptor> {
+  FunctionPassManager HotFPM;
+  FunctionPassManager ColdFPM;
+
+public:
+  HotColdFunctionPassAdaptor(FunctionPassManager HotFPM,
+                             FunctionPassManager ColdFPM)
+      : HotFPM(std::move(HotFPM)), ColdFPM(std::move(ColdFPM)) {}
+
+  PreservedAnalyses run(Module &M, ModuleAnalysisManager &AM) {
+    FunctionAnalysisManager &FAM =
+        AM.getResult<FunctionAnalysisManagerModuleProxy>(M).getManager();
+    ProfileSummaryInfo &PSI = AM.getResult<ProfileSummaryAnalysis>(M);
+
+    PassInstrumentation PI = AM.getResult<PassInstrumentationAnalysis>(M);
+
+    PreservedAnalyses PA = PreservedAnalyses::all();
+    for (Function &F : M) {
+      if (F.isDeclaration())
+        continue;
+
+      bool IsCold =
+          PSI.hasProfileSummary() &&
+          PSI.isFunctionColdInCallGraph(
+              &F, FAM.getResult<BlockFrequencyAnalysis>(F));
+      FunctionPassManager &FPM = IsCold ? ColdFPM : HotFPM;
+
+      if (!PI.runBeforePass<Function>(FPM, F))
+        continue;
+      PreservedAnalyses PassPA = FPM.run(F, FAM);
+      PI.runAfterPass(FPM, F);
+
+      // As in ModuleToFunctionPassAdaptor, handle function analysis
+      // invalidation directly and fold the rest into the module-level set.
+      FAM.invalidate(F, PassPA);
+      PA.intersect(std::move(PassPA));
+    }
+
+    PA.preserveSet<AllAnalysesOn<Function>>();
+    PA.preserve<FunctionAnalysisManagerModuleProxy>();
+    return PA;
+  }
+};
+
 } // End anonymous namespace.
 
 void PassBuilder::invokePeepholeEPCallbacks(
@@ -724,6 +808,11 @@ PassBuilder::buildModuleSimplificationPipeline(OptimizationLevel Level,
                                            true /* SamplePGO */));
   }
 
+  // Specialize hot functions on frequently passed constant arguments before
+  // interprocedural constant propagation so the clones benefit from it.
+  if (EnableFunctionSpecialization)
+    MPM.addPass(FunctionSpecializationPass());
+
   // Interprocedural constant propagation now that basic cleanup has occurred
   // and prior to optimizing globals.
   // FIXME: This position in the pipeline hasn't been carefully considered in
@@ -1004,7 +1093,18 @@ ModulePassManager PassBuilder::buildModuleOptimizationPipeline(
     C(OptimizePM, Level);
 
   // Add the core optimizing pipeline.
-  MPM.addPass(createModuleToFunctionPassAdaptor(std::move(OptimizePM)));
+  if (EnableHotColdPipelines) {
+    // Cold functions only get a light cleanup of what the simplification
+    // phase (which also performed the inlining) already produced.
+    FunctionPassManager ColdPM(DebugLogging);
+    ColdPM.addPass(InstCombinePass());
+    ColdPM.addPass(SimplifyCFGPass());
+    MPM.addPass(
+        HotColdFunctionPassAdaptor(std::move(OptimizePM), std::move(ColdPM)));
+  } else if (EnableFunctionOptCache)
+    MPM.addPass(FunctionOptCachePass(std::move(OptimizePM)));
+  else
+    MPM.addPass(createModuleToFunctionPassAdaptor(std::move(OptimizePM)));
 
   MPM.addPass(CGProfilePass());
 
@@ -1656,6 +1756,8 @@ static bool isModulePassName(StringRef Name, CallbacksT &Callbacks) {
     return true;
   if (Name == "function")
     return true;
+  if (Name == "cached-function")
+    return true;
 
   // Explicitly handle custom-parsed pass names.
   if (parseRepeatPassName(Name))
@@ -1836,6 +1938,14 @@ Error PassBuilder::parseModulePass(ModulePassManager &MPM,
       MPM.addPass(createModuleToFunctionPassAdaptor(std::move(FPM)));
       return Error::success();
     }
+    if (Name == "cached-function") {
+      FunctionPassManager FPM(DebugLogging);
+      if (auto Err = parseFunctionPassPipeline(FPM, InnerPipeline,
+                                               VerifyEachPass, DebugLogging))
+        return Err;
+      MPM.addPass(FunctionOptCachePass(std::move(FPM)));
+      return Error::success();
+    }
     if (auto Count = parseRepeatPassName(Name)) {
       ModulePassManager NestedMPM(DebugLogging);
       if (auto Err = parseModulePassPipeline(NestedMPM, InnerPipeline,
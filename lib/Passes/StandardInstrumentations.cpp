@@ -14,6 +14,8 @@
 
 #include "llvm/Passes/StandardInstrumentations.h"
 #include "llvm/ADT/Optional.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/CallGraphSCCPass.h"
 #include "llvm/Analysis/LazyCallGraph.h"
 #include "llvm/Analysis/LoopInfo.h"
@@ -21,12 +23,21 @@
 #include "llvm/IR/IRPrintingPasses.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/PassInstrumentation.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/Format.h"
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/raw_ostream.h"
 
 using namespace llvm;
 
+// Profile how often analysis results are invalidated and recomputed, and
+// print a report ranking analyses by wasted recomputation time at exit.
+static cl::opt<bool> ProfileAnalysisInvalidation(
+    "profile-analysis-invalidation", cl::init(false), cl::Hidden,
+    cl::desc("Profile analysis invalidation and recomputation in the new "
+             "pass manager and print a report at exit"));
+
 namespace {
 
 /// Extracting Module out of \p IR unit. Also fills a textual description
@@ -235,8 +246,152 @@ void PrintIRInstrumentation::registerCallbacks(
   }
 }
 
+/// Extract a name for \p IR for use in profile keys and reports.
+static std::string getIRName(Any IR) {
+  if (any_isa<const Module *>(IR))
+    return any_cast<const Module *>(IR)->getName().str();
+
+  if (any_isa<const Function *>(IR))
+    return any_cast<const Function *>(IR)->getName().str();
+
+  if (any_isa<const LazyCallGraph::SCC *>(IR))
+    return any_cast<const LazyCallGraph::SCC *>(IR)->getName();
+
+  if (any_isa<const Loop *>(IR))
+    return any_cast<const Loop *>(IR)->getName().str();
+
+  return "<unknown IR unit>";
+}
+
+AnalysisInvalidationProfiler::~AnalysisInvalidationProfiler() {
+  if (Enabled)
+    print(*CreateInfoOutputFile());
+}
+
+void AnalysisInvalidationProfiler::handleBeforePass(StringRef PassID) {
+  PassStack.push_back(PassID.str());
+}
+
+void AnalysisInvalidationProfiler::handleAfterPass(StringRef PassID) {
+  // Another BeforePass callback may have skipped a pass after our push, in
+  // which case no After callback was run for it; pop until the matching
+  // entry is found.
+  while (!PassStack.empty()) {
+    bool Found = PassStack.back() == PassID;
+    PassStack.pop_back();
+    if (Found)
+      break;
+  }
+}
+
+void AnalysisInvalidationProfiler::handleBeforeAnalysis(StringRef AnalysisID,
+                                                        Any IR) {
+  AnalysisStack.push_back({(AnalysisID + "|" + getIRName(IR)).str(),
+                           TimeRecord::getCurrentTime(/*Start=*/true)});
+}
+
+void AnalysisInvalidationProfiler::handleAfterAnalysis(StringRef AnalysisID,
+                                                       Any IR) {
+  assert(!AnalysisStack.empty() && "unbalanced analysis instrumentation");
+  std::string Key = std::move(AnalysisStack.back().first);
+  TimeRecord Start = AnalysisStack.back().second;
+  AnalysisStack.pop_back();
+
+  AnalysisStats &S = Stats[AnalysisID];
+  ++S.Computations;
+  if (!EverComputed.insert(Key).second) {
+    ++S.Recomputations;
+    S.RecomputeTime += TimeRecord::getCurrentTime(/*Start=*/false).getWallTime() -
+                       Start.getWallTime();
+  }
+}
+
+void AnalysisInvalidationProfiler::handleAnalysisInvalidated(
+    StringRef AnalysisID, StringRef IRName) {
+  AnalysisStats &S = Stats[AnalysisID];
+  ++S.Invalidations;
+  StringRef Pass =
+      PassStack.empty() ? StringRef("<no pass running>") : StringRef(PassStack.back());
+  ++S.InvalidatingPasses[Pass];
+  (void)IRName;
+}
+
+void AnalysisInvalidationProfiler::print(raw_ostream &OS) const {
+  std::vector<const StringMapEntry<AnalysisStats> *> Ranked;
+  for (const auto &E : Stats)
+    if (E.second.Invalidations || E.second.Recomputations)
+      Ranked.push_back(&E);
+  if (Ranked.empty())
+    return;
+
+  // Rank by wasted recomputation time; break ties deterministically.
+  llvm::stable_sort(Ranked, [](const StringMapEntry<AnalysisStats> *A,
+                               const StringMapEntry<AnalysisStats> *B) {
+    if (A->second.RecomputeTime != B->second.RecomputeTime)
+      return A->second.RecomputeTime > B->second.RecomputeTime;
+    if (A->second.Recomputations != B->second.Recomputations)
+      return A->second.Recomputations > B->second.Recomputations;
+    return A->first() < B->first();
+  });
+
+  OS << "===" << std::string(73, '-') << "===\n"
+     << "                       Analysis Invalidation Profile\n"
+     << "===" << std::string(73, '-') << "===\n"
+     << "  Wasted time is wall time spent recomputing a result that had "
+        "already\n  been computed for the same IR unit.\n\n";
+
+  for (const auto *E : Ranked) {
+    const AnalysisStats &S = E->second;
+    OS << format("  %8.4fs wasted  %6u recomputed  %6u invalidated  %6u runs"
+                 "  ",
+                 S.RecomputeTime, S.Recomputations, S.Invalidations,
+                 S.Computations)
+       << E->first() << "\n";
+
+    // Show which passes triggered the invalidations, biggest offender first.
+    std::vector<std::pair<StringRef, unsigned>> Triggers;
+    for (const auto &P : S.InvalidatingPasses)
+      Triggers.push_back({P.first(), P.second});
+    llvm::stable_sort(Triggers, [](const std::pair<StringRef, unsigned> &A,
+                                   const std::pair<StringRef, unsigned> &B) {
+      if (A.second != B.second)
+        return A.second > B.second;
+      return A.first < B.first;
+    });
+    for (const auto &T : Triggers)
+      OS << "              invalidated " << T.second << " time(s) by "
+         << T.first << "\n";
+  }
+  OS.flush();
+}
+
+void AnalysisInvalidationProfiler::registerCallbacks(
+    PassInstrumentationCallbacks &PIC) {
+  Enabled = ProfileAnalysisInvalidation;
+  if (!Enabled)
+    return;
+
+  PIC.registerBeforePassCallback([this](StringRef P, Any) {
+    this->handleBeforePass(P);
+    return true;
+  });
+  PIC.registerAfterPassCallback(
+      [this](StringRef P, Any) { this->handleAfterPass(P); });
+  PIC.registerAfterPassInvalidatedCallback(
+      [this](StringRef P) { this->handleAfterPass(P); });
+  PIC.registerBeforeAnalysisCallback(
+      [this](StringRef A, Any IR) { this->handleBeforeAnalysis(A, IR); });
+  PIC.registerAfterAnalysisCallback(
+      [this](StringRef A, Any IR) { this->handleAfterAnalysis(A, IR); });
+  PIC.registerAnalysisInvalidatedCallback(
+      [this](StringRef A, StringRef IRName) {
+        this->handleAnalysisInvalidated(A, IRName);
+      });
+}
+
 void StandardInstrumentations::registerCallbacks(
     PassInstrumentationCallbacks &PIC) {
   PrintIR.registerCallbacks(PIC);
   TimePasses.registerCallbacks(PIC);
+  AnalysisInvalidation.registerCallbacks(PIC);
 }
@@ -19,6 +19,7 @@
 #include "llvm/ADT/SmallBitVector.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/ProfileData/Coverage/CoverageMappingReader.h"
 #include "llvm/ProfileData/InstrProfReader.h"
 #include "llvm/Support/Debug.h"
@@ -27,6 +28,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
@@ -205,7 +207,7 @@ ArrayRef<unsigned> CoverageMapping::getImpreciseRecordIndicesForFilename(
 
 Error CoverageMapping::loadFunctionRecord(
     const CoverageMappingRecord &Record,
-    IndexedInstrProfReader &ProfileReader) {
+    IndexedInstrProfReader &ProfileReader, bool MaterializeRegions) {
   StringRef OrigFuncName = Record.FunctionName;
   if (OrigFuncName.empty())
     return make_error<CoverageMapError>(coveragemap_error::malformed);
@@ -230,6 +232,11 @@ Error CoverageMapping::loadFunctionRecord(
   }
   Ctx.setCounts(Counts);
 
+  // The profile lookup above is all that is needed for records whose regions
+  // the caller does not want.
+  if (!MaterializeRegions)
+    return Error::success();
+
   assert(!Record.MappingRegions.empty() && "Function has no regions");
 
   // This coverage record is a zero region for a function that's unused in
@@ -277,15 +284,31 @@ Error CoverageMapping::loadFunctionRecord(
 
 Expected<std::unique_ptr<CoverageMapping>> CoverageMapping::load(
     ArrayRef<std::unique_ptr<CoverageMappingReader>> CoverageReaders,
-    IndexedInstrProfReader &ProfileReader) {
+    IndexedInstrProfReader &ProfileReader, ArrayRef<StringRef> SourceFiles) {
   auto Coverage = std::unique_ptr<CoverageMapping>(new CoverageMapping());
 
+  // Match requested source files by their last path component, so a path
+  // remapping applied by the client after loading cannot exclude records we
+  // actually need.
+  StringSet<> SourceBasenames;
+  for (StringRef SourceFile : SourceFiles)
+    SourceBasenames.insert(sys::path::filename(SourceFile));
+
   for (const auto &CoverageReader : CoverageReaders) {
     for (auto RecordOrErr : *CoverageReader) {
       if (Error E = RecordOrErr.takeError())
         return std::move(E);
       const auto &Record = *RecordOrErr;
-      if (Error E = Coverage->loadFunctionRecord(Record, ProfileReader))
+      // Records touching none of the requested files still get their profile
+      // lookup, so counter mismatches are diagnosed as in a full load, but
+      // their regions are not materialized.
+      bool WantRegions =
+          SourceBasenames.empty() ||
+          llvm::any_of(Record.Filenames, [&](StringRef Filename) {
+            return SourceBasenames.count(sys::path::filename(Filename));
+          });
+      if (Error E =
+              Coverage->loadFunctionRecord(Record, ProfileReader, WantRegions))
         return std::move(E);
     }
   }
@@ -305,7 +328,8 @@ static Error handleMaybeNoDataFoundError(Error E) {
 
 Expected<std::unique_ptr<CoverageMapping>>
 CoverageMapping::load(ArrayRef<StringRef> ObjectFilenames,
-                      StringRef ProfileFilename, ArrayRef<StringRef> Arches) {
+                      StringRef ProfileFilename, ArrayRef<StringRef> Arches,
+                      ArrayRef<StringRef> SourceFiles) {
   auto ProfileReaderOrErr = IndexedInstrProfReader::create(ProfileFilename);
   if (Error E = ProfileReaderOrErr.takeError())
     return std::move(E);
@@ -337,7 +361,15 @@ CoverageMapping::load(ArrayRef<StringRef> ObjectFilenames,
   // had coverage data. Return an error in the latter case.
   if (Readers.empty() && !ObjectFilenames.empty())
     return make_error<CoverageMapError>(coveragemap_error::no_data_found);
-  return load(Readers, *ProfileReader);
+  auto CoverageOrErr = load(Readers, *ProfileReader, SourceFiles);
+  if (Error E = CoverageOrErr.takeError())
+    return std::move(E);
+  // If the requested source files matched no records (e.g. they are not
+  // translation units the binary was built from), degrade to a full load so
+  // the caller can diagnose the situation instead of seeing empty coverage.
+  if (!SourceFiles.empty() && (*CoverageOrErr)->Functions.empty())
+    return load(ObjectFilenames, ProfileFilename, Arches);
+  return CoverageOrErr;
 }
 
 namespace {
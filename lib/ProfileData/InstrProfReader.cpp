@@ -38,9 +38,16 @@
 using namespace llvm;
 
 static Expected<std::unique_ptr<MemoryBuffer>>
-setupMemoryBuffer(const Twine &Path) {
+setupMemoryBuffer(const Twine &Path, bool IsLive = false) {
+  // A live profile is being updated in place by a running instrumented
+  // process. Mark the buffer volatile so it is copied into memory rather than
+  // memory-mapped; the copy is a stable snapshot that concurrent counter
+  // updates cannot change under the reader.
   ErrorOr<std::unique_ptr<MemoryBuffer>> BufferOrErr =
-      MemoryBuffer::getFileOrSTDIN(Path);
+      IsLive ? MemoryBuffer::getFile(Path, /*FileSize=*/-1,
+                                     /*RequiresNullTerminator=*/true,
+                                     /*IsVolatile=*/true)
+             : MemoryBuffer::getFileOrSTDIN(Path);
   if (std::error_code EC = BufferOrErr.getError())
     return errorCodeToError(EC);
   return std::move(BufferOrErr.get());
@@ -51,9 +58,9 @@ static Error initializeReader(InstrProfReader &Reader) {
 }
 
 Expected<std::unique_ptr<InstrProfReader>>
-InstrProfReader::create(const Twine &Path) {
+InstrProfReader::create(const Twine &Path, bool IsLive) {
   // Set up the buffer to read.
-  auto BufferOrError = setupMemoryBuffer(Path);
+  auto BufferOrError = setupMemoryBuffer(Path, IsLive);
   if (Error E = BufferOrError.takeError())
     return std::move(E);
   return InstrProfReader::create(std::move(BufferOrError.get()));
@@ -254,6 +254,11 @@ void InstrProfWriter::mergeRecordsFromWriter(InstrProfWriter &&IPW,
   for (auto &I : IPW.FunctionData)
     for (auto &Func : I.getValue())
       addRecord(I.getKey(), Func.first, std::move(Func.second), 1, Warn);
+
+  // Release the source writer's storage eagerly. When writers are merged
+  // hierarchically the source may otherwise hold its (moved-from) map skeleton
+  // and name storage until all of the merge steps finish.
+  IPW.FunctionData.clear();
 }
 
 bool InstrProfWriter::shouldEncodeData(const ProfilingData &PD) {
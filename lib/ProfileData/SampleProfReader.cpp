@@ -541,20 +541,33 @@ std::error_code SampleProfileReaderExtBinary::readFuncProfiles() {
   }
 
   if (Remapper) {
+    // With a remapper, any profile name may remap to a name used by the
+    // module, so the whole offset table has to be scanned.
     for (auto Name : FuncsToUse) {
       Remapper->insert(Name);
     }
-  }
-
-  for (auto NameOffset : FuncOffsetTable) {
-    auto FuncName = NameOffset.first;
-    if (!FuncsToUse.count(FuncName) &&
-        (!Remapper || !Remapper->exist(FuncName)))
-      continue;
-    const uint8_t *FuncProfileAddr = Start + NameOffset.second;
-    assert(FuncProfileAddr < End && "out of LBRProfile section");
-    if (std::error_code EC = readFuncProfile(FuncProfileAddr))
-      return EC;
+    for (auto NameOffset : FuncOffsetTable) {
+      auto FuncName = NameOffset.first;
+      if (!FuncsToUse.count(FuncName) && !Remapper->exist(FuncName))
+        continue;
+      const uint8_t *FuncProfileAddr = Start + NameOffset.second;
+      assert(FuncProfileAddr < End && "out of LBRProfile section");
+      if (std::error_code EC = readFuncProfile(FuncProfileAddr))
+        return EC;
+    }
+  } else {
+    // Without a remapper, look the module's functions up directly so the
+    // work is proportional to the module, not to a (potentially much larger)
+    // fleet-wide profile.
+    for (auto Name : FuncsToUse) {
+      auto iter = FuncOffsetTable.find(Name);
+      if (iter == FuncOffsetTable.end())
+        continue;
+      const uint8_t *FuncProfileAddr = Start + iter->second;
+      assert(FuncProfileAddr < End && "out of LBRProfile section");
+      if (std::error_code EC = readFuncProfile(FuncProfileAddr))
+        return EC;
+    }
   }
 
   Data = End;
@@ -1454,6 +1454,32 @@ void APInt::divide(const WordType *LHS, unsigned lhsWords, const WordType *RHS,
                    unsigned rhsWords, WordType *Quotient, WordType *Remainder) {
   assert(lhsWords >= rhsWords && "Fractional result");
 
+#if defined(__SIZEOF_INT128__)
+  // Values that fit in two words divide directly at 128 bits; this covers the
+  // very common i128 case without decomposing into 32-bit digits and without
+  // any scratch buffers.
+  if (lhsWords <= 2 && rhsWords <= 2) {
+    unsigned __int128 Dividend = LHS[0];
+    if (lhsWords == 2)
+      Dividend |= (unsigned __int128)LHS[1] << 64;
+    unsigned __int128 Divisor = RHS[0];
+    if (rhsWords == 2)
+      Divisor |= (unsigned __int128)RHS[1] << 64;
+    assert(Divisor != 0 && "Divide by zero?");
+    if (Quotient) {
+      unsigned __int128 Q128 = Dividend / Divisor;
+      for (unsigned i = 0; i != lhsWords; ++i)
+        Quotient[i] = (uint64_t)(Q128 >> (64 * i));
+    }
+    if (Remainder) {
+      unsigned __int128 R128 = Dividend % Divisor;
+      for (unsigned i = 0; i != rhsWords; ++i)
+        Remainder[i] = (uint64_t)(R128 >> (64 * i));
+    }
+    return;
+  }
+#endif
+
   // First, compose the values into an array of 32-bit words instead of
   // 64-bit words. This is a necessity of both the "short division" algorithm
   // and the Knuth "classical algorithm" which requires there to be native
@@ -144,6 +144,13 @@ public:
   // ParseCommandLineOptions actually runs.
   SmallVector<Option*, 4> DefaultOptions;
 
+  // Options whose registration was deferred from their global constructor.
+  // They are materialized into the per-subcommand maps by
+  // flushPendingOptions() the first time those maps are consulted, so the
+  // thousands of cl::opt globals a tool links cost one push_back each at
+  // static-init time instead of hashing and duplicate checking.
+  SmallVector<Option *, 0> PendingOptions;
+
   // This collects the different option categories that have been registered.
   SmallPtrSet<OptionCategory *, 16> RegisteredOptionCategories;
 
@@ -242,7 +249,14 @@ public:
       DefaultOptions.push_back(O);
       return;
     }
+    if (!ProcessDefaultOption) {
+      PendingOptions.push_back(O);
+      return;
+    }
+    addOptionNow(O);
+  }
 
+  void addOptionNow(Option *O) {
     if (O->Subs.empty()) {
       addOption(O, &*TopLevelSubCommand);
     } else {
@@ -251,6 +265,14 @@ public:
     }
   }
 
+  // Materialize deferred registrations. Must be called before the
+  // per-subcommand option maps are read.
+  void flushPendingOptions() {
+    for (Option *O : PendingOptions)
+      addOptionNow(O);
+    PendingOptions.clear();
+  }
+
   void removeOption(Option *O, SubCommand *SC) {
     SmallVector<StringRef, 16> OptionNames;
     O->getExtraOptionNames(OptionNames);
@@ -285,6 +307,13 @@ public:
   }
 
   void removeOption(Option *O) {
+    // If the option was never materialized, dropping the deferred
+    // registration is all there is to do.
+    auto Pending = find(PendingOptions, O);
+    if (Pending != PendingOptions.end()) {
+      PendingOptions.erase(Pending);
+      return;
+    }
     if (O->Subs.empty())
       removeOption(O, &*TopLevelSubCommand);
     else {
@@ -324,6 +353,10 @@ public:
   }
 
   void updateArgStr(Option *O, StringRef NewName) {
+    // A still-deferred option is in no map yet; it will register under the
+    // new name when materialized.
+    if (is_contained(PendingOptions, O))
+      return;
     if (O->Subs.empty())
       updateArgStr(O, NewName, &*TopLevelSubCommand);
     else {
@@ -1257,6 +1290,7 @@ bool CommandLineParser::ParseCommandLineOptions(int argc,
                                                 StringRef Overview,
                                                 raw_ostream *Errs,
                                                 bool LongOptionsUseDoubleDash) {
+  flushPendingOptions();
   assert(hasOptions() && "No options specified!");
 
   // Expand response files.
@@ -1432,6 +1466,18 @@ bool CommandLineParser::ParseCommandLineOptions(int argc,
         Handler = HandlePrefixedOrGroupedOption(ArgName, Value, ErrorParsing,
                                                 OptionsMap);
 
+      // A handler that already ran (e.g. -load) may have registered new
+      // options; materialize them and retry before declaring the argument
+      // unknown.
+      if (!Handler && !PendingOptions.empty()) {
+        flushPendingOptions();
+        Handler = LookupLongOption(*ChosenSubCommand, ArgName, Value,
+                                   LongOptionsUseDoubleDash, HaveDoubleDash);
+        if (!Handler && !(LongOptionsUseDoubleDash && HaveDoubleDash))
+          Handler = HandlePrefixedOrGroupedOption(ArgName, Value, ErrorParsing,
+                                                  OptionsMap);
+      }
+
       // Otherwise, look for the closest available option to report to the user
       // in the upcoming error.
       if (!Handler && SinkOpts.empty())
@@ -2452,6 +2498,7 @@ void cl::AddExtraVersionPrinter(VersionPrinterTy func) {
 }
 
 StringMap<Option *> &cl::getRegisteredOptions(SubCommand &Sub) {
+  GlobalParser->flushPendingOptions();
   auto &Subs = GlobalParser->RegisteredSubCommands;
   (void)Subs;
   assert(is_contained(Subs, &Sub));
@@ -2464,6 +2511,7 @@ cl::getRegisteredSubcommands() {
 }
 
 void cl::HideUnrelatedOptions(cl::OptionCategory &Category, SubCommand &Sub) {
+  GlobalParser->flushPendingOptions();
   for (auto &I : Sub.OptionsMap) {
     for (auto &Cat : I.second->Categories) {
       if (Cat != &Category &&
@@ -2475,6 +2523,7 @@ void cl::HideUnrelatedOptions(cl::OptionCategory &Category, SubCommand &Sub) {
 
 void cl::HideUnrelatedOptions(ArrayRef<const cl::OptionCategory *> Categories,
                               SubCommand &Sub) {
+  GlobalParser->flushPendingOptions();
   for (auto &I : Sub.OptionsMap) {
     for (auto &Cat : I.second->Categories) {
       if (find(Categories, Cat) == Categories.end() && Cat != &GenericCategory)
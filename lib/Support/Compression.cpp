@@ -17,6 +17,8 @@
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/ThreadPool.h"
+#include <vector>
 #if LLVM_ENABLE_ZLIB == 1 && HAVE_ZLIB_H
 #include <zlib.h>
 #endif
@@ -60,6 +62,89 @@ Error zlib::compress(StringRef InputBuffer,
   return Res ? createError(convertZlibCodeToString(Res)) : Error::success();
 }
 
+Error zlib::compressParallel(StringRef InputBuffer,
+                             SmallVectorImpl<char> &CompressedBuffer, int Level,
+                             size_t ChunkSize) {
+  assert(ChunkSize > 0 && "chunk size must be positive");
+  // Small inputs are not worth the thread and stitching overhead.
+  if (InputBuffer.size() <= ChunkSize)
+    return compress(InputBuffer, CompressedBuffer, Level);
+
+  // Deflate each chunk as an independent raw-deflate stream terminated by a
+  // full flush, which ends its output on a byte boundary so the pieces can be
+  // concatenated into one continuous deflate stream (the scheme pigz uses).
+  struct Chunk {
+    SmallVector<char, 0> Deflated;
+    uint32_t Adler = 0;
+    int Result = Z_OK;
+  };
+  size_t NumChunks = (InputBuffer.size() + ChunkSize - 1) / ChunkSize;
+  std::vector<Chunk> Chunks(NumChunks);
+
+  ThreadPool Pool;
+  for (size_t I = 0; I != NumChunks; ++I) {
+    StringRef Input = InputBuffer.substr(I * ChunkSize, ChunkSize);
+    Chunk &C = Chunks[I];
+    Pool.async([Input, Level, &C] {
+      z_stream Strm = {};
+      C.Result = deflateInit2(&Strm, Level, Z_DEFLATED, -15 /* raw deflate */,
+                              8, Z_DEFAULT_STRATEGY);
+      if (C.Result != Z_OK)
+        return;
+      // deflateBound covers a deflate-everything call; leave headroom for the
+      // empty stored block the full flush appends.
+      C.Deflated.resize(deflateBound(&Strm, Input.size()) + 16);
+      Strm.next_in = (Bytef *)const_cast<char *>(Input.data());
+      Strm.avail_in = Input.size();
+      Strm.next_out = (Bytef *)C.Deflated.data();
+      Strm.avail_out = C.Deflated.size();
+      int Res = deflate(&Strm, Z_FULL_FLUSH);
+      if (Res == Z_OK && Strm.avail_in == 0) {
+        __msan_unpoison(C.Deflated.data(), Strm.total_out);
+        C.Deflated.resize(Strm.total_out);
+        C.Adler = ::adler32(::adler32(0, nullptr, 0),
+                            (const Bytef *)Input.data(), Input.size());
+      } else {
+        C.Result = Res == Z_OK ? Z_BUF_ERROR : Res;
+      }
+      deflateEnd(&Strm);
+    });
+  }
+  Pool.wait();
+
+  size_t DeflatedSize = 0;
+  for (const Chunk &C : Chunks) {
+    if (C.Result != Z_OK)
+      return createError(convertZlibCodeToString(C.Result));
+    DeflatedSize += C.Deflated.size();
+  }
+
+  CompressedBuffer.clear();
+  CompressedBuffer.reserve(DeflatedSize + 8);
+  // zlib header: CMF = deflate with a 32K window, FLG advertises the level
+  // and carries a check value making the 16-bit header divisible by 31.
+  unsigned LevelFlags = Level < 2 ? 0 : Level < 6 ? 1 : Level == 6 ? 2 : 3;
+  unsigned Header = (0x78 << 8) | (LevelFlags << 6);
+  if (Header % 31)
+    Header += 31 - Header % 31;
+  CompressedBuffer.push_back(char(Header >> 8));
+  CompressedBuffer.push_back(char(Header & 0xFF));
+  uLong Adler = ::adler32(0, nullptr, 0);
+  for (size_t I = 0; I != NumChunks; ++I) {
+    const Chunk &C = Chunks[I];
+    CompressedBuffer.append(C.Deflated.begin(), C.Deflated.end());
+    size_t Len = std::min(ChunkSize, InputBuffer.size() - I * ChunkSize);
+    Adler = ::adler32_combine(Adler, C.Adler, Len);
+  }
+  // A final fixed-Huffman block with just an end-of-block marker terminates
+  // the deflate stream, followed by the combined Adler-32 of the input.
+  CompressedBuffer.push_back('\x03');
+  CompressedBuffer.push_back('\x00');
+  for (int Shift = 24; Shift >= 0; Shift -= 8)
+    CompressedBuffer.push_back(char((Adler >> Shift) & 0xFF));
+  return Error::success();
+}
+
 Error zlib::uncompress(StringRef InputBuffer, char *UncompressedBuffer,
                        size_t &UncompressedSize) {
   int Res =
@@ -91,6 +176,11 @@ Error zlib::compress(StringRef InputBuffer,
                      SmallVectorImpl<char> &CompressedBuffer, int Level) {
   llvm_unreachable("zlib::compress is unavailable");
 }
+Error zlib::compressParallel(StringRef InputBuffer,
+                             SmallVectorImpl<char> &CompressedBuffer, int Level,
+                             size_t ChunkSize) {
+  llvm_unreachable("zlib::compressParallel is unavailable");
+}
 Error zlib::uncompress(StringRef InputBuffer, char *UncompressedBuffer,
                        size_t &UncompressedSize) {
   llvm_unreachable("zlib::uncompress is unavailable");
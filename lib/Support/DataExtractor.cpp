@@ -192,6 +192,28 @@ uint64_t DataExtractor::getULEB128(uint64_t *offset_ptr,
   return result;
 }
 
+size_t DataExtractor::getULEB128Array(uint64_t *offset_ptr,
+                                      MutableArrayRef<uint64_t> Dst,
+                                      llvm::Error *Err) const {
+  assert(*offset_ptr <= Data.size());
+  ErrorAsOutParameter ErrAsOut(Err);
+  if (isError(Err))
+    return 0;
+
+  const char *error = nullptr;
+  const uint8_t *p =
+      reinterpret_cast<const uint8_t *>(Data.data() + *offset_ptr);
+  const uint8_t *end =
+      reinterpret_cast<const uint8_t *>(Data.data() + Data.size());
+  size_t Count = decodeULEB128Array(p, end, Dst, &error);
+  *offset_ptr = p - reinterpret_cast<const uint8_t *>(Data.data());
+  if (Count != Dst.size() && Err)
+    *Err = createStringError(errc::illegal_byte_sequence,
+                             error ? error
+                                   : "unexpected end of data in uleb128 array");
+  return Count;
+}
+
 int64_t DataExtractor::getSLEB128(uint64_t *offset_ptr) const {
   assert(*offset_ptr <= Data.size());
 
@@ -662,7 +662,15 @@ Expected<size_t> FileCheckPattern::match(StringRef Buffer, size_t &MatchLen,
   unsigned int Flags = Regex::Newline;
   if (IgnoreCase)
     Flags |= Regex::IgnoreCase;
-  if (!Regex(RegExToMatch, Flags).match(Buffer, &MatchInfo))
+  // Reuse the compiled regex from the previous match unless substitutions
+  // produced different regex text. CHECK-DAG and CHECK-NOT in particular can
+  // match the same pattern many times, and recompiling it each time dominates
+  // the cost of matching large inputs.
+  if (!CompiledRegEx || StringRef(CompiledRegExStr) != RegExToMatch) {
+    CompiledRegExStr = RegExToMatch;
+    CompiledRegEx = std::make_shared<Regex>(CompiledRegExStr, Flags);
+  }
+  if (!CompiledRegEx->match(Buffer, &MatchInfo))
     return make_error<FileCheckNotFoundError>();
 
   // Successful regex match.
@@ -19,6 +19,7 @@
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/Regex.h"
 #include "llvm/Support/SourceMgr.h"
 #include <map>
 #include <string>
@@ -372,6 +373,16 @@ class FileCheckPattern {
   /// a fixed string to match.
   std::string RegExStr;
 
+  /// Compiled form of the regex last matched together with the exact text it
+  /// was compiled from. Patterns are matched repeatedly (CHECK-DAG retries
+  /// after overlapping matches, CHECK-NOT scans), and compiling a regex is far
+  /// more expensive than executing it, so match() compiles lazily on first use
+  /// and recompiles only when substitutions change the regex text. Mutable
+  /// because this is purely a cache and match() is const; a shared_ptr so the
+  /// pattern stays copyable and copies share the compiled regex.
+  mutable std::string CompiledRegExStr;
+  mutable std::shared_ptr<Regex> CompiledRegEx;
+
   /// Entries in this vector represent a substitution of a string variable or
   /// an expression in the RegExStr regex at match time. For example, in the
   /// case of a CHECK directive with the pattern "foo[[bar]]baz[[#N+1]]",
@@ -214,6 +214,7 @@ public:
   }
 
   bool parseValue(Value &Out);
+  bool parseValue(ParseHandler &H);
 
   bool assertEnd() {
     eatWhitespace();
@@ -235,9 +236,11 @@ private:
 
   // On invalid syntax, parseX() functions return false and set Err.
   bool parseNumber(char First, Value &Out);
+  bool parseNumber(char First, ParseHandler &H);
   bool parseString(std::string &Out);
   bool parseUnicode(std::string &Out);
   bool parseError(const char *Msg); // always returns false
+  bool handlerAborted() { return parseError("Parsing aborted by handler"); }
 
   char next() { return P == End ? 0 : *P++; }
   char peek() { return P == End ? 0 : *P; }
@@ -340,6 +343,98 @@ bool Parser::parseValue(Value &Out) {
   }
 }
 
+// Streaming twin of parseValue(Value&) above: same grammar, but dispatches
+// to handler callbacks instead of building a tree. Scratch strings are reused
+// so a deeply nested document allocates O(depth), not O(size).
+bool Parser::parseValue(ParseHandler &H) {
+  eatWhitespace();
+  if (P == End)
+    return parseError("Unexpected EOF");
+  switch (char C = next()) {
+  // Bare null/true/false are easy - first char identifies them.
+  case 'n':
+    if (!(next() == 'u' && next() == 'l' && next() == 'l'))
+      return parseError("Invalid JSON value (null?)");
+    return H.onNull() || handlerAborted();
+  case 't':
+    if (!(next() == 'r' && next() == 'u' && next() == 'e'))
+      return parseError("Invalid JSON value (true?)");
+    return H.onBool(true) || handlerAborted();
+  case 'f':
+    if (!(next() == 'a' && next() == 'l' && next() == 's' && next() == 'e'))
+      return parseError("Invalid JSON value (false?)");
+    return H.onBool(false) || handlerAborted();
+  case '"': {
+    std::string S;
+    if (!parseString(S))
+      return false;
+    return H.onString(S) || handlerAborted();
+  }
+  case '[': {
+    if (!H.onArrayBegin())
+      return handlerAborted();
+    eatWhitespace();
+    if (peek() == ']') {
+      ++P;
+      return H.onArrayEnd() || handlerAborted();
+    }
+    for (;;) {
+      if (!parseValue(H))
+        return false;
+      eatWhitespace();
+      switch (next()) {
+      case ',':
+        eatWhitespace();
+        continue;
+      case ']':
+        return H.onArrayEnd() || handlerAborted();
+      default:
+        return parseError("Expected , or ] after array element");
+      }
+    }
+  }
+  case '{': {
+    if (!H.onObjectBegin())
+      return handlerAborted();
+    eatWhitespace();
+    if (peek() == '}') {
+      ++P;
+      return H.onObjectEnd() || handlerAborted();
+    }
+    std::string K;
+    for (;;) {
+      if (next() != '"')
+        return parseError("Expected object key");
+      K.clear();
+      if (!parseString(K))
+        return false;
+      if (!H.onObjectKey(K))
+        return handlerAborted();
+      eatWhitespace();
+      if (next() != ':')
+        return parseError("Expected : after object key");
+      eatWhitespace();
+      if (!parseValue(H))
+        return false;
+      eatWhitespace();
+      switch (next()) {
+      case ',':
+        eatWhitespace();
+        continue;
+      case '}':
+        return H.onObjectEnd() || handlerAborted();
+      default:
+        return parseError("Expected , or } after object property");
+      }
+    }
+  }
+  default:
+    if (isNumber(C))
+      return parseNumber(C, H);
+    return parseError("Invalid JSON value");
+  }
+}
+
 bool Parser::parseNumber(char First, Value &Out) {
   // Read the number into a string. (Must be null-terminated for strto*).
   SmallString<24> S;
@@ -360,6 +455,23 @@ bool Parser::parseNumber(char First, Value &Out) {
   return End == S.end() || parseError("Invalid JSON value (number?)");
 }
 
+bool Parser::parseNumber(char First, ParseHandler &H) {
+  // Same integer-vs-double split as the DOM flavor above.
+  SmallString<24> S;
+  S.push_back(First);
+  while (isNumber(peek()))
+    S.push_back(next());
+  char *End;
+  auto I = std::strtoll(S.c_str(), &End, 10);
+  if (End == S.end() && I >= std::numeric_limits<int64_t>::min() &&
+      I <= std::numeric_limits<int64_t>::max())
+    return H.onInteger(int64_t(I)) || handlerAborted();
+  double D = std::strtod(S.c_str(), &End);
+  if (End != S.end())
+    return parseError("Invalid JSON value (number?)");
+  return H.onNumber(D) || handlerAborted();
+}
+
 bool Parser::parseString(std::string &Out) {
   // leading quote was already consumed.
   for (char C = next(); C != '"'; C = next()) {
@@ -516,6 +628,17 @@ Expected<Value> parse(StringRef JSON) {
         return std::move(E);
   return P.takeError();
 }
+
+ParseHandler::~ParseHandler() = default;
+
+Error parse(StringRef JSON, ParseHandler &Handler) {
+  Parser P(JSON);
+  if (P.checkUTF8())
+    if (P.parseValue(Handler))
+      if (P.assertEnd())
+        return Error::success();
+  return P.takeError();
+}
 char ParseError::ID = 0;
 
 static std::vector<const Object::value_type *> sortedElements(const Object &O) {
@@ -12,15 +12,105 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/KnownBits.h"
+#include "llvm/ADT/ArrayRef.h"
 
 using namespace llvm;
 
+/// Fast path for widths of up to 64 bits: do the whole merge branchlessly on
+/// raw words instead of going through one APInt temporary per step.
+static KnownBits computeForAddCarryOneWord(const KnownBits &LHS,
+                                           const KnownBits &RHS,
+                                           bool CarryZero, bool CarryOne) {
+  unsigned BitWidth = LHS.getBitWidth();
+  uint64_t Mask = BitWidth == 64 ? UINT64_MAX : (UINT64_C(1) << BitWidth) - 1;
+  uint64_t LZ = LHS.Zero.getZExtValue(), LO = LHS.One.getZExtValue();
+  uint64_t RZ = RHS.Zero.getZExtValue(), RO = RHS.One.getZExtValue();
+
+  uint64_t PossibleSumZero =
+      ((~LZ & Mask) + (~RZ & Mask) + !CarryZero) & Mask;
+  uint64_t PossibleSumOne = (LO + RO + CarryOne) & Mask;
+
+  // Compute known bits of the carry.
+  uint64_t CarryKnownZero = ~(PossibleSumZero ^ LZ ^ RZ);
+  uint64_t CarryKnownOne = PossibleSumOne ^ LO ^ RO;
+
+  // Compute set of known bits (where all three relevant bits are known).
+  uint64_t Known = (LZ | LO) & (RZ | RO) & (CarryKnownZero | CarryKnownOne);
+
+  assert((PossibleSumZero & Known) == (PossibleSumOne & Known) &&
+         "known bits of sum differ");
+
+  KnownBits KnownOut(BitWidth);
+  KnownOut.Zero = ~PossibleSumZero & Known & Mask;
+  KnownOut.One = PossibleSumOne & Known;
+  return KnownOut;
+}
+
+/// Two-word addition with carry-in, for the 128-bit fast path.
+static inline void addTwoWords(uint64_t ALo, uint64_t AHi, uint64_t BLo,
+                               uint64_t BHi, uint64_t CarryIn, uint64_t &RLo,
+                               uint64_t &RHi) {
+  RLo = ALo + BLo;
+  uint64_t Carry = RLo < ALo;
+  RLo += CarryIn;
+  Carry += RLo < CarryIn;
+  RHi = AHi + BHi + Carry;
+}
+
+/// Fast path for widths of 65 to 128 bits: two-word arithmetic with a single
+/// APInt construction per output instead of one allocation per temporary.
+static KnownBits computeForAddCarryTwoWords(const KnownBits &LHS,
+                                            const KnownBits &RHS,
+                                            bool CarryZero, bool CarryOne) {
+  unsigned BitWidth = LHS.getBitWidth();
+  uint64_t HiMask = BitWidth == 128
+                        ? UINT64_MAX
+                        : (UINT64_C(1) << (BitWidth - 64)) - 1;
+  uint64_t LZLo = LHS.Zero.getRawData()[0], LZHi = LHS.Zero.getRawData()[1];
+  uint64_t LOLo = LHS.One.getRawData()[0], LOHi = LHS.One.getRawData()[1];
+  uint64_t RZLo = RHS.Zero.getRawData()[0], RZHi = RHS.Zero.getRawData()[1];
+  uint64_t ROLo = RHS.One.getRawData()[0], ROHi = RHS.One.getRawData()[1];
+
+  uint64_t SumZLo, SumZHi, SumOLo, SumOHi;
+  addTwoWords(~LZLo, ~LZHi & HiMask, ~RZLo, ~RZHi & HiMask, !CarryZero,
+              SumZLo, SumZHi);
+  SumZHi &= HiMask;
+  addTwoWords(LOLo, LOHi, ROLo, ROHi, CarryOne, SumOLo, SumOHi);
+  SumOHi &= HiMask;
+
+  uint64_t CarryKZLo = ~(SumZLo ^ LZLo ^ RZLo);
+  uint64_t CarryKZHi = ~(SumZHi ^ LZHi ^ RZHi);
+  uint64_t CarryKOLo = SumOLo ^ LOLo ^ ROLo;
+  uint64_t CarryKOHi = SumOHi ^ LOHi ^ ROHi;
+
+  uint64_t KnownLo =
+      (LZLo | LOLo) & (RZLo | ROLo) & (CarryKZLo | CarryKOLo);
+  uint64_t KnownHi =
+      (LZHi | LOHi) & (RZHi | ROHi) & (CarryKZHi | CarryKOHi);
+
+  assert((SumZLo & KnownLo) == (SumOLo & KnownLo) &&
+         (SumZHi & KnownHi) == (SumOHi & KnownHi) &&
+         "known bits of sum differ");
+
+  KnownBits KnownOut(BitWidth);
+  uint64_t ZeroWords[2] = {~SumZLo & KnownLo, ~SumZHi & KnownHi & HiMask};
+  uint64_t OneWords[2] = {SumOLo & KnownLo, SumOHi & KnownHi};
+  KnownOut.Zero = APInt(BitWidth, makeArrayRef(ZeroWords));
+  KnownOut.One = APInt(BitWidth, makeArrayRef(OneWords));
+  return KnownOut;
+}
+
 static KnownBits computeForAddCarry(
     const KnownBits &LHS, const KnownBits &RHS,
     bool CarryZero, bool CarryOne) {
   assert(!(CarryZero && CarryOne) &&
          "Carry can't be zero and one at the same time");
 
+  if (LHS.getBitWidth() <= 64)
+    return computeForAddCarryOneWord(LHS, RHS, CarryZero, CarryOne);
+  if (LHS.getBitWidth() <= 128)
+    return computeForAddCarryTwoWords(LHS, RHS, CarryZero, CarryOne);
+
   APInt PossibleSumZero = ~LHS.Zero + ~RHS.Zero + !CarryZero;
   APInt PossibleSumOne = LHS.One + RHS.One + CarryOne;
 
@@ -32,6 +32,9 @@
 #else
 #include <io.h>
 #endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
 using namespace llvm;
 
 //===----------------------------------------------------------------------===//
@@ -234,6 +237,60 @@ MemoryBuffer::getFile(const Twine &Filename, int64_t FileSize,
                                   RequiresNullTerminator, IsVolatile);
 }
 
+bool MemoryBuffer::adviseAccessPattern(AccessPattern Pattern) const {
+#if defined(HAVE_SYS_MMAN_H) && defined(MADV_NORMAL)
+  if (getBufferKind() != MemoryBuffer_MMap || getBufferSize() == 0)
+    return false;
+
+  int Advice;
+  switch (Pattern) {
+  case AccessPattern::Normal:
+    Advice = MADV_NORMAL;
+    break;
+  case AccessPattern::Sequential:
+    Advice = MADV_SEQUENTIAL;
+    break;
+  case AccessPattern::WillNeed:
+    Advice = MADV_WILLNEED;
+    break;
+  case AccessPattern::Hugepage:
+#if defined(MADV_HUGEPAGE)
+    Advice = MADV_HUGEPAGE;
+    break;
+#else
+    return false;
+#endif
+  }
+
+  // madvise operates on whole pages, and the buffer may start mid-page when
+  // mapping a slice, so round the start down to a page boundary.
+  static const size_t PageSize = sys::Process::getPageSizeEstimate();
+  uintptr_t Start = reinterpret_cast<uintptr_t>(getBufferStart());
+  uintptr_t AlignedStart = Start & ~uintptr_t(PageSize - 1);
+  size_t Length = getBufferSize() + (Start - AlignedStart);
+  return ::madvise(reinterpret_cast<void *>(AlignedStart), Length, Advice) == 0;
+#else
+  (void)Pattern;
+  return false;
+#endif
+}
+
+ErrorOr<std::unique_ptr<MemoryBuffer>>
+MemoryBuffer::getFileWithReadahead(const Twine &Filename, int64_t FileSize) {
+  // Null termination would force a read-based fallback whenever the file ends
+  // exactly on a page boundary, so do not request it here.
+  auto BufOrErr = getFileAux<MemoryBuffer>(Filename, FileSize, FileSize, 0,
+                                           /*RequiresNullTerminator=*/false,
+                                           /*IsVolatile=*/false);
+  if (!BufOrErr)
+    return BufOrErr;
+  // Best effort: if the buffer was read into memory instead of mmap'ed, or
+  // the platform has no madvise, the hints simply do nothing.
+  (*BufOrErr)->adviseAccessPattern(AccessPattern::Sequential);
+  (*BufOrErr)->adviseAccessPattern(AccessPattern::WillNeed);
+  return BufOrErr;
+}
+
 template <typename MB>
 static ErrorOr<std::unique_ptr<MB>>
 getOpenFileImpl(sys::fs::file_t FD, const Twine &Filename, uint64_t FileSize,
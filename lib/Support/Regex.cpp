@@ -12,8 +12,12 @@
 
 #include "llvm/Support/Regex.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/Mutex.h"
+#include <memory>
 #include <string>
 
 // Important this comes last because it defines "_REGEX_H_". At least on
@@ -202,6 +206,30 @@ std::string Regex::sub(StringRef Repl, StringRef String,
   return Res;
 }
 
+namespace {
+/// Process-wide cache of compiled patterns, keyed by the pattern string.
+/// Each pattern keeps one compiled form per flag combination; in practice a
+/// pattern is almost always compiled with a single set of flags.
+struct RegexCache {
+  sys::SmartMutex<true> Lock;
+  StringMap<SmallVector<std::pair<unsigned, std::unique_ptr<Regex>>, 1>>
+      Entries;
+};
+} // namespace
+
+static ManagedStatic<RegexCache> CompiledPatterns;
+
+const Regex &Regex::getCached(StringRef Pattern, unsigned Flags) {
+  RegexCache &Cache = *CompiledPatterns;
+  sys::SmartScopedLock<true> Guard(Cache.Lock);
+  auto &Variants = Cache.Entries[Pattern];
+  for (const auto &V : Variants)
+    if (V.first == Flags)
+      return *V.second;
+  Variants.emplace_back(Flags, std::make_unique<Regex>(Pattern, Flags));
+  return *Variants.back().second;
+}
+
 // These are the special characters matched in functions like "p_ere_exp".
 static const char RegexMetachars[] = "()^$|*+?.[]\\{}";
 
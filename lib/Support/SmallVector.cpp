@@ -11,6 +11,10 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/ManagedStatic.h"
+#include <mutex>
 using namespace llvm;
 
 // Check that no bytes are wasted and everything is well-aligned.
@@ -37,6 +41,54 @@ static_assert(sizeof(SmallVector<void *, 1>) ==
                   sizeof(unsigned) * 2 + sizeof(void *) * 2,
               "wasted space in SmallVector size 1");
 
+namespace {
+
+/// Per-instantiation-site counters for the opt-in grow() instrumentation.
+/// TrackingStatistic is used directly (rather than the STATISTIC macro) so the
+/// counters exist even in builds where LLVM_ENABLE_STATS is off, and so the
+/// names can be derived from the instantiation site at runtime.
+struct SiteStats {
+  std::string GrowsName, SpillsName, MaxBytesName;
+  std::unique_ptr<TrackingStatistic> Grows, Spills, MaxBytes;
+};
+
+struct SmallVectorStatsRegistry {
+  std::mutex Lock;
+  StringMap<SiteStats> Sites;
+};
+
+} // end anonymous namespace
+
+static ManagedStatic<SmallVectorStatsRegistry> SmallVectorStats;
+
+/// See the declaration in SmallVector.h.  This is always compiled into
+/// libSupport so that translation units built with
+/// -DLLVM_ENABLE_SMALLVECTOR_STATS link against a prebuilt library.
+void llvm::detail::recordSmallVectorGrow(const char *Site,
+                                         bool SpilledFromInline,
+                                         size_t NewCapacityInBytes) {
+  SmallVectorStatsRegistry &R = *SmallVectorStats;
+  std::lock_guard<std::mutex> Guard(R.Lock);
+  SiteStats &S = R.Sites[Site];
+  if (!S.Grows) {
+    S.GrowsName = std::string(Site) + " grows";
+    S.SpillsName = std::string(Site) + " heap spills";
+    S.MaxBytesName = std::string(Site) + " max bytes";
+    S.Grows = std::make_unique<TrackingStatistic>(
+        "smallvector", S.GrowsName.c_str(), "Number of grow() calls");
+    S.Spills = std::make_unique<TrackingStatistic>(
+        "smallvector", S.SpillsName.c_str(),
+        "Number of grows that left the inline buffer");
+    S.MaxBytes = std::make_unique<TrackingStatistic>(
+        "smallvector", S.MaxBytesName.c_str(),
+        "High-water allocated capacity in bytes");
+  }
+  ++*S.Grows;
+  if (SpilledFromInline)
+    ++*S.Spills;
+  S.MaxBytes->updateMax(std::min(NewCapacityInBytes, size_t(UINT32_MAX)));
+}
+
 /// grow_pod - This is an implementation of the grow() method which only works
 /// on POD-like datatypes and is out of line to reduce code duplication.
 void SmallVectorBase::grow_pod(void *FirstEl, size_t MinCapacity,
@@ -47,6 +47,12 @@ static cl::opt<bool> StatsAsJSON("stats-json",
                                  cl::desc("Display statistics as json data"),
                                  cl::Hidden);
 
+static cl::opt<bool>
+    StatsGrouped("stats-grouped",
+                 cl::desc("Group statistics by pass (debug type) with "
+                          "per-pass totals"),
+                 cl::Hidden);
+
 static bool Enabled;
 static bool PrintOnExit;
 
@@ -61,6 +67,7 @@ class StatisticInfo {
 
   friend void llvm::PrintStatistics();
   friend void llvm::PrintStatistics(raw_ostream &OS);
+  friend void llvm::PrintStatisticsGrouped(raw_ostream &OS);
   friend void llvm::PrintStatisticsJSON(raw_ostream &OS);
 
   /// Sort statistics by debugtype,name,description.
@@ -197,6 +204,46 @@ void llvm::PrintStatistics(raw_ostream &OS) {
   OS.flush();
 }
 
+void llvm::PrintStatisticsGrouped(raw_ostream &OS) {
+  StatisticInfo &Stats = *StatInfo;
+
+  // Values are read with relaxed atomic loads; concurrent updates from still
+  // running threads simply land in whichever snapshot we take.
+  unsigned MaxValLen = 0;
+  for (TrackingStatistic *Stat : Stats.Stats)
+    MaxValLen =
+        std::max(MaxValLen, (unsigned)utostr(Stat->getValue()).size());
+
+  Stats.sort();
+
+  OS << "===" << std::string(73, '-') << "===\n"
+     << "                          ... Statistics Collected ...\n"
+     << "===" << std::string(73, '-') << "===\n";
+
+  // sort() leaves the list ordered by debug type, so each run of equal debug
+  // types forms one section.
+  const char *LastType = nullptr;
+  uint64_t GroupTotal = 0;
+  auto FinishGroup = [&] {
+    if (LastType)
+      OS.indent(MaxValLen) << " (total events: " << GroupTotal << ")\n";
+  };
+  for (TrackingStatistic *Stat : Stats.Stats) {
+    if (!LastType || std::strcmp(LastType, Stat->getDebugType())) {
+      FinishGroup();
+      LastType = Stat->getDebugType();
+      GroupTotal = 0;
+      OS << '\n' << LastType << ":\n";
+    }
+    OS << format("%*u - %s\n", MaxValLen, Stat->getValue(), Stat->getDesc());
+    GroupTotal += Stat->getValue();
+  }
+  FinishGroup();
+
+  OS << '\n';
+  OS.flush();
+}
+
 void llvm::PrintStatisticsJSON(raw_ostream &OS) {
   sys::SmartScopedLock<true> Reader(*StatLock);
   StatisticInfo &Stats = *StatInfo;
@@ -235,6 +282,8 @@ void llvm::PrintStatistics() {
   std::unique_ptr<raw_ostream> OutStream = CreateInfoOutputFile();
   if (StatsAsJSON)
     PrintStatisticsJSON(*OutStream);
+  else if (StatsGrouped)
+    PrintStatisticsGrouped(*OutStream);
   else
     PrintStatistics(*OutStream);
 
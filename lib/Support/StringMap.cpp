@@ -69,6 +69,50 @@ void StringMapImpl::init(unsigned InitSize) {
   TheTable[NumBuckets] = (StringMapEntryBase*)2;
 }
 
+/// ReserveTable - Grow the table in a single step so that \p NumEntries items
+/// fit without triggering another rehash.  This redistributes the existing
+/// items exactly like RehashTable, but jumps straight to the final size
+/// instead of doubling repeatedly.
+void StringMapImpl::ReserveTable(unsigned NumEntries) {
+  unsigned NeededBuckets = getMinBucketToReserveForEntries(NumEntries);
+  if (NeededBuckets <= NumBuckets)
+    return;
+
+  if (NumBuckets == 0) {
+    init(NeededBuckets);
+    return;
+  }
+
+  unsigned *HashTable = (unsigned *)(TheTable + NumBuckets + 1);
+  auto NewTableArray = static_cast<StringMapEntryBase **>(safe_calloc(
+      NeededBuckets + 1, sizeof(StringMapEntryBase *) + sizeof(unsigned)));
+  unsigned *NewHashArray = (unsigned *)(NewTableArray + NeededBuckets + 1);
+  NewTableArray[NeededBuckets] = (StringMapEntryBase *)2;
+
+  // Move the items over, reusing the stored hash values.  Tombstones are
+  // dropped on the floor since every live item gets a fresh bucket.
+  for (unsigned I = 0, E = NumBuckets; I != E; ++I) {
+    StringMapEntryBase *Bucket = TheTable[I];
+    if (!Bucket || Bucket == getTombstoneVal())
+      continue;
+
+    unsigned FullHash = HashTable[I];
+    unsigned NewBucket = FullHash & (NeededBuckets - 1);
+    unsigned ProbeSize = 1;
+    while (NewTableArray[NewBucket])
+      NewBucket = (NewBucket + ProbeSize++) & (NeededBuckets - 1);
+
+    NewTableArray[NewBucket] = Bucket;
+    NewHashArray[NewBucket] = FullHash;
+  }
+
+  free(TheTable);
+
+  TheTable = NewTableArray;
+  NumBuckets = NeededBuckets;
+  NumTombstones = 0;
+}
+
 /// LookupBucketFor - Look up the bucket that the specified string should end
 /// up in.  If it already exists as a key in the map, the Item pointer for the
 /// specified bucket will be non-null.  Otherwise, it will be null.  In either
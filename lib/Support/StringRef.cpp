@@ -149,13 +149,15 @@ size_t StringRef::find(StringRef Str, size_t From) const {
 
   const char *Stop = Start + (Size - N + 1);
 
-  // For short haystacks or unsupported needles fall back to the naive algorithm
+  // For short haystacks or unsupported needles fall back to locating candidate
+  // positions of the first needle byte with memchr (vectorized in libc) and
+  // confirming with memcmp, instead of sliding one byte at a time.
   if (Size < 16 || N > 255) {
-    do {
+    while ((Start = (const char *)::memchr(Start, Needle[0], Stop - Start))) {
       if (std::memcmp(Start, Needle, N) == 0)
         return Start - Data;
       ++Start;
-    } while (Start < Stop);
+    }
     return npos;
   }
 
@@ -372,11 +374,12 @@ void StringRef::split(SmallVectorImpl<StringRef> &A, char Separator,
 size_t StringRef::count(StringRef Str) const {
   size_t Count = 0;
   size_t N = Str.size();
-  if (N > Length)
+  if (!N || N > Length)
     return 0;
-  for (size_t i = 0, e = Length - N + 1; i != e; ++i)
-    if (substr(i, N).equals(Str))
-      ++Count;
+  // Reuse find(), which dispatches to memchr and a bad-character table, rather
+  // than testing every offset with memcmp.
+  for (size_t Pos = 0; (Pos = find(Str, Pos)) != npos; Pos += N)
+    ++Count;
   return Count;
 }
 
@@ -15,8 +15,11 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/JSON.h"
+#include "llvm/Support/Threading.h"
 #include <cassert>
 #include <chrono>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -24,7 +27,13 @@ using namespace std::chrono;
 
 namespace llvm {
 
-TimeTraceProfiler *TimeTraceProfilerInstance = nullptr;
+LLVM_THREAD_LOCAL TimeTraceProfiler *TimeTraceProfilerInstance = nullptr;
+
+// Per-thread instances retired via timeTraceProfilerFinishThread, waiting to
+// be merged into the report by the thread that calls timeTraceProfilerWrite.
+static std::mutex Mu;
+static std::vector<std::unique_ptr<TimeTraceProfiler>>
+    ThreadTimeTraceProfilerInstances; // guarded by Mu
 
 typedef duration<steady_clock::rep, steady_clock::period> DurationType;
 typedef time_point<steady_clock> TimePointType;
@@ -59,7 +68,7 @@ struct Entry {
 };
 
 struct TimeTraceProfiler {
-  TimeTraceProfiler() {
+  TimeTraceProfiler() : Tid(llvm::get_threadid()) {
     StartTime = steady_clock::now();
   }
 
@@ -103,36 +112,63 @@ struct TimeTraceProfiler {
     Stack.pop_back();
   }
 
+  // Write events from this instance and all retired per-thread instances.
   void Write(raw_pwrite_stream &OS) {
-    assert(Stack.empty() &&
-           "All profiler sections should be ended when calling Write");
+    std::lock_guard<std::mutex> Lock(Mu);
+    SmallVector<const TimeTraceProfiler *, 8> Instances;
+    Instances.push_back(this);
+    for (const auto &TTP : ThreadTimeTraceProfilerInstances)
+      Instances.push_back(TTP.get());
+
+    // Flame graph timestamps are relative to the earliest thread's start, so
+    // the per-thread tracks line up in the viewer.
+    TimePointType CommonStartTime = StartTime;
+    uint64_t MaxTid = Tid;
+    for (const TimeTraceProfiler *TTP : Instances) {
+      assert(TTP->Stack.empty() &&
+             "All profiler sections should be ended when calling Write");
+      CommonStartTime = std::min(CommonStartTime, TTP->StartTime);
+      MaxTid = std::max(MaxTid, TTP->Tid);
+    }
+
     json::OStream J(OS);
     J.objectBegin();
     J.attributeBegin("traceEvents");
     J.arrayBegin();
 
-    // Emit all events for the main flame graph.
-    for (const auto &E : Entries) {
-      auto StartUs = E.getFlameGraphStartUs(StartTime);
-      auto DurUs = E.getFlameGraphDurUs();
-
-      J.object([&]{
-        J.attribute("pid", 1);
-        J.attribute("tid", 0);
-        J.attribute("ph", "X");
-        J.attribute("ts", StartUs);
-        J.attribute("dur", DurUs);
-        J.attribute("name", E.Name);
-        J.attributeObject("args", [&] { J.attribute("detail", E.Detail); });
-      });
+    // Emit all events for the main flame graph, one track per thread.
+    for (const TimeTraceProfiler *TTP : Instances) {
+      for (const auto &E : TTP->Entries) {
+        auto StartUs = E.getFlameGraphStartUs(CommonStartTime);
+        auto DurUs = E.getFlameGraphDurUs();
+
+        J.object([&] {
+          J.attribute("pid", 1);
+          J.attribute("tid", int64_t(TTP->Tid));
+          J.attribute("ph", "X");
+          J.attribute("ts", StartUs);
+          J.attribute("dur", DurUs);
+          J.attribute("name", E.Name);
+          J.attributeObject("args", [&] { J.attribute("detail", E.Detail); });
+        });
+      }
     }
 
     // Emit totals by section name as additional "thread" events, sorted from
-    // longest one.
-    int Tid = 1;
+    // longest one. Totals are summed over all threads.
+    StringMap<CountAndDurationType> AllCountAndTotalPerName;
+    for (const TimeTraceProfiler *TTP : Instances) {
+      for (const auto &E : TTP->CountAndTotalPerName) {
+        auto &CountAndTotal = AllCountAndTotalPerName[E.getKey()];
+        CountAndTotal.first += E.getValue().first;
+        CountAndTotal.second += E.getValue().second;
+      }
+    }
+
+    uint64_t TotalTid = MaxTid + 1;
     std::vector<NameAndCountAndDurationType> SortedTotals;
-    SortedTotals.reserve(CountAndTotalPerName.size());
-    for (const auto &E : CountAndTotalPerName)
+    SortedTotals.reserve(AllCountAndTotalPerName.size());
+    for (const auto &E : AllCountAndTotalPerName)
       SortedTotals.emplace_back(E.getKey(), E.getValue());
 
     llvm::sort(SortedTotals.begin(), SortedTotals.end(),
@@ -142,11 +178,11 @@ struct TimeTraceProfiler {
                });
     for (const auto &E : SortedTotals) {
       auto DurUs = duration_cast<microseconds>(E.second.second).count();
-      auto Count = CountAndTotalPerName[E.first].first;
+      auto Count = E.second.first;
 
       J.object([&]{
         J.attribute("pid", 1);
-        J.attribute("tid", Tid);
+        J.attribute("tid", int64_t(TotalTid));
         J.attribute("ph", "X");
         J.attribute("ts", 0);
         J.attribute("dur", DurUs);
@@ -157,7 +193,7 @@ struct TimeTraceProfiler {
         });
       });
 
-      ++Tid;
+      ++TotalTid;
     }
 
     // Emit metadata event with process name.
@@ -180,6 +216,7 @@ struct TimeTraceProfiler {
   SmallVector<Entry, 128> Entries;
   StringMap<CountAndDurationType> CountAndTotalPerName;
   TimePointType StartTime;
+  const uint64_t Tid;
 
   // Minimum time granularity (in microseconds)
   unsigned TimeTraceGranularity;
@@ -195,6 +232,17 @@ void timeTraceProfilerInitialize(unsigned TimeTraceGranularity) {
 void timeTraceProfilerCleanup() {
   delete TimeTraceProfilerInstance;
   TimeTraceProfilerInstance = nullptr;
+  std::lock_guard<std::mutex> Lock(Mu);
+  ThreadTimeTraceProfilerInstances.clear();
+}
+
+void timeTraceProfilerFinishThread() {
+  assert(TimeTraceProfilerInstance != nullptr &&
+         "Profiler should be initialized on this thread");
+  std::lock_guard<std::mutex> Lock(Mu);
+  ThreadTimeTraceProfilerInstances.push_back(
+      std::unique_ptr<TimeTraceProfiler>(TimeTraceProfilerInstance));
+  TimeTraceProfilerInstance = nullptr;
 }
 
 void timeTraceProfilerWrite(raw_pwrite_stream &OS) {
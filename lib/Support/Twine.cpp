@@ -15,9 +15,9 @@
 using namespace llvm;
 
 std::string Twine::str() const {
-  // If we're storing only a std::string, just return it.
-  if (LHSKind == StdStringKind && RHSKind == EmptyKind)
-    return *LHS.stdString;
+  // If the whole twine is one string-like node, copy it out directly.
+  if (isSingleStringRef())
+    return getSingleStringRef().str();
 
   // If we're storing a formatv_object, we can avoid an extra copy by formatting
   // it immediately and returning the result.
@@ -29,7 +29,52 @@ std::string Twine::str() const {
   return toStringRef(Vec).str();
 }
 
+bool Twine::appendOneChildSimple(SmallVectorImpl<char> &Out, Child Ptr,
+                                 NodeKind Kind) {
+  switch (Kind) {
+  case Twine::NullKind:
+  case Twine::EmptyKind:
+    return true;
+  case Twine::TwineKind:
+    return Ptr.twine->appendSimple(Out);
+  case Twine::CStringKind: {
+    StringRef S(Ptr.cString);
+    Out.append(S.begin(), S.end());
+    return true;
+  }
+  case Twine::StdStringKind:
+    Out.append(Ptr.stdString->begin(), Ptr.stdString->end());
+    return true;
+  case Twine::StringRefKind:
+    Out.append(Ptr.stringRef->begin(), Ptr.stringRef->end());
+    return true;
+  case Twine::SmallStringKind:
+    Out.append(Ptr.smallString->begin(), Ptr.smallString->end());
+    return true;
+  case Twine::CharKind:
+    Out.push_back(Ptr.character);
+    return true;
+  default:
+    // Numbers and formatv objects need the stream machinery to render.
+    return false;
+  }
+}
+
+bool Twine::appendSimple(SmallVectorImpl<char> &Out) const {
+  return appendOneChildSimple(Out, LHS, getLHSKind()) &&
+         appendOneChildSimple(Out, RHS, getRHSKind());
+}
+
 void Twine::toVector(SmallVectorImpl<char> &Out) const {
+  // Concatenations of strings and characters - by far the common case - are
+  // appended directly; this keeps symbol-name and path assembly free of the
+  // raw_ostream overhead. Anything needing number formatting falls back to
+  // the stream path below.
+  size_t OldSize = Out.size();
+  if (appendSimple(Out))
+    return;
+  Out.resize(OldSize);
+
   raw_svector_ostream OS(Out);
   print(OS);
 }
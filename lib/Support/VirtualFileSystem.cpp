@@ -520,6 +520,45 @@ directory_iterator OverlayFileSystem::dir_begin(const Twine &Dir,
 
 void ProxyFileSystem::anchor() {}
 
+ErrorOr<Status> StatCachingFileSystem::status(const Twine &Path) {
+  SmallString<256> PathStorage;
+  StringRef Key = Path.toStringRef(PathStorage);
+  uint64_t CurrentGen = Generation.load(std::memory_order_acquire);
+  {
+    llvm::sys::SmartScopedReader<true> Guard(CacheMutex);
+    auto It = StatCache.find(Key);
+    if (It != StatCache.end() && It->second.Generation == CurrentGen) {
+      if (It->second.Stat)
+        // The cached entry carries the name of the first request; report the
+        // spelling this caller used, as an uncached status() would.
+        return Status::copyWithNewName(*It->second.Stat, Path);
+      return It->second.EC;
+    }
+  }
+
+  ErrorOr<Status> Result = ProxyFileSystem::status(Path);
+  {
+    llvm::sys::SmartScopedWriter<true> Guard(CacheMutex);
+    CachedStat &Entry = StatCache[Key];
+    Entry.Generation = CurrentGen;
+    if (Result) {
+      Entry.Stat = *Result;
+      Entry.EC = std::error_code();
+    } else {
+      Entry.Stat = None;
+      Entry.EC = Result.getError();
+    }
+  }
+  return Result;
+}
+
+std::error_code
+StatCachingFileSystem::setCurrentWorkingDirectory(const Twine &Path) {
+  // Relative paths may now resolve differently.
+  invalidateStatCache();
+  return ProxyFileSystem::setCurrentWorkingDirectory(Path);
+}
+
 namespace llvm {
 namespace vfs {
 
@@ -133,7 +133,7 @@ void Input::beginMapping() {
   // CurrentNode can be null if the document is empty.
   MapHNode *MN = dyn_cast_or_null<MapHNode>(CurrentNode);
   if (MN) {
-    MN->ValidKeys.clear();
+    MN->VisitedValues.clear();
   }
 }
 
@@ -169,8 +169,10 @@ bool Input::preflightKey(const char *Key, bool Required, bool, bool &UseDefault,
       setError(CurrentNode, "not a mapping");
     return false;
   }
-  MN->ValidKeys.push_back(Key);
-  HNode *Value = MN->Mapping[Key].get();
+  // Use find() rather than operator[] so that probing for an absent optional
+  // key does not grow the map with a null entry.
+  auto It = MN->Mapping.find(Key);
+  HNode *Value = It == MN->Mapping.end() ? nullptr : It->second.get();
   if (!Value) {
     if (Required)
       setError(CurrentNode, Twine("missing required key '") + Key + "'");
@@ -178,6 +180,7 @@ bool Input::preflightKey(const char *Key, bool Required, bool, bool &UseDefault,
       UseDefault = true;
     return false;
   }
+  MN->VisitedValues.insert(Value);
   SaveInfo = CurrentNode;
   CurrentNode = Value;
   return true;
@@ -195,7 +198,7 @@ void Input::endMapping() {
   if (!MN)
     return;
   for (const auto &NN : MN->Mapping) {
-    if (!is_contained(MN->ValidKeys, NN.first())) {
+    if (!MN->VisitedValues.count(NN.second.get())) {
       setError(NN.second.get(), Twine("unknown key '") + NN.first() + "'");
       break;
     }
@@ -404,11 +407,9 @@ std::unique_ptr<Input::HNode> Input::createHNodes(Node *N) {
         break;
       }
       StringStorage.clear();
+      // No need to copy the key via StringAllocator here: StringMap keeps its
+      // own copy of the key, so KeyStr only has to live until the insertion.
       StringRef KeyStr = Key->getValue(StringStorage);
-      if (!StringStorage.empty()) {
-        // Copy string to permanent storage
-        KeyStr = StringStorage.str().copy(StringAllocator);
-      }
       auto ValueHNode = createHNodes(Value);
       if (EC)
         break;
@@ -0,0 +1,123 @@
+//===- raw_mmap_ostream.cpp - mmap-backed raw_ostream ---------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements a raw_pwrite_stream backed by a memory-mapped file.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/raw_mmap_ostream.h"
+#include "llvm/Support/Errc.h"
+#include "llvm/Support/FileSystem.h"
+#include <cstring>
+
+using namespace llvm;
+using namespace llvm::sys;
+
+static Expected<std::unique_ptr<fs::mapped_file_region>>
+mapTempFile(fs::TempFile &File, uint64_t Size) {
+#ifndef _WIN32
+  // On Windows the mapping itself extends the file; see FileOutputBuffer.
+  if (std::error_code EC = fs::resize_file(File.FD, Size))
+    return errorCodeToError(EC);
+#endif
+  std::error_code EC;
+  auto Map = std::make_unique<fs::mapped_file_region>(
+      fs::convertFDToNativeFile(File.FD), fs::mapped_file_region::readwrite,
+      Size, 0, EC);
+  if (EC)
+    return errorCodeToError(EC);
+  return std::move(Map);
+}
+
+Expected<std::unique_ptr<raw_mmap_ostream>>
+raw_mmap_ostream::create(StringRef Path, uint64_t SizeHint) {
+  // "-" and special files cannot be mmapped or atomically replaced; the
+  // caller should use raw_fd_ostream for those.
+  if (Path == "-")
+    return errorCodeToError(errc::invalid_argument);
+
+  Expected<fs::TempFile> FileOrErr =
+      fs::TempFile::create(Path + ".tmp%%%%%%%", fs::all_read | fs::all_write);
+  if (!FileOrErr)
+    return FileOrErr.takeError();
+  auto Temp = std::make_unique<fs::TempFile>(std::move(*FileOrErr));
+
+  uint64_t Size = std::max<uint64_t>(SizeHint, 4096);
+  auto MapOrErr = mapTempFile(*Temp, Size);
+  if (!MapOrErr) {
+    consumeError(Temp->discard());
+    return MapOrErr.takeError();
+  }
+
+  return std::unique_ptr<raw_mmap_ostream>(
+      new raw_mmap_ostream(Path, std::move(Temp), std::move(*MapOrErr)));
+}
+
+raw_mmap_ostream::raw_mmap_ostream(
+    StringRef Path, std::unique_ptr<fs::TempFile> Temp,
+    std::unique_ptr<fs::mapped_file_region> Map)
+    : raw_pwrite_stream(/*Unbuffered=*/true), FinalPath(Path),
+      Temp(std::move(Temp)), Map(std::move(Map)) {}
+
+raw_mmap_ostream::~raw_mmap_ostream() {
+  if (Committed)
+    return;
+  // Unmap before deleting the temporary so the removal succeeds everywhere.
+  Map.reset();
+  if (Temp)
+    consumeError(Temp->discard());
+}
+
+void raw_mmap_ostream::grow(uint64_t MinSize) {
+  uint64_t NewSize = std::max(Map->size() * 2, MinSize);
+  // The old mapping must be gone before the file is resized and remapped.
+  Map.reset();
+  auto MapOrErr = mapTempFile(*Temp, NewSize);
+  if (!MapOrErr) {
+    EC = errorToErrorCode(MapOrErr.takeError());
+    return;
+  }
+  Map = std::move(*MapOrErr);
+}
+
+void raw_mmap_ostream::write_impl(const char *Ptr, size_t Size) {
+  if (EC || Committed)
+    return;
+  if (Pos + Size > Map->size()) {
+    grow(Pos + Size);
+    if (EC)
+      return;
+  }
+  memcpy(Map->data() + Pos, Ptr, Size);
+  Pos += Size;
+}
+
+void raw_mmap_ostream::pwrite_impl(const char *Ptr, size_t Size,
+                                   uint64_t Offset) {
+  if (EC || Committed)
+    return;
+  assert(Offset + Size <= Pos && "patching unwritten bytes");
+  memcpy(Map->data() + Offset, Ptr, Size);
+}
+
+Error raw_mmap_ostream::commit() {
+  assert(!Committed && "already committed");
+  flush();
+  if (EC)
+    return errorCodeToError(EC);
+  Committed = true;
+
+  // Drop the mapping, shrink the file from the mapped capacity down to the
+  // bytes actually written, and put it in place.
+  Map.reset();
+  if (std::error_code ResizeEC = fs::resize_file(Temp->FD, Pos)) {
+    consumeError(Temp->discard());
+    return errorCodeToError(ResizeEC);
+  }
+  return Temp->keep(FinalPath);
+}
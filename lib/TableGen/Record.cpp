@@ -2345,11 +2345,18 @@ RecordKeeper::getAllDerivedDefinitions(StringRef ClassName) const {
   if (!Class)
     PrintFatalError("ERROR: Couldn't find the `" + ClassName + "' class!\n");
 
+  // The backends query the same handful of classes over and over, and every
+  // query walks all defs, so memoize the results.
+  auto It = DerivedDefsCache.find(ClassName);
+  if (It != DerivedDefsCache.end())
+    return It->second;
+
   std::vector<Record*> Defs;
   for (const auto &D : getDefs())
     if (D.second->isSubClassOf(Class))
       Defs.push_back(D.second.get());
 
+  DerivedDefsCache.emplace(ClassName, Defs);
   return Defs;
 }
 
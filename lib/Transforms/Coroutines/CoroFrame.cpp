@@ -18,6 +18,8 @@
 
 #include "CoroInternal.h"
 #include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/Analysis/OptimizationRemarkEmitter.h"
 #include "llvm/Analysis/PtrUseVisitor.h"
 #include "llvm/Transforms/Utils/Local.h"
 #include "llvm/Config/llvm-config.h"
@@ -428,7 +430,18 @@ static StructType *buildFrameType(Function &F, coro::Shape &Shape,
 
   Padder.addTypes(Types);
 
-  // Create an entry for every spilled value.
+  // Collect an entry for every spilled value before laying anything out so
+  // that the fields can be ordered by decreasing alignment. Keeping the most
+  // aligned fields first minimizes the padding inserted between them.
+  struct FrameField {
+    Spill *S; // First spill entry for the definition; holds the field index.
+    Type *Ty;
+    uint64_t Count;
+    unsigned Alignment;       // Max of the ABI and any forced alignment.
+    unsigned ForcedAlignment; // Alignment specified on the alloca, if any.
+  };
+  SmallVector<FrameField, 8> Fields;
+
   for (auto &S : Spills) {
     if (CurrentDef == S.def())
       continue;
@@ -440,16 +453,10 @@ static StructType *buildFrameType(Function &F, coro::Shape &Shape,
 
     uint64_t Count = 1;
     Type *Ty = nullptr;
+    unsigned ForcedAlignment = 0;
     if (auto *AI = dyn_cast<AllocaInst>(CurrentDef)) {
       Ty = AI->getAllocatedType();
-      if (unsigned AllocaAlignment = AI->getAlignment()) {
-        // If alignment is specified in alloca, see if we need to insert extra
-        // padding.
-        if (auto PaddingTy = Padder.getPaddingType(Ty, AllocaAlignment)) {
-          Types.push_back(PaddingTy);
-          Padder.addType(PaddingTy);
-        }
-      }
+      ForcedAlignment = AI->getAlignment();
       if (auto *CI = dyn_cast<ConstantInt>(AI->getArraySize()))
         Count = CI->getValue().getZExtValue();
       else
@@ -457,15 +464,46 @@ static StructType *buildFrameType(Function &F, coro::Shape &Shape,
     } else {
       Ty = CurrentDef->getType();
     }
-    S.setFieldIndex(Types.size());
-    if (Count == 1)
-      Types.push_back(Ty);
+    unsigned Alignment =
+        std::max(DL.getABITypeAlignment(Ty), ForcedAlignment);
+    Fields.push_back({&S, Ty, Count, Alignment, ForcedAlignment});
+  }
+
+  // The sort is stable, so frames where every field shares one alignment keep
+  // their discovery order.
+  llvm::stable_sort(Fields, [](const FrameField &A, const FrameField &B) {
+    return A.Alignment > B.Alignment;
+  });
+
+  for (auto &FF : Fields) {
+    if (FF.ForcedAlignment) {
+      // If alignment is specified in alloca, see if we need to insert extra
+      // padding.
+      if (auto PaddingTy = Padder.getPaddingType(FF.Ty, FF.ForcedAlignment)) {
+        Types.push_back(PaddingTy);
+        Padder.addType(PaddingTy);
+      }
+    }
+    FF.S->setFieldIndex(Types.size());
+    if (FF.Count == 1)
+      Types.push_back(FF.Ty);
     else
-      Types.push_back(ArrayType::get(Ty, Count));
-    Padder.addType(Ty);
+      Types.push_back(ArrayType::get(FF.Ty, FF.Count));
+    Padder.addType(FF.Ty);
   }
   FrameTy->setBody(Types);
 
+  // Report the frame size so that its growth can be tracked over time.
+  OptimizationRemarkEmitter ORE(&F);
+  ORE.emit([&]() {
+    return OptimizationRemark(DEBUG_TYPE, "CoroFrameSize",
+                              &F.getEntryBlock().front())
+           << "coroutine frame is "
+           << ore::NV("Size", DL.getTypeAllocSize(FrameTy))
+           << " bytes with alignment "
+           << ore::NV("Alignment", DL.getABITypeAlignment(FrameTy));
+  });
+
   switch (Shape.ABI) {
   case coro::ABI::Switch:
     break;
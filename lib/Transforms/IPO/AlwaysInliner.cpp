@@ -99,6 +99,9 @@ namespace {
 /// Unlike the \c AlwaysInlinerPass, this uses the more heavyweight \c Inliner
 /// base class to provide several facilities such as array alloca merging.
 class AlwaysInlinerLegacyPass : public LegacyInlinerBase {
+  /// Memoizes the per-callee viability walk across call sites; see
+  /// getInlineCost().
+  InlineViabilityCache ViabilityCache;
 
 public:
   AlwaysInlinerLegacyPass() : LegacyInlinerBase(ID, /*InsertLifetime*/ true) {
@@ -146,10 +149,9 @@ Pass *llvm::createAlwaysInlinerLegacyPass(bool InsertLifetime) {
 /// a very simple and boring direct walk of the instructions looking for
 /// impossible-to-inline constructs.
 ///
-/// Note, it would be possible to go to some lengths to cache the information
-/// computed here, but as we only expect to do this for relatively few and
-/// small functions which have the explicit attribute to force inlining, it is
-/// likely not worth it in practice.
+/// The walk's verdict only depends on the callee's body, not the call site,
+/// so it is memoized in ViabilityCache rather than repeated for each of the
+/// callee's (possibly many) call sites.
 InlineCost AlwaysInlinerLegacyPass::getInlineCost(CallSite CS) {
   Function *Callee = CS.getCalledFunction();
 
@@ -165,7 +167,7 @@ InlineCost AlwaysInlinerLegacyPass::getInlineCost(CallSite CS) {
   if (!CS.hasFnAttr(Attribute::AlwaysInline))
     return InlineCost::getNever("no alwaysinline attribute");
 
-  auto IsViable = isInlineViable(*Callee);
+  auto IsViable = ViabilityCache.get(*Callee);
   if (!IsViable)
     return InlineCost::getNever(IsViable.message);
 
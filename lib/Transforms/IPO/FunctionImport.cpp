@@ -42,6 +42,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/IPO/Internalize.h"
 #include "llvm/Transforms/Utils/Cloning.h"
@@ -112,6 +113,18 @@ static cl::opt<float> ImportColdMultiplier(
     "import-cold-multiplier", cl::init(0), cl::Hidden, cl::value_desc("N"),
     cl::desc("Multiply the `import-instr-limit` threshold for cold callsites"));
 
+static cl::opt<float> ImportHotModuleMultiplier(
+    "import-hot-module-multiplier", cl::init(1.0), cl::Hidden,
+    cl::value_desc("x"),
+    cl::desc("Multiply the initial `import-instr-limit` for modules "
+             "containing hot or critical call edges"));
+
+static cl::opt<float> ImportColdModuleMultiplier(
+    "import-cold-module-multiplier", cl::init(1.0), cl::Hidden,
+    cl::value_desc("x"),
+    cl::desc("Multiply the initial `import-instr-limit` for modules whose "
+             "profiled call edges are all cold"));
+
 static cl::opt<bool> PrintImports("print-imports", cl::init(false), cl::Hidden,
                                   cl::desc("Print imported functions"));
 
@@ -122,6 +135,11 @@ static cl::opt<bool> PrintImportFailures(
 static cl::opt<bool> ComputeDead("compute-dead", cl::init(true), cl::Hidden,
                                  cl::desc("Compute dead symbols"));
 
+static cl::opt<std::string> LivenessAttributionFile(
+    "liveness-attribution-file", cl::Hidden, cl::value_desc("filename"),
+    cl::desc("Write a CSV report attributing each live GUID to the live root "
+             "that first reached it during dead symbol computation"));
+
 static cl::opt<bool> EnableImportMetadata(
     "enable-import-metadata", cl::init(
 #if !defined(NDEBUG)
@@ -531,6 +549,37 @@ static void ComputeImportForModule(
   SmallVector<EdgeInfo, 128> Worklist;
   FunctionImporter::ImportThresholdsTy ImportThresholds;
 
+  // Scale the initial import budget by module hotness: modules making hot or
+  // critical calls get a deeper import budget than modules whose profiled
+  // edges are all cold, so hot modules do not exhaust their budget on cold
+  // callees. The per-callsite hotness multipliers still apply on top.
+  unsigned ModuleImportLimit = ImportInstrLimit;
+  if (ImportHotModuleMultiplier != 1.0f || ImportColdModuleMultiplier != 1.0f) {
+    bool SeenHot = false, SeenProfiled = false;
+    for (auto &GVSummary : DefinedGVSummaries) {
+      auto *FuncSummary =
+          dyn_cast<FunctionSummary>(GVSummary.second->getBaseObject());
+      if (!FuncSummary || !Index.isGlobalValueLive(GVSummary.second))
+        continue;
+      for (auto &Edge : FuncSummary->calls()) {
+        auto Hotness = Edge.second.getHotness();
+        if (Hotness == CalleeInfo::HotnessType::Hot ||
+            Hotness == CalleeInfo::HotnessType::Critical)
+          SeenHot = true;
+        if (Hotness != CalleeInfo::HotnessType::Unknown)
+          SeenProfiled = true;
+      }
+      if (SeenHot)
+        break;
+    }
+    if (SeenHot)
+      ModuleImportLimit = ImportInstrLimit * ImportHotModuleMultiplier;
+    else if (SeenProfiled)
+      ModuleImportLimit = ImportInstrLimit * ImportColdModuleMultiplier;
+    LLVM_DEBUG(dbgs() << "Module " << ModName << " import limit "
+                      << ModuleImportLimit << "\n");
+  }
+
   // Populate the worklist with the import for the functions in the current
   // module
   for (auto &GVSummary : DefinedGVSummaries) {
@@ -549,7 +598,7 @@ static void ComputeImportForModule(
       // Skip import for global variables
       continue;
     LLVM_DEBUG(dbgs() << "Initialize import for " << VI << "\n");
-    computeImportForFunction(*FuncSummary, Index, ImportInstrLimit,
+    computeImportForFunction(*FuncSummary, Index, ModuleImportLimit,
                              DefinedGVSummaries, Worklist, ImportList,
                              ExportLists, ImportThresholds);
   }
@@ -620,14 +669,48 @@ void llvm::ComputeCrossModuleImport(
     const StringMap<GVSummaryMapTy> &ModuleToDefinedGVSummaries,
     StringMap<FunctionImporter::ImportMapTy> &ImportLists,
     StringMap<FunctionImporter::ExportSetTy> &ExportLists) {
-  // For each module that has function defined, compute the import/export lists.
+  // The import computation for a module only reads the (immutable during the
+  // thin link) index and writes its own import list plus the export lists of
+  // the modules it imports from. By giving each module its own export list
+  // map and merging them afterwards, the per-module computations become
+  // independent of each other and can run concurrently. The import list
+  // entries are created up front so the workers never mutate ImportLists
+  // itself.
+  std::vector<const StringMapEntry<GVSummaryMapTy> *> ModuleSummaries;
+  ModuleSummaries.reserve(ModuleToDefinedGVSummaries.size());
   for (auto &DefinedGVSummaries : ModuleToDefinedGVSummaries) {
-    auto &ImportList = ImportLists[DefinedGVSummaries.first()];
-    LLVM_DEBUG(dbgs() << "Computing import for Module '"
-                      << DefinedGVSummaries.first() << "'\n");
-    ComputeImportForModule(DefinedGVSummaries.second, Index,
-                           DefinedGVSummaries.first(), ImportList,
-                           &ExportLists);
+    (void)ImportLists[DefinedGVSummaries.first()];
+    ModuleSummaries.push_back(&DefinedGVSummaries);
+  }
+
+  auto ComputeForModule =
+      [&](const StringMapEntry<GVSummaryMapTy> &DefinedGVSummaries,
+          StringMap<FunctionImporter::ExportSetTy> &ModuleExportLists) {
+        auto &ImportList = ImportLists[DefinedGVSummaries.first()];
+        LLVM_DEBUG(dbgs() << "Computing import for Module '"
+                          << DefinedGVSummaries.first() << "'\n");
+        ComputeImportForModule(DefinedGVSummaries.getValue(), Index,
+                               DefinedGVSummaries.first(), ImportList,
+                               &ModuleExportLists);
+      };
+
+  if (ModuleSummaries.size() < 2) {
+    for (const auto *DefinedGVSummaries : ModuleSummaries)
+      ComputeForModule(*DefinedGVSummaries, ExportLists);
+  } else {
+    std::vector<StringMap<FunctionImporter::ExportSetTy>> PerModuleExportLists(
+        ModuleSummaries.size());
+    {
+      ThreadPool Pool;
+      for (size_t I = 0; I < ModuleSummaries.size(); ++I)
+        Pool.async([&, I] {
+          ComputeForModule(*ModuleSummaries[I], PerModuleExportLists[I]);
+        });
+      Pool.wait();
+    }
+    for (auto &ModuleExportLists : PerModuleExportLists)
+      for (auto &ELI : ModuleExportLists)
+        ExportLists[ELI.first()].insert(ELI.second.begin(), ELI.second.end());
   }
 
   // When computing imports we added all GUIDs referenced by anything
@@ -741,6 +824,10 @@ void llvm::computeDeadSymbols(
     // Don't do anything when nothing is live, this is friendly with tests.
     return;
   unsigned LiveSymbols = 0;
+  // Records which live root made each GUID live, for the
+  // -liveness-attribution-file report. Roots attribute to themselves.
+  const bool TrackLiveRoots = !LivenessAttributionFile.empty();
+  DenseMap<GlobalValue::GUID, GlobalValue::GUID> LiveRoot;
   SmallVector<ValueInfo, 128> Worklist;
   Worklist.reserve(GUIDPreservedSymbols.size() * 2);
   for (auto GUID : GUIDPreservedSymbols) {
@@ -759,12 +846,14 @@ void llvm::computeDeadSymbols(
         LLVM_DEBUG(dbgs() << "Live root: " << VI << "\n");
         Worklist.push_back(VI);
         ++LiveSymbols;
+        if (TrackLiveRoots)
+          LiveRoot[VI.getGUID()] = VI.getGUID();
         break;
       }
   }
 
   // Make value live and add it to the worklist if it was not live before.
-  auto visit = [&](ValueInfo VI, bool IsAliasee) {
+  auto visit = [&](ValueInfo VI, bool IsAliasee, GlobalValue::GUID Root) {
     // FIXME: If we knew which edges were created for indirect call profiles,
     // we could skip them here. Any that are live should be reached via
     // other edges, e.g. reference edges. Otherwise, using a profile collected
@@ -814,30 +903,55 @@ void llvm::computeDeadSymbols(
     for (auto &S : VI.getSummaryList())
       S->setLive(true);
     ++LiveSymbols;
+    if (TrackLiveRoots)
+      LiveRoot.try_emplace(VI.getGUID(), Root);
     Worklist.push_back(VI);
   };
 
   while (!Worklist.empty()) {
     auto VI = Worklist.pop_back_val();
+    GlobalValue::GUID Root =
+        TrackLiveRoots ? LiveRoot.lookup(VI.getGUID()) : 0;
     for (auto &Summary : VI.getSummaryList()) {
       if (auto *AS = dyn_cast<AliasSummary>(Summary.get())) {
         // If this is an alias, visit the aliasee VI to ensure that all copies
         // are marked live and it is added to the worklist for further
         // processing of its references.
-        visit(AS->getAliaseeVI(), true);
+        visit(AS->getAliaseeVI(), true, Root);
         continue;
       }
 
       Summary->setLive(true);
       for (auto Ref : Summary->refs())
-        visit(Ref, false);
+        visit(Ref, false, Root);
       if (auto *FS = dyn_cast<FunctionSummary>(Summary.get()))
         for (auto Call : FS->calls())
-          visit(Call.first, false);
+          visit(Call.first, false, Root);
     }
   }
   Index.setWithGlobalValueDeadStripping();
 
+  if (TrackLiveRoots) {
+    std::error_code EC;
+    raw_fd_ostream OS(LivenessAttributionFile, EC, sys::fs::OF_Text);
+    if (EC)
+      report_fatal_error(Twine("Failed to open liveness attribution file ") +
+                         LivenessAttributionFile + ": " + EC.message());
+    std::vector<std::pair<GlobalValue::GUID, GlobalValue::GUID>> Attribution(
+        LiveRoot.begin(), LiveRoot.end());
+    llvm::sort(Attribution);
+    auto NameOf = [&Index](GlobalValue::GUID GUID) -> StringRef {
+      ValueInfo VI = Index.getValueInfo(GUID);
+      return VI ? VI.name() : StringRef();
+    };
+    // Names are only present when the index was built with global values
+    // attached or written with names; the GUID columns are always valid.
+    OS << "GUID,RootGUID,Name,RootName\n";
+    for (const auto &P : Attribution)
+      OS << P.first << ',' << P.second << ',' << NameOf(P.first) << ','
+         << NameOf(P.second) << '\n';
+  }
+
   unsigned DeadSymbols = Index.size() - LiveSymbols;
   LLVM_DEBUG(dbgs() << LiveSymbols << " symbols Live, and " << DeadSymbols
                     << " symbols Dead \n");
@@ -0,0 +1,247 @@
+//===- FunctionSpecialization.cpp - Specialize on constant args -----------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This pass specializes functions on frequently passed constant arguments.
+// For each candidate function it tallies, per argument position, the
+// constants its call sites pass, weighting each site by its profile count
+// when a profile is available.  If enough call sites agree on a constant, the
+// function is cloned, the argument is replaced by the constant inside the
+// clone, and the agreeing call sites are redirected to it.  Interprocedural
+// constant propagation and the inliner then simplify the clone; they cannot
+// perform this transform themselves because the remaining call sites keep
+// the argument non-constant.
+//
+// Only the most profitable (argument, constant) pair of a function is
+// specialized per run, and a module-level budget bounds code growth.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Transforms/IPO/FunctionSpecialization.h"
+#include "llvm/ADT/MapVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
+#include "llvm/IR/CallSite.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Module.h"
+#include "llvm/InitializePasses.h"
+#include "llvm/Pass.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Transforms/IPO.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+
+using namespace llvm;
+
+#define DEBUG_TYPE "function-specialize"
+
+STATISTIC(NumFunctionsSpecialized, "Number of functions specialized");
+
+static cl::opt<unsigned> SpecializationLimit(
+    "func-specialize-limit", cl::init(8), cl::Hidden,
+    cl::desc("Maximum number of specializations created per module"));
+
+static cl::opt<unsigned> MinSpecializedCallSites(
+    "func-specialize-min-call-sites", cl::init(3), cl::Hidden,
+    cl::desc("Minimum number of call sites that must pass the same constant "
+             "argument before a specialization is created"));
+
+static cl::opt<unsigned> MaxSpecializedSize(
+    "func-specialize-max-size", cl::init(200), cl::Hidden,
+    cl::desc(
+        "Maximum callee size in instructions to consider for specialization"));
+
+namespace {
+
+/// A constant frequently passed for one argument position, together with the
+/// call sites that pass it.
+struct SpecializationCandidate {
+  unsigned ArgNo = 0;
+  Constant *C = nullptr;
+
+  /// Sum of the profile counts of the call sites, or one per site when no
+  /// profile is available.
+  uint64_t Weight = 0;
+
+  SmallVector<CallSite, 8> Sites;
+};
+
+class FunctionSpecializer {
+  ProfileSummaryInfo *PSI;
+
+public:
+  FunctionSpecializer(ProfileSummaryInfo *PSI) : PSI(PSI) {}
+
+  bool run(Module &M);
+
+private:
+  bool isCandidate(const Function &F) const;
+  Optional<SpecializationCandidate> findBestCandidate(Function &F) const;
+  void specialize(Function &F, SpecializationCandidate &SC);
+};
+
+} // end anonymous namespace
+
+bool FunctionSpecializer::isCandidate(const Function &F) const {
+  if (F.isDeclaration() || F.hasOptNone() || F.isVarArg() || F.hasComdat())
+    return false;
+
+  if (F.getInstructionCount() > MaxSpecializedSize)
+    return false;
+
+  // With a profile, only spend the budget on hot callees; cloning cold code
+  // just grows the module.
+  if (PSI->hasProfileSummary() && !PSI->isFunctionEntryHot(&F))
+    return false;
+
+  return true;
+}
+
+Optional<SpecializationCandidate>
+FunctionSpecializer::findBestCandidate(Function &F) const {
+  // Tally constants per argument position over the direct call sites.  A
+  // MapVector keeps the iteration order, and hence the tie-breaking among
+  // equally heavy candidates, deterministic.
+  MapVector<std::pair<unsigned, Constant *>, SpecializationCandidate>
+      Candidates;
+
+  for (Use &U : F.uses()) {
+    CallSite CS(U.getUser());
+    if (!CS || !CS.isCallee(&U))
+      continue;
+
+    // Leave `optnone` callers untouched.
+    if (CS.getInstruction()->getFunction()->hasOptNone())
+      continue;
+
+    uint64_t Count = 1;
+    if (PSI->hasProfileSummary())
+      if (Optional<uint64_t> PC =
+              PSI->getProfileCount(CS.getInstruction(), /*BFI=*/nullptr))
+        Count = *PC;
+
+    for (unsigned ArgNo = 0, E = F.arg_size(); ArgNo != E; ++ArgNo) {
+      Argument *A = F.getArg(ArgNo);
+      // An unused argument is not worth specializing on, and replacing a
+      // byval/inalloca argument with the caller's pointer would drop the
+      // implied copy.
+      if (A->use_empty() || A->hasByValOrInAllocaAttr())
+        continue;
+
+      Constant *C = dyn_cast<Constant>(CS.getArgument(ArgNo));
+      if (!C)
+        continue;
+
+      SpecializationCandidate &Cand = Candidates[{ArgNo, C}];
+      Cand.ArgNo = ArgNo;
+      Cand.C = C;
+      Cand.Weight += Count;
+      Cand.Sites.push_back(CS);
+    }
+  }
+
+  SpecializationCandidate *Best = nullptr;
+  for (auto &KV : Candidates) {
+    SpecializationCandidate &Cand = KV.second;
+    if (Cand.Sites.size() < MinSpecializedCallSites)
+      continue;
+    if (!Best || Cand.Weight > Best->Weight)
+      Best = &Cand;
+  }
+  if (!Best)
+    return None;
+  return std::move(*Best);
+}
+
+void FunctionSpecializer::specialize(Function &F, SpecializationCandidate &SC) {
+  ValueToValueMapTy VMap;
+  Function *Clone = CloneFunction(&F, VMap);
+  Clone->setName(F.getName() + ".specialized");
+  // The clone only serves the rewritten call sites below; keep it out of the
+  // symbol table of the final image.
+  Clone->setLinkage(GlobalValue::InternalLinkage);
+
+  Clone->getArg(SC.ArgNo)->replaceAllUsesWith(SC.C);
+
+  for (CallSite CS : SC.Sites)
+    CS.setCalledFunction(Clone);
+
+  LLVM_DEBUG(dbgs() << "Specialized " << F.getName() << " on argument "
+                    << SC.ArgNo << " = " << *SC.C << " for " << SC.Sites.size()
+                    << " call sites\n");
+  ++NumFunctionsSpecialized;
+}
+
+bool FunctionSpecializer::run(Module &M) {
+  // Collect candidates up front; clones are appended to the module while
+  // call sites are rewritten and must not themselves be visited.
+  SmallVector<Function *, 16> Worklist;
+  for (Function &F : M)
+    if (isCandidate(F))
+      Worklist.push_back(&F);
+
+  bool Changed = false;
+  unsigned Budget = SpecializationLimit;
+  for (Function *F : Worklist) {
+    if (!Budget)
+      break;
+    Optional<SpecializationCandidate> SC = findBestCandidate(*F);
+    if (!SC)
+      continue;
+    specialize(*F, *SC);
+    --Budget;
+    Changed = true;
+  }
+  return Changed;
+}
+
+PreservedAnalyses FunctionSpecializationPass::run(Module &M,
+                                                  ModuleAnalysisManager &AM) {
+  ProfileSummaryInfo *PSI = &AM.getResult<ProfileSummaryAnalysis>(M);
+  if (FunctionSpecializer(PSI).run(M))
+    return PreservedAnalyses::none();
+  return PreservedAnalyses::all();
+}
+
+namespace {
+
+class FunctionSpecializationLegacyPass : public ModulePass {
+public:
+  static char ID;
+
+  FunctionSpecializationLegacyPass() : ModulePass(ID) {
+    initializeFunctionSpecializationLegacyPassPass(
+        *PassRegistry::getPassRegistry());
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const override {
+    AU.addRequired<ProfileSummaryInfoWrapperPass>();
+  }
+
+  bool runOnModule(Module &M) override {
+    if (skipModule(M))
+      return false;
+    ProfileSummaryInfo *PSI =
+        &getAnalysis<ProfileSummaryInfoWrapperPass>().getPSI();
+    return FunctionSpecializer(PSI).run(M);
+  }
+};
+
+} // end anonymous namespace
+
+char FunctionSpecializationLegacyPass::ID = 0;
+INITIALIZE_PASS_BEGIN(FunctionSpecializationLegacyPass, "function-specialize",
+                      "Function Specialization", false, false)
+INITIALIZE_PASS_DEPENDENCY(ProfileSummaryInfoWrapperPass)
+INITIALIZE_PASS_END(FunctionSpecializationLegacyPass, "function-specialize",
+                    "Function Specialization", false, false)
+
+ModulePass *llvm::createFunctionSpecializationPass() {
+  return new FunctionSpecializationLegacyPass();
+}
@@ -91,6 +91,8 @@ STATISTIC(NumAliasesRemoved, "Number of global aliases eliminated");
 STATISTIC(NumCXXDtorsRemoved, "Number of global C++ destructors removed");
 STATISTIC(NumInternalFunc, "Number of internal functions");
 STATISTIC(NumColdCC, "Number of functions marked coldcc");
+STATISTIC(NumStableSkipped,
+          "Number of global re-scans skipped by the use index");
 
 static cl::opt<bool>
     EnableColdCCStressTest("enable-coldcc-stress-test",
@@ -105,6 +107,122 @@ static cl::opt<int> ColdCCRelFreq(
         "entry frequency, for a call site to be considered cold for enabling"
         "coldcc"));
 
+namespace {
+
+/// Remembers globals whose analysis reached a fixed point so that later
+/// iterations of the globalopt fixpoint loop do not re-walk their users.
+///
+/// A global is recorded once processing it made no change, together with its
+/// use count and the modification epoch of every function containing one of
+/// its (transitive) users.  Its analysis cannot come out differently until
+/// one of those functions changes, its use list changes, or a tracked value
+/// is deleted, so a global whose recorded state still matches is skipped.
+/// Mutations that do not tick a function epoch (constructor evaluation
+/// rewriting initializers, alias resolution) must drop the whole index via
+/// invalidateAll().
+class GlobalUseIndex {
+  struct Entry {
+    unsigned NumUses;
+
+    /// Functions containing users, with their epoch at the time of the scan.
+    SmallVector<std::pair<const Function *, uint64_t>, 4> UserFns;
+  };
+
+  /// Helper that invalidates the index when a tracked value is deleted, so
+  /// a later value allocated at the same address cannot match a stale entry.
+  class InvalidateVH final : public CallbackVH {
+    GlobalUseIndex *Idx;
+
+    void deleted() override {
+      GlobalUseIndex *TheIdx = Idx;
+      TheIdx->Stale = true;
+      TheIdx->Watched.erase(getValPtr());
+      // This handle is destroyed by the erase above.
+    }
+
+  public:
+    using DMI = DenseMapInfo<Value *>;
+
+    InvalidateVH(Value *V, GlobalUseIndex *Idx = nullptr)
+        : CallbackVH(V), Idx(Idx) {}
+  };
+
+  friend InvalidateVH;
+
+  DenseMap<const GlobalValue *, Entry> Entries;
+  DenseMap<InvalidateVH, char, InvalidateVH::DMI> Watched;
+  bool Stale = false;
+
+  /// Cap on tracked user functions per global; diffusely used globals are
+  /// not worth the bookkeeping.
+  static const unsigned MaxUserFns = 64;
+
+public:
+  void invalidateAll() { Stale = true; }
+
+  /// Return true if \p GV was recorded and nothing that could change its
+  /// analysis has happened since.
+  bool isUpToDate(const GlobalValue &GV) {
+    if (Stale) {
+      Entries.clear();
+      Watched.clear();
+      Stale = false;
+    }
+    auto It = Entries.find(&GV);
+    if (It == Entries.end())
+      return false;
+    const Entry &E = It->second;
+    if (GV.getNumUses() != E.NumUses) {
+      Entries.erase(It);
+      return false;
+    }
+    for (const auto &FE : E.UserFns)
+      if (FE.first->getModificationEpoch() != FE.second) {
+        Entries.erase(It);
+        return false;
+      }
+    return true;
+  }
+
+  /// Record that processing \p GV made no change.  Does nothing if the
+  /// users cannot be attributed to functions.
+  void record(GlobalValue &GV) {
+    SmallPtrSet<const Function *, 8> Fns;
+    SmallPtrSet<const User *, 16> Visited;
+    SmallVector<const User *, 16> Worklist(GV.user_begin(), GV.user_end());
+    while (!Worklist.empty()) {
+      const User *U = Worklist.pop_back_val();
+      if (!Visited.insert(U).second)
+        continue;
+      if (const auto *I = dyn_cast<Instruction>(U)) {
+        const Function *F = I->getFunction();
+        if (!F)
+          return;
+        if (Fns.insert(F).second && Fns.size() > MaxUserFns)
+          return;
+      } else if (isa<Constant>(U)) {
+        for (const User *UU : U->users())
+          Worklist.push_back(UU);
+      } else {
+        // Unknown user kind; leave the global unrecorded.
+        return;
+      }
+    }
+
+    Entry &E = Entries[&GV];
+    E.NumUses = GV.getNumUses();
+    E.UserFns.clear();
+    for (const Function *F : Fns)
+      E.UserFns.push_back({F, F->getModificationEpoch()});
+
+    Watched.insert({InvalidateVH(&GV, this), 0});
+    for (const Function *F : Fns)
+      Watched.insert({InvalidateVH(const_cast<Function *>(F), this), 0});
+  }
+};
+
+} // end anonymous namespace
+
 /// Is this global variable possibly used by a leak checker as a root?  If so,
 /// we might not really want to eliminate the stores to it.
 static bool isLeakCheckerRoot(GlobalVariable *GV) {
@@ -2351,7 +2469,8 @@ static bool
 OptimizeGlobalVars(Module &M,
                    function_ref<TargetLibraryInfo &(Function &)> GetTLI,
                    function_ref<DominatorTree &(Function &)> LookupDomTree,
-                   SmallPtrSetImpl<const Comdat *> &NotDiscardableComdats) {
+                   SmallPtrSetImpl<const Comdat *> &NotDiscardableComdats,
+                   GlobalUseIndex &UseIndex) {
   bool Changed = false;
 
   for (Module::global_iterator GVI = M.global_begin(), E = M.global_end();
@@ -2360,6 +2479,19 @@ OptimizeGlobalVars(Module &M,
     // Global variables without names cannot be referenced outside this module.
     if (!GV->hasName() && !GV->isDeclaration() && !GV->hasLocalLinkage())
       GV->setLinkage(GlobalValue::InternalLinkage);
+
+    if (deleteIfDead(*GV, NotDiscardableComdats)) {
+      Changed = true;
+      continue;
+    }
+
+    // Nothing that could affect the analysis of this global has changed
+    // since it last reached a fixed point.
+    if (UseIndex.isUpToDate(*GV)) {
+      ++NumStableSkipped;
+      continue;
+    }
+
     // Simplify the initializer.
     if (GV->hasInitializer())
       if (auto *C = dyn_cast<Constant>(GV->getInitializer())) {
@@ -2372,12 +2504,10 @@ OptimizeGlobalVars(Module &M,
           GV->setInitializer(New);
       }
 
-    if (deleteIfDead(*GV, NotDiscardableComdats)) {
+    if (processGlobal(*GV, GetTLI, LookupDomTree))
       Changed = true;
-      continue;
-    }
-
-    Changed |= processGlobal(*GV, GetTLI, LookupDomTree);
+    else
+      UseIndex.record(*GV);
   }
   return Changed;
 }
@@ -2915,6 +3045,7 @@ static bool optimizeGlobalsInModule(
     function_ref<BlockFrequencyInfo &(Function &)> GetBFI,
     function_ref<DominatorTree &(Function &)> LookupDomTree) {
   SmallPtrSet<const Comdat *, 8> NotDiscardableComdats;
+  GlobalUseIndex UseIndex;
   bool Changed = false;
   bool LocalChange = true;
   while (LocalChange) {
@@ -2939,22 +3070,37 @@ static bool optimizeGlobalsInModule(
                                      NotDiscardableComdats);
 
     // Optimize global_ctors list.
-    LocalChange |= optimizeGlobalCtorsList(M, [&](Function *F) {
+    bool CtorsChanged = optimizeGlobalCtorsList(M, [&](Function *F) {
       return EvaluateStaticConstructor(F, DL, &GetTLI(*F));
     });
+    LocalChange |= CtorsChanged;
+
+    // Evaluating constructors rewrites initializers without going through
+    // the functions containing a global's users, so the use index cannot
+    // see those changes.
+    if (CtorsChanged)
+      UseIndex.invalidateAll();
 
     // Optimize non-address-taken globals.
-    LocalChange |=
-        OptimizeGlobalVars(M, GetTLI, LookupDomTree, NotDiscardableComdats);
+    LocalChange |= OptimizeGlobalVars(M, GetTLI, LookupDomTree,
+                                      NotDiscardableComdats, UseIndex);
 
     // Resolve aliases, when possible.
-    LocalChange |= OptimizeGlobalAliases(M, NotDiscardableComdats);
+    bool AliasesChanged = OptimizeGlobalAliases(M, NotDiscardableComdats);
+    LocalChange |= AliasesChanged;
 
     // Try to remove trivial global destructors if they are not removed
     // already.
+    bool DtorsChanged = false;
     Function *CXAAtExitFn = FindCXAAtExit(M, GetTLI);
     if (CXAAtExitFn)
-      LocalChange |= OptimizeEmptyGlobalCXXDtors(CXAAtExitFn);
+      DtorsChanged = OptimizeEmptyGlobalCXXDtors(CXAAtExitFn);
+    LocalChange |= DtorsChanged;
+
+    // Alias resolution and dtor removal likewise rewrite uses in ways the
+    // per-function epochs do not capture.
+    if (AliasesChanged || DtorsChanged)
+      UseIndex.invalidateAll();
 
     Changed |= LocalChange;
   }
@@ -1007,12 +1007,15 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
       return FAM.getResult<BlockFrequencyAnalysis>(F);
     };
 
+    // Whether missed-optimization remarks are requested is a property of the
+    // context's diagnostic handler, not of any particular call site.
+    bool RemarksEnabled =
+        F.getContext().getDiagHandlerPtr()->isMissedOptRemarkEnabled(
+            DEBUG_TYPE);
+
     auto GetInlineCost = [&](CallSite CS) {
       Function &Callee = *CS.getCalledFunction();
       auto &CalleeTTI = FAM.getResult<TargetIRAnalysis>(Callee);
-      bool RemarksEnabled =
-          Callee.getContext().getDiagHandlerPtr()->isMissedOptRemarkEnabled(
-              DEBUG_TYPE);
       return getInlineCost(cast<CallBase>(*CS.getInstruction()), Params,
                            CalleeTTI, GetAssumptionCache, {GetBFI}, PSI,
                            RemarksEnabled ? &ORE : nullptr);
@@ -1063,11 +1066,20 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
       }
 
       // Setup the data structure used to plumb customization into the
-      // `InlineFunction` routine.
+      // `InlineFunction` routine.  Block frequencies are only consulted to
+      // keep profile counts up to date, so don't pay for computing them for
+      // every inlined call when there are no counts to update.  Entry counts
+      // can be present without a full summary, so check for them too.
+      bool HasProfile = PSI && (PSI->hasProfileSummary() ||
+                                CS.getCaller()->getEntryCount().hasValue() ||
+                                Callee.getEntryCount().hasValue());
       InlineFunctionInfo IFI(
           /*cg=*/nullptr, &GetAssumptionCache, PSI,
-          &FAM.getResult<BlockFrequencyAnalysis>(*(CS.getCaller())),
-          &FAM.getResult<BlockFrequencyAnalysis>(Callee));
+          HasProfile
+              ? &FAM.getResult<BlockFrequencyAnalysis>(*(CS.getCaller()))
+              : nullptr,
+          HasProfile ? &FAM.getResult<BlockFrequencyAnalysis>(Callee)
+                     : nullptr);
 
       // Get DebugLoc to report. CS will be invalid after Inliner.
       DebugLoc DLoc = CS->getDebugLoc();
@@ -89,6 +89,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/Optional.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Statistic.h"
@@ -177,10 +178,14 @@ class FunctionNode {
   FunctionComparator::FunctionHash Hash;
 
 public:
-  // Note the hash is recalculated potentially multiple times, but it is cheap.
   FunctionNode(Function *F)
     : F(F), Hash(FunctionComparator::functionHash(*F))  {}
 
+  /// Reuses \p Hash computed for the current body of \p F rather than
+  /// walking the function again.
+  FunctionNode(Function *F, FunctionComparator::FunctionHash Hash)
+      : F(F), Hash(Hash) {}
+
   Function *getFunc() const { return F; }
   FunctionComparator::FunctionHash getHash() const { return Hash; }
 
@@ -227,19 +232,27 @@ private:
 
   GlobalNumberState GlobalNumbers;
 
+  /// A queued function together with its structural hash, when the hash is
+  /// known to describe the function's current body.
+  using WorklistEntry =
+      std::pair<WeakTrackingVH, Optional<FunctionComparator::FunctionHash>>;
+
   /// A work queue of functions that may have been modified and should be
   /// analyzed again.
-  std::vector<WeakTrackingVH> Deferred;
+  std::vector<WorklistEntry> Deferred;
 
 #ifndef NDEBUG
   /// Checks the rules of order relation introduced among functions set.
   /// Returns true, if sanity check has been passed, and false if failed.
-  bool doSanityCheck(std::vector<WeakTrackingVH> &Worklist);
+  bool doSanityCheck(std::vector<WorklistEntry> &Worklist);
 #endif
 
   /// Insert a ComparableFunction into the FnTree, or merge it away if it's
-  /// equal to one that's already present.
-  bool insert(Function *NewFunction);
+  /// equal to one that's already present.  \p KnownHash, when provided, is
+  /// the structural hash of the function's current body and spares walking
+  /// the function again to recompute it.
+  bool insert(Function *NewFunction,
+              Optional<FunctionComparator::FunctionHash> KnownHash = None);
 
   /// Remove a Function from the FnTree and queue it up for a second sweep of
   /// analysis.
@@ -308,7 +321,7 @@ ModulePass *llvm::createMergeFunctionsPass() {
 }
 
 #ifndef NDEBUG
-bool MergeFunctions::doSanityCheck(std::vector<WeakTrackingVH> &Worklist) {
+bool MergeFunctions::doSanityCheck(std::vector<WorklistEntry> &Worklist) {
   if (const unsigned Max = NumFunctionsForSanityCheck) {
     unsigned TripleNumber = 0;
     bool Valid = true;
@@ -316,14 +329,14 @@ bool MergeFunctions::doSanityCheck(std::vector<WeakTrackingVH> &Worklist) {
     dbgs() << "MERGEFUNC-SANITY: Started for first " << Max << " functions.\n";
 
     unsigned i = 0;
-    for (std::vector<WeakTrackingVH>::iterator I = Worklist.begin(),
-                                               E = Worklist.end();
+    for (std::vector<WorklistEntry>::iterator I = Worklist.begin(),
+                                              E = Worklist.end();
          I != E && i < Max; ++I, ++i) {
       unsigned j = i;
-      for (std::vector<WeakTrackingVH>::iterator J = I; J != E && j < Max;
+      for (std::vector<WorklistEntry>::iterator J = I; J != E && j < Max;
            ++J, ++j) {
-        Function *F1 = cast<Function>(*I);
-        Function *F2 = cast<Function>(*J);
+        Function *F1 = cast<Function>(I->first);
+        Function *F2 = cast<Function>(J->first);
         int Res1 = FunctionComparator(F1, F2, &GlobalNumbers).compare();
         int Res2 = FunctionComparator(F2, F1, &GlobalNumbers).compare();
 
@@ -339,12 +352,12 @@ bool MergeFunctions::doSanityCheck(std::vector<WeakTrackingVH> &Worklist) {
           continue;
 
         unsigned k = j;
-        for (std::vector<WeakTrackingVH>::iterator K = J; K != E && k < Max;
+        for (std::vector<WorklistEntry>::iterator K = J; K != E && k < Max;
              ++k, ++K, ++TripleNumber) {
           if (K == J)
             continue;
 
-          Function *F3 = cast<Function>(*K);
+          Function *F3 = cast<Function>(K->first);
           int Res3 = FunctionComparator(F1, F3, &GlobalNumbers).compare();
           int Res4 = FunctionComparator(F2, F3, &GlobalNumbers).compare();
 
@@ -409,12 +422,12 @@ bool MergeFunctions::runOnModule(Module &M) {
     // consider merging it. Otherwise it is dropped and never considered again.
     if ((I != S && std::prev(I)->first == I->first) ||
         (std::next(I) != IE && std::next(I)->first == I->first) ) {
-      Deferred.push_back(WeakTrackingVH(I->second));
+      Deferred.push_back({WeakTrackingVH(I->second), I->first});
     }
   }
 
   do {
-    std::vector<WeakTrackingVH> Worklist;
+    std::vector<WorklistEntry> Worklist;
     Deferred.swap(Worklist);
 
     LLVM_DEBUG(doSanityCheck(Worklist));
@@ -423,12 +436,12 @@ bool MergeFunctions::runOnModule(Module &M) {
     LLVM_DEBUG(dbgs() << "size of worklist: " << Worklist.size() << '\n');
 
     // Insert functions and merge them.
-    for (WeakTrackingVH &I : Worklist) {
-      if (!I)
+    for (WorklistEntry &Entry : Worklist) {
+      if (!Entry.first)
         continue;
-      Function *F = cast<Function>(I);
+      Function *F = cast<Function>(Entry.first);
       if (!F->isDeclaration() && !F->hasAvailableExternallyLinkage()) {
-        Changed |= insert(F);
+        Changed |= insert(F, Entry.second);
       }
     }
     LLVM_DEBUG(dbgs() << "size of FnTree: " << FnTree.size() << '\n');
@@ -899,9 +912,12 @@ static bool isFuncOrderCorrect(const Function *F, const Function *G) {
 
 // Insert a ComparableFunction into the FnTree, or merge it away if equal to one
 // that was already inserted.
-bool MergeFunctions::insert(Function *NewFunction) {
-  std::pair<FnTreeType::iterator, bool> Result =
-      FnTree.insert(FunctionNode(NewFunction));
+bool MergeFunctions::insert(Function *NewFunction,
+                            Optional<FunctionComparator::FunctionHash>
+                                KnownHash) {
+  std::pair<FnTreeType::iterator, bool> Result = FnTree.insert(
+      KnownHash ? FunctionNode(NewFunction, *KnownHash)
+                : FunctionNode(NewFunction));
 
   if (Result.second) {
     assert(FNodesInTree.count(NewFunction) == 0);
@@ -939,7 +955,9 @@ void MergeFunctions::remove(Function *F) {
     // I->second has been invalidated, remove it from the FNodesInTree map to
     // preserve the invariant.
     FNodesInTree.erase(I);
-    Deferred.emplace_back(F);
+    // The function was just modified, so its recorded hash no longer
+    // describes the body; it will be rehashed on re-insertion.
+    Deferred.push_back({WeakTrackingVH(F), None});
   }
 }
 
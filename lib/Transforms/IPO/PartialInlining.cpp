@@ -285,7 +285,8 @@ private:
   // profit.
   bool shouldPartialInline(CallSite CS, FunctionCloner &Cloner,
                            BlockFrequency WeightedOutliningRcost,
-                           OptimizationRemarkEmitter &ORE);
+                           OptimizationRemarkEmitter &ORE,
+                           bool RemarksEnabled);
 
   // Try to inline DuplicateFunction (cloned from F with call to
   // the OutlinedFunction into its callers. Return true
@@ -446,10 +447,16 @@ PartialInlinerImpl::computeOutliningColdRegionsInfo(Function *F,
   };
 
   // Use the same computeBBInlineCost function to compute the cost savings of
-  // the outlining the candidate region.
+  // the outlining the candidate region.  Compute the per-block cost once and
+  // cache it; the candidate regions below reuse it, and overlapping rejected
+  // candidates may otherwise cost the same block several times.
+  DenseMap<BasicBlock *, int> BBCostMap;
   int OverallFunctionCost = 0;
-  for (auto &BB : *F)
-    OverallFunctionCost += computeBBInlineCost(&BB);
+  for (auto &BB : *F) {
+    int Cost = computeBBInlineCost(&BB);
+    BBCostMap[&BB] = Cost;
+    OverallFunctionCost += Cost;
+  }
 
 #ifndef NDEBUG
   if (TracePartialInlining)
@@ -508,7 +515,7 @@ PartialInlinerImpl::computeOutliningColdRegionsInfo(Function *F,
         continue;
       int OutlineRegionCost = 0;
       for (auto *BB : DominateVector)
-        OutlineRegionCost += computeBBInlineCost(BB);
+        OutlineRegionCost += BBCostMap.lookup(BB);
 
 #ifndef NDEBUG
       if (TracePartialInlining)
@@ -760,7 +767,7 @@ PartialInlinerImpl::getOutliningCallBBRelativeFreq(FunctionCloner &Cloner) {
 bool PartialInlinerImpl::shouldPartialInline(
     CallSite CS, FunctionCloner &Cloner,
     BlockFrequency WeightedOutliningRcost,
-    OptimizationRemarkEmitter &ORE) {
+    OptimizationRemarkEmitter &ORE, bool RemarksEnabled) {
   using namespace ore;
 
   Instruction *Call = CS.getInstruction();
@@ -772,9 +779,6 @@ bool PartialInlinerImpl::shouldPartialInline(
 
   Function *Caller = CS.getCaller();
   auto &CalleeTTI = (*GetTTI)(*Callee);
-  bool RemarksEnabled =
-      Callee->getContext().getDiagHandlerPtr()->isMissedOptRemarkEnabled(
-          DEBUG_TYPE);
   assert(Call && "invalid callsite for partial inline");
   InlineCost IC = getInlineCost(cast<CallBase>(*Call), getInlineParams(),
                                 CalleeTTI, *GetAssumptionCache, GetBFI, PSI,
@@ -1388,6 +1392,12 @@ bool PartialInlinerImpl::tryPartialInline(FunctionCloner &Cloner) {
   uint64_t CalleeEntryCountV =
       (CalleeEntryCount ? CalleeEntryCount.getCount() : 0);
 
+  // The diagnostic handler lives on the context shared by every call site, so
+  // query it once rather than per call site.
+  bool RemarksEnabled = Cloner.ClonedFunc->getContext()
+                            .getDiagHandlerPtr()
+                            ->isMissedOptRemarkEnabled(DEBUG_TYPE);
+
   bool AnyInline = false;
   for (User *User : Users) {
     CallSite CS = getCallSite(User);
@@ -1396,7 +1406,8 @@ bool PartialInlinerImpl::tryPartialInline(FunctionCloner &Cloner) {
       continue;
 
     OptimizationRemarkEmitter CallerORE(CS.getCaller());
-    if (!shouldPartialInline(CS, Cloner, WeightedRcost, CallerORE))
+    if (!shouldPartialInline(CS, Cloner, WeightedRcost, CallerORE,
+                             RemarksEnabled))
       continue;
 
     // Construct remark before doing the inlining, as after successful inlining
@@ -22,6 +22,19 @@ using namespace PatternMatch;
 
 #define DEBUG_TYPE "instcombine"
 
+/// Return the opcode of \p V if it is an instruction or a constant expression,
+/// and zero otherwise. Zero is never a real opcode, so the result can be
+/// compared directly against Instruction opcodes. This lets whole groups of
+/// matchers below be skipped with one comparison when no operand has the root
+/// shape that every pattern in the group requires; the commutative matchers in
+/// particular retry each operand order, so bailing out before they run saves
+/// several redundant walks in the common no-match case.
+static unsigned getOperandOpcode(const Value *V) {
+  if (const auto *O = dyn_cast<Operator>(V))
+    return O->getOpcode();
+  return 0;
+}
+
 /// Similar to getICmpCode but for FCmpInst. This encodes a fcmp predicate into
 /// a four bit mask.
 static unsigned getFCmpCode(FCmpInst::Predicate CC) {
@@ -1605,6 +1618,10 @@ static Instruction *foldAndToXor(BinaryOperator &I,
   Value *Op1 = I.getOperand(1);
   Value *A, *B;
 
+  // Every pattern below needs an 'or' on the LHS.
+  if (getOperandOpcode(Op0) != Instruction::Or)
+    return nullptr;
+
   // Operand complexity canonicalization guarantees that the 'or' is Op0.
   // (A | B) & ~(A & B) --> A ^ B
   // (A | B) & ~(B & A) --> A ^ B
@@ -1631,6 +1648,10 @@ static Instruction *foldOrToXor(BinaryOperator &I,
   Value *Op1 = I.getOperand(1);
   Value *A, *B;
 
+  // Every pattern below needs an 'and' on the LHS.
+  if (getOperandOpcode(Op0) != Instruction::And)
+    return nullptr;
+
   // Operand complexity canonicalization guarantees that the 'and' is Op0.
   // (A & B) | ~(A | B) --> ~(A ^ B)
   // (A & B) | ~(B | A) --> ~(A ^ B)
@@ -1873,7 +1894,10 @@ Instruction *InstCombiner::visitAnd(BinaryOperator &I) {
   if (Instruction *DeMorgan = matchDeMorgansLaws(I, Builder))
     return DeMorgan;
 
-  {
+  // Every pattern in this group requires a xor on one side, so skip it all
+  // with two opcode checks when there is none.
+  if (getOperandOpcode(Op0) == Instruction::Xor ||
+      getOperandOpcode(Op1) == Instruction::Xor) {
     Value *A, *B, *C;
     // A & (A ^ B) --> A & ~B
     if (match(Op1, m_OneUse(m_c_Xor(m_Specific(Op0), m_Value(B)))))
@@ -2741,6 +2765,16 @@ static Instruction *foldXorToXor(BinaryOperator &I,
   Value *Op1 = I.getOperand(1);
   Value *A, *B;
 
+  // Every pattern below requires both operands to be and/or/xor (a 'not' is
+  // a xor with all-ones).
+  auto IsBitwiseLogic = [](unsigned Opc) {
+    return Opc == Instruction::And || Opc == Instruction::Or ||
+           Opc == Instruction::Xor;
+  };
+  if (!IsBitwiseLogic(getOperandOpcode(Op0)) ||
+      !IsBitwiseLogic(getOperandOpcode(Op1)))
+    return nullptr;
+
   // There are 4 commuted variants for each of the basic patterns.
 
   // (A & B) ^ (A | B) -> A ^ B
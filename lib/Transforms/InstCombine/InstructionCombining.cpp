@@ -118,6 +118,10 @@ STATISTIC(NumSunkInst , "Number of instructions sunk");
 STATISTIC(NumExpand,    "Number of expansions");
 STATISTIC(NumFactor   , "Number of factorizations");
 STATISTIC(NumReassoc  , "Number of reassociations");
+STATISTIC(NumWorklistVisits,
+          "Number of instructions popped off the InstCombine worklist");
+STATISTIC(MaxWorklistVisitsPerInst,
+          "Maximum visits of one instruction in one fixpoint iteration");
 DEBUG_COUNTER(VisitCounter, "instcombine-visit",
               "Controls which instructions are visited");
 
@@ -3204,10 +3208,20 @@ static bool TryToSinkInstruction(Instruction *I, BasicBlock *DestBlock) {
 }
 
 bool InstCombiner::run() {
+  // Per-instruction visit counts for this fixpoint iteration, maintained only
+  // when statistics are enabled to measure worklist churn. The counts are
+  // keyed by address, so an allocation recycled for a new instruction can
+  // merge two histories; that is fine for a measurement aid.
+  DenseMap<Instruction *, unsigned> VisitCounts;
+
   while (!Worklist.isEmpty()) {
     Instruction *I = Worklist.RemoveOne();
     if (I == nullptr) continue;  // skip null values.
 
+    ++NumWorklistVisits;
+    if (LLVM_UNLIKELY(AreStatisticsEnabled()))
+      MaxWorklistVisitsPerInst.updateMax(++VisitCounts[I]);
+
     // Check to see if we can DCE the instruction.
     if (isInstructionTriviallyDead(I, &TLI)) {
       LLVM_DEBUG(dbgs() << "IC: DCE: " << *I << '\n');
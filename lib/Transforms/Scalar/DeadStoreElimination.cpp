@@ -28,6 +28,8 @@
 #include "llvm/Analysis/MemoryBuiltins.h"
 #include "llvm/Analysis/MemoryDependenceAnalysis.h"
 #include "llvm/Analysis/MemoryLocation.h"
+#include "llvm/Analysis/MemorySSA.h"
+#include "llvm/Analysis/MemorySSAUpdater.h"
 #include "llvm/Analysis/OrderedBasicBlock.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
 #include "llvm/Analysis/ValueTracking.h"
@@ -74,6 +76,7 @@ STATISTIC(NumFastStores, "Number of stores deleted");
 STATISTIC(NumFastOther, "Number of other instrs removed");
 STATISTIC(NumCompletePartials, "Number of stores dead by later partials");
 STATISTIC(NumModifiedStores, "Number of stores modified");
+STATISTIC(NumCrossBlockStores, "Number of cross-block dead stores deleted");
 
 static cl::opt<bool>
 EnablePartialOverwriteTracking("enable-dse-partial-overwrite-tracking",
@@ -85,6 +88,12 @@ EnablePartialStoreMerging("enable-dse-partial-store-merging",
   cl::init(true), cl::Hidden,
   cl::desc("Enable partial store merging in DSE"));
 
+static cl::opt<bool>
+EnableCrossBlockDSE("enable-dse-cross-block",
+  cl::init(false), cl::Hidden,
+  cl::desc("Eliminate dead stores to non-escaping allocas whose overwrite "
+           "is in a later block, using MemorySSA"));
+
 //===----------------------------------------------------------------------===//
 // Helper functions
 //===----------------------------------------------------------------------===//
@@ -1310,10 +1319,135 @@ static bool eliminateDeadStores(BasicBlock &BB, AliasAnalysis *AA,
   return MadeChange;
 }
 
-static bool eliminateDeadStores(Function &F, AliasAnalysis *AA,
+/// Variant of deleteDeadInstruction for the MemorySSA-backed elimination
+/// below: in addition to MemDep, the accesses MemorySSA holds for the dead
+/// instructions must be dropped before they are erased.
+static void deleteDeadInstructionMSSA(Instruction *I, MemorySSAUpdater &Updater,
+                                      MemoryDependenceResults &MD,
+                                      const TargetLibraryInfo &TLI) {
+  SmallVector<Instruction *, 8> NowDeadInsts;
+  NowDeadInsts.push_back(I);
+  --NumFastOther;
+
+  do {
+    Instruction *DeadInst = NowDeadInsts.pop_back_val();
+    ++NumFastOther;
+
+    salvageDebugInfo(*DeadInst);
+
+    // Remove the instruction from the analyses while its operands are still
+    // in place, then drop operands that become trivially dead as well. Dead
+    // loads picked up here have MemorySSA accesses of their own.
+    MD.removeInstruction(DeadInst);
+    if (MemoryAccess *MA =
+            Updater.getMemorySSA()->getMemoryAccess(DeadInst))
+      Updater.removeMemoryAccess(MA);
+
+    for (unsigned Op = 0, E = DeadInst->getNumOperands(); Op != E; ++Op) {
+      Value *OpV = DeadInst->getOperand(Op);
+      DeadInst->setOperand(Op, nullptr);
+
+      if (!OpV->use_empty())
+        continue;
+
+      if (Instruction *OpI = dyn_cast<Instruction>(OpV))
+        if (isInstructionTriviallyDead(OpI, &TLI))
+          NowDeadInsts.push_back(OpI);
+    }
+
+    DeadInst->eraseFromParent();
+  } while (!NowDeadInsts.empty());
+}
+
+/// Eliminate stores that are overwritten in a later block before any read,
+/// which the block-local walk above cannot see.
+///
+/// A store is dead when the only user of its MemoryDef is a later MemoryDef
+/// that completely overwrites the stored location without reading it: any
+/// read of those bytes, on any path, would either use the def directly or go
+/// through a MemoryPhi that uses it. The stored-to object must additionally
+/// be a non-escaping alloca so that paths which reach a return or an unwind
+/// without passing the overwrite cannot make the store observable from
+/// outside the function.
+static bool eliminateCrossBlockDeadStores(Function &F, AliasAnalysis *AA,
+                                          MemorySSA *MSSA,
+                                          MemoryDependenceResults *MD,
+                                          const TargetLibraryInfo *TLI) {
+  const DataLayout &DL = F.getParent()->getDataLayout();
+  MemorySSAUpdater Updater(MSSA);
+  InstOverlapIntervalsTy IOL;
+  DenseMap<const AllocaInst *, bool> CapturedCache;
+  bool MadeChange = false;
+
+  // Collect the candidate defs up front; the elimination below only ever
+  // deletes the candidate currently being visited (stores are never swept up
+  // as trivially dead operands), so the rest of the list stays valid.
+  SmallVector<MemoryDef *, 32> Defs;
+  for (BasicBlock &BB : F)
+    for (Instruction &I : BB)
+      if (isa<StoreInst>(&I))
+        if (auto *D = dyn_cast_or_null<MemoryDef>(MSSA->getMemoryAccess(&I)))
+          Defs.push_back(D);
+
+  for (MemoryDef *D : Defs) {
+    auto *Earlier = cast<StoreInst>(D->getMemoryInst());
+    if (!isRemovable(Earlier) || !D->hasOneUse())
+      continue;
+
+    auto *LaterDef = dyn_cast<MemoryDef>(D->user_back());
+    if (!LaterDef)
+      continue;
+    Instruction *Later = LaterDef->getMemoryInst();
+
+    // Stores and memsets overwrite their destination without reading it; any
+    // other def might read the stored bytes before clobbering them.
+    if (!isa<StoreInst>(Later) && !isa<MemSetInst>(Later))
+      continue;
+
+    MemoryLocation Loc = getLocForWrite(Earlier);
+    MemoryLocation LaterLoc = getLocForWrite(Later);
+    if (!Loc.Ptr || !LaterLoc.Ptr)
+      continue;
+
+    const auto *AI = dyn_cast<AllocaInst>(GetUnderlyingObject(Loc.Ptr, DL));
+    if (!AI)
+      continue;
+    auto CaptureIt = CapturedCache.find(AI);
+    if (CaptureIt == CapturedCache.end())
+      CaptureIt = CapturedCache
+                      .insert({AI, PointerMayBeCaptured(
+                                       AI, /*ReturnCaptures=*/true,
+                                       /*StoreCaptures=*/true)})
+                      .first;
+    if (CaptureIt->second)
+      continue;
+
+    int64_t EarlierOff = 0, LaterOff = 0;
+    if (isOverwrite(LaterLoc, Loc, DL, *TLI, EarlierOff, LaterOff, Earlier,
+                    IOL, *AA, &F) != OW_Complete)
+      continue;
+
+    LLVM_DEBUG(dbgs() << "DSE: Remove Cross-Block Dead Store:\n  DEAD: "
+                      << *Earlier << "\n  KILLER: " << *Later << '\n');
+    deleteDeadInstructionMSSA(Earlier, Updater, *MD, *TLI);
+    ++NumCrossBlockStores;
+    ++NumFastStores;
+    MadeChange = true;
+  }
+
+  return MadeChange;
+}
+
+static bool eliminateDeadStores(Function &F, AliasAnalysis *AA, MemorySSA *MSSA,
                                 MemoryDependenceResults *MD, DominatorTree *DT,
                                 const TargetLibraryInfo *TLI) {
   bool MadeChange = false;
+
+  // Run the MemorySSA-backed walk first: the block-local walk below deletes
+  // instructions without keeping MemorySSA in sync.
+  if (MSSA)
+    MadeChange |= eliminateCrossBlockDeadStores(F, AA, MSSA, MD, TLI);
+
   for (BasicBlock &BB : F)
     // Only check non-dead blocks.  Dead blocks may have strange pointer
     // cycles that will confuse alias analysis.
@@ -1331,8 +1465,11 @@ PreservedAnalyses DSEPass::run(Function &F, FunctionAnalysisManager &AM) {
   DominatorTree *DT = &AM.getResult<DominatorTreeAnalysis>(F);
   MemoryDependenceResults *MD = &AM.getResult<MemoryDependenceAnalysis>(F);
   const TargetLibraryInfo *TLI = &AM.getResult<TargetLibraryAnalysis>(F);
+  MemorySSA *MSSA = EnableCrossBlockDSE
+                        ? &AM.getResult<MemorySSAAnalysis>(F).getMSSA()
+                        : nullptr;
 
-  if (!eliminateDeadStores(F, AA, MD, DT, TLI))
+  if (!eliminateDeadStores(F, AA, MSSA, MD, DT, TLI))
     return PreservedAnalyses::all();
 
   PreservedAnalyses PA;
@@ -1363,8 +1500,11 @@ public:
         &getAnalysis<MemoryDependenceWrapperPass>().getMemDep();
     const TargetLibraryInfo *TLI =
         &getAnalysis<TargetLibraryInfoWrapperPass>().getTLI(F);
+    MemorySSA *MSSA = EnableCrossBlockDSE
+                          ? &getAnalysis<MemorySSAWrapperPass>().getMSSA()
+                          : nullptr;
 
-    return eliminateDeadStores(F, AA, MD, DT, TLI);
+    return eliminateDeadStores(F, AA, MSSA, MD, DT, TLI);
   }
 
   void getAnalysisUsage(AnalysisUsage &AU) const override {
@@ -1376,6 +1516,10 @@ public:
     AU.addPreserved<DominatorTreeWrapperPass>();
     AU.addPreserved<GlobalsAAWrapperPass>();
     AU.addPreserved<MemoryDependenceWrapperPass>();
+    // The block-local walk does not keep MemorySSA up to date, so it is
+    // consumed, never preserved.
+    if (EnableCrossBlockDSE)
+      AU.addRequired<MemorySSAWrapperPass>();
   }
 };
 
@@ -1389,6 +1533,7 @@ INITIALIZE_PASS_DEPENDENCY(DominatorTreeWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(AAResultsWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(GlobalsAAWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(MemoryDependenceWrapperPass)
+INITIALIZE_PASS_DEPENDENCY(MemorySSAWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(TargetLibraryInfoWrapperPass)
 INITIALIZE_PASS_END(DSELegacyPass, "dse", "Dead Store Elimination", false,
                     false)
@@ -1746,10 +1746,13 @@ static bool isOnlyReachableViaThisEdge(const BasicBlockEdge &E,
 
 void GVN::assignBlockRPONumber(Function &F) {
   BlockRPONumber.clear();
+  BlockRPOOrder.clear();
   uint32_t NextBlockNumber = 1;
   ReversePostOrderTraversal<Function *> RPOT(&F);
-  for (BasicBlock *BB : RPOT)
+  for (BasicBlock *BB : RPOT) {
     BlockRPONumber[BB] = NextBlockNumber++;
+    BlockRPOOrder.push_back(BB);
+  }
   InvalidBlockRPONumbers = false;
 }
 
@@ -2137,6 +2140,13 @@ bool GVN::runImpl(Function &F, AssumptionCache &RunAC, DominatorTree &RunDT,
   // Do not cleanup DeadBlocks in cleanupGlobalSets() as it's called for each
   // iteration.
   DeadBlocks.clear();
+  // The RPO numbers also survive the fixpoint iterations (they only change
+  // when the CFG does), so they are dropped here rather than in
+  // cleanupGlobalSets(). The map holds asserting handles, so it must not
+  // outlive the function's blocks.
+  BlockRPONumber.clear();
+  BlockRPOOrder.clear();
+  InvalidBlockRPONumbers = true;
 
   return Changed;
 }
@@ -2476,12 +2486,14 @@ bool GVN::iterateOnFunction(Function &F) {
 
   // Top-down walk of the dominator tree
   bool Changed = false;
-  // Needed for value numbering with phi construction to work.
-  // RPOT walks the graph in its constructor and will not be invalidated during
-  // processBlock.
-  ReversePostOrderTraversal<Function *> RPOT(&F);
+  // Needed for value numbering with phi construction to work. The RPO order
+  // only depends on the CFG, so reuse the order cached by the previous
+  // iteration unless a critical edge has been split since it was computed;
+  // it is not invalidated during processBlock.
+  if (InvalidBlockRPONumbers)
+    assignBlockRPONumber(F);
 
-  for (BasicBlock *BB : RPOT)
+  for (BasicBlock *BB : BlockRPOOrder)
     Changed |= processBlock(BB);
 
   return Changed;
@@ -2490,10 +2502,8 @@ bool GVN::iterateOnFunction(Function &F) {
 void GVN::cleanupGlobalSets() {
   VN.clear();
   LeaderTable.clear();
-  BlockRPONumber.clear();
   TableAllocator.Reset();
   ICF->clear();
-  InvalidBlockRPONumbers = true;
 }
 
 /// Verify that the specified instruction does not occur in our
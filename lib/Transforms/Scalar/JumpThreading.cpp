@@ -84,12 +84,20 @@ using namespace jumpthreading;
 STATISTIC(NumThreads, "Number of jumps threaded");
 STATISTIC(NumFolds,   "Number of terminators folded");
 STATISTIC(NumDupes,   "Number of branch blocks duplicated to eliminate phi");
+STATISTIC(NumBudgetRejects,
+          "Number of profitable threads rejected by the duplication budget");
 
 static cl::opt<unsigned>
 BBDuplicateThreshold("jump-threading-threshold",
           cl::desc("Max block size to duplicate for jump threading"),
           cl::init(6), cl::Hidden);
 
+static cl::opt<unsigned> TotalDuplicateThreshold(
+    "jump-threading-total-threshold",
+    cl::desc("Cap on the total instruction duplication cost per function "
+             "(0 = unlimited)"),
+    cl::init(0), cl::Hidden);
+
 static cl::opt<unsigned>
 ImplicationSearchThreshold(
   "jump-threading-implication-search-threshold",
@@ -387,6 +395,8 @@ bool JumpThreadingPass::runImpl(Function &F, TargetLibraryInfo *TLI_,
   if (!ThreadAcrossLoopHeaders)
     FindLoopHeaders(F);
 
+  DuplicationCostLedger = 0;
+
   bool EverChanged = false;
   bool Changed;
   do {
@@ -543,6 +553,21 @@ static unsigned getJumpThreadDuplicationCost(BasicBlock *BB,
   return Size > Bonus ? Size - Bonus : 0;
 }
 
+/// Charge \p Cost against the per-function duplication budget.  When
+/// -jump-threading-total-threshold is set, this keeps a runaway chain of
+/// individually cheap threads from blowing up the function: each thread is
+/// under the per-block threshold, but every clone creates new blocks that can
+/// themselves be threaded on the next iteration.
+bool JumpThreadingPass::chargeDuplicationCost(unsigned Cost) {
+  if (TotalDuplicateThreshold &&
+      Cost > TotalDuplicateThreshold - DuplicationCostLedger) {
+    ++NumBudgetRejects;
+    return false;
+  }
+  DuplicationCostLedger += Cost;
+  return true;
+}
+
 /// FindLoopHeaders - We do not want jump threading to turn proper loop
 /// structures into irreducible loops.  Doing this breaks up the loop nesting
 /// hierarchy and pessimizes later transformations.  To prevent this from
@@ -1954,6 +1979,11 @@ bool JumpThreadingPass::ThreadEdge(BasicBlock *BB,
                       << "' - Cost is too high: " << JumpThreadCost << "\n");
     return false;
   }
+  if (!chargeDuplicationCost(JumpThreadCost)) {
+    LLVM_DEBUG(dbgs() << "  Not threading BB '" << BB->getName()
+                      << "' - duplication budget exhausted.\n");
+    return false;
+  }
 
   // And finally, do it!  Start by factoring the predecessors if needed.
   BasicBlock *PredBB;
@@ -2280,6 +2310,11 @@ bool JumpThreadingPass::DuplicateCondBranchOnPHIIntoPred(
                       << "' - Cost is too high: " << DuplicationCost << "\n");
     return false;
   }
+  if (!chargeDuplicationCost(DuplicationCost)) {
+    LLVM_DEBUG(dbgs() << "  Not duplicating BB '" << BB->getName()
+                      << "' - duplication budget exhausted.\n");
+    return false;
+  }
 
   // And finally, do it!  Start by factoring the predecessors if needed.
   std::vector<DominatorTree::UpdateType> Updates;
@@ -2718,6 +2753,8 @@ bool JumpThreadingPass::ThreadGuard(BasicBlock *BB, IntrinsicInst *Guard,
   unsigned Cost = getJumpThreadDuplicationCost(BB, AfterGuard, BBDupThreshold);
   if (Cost > BBDupThreshold)
     return false;
+  if (!chargeDuplicationCost(Cost))
+    return false;
   // Duplicate all instructions before the guard and the guard itself to the
   // branch where implication is not proved.
   BasicBlock *GuardedBlock = DuplicateInstructionsInSplitBetween(
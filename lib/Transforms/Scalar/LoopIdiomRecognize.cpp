@@ -107,6 +107,7 @@ using namespace llvm;
 
 STATISTIC(NumMemSet, "Number of memset's formed from loop stores");
 STATISTIC(NumMemCpy, "Number of memcpy's formed from loop load+stores");
+STATISTIC(NumMemMove, "Number of memmove's formed from loop load+stores");
 STATISTIC(NumBCmp, "Number of memcmp's formed from loop 2xload+eq-compare");
 
 static cl::opt<bool> UseLIRCodeSizeHeurs(
@@ -1050,7 +1051,8 @@ bool LoopIdiomRecognize::processLoopStridedStore(
 }
 
 /// If the stored value is a strided load in the same loop with the same stride
-/// this may be transformable into a memcpy.  This kicks in for stuff like
+/// this may be transformable into a memcpy, or a memmove when the source and
+/// destination overlap benignly.  This kicks in for stuff like
 /// for (i) A[i] = B[i];
 bool LoopIdiomRecognize::processLoopStoreOfLoopLoad(StoreInst *SI,
                                                     const SCEV *BECount) {
@@ -1096,14 +1098,24 @@ bool LoopIdiomRecognize::processLoopStoreOfLoopLoad(StoreInst *SI,
   Value *StoreBasePtr = Expander.expandCodeFor(
       StrStart, Builder.getInt8PtrTy(StrAS), Preheader->getTerminator());
 
-  SmallPtrSet<Instruction *, 1> Stores;
+  SmallPtrSet<Instruction *, 2> Stores;
   Stores.insert(SI);
+  bool UseMemMove = false;
   if (mayLoopAccessLocation(StoreBasePtr, ModRefInfo::ModRef, CurLoop, BECount,
                             StoreSize, *AA, Stores)) {
-    Expander.clear();
-    // If we generated new code for the base pointer, clean up.
-    RecursivelyDeleteTriviallyDeadInstructions(StoreBasePtr, TLI);
-    return false;
+    // If the only aliasing access in the loop is the load feeding this store,
+    // the source and destination merely overlap and we may still be able to
+    // use a memmove instead of a memcpy.
+    Stores.insert(LI);
+    if (mayLoopAccessLocation(StoreBasePtr, ModRefInfo::ModRef, CurLoop,
+                              BECount, StoreSize, *AA, Stores)) {
+      Expander.clear();
+      // If we generated new code for the base pointer, clean up.
+      RecursivelyDeleteTriviallyDeadInstructions(StoreBasePtr, TLI);
+      return false;
+    }
+    Stores.erase(LI);
+    UseMemMove = true;
   }
 
   const SCEV *LdStart = LoadEv->getStart();
@@ -1127,6 +1139,29 @@ bool LoopIdiomRecognize::processLoopStoreOfLoopLoad(StoreInst *SI,
     return false;
   }
 
+  if (UseMemMove) {
+    // A memmove reads the entire source as-if before any byte of the
+    // destination is written, but the loop interleaves loads and stores.  The
+    // two are only equivalent if every load reads bytes no prior iteration
+    // has overwritten: for forward copies the destination must lie strictly
+    // below the source, for backward copies strictly above.  We can only
+    // decide this when both expanded base pointers share a common base with
+    // constant offsets.  There is also no unordered-atomic memmove intrinsic.
+    int64_t LoadOff = 0, StoreOff = 0;
+    const Value *LoadBase = GetPointerBaseWithConstantOffset(
+        LoadBasePtr, LoadOff, *DL);
+    const Value *StoreBase = GetPointerBaseWithConstantOffset(
+        StoreBasePtr, StoreOff, *DL);
+    if (LoadBase != StoreBase || SI->isAtomic() || LI->isAtomic() ||
+        (!NegStride && LoadOff <= StoreOff) ||
+        (NegStride && LoadOff >= StoreOff)) {
+      Expander.clear();
+      RecursivelyDeleteTriviallyDeadInstructions(LoadBasePtr, TLI);
+      RecursivelyDeleteTriviallyDeadInstructions(StoreBasePtr, TLI);
+      return false;
+    }
+  }
+
   if (avoidLIRForMultiBlockLoop())
     return false;
 
@@ -1142,7 +1177,10 @@ bool LoopIdiomRecognize::processLoopStoreOfLoopLoad(StoreInst *SI,
   // Check whether to generate an unordered atomic memcpy:
   //  If the load or store are atomic, then they must necessarily be unordered
   //  by previous checks.
-  if (!SI->isAtomic() && !LI->isAtomic())
+  if (UseMemMove)
+    NewCall = Builder.CreateMemMove(StoreBasePtr, SI->getAlignment(),
+                                    LoadBasePtr, LI->getAlignment(), NumBytes);
+  else if (!SI->isAtomic() && !LI->isAtomic())
     NewCall = Builder.CreateMemCpy(StoreBasePtr, SI->getAlignment(),
                                    LoadBasePtr, LI->getAlignment(), NumBytes);
   else {
@@ -1168,7 +1206,8 @@ bool LoopIdiomRecognize::processLoopStoreOfLoopLoad(StoreInst *SI,
   }
   NewCall->setDebugLoc(SI->getDebugLoc());
 
-  LLVM_DEBUG(dbgs() << "  Formed memcpy: " << *NewCall << "\n"
+  LLVM_DEBUG(dbgs() << "  Formed " << (UseMemMove ? "memmove: " : "memcpy: ")
+                    << *NewCall << "\n"
                     << "    from load ptr=" << *LoadEv << " at: " << *LI << "\n"
                     << "    from store ptr=" << *StoreEv << " at: " << *SI
                     << "\n");
@@ -1184,7 +1223,10 @@ bool LoopIdiomRecognize::processLoopStoreOfLoopLoad(StoreInst *SI,
   // Okay, the memcpy has been formed.  Zap the original store and anything that
   // feeds into it.
   deleteDeadInstruction(SI);
-  ++NumMemCpy;
+  if (UseMemMove)
+    ++NumMemMove;
+  else
+    ++NumMemCpy;
   return true;
 }
 
@@ -2383,6 +2383,21 @@ ReassociatePass::BuildPairMap(ReversePostOrderTraversal<Function *> &RPOT) {
 }
 
 PreservedAnalyses ReassociatePass::run(Function &F, FunctionAnalysisManager &) {
+  // Fast path: this pass only rewrites unary and binary operators, plus any
+  // trivially dead instructions it deletes along the way.  A function without
+  // either (common in glue and data-movement code) cannot be changed, so don't
+  // bother building the rank and pair maps for it.
+  auto MayBeChanged = [](Function &F) {
+    for (BasicBlock &BB : F)
+      for (Instruction &I : BB)
+        if (isa<UnaryOperator>(I) || isa<BinaryOperator>(I) ||
+            isInstructionTriviallyDead(&I))
+          return true;
+    return false;
+  };
+  if (!MayBeChanged(F))
+    return PreservedAnalyses::all();
+
   // Get the functions basic blocks in Reverse Post Order. This order is used by
   // BuildRankMap to pre calculate ranks correctly. It also excludes dead basic
   // blocks (it has been seen that the analysis in this pass could hang when
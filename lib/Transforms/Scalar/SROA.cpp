@@ -4276,12 +4276,27 @@ bool SROA::splitAlloca(AllocaInst &AI, AllocaSlices &AS) {
   const uint64_t MaxBitVectorSize = 1024;
   if (AllocaSize <= MaxBitVectorSize) {
     // If a byte boundary is included in any load or store, a slice starting or
-    // ending at the boundary is not splittable.
+    // ending at the boundary is not splittable. Accumulate the covered
+    // interior bytes with a difference array so the cost is linear in the
+    // number of slices plus the alloca size, rather than the sum of all slice
+    // lengths; allocas with tens of thousands of overlapping slices are seen
+    // in generated code.
     SmallBitVector SplittableOffset(AllocaSize + 1, true);
-    for (Slice &S : AS)
-      for (unsigned O = S.beginOffset() + 1;
-           O < S.endOffset() && O < AllocaSize; O++)
+    SmallVector<int, 8> Coverage(AllocaSize + 1, 0);
+    for (Slice &S : AS) {
+      uint64_t Begin = S.beginOffset() + 1;
+      uint64_t End = std::min(S.endOffset(), AllocaSize);
+      if (Begin < End) {
+        ++Coverage[Begin];
+        --Coverage[End];
+      }
+    }
+    int Covering = 0;
+    for (uint64_t O = 1; O < AllocaSize; O++) {
+      Covering += Coverage[O];
+      if (Covering)
         SplittableOffset.reset(O);
+    }
 
     for (Slice &S : AS) {
       if (!S.isSplittable())
@@ -0,0 +1,62 @@
+//===- BatchRAUW.cpp - Bulk replaceAllUsesWith helper ---------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the BatchRAUW class.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Transforms/Utils/BatchRAUW.h"
+#include "llvm/IR/Type.h"
+#include "llvm/IR/Value.h"
+
+using namespace llvm;
+
+#define DEBUG_TYPE "batchrauw"
+
+/// Follow replacement chains from \p From to the value that is not itself
+/// being replaced, compressing the visited entries so later lookups are O(1).
+static Value *resolveTarget(DenseMap<Value *, Value *> &Targets, Value *From) {
+  SmallVector<Value *, 4> Chain;
+  Value *V = From;
+  while (true) {
+    auto It = Targets.find(V);
+    if (It == Targets.end())
+      break;
+    Chain.push_back(V);
+    V = It->second;
+    assert(Chain.size() <= Targets.size() &&
+           "BatchRAUW replacements form a cycle");
+  }
+  for (Value *Link : Chain)
+    Targets[Link] = V;
+  return V;
+}
+
+void BatchRAUW::addReplacement(Value *From, Value *To) {
+  assert(From != To && "Replacing a value with itself");
+  assert(From->getType() == To->getType() &&
+         "Replacement value must have the same type");
+  Value *&Target = Targets[From];
+  if (!Target)
+    FromValues.push_back(From);
+  Target = To;
+}
+
+void BatchRAUW::execute() {
+  // Resolve chains first so each use-list is walked exactly once, with the
+  // final target. This is what coalesces ValueHandle callbacks: a handle on
+  // a chained value sees one RAUW to the final replacement instead of one
+  // per link.
+  for (Value *From : FromValues)
+    Targets[From] = resolveTarget(Targets, From);
+
+  for (Value *From : FromValues)
+    From->replaceAllUsesWith(Targets.lookup(From));
+
+  clear();
+}
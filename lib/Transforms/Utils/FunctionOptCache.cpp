@@ -0,0 +1,121 @@
+//===- FunctionOptCache.cpp - Reuse optimized bodies of identical funcs ---===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Groups functions that are identical before optimization, runs the function
+// pipeline on one representative per group and clones the optimized body into
+// the other members. The grouping reuses FunctionComparator from
+// MergeFunctions, which also compares signatures and attributes, so a body is
+// only ever spliced into a function with identical pre-optimization
+// semantics.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Transforms/Utils/FunctionOptCache.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+#include "llvm/Transforms/Utils/FunctionComparator.h"
+
+using namespace llvm;
+
+#define DEBUG_TYPE "function-opt-cache"
+
+STATISTIC(NumOptimizedBodiesReused,
+          "Number of functions that reused an already optimized body");
+
+/// Replace the body of \p To with a clone of the optimized body of the
+/// identical function \p From.
+static void spliceOptimizedBody(Function &To, Function &From) {
+  // deleteBody resets the linkage to external; remember the original.
+  GlobalValue::LinkageTypes Linkage = To.getLinkage();
+  To.deleteBody();
+  To.setLinkage(Linkage);
+
+  ValueToValueMapTy VMap;
+  auto ToArgIt = To.arg_begin();
+  for (Argument &Arg : From.args())
+    VMap[&Arg] = &*ToArgIt++;
+  // Keep recursive references pointing at the function being filled in.
+  VMap[&From] = &To;
+
+  SmallVector<ReturnInst *, 8> Returns;
+  CloneFunctionInto(&To, &From, VMap, /*ModuleLevelChanges=*/false, Returns);
+}
+
+PreservedAnalyses FunctionOptCachePass::run(Module &M,
+                                            ModuleAnalysisManager &AM) {
+  FunctionAnalysisManager &FAM =
+      AM.getResult<FunctionAnalysisManagerModuleProxy>(M).getManager();
+
+  PassInstrumentation PI = AM.getResult<PassInstrumentationAnalysis>(M);
+
+  // Bucket the functions by hash and confirm candidates with a full
+  // comparison before running any passes; the comparison is only meaningful
+  // while the bodies are still unoptimized.
+  GlobalNumberState GlobalNumbers;
+  DenseMap<FunctionComparator::FunctionHash, SmallVector<Function *, 2>>
+      Buckets;
+  for (Function &F : M)
+    if (!F.isDeclaration())
+      Buckets[FunctionComparator::functionHash(F)].push_back(&F);
+
+  // Maps each duplicate to the first identical function in module order,
+  // whose optimized body it will reuse.
+  DenseMap<Function *, Function *> ReuseFrom;
+  for (auto &Bucket : Buckets) {
+    auto &Fns = Bucket.second;
+    if (Fns.size() < 2)
+      continue;
+    SmallVector<Function *, 2> Leaders;
+    for (Function *F : Fns) {
+      auto It = llvm::find_if(Leaders, [&](Function *L) {
+        return FunctionComparator(L, F, &GlobalNumbers).compare() == 0;
+      });
+      if (It != Leaders.end())
+        ReuseFrom[F] = *It;
+      else
+        Leaders.push_back(F);
+    }
+  }
+
+  PreservedAnalyses PA = PreservedAnalyses::all();
+  for (Function &F : M) {
+    if (F.isDeclaration())
+      continue;
+
+    auto ReuseIt = ReuseFrom.find(&F);
+    if (ReuseIt != ReuseFrom.end()) {
+      // Module order guarantees the leader was already optimized above.
+      spliceOptimizedBody(F, *ReuseIt->second);
+      ++NumOptimizedBodiesReused;
+      FAM.invalidate(F, PreservedAnalyses::none());
+      continue;
+    }
+
+    if (!PI.runBeforePass<Function>(FPM, F))
+      continue;
+    PreservedAnalyses PassPA = FPM.run(F, FAM);
+    PI.runAfterPass(FPM, F);
+
+    // As in ModuleToFunctionPassAdaptor, handle the function analysis
+    // manager's invalidation directly and fold the rest into the module-level
+    // preserved set.
+    FAM.invalidate(F, PassPA);
+    PA.intersect(std::move(PassPA));
+  }
+
+  // No functions were added or removed, and all function analysis
+  // invalidation was handled above.
+  PA.preserveSet<AllAnalysesOn<Function>>();
+  PA.preserve<FunctionAnalysisManagerModuleProxy>();
+  return PA;
+}
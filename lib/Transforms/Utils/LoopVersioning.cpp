@@ -13,6 +13,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Transforms/Utils/LoopVersioning.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/Analysis/LoopAccessAnalysis.h"
 #include "llvm/Analysis/LoopInfo.h"
 #include "llvm/Analysis/ScalarEvolutionExpander.h"
@@ -51,6 +52,26 @@ void LoopVersioning::setSCEVChecks(SCEVUnionPredicate Check) {
   Preds = std::move(Check);
 }
 
+void LoopVersioning::addAliasChecks(
+    ArrayRef<RuntimePointerChecking::PointerCheck> Checks) {
+  // A pair of checking groups only needs to be tested once, whichever order
+  // it was recorded in.
+  DenseSet<RuntimePointerChecking::PointerCheck> Covered;
+  for (const auto &Check : AliasChecks) {
+    Covered.insert(Check);
+    Covered.insert({Check.second, Check.first});
+  }
+  for (const auto &Check : Checks)
+    if (Covered.insert(Check).second) {
+      Covered.insert({Check.second, Check.first});
+      AliasChecks.push_back(Check);
+    }
+}
+
+void LoopVersioning::addSCEVChecks(const SCEVUnionPredicate &Check) {
+  Preds.add(&Check);
+}
+
 void LoopVersioning::versionLoop(
     const SmallVectorImpl<Instruction *> &DefsUsedOutside) {
   Instruction *FirstCheckInst;
@@ -63,11 +84,13 @@ void LoopVersioning::versionLoop(
   std::tie(FirstCheckInst, MemRuntimeCheck) =
       LAI.addRuntimeChecks(RuntimeCheckBB->getTerminator(), AliasChecks);
 
-  const SCEVUnionPredicate &Pred = LAI.getPSE().getUnionPredicate();
   SCEVExpander Exp(*SE, RuntimeCheckBB->getModule()->getDataLayout(),
                    "scev.check");
+  // Expand the SCEV checks the client configured (by default LAI's union
+  // predicate), not LAI's directly: a client may have pruned or merged the
+  // predicate set before versioning.
   SCEVRuntimeCheck =
-      Exp.expandCodeForPredicate(&Pred, RuntimeCheckBB->getTerminator());
+      Exp.expandCodeForPredicate(&Preds, RuntimeCheckBB->getTerminator());
   auto *CI = dyn_cast<ConstantInt>(SCEVRuntimeCheck);
 
   // Discard the SCEV runtime check if it is always true.
@@ -133,6 +133,12 @@ static cl::opt<unsigned> MaxSpeculationDepth(
     cl::desc("Limit maximum recursion depth when calculating costs of "
              "speculatively executed instructions"));
 
+static cl::opt<bool> InterleaveLookupTables(
+    "simplifycfg-interleave-lookup-tables", cl::Hidden, cl::init(false),
+    cl::desc("When a switch produces several results that each need an "
+             "in-memory lookup table, emit one array of structs instead of "
+             "one array per result"));
+
 STATISTIC(NumBitMaps, "Number of switch instructions turned into bitmaps");
 STATISTIC(NumLinearMaps,
           "Number of switch instructions turned into linear mapping");
@@ -141,6 +147,8 @@ STATISTIC(NumLookupTables,
 STATISTIC(
     NumLookupTablesHoles,
     "Number of switch instructions turned into lookup tables (holes checked)");
+STATISTIC(NumInterleavedTables,
+          "Number of interleaved multi-result switch lookup tables built");
 STATISTIC(NumTableCmpReuses, "Number of reused switch table lookup compares");
 STATISTIC(NumSinkCommons,
           "Number of common instructions sunk down to the end block");
@@ -4932,7 +4940,30 @@ public:
   static bool WouldFitInRegister(const DataLayout &DL, uint64_t TableSize,
                                  Type *ElementType);
 
+  /// Build the complete table contents into TableContents, filling any holes
+  /// with DefaultValue. Returns the common value if every element is the
+  /// same, otherwise null.
+  static Constant *BuildContents(
+      uint64_t TableSize, ConstantInt *Offset,
+      const SmallVectorImpl<std::pair<ConstantInt *, Constant *>> &Values,
+      Constant *DefaultValue, SmallVectorImpl<Constant *> &TableContents);
+
+  /// Return true if this table would be materialized as an in-memory array
+  /// (ArrayKind): neither of the computed representations (single value,
+  /// linear map) applies and the contents do not pack into a register-sized
+  /// bitmap.
+  static bool NeedsArray(
+      uint64_t TableSize, ConstantInt *Offset,
+      const SmallVectorImpl<std::pair<ConstantInt *, Constant *>> &Values,
+      Constant *DefaultValue, const DataLayout &DL);
+
 private:
+  /// If the integer contents form an arithmetic progression over the table
+  /// index, return true and set Offset and Multiplier to the derived
+  /// constants.
+  static bool IsLinearMap(ArrayRef<Constant *> TableContents,
+                          ConstantInt *&Offset, ConstantInt *&Multiplier);
+
   // Depending on the contents of the table, it can be represented in
   // different ways.
   enum {
@@ -4979,38 +5010,12 @@ SwitchLookupTable::SwitchLookupTable(
   assert(Values.size() && "Can't build lookup table without values!");
   assert(TableSize >= Values.size() && "Can't fit values in table!");
 
-  // If all values in the table are equal, this is that value.
-  SingleValue = Values.begin()->second;
-
   Type *ValueType = Values.begin()->second->getType();
 
   // Build up the table contents.
-  SmallVector<Constant *, 64> TableContents(TableSize);
-  for (size_t I = 0, E = Values.size(); I != E; ++I) {
-    ConstantInt *CaseVal = Values[I].first;
-    Constant *CaseRes = Values[I].second;
-    assert(CaseRes->getType() == ValueType);
-
-    uint64_t Idx = (CaseVal->getValue() - Offset->getValue()).getLimitedValue();
-    TableContents[Idx] = CaseRes;
-
-    if (CaseRes != SingleValue)
-      SingleValue = nullptr;
-  }
-
-  // Fill in any holes in the table with the default result.
-  if (Values.size() < TableSize) {
-    assert(DefaultValue &&
-           "Need a default value to fill the lookup table holes.");
-    assert(DefaultValue->getType() == ValueType);
-    for (uint64_t I = 0; I < TableSize; ++I) {
-      if (!TableContents[I])
-        TableContents[I] = DefaultValue;
-    }
-
-    if (DefaultValue != SingleValue)
-      SingleValue = nullptr;
-  }
+  SmallVector<Constant *, 64> TableContents;
+  SingleValue =
+      BuildContents(TableSize, Offset, Values, DefaultValue, TableContents);
 
   // If each element in the table contains the same value, we only need to store
   // that single value.
@@ -5021,39 +5026,11 @@ SwitchLookupTable::SwitchLookupTable(
 
   // Check if we can derive the value with a linear transformation from the
   // table index.
-  if (isa<IntegerType>(ValueType)) {
-    bool LinearMappingPossible = true;
-    APInt PrevVal;
-    APInt DistToPrev;
-    assert(TableSize >= 2 && "Should be a SingleValue table.");
-    // Check if there is the same distance between two consecutive values.
-    for (uint64_t I = 0; I < TableSize; ++I) {
-      ConstantInt *ConstVal = dyn_cast<ConstantInt>(TableContents[I]);
-      if (!ConstVal) {
-        // This is an undef. We could deal with it, but undefs in lookup tables
-        // are very seldom. It's probably not worth the additional complexity.
-        LinearMappingPossible = false;
-        break;
-      }
-      const APInt &Val = ConstVal->getValue();
-      if (I != 0) {
-        APInt Dist = Val - PrevVal;
-        if (I == 1) {
-          DistToPrev = Dist;
-        } else if (Dist != DistToPrev) {
-          LinearMappingPossible = false;
-          break;
-        }
-      }
-      PrevVal = Val;
-    }
-    if (LinearMappingPossible) {
-      LinearOffset = cast<ConstantInt>(TableContents[0]);
-      LinearMultiplier = ConstantInt::get(M.getContext(), DistToPrev);
-      Kind = LinearMapKind;
-      ++NumLinearMaps;
-      return;
-    }
+  if (isa<IntegerType>(ValueType) &&
+      IsLinearMap(TableContents, LinearOffset, LinearMultiplier)) {
+    Kind = LinearMapKind;
+    ++NumLinearMaps;
+    return;
   }
 
   // If the type is integer and the table fits in a register, build a bitmap.
@@ -5089,6 +5066,90 @@ SwitchLookupTable::SwitchLookupTable(
   Kind = ArrayKind;
 }
 
+Constant *SwitchLookupTable::BuildContents(
+    uint64_t TableSize, ConstantInt *Offset,
+    const SmallVectorImpl<std::pair<ConstantInt *, Constant *>> &Values,
+    Constant *DefaultValue, SmallVectorImpl<Constant *> &TableContents) {
+  // If all values in the table are equal, this is that value.
+  Constant *SingleValue = Values.begin()->second;
+
+  TableContents.assign(TableSize, nullptr);
+  for (size_t I = 0, E = Values.size(); I != E; ++I) {
+    ConstantInt *CaseVal = Values[I].first;
+    Constant *CaseRes = Values[I].second;
+    assert(CaseRes->getType() == SingleValue->getType());
+
+    uint64_t Idx = (CaseVal->getValue() - Offset->getValue()).getLimitedValue();
+    TableContents[Idx] = CaseRes;
+
+    if (CaseRes != SingleValue)
+      SingleValue = nullptr;
+  }
+
+  // Fill in any holes in the table with the default result.
+  if (Values.size() < TableSize) {
+    assert(DefaultValue &&
+           "Need a default value to fill the lookup table holes.");
+    assert(DefaultValue->getType() == Values.begin()->second->getType());
+    for (uint64_t I = 0; I < TableSize; ++I) {
+      if (!TableContents[I])
+        TableContents[I] = DefaultValue;
+    }
+
+    if (DefaultValue != SingleValue)
+      SingleValue = nullptr;
+  }
+
+  return SingleValue;
+}
+
+bool SwitchLookupTable::IsLinearMap(ArrayRef<Constant *> TableContents,
+                                    ConstantInt *&Offset,
+                                    ConstantInt *&Multiplier) {
+  APInt PrevVal;
+  APInt DistToPrev;
+  assert(TableContents.size() >= 2 && "Should be a SingleValue table.");
+  // Check if there is the same distance between two consecutive values.
+  for (uint64_t I = 0, E = TableContents.size(); I != E; ++I) {
+    ConstantInt *ConstVal = dyn_cast<ConstantInt>(TableContents[I]);
+    if (!ConstVal)
+      // This is an undef. We could deal with it, but undefs in lookup tables
+      // are very seldom. It's probably not worth the additional complexity.
+      return false;
+    const APInt &Val = ConstVal->getValue();
+    if (I != 0) {
+      APInt Dist = Val - PrevVal;
+      if (I == 1)
+        DistToPrev = Dist;
+      else if (Dist != DistToPrev)
+        return false;
+    }
+    PrevVal = Val;
+  }
+  Offset = cast<ConstantInt>(TableContents[0]);
+  Multiplier =
+      ConstantInt::get(TableContents[0]->getContext(), DistToPrev);
+  return true;
+}
+
+bool SwitchLookupTable::NeedsArray(
+    uint64_t TableSize, ConstantInt *Offset,
+    const SmallVectorImpl<std::pair<ConstantInt *, Constant *>> &Values,
+    Constant *DefaultValue, const DataLayout &DL) {
+  Type *ValueType = Values.begin()->second->getType();
+
+  SmallVector<Constant *, 64> TableContents;
+  if (BuildContents(TableSize, Offset, Values, DefaultValue, TableContents))
+    return false;
+
+  ConstantInt *UnusedOffset, *UnusedMultiplier;
+  if (isa<IntegerType>(ValueType) &&
+      IsLinearMap(TableContents, UnusedOffset, UnusedMultiplier))
+    return false;
+
+  return !WouldFitInRegister(DL, TableSize, ValueType);
+}
+
 Value *SwitchLookupTable::BuildLookup(Value *Index, IRBuilder<> &Builder) {
   switch (Kind) {
   case SingleValueKind:
@@ -5392,6 +5453,54 @@ static bool SwitchToLookupTable(SwitchInst *SI, IRBuilder<> &Builder,
   BasicBlock *LookupBB = BasicBlock::Create(
       Mod.getContext(), "switch.lookup", CommonDest->getParent(), CommonDest);
 
+  // If several phis would each need an in-memory table, optionally interleave
+  // their contents into a single array of structs so that one dispatch
+  // touches adjacent bytes instead of one array (and likely one cache line)
+  // per result.
+  SmallDenseMap<PHINode *, unsigned> InterleavedFieldIdx;
+  StructType *InterleavedRowTy = nullptr;
+  GlobalVariable *InterleavedArray = nullptr;
+  if (InterleaveLookupTables) {
+    SmallVector<PHINode *, 4> ArrayPHIs;
+    for (PHINode *PHI : PHIs) {
+      Constant *DV = NeedMask ? ResultLists[PHI][0].second : DefaultResults[PHI];
+      if (SwitchLookupTable::NeedsArray(TableSize, MinCaseVal, ResultLists[PHI],
+                                        DV, DL))
+        ArrayPHIs.push_back(PHI);
+    }
+    if (ArrayPHIs.size() >= 2) {
+      SmallVector<Type *, 4> FieldTypes;
+      SmallVector<SmallVector<Constant *, 64>, 4> Columns(ArrayPHIs.size());
+      for (unsigned I = 0, E = ArrayPHIs.size(); I != E; ++I) {
+        PHINode *PHI = ArrayPHIs[I];
+        Constant *DV =
+            NeedMask ? ResultLists[PHI][0].second : DefaultResults[PHI];
+        SwitchLookupTable::BuildContents(TableSize, MinCaseVal,
+                                         ResultLists[PHI], DV, Columns[I]);
+        FieldTypes.push_back(ResultTypes[PHI]);
+        InterleavedFieldIdx[PHI] = I;
+      }
+      InterleavedRowTy = StructType::get(Mod.getContext(), FieldTypes);
+      SmallVector<Constant *, 64> Rows;
+      Rows.reserve(TableSize);
+      for (uint64_t Row = 0; Row != TableSize; ++Row) {
+        SmallVector<Constant *, 4> Fields;
+        for (const auto &Column : Columns)
+          Fields.push_back(Column[Row]);
+        Rows.push_back(ConstantStruct::get(InterleavedRowTy, Fields));
+      }
+      ArrayType *ArrayTy = ArrayType::get(InterleavedRowTy, TableSize);
+      InterleavedArray = new GlobalVariable(
+          Mod, ArrayTy, /*isConstant=*/true, GlobalVariable::PrivateLinkage,
+          ConstantArray::get(ArrayTy, Rows),
+          "switch.interleaved." + Fn->getName());
+      InterleavedArray->setUnnamedAddr(GlobalValue::UnnamedAddr::Global);
+      InterleavedArray->setAlignment(
+          Align(DL.getPrefTypeAlignment(InterleavedRowTy)));
+      ++NumInterleavedTables;
+    }
+  }
+
   // Compute the table index value.
   Builder.SetInsertPoint(SI);
   Value *TableIndex;
@@ -5475,17 +5584,43 @@ static bool SwitchToLookupTable(SwitchInst *SI, IRBuilder<> &Builder,
                                             /*KeepOneInputPHIs=*/true);
   }
 
+  // If we built an interleaved array, compute the pointer to the row for this
+  // index once; each participating phi then loads its own field of the row.
+  Value *InterleavedRow = nullptr;
+  if (InterleavedArray) {
+    // Make sure the table index will not overflow when treated as signed.
+    Value *RowIndex = TableIndex;
+    IntegerType *IT = cast<IntegerType>(RowIndex->getType());
+    if (TableSize > (1ULL << (IT->getBitWidth() - 1)))
+      RowIndex = Builder.CreateZExt(
+          RowIndex, IntegerType::get(IT->getContext(), IT->getBitWidth() + 1),
+          "switch.tableidx.zext");
+
+    Value *GEPIndices[] = {Builder.getInt32(0), RowIndex};
+    InterleavedRow =
+        Builder.CreateInBoundsGEP(InterleavedArray->getValueType(),
+                                  InterleavedArray, GEPIndices, "switch.gep");
+  }
+
   bool ReturnedEarly = false;
   for (PHINode *PHI : PHIs) {
     const ResultListTy &ResultList = ResultLists[PHI];
 
     // If using a bitmask, use any value to fill the lookup table holes.
     Constant *DV = NeedMask ? ResultLists[PHI][0].second : DefaultResults[PHI];
-    StringRef FuncName = Fn->getName();
-    SwitchLookupTable Table(Mod, TableSize, MinCaseVal, ResultList, DV, DL,
-                            FuncName);
 
-    Value *Result = Table.BuildLookup(TableIndex, Builder);
+    Value *Result;
+    auto FieldIt = InterleavedFieldIdx.find(PHI);
+    if (FieldIt != InterleavedFieldIdx.end()) {
+      Value *FieldPtr = Builder.CreateStructGEP(
+          InterleavedRowTy, InterleavedRow, FieldIt->second, "switch.field");
+      Result = Builder.CreateLoad(ResultTypes[PHI], FieldPtr, "switch.load");
+    } else {
+      StringRef FuncName = Fn->getName();
+      SwitchLookupTable Table(Mod, TableSize, MinCaseVal, ResultList, DV, DL,
+                              FuncName);
+      Result = Table.BuildLookup(TableIndex, Builder);
+    }
 
     // If the result is used to return immediately from the function, we want to
     // do that right here.
@@ -18,10 +18,12 @@
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/IR/BasicBlock.h"
 #include "llvm/IR/Comdat.h"
 #include "llvm/IR/Constant.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Function.h"
+#include "llvm/IR/InstrTypes.h"
 #include "llvm/IR/GlobalAlias.h"
 #include "llvm/IR/GlobalObject.h"
 #include "llvm/IR/GlobalIndirectSymbol.h"
@@ -32,6 +34,7 @@
 #include "llvm/IR/User.h"
 #include "llvm/IR/Value.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MD5.h"
@@ -50,6 +53,11 @@ using namespace llvm;
 
 #define DEBUG_TYPE "split-module"
 
+static cl::opt<bool> SplitByCallGraph(
+    "split-module-by-callgraph", cl::Hidden, cl::init(false),
+    cl::desc("Cluster callers with their hottest callees when splitting a "
+             "module instead of assigning globals to partitions by hash"));
+
 namespace {
 
 using ClusterMapType = EquivalenceClasses<const GlobalValue *>;
@@ -91,6 +99,19 @@ static void addAllGlobalValueUsers(ClusterMapType &GVtoClusterMap,
   }
 }
 
+// Rough codegen cost of a global, used to balance partitions when splitting
+// by call graph. Functions are weighted by instruction count; other globals
+// cost comparatively little to emit.
+static uint64_t getNodeWeight(const GlobalValue *GV) {
+  const auto *F = dyn_cast<Function>(GV);
+  if (!F || F->isDeclaration())
+    return 1;
+  uint64_t Weight = 1;
+  for (const BasicBlock &BB : *F)
+    Weight += BB.size();
+  return Weight;
+}
+
 // Find partitions for module in the way that no locals need to be
 // globalized.
 // Try to balance pack those partitions into N files since this roughly equals
@@ -148,37 +169,129 @@ static void findPartitions(Module *M, ClusterIDMapType &ClusterIDMap,
   llvm::for_each(M->globals(), recordGVSet);
   llvm::for_each(M->aliases(), recordGVSet);
 
+  // When requested, refine the clustering using the call graph: contract the
+  // hottest caller/callee edges first so that call sites end up in the same
+  // partition as their targets, as long as the merged cluster stays below the
+  // average partition weight so the partitions can still be balanced.
+  if (SplitByCallGraph) {
+    uint64_t TotalWeight = 0;
+    for (GlobalValue &GV : M->global_values()) {
+      if (GV.isDeclaration())
+        continue;
+      GVtoClusterMap.insert(&GV);
+      TotalWeight += getNodeWeight(&GV);
+    }
+
+    DenseMap<const GlobalValue *, uint64_t> ClusterWeights;
+    for (ClusterMapType::iterator I = GVtoClusterMap.begin(),
+                                  E = GVtoClusterMap.end();
+         I != E; ++I) {
+      if (!I->isLeader())
+        continue;
+      uint64_t Weight = 0;
+      for (ClusterMapType::member_iterator MI = GVtoClusterMap.member_begin(I);
+           MI != GVtoClusterMap.member_end(); ++MI)
+        Weight += getNodeWeight(*MI);
+      ClusterWeights[GVtoClusterMap.getLeaderValue(I->getData())] = Weight;
+    }
+
+    // Aggregate direct call edges between defined functions. Call site
+    // profile counts (or, failing that, the caller's entry count) make hot
+    // pairs sort first.
+    using EdgeType = std::pair<const Function *, const Function *>;
+    DenseMap<EdgeType, uint64_t> EdgeWeights;
+    for (const Function &F : M->functions()) {
+      if (F.isDeclaration())
+        continue;
+      for (const BasicBlock &BB : F)
+        for (const Instruction &I : BB) {
+          const auto *CB = dyn_cast<CallBase>(&I);
+          if (!CB)
+            continue;
+          const Function *Callee = CB->getCalledFunction();
+          if (!Callee || Callee->isDeclaration() || Callee == &F)
+            continue;
+          uint64_t Count;
+          if (!I.extractProfTotalWeight(Count))
+            Count = F.getEntryCount().hasValue()
+                        ? F.getEntryCount().getCount()
+                        : 1;
+          EdgeWeights[std::make_pair(&F, Callee)] +=
+              std::max<uint64_t>(Count, 1);
+        }
+    }
+
+    SmallVector<std::pair<EdgeType, uint64_t>, 64> Edges(EdgeWeights.begin(),
+                                                         EdgeWeights.end());
+    llvm::sort(Edges, [](const std::pair<EdgeType, uint64_t> &a,
+                         const std::pair<EdgeType, uint64_t> &b) {
+      if (a.second != b.second)
+        return a.second > b.second;
+      if (a.first.first->getName() != b.first.first->getName())
+        return a.first.first->getName() < b.first.first->getName();
+      return a.first.second->getName() < b.first.second->getName();
+    });
+
+    const uint64_t MaxClusterWeight = std::max<uint64_t>(TotalWeight / N, 1);
+    for (const auto &Edge : Edges) {
+      const GlobalValue *CallerLeader =
+          GVtoClusterMap.getLeaderValue(Edge.first.first);
+      const GlobalValue *CalleeLeader =
+          GVtoClusterMap.getLeaderValue(Edge.first.second);
+      if (CallerLeader == CalleeLeader)
+        continue;
+      uint64_t MergedWeight = ClusterWeights.lookup(CallerLeader) +
+                              ClusterWeights.lookup(CalleeLeader);
+      if (MergedWeight > MaxClusterWeight)
+        continue;
+      LLVM_DEBUG(dbgs() << "Contracting call edge ("
+                        << Edge.first.first->getName() << " -> "
+                        << Edge.first.second->getName() << ") weight("
+                        << Edge.second << ")\n");
+      GVtoClusterMap.unionSets(CallerLeader, CalleeLeader);
+      const GlobalValue *NewLeader = GVtoClusterMap.getLeaderValue(CallerLeader);
+      ClusterWeights.erase(NewLeader == CallerLeader ? CalleeLeader
+                                                     : CallerLeader);
+      ClusterWeights[NewLeader] = MergedWeight;
+    }
+  }
+
   // Assigned all GVs to merged clusters while balancing number of objects in
   // each.
-  auto CompareClusters = [](const std::pair<unsigned, unsigned> &a,
-                            const std::pair<unsigned, unsigned> &b) {
+  auto CompareClusters = [](const std::pair<unsigned, uint64_t> &a,
+                            const std::pair<unsigned, uint64_t> &b) {
     if (a.second || b.second)
       return a.second > b.second;
     else
       return a.first > b.first;
   };
 
-  std::priority_queue<std::pair<unsigned, unsigned>,
-                      std::vector<std::pair<unsigned, unsigned>>,
+  std::priority_queue<std::pair<unsigned, uint64_t>,
+                      std::vector<std::pair<unsigned, uint64_t>>,
                       decltype(CompareClusters)>
       BalancinQueue(CompareClusters);
   // Pre-populate priority queue with N slot blanks.
   for (unsigned i = 0; i < N; ++i)
-    BalancinQueue.push(std::make_pair(i, 0));
+    BalancinQueue.push(std::make_pair(i, uint64_t(0)));
 
-  using SortType = std::pair<unsigned, ClusterMapType::iterator>;
+  using SortType = std::pair<uint64_t, ClusterMapType::iterator>;
 
   SmallVector<SortType, 64> Sets;
   SmallPtrSet<const GlobalValue *, 32> Visited;
 
   // To guarantee determinism, we have to sort SCC according to size.
-  // When size is the same, use leader's name.
+  // When size is the same, use leader's name. In call-graph mode clusters
+  // are sized by codegen weight rather than by member count.
   for (ClusterMapType::iterator I = GVtoClusterMap.begin(),
-                                E = GVtoClusterMap.end(); I != E; ++I)
-    if (I->isLeader())
-      Sets.push_back(
-          std::make_pair(std::distance(GVtoClusterMap.member_begin(I),
-                                       GVtoClusterMap.member_end()), I));
+                                E = GVtoClusterMap.end(); I != E; ++I) {
+    if (!I->isLeader())
+      continue;
+    uint64_t Size = 0;
+    for (ClusterMapType::member_iterator MI = GVtoClusterMap.member_begin(I);
+         MI != GVtoClusterMap.member_end(); ++MI)
+      Size += SplitByCallGraph ? getNodeWeight(*MI) : 1;
+    Sets.push_back(std::make_pair(Size, I));
+  }
 
   llvm::sort(Sets, [](const SortType &a, const SortType &b) {
     if (a.first == b.first)
@@ -189,7 +302,7 @@ static void findPartitions(Module *M, ClusterIDMapType &ClusterIDMap,
 
   for (auto &I : Sets) {
     unsigned CurrentClusterID = BalancinQueue.top().first;
-    unsigned CurrentClusterSize = BalancinQueue.top().second;
+    uint64_t CurrentClusterSize = BalancinQueue.top().second;
     BalancinQueue.pop();
 
     LLVM_DEBUG(dbgs() << "Root[" << CurrentClusterID << "] cluster_size("
@@ -205,7 +318,7 @@ static void findPartitions(Module *M, ClusterIDMapType &ClusterIDMap,
                         << ((*MI)->hasLocalLinkage() ? " l " : " e ") << "\n");
       Visited.insert(*MI);
       ClusterIDMap[*MI] = CurrentClusterID;
-      CurrentClusterSize++;
+      CurrentClusterSize += SplitByCallGraph ? getNodeWeight(*MI) : 1;
     }
     // Add this set size to the number of entries in this cluster.
     BalancinQueue.push(std::make_pair(CurrentClusterID, CurrentClusterSize));
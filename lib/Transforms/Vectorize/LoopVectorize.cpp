@@ -1393,6 +1393,13 @@ private:
   /// vectorization factor. The entries are VF-ScalarCostTy pairs.
   DenseMap<unsigned, ScalarCostsTy> InstsToScalarize;
 
+  /// Memoized results of getInstructionCost queries at VF = 1. The scalar
+  /// cost of an instruction never changes, but is re-queried for every
+  /// candidate VF when computing scalarization discounts and forced-scalar
+  /// costs. Per-VF vector costs cannot be cached the same way because
+  /// InstsToScalarize is filled in between queries for the same VF.
+  DenseMap<Instruction *, VectorizationCostTy> ScalarInstCostCache;
+
   /// Holds the instructions known to be uniform after vectorization.
   /// The data is collected per VF.
   DenseMap<unsigned, SmallPtrSet<Instruction *, 4>> Uniforms;
@@ -5890,6 +5897,12 @@ LoopVectorizationCostModel::getInstructionCost(Instruction *I, unsigned VF) {
   if (isUniformAfterVectorization(I, VF))
     VF = 1;
 
+  if (VF == 1) {
+    auto Cached = ScalarInstCostCache.find(I);
+    if (Cached != ScalarInstCostCache.end())
+      return Cached->second;
+  }
+
   if (VF > 1 && isProfitableToScalarize(I, VF))
     return VectorizationCostTy(InstsToScalarize[VF][I], false);
 
@@ -5906,7 +5919,10 @@ LoopVectorizationCostModel::getInstructionCost(Instruction *I, unsigned VF) {
 
   bool TypeNotScalarized =
       VF > 1 && VectorTy->isVectorTy() && TTI.getNumberOfParts(VectorTy) < VF;
-  return VectorizationCostTy(C, TypeNotScalarized);
+  VectorizationCostTy Cost(C, TypeNotScalarized);
+  if (VF == 1)
+    ScalarInstCostCache[I] = Cost;
+  return Cost;
 }
 
 unsigned LoopVectorizationCostModel::getScalarizationOverhead(Instruction *I,
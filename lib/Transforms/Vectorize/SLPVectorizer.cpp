@@ -151,6 +151,11 @@ static cl::opt<bool>
     ViewSLPTree("view-slp-tree", cl::Hidden,
                 cl::desc("Display the SLP trees with Graphviz"));
 
+static cl::opt<unsigned> MaxStoreLookup(
+    "slp-max-store-lookup", cl::init(32), cl::Hidden,
+    cl::desc("Maximum depth of the pairwise consecutive-store search used "
+             "when a store group cannot be indexed by constant offset"));
+
 // Limit the number of alias checks. The limit is chosen so that
 // it has no negative effect on the llvm benchmarks.
 static const unsigned AliasedCheckLimit = 10;
@@ -5411,18 +5416,73 @@ bool SLPVectorizerPass::vectorizeStores(ArrayRef<StoreInst *> Stores,
         return true;
       };
 
-  // Do a quadratic search on all of the given stores in reverse order and find
-  // all of the pairs of stores that follow each other.
   int E = Stores.size();
-  for (int Idx = E - 1; Idx >= 0; --Idx) {
-    // If a store has multiple consecutive store candidates, search according
-    // to the sequence: Idx-1, Idx+1, Idx-2, Idx+2, ...
-    // This is because usually pairing with immediate succeeding or preceding
-    // candidate create the best chance to find slp vectorization opportunity.
-    for (int Offset = 1, F = std::max(E - Idx, Idx + 1); Offset < F; ++Offset)
-      if ((Idx >= Offset && FindConsecutiveAccess(Idx - Offset, Idx)) ||
-          (Idx + Offset < E && FindConsecutiveAccess(Idx + Offset, Idx)))
+
+  // Try to index the stores by constant offset from a common base first.  If
+  // every store in the group resolves, each store's address predecessor can
+  // be found with a hash lookup and chain formation is linear in the number
+  // of stores.
+  bool Indexed = false;
+  {
+    const Value *CommonBase = nullptr;
+    SmallVector<int64_t, 16> Offsets;
+    Offsets.reserve(E);
+    DenseMap<int64_t, SmallVector<int, 2>> IdxByOffset;
+    bool AllResolved = true;
+    for (int Idx = 0; Idx != E; ++Idx) {
+      int64_t Off = 0;
+      const Value *Base = GetPointerBaseWithConstantOffset(
+          Stores[Idx]->getPointerOperand(), Off, *DL);
+      if (!CommonBase)
+        CommonBase = Base;
+      if (Base != CommonBase) {
+        AllResolved = false;
         break;
+      }
+      Offsets.push_back(Off);
+      IdxByOffset[Off].push_back(Idx);
+    }
+
+    if (AllResolved && E > 1) {
+      for (int Idx = E - 1; Idx >= 0; --Idx) {
+        int64_t Size = DL->getTypeStoreSize(
+            Stores[Idx]->getValueOperand()->getType());
+        auto It = IdxByOffset.find(Offsets[Idx] - Size);
+        if (It == IdxByOffset.end())
+          continue;
+        // Prefer the candidate nearest to Idx in program order, below before
+        // above on ties, to match the pairwise search order used in the
+        // fallback.  FindConsecutiveAccess revalidates the pair, so type
+        // mismatches among same-offset candidates are still rejected.
+        SmallVector<int, 2> Candidates(It->second.begin(), It->second.end());
+        llvm::sort(Candidates, [Idx](int A, int B) {
+          int DA = A > Idx ? A - Idx : Idx - A;
+          int DB = B > Idx ? B - Idx : Idx - B;
+          return DA < DB || (DA == DB && A < B);
+        });
+        for (int K : Candidates)
+          if (K != Idx && FindConsecutiveAccess(K, Idx))
+            break;
+      }
+      Indexed = true;
+    }
+  }
+
+  // Otherwise, do a quadratic search on all of the given stores in reverse
+  // order and find all of the pairs of stores that follow each other, capped
+  // at MaxStoreLookup candidates per store.
+  if (!Indexed) {
+    for (int Idx = E - 1; Idx >= 0; --Idx) {
+      // If a store has multiple consecutive store candidates, search according
+      // to the sequence: Idx-1, Idx+1, Idx-2, Idx+2, ...
+      // This is because usually pairing with immediate succeeding or preceding
+      // candidate create the best chance to find slp vectorization opportunity.
+      int F = std::min<int>(std::max(E - Idx, Idx + 1), MaxStoreLookup + 1);
+      for (int Offset = 1; Offset < F; ++Offset)
+        if ((Idx >= Offset && FindConsecutiveAccess(Idx - Offset, Idx)) ||
+            (Idx + Offset < E && FindConsecutiveAccess(Idx + Offset, Idx)))
+          break;
+    }
   }
 
   // For stores that start but don't end a link in the chain:
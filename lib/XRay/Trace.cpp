@@ -14,6 +14,7 @@
 #include "llvm/Support/DataExtractor.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/XRay/BlockIndexer.h"
 #include "llvm/XRay/BlockVerifier.h"
 #include "llvm/XRay/FDRRecordConsumer.h"
@@ -53,6 +54,10 @@ Error loadNaiveFormatLog(StringRef Data, bool IsLittleEndian,
     return FileHeaderOrError.takeError();
   FileHeader = std::move(FileHeaderOrError.get());
 
+  // The file is mapped, so we know exactly how many 32-byte records follow
+  // the header; reserve up front to avoid re-allocating while appending.
+  Records.reserve((Data.size() - 32) / 32);
+
   // Each record after the header will be 32 bytes, in the following format:
   //
   //   (2)   uint16 : record type
@@ -304,45 +309,83 @@ Error loadFDRLog(StringRef Data, bool IsLittleEndian,
       return E;
   }
 
-  // Then we verify the consistency of the blocks.
-  {
-    for (auto &PTB : Index) {
-      auto &Blocks = PTB.second;
-      for (auto &B : Blocks) {
-        BlockVerifier Verifier;
-        for (auto *R : B.Records)
-          if (auto E = R->apply(Verifier))
-            return E;
-        if (auto E = Verifier.verify())
+  // This is now the meat of the algorithm. We verify the consistency of each
+  // process+thread log, then sort its blocks according to the Walltime record
+  // in each of the blocks for the same thread. This allows us to more
+  // consistently recreate the execution trace in temporal order. After the
+  // sort, we then reconstitute `Trace` records using a stateful visitor
+  // associated with a single process+thread pair. Since both the verifier and
+  // the expander only ever see records from a single process+thread log, the
+  // logs are independent of each other and we can process them concurrently,
+  // splicing the per-log results together in a deterministic order afterwards.
+  auto ProcessPTB = [&FileHeader](std::vector<BlockIndexer::Block> &Blocks,
+                                  std::vector<XRayRecord> &Out) -> Error {
+    for (auto &B : Blocks) {
+      BlockVerifier Verifier;
+      for (auto *R : B.Records)
+        if (auto E = R->apply(Verifier))
           return E;
-      }
+      if (auto E = Verifier.verify())
+        return E;
     }
+    llvm::sort(Blocks, [](const BlockIndexer::Block &L,
+                          const BlockIndexer::Block &R) {
+      return (L.WallclockTime->seconds() < R.WallclockTime->seconds() &&
+              L.WallclockTime->nanos() < R.WallclockTime->nanos());
+    });
+    auto Adder = [&](const XRayRecord &R) { Out.push_back(R); };
+    TraceExpander Expander(Adder, FileHeader.Version);
+    for (auto &B : Blocks) {
+      for (auto *R : B.Records)
+        if (auto E = R->apply(Expander))
+          return E;
+    }
+    return Expander.flush();
+  };
+
+  // Impose a stable (process, thread) order on the logs so that the output
+  // does not depend on the iteration order of the index.
+  std::vector<BlockIndexer::Index::value_type *> PTBs;
+  PTBs.reserve(Index.size());
+  for (auto &PTB : Index)
+    PTBs.push_back(&PTB);
+  llvm::sort(PTBs, [](const BlockIndexer::Index::value_type *L,
+                      const BlockIndexer::Index::value_type *R) {
+    return L->first < R->first;
+  });
+
+  if (PTBs.size() < 2) {
+    for (auto *PTB : PTBs)
+      if (auto E = ProcessPTB(PTB->second, Records))
+        return E;
+    return Error::success();
   }
 
-  // This is now the meat of the algorithm. Here we sort the blocks according to
-  // the Walltime record in each of the blocks for the same thread. This allows
-  // us to more consistently recreate the execution trace in temporal order.
-  // After the sort, we then reconstitute `Trace` records using a stateful
-  // visitor associated with a single process+thread pair.
+  std::vector<std::vector<XRayRecord>> PTBRecords(PTBs.size());
+  std::vector<Error> PTBErrors;
+  PTBErrors.reserve(PTBs.size());
+  for (size_t I = 0; I < PTBs.size(); ++I)
+    PTBErrors.push_back(Error::success());
   {
-    for (auto &PTB : Index) {
-      auto &Blocks = PTB.second;
-      llvm::sort(Blocks, [](const BlockIndexer::Block &L,
-                            const BlockIndexer::Block &R) {
-        return (L.WallclockTime->seconds() < R.WallclockTime->seconds() &&
-                L.WallclockTime->nanos() < R.WallclockTime->nanos());
+    ThreadPool Pool;
+    for (size_t I = 0; I < PTBs.size(); ++I)
+      Pool.async([&, I] {
+        PTBErrors[I] = ProcessPTB(PTBs[I]->second, PTBRecords[I]);
       });
-      auto Adder = [&](const XRayRecord &R) { Records.push_back(R); };
-      TraceExpander Expander(Adder, FileHeader.Version);
-      for (auto &B : Blocks) {
-        for (auto *R : B.Records)
-          if (auto E = R->apply(Expander))
-            return E;
-      }
-      if (auto E = Expander.flush())
-        return E;
-    }
+    Pool.wait();
   }
+  Error Err = Error::success();
+  for (auto &E : PTBErrors)
+    Err = joinErrors(std::move(Err), std::move(E));
+  if (Err)
+    return Err;
+
+  size_t Total = Records.size();
+  for (const auto &PTBR : PTBRecords)
+    Total += PTBR.size();
+  Records.reserve(Total);
+  for (auto &PTBR : PTBRecords)
+    Records.insert(Records.end(), PTBR.begin(), PTBR.end());
 
   return Error::success();
 }
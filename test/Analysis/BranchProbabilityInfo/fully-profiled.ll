@@ -0,0 +1,39 @@
+; RUN: opt < %s -analyze -branch-prob | FileCheck %s
+; RUN: opt < %s -passes='print<branch-prob>' -disable-output 2>&1 | FileCheck %s
+
+; Every branch carries complete weight metadata and nothing feeds the
+; unreachable sets, so the fast path that runs only the metadata pass must
+; produce the same probabilities as the full calculation.
+
+define i32 @fully_profiled(i32 %x, i32 %y) {
+; CHECK: Printing analysis {{.*}} for function 'fully_profiled'
+entry:
+  %c = icmp sgt i32 %x, 0
+  br i1 %c, label %then, label %else, !prof !0
+; CHECK: edge entry -> then probability is 0x60000000 / 0x80000000 = 75.00%
+; CHECK: edge entry -> else probability is 0x20000000 / 0x80000000 = 25.00%
+
+then:
+  %t = add i32 %x, %y
+  br label %merge
+
+else:
+  %e = sub i32 %x, %y
+  br label %merge
+
+merge:
+  %r = phi i32 [ %t, %then ], [ %e, %else ]
+  %c2 = icmp slt i32 %r, 100
+  br i1 %c2, label %small, label %big, !prof !1
+; CHECK: edge merge -> small probability is 0x04000000 / 0x80000000 = 3.12%
+; CHECK: edge merge -> big probability is 0x7c000000 / 0x80000000 = 96.88% [HOT edge]
+
+small:
+  ret i32 0
+
+big:
+  ret i32 %r
+}
+
+!0 = !{!"branch_weights", i32 3, i32 1}
+!1 = !{!"branch_weights", i32 1, i32 31}
@@ -0,0 +1,30 @@
+; RUN: opt -passes='print<loop-nest-summary>' -disable-output %s 2>&1 | FileCheck %s
+
+; CHECK: Loop 'loop':
+; CHECK-NEXT:   latch: latch
+; CHECK-NEXT:   dedicated exits: yes
+; CHECK-NEXT:   exiting blocks: latch
+; CHECK-NEXT:   exit blocks: exit
+; CHECK-NEXT:   invariant operands: 3
+; CHECK-NEXT:   memory accesses: 2
+
+define void @f(i32* %a, i32* %b, i32 %n) {
+entry:
+  br label %loop
+
+loop:
+  %iv = phi i32 [ 0, %entry ], [ %iv.next, %latch ]
+  %a.gep = getelementptr inbounds i32, i32* %a, i32 %iv
+  %v = load i32, i32* %a.gep
+  %b.gep = getelementptr inbounds i32, i32* %b, i32 %iv
+  store i32 %v, i32* %b.gep
+  br label %latch
+
+latch:
+  %iv.next = add nuw i32 %iv, 1
+  %cond = icmp slt i32 %iv.next, %n
+  br i1 %cond, label %loop, label %exit
+
+exit:
+  ret void
+}
@@ -0,0 +1,20 @@
+; Tuned abbreviation widths are recorded in the blockinfo block, so a tuned
+; module must round-trip with any reader.
+; RUN: llvm-as -bitcode-tune-abbrevs < %s | llvm-dis | FileCheck %s
+
+; CHECK-LABEL: define i32 @f(i32 %a, i32 %b)
+define i32 @f(i32 %a, i32 %b) {
+; CHECK: %sum = add i32 %a, %b
+  %sum = add i32 %a, %b
+; CHECK: %scaled = mul i32 %sum, 65537
+  %scaled = mul i32 %sum, 65537
+  ret i32 %scaled
+}
+
+; CHECK-LABEL: define i32 @g(i32* %p)
+define i32 @g(i32* %p) {
+; CHECK: %v = load i32, i32* %p
+  %v = load i32, i32* %p
+  %r = add i32 %v, -42
+  ret i32 %r
+}
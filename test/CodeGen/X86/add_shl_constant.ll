@@ -1,4 +1,4 @@
-; RUN: llc -mtriple=x86_64-apple-darwin < %s | FileCheck %s
+; RUN: llc -mtriple=x86_64-apple-darwin -merge-constant-pool-entries=false < %s | FileCheck %s
 
 ; CHECK-LABEL: add_shl_add_constant_1_i32
 ; CHECK: leal 984(%rsi,%rdi,8), %eax
@@ -36,7 +36,7 @@ define <2 x i32> @masked_gather_v2i32(<2 x i32*>* %ptr, <2 x i1> %masks, <2 x i3
 ; NOGATHER-NEXT:  # %bb.2: # %else
 ; NOGATHER-NEXT:    testb $2, %al
 ; NOGATHER-NEXT:    jne .LBB0_3
-; NOGATHER-NEXT:  .LBB0_4: # %else2
+; NOGATHER-NEXT:  .LBB0_4: # %else1
 ; NOGATHER-NEXT:    vmovdqa %xmm1, %xmm0
 ; NOGATHER-NEXT:    retq
 ; NOGATHER-NEXT:  .LBB0_1: # %cond.load
@@ -85,7 +85,7 @@ define <4 x i32> @masked_gather_v2i32_concat(<2 x i32*>* %ptr, <2 x i1> %masks,
 ; NOGATHER-NEXT:  # %bb.2: # %else
 ; NOGATHER-NEXT:    testb $2, %al
 ; NOGATHER-NEXT:    jne .LBB1_3
-; NOGATHER-NEXT:  .LBB1_4: # %else2
+; NOGATHER-NEXT:  .LBB1_4: # %else1
 ; NOGATHER-NEXT:    vmovdqa %xmm1, %xmm0
 ; NOGATHER-NEXT:    retq
 ; NOGATHER-NEXT:  .LBB1_1: # %cond.load
@@ -137,7 +137,7 @@ define <2 x float> @masked_gather_v2float(<2 x float*>* %ptr, <2 x i1> %masks, <
 ; NOGATHER-NEXT:  # %bb.2: # %else
 ; NOGATHER-NEXT:    testb $2, %al
 ; NOGATHER-NEXT:    jne .LBB2_3
-; NOGATHER-NEXT:  .LBB2_4: # %else2
+; NOGATHER-NEXT:  .LBB2_4: # %else1
 ; NOGATHER-NEXT:    vmovaps %xmm1, %xmm0
 ; NOGATHER-NEXT:    retq
 ; NOGATHER-NEXT:  .LBB2_1: # %cond.load
@@ -187,7 +187,7 @@ define <4 x float> @masked_gather_v2float_concat(<2 x float*>* %ptr, <2 x i1> %m
 ; NOGATHER-NEXT:  # %bb.2: # %else
 ; NOGATHER-NEXT:    testb $2, %al
 ; NOGATHER-NEXT:    jne .LBB3_3
-; NOGATHER-NEXT:  .LBB3_4: # %else2
+; NOGATHER-NEXT:  .LBB3_4: # %else1
 ; NOGATHER-NEXT:    vmovaps %xmm1, %xmm0
 ; NOGATHER-NEXT:    retq
 ; NOGATHER-NEXT:  .LBB3_1: # %cond.load
@@ -242,23 +242,23 @@ define <4 x i32> @masked_gather_v4i32(<4 x i32*> %ptrs, <4 x i1> %masks, <4 x i3
 ; NOGATHER-NEXT:  # %bb.3: # %cond.load1
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rcx
 ; NOGATHER-NEXT:    vpinsrd $1, (%rcx), %xmm2, %xmm2
-; NOGATHER-NEXT:  .LBB4_4: # %else2
+; NOGATHER-NEXT:  .LBB4_4: # %else1
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm0, %xmm0
 ; NOGATHER-NEXT:    testb $4, %al
 ; NOGATHER-NEXT:    jne .LBB4_5
-; NOGATHER-NEXT:  # %bb.6: # %else5
+; NOGATHER-NEXT:  # %bb.6: # %else2
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    jne .LBB4_7
-; NOGATHER-NEXT:  .LBB4_8: # %else8
+; NOGATHER-NEXT:  .LBB4_8: # %else3
 ; NOGATHER-NEXT:    vmovdqa %xmm2, %xmm0
 ; NOGATHER-NEXT:    vzeroupper
 ; NOGATHER-NEXT:    retq
-; NOGATHER-NEXT:  .LBB4_5: # %cond.load4
+; NOGATHER-NEXT:  .LBB4_5: # %cond.load2
 ; NOGATHER-NEXT:    vmovq %xmm0, %rcx
 ; NOGATHER-NEXT:    vpinsrd $2, (%rcx), %xmm2, %xmm2
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    je .LBB4_8
-; NOGATHER-NEXT:  .LBB4_7: # %cond.load7
+; NOGATHER-NEXT:  .LBB4_7: # %cond.load3
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rax
 ; NOGATHER-NEXT:    vpinsrd $3, (%rax), %xmm2, %xmm2
 ; NOGATHER-NEXT:    vmovdqa %xmm2, %xmm0
@@ -303,23 +303,23 @@ define <4 x float> @masked_gather_v4float(<4 x float*> %ptrs, <4 x i1> %masks, <
 ; NOGATHER-NEXT:  # %bb.3: # %cond.load1
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rcx
 ; NOGATHER-NEXT:    vinsertps {{.*#+}} xmm2 = xmm2[0],mem[0],xmm2[2,3]
-; NOGATHER-NEXT:  .LBB5_4: # %else2
+; NOGATHER-NEXT:  .LBB5_4: # %else1
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm0, %xmm0
 ; NOGATHER-NEXT:    testb $4, %al
 ; NOGATHER-NEXT:    jne .LBB5_5
-; NOGATHER-NEXT:  # %bb.6: # %else5
+; NOGATHER-NEXT:  # %bb.6: # %else2
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    jne .LBB5_7
-; NOGATHER-NEXT:  .LBB5_8: # %else8
+; NOGATHER-NEXT:  .LBB5_8: # %else3
 ; NOGATHER-NEXT:    vmovaps %xmm2, %xmm0
 ; NOGATHER-NEXT:    vzeroupper
 ; NOGATHER-NEXT:    retq
-; NOGATHER-NEXT:  .LBB5_5: # %cond.load4
+; NOGATHER-NEXT:  .LBB5_5: # %cond.load2
 ; NOGATHER-NEXT:    vmovq %xmm0, %rcx
 ; NOGATHER-NEXT:    vinsertps {{.*#+}} xmm2 = xmm2[0,1],mem[0],xmm2[3]
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    je .LBB5_8
-; NOGATHER-NEXT:  .LBB5_7: # %cond.load7
+; NOGATHER-NEXT:  .LBB5_7: # %cond.load3
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rax
 ; NOGATHER-NEXT:    vinsertps {{.*#+}} xmm2 = xmm2[0,1,2],mem[0]
 ; NOGATHER-NEXT:    vmovaps %xmm2, %xmm0
@@ -377,47 +377,47 @@ define <8 x i32> @masked_gather_v8i32(<8 x i32*>* %ptr, <8 x i1> %masks, <8 x i3
 ; NOGATHER-NEXT:    vpextrq $1, %xmm3, %rcx
 ; NOGATHER-NEXT:    vpinsrd $1, (%rcx), %xmm1, %xmm0
 ; NOGATHER-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
-; NOGATHER-NEXT:  .LBB6_4: # %else2
+; NOGATHER-NEXT:  .LBB6_4: # %else1
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm3, %xmm0
 ; NOGATHER-NEXT:    testb $4, %al
 ; NOGATHER-NEXT:    jne .LBB6_5
-; NOGATHER-NEXT:  # %bb.6: # %else5
+; NOGATHER-NEXT:  # %bb.6: # %else2
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    jne .LBB6_7
-; NOGATHER-NEXT:  .LBB6_8: # %else8
+; NOGATHER-NEXT:  .LBB6_8: # %else3
 ; NOGATHER-NEXT:    testb $16, %al
 ; NOGATHER-NEXT:    jne .LBB6_9
-; NOGATHER-NEXT:  .LBB6_10: # %else11
+; NOGATHER-NEXT:  .LBB6_10: # %else4
 ; NOGATHER-NEXT:    testb $32, %al
 ; NOGATHER-NEXT:    je .LBB6_12
-; NOGATHER-NEXT:  .LBB6_11: # %cond.load13
+; NOGATHER-NEXT:  .LBB6_11: # %cond.load5
 ; NOGATHER-NEXT:    vpextrq $1, %xmm2, %rcx
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; NOGATHER-NEXT:    vpinsrd $1, (%rcx), %xmm0, %xmm0
 ; NOGATHER-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
-; NOGATHER-NEXT:  .LBB6_12: # %else14
+; NOGATHER-NEXT:  .LBB6_12: # %else5
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm2, %xmm0
 ; NOGATHER-NEXT:    testb $64, %al
 ; NOGATHER-NEXT:    jne .LBB6_13
-; NOGATHER-NEXT:  # %bb.14: # %else17
+; NOGATHER-NEXT:  # %bb.14: # %else6
 ; NOGATHER-NEXT:    testb $-128, %al
 ; NOGATHER-NEXT:    jne .LBB6_15
-; NOGATHER-NEXT:  .LBB6_16: # %else20
+; NOGATHER-NEXT:  .LBB6_16: # %else7
 ; NOGATHER-NEXT:    vmovaps %ymm1, %ymm0
 ; NOGATHER-NEXT:    retq
-; NOGATHER-NEXT:  .LBB6_5: # %cond.load4
+; NOGATHER-NEXT:  .LBB6_5: # %cond.load2
 ; NOGATHER-NEXT:    vmovq %xmm0, %rcx
 ; NOGATHER-NEXT:    vpinsrd $2, (%rcx), %xmm1, %xmm3
 ; NOGATHER-NEXT:    vblendps {{.*#+}} ymm1 = ymm3[0,1,2,3],ymm1[4,5,6,7]
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    je .LBB6_8
-; NOGATHER-NEXT:  .LBB6_7: # %cond.load7
+; NOGATHER-NEXT:  .LBB6_7: # %cond.load3
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rcx
 ; NOGATHER-NEXT:    vpinsrd $3, (%rcx), %xmm1, %xmm0
 ; NOGATHER-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; NOGATHER-NEXT:    testb $16, %al
 ; NOGATHER-NEXT:    je .LBB6_10
-; NOGATHER-NEXT:  .LBB6_9: # %cond.load10
+; NOGATHER-NEXT:  .LBB6_9: # %cond.load4
 ; NOGATHER-NEXT:    vmovq %xmm2, %rcx
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; NOGATHER-NEXT:    vpinsrd $0, (%rcx), %xmm0, %xmm0
@@ -425,14 +425,14 @@ define <8 x i32> @masked_gather_v8i32(<8 x i32*>* %ptr, <8 x i1> %masks, <8 x i3
 ; NOGATHER-NEXT:    testb $32, %al
 ; NOGATHER-NEXT:    jne .LBB6_11
 ; NOGATHER-NEXT:    jmp .LBB6_12
-; NOGATHER-NEXT:  .LBB6_13: # %cond.load16
+; NOGATHER-NEXT:  .LBB6_13: # %cond.load6
 ; NOGATHER-NEXT:    vmovq %xmm0, %rcx
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm2
 ; NOGATHER-NEXT:    vpinsrd $2, (%rcx), %xmm2, %xmm2
 ; NOGATHER-NEXT:    vinsertf128 $1, %xmm2, %ymm1, %ymm1
 ; NOGATHER-NEXT:    testb $-128, %al
 ; NOGATHER-NEXT:    je .LBB6_16
-; NOGATHER-NEXT:  .LBB6_15: # %cond.load19
+; NOGATHER-NEXT:  .LBB6_15: # %cond.load7
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rax
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; NOGATHER-NEXT:    vpinsrd $3, (%rax), %xmm0, %xmm0
@@ -492,47 +492,47 @@ define <8 x float> @masked_gather_v8float(<8 x float*>* %ptr, <8 x i1> %masks, <
 ; NOGATHER-NEXT:    vpextrq $1, %xmm3, %rcx
 ; NOGATHER-NEXT:    vinsertps {{.*#+}} xmm0 = xmm1[0],mem[0],xmm1[2,3]
 ; NOGATHER-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
-; NOGATHER-NEXT:  .LBB7_4: # %else2
+; NOGATHER-NEXT:  .LBB7_4: # %else1
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm3, %xmm0
 ; NOGATHER-NEXT:    testb $4, %al
 ; NOGATHER-NEXT:    jne .LBB7_5
-; NOGATHER-NEXT:  # %bb.6: # %else5
+; NOGATHER-NEXT:  # %bb.6: # %else2
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    jne .LBB7_7
-; NOGATHER-NEXT:  .LBB7_8: # %else8
+; NOGATHER-NEXT:  .LBB7_8: # %else3
 ; NOGATHER-NEXT:    testb $16, %al
 ; NOGATHER-NEXT:    jne .LBB7_9
-; NOGATHER-NEXT:  .LBB7_10: # %else11
+; NOGATHER-NEXT:  .LBB7_10: # %else4
 ; NOGATHER-NEXT:    testb $32, %al
 ; NOGATHER-NEXT:    je .LBB7_12
-; NOGATHER-NEXT:  .LBB7_11: # %cond.load13
+; NOGATHER-NEXT:  .LBB7_11: # %cond.load5
 ; NOGATHER-NEXT:    vpextrq $1, %xmm2, %rcx
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; NOGATHER-NEXT:    vinsertps {{.*#+}} xmm0 = xmm0[0],mem[0],xmm0[2,3]
 ; NOGATHER-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
-; NOGATHER-NEXT:  .LBB7_12: # %else14
+; NOGATHER-NEXT:  .LBB7_12: # %else5
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm2, %xmm0
 ; NOGATHER-NEXT:    testb $64, %al
 ; NOGATHER-NEXT:    jne .LBB7_13
-; NOGATHER-NEXT:  # %bb.14: # %else17
+; NOGATHER-NEXT:  # %bb.14: # %else6
 ; NOGATHER-NEXT:    testb $-128, %al
 ; NOGATHER-NEXT:    jne .LBB7_15
-; NOGATHER-NEXT:  .LBB7_16: # %else20
+; NOGATHER-NEXT:  .LBB7_16: # %else7
 ; NOGATHER-NEXT:    vmovaps %ymm1, %ymm0
 ; NOGATHER-NEXT:    retq
-; NOGATHER-NEXT:  .LBB7_5: # %cond.load4
+; NOGATHER-NEXT:  .LBB7_5: # %cond.load2
 ; NOGATHER-NEXT:    vmovq %xmm0, %rcx
 ; NOGATHER-NEXT:    vinsertps {{.*#+}} xmm3 = xmm1[0,1],mem[0],xmm1[3]
 ; NOGATHER-NEXT:    vblendps {{.*#+}} ymm1 = ymm3[0,1,2,3],ymm1[4,5,6,7]
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    je .LBB7_8
-; NOGATHER-NEXT:  .LBB7_7: # %cond.load7
+; NOGATHER-NEXT:  .LBB7_7: # %cond.load3
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rcx
 ; NOGATHER-NEXT:    vinsertps {{.*#+}} xmm0 = xmm1[0,1,2],mem[0]
 ; NOGATHER-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; NOGATHER-NEXT:    testb $16, %al
 ; NOGATHER-NEXT:    je .LBB7_10
-; NOGATHER-NEXT:  .LBB7_9: # %cond.load10
+; NOGATHER-NEXT:  .LBB7_9: # %cond.load4
 ; NOGATHER-NEXT:    vmovq %xmm2, %rcx
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; NOGATHER-NEXT:    vmovd {{.*#+}} xmm3 = mem[0],zero,zero,zero
@@ -541,14 +541,14 @@ define <8 x float> @masked_gather_v8float(<8 x float*>* %ptr, <8 x i1> %masks, <
 ; NOGATHER-NEXT:    testb $32, %al
 ; NOGATHER-NEXT:    jne .LBB7_11
 ; NOGATHER-NEXT:    jmp .LBB7_12
-; NOGATHER-NEXT:  .LBB7_13: # %cond.load16
+; NOGATHER-NEXT:  .LBB7_13: # %cond.load6
 ; NOGATHER-NEXT:    vmovq %xmm0, %rcx
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm2
 ; NOGATHER-NEXT:    vinsertps {{.*#+}} xmm2 = xmm2[0,1],mem[0],xmm2[3]
 ; NOGATHER-NEXT:    vinsertf128 $1, %xmm2, %ymm1, %ymm1
 ; NOGATHER-NEXT:    testb $-128, %al
 ; NOGATHER-NEXT:    je .LBB7_16
-; NOGATHER-NEXT:  .LBB7_15: # %cond.load19
+; NOGATHER-NEXT:  .LBB7_15: # %cond.load7
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rax
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; NOGATHER-NEXT:    vinsertps {{.*#+}} xmm0 = xmm0[0,1,2],mem[0]
@@ -601,24 +601,24 @@ define <4 x i64> @masked_gather_v4i64(<4 x i64*>* %ptr, <4 x i1> %masks, <4 x i6
 ; NOGATHER-NEXT:    vpextrq $1, %xmm2, %rcx
 ; NOGATHER-NEXT:    vpinsrq $1, (%rcx), %xmm1, %xmm0
 ; NOGATHER-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
-; NOGATHER-NEXT:  .LBB8_4: # %else2
+; NOGATHER-NEXT:  .LBB8_4: # %else1
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm2, %xmm0
 ; NOGATHER-NEXT:    testb $4, %al
 ; NOGATHER-NEXT:    jne .LBB8_5
-; NOGATHER-NEXT:  # %bb.6: # %else5
+; NOGATHER-NEXT:  # %bb.6: # %else2
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    jne .LBB8_7
-; NOGATHER-NEXT:  .LBB8_8: # %else8
+; NOGATHER-NEXT:  .LBB8_8: # %else3
 ; NOGATHER-NEXT:    vmovaps %ymm1, %ymm0
 ; NOGATHER-NEXT:    retq
-; NOGATHER-NEXT:  .LBB8_5: # %cond.load4
+; NOGATHER-NEXT:  .LBB8_5: # %cond.load2
 ; NOGATHER-NEXT:    vmovq %xmm0, %rcx
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm2
 ; NOGATHER-NEXT:    vpinsrq $0, (%rcx), %xmm2, %xmm2
 ; NOGATHER-NEXT:    vinsertf128 $1, %xmm2, %ymm1, %ymm1
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    je .LBB8_8
-; NOGATHER-NEXT:  .LBB8_7: # %cond.load7
+; NOGATHER-NEXT:  .LBB8_7: # %cond.load3
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rax
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; NOGATHER-NEXT:    vpinsrq $1, (%rax), %xmm0, %xmm0
@@ -671,24 +671,24 @@ define <4 x double> @masked_gather_v4double(<4 x double*>* %ptr, <4 x i1> %masks
 ; NOGATHER-NEXT:    vpextrq $1, %xmm2, %rcx
 ; NOGATHER-NEXT:    vmovhps {{.*#+}} xmm0 = xmm1[0,1],mem[0,1]
 ; NOGATHER-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
-; NOGATHER-NEXT:  .LBB9_4: # %else2
+; NOGATHER-NEXT:  .LBB9_4: # %else1
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm2, %xmm0
 ; NOGATHER-NEXT:    testb $4, %al
 ; NOGATHER-NEXT:    jne .LBB9_5
-; NOGATHER-NEXT:  # %bb.6: # %else5
+; NOGATHER-NEXT:  # %bb.6: # %else2
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    jne .LBB9_7
-; NOGATHER-NEXT:  .LBB9_8: # %else8
+; NOGATHER-NEXT:  .LBB9_8: # %else3
 ; NOGATHER-NEXT:    vmovaps %ymm1, %ymm0
 ; NOGATHER-NEXT:    retq
-; NOGATHER-NEXT:  .LBB9_5: # %cond.load4
+; NOGATHER-NEXT:  .LBB9_5: # %cond.load2
 ; NOGATHER-NEXT:    vmovq %xmm0, %rcx
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm2
 ; NOGATHER-NEXT:    vmovlps {{.*#+}} xmm2 = mem[0,1],xmm2[2,3]
 ; NOGATHER-NEXT:    vinsertf128 $1, %xmm2, %ymm1, %ymm1
 ; NOGATHER-NEXT:    testb $8, %al
 ; NOGATHER-NEXT:    je .LBB9_8
-; NOGATHER-NEXT:  .LBB9_7: # %cond.load7
+; NOGATHER-NEXT:  .LBB9_7: # %cond.load3
 ; NOGATHER-NEXT:    vpextrq $1, %xmm0, %rax
 ; NOGATHER-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; NOGATHER-NEXT:    vmovhps {{.*#+}} xmm0 = xmm0[0,1],mem[0,1]
@@ -731,7 +731,7 @@ define <2 x i64> @masked_gather_v2i64(<2 x i64*>* %ptr, <2 x i1> %masks, <2 x i6
 ; NOGATHER-NEXT:  # %bb.2: # %else
 ; NOGATHER-NEXT:    testb $2, %al
 ; NOGATHER-NEXT:    jne .LBB10_3
-; NOGATHER-NEXT:  .LBB10_4: # %else2
+; NOGATHER-NEXT:  .LBB10_4: # %else1
 ; NOGATHER-NEXT:    vmovdqa %xmm1, %xmm0
 ; NOGATHER-NEXT:    retq
 ; NOGATHER-NEXT:  .LBB10_1: # %cond.load
@@ -780,7 +780,7 @@ define <2 x double> @masked_gather_v2double(<2 x double*>* %ptr, <2 x i1> %masks
 ; NOGATHER-NEXT:  # %bb.2: # %else
 ; NOGATHER-NEXT:    testb $2, %al
 ; NOGATHER-NEXT:    jne .LBB11_3
-; NOGATHER-NEXT:  .LBB11_4: # %else2
+; NOGATHER-NEXT:  .LBB11_4: # %else1
 ; NOGATHER-NEXT:    vmovaps %xmm1, %xmm0
 ; NOGATHER-NEXT:    retq
 ; NOGATHER-NEXT:  .LBB11_1: # %cond.load
@@ -0,0 +1,55 @@
+; RUN: llc < %s -mtriple=x86_64-unknown-linux-gnu | FileCheck %s
+; RUN: llc < %s -mtriple=x86_64-unknown-linux-gnu -merge-constant-pool-entries=false | FileCheck %s --check-prefix=NOMERGE
+
+; The asm printer emits each distinct constant pool entry only once per
+; section and defines later copies as assignments to the first emission.
+; Entries in other sections and entries with different values still get
+; their own definitions.
+
+; @pi_a emits the entry; @pi_b reuses it via an assignment.
+; CHECK:        .LCPI0_0:
+; CHECK-NEXT:   .quad 4614256656552045848
+; CHECK-NOT:    .LCPI1_0:
+; CHECK:        .set .LCPI1_0, .LCPI0_0
+
+; A different value in the same section gets its own definition.
+; CHECK:        .LCPI2_0:
+; CHECK-NEXT:   .quad 4613303445314885481
+
+; A float lands in .rodata.cst4, not the .rodata.cst8 entries above; the
+; first copy is defined there and the second copy aliases it.
+; CHECK:        .section .rodata.cst4
+; CHECK:        .LCPI3_0:
+; CHECK-NEXT:   .long 1075838976
+; CHECK:        .set .LCPI4_0, .LCPI3_0
+
+; With merging disabled every function defines its own entry.
+; NOMERGE:      .LCPI0_0:
+; NOMERGE-NEXT: .quad 4614256656552045848
+; NOMERGE:      .LCPI1_0:
+; NOMERGE-NEXT: .quad 4614256656552045848
+; NOMERGE:      .LCPI3_0:
+; NOMERGE-NEXT: .long 1075838976
+; NOMERGE:      .LCPI4_0:
+; NOMERGE-NEXT: .long 1075838976
+; NOMERGE-NOT:  .set
+
+define double @pi_a() {
+  ret double 0x400921FB54442D18
+}
+
+define double @pi_b() {
+  ret double 0x400921FB54442D18
+}
+
+define double @e_c() {
+  ret double 0x4005BF0A8B145769
+}
+
+define float @f_a() {
+  ret float 2.5
+}
+
+define float @f_b() {
+  ret float 2.5
+}
@@ -1,4 +1,4 @@
-; RUN: llc -mtriple=x86_64-apple-macosx10.10.0 < %s | FileCheck %s
+; RUN: llc -mtriple=x86_64-apple-macosx10.10.0 -merge-constant-pool-entries=false < %s | FileCheck %s
 
 target datalayout = "e-m:o-i64:64-f80:128-n8:16:32:64-S128"
 
@@ -28,10 +28,10 @@ define  <3 x i32> @masked_load_v3(i32 addrspace(1)*, <3 x i1>) {
 ; CHECK-NEXT:  # %bb.2: # %else
 ; CHECK-NEXT:    testb $2, %cl
 ; CHECK-NEXT:    jne .LBB0_3
-; CHECK-NEXT:  .LBB0_4: # %else2
+; CHECK-NEXT:  .LBB0_4: # %else1
 ; CHECK-NEXT:    testb $4, %cl
 ; CHECK-NEXT:    jne .LBB0_5
-; CHECK-NEXT:  .LBB0_6: # %else5
+; CHECK-NEXT:  .LBB0_6: # %else2
 ; CHECK-NEXT:    retq
 ; CHECK-NEXT:  .LBB0_1: # %cond.load
 ; CHECK-NEXT:    movd {{.*#+}} xmm0 = mem[0],zero,zero,zero
@@ -41,7 +41,7 @@ define  <3 x i32> @masked_load_v3(i32 addrspace(1)*, <3 x i1>) {
 ; CHECK-NEXT:    pinsrd $1, 4(%rdi), %xmm0
 ; CHECK-NEXT:    testb $4, %cl
 ; CHECK-NEXT:    je .LBB0_6
-; CHECK-NEXT:  .LBB0_5: # %cond.load4
+; CHECK-NEXT:  .LBB0_5: # %cond.load2
 ; CHECK-NEXT:    pinsrd $2, 8(%rdi), %xmm0
 ; CHECK-NEXT:    retq
 entry:
@@ -65,10 +65,10 @@ define void @masked_store4_v3(<3 x i32>, i32 addrspace(1)*, <3 x i1>) {
 ; CHECK-NEXT:  # %bb.2: # %else
 ; CHECK-NEXT:    testb $2, %cl
 ; CHECK-NEXT:    jne .LBB1_3
-; CHECK-NEXT:  .LBB1_4: # %else2
+; CHECK-NEXT:  .LBB1_4: # %else1
 ; CHECK-NEXT:    testb $4, %cl
 ; CHECK-NEXT:    jne .LBB1_5
-; CHECK-NEXT:  .LBB1_6: # %else4
+; CHECK-NEXT:  .LBB1_6: # %else2
 ; CHECK-NEXT:    retq
 ; CHECK-NEXT:  .LBB1_1: # %cond.store
 ; CHECK-NEXT:    movss %xmm0, (%rdi)
@@ -78,7 +78,7 @@ define void @masked_store4_v3(<3 x i32>, i32 addrspace(1)*, <3 x i1>) {
 ; CHECK-NEXT:    extractps $1, %xmm0, 4(%rdi)
 ; CHECK-NEXT:    testb $4, %cl
 ; CHECK-NEXT:    je .LBB1_6
-; CHECK-NEXT:  .LBB1_5: # %cond.store3
+; CHECK-NEXT:  .LBB1_5: # %cond.store2
 ; CHECK-NEXT:    extractps $2, %xmm0, 8(%rdi)
 ; CHECK-NEXT:    retq
 entry:
@@ -22,25 +22,25 @@ define void @compressstore_v8f64_v8i1(double* %base, <8 x double> %V, <8 x i1> %
 ; SSE-NEXT:  ## %bb.2: ## %else
 ; SSE-NEXT:    testb $2, %al
 ; SSE-NEXT:    jne LBB0_3
-; SSE-NEXT:  LBB0_4: ## %else2
+; SSE-NEXT:  LBB0_4: ## %else1
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    jne LBB0_5
-; SSE-NEXT:  LBB0_6: ## %else5
+; SSE-NEXT:  LBB0_6: ## %else2
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    jne LBB0_7
-; SSE-NEXT:  LBB0_8: ## %else8
+; SSE-NEXT:  LBB0_8: ## %else3
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    jne LBB0_9
-; SSE-NEXT:  LBB0_10: ## %else11
+; SSE-NEXT:  LBB0_10: ## %else4
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    jne LBB0_11
-; SSE-NEXT:  LBB0_12: ## %else14
+; SSE-NEXT:  LBB0_12: ## %else5
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    jne LBB0_13
-; SSE-NEXT:  LBB0_14: ## %else17
+; SSE-NEXT:  LBB0_14: ## %else6
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    jne LBB0_15
-; SSE-NEXT:  LBB0_16: ## %else20
+; SSE-NEXT:  LBB0_16: ## %else7
 ; SSE-NEXT:    retq
 ; SSE-NEXT:  LBB0_1: ## %cond.store
 ; SSE-NEXT:    movq %xmm0, (%rdi)
@@ -52,32 +52,32 @@ define void @compressstore_v8f64_v8i1(double* %base, <8 x double> %V, <8 x i1> %
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    je LBB0_6
-; SSE-NEXT:  LBB0_5: ## %cond.store4
+; SSE-NEXT:  LBB0_5: ## %cond.store2
 ; SSE-NEXT:    movlps %xmm1, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    je LBB0_8
-; SSE-NEXT:  LBB0_7: ## %cond.store7
+; SSE-NEXT:  LBB0_7: ## %cond.store3
 ; SSE-NEXT:    movhps %xmm1, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    je LBB0_10
-; SSE-NEXT:  LBB0_9: ## %cond.store10
+; SSE-NEXT:  LBB0_9: ## %cond.store4
 ; SSE-NEXT:    movlps %xmm2, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    je LBB0_12
-; SSE-NEXT:  LBB0_11: ## %cond.store13
+; SSE-NEXT:  LBB0_11: ## %cond.store5
 ; SSE-NEXT:    movhps %xmm2, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    je LBB0_14
-; SSE-NEXT:  LBB0_13: ## %cond.store16
+; SSE-NEXT:  LBB0_13: ## %cond.store6
 ; SSE-NEXT:    movlps %xmm3, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    je LBB0_16
-; SSE-NEXT:  LBB0_15: ## %cond.store19
+; SSE-NEXT:  LBB0_15: ## %cond.store7
 ; SSE-NEXT:    movhps %xmm3, (%rdi)
 ; SSE-NEXT:    retq
 ;
@@ -97,54 +97,54 @@ define void @compressstore_v8f64_v8i1(double* %base, <8 x double> %V, <8 x i1> %
 ; AVX1-NEXT:  ## %bb.3: ## %cond.store1
 ; AVX1-NEXT:    vmovhpd %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
-; AVX1-NEXT:  LBB0_4: ## %else2
+; AVX1-NEXT:  LBB0_4: ## %else1
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    vextractf128 $1, %ymm0, %xmm0
 ; AVX1-NEXT:    jne LBB0_5
-; AVX1-NEXT:  ## %bb.6: ## %else5
+; AVX1-NEXT:  ## %bb.6: ## %else2
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    jne LBB0_7
-; AVX1-NEXT:  LBB0_8: ## %else8
+; AVX1-NEXT:  LBB0_8: ## %else3
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    jne LBB0_9
-; AVX1-NEXT:  LBB0_10: ## %else11
+; AVX1-NEXT:  LBB0_10: ## %else4
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    je LBB0_12
-; AVX1-NEXT:  LBB0_11: ## %cond.store13
+; AVX1-NEXT:  LBB0_11: ## %cond.store5
 ; AVX1-NEXT:    vmovhps %xmm1, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
-; AVX1-NEXT:  LBB0_12: ## %else14
+; AVX1-NEXT:  LBB0_12: ## %else5
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    jne LBB0_13
-; AVX1-NEXT:  ## %bb.14: ## %else17
+; AVX1-NEXT:  ## %bb.14: ## %else6
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    jne LBB0_15
-; AVX1-NEXT:  LBB0_16: ## %else20
+; AVX1-NEXT:  LBB0_16: ## %else7
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
-; AVX1-NEXT:  LBB0_5: ## %cond.store4
+; AVX1-NEXT:  LBB0_5: ## %cond.store2
 ; AVX1-NEXT:    vmovlps %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    je LBB0_8
-; AVX1-NEXT:  LBB0_7: ## %cond.store7
+; AVX1-NEXT:  LBB0_7: ## %cond.store3
 ; AVX1-NEXT:    vmovhps %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    je LBB0_10
-; AVX1-NEXT:  LBB0_9: ## %cond.store10
+; AVX1-NEXT:  LBB0_9: ## %cond.store4
 ; AVX1-NEXT:    vmovlps %xmm1, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    jne LBB0_11
 ; AVX1-NEXT:    jmp LBB0_12
-; AVX1-NEXT:  LBB0_13: ## %cond.store16
+; AVX1-NEXT:  LBB0_13: ## %cond.store6
 ; AVX1-NEXT:    vmovlps %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    je LBB0_16
-; AVX1-NEXT:  LBB0_15: ## %cond.store19
+; AVX1-NEXT:  LBB0_15: ## %cond.store7
 ; AVX1-NEXT:    vmovhps %xmm0, (%rdi)
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
@@ -165,54 +165,54 @@ define void @compressstore_v8f64_v8i1(double* %base, <8 x double> %V, <8 x i1> %
 ; AVX2-NEXT:  ## %bb.3: ## %cond.store1
 ; AVX2-NEXT:    vmovhpd %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
-; AVX2-NEXT:  LBB0_4: ## %else2
+; AVX2-NEXT:  LBB0_4: ## %else1
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    vextracti128 $1, %ymm0, %xmm0
 ; AVX2-NEXT:    jne LBB0_5
-; AVX2-NEXT:  ## %bb.6: ## %else5
+; AVX2-NEXT:  ## %bb.6: ## %else2
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    jne LBB0_7
-; AVX2-NEXT:  LBB0_8: ## %else8
+; AVX2-NEXT:  LBB0_8: ## %else3
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    jne LBB0_9
-; AVX2-NEXT:  LBB0_10: ## %else11
+; AVX2-NEXT:  LBB0_10: ## %else4
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    je LBB0_12
-; AVX2-NEXT:  LBB0_11: ## %cond.store13
+; AVX2-NEXT:  LBB0_11: ## %cond.store5
 ; AVX2-NEXT:    vmovhps %xmm1, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
-; AVX2-NEXT:  LBB0_12: ## %else14
+; AVX2-NEXT:  LBB0_12: ## %else5
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    jne LBB0_13
-; AVX2-NEXT:  ## %bb.14: ## %else17
+; AVX2-NEXT:  ## %bb.14: ## %else6
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    jne LBB0_15
-; AVX2-NEXT:  LBB0_16: ## %else20
+; AVX2-NEXT:  LBB0_16: ## %else7
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
-; AVX2-NEXT:  LBB0_5: ## %cond.store4
+; AVX2-NEXT:  LBB0_5: ## %cond.store2
 ; AVX2-NEXT:    vmovq %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    je LBB0_8
-; AVX2-NEXT:  LBB0_7: ## %cond.store7
+; AVX2-NEXT:  LBB0_7: ## %cond.store3
 ; AVX2-NEXT:    vmovhpd %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    je LBB0_10
-; AVX2-NEXT:  LBB0_9: ## %cond.store10
+; AVX2-NEXT:  LBB0_9: ## %cond.store4
 ; AVX2-NEXT:    vmovlps %xmm1, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    jne LBB0_11
 ; AVX2-NEXT:    jmp LBB0_12
-; AVX2-NEXT:  LBB0_13: ## %cond.store16
+; AVX2-NEXT:  LBB0_13: ## %cond.store6
 ; AVX2-NEXT:    vmovlps %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    je LBB0_16
-; AVX2-NEXT:  LBB0_15: ## %cond.store19
+; AVX2-NEXT:  LBB0_15: ## %cond.store7
 ; AVX2-NEXT:    vmovhps %xmm0, (%rdi)
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
@@ -257,49 +257,49 @@ define void @compressstore_v16f64_v16i1(double* %base, <16 x double> %V, <16 x i
 ; SSE-NEXT:  ## %bb.2: ## %else
 ; SSE-NEXT:    testb $2, %al
 ; SSE-NEXT:    jne LBB1_3
-; SSE-NEXT:  LBB1_4: ## %else2
+; SSE-NEXT:  LBB1_4: ## %else1
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    jne LBB1_5
-; SSE-NEXT:  LBB1_6: ## %else5
+; SSE-NEXT:  LBB1_6: ## %else2
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    jne LBB1_7
-; SSE-NEXT:  LBB1_8: ## %else8
+; SSE-NEXT:  LBB1_8: ## %else3
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    jne LBB1_9
-; SSE-NEXT:  LBB1_10: ## %else11
+; SSE-NEXT:  LBB1_10: ## %else4
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    jne LBB1_11
-; SSE-NEXT:  LBB1_12: ## %else14
+; SSE-NEXT:  LBB1_12: ## %else5
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    jne LBB1_13
-; SSE-NEXT:  LBB1_14: ## %else17
+; SSE-NEXT:  LBB1_14: ## %else6
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    jne LBB1_15
-; SSE-NEXT:  LBB1_16: ## %else20
+; SSE-NEXT:  LBB1_16: ## %else7
 ; SSE-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE-NEXT:    jne LBB1_17
-; SSE-NEXT:  LBB1_18: ## %else23
+; SSE-NEXT:  LBB1_18: ## %else8
 ; SSE-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE-NEXT:    jne LBB1_19
-; SSE-NEXT:  LBB1_20: ## %else26
+; SSE-NEXT:  LBB1_20: ## %else9
 ; SSE-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE-NEXT:    jne LBB1_21
-; SSE-NEXT:  LBB1_22: ## %else29
+; SSE-NEXT:  LBB1_22: ## %else10
 ; SSE-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE-NEXT:    jne LBB1_23
-; SSE-NEXT:  LBB1_24: ## %else32
+; SSE-NEXT:  LBB1_24: ## %else11
 ; SSE-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE-NEXT:    jne LBB1_25
-; SSE-NEXT:  LBB1_26: ## %else35
+; SSE-NEXT:  LBB1_26: ## %else12
 ; SSE-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE-NEXT:    jne LBB1_27
-; SSE-NEXT:  LBB1_28: ## %else38
+; SSE-NEXT:  LBB1_28: ## %else13
 ; SSE-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE-NEXT:    jne LBB1_29
-; SSE-NEXT:  LBB1_30: ## %else41
+; SSE-NEXT:  LBB1_30: ## %else14
 ; SSE-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE-NEXT:    jne LBB1_31
-; SSE-NEXT:  LBB1_32: ## %else44
+; SSE-NEXT:  LBB1_32: ## %else15
 ; SSE-NEXT:    retq
 ; SSE-NEXT:  LBB1_1: ## %cond.store
 ; SSE-NEXT:    movlps %xmm0, (%rdi)
@@ -311,72 +311,72 @@ define void @compressstore_v16f64_v16i1(double* %base, <16 x double> %V, <16 x i
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    je LBB1_6
-; SSE-NEXT:  LBB1_5: ## %cond.store4
+; SSE-NEXT:  LBB1_5: ## %cond.store2
 ; SSE-NEXT:    movlps %xmm1, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    je LBB1_8
-; SSE-NEXT:  LBB1_7: ## %cond.store7
+; SSE-NEXT:  LBB1_7: ## %cond.store3
 ; SSE-NEXT:    movhps %xmm1, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    je LBB1_10
-; SSE-NEXT:  LBB1_9: ## %cond.store10
+; SSE-NEXT:  LBB1_9: ## %cond.store4
 ; SSE-NEXT:    movlps %xmm2, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    je LBB1_12
-; SSE-NEXT:  LBB1_11: ## %cond.store13
+; SSE-NEXT:  LBB1_11: ## %cond.store5
 ; SSE-NEXT:    movhps %xmm2, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    je LBB1_14
-; SSE-NEXT:  LBB1_13: ## %cond.store16
+; SSE-NEXT:  LBB1_13: ## %cond.store6
 ; SSE-NEXT:    movlps %xmm3, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    je LBB1_16
-; SSE-NEXT:  LBB1_15: ## %cond.store19
+; SSE-NEXT:  LBB1_15: ## %cond.store7
 ; SSE-NEXT:    movhps %xmm3, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE-NEXT:    je LBB1_18
-; SSE-NEXT:  LBB1_17: ## %cond.store22
+; SSE-NEXT:  LBB1_17: ## %cond.store8
 ; SSE-NEXT:    movlps %xmm4, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE-NEXT:    je LBB1_20
-; SSE-NEXT:  LBB1_19: ## %cond.store25
+; SSE-NEXT:  LBB1_19: ## %cond.store9
 ; SSE-NEXT:    movhps %xmm4, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE-NEXT:    je LBB1_22
-; SSE-NEXT:  LBB1_21: ## %cond.store28
+; SSE-NEXT:  LBB1_21: ## %cond.store10
 ; SSE-NEXT:    movlps %xmm5, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE-NEXT:    je LBB1_24
-; SSE-NEXT:  LBB1_23: ## %cond.store31
+; SSE-NEXT:  LBB1_23: ## %cond.store11
 ; SSE-NEXT:    movhps %xmm5, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE-NEXT:    je LBB1_26
-; SSE-NEXT:  LBB1_25: ## %cond.store34
+; SSE-NEXT:  LBB1_25: ## %cond.store12
 ; SSE-NEXT:    movlps %xmm6, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE-NEXT:    je LBB1_28
-; SSE-NEXT:  LBB1_27: ## %cond.store37
+; SSE-NEXT:  LBB1_27: ## %cond.store13
 ; SSE-NEXT:    movhps %xmm6, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE-NEXT:    je LBB1_30
-; SSE-NEXT:  LBB1_29: ## %cond.store40
+; SSE-NEXT:  LBB1_29: ## %cond.store14
 ; SSE-NEXT:    movlps %xmm7, (%rdi)
 ; SSE-NEXT:    addq $8, %rdi
 ; SSE-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE-NEXT:    je LBB1_32
-; SSE-NEXT:  LBB1_31: ## %cond.store43
+; SSE-NEXT:  LBB1_31: ## %cond.store15
 ; SSE-NEXT:    movhps %xmm7, (%rdi)
 ; SSE-NEXT:    retq
 ;
@@ -395,118 +395,118 @@ define void @compressstore_v16f64_v16i1(double* %base, <16 x double> %V, <16 x i
 ; AVX1OR2-NEXT:  ## %bb.3: ## %cond.store1
 ; AVX1OR2-NEXT:    vmovhps %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
-; AVX1OR2-NEXT:  LBB1_4: ## %else2
+; AVX1OR2-NEXT:  LBB1_4: ## %else1
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    vextractf128 $1, %ymm0, %xmm0
 ; AVX1OR2-NEXT:    jne LBB1_5
-; AVX1OR2-NEXT:  ## %bb.6: ## %else5
+; AVX1OR2-NEXT:  ## %bb.6: ## %else2
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    jne LBB1_7
-; AVX1OR2-NEXT:  LBB1_8: ## %else8
+; AVX1OR2-NEXT:  LBB1_8: ## %else3
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    jne LBB1_9
-; AVX1OR2-NEXT:  LBB1_10: ## %else11
+; AVX1OR2-NEXT:  LBB1_10: ## %else4
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    je LBB1_12
-; AVX1OR2-NEXT:  LBB1_11: ## %cond.store13
+; AVX1OR2-NEXT:  LBB1_11: ## %cond.store5
 ; AVX1OR2-NEXT:    vmovhps %xmm1, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
-; AVX1OR2-NEXT:  LBB1_12: ## %else14
+; AVX1OR2-NEXT:  LBB1_12: ## %else5
 ; AVX1OR2-NEXT:    testb $64, %al
 ; AVX1OR2-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1OR2-NEXT:    jne LBB1_13
-; AVX1OR2-NEXT:  ## %bb.14: ## %else17
+; AVX1OR2-NEXT:  ## %bb.14: ## %else6
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    jne LBB1_15
-; AVX1OR2-NEXT:  LBB1_16: ## %else20
+; AVX1OR2-NEXT:  LBB1_16: ## %else7
 ; AVX1OR2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1OR2-NEXT:    jne LBB1_17
-; AVX1OR2-NEXT:  LBB1_18: ## %else23
+; AVX1OR2-NEXT:  LBB1_18: ## %else8
 ; AVX1OR2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1OR2-NEXT:    je LBB1_20
-; AVX1OR2-NEXT:  LBB1_19: ## %cond.store25
+; AVX1OR2-NEXT:  LBB1_19: ## %cond.store9
 ; AVX1OR2-NEXT:    vmovhps %xmm2, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
-; AVX1OR2-NEXT:  LBB1_20: ## %else26
+; AVX1OR2-NEXT:  LBB1_20: ## %else9
 ; AVX1OR2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1OR2-NEXT:    vextractf128 $1, %ymm2, %xmm0
 ; AVX1OR2-NEXT:    jne LBB1_21
-; AVX1OR2-NEXT:  ## %bb.22: ## %else29
+; AVX1OR2-NEXT:  ## %bb.22: ## %else10
 ; AVX1OR2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1OR2-NEXT:    jne LBB1_23
-; AVX1OR2-NEXT:  LBB1_24: ## %else32
+; AVX1OR2-NEXT:  LBB1_24: ## %else11
 ; AVX1OR2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1OR2-NEXT:    jne LBB1_25
-; AVX1OR2-NEXT:  LBB1_26: ## %else35
+; AVX1OR2-NEXT:  LBB1_26: ## %else12
 ; AVX1OR2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1OR2-NEXT:    je LBB1_28
-; AVX1OR2-NEXT:  LBB1_27: ## %cond.store37
+; AVX1OR2-NEXT:  LBB1_27: ## %cond.store13
 ; AVX1OR2-NEXT:    vmovhps %xmm3, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
-; AVX1OR2-NEXT:  LBB1_28: ## %else38
+; AVX1OR2-NEXT:  LBB1_28: ## %else13
 ; AVX1OR2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1OR2-NEXT:    vextractf128 $1, %ymm3, %xmm0
 ; AVX1OR2-NEXT:    jne LBB1_29
-; AVX1OR2-NEXT:  ## %bb.30: ## %else41
+; AVX1OR2-NEXT:  ## %bb.30: ## %else14
 ; AVX1OR2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1OR2-NEXT:    jne LBB1_31
-; AVX1OR2-NEXT:  LBB1_32: ## %else44
+; AVX1OR2-NEXT:  LBB1_32: ## %else15
 ; AVX1OR2-NEXT:    vzeroupper
 ; AVX1OR2-NEXT:    retq
-; AVX1OR2-NEXT:  LBB1_5: ## %cond.store4
+; AVX1OR2-NEXT:  LBB1_5: ## %cond.store2
 ; AVX1OR2-NEXT:    vmovlps %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    je LBB1_8
-; AVX1OR2-NEXT:  LBB1_7: ## %cond.store7
+; AVX1OR2-NEXT:  LBB1_7: ## %cond.store3
 ; AVX1OR2-NEXT:    vmovhps %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    je LBB1_10
-; AVX1OR2-NEXT:  LBB1_9: ## %cond.store10
+; AVX1OR2-NEXT:  LBB1_9: ## %cond.store4
 ; AVX1OR2-NEXT:    vmovlps %xmm1, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    jne LBB1_11
 ; AVX1OR2-NEXT:    jmp LBB1_12
-; AVX1OR2-NEXT:  LBB1_13: ## %cond.store16
+; AVX1OR2-NEXT:  LBB1_13: ## %cond.store6
 ; AVX1OR2-NEXT:    vmovlps %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    je LBB1_16
-; AVX1OR2-NEXT:  LBB1_15: ## %cond.store19
+; AVX1OR2-NEXT:  LBB1_15: ## %cond.store7
 ; AVX1OR2-NEXT:    vmovhps %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1OR2-NEXT:    je LBB1_18
-; AVX1OR2-NEXT:  LBB1_17: ## %cond.store22
+; AVX1OR2-NEXT:  LBB1_17: ## %cond.store8
 ; AVX1OR2-NEXT:    vmovlps %xmm2, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1OR2-NEXT:    jne LBB1_19
 ; AVX1OR2-NEXT:    jmp LBB1_20
-; AVX1OR2-NEXT:  LBB1_21: ## %cond.store28
+; AVX1OR2-NEXT:  LBB1_21: ## %cond.store10
 ; AVX1OR2-NEXT:    vmovlps %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1OR2-NEXT:    je LBB1_24
-; AVX1OR2-NEXT:  LBB1_23: ## %cond.store31
+; AVX1OR2-NEXT:  LBB1_23: ## %cond.store11
 ; AVX1OR2-NEXT:    vmovhps %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1OR2-NEXT:    je LBB1_26
-; AVX1OR2-NEXT:  LBB1_25: ## %cond.store34
+; AVX1OR2-NEXT:  LBB1_25: ## %cond.store12
 ; AVX1OR2-NEXT:    vmovlps %xmm3, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1OR2-NEXT:    jne LBB1_27
 ; AVX1OR2-NEXT:    jmp LBB1_28
-; AVX1OR2-NEXT:  LBB1_29: ## %cond.store40
+; AVX1OR2-NEXT:  LBB1_29: ## %cond.store14
 ; AVX1OR2-NEXT:    vmovlps %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $8, %rdi
 ; AVX1OR2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1OR2-NEXT:    je LBB1_32
-; AVX1OR2-NEXT:  LBB1_31: ## %cond.store43
+; AVX1OR2-NEXT:  LBB1_31: ## %cond.store15
 ; AVX1OR2-NEXT:    vmovhps %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    vzeroupper
 ; AVX1OR2-NEXT:    retq
@@ -612,7 +612,7 @@ define void @compressstore_v2f32_v2i32(float* %base, <2 x float> %V, <2 x i32> %
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB2_3
-; SSE2-NEXT:  LBB2_4: ## %else2
+; SSE2-NEXT:  LBB2_4: ## %else1
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB2_1: ## %cond.store
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
@@ -635,7 +635,7 @@ define void @compressstore_v2f32_v2i32(float* %base, <2 x float> %V, <2 x i32> %
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB2_3
-; SSE42-NEXT:  LBB2_4: ## %else2
+; SSE42-NEXT:  LBB2_4: ## %else1
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB2_1: ## %cond.store
 ; SSE42-NEXT:    movss %xmm0, (%rdi)
@@ -657,7 +657,7 @@ define void @compressstore_v2f32_v2i32(float* %base, <2 x float> %V, <2 x i32> %
 ; AVX1OR2-NEXT:  ## %bb.2: ## %else
 ; AVX1OR2-NEXT:    testb $2, %al
 ; AVX1OR2-NEXT:    jne LBB2_3
-; AVX1OR2-NEXT:  LBB2_4: ## %else2
+; AVX1OR2-NEXT:  LBB2_4: ## %else1
 ; AVX1OR2-NEXT:    retq
 ; AVX1OR2-NEXT:  LBB2_1: ## %cond.store
 ; AVX1OR2-NEXT:    vmovss %xmm0, (%rdi)
@@ -709,13 +709,13 @@ define void @compressstore_v4f32_v4i1(float* %base, <4 x float> %V, <4 x i1> %ma
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB3_3
-; SSE2-NEXT:  LBB3_4: ## %else2
+; SSE2-NEXT:  LBB3_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB3_5
-; SSE2-NEXT:  LBB3_6: ## %else5
+; SSE2-NEXT:  LBB3_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB3_7
-; SSE2-NEXT:  LBB3_8: ## %else8
+; SSE2-NEXT:  LBB3_8: ## %else3
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB3_1: ## %cond.store
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
@@ -729,14 +729,14 @@ define void @compressstore_v4f32_v4i1(float* %base, <4 x float> %V, <4 x i1> %ma
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB3_6
-; SSE2-NEXT:  LBB3_5: ## %cond.store4
+; SSE2-NEXT:  LBB3_5: ## %cond.store2
 ; SSE2-NEXT:    movaps %xmm0, %xmm1
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm1 = xmm1[1],xmm0[1]
 ; SSE2-NEXT:    movss %xmm1, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB3_8
-; SSE2-NEXT:  LBB3_7: ## %cond.store7
+; SSE2-NEXT:  LBB3_7: ## %cond.store3
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    retq
@@ -750,13 +750,13 @@ define void @compressstore_v4f32_v4i1(float* %base, <4 x float> %V, <4 x i1> %ma
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB3_3
-; SSE42-NEXT:  LBB3_4: ## %else2
+; SSE42-NEXT:  LBB3_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB3_5
-; SSE42-NEXT:  LBB3_6: ## %else5
+; SSE42-NEXT:  LBB3_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB3_7
-; SSE42-NEXT:  LBB3_8: ## %else8
+; SSE42-NEXT:  LBB3_8: ## %else3
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB3_1: ## %cond.store
 ; SSE42-NEXT:    movss %xmm0, (%rdi)
@@ -768,12 +768,12 @@ define void @compressstore_v4f32_v4i1(float* %base, <4 x float> %V, <4 x i1> %ma
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB3_6
-; SSE42-NEXT:  LBB3_5: ## %cond.store4
+; SSE42-NEXT:  LBB3_5: ## %cond.store2
 ; SSE42-NEXT:    extractps $2, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB3_8
-; SSE42-NEXT:  LBB3_7: ## %cond.store7
+; SSE42-NEXT:  LBB3_7: ## %cond.store3
 ; SSE42-NEXT:    extractps $3, %xmm0, (%rdi)
 ; SSE42-NEXT:    retq
 ;
@@ -786,13 +786,13 @@ define void @compressstore_v4f32_v4i1(float* %base, <4 x float> %V, <4 x i1> %ma
 ; AVX1OR2-NEXT:  ## %bb.2: ## %else
 ; AVX1OR2-NEXT:    testb $2, %al
 ; AVX1OR2-NEXT:    jne LBB3_3
-; AVX1OR2-NEXT:  LBB3_4: ## %else2
+; AVX1OR2-NEXT:  LBB3_4: ## %else1
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    jne LBB3_5
-; AVX1OR2-NEXT:  LBB3_6: ## %else5
+; AVX1OR2-NEXT:  LBB3_6: ## %else2
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    jne LBB3_7
-; AVX1OR2-NEXT:  LBB3_8: ## %else8
+; AVX1OR2-NEXT:  LBB3_8: ## %else3
 ; AVX1OR2-NEXT:    retq
 ; AVX1OR2-NEXT:  LBB3_1: ## %cond.store
 ; AVX1OR2-NEXT:    vmovss %xmm0, (%rdi)
@@ -804,12 +804,12 @@ define void @compressstore_v4f32_v4i1(float* %base, <4 x float> %V, <4 x i1> %ma
 ; AVX1OR2-NEXT:    addq $4, %rdi
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    je LBB3_6
-; AVX1OR2-NEXT:  LBB3_5: ## %cond.store4
+; AVX1OR2-NEXT:  LBB3_5: ## %cond.store2
 ; AVX1OR2-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $4, %rdi
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    je LBB3_8
-; AVX1OR2-NEXT:  LBB3_7: ## %cond.store7
+; AVX1OR2-NEXT:  LBB3_7: ## %cond.store3
 ; AVX1OR2-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    retq
 ;
@@ -852,25 +852,25 @@ define void @compressstore_v8f32_v8i1(float* %base, <8 x float> %V, <8 x i1> %ma
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB4_3
-; SSE2-NEXT:  LBB4_4: ## %else2
+; SSE2-NEXT:  LBB4_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB4_5
-; SSE2-NEXT:  LBB4_6: ## %else5
+; SSE2-NEXT:  LBB4_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB4_7
-; SSE2-NEXT:  LBB4_8: ## %else8
+; SSE2-NEXT:  LBB4_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB4_9
-; SSE2-NEXT:  LBB4_10: ## %else11
+; SSE2-NEXT:  LBB4_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB4_11
-; SSE2-NEXT:  LBB4_12: ## %else14
+; SSE2-NEXT:  LBB4_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB4_13
-; SSE2-NEXT:  LBB4_14: ## %else17
+; SSE2-NEXT:  LBB4_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB4_15
-; SSE2-NEXT:  LBB4_16: ## %else20
+; SSE2-NEXT:  LBB4_16: ## %else7
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB4_1: ## %cond.store
 ; SSE2-NEXT:    movd %xmm0, (%rdi)
@@ -884,39 +884,39 @@ define void @compressstore_v8f32_v8i1(float* %base, <8 x float> %V, <8 x i1> %ma
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB4_6
-; SSE2-NEXT:  LBB4_5: ## %cond.store4
+; SSE2-NEXT:  LBB4_5: ## %cond.store2
 ; SSE2-NEXT:    movdqa %xmm0, %xmm2
 ; SSE2-NEXT:    punpckhqdq {{.*#+}} xmm2 = xmm2[1],xmm0[1]
 ; SSE2-NEXT:    movd %xmm2, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB4_8
-; SSE2-NEXT:  LBB4_7: ## %cond.store7
+; SSE2-NEXT:  LBB4_7: ## %cond.store3
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB4_10
-; SSE2-NEXT:  LBB4_9: ## %cond.store10
+; SSE2-NEXT:  LBB4_9: ## %cond.store4
 ; SSE2-NEXT:    movss %xmm1, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB4_12
-; SSE2-NEXT:  LBB4_11: ## %cond.store13
+; SSE2-NEXT:  LBB4_11: ## %cond.store5
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[1,1],xmm1[2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB4_14
-; SSE2-NEXT:  LBB4_13: ## %cond.store16
+; SSE2-NEXT:  LBB4_13: ## %cond.store6
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm0 = xmm0[1],xmm1[1]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB4_16
-; SSE2-NEXT:  LBB4_15: ## %cond.store19
+; SSE2-NEXT:  LBB4_15: ## %cond.store7
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm1, (%rdi)
 ; SSE2-NEXT:    retq
@@ -931,25 +931,25 @@ define void @compressstore_v8f32_v8i1(float* %base, <8 x float> %V, <8 x i1> %ma
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB4_3
-; SSE42-NEXT:  LBB4_4: ## %else2
+; SSE42-NEXT:  LBB4_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB4_5
-; SSE42-NEXT:  LBB4_6: ## %else5
+; SSE42-NEXT:  LBB4_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB4_7
-; SSE42-NEXT:  LBB4_8: ## %else8
+; SSE42-NEXT:  LBB4_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB4_9
-; SSE42-NEXT:  LBB4_10: ## %else11
+; SSE42-NEXT:  LBB4_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB4_11
-; SSE42-NEXT:  LBB4_12: ## %else14
+; SSE42-NEXT:  LBB4_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB4_13
-; SSE42-NEXT:  LBB4_14: ## %else17
+; SSE42-NEXT:  LBB4_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB4_15
-; SSE42-NEXT:  LBB4_16: ## %else20
+; SSE42-NEXT:  LBB4_16: ## %else7
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB4_1: ## %cond.store
 ; SSE42-NEXT:    movd %xmm0, (%rdi)
@@ -961,32 +961,32 @@ define void @compressstore_v8f32_v8i1(float* %base, <8 x float> %V, <8 x i1> %ma
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB4_6
-; SSE42-NEXT:  LBB4_5: ## %cond.store4
+; SSE42-NEXT:  LBB4_5: ## %cond.store2
 ; SSE42-NEXT:    pextrd $2, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB4_8
-; SSE42-NEXT:  LBB4_7: ## %cond.store7
+; SSE42-NEXT:  LBB4_7: ## %cond.store3
 ; SSE42-NEXT:    pextrd $3, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB4_10
-; SSE42-NEXT:  LBB4_9: ## %cond.store10
+; SSE42-NEXT:  LBB4_9: ## %cond.store4
 ; SSE42-NEXT:    movss %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB4_12
-; SSE42-NEXT:  LBB4_11: ## %cond.store13
+; SSE42-NEXT:  LBB4_11: ## %cond.store5
 ; SSE42-NEXT:    extractps $1, %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB4_14
-; SSE42-NEXT:  LBB4_13: ## %cond.store16
+; SSE42-NEXT:  LBB4_13: ## %cond.store6
 ; SSE42-NEXT:    extractps $2, %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB4_16
-; SSE42-NEXT:  LBB4_15: ## %cond.store19
+; SSE42-NEXT:  LBB4_15: ## %cond.store7
 ; SSE42-NEXT:    extractps $3, %xmm1, (%rdi)
 ; SSE42-NEXT:    retq
 ;
@@ -1000,29 +1000,29 @@ define void @compressstore_v8f32_v8i1(float* %base, <8 x float> %V, <8 x i1> %ma
 ; AVX1-NEXT:  ## %bb.2: ## %else
 ; AVX1-NEXT:    testb $2, %al
 ; AVX1-NEXT:    jne LBB4_3
-; AVX1-NEXT:  LBB4_4: ## %else2
+; AVX1-NEXT:  LBB4_4: ## %else1
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    jne LBB4_5
-; AVX1-NEXT:  LBB4_6: ## %else5
+; AVX1-NEXT:  LBB4_6: ## %else2
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    je LBB4_8
-; AVX1-NEXT:  LBB4_7: ## %cond.store7
+; AVX1-NEXT:  LBB4_7: ## %cond.store3
 ; AVX1-NEXT:    vpextrd $3, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
-; AVX1-NEXT:  LBB4_8: ## %else8
+; AVX1-NEXT:  LBB4_8: ## %else3
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    vextractf128 $1, %ymm0, %xmm0
 ; AVX1-NEXT:    jne LBB4_9
-; AVX1-NEXT:  ## %bb.10: ## %else11
+; AVX1-NEXT:  ## %bb.10: ## %else4
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    jne LBB4_11
-; AVX1-NEXT:  LBB4_12: ## %else14
+; AVX1-NEXT:  LBB4_12: ## %else5
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    jne LBB4_13
-; AVX1-NEXT:  LBB4_14: ## %else17
+; AVX1-NEXT:  LBB4_14: ## %else6
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    jne LBB4_15
-; AVX1-NEXT:  LBB4_16: ## %else20
+; AVX1-NEXT:  LBB4_16: ## %else7
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
 ; AVX1-NEXT:  LBB4_1: ## %cond.store
@@ -1035,28 +1035,28 @@ define void @compressstore_v8f32_v8i1(float* %base, <8 x float> %V, <8 x i1> %ma
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    je LBB4_6
-; AVX1-NEXT:  LBB4_5: ## %cond.store4
+; AVX1-NEXT:  LBB4_5: ## %cond.store2
 ; AVX1-NEXT:    vpextrd $2, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    jne LBB4_7
 ; AVX1-NEXT:    jmp LBB4_8
-; AVX1-NEXT:  LBB4_9: ## %cond.store10
+; AVX1-NEXT:  LBB4_9: ## %cond.store4
 ; AVX1-NEXT:    vmovss %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    je LBB4_12
-; AVX1-NEXT:  LBB4_11: ## %cond.store13
+; AVX1-NEXT:  LBB4_11: ## %cond.store5
 ; AVX1-NEXT:    vextractps $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    je LBB4_14
-; AVX1-NEXT:  LBB4_13: ## %cond.store16
+; AVX1-NEXT:  LBB4_13: ## %cond.store6
 ; AVX1-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    je LBB4_16
-; AVX1-NEXT:  LBB4_15: ## %cond.store19
+; AVX1-NEXT:  LBB4_15: ## %cond.store7
 ; AVX1-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
@@ -1071,29 +1071,29 @@ define void @compressstore_v8f32_v8i1(float* %base, <8 x float> %V, <8 x i1> %ma
 ; AVX2-NEXT:  ## %bb.2: ## %else
 ; AVX2-NEXT:    testb $2, %al
 ; AVX2-NEXT:    jne LBB4_3
-; AVX2-NEXT:  LBB4_4: ## %else2
+; AVX2-NEXT:  LBB4_4: ## %else1
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    jne LBB4_5
-; AVX2-NEXT:  LBB4_6: ## %else5
+; AVX2-NEXT:  LBB4_6: ## %else2
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    je LBB4_8
-; AVX2-NEXT:  LBB4_7: ## %cond.store7
+; AVX2-NEXT:  LBB4_7: ## %cond.store3
 ; AVX2-NEXT:    vpextrd $3, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
-; AVX2-NEXT:  LBB4_8: ## %else8
+; AVX2-NEXT:  LBB4_8: ## %else3
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    vextracti128 $1, %ymm0, %xmm0
 ; AVX2-NEXT:    jne LBB4_9
-; AVX2-NEXT:  ## %bb.10: ## %else11
+; AVX2-NEXT:  ## %bb.10: ## %else4
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    jne LBB4_11
-; AVX2-NEXT:  LBB4_12: ## %else14
+; AVX2-NEXT:  LBB4_12: ## %else5
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    jne LBB4_13
-; AVX2-NEXT:  LBB4_14: ## %else17
+; AVX2-NEXT:  LBB4_14: ## %else6
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    jne LBB4_15
-; AVX2-NEXT:  LBB4_16: ## %else20
+; AVX2-NEXT:  LBB4_16: ## %else7
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
 ; AVX2-NEXT:  LBB4_1: ## %cond.store
@@ -1106,28 +1106,28 @@ define void @compressstore_v8f32_v8i1(float* %base, <8 x float> %V, <8 x i1> %ma
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    je LBB4_6
-; AVX2-NEXT:  LBB4_5: ## %cond.store4
+; AVX2-NEXT:  LBB4_5: ## %cond.store2
 ; AVX2-NEXT:    vpextrd $2, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    jne LBB4_7
 ; AVX2-NEXT:    jmp LBB4_8
-; AVX2-NEXT:  LBB4_9: ## %cond.store10
+; AVX2-NEXT:  LBB4_9: ## %cond.store4
 ; AVX2-NEXT:    vmovd %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    je LBB4_12
-; AVX2-NEXT:  LBB4_11: ## %cond.store13
+; AVX2-NEXT:  LBB4_11: ## %cond.store5
 ; AVX2-NEXT:    vpextrd $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    je LBB4_14
-; AVX2-NEXT:  LBB4_13: ## %cond.store16
+; AVX2-NEXT:  LBB4_13: ## %cond.store6
 ; AVX2-NEXT:    vpextrd $2, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    je LBB4_16
-; AVX2-NEXT:  LBB4_15: ## %cond.store19
+; AVX2-NEXT:  LBB4_15: ## %cond.store7
 ; AVX2-NEXT:    vpextrd $3, %xmm0, (%rdi)
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
@@ -1297,97 +1297,97 @@ define void @compressstore_v32f32_v32i32(float* %base, <32 x float> %V, <32 x i3
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB6_3
-; SSE2-NEXT:  LBB6_4: ## %else2
+; SSE2-NEXT:  LBB6_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB6_5
-; SSE2-NEXT:  LBB6_6: ## %else5
+; SSE2-NEXT:  LBB6_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB6_7
-; SSE2-NEXT:  LBB6_8: ## %else8
+; SSE2-NEXT:  LBB6_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB6_9
-; SSE2-NEXT:  LBB6_10: ## %else11
+; SSE2-NEXT:  LBB6_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB6_11
-; SSE2-NEXT:  LBB6_12: ## %else14
+; SSE2-NEXT:  LBB6_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB6_13
-; SSE2-NEXT:  LBB6_14: ## %else17
+; SSE2-NEXT:  LBB6_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB6_15
-; SSE2-NEXT:  LBB6_16: ## %else20
+; SSE2-NEXT:  LBB6_16: ## %else7
 ; SSE2-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE2-NEXT:    jne LBB6_17
-; SSE2-NEXT:  LBB6_18: ## %else23
+; SSE2-NEXT:  LBB6_18: ## %else8
 ; SSE2-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE2-NEXT:    jne LBB6_19
-; SSE2-NEXT:  LBB6_20: ## %else26
+; SSE2-NEXT:  LBB6_20: ## %else9
 ; SSE2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE2-NEXT:    jne LBB6_21
-; SSE2-NEXT:  LBB6_22: ## %else29
+; SSE2-NEXT:  LBB6_22: ## %else10
 ; SSE2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE2-NEXT:    jne LBB6_23
-; SSE2-NEXT:  LBB6_24: ## %else32
+; SSE2-NEXT:  LBB6_24: ## %else11
 ; SSE2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE2-NEXT:    jne LBB6_25
-; SSE2-NEXT:  LBB6_26: ## %else35
+; SSE2-NEXT:  LBB6_26: ## %else12
 ; SSE2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE2-NEXT:    jne LBB6_27
-; SSE2-NEXT:  LBB6_28: ## %else38
+; SSE2-NEXT:  LBB6_28: ## %else13
 ; SSE2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE2-NEXT:    jne LBB6_29
-; SSE2-NEXT:  LBB6_30: ## %else41
+; SSE2-NEXT:  LBB6_30: ## %else14
 ; SSE2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE2-NEXT:    jne LBB6_31
-; SSE2-NEXT:  LBB6_32: ## %else44
+; SSE2-NEXT:  LBB6_32: ## %else15
 ; SSE2-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; SSE2-NEXT:    jne LBB6_33
-; SSE2-NEXT:  LBB6_34: ## %else47
+; SSE2-NEXT:  LBB6_34: ## %else16
 ; SSE2-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; SSE2-NEXT:    jne LBB6_35
-; SSE2-NEXT:  LBB6_36: ## %else50
+; SSE2-NEXT:  LBB6_36: ## %else17
 ; SSE2-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; SSE2-NEXT:    jne LBB6_37
-; SSE2-NEXT:  LBB6_38: ## %else53
+; SSE2-NEXT:  LBB6_38: ## %else18
 ; SSE2-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; SSE2-NEXT:    jne LBB6_39
-; SSE2-NEXT:  LBB6_40: ## %else56
+; SSE2-NEXT:  LBB6_40: ## %else19
 ; SSE2-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; SSE2-NEXT:    jne LBB6_41
-; SSE2-NEXT:  LBB6_42: ## %else59
+; SSE2-NEXT:  LBB6_42: ## %else20
 ; SSE2-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; SSE2-NEXT:    jne LBB6_43
-; SSE2-NEXT:  LBB6_44: ## %else62
+; SSE2-NEXT:  LBB6_44: ## %else21
 ; SSE2-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; SSE2-NEXT:    jne LBB6_45
-; SSE2-NEXT:  LBB6_46: ## %else65
+; SSE2-NEXT:  LBB6_46: ## %else22
 ; SSE2-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; SSE2-NEXT:    jne LBB6_47
-; SSE2-NEXT:  LBB6_48: ## %else68
+; SSE2-NEXT:  LBB6_48: ## %else23
 ; SSE2-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; SSE2-NEXT:    jne LBB6_49
-; SSE2-NEXT:  LBB6_50: ## %else71
+; SSE2-NEXT:  LBB6_50: ## %else24
 ; SSE2-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; SSE2-NEXT:    jne LBB6_51
-; SSE2-NEXT:  LBB6_52: ## %else74
+; SSE2-NEXT:  LBB6_52: ## %else25
 ; SSE2-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; SSE2-NEXT:    jne LBB6_53
-; SSE2-NEXT:  LBB6_54: ## %else77
+; SSE2-NEXT:  LBB6_54: ## %else26
 ; SSE2-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; SSE2-NEXT:    jne LBB6_55
-; SSE2-NEXT:  LBB6_56: ## %else80
+; SSE2-NEXT:  LBB6_56: ## %else27
 ; SSE2-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; SSE2-NEXT:    jne LBB6_57
-; SSE2-NEXT:  LBB6_58: ## %else83
+; SSE2-NEXT:  LBB6_58: ## %else28
 ; SSE2-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; SSE2-NEXT:    jne LBB6_59
-; SSE2-NEXT:  LBB6_60: ## %else86
+; SSE2-NEXT:  LBB6_60: ## %else29
 ; SSE2-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; SSE2-NEXT:    jne LBB6_61
-; SSE2-NEXT:  LBB6_62: ## %else89
+; SSE2-NEXT:  LBB6_62: ## %else30
 ; SSE2-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; SSE2-NEXT:    jne LBB6_63
-; SSE2-NEXT:  LBB6_64: ## %else92
+; SSE2-NEXT:  LBB6_64: ## %else31
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB6_1: ## %cond.store
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
@@ -1401,189 +1401,189 @@ define void @compressstore_v32f32_v32i32(float* %base, <32 x float> %V, <32 x i3
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB6_6
-; SSE2-NEXT:  LBB6_5: ## %cond.store4
+; SSE2-NEXT:  LBB6_5: ## %cond.store2
 ; SSE2-NEXT:    movaps %xmm0, %xmm8
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm8 = xmm8[1],xmm0[1]
 ; SSE2-NEXT:    movss %xmm8, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB6_8
-; SSE2-NEXT:  LBB6_7: ## %cond.store7
+; SSE2-NEXT:  LBB6_7: ## %cond.store3
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB6_10
-; SSE2-NEXT:  LBB6_9: ## %cond.store10
+; SSE2-NEXT:  LBB6_9: ## %cond.store4
 ; SSE2-NEXT:    movss %xmm1, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB6_12
-; SSE2-NEXT:  LBB6_11: ## %cond.store13
+; SSE2-NEXT:  LBB6_11: ## %cond.store5
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[1,1],xmm1[2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB6_14
-; SSE2-NEXT:  LBB6_13: ## %cond.store16
+; SSE2-NEXT:  LBB6_13: ## %cond.store6
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm0 = xmm0[1],xmm1[1]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB6_16
-; SSE2-NEXT:  LBB6_15: ## %cond.store19
+; SSE2-NEXT:  LBB6_15: ## %cond.store7
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm1, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE2-NEXT:    je LBB6_18
-; SSE2-NEXT:  LBB6_17: ## %cond.store22
+; SSE2-NEXT:  LBB6_17: ## %cond.store8
 ; SSE2-NEXT:    movss %xmm2, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE2-NEXT:    je LBB6_20
-; SSE2-NEXT:  LBB6_19: ## %cond.store25
+; SSE2-NEXT:  LBB6_19: ## %cond.store9
 ; SSE2-NEXT:    movaps %xmm2, %xmm0
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[1,1],xmm2[2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE2-NEXT:    je LBB6_22
-; SSE2-NEXT:  LBB6_21: ## %cond.store28
+; SSE2-NEXT:  LBB6_21: ## %cond.store10
 ; SSE2-NEXT:    movaps %xmm2, %xmm0
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm0 = xmm0[1],xmm2[1]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE2-NEXT:    je LBB6_24
-; SSE2-NEXT:  LBB6_23: ## %cond.store31
+; SSE2-NEXT:  LBB6_23: ## %cond.store11
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm2, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE2-NEXT:    je LBB6_26
-; SSE2-NEXT:  LBB6_25: ## %cond.store34
+; SSE2-NEXT:  LBB6_25: ## %cond.store12
 ; SSE2-NEXT:    movss %xmm3, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE2-NEXT:    je LBB6_28
-; SSE2-NEXT:  LBB6_27: ## %cond.store37
+; SSE2-NEXT:  LBB6_27: ## %cond.store13
 ; SSE2-NEXT:    movaps %xmm3, %xmm0
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[1,1],xmm3[2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE2-NEXT:    je LBB6_30
-; SSE2-NEXT:  LBB6_29: ## %cond.store40
+; SSE2-NEXT:  LBB6_29: ## %cond.store14
 ; SSE2-NEXT:    movaps %xmm3, %xmm0
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm0 = xmm0[1],xmm3[1]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE2-NEXT:    je LBB6_32
-; SSE2-NEXT:  LBB6_31: ## %cond.store43
+; SSE2-NEXT:  LBB6_31: ## %cond.store15
 ; SSE2-NEXT:    shufps {{.*#+}} xmm3 = xmm3[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm3, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; SSE2-NEXT:    je LBB6_34
-; SSE2-NEXT:  LBB6_33: ## %cond.store46
+; SSE2-NEXT:  LBB6_33: ## %cond.store16
 ; SSE2-NEXT:    movss %xmm4, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; SSE2-NEXT:    je LBB6_36
-; SSE2-NEXT:  LBB6_35: ## %cond.store49
+; SSE2-NEXT:  LBB6_35: ## %cond.store17
 ; SSE2-NEXT:    movaps %xmm4, %xmm0
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[1,1],xmm4[2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; SSE2-NEXT:    je LBB6_38
-; SSE2-NEXT:  LBB6_37: ## %cond.store52
+; SSE2-NEXT:  LBB6_37: ## %cond.store18
 ; SSE2-NEXT:    movaps %xmm4, %xmm0
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm0 = xmm0[1],xmm4[1]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; SSE2-NEXT:    je LBB6_40
-; SSE2-NEXT:  LBB6_39: ## %cond.store55
+; SSE2-NEXT:  LBB6_39: ## %cond.store19
 ; SSE2-NEXT:    shufps {{.*#+}} xmm4 = xmm4[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm4, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; SSE2-NEXT:    je LBB6_42
-; SSE2-NEXT:  LBB6_41: ## %cond.store58
+; SSE2-NEXT:  LBB6_41: ## %cond.store20
 ; SSE2-NEXT:    movss %xmm5, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; SSE2-NEXT:    je LBB6_44
-; SSE2-NEXT:  LBB6_43: ## %cond.store61
+; SSE2-NEXT:  LBB6_43: ## %cond.store21
 ; SSE2-NEXT:    movaps %xmm5, %xmm0
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[1,1],xmm5[2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; SSE2-NEXT:    je LBB6_46
-; SSE2-NEXT:  LBB6_45: ## %cond.store64
+; SSE2-NEXT:  LBB6_45: ## %cond.store22
 ; SSE2-NEXT:    movaps %xmm5, %xmm0
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm0 = xmm0[1],xmm5[1]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; SSE2-NEXT:    je LBB6_48
-; SSE2-NEXT:  LBB6_47: ## %cond.store67
+; SSE2-NEXT:  LBB6_47: ## %cond.store23
 ; SSE2-NEXT:    shufps {{.*#+}} xmm5 = xmm5[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm5, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; SSE2-NEXT:    je LBB6_50
-; SSE2-NEXT:  LBB6_49: ## %cond.store70
+; SSE2-NEXT:  LBB6_49: ## %cond.store24
 ; SSE2-NEXT:    movss %xmm6, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; SSE2-NEXT:    je LBB6_52
-; SSE2-NEXT:  LBB6_51: ## %cond.store73
+; SSE2-NEXT:  LBB6_51: ## %cond.store25
 ; SSE2-NEXT:    movaps %xmm6, %xmm0
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[1,1],xmm6[2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; SSE2-NEXT:    je LBB6_54
-; SSE2-NEXT:  LBB6_53: ## %cond.store76
+; SSE2-NEXT:  LBB6_53: ## %cond.store26
 ; SSE2-NEXT:    movaps %xmm6, %xmm0
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm0 = xmm0[1],xmm6[1]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; SSE2-NEXT:    je LBB6_56
-; SSE2-NEXT:  LBB6_55: ## %cond.store79
+; SSE2-NEXT:  LBB6_55: ## %cond.store27
 ; SSE2-NEXT:    shufps {{.*#+}} xmm6 = xmm6[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm6, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; SSE2-NEXT:    je LBB6_58
-; SSE2-NEXT:  LBB6_57: ## %cond.store82
+; SSE2-NEXT:  LBB6_57: ## %cond.store28
 ; SSE2-NEXT:    movss %xmm7, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; SSE2-NEXT:    je LBB6_60
-; SSE2-NEXT:  LBB6_59: ## %cond.store85
+; SSE2-NEXT:  LBB6_59: ## %cond.store29
 ; SSE2-NEXT:    movaps %xmm7, %xmm0
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[1,1],xmm7[2,3]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; SSE2-NEXT:    je LBB6_62
-; SSE2-NEXT:  LBB6_61: ## %cond.store88
+; SSE2-NEXT:  LBB6_61: ## %cond.store30
 ; SSE2-NEXT:    movaps %xmm7, %xmm0
 ; SSE2-NEXT:    unpckhpd {{.*#+}} xmm0 = xmm0[1],xmm7[1]
 ; SSE2-NEXT:    movss %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; SSE2-NEXT:    je LBB6_64
-; SSE2-NEXT:  LBB6_63: ## %cond.store91
+; SSE2-NEXT:  LBB6_63: ## %cond.store31
 ; SSE2-NEXT:    shufps {{.*#+}} xmm7 = xmm7[3,1,2,3]
 ; SSE2-NEXT:    movss %xmm7, (%rdi)
 ; SSE2-NEXT:    retq
@@ -1621,97 +1621,97 @@ define void @compressstore_v32f32_v32i32(float* %base, <32 x float> %V, <32 x i3
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB6_3
-; SSE42-NEXT:  LBB6_4: ## %else2
+; SSE42-NEXT:  LBB6_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB6_5
-; SSE42-NEXT:  LBB6_6: ## %else5
+; SSE42-NEXT:  LBB6_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB6_7
-; SSE42-NEXT:  LBB6_8: ## %else8
+; SSE42-NEXT:  LBB6_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB6_9
-; SSE42-NEXT:  LBB6_10: ## %else11
+; SSE42-NEXT:  LBB6_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB6_11
-; SSE42-NEXT:  LBB6_12: ## %else14
+; SSE42-NEXT:  LBB6_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB6_13
-; SSE42-NEXT:  LBB6_14: ## %else17
+; SSE42-NEXT:  LBB6_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB6_15
-; SSE42-NEXT:  LBB6_16: ## %else20
+; SSE42-NEXT:  LBB6_16: ## %else7
 ; SSE42-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE42-NEXT:    jne LBB6_17
-; SSE42-NEXT:  LBB6_18: ## %else23
+; SSE42-NEXT:  LBB6_18: ## %else8
 ; SSE42-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE42-NEXT:    jne LBB6_19
-; SSE42-NEXT:  LBB6_20: ## %else26
+; SSE42-NEXT:  LBB6_20: ## %else9
 ; SSE42-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE42-NEXT:    jne LBB6_21
-; SSE42-NEXT:  LBB6_22: ## %else29
+; SSE42-NEXT:  LBB6_22: ## %else10
 ; SSE42-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE42-NEXT:    jne LBB6_23
-; SSE42-NEXT:  LBB6_24: ## %else32
+; SSE42-NEXT:  LBB6_24: ## %else11
 ; SSE42-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE42-NEXT:    jne LBB6_25
-; SSE42-NEXT:  LBB6_26: ## %else35
+; SSE42-NEXT:  LBB6_26: ## %else12
 ; SSE42-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE42-NEXT:    jne LBB6_27
-; SSE42-NEXT:  LBB6_28: ## %else38
+; SSE42-NEXT:  LBB6_28: ## %else13
 ; SSE42-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE42-NEXT:    jne LBB6_29
-; SSE42-NEXT:  LBB6_30: ## %else41
+; SSE42-NEXT:  LBB6_30: ## %else14
 ; SSE42-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE42-NEXT:    jne LBB6_31
-; SSE42-NEXT:  LBB6_32: ## %else44
+; SSE42-NEXT:  LBB6_32: ## %else15
 ; SSE42-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; SSE42-NEXT:    jne LBB6_33
-; SSE42-NEXT:  LBB6_34: ## %else47
+; SSE42-NEXT:  LBB6_34: ## %else16
 ; SSE42-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; SSE42-NEXT:    jne LBB6_35
-; SSE42-NEXT:  LBB6_36: ## %else50
+; SSE42-NEXT:  LBB6_36: ## %else17
 ; SSE42-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; SSE42-NEXT:    jne LBB6_37
-; SSE42-NEXT:  LBB6_38: ## %else53
+; SSE42-NEXT:  LBB6_38: ## %else18
 ; SSE42-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; SSE42-NEXT:    jne LBB6_39
-; SSE42-NEXT:  LBB6_40: ## %else56
+; SSE42-NEXT:  LBB6_40: ## %else19
 ; SSE42-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; SSE42-NEXT:    jne LBB6_41
-; SSE42-NEXT:  LBB6_42: ## %else59
+; SSE42-NEXT:  LBB6_42: ## %else20
 ; SSE42-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; SSE42-NEXT:    jne LBB6_43
-; SSE42-NEXT:  LBB6_44: ## %else62
+; SSE42-NEXT:  LBB6_44: ## %else21
 ; SSE42-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; SSE42-NEXT:    jne LBB6_45
-; SSE42-NEXT:  LBB6_46: ## %else65
+; SSE42-NEXT:  LBB6_46: ## %else22
 ; SSE42-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; SSE42-NEXT:    jne LBB6_47
-; SSE42-NEXT:  LBB6_48: ## %else68
+; SSE42-NEXT:  LBB6_48: ## %else23
 ; SSE42-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; SSE42-NEXT:    jne LBB6_49
-; SSE42-NEXT:  LBB6_50: ## %else71
+; SSE42-NEXT:  LBB6_50: ## %else24
 ; SSE42-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; SSE42-NEXT:    jne LBB6_51
-; SSE42-NEXT:  LBB6_52: ## %else74
+; SSE42-NEXT:  LBB6_52: ## %else25
 ; SSE42-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; SSE42-NEXT:    jne LBB6_53
-; SSE42-NEXT:  LBB6_54: ## %else77
+; SSE42-NEXT:  LBB6_54: ## %else26
 ; SSE42-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; SSE42-NEXT:    jne LBB6_55
-; SSE42-NEXT:  LBB6_56: ## %else80
+; SSE42-NEXT:  LBB6_56: ## %else27
 ; SSE42-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; SSE42-NEXT:    jne LBB6_57
-; SSE42-NEXT:  LBB6_58: ## %else83
+; SSE42-NEXT:  LBB6_58: ## %else28
 ; SSE42-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; SSE42-NEXT:    jne LBB6_59
-; SSE42-NEXT:  LBB6_60: ## %else86
+; SSE42-NEXT:  LBB6_60: ## %else29
 ; SSE42-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; SSE42-NEXT:    jne LBB6_61
-; SSE42-NEXT:  LBB6_62: ## %else89
+; SSE42-NEXT:  LBB6_62: ## %else30
 ; SSE42-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; SSE42-NEXT:    jne LBB6_63
-; SSE42-NEXT:  LBB6_64: ## %else92
+; SSE42-NEXT:  LBB6_64: ## %else31
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB6_1: ## %cond.store
 ; SSE42-NEXT:    movss %xmm0, (%rdi)
@@ -1723,152 +1723,152 @@ define void @compressstore_v32f32_v32i32(float* %base, <32 x float> %V, <32 x i3
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB6_6
-; SSE42-NEXT:  LBB6_5: ## %cond.store4
+; SSE42-NEXT:  LBB6_5: ## %cond.store2
 ; SSE42-NEXT:    extractps $2, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB6_8
-; SSE42-NEXT:  LBB6_7: ## %cond.store7
+; SSE42-NEXT:  LBB6_7: ## %cond.store3
 ; SSE42-NEXT:    extractps $3, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB6_10
-; SSE42-NEXT:  LBB6_9: ## %cond.store10
+; SSE42-NEXT:  LBB6_9: ## %cond.store4
 ; SSE42-NEXT:    movss %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB6_12
-; SSE42-NEXT:  LBB6_11: ## %cond.store13
+; SSE42-NEXT:  LBB6_11: ## %cond.store5
 ; SSE42-NEXT:    extractps $1, %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB6_14
-; SSE42-NEXT:  LBB6_13: ## %cond.store16
+; SSE42-NEXT:  LBB6_13: ## %cond.store6
 ; SSE42-NEXT:    extractps $2, %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB6_16
-; SSE42-NEXT:  LBB6_15: ## %cond.store19
+; SSE42-NEXT:  LBB6_15: ## %cond.store7
 ; SSE42-NEXT:    extractps $3, %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE42-NEXT:    je LBB6_18
-; SSE42-NEXT:  LBB6_17: ## %cond.store22
+; SSE42-NEXT:  LBB6_17: ## %cond.store8
 ; SSE42-NEXT:    movss %xmm2, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE42-NEXT:    je LBB6_20
-; SSE42-NEXT:  LBB6_19: ## %cond.store25
+; SSE42-NEXT:  LBB6_19: ## %cond.store9
 ; SSE42-NEXT:    extractps $1, %xmm2, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE42-NEXT:    je LBB6_22
-; SSE42-NEXT:  LBB6_21: ## %cond.store28
+; SSE42-NEXT:  LBB6_21: ## %cond.store10
 ; SSE42-NEXT:    extractps $2, %xmm2, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE42-NEXT:    je LBB6_24
-; SSE42-NEXT:  LBB6_23: ## %cond.store31
+; SSE42-NEXT:  LBB6_23: ## %cond.store11
 ; SSE42-NEXT:    extractps $3, %xmm2, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE42-NEXT:    je LBB6_26
-; SSE42-NEXT:  LBB6_25: ## %cond.store34
+; SSE42-NEXT:  LBB6_25: ## %cond.store12
 ; SSE42-NEXT:    movss %xmm3, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE42-NEXT:    je LBB6_28
-; SSE42-NEXT:  LBB6_27: ## %cond.store37
+; SSE42-NEXT:  LBB6_27: ## %cond.store13
 ; SSE42-NEXT:    extractps $1, %xmm3, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE42-NEXT:    je LBB6_30
-; SSE42-NEXT:  LBB6_29: ## %cond.store40
+; SSE42-NEXT:  LBB6_29: ## %cond.store14
 ; SSE42-NEXT:    extractps $2, %xmm3, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE42-NEXT:    je LBB6_32
-; SSE42-NEXT:  LBB6_31: ## %cond.store43
+; SSE42-NEXT:  LBB6_31: ## %cond.store15
 ; SSE42-NEXT:    extractps $3, %xmm3, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; SSE42-NEXT:    je LBB6_34
-; SSE42-NEXT:  LBB6_33: ## %cond.store46
+; SSE42-NEXT:  LBB6_33: ## %cond.store16
 ; SSE42-NEXT:    movss %xmm4, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; SSE42-NEXT:    je LBB6_36
-; SSE42-NEXT:  LBB6_35: ## %cond.store49
+; SSE42-NEXT:  LBB6_35: ## %cond.store17
 ; SSE42-NEXT:    extractps $1, %xmm4, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; SSE42-NEXT:    je LBB6_38
-; SSE42-NEXT:  LBB6_37: ## %cond.store52
+; SSE42-NEXT:  LBB6_37: ## %cond.store18
 ; SSE42-NEXT:    extractps $2, %xmm4, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; SSE42-NEXT:    je LBB6_40
-; SSE42-NEXT:  LBB6_39: ## %cond.store55
+; SSE42-NEXT:  LBB6_39: ## %cond.store19
 ; SSE42-NEXT:    extractps $3, %xmm4, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; SSE42-NEXT:    je LBB6_42
-; SSE42-NEXT:  LBB6_41: ## %cond.store58
+; SSE42-NEXT:  LBB6_41: ## %cond.store20
 ; SSE42-NEXT:    movss %xmm5, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; SSE42-NEXT:    je LBB6_44
-; SSE42-NEXT:  LBB6_43: ## %cond.store61
+; SSE42-NEXT:  LBB6_43: ## %cond.store21
 ; SSE42-NEXT:    extractps $1, %xmm5, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; SSE42-NEXT:    je LBB6_46
-; SSE42-NEXT:  LBB6_45: ## %cond.store64
+; SSE42-NEXT:  LBB6_45: ## %cond.store22
 ; SSE42-NEXT:    extractps $2, %xmm5, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; SSE42-NEXT:    je LBB6_48
-; SSE42-NEXT:  LBB6_47: ## %cond.store67
+; SSE42-NEXT:  LBB6_47: ## %cond.store23
 ; SSE42-NEXT:    extractps $3, %xmm5, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; SSE42-NEXT:    je LBB6_50
-; SSE42-NEXT:  LBB6_49: ## %cond.store70
+; SSE42-NEXT:  LBB6_49: ## %cond.store24
 ; SSE42-NEXT:    movss %xmm6, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; SSE42-NEXT:    je LBB6_52
-; SSE42-NEXT:  LBB6_51: ## %cond.store73
+; SSE42-NEXT:  LBB6_51: ## %cond.store25
 ; SSE42-NEXT:    extractps $1, %xmm6, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; SSE42-NEXT:    je LBB6_54
-; SSE42-NEXT:  LBB6_53: ## %cond.store76
+; SSE42-NEXT:  LBB6_53: ## %cond.store26
 ; SSE42-NEXT:    extractps $2, %xmm6, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; SSE42-NEXT:    je LBB6_56
-; SSE42-NEXT:  LBB6_55: ## %cond.store79
+; SSE42-NEXT:  LBB6_55: ## %cond.store27
 ; SSE42-NEXT:    extractps $3, %xmm6, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; SSE42-NEXT:    je LBB6_58
-; SSE42-NEXT:  LBB6_57: ## %cond.store82
+; SSE42-NEXT:  LBB6_57: ## %cond.store28
 ; SSE42-NEXT:    movss %xmm7, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; SSE42-NEXT:    je LBB6_60
-; SSE42-NEXT:  LBB6_59: ## %cond.store85
+; SSE42-NEXT:  LBB6_59: ## %cond.store29
 ; SSE42-NEXT:    extractps $1, %xmm7, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; SSE42-NEXT:    je LBB6_62
-; SSE42-NEXT:  LBB6_61: ## %cond.store88
+; SSE42-NEXT:  LBB6_61: ## %cond.store30
 ; SSE42-NEXT:    extractps $2, %xmm7, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; SSE42-NEXT:    je LBB6_64
-; SSE42-NEXT:  LBB6_63: ## %cond.store91
+; SSE42-NEXT:  LBB6_63: ## %cond.store31
 ; SSE42-NEXT:    extractps $3, %xmm7, (%rdi)
 ; SSE42-NEXT:    retq
 ;
@@ -1902,113 +1902,113 @@ define void @compressstore_v32f32_v32i32(float* %base, <32 x float> %V, <32 x i3
 ; AVX1-NEXT:  ## %bb.2: ## %else
 ; AVX1-NEXT:    testb $2, %al
 ; AVX1-NEXT:    jne LBB6_3
-; AVX1-NEXT:  LBB6_4: ## %else2
+; AVX1-NEXT:  LBB6_4: ## %else1
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    jne LBB6_5
-; AVX1-NEXT:  LBB6_6: ## %else5
+; AVX1-NEXT:  LBB6_6: ## %else2
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    je LBB6_8
-; AVX1-NEXT:  LBB6_7: ## %cond.store7
+; AVX1-NEXT:  LBB6_7: ## %cond.store3
 ; AVX1-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
-; AVX1-NEXT:  LBB6_8: ## %else8
+; AVX1-NEXT:  LBB6_8: ## %else3
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    vextractf128 $1, %ymm0, %xmm0
 ; AVX1-NEXT:    jne LBB6_9
-; AVX1-NEXT:  ## %bb.10: ## %else11
+; AVX1-NEXT:  ## %bb.10: ## %else4
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    jne LBB6_11
-; AVX1-NEXT:  LBB6_12: ## %else14
+; AVX1-NEXT:  LBB6_12: ## %else5
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    jne LBB6_13
-; AVX1-NEXT:  LBB6_14: ## %else17
+; AVX1-NEXT:  LBB6_14: ## %else6
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    jne LBB6_15
-; AVX1-NEXT:  LBB6_16: ## %else20
+; AVX1-NEXT:  LBB6_16: ## %else7
 ; AVX1-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1-NEXT:    jne LBB6_17
-; AVX1-NEXT:  LBB6_18: ## %else23
+; AVX1-NEXT:  LBB6_18: ## %else8
 ; AVX1-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1-NEXT:    jne LBB6_19
-; AVX1-NEXT:  LBB6_20: ## %else26
+; AVX1-NEXT:  LBB6_20: ## %else9
 ; AVX1-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1-NEXT:    jne LBB6_21
-; AVX1-NEXT:  LBB6_22: ## %else29
+; AVX1-NEXT:  LBB6_22: ## %else10
 ; AVX1-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1-NEXT:    je LBB6_24
-; AVX1-NEXT:  LBB6_23: ## %cond.store31
+; AVX1-NEXT:  LBB6_23: ## %cond.store11
 ; AVX1-NEXT:    vextractps $3, %xmm1, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
-; AVX1-NEXT:  LBB6_24: ## %else32
+; AVX1-NEXT:  LBB6_24: ## %else11
 ; AVX1-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    jne LBB6_25
-; AVX1-NEXT:  ## %bb.26: ## %else35
+; AVX1-NEXT:  ## %bb.26: ## %else12
 ; AVX1-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1-NEXT:    jne LBB6_27
-; AVX1-NEXT:  LBB6_28: ## %else38
+; AVX1-NEXT:  LBB6_28: ## %else13
 ; AVX1-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1-NEXT:    jne LBB6_29
-; AVX1-NEXT:  LBB6_30: ## %else41
+; AVX1-NEXT:  LBB6_30: ## %else14
 ; AVX1-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1-NEXT:    jne LBB6_31
-; AVX1-NEXT:  LBB6_32: ## %else44
+; AVX1-NEXT:  LBB6_32: ## %else15
 ; AVX1-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX1-NEXT:    jne LBB6_33
-; AVX1-NEXT:  LBB6_34: ## %else47
+; AVX1-NEXT:  LBB6_34: ## %else16
 ; AVX1-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX1-NEXT:    jne LBB6_35
-; AVX1-NEXT:  LBB6_36: ## %else50
+; AVX1-NEXT:  LBB6_36: ## %else17
 ; AVX1-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX1-NEXT:    jne LBB6_37
-; AVX1-NEXT:  LBB6_38: ## %else53
+; AVX1-NEXT:  LBB6_38: ## %else18
 ; AVX1-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX1-NEXT:    je LBB6_40
-; AVX1-NEXT:  LBB6_39: ## %cond.store55
+; AVX1-NEXT:  LBB6_39: ## %cond.store19
 ; AVX1-NEXT:    vextractps $3, %xmm2, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
-; AVX1-NEXT:  LBB6_40: ## %else56
+; AVX1-NEXT:  LBB6_40: ## %else19
 ; AVX1-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX1-NEXT:    vextractf128 $1, %ymm2, %xmm0
 ; AVX1-NEXT:    jne LBB6_41
-; AVX1-NEXT:  ## %bb.42: ## %else59
+; AVX1-NEXT:  ## %bb.42: ## %else20
 ; AVX1-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX1-NEXT:    jne LBB6_43
-; AVX1-NEXT:  LBB6_44: ## %else62
+; AVX1-NEXT:  LBB6_44: ## %else21
 ; AVX1-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX1-NEXT:    jne LBB6_45
-; AVX1-NEXT:  LBB6_46: ## %else65
+; AVX1-NEXT:  LBB6_46: ## %else22
 ; AVX1-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX1-NEXT:    jne LBB6_47
-; AVX1-NEXT:  LBB6_48: ## %else68
+; AVX1-NEXT:  LBB6_48: ## %else23
 ; AVX1-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX1-NEXT:    jne LBB6_49
-; AVX1-NEXT:  LBB6_50: ## %else71
+; AVX1-NEXT:  LBB6_50: ## %else24
 ; AVX1-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX1-NEXT:    jne LBB6_51
-; AVX1-NEXT:  LBB6_52: ## %else74
+; AVX1-NEXT:  LBB6_52: ## %else25
 ; AVX1-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX1-NEXT:    jne LBB6_53
-; AVX1-NEXT:  LBB6_54: ## %else77
+; AVX1-NEXT:  LBB6_54: ## %else26
 ; AVX1-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX1-NEXT:    je LBB6_56
-; AVX1-NEXT:  LBB6_55: ## %cond.store79
+; AVX1-NEXT:  LBB6_55: ## %cond.store27
 ; AVX1-NEXT:    vextractps $3, %xmm3, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
-; AVX1-NEXT:  LBB6_56: ## %else80
+; AVX1-NEXT:  LBB6_56: ## %else27
 ; AVX1-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX1-NEXT:    vextractf128 $1, %ymm3, %xmm0
 ; AVX1-NEXT:    jne LBB6_57
-; AVX1-NEXT:  ## %bb.58: ## %else83
+; AVX1-NEXT:  ## %bb.58: ## %else28
 ; AVX1-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX1-NEXT:    jne LBB6_59
-; AVX1-NEXT:  LBB6_60: ## %else86
+; AVX1-NEXT:  LBB6_60: ## %else29
 ; AVX1-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX1-NEXT:    jne LBB6_61
-; AVX1-NEXT:  LBB6_62: ## %else89
+; AVX1-NEXT:  LBB6_62: ## %else30
 ; AVX1-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX1-NEXT:    jne LBB6_63
-; AVX1-NEXT:  LBB6_64: ## %else92
+; AVX1-NEXT:  LBB6_64: ## %else31
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
 ; AVX1-NEXT:  LBB6_1: ## %cond.store
@@ -2021,136 +2021,136 @@ define void @compressstore_v32f32_v32i32(float* %base, <32 x float> %V, <32 x i3
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    je LBB6_6
-; AVX1-NEXT:  LBB6_5: ## %cond.store4
+; AVX1-NEXT:  LBB6_5: ## %cond.store2
 ; AVX1-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    jne LBB6_7
 ; AVX1-NEXT:    jmp LBB6_8
-; AVX1-NEXT:  LBB6_9: ## %cond.store10
+; AVX1-NEXT:  LBB6_9: ## %cond.store4
 ; AVX1-NEXT:    vmovss %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    je LBB6_12
-; AVX1-NEXT:  LBB6_11: ## %cond.store13
+; AVX1-NEXT:  LBB6_11: ## %cond.store5
 ; AVX1-NEXT:    vextractps $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    je LBB6_14
-; AVX1-NEXT:  LBB6_13: ## %cond.store16
+; AVX1-NEXT:  LBB6_13: ## %cond.store6
 ; AVX1-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    je LBB6_16
-; AVX1-NEXT:  LBB6_15: ## %cond.store19
+; AVX1-NEXT:  LBB6_15: ## %cond.store7
 ; AVX1-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1-NEXT:    je LBB6_18
-; AVX1-NEXT:  LBB6_17: ## %cond.store22
+; AVX1-NEXT:  LBB6_17: ## %cond.store8
 ; AVX1-NEXT:    vmovss %xmm1, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1-NEXT:    je LBB6_20
-; AVX1-NEXT:  LBB6_19: ## %cond.store25
+; AVX1-NEXT:  LBB6_19: ## %cond.store9
 ; AVX1-NEXT:    vextractps $1, %xmm1, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1-NEXT:    je LBB6_22
-; AVX1-NEXT:  LBB6_21: ## %cond.store28
+; AVX1-NEXT:  LBB6_21: ## %cond.store10
 ; AVX1-NEXT:    vextractps $2, %xmm1, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1-NEXT:    jne LBB6_23
 ; AVX1-NEXT:    jmp LBB6_24
-; AVX1-NEXT:  LBB6_25: ## %cond.store34
+; AVX1-NEXT:  LBB6_25: ## %cond.store12
 ; AVX1-NEXT:    vmovss %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1-NEXT:    je LBB6_28
-; AVX1-NEXT:  LBB6_27: ## %cond.store37
+; AVX1-NEXT:  LBB6_27: ## %cond.store13
 ; AVX1-NEXT:    vextractps $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1-NEXT:    je LBB6_30
-; AVX1-NEXT:  LBB6_29: ## %cond.store40
+; AVX1-NEXT:  LBB6_29: ## %cond.store14
 ; AVX1-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1-NEXT:    je LBB6_32
-; AVX1-NEXT:  LBB6_31: ## %cond.store43
+; AVX1-NEXT:  LBB6_31: ## %cond.store15
 ; AVX1-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX1-NEXT:    je LBB6_34
-; AVX1-NEXT:  LBB6_33: ## %cond.store46
+; AVX1-NEXT:  LBB6_33: ## %cond.store16
 ; AVX1-NEXT:    vmovss %xmm2, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX1-NEXT:    je LBB6_36
-; AVX1-NEXT:  LBB6_35: ## %cond.store49
+; AVX1-NEXT:  LBB6_35: ## %cond.store17
 ; AVX1-NEXT:    vextractps $1, %xmm2, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX1-NEXT:    je LBB6_38
-; AVX1-NEXT:  LBB6_37: ## %cond.store52
+; AVX1-NEXT:  LBB6_37: ## %cond.store18
 ; AVX1-NEXT:    vextractps $2, %xmm2, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX1-NEXT:    jne LBB6_39
 ; AVX1-NEXT:    jmp LBB6_40
-; AVX1-NEXT:  LBB6_41: ## %cond.store58
+; AVX1-NEXT:  LBB6_41: ## %cond.store20
 ; AVX1-NEXT:    vmovss %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX1-NEXT:    je LBB6_44
-; AVX1-NEXT:  LBB6_43: ## %cond.store61
+; AVX1-NEXT:  LBB6_43: ## %cond.store21
 ; AVX1-NEXT:    vextractps $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX1-NEXT:    je LBB6_46
-; AVX1-NEXT:  LBB6_45: ## %cond.store64
+; AVX1-NEXT:  LBB6_45: ## %cond.store22
 ; AVX1-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX1-NEXT:    je LBB6_48
-; AVX1-NEXT:  LBB6_47: ## %cond.store67
+; AVX1-NEXT:  LBB6_47: ## %cond.store23
 ; AVX1-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX1-NEXT:    je LBB6_50
-; AVX1-NEXT:  LBB6_49: ## %cond.store70
+; AVX1-NEXT:  LBB6_49: ## %cond.store24
 ; AVX1-NEXT:    vmovss %xmm3, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX1-NEXT:    je LBB6_52
-; AVX1-NEXT:  LBB6_51: ## %cond.store73
+; AVX1-NEXT:  LBB6_51: ## %cond.store25
 ; AVX1-NEXT:    vextractps $1, %xmm3, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX1-NEXT:    je LBB6_54
-; AVX1-NEXT:  LBB6_53: ## %cond.store76
+; AVX1-NEXT:  LBB6_53: ## %cond.store26
 ; AVX1-NEXT:    vextractps $2, %xmm3, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX1-NEXT:    jne LBB6_55
 ; AVX1-NEXT:    jmp LBB6_56
-; AVX1-NEXT:  LBB6_57: ## %cond.store82
+; AVX1-NEXT:  LBB6_57: ## %cond.store28
 ; AVX1-NEXT:    vmovss %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX1-NEXT:    je LBB6_60
-; AVX1-NEXT:  LBB6_59: ## %cond.store85
+; AVX1-NEXT:  LBB6_59: ## %cond.store29
 ; AVX1-NEXT:    vextractps $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX1-NEXT:    je LBB6_62
-; AVX1-NEXT:  LBB6_61: ## %cond.store88
+; AVX1-NEXT:  LBB6_61: ## %cond.store30
 ; AVX1-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $4, %rdi
 ; AVX1-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX1-NEXT:    je LBB6_64
-; AVX1-NEXT:  LBB6_63: ## %cond.store91
+; AVX1-NEXT:  LBB6_63: ## %cond.store31
 ; AVX1-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
@@ -2174,113 +2174,113 @@ define void @compressstore_v32f32_v32i32(float* %base, <32 x float> %V, <32 x i3
 ; AVX2-NEXT:  ## %bb.2: ## %else
 ; AVX2-NEXT:    testb $2, %al
 ; AVX2-NEXT:    jne LBB6_3
-; AVX2-NEXT:  LBB6_4: ## %else2
+; AVX2-NEXT:  LBB6_4: ## %else1
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    jne LBB6_5
-; AVX2-NEXT:  LBB6_6: ## %else5
+; AVX2-NEXT:  LBB6_6: ## %else2
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    je LBB6_8
-; AVX2-NEXT:  LBB6_7: ## %cond.store7
+; AVX2-NEXT:  LBB6_7: ## %cond.store3
 ; AVX2-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
-; AVX2-NEXT:  LBB6_8: ## %else8
+; AVX2-NEXT:  LBB6_8: ## %else3
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    vextractf128 $1, %ymm0, %xmm0
 ; AVX2-NEXT:    jne LBB6_9
-; AVX2-NEXT:  ## %bb.10: ## %else11
+; AVX2-NEXT:  ## %bb.10: ## %else4
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    jne LBB6_11
-; AVX2-NEXT:  LBB6_12: ## %else14
+; AVX2-NEXT:  LBB6_12: ## %else5
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    jne LBB6_13
-; AVX2-NEXT:  LBB6_14: ## %else17
+; AVX2-NEXT:  LBB6_14: ## %else6
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    jne LBB6_15
-; AVX2-NEXT:  LBB6_16: ## %else20
+; AVX2-NEXT:  LBB6_16: ## %else7
 ; AVX2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX2-NEXT:    jne LBB6_17
-; AVX2-NEXT:  LBB6_18: ## %else23
+; AVX2-NEXT:  LBB6_18: ## %else8
 ; AVX2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX2-NEXT:    jne LBB6_19
-; AVX2-NEXT:  LBB6_20: ## %else26
+; AVX2-NEXT:  LBB6_20: ## %else9
 ; AVX2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX2-NEXT:    jne LBB6_21
-; AVX2-NEXT:  LBB6_22: ## %else29
+; AVX2-NEXT:  LBB6_22: ## %else10
 ; AVX2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX2-NEXT:    je LBB6_24
-; AVX2-NEXT:  LBB6_23: ## %cond.store31
+; AVX2-NEXT:  LBB6_23: ## %cond.store11
 ; AVX2-NEXT:    vextractps $3, %xmm1, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
-; AVX2-NEXT:  LBB6_24: ## %else32
+; AVX2-NEXT:  LBB6_24: ## %else11
 ; AVX2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX2-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    jne LBB6_25
-; AVX2-NEXT:  ## %bb.26: ## %else35
+; AVX2-NEXT:  ## %bb.26: ## %else12
 ; AVX2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX2-NEXT:    jne LBB6_27
-; AVX2-NEXT:  LBB6_28: ## %else38
+; AVX2-NEXT:  LBB6_28: ## %else13
 ; AVX2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX2-NEXT:    jne LBB6_29
-; AVX2-NEXT:  LBB6_30: ## %else41
+; AVX2-NEXT:  LBB6_30: ## %else14
 ; AVX2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX2-NEXT:    jne LBB6_31
-; AVX2-NEXT:  LBB6_32: ## %else44
+; AVX2-NEXT:  LBB6_32: ## %else15
 ; AVX2-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX2-NEXT:    jne LBB6_33
-; AVX2-NEXT:  LBB6_34: ## %else47
+; AVX2-NEXT:  LBB6_34: ## %else16
 ; AVX2-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX2-NEXT:    jne LBB6_35
-; AVX2-NEXT:  LBB6_36: ## %else50
+; AVX2-NEXT:  LBB6_36: ## %else17
 ; AVX2-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX2-NEXT:    jne LBB6_37
-; AVX2-NEXT:  LBB6_38: ## %else53
+; AVX2-NEXT:  LBB6_38: ## %else18
 ; AVX2-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX2-NEXT:    je LBB6_40
-; AVX2-NEXT:  LBB6_39: ## %cond.store55
+; AVX2-NEXT:  LBB6_39: ## %cond.store19
 ; AVX2-NEXT:    vextractps $3, %xmm2, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
-; AVX2-NEXT:  LBB6_40: ## %else56
+; AVX2-NEXT:  LBB6_40: ## %else19
 ; AVX2-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX2-NEXT:    vextractf128 $1, %ymm2, %xmm0
 ; AVX2-NEXT:    jne LBB6_41
-; AVX2-NEXT:  ## %bb.42: ## %else59
+; AVX2-NEXT:  ## %bb.42: ## %else20
 ; AVX2-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX2-NEXT:    jne LBB6_43
-; AVX2-NEXT:  LBB6_44: ## %else62
+; AVX2-NEXT:  LBB6_44: ## %else21
 ; AVX2-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX2-NEXT:    jne LBB6_45
-; AVX2-NEXT:  LBB6_46: ## %else65
+; AVX2-NEXT:  LBB6_46: ## %else22
 ; AVX2-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX2-NEXT:    jne LBB6_47
-; AVX2-NEXT:  LBB6_48: ## %else68
+; AVX2-NEXT:  LBB6_48: ## %else23
 ; AVX2-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX2-NEXT:    jne LBB6_49
-; AVX2-NEXT:  LBB6_50: ## %else71
+; AVX2-NEXT:  LBB6_50: ## %else24
 ; AVX2-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX2-NEXT:    jne LBB6_51
-; AVX2-NEXT:  LBB6_52: ## %else74
+; AVX2-NEXT:  LBB6_52: ## %else25
 ; AVX2-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX2-NEXT:    jne LBB6_53
-; AVX2-NEXT:  LBB6_54: ## %else77
+; AVX2-NEXT:  LBB6_54: ## %else26
 ; AVX2-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX2-NEXT:    je LBB6_56
-; AVX2-NEXT:  LBB6_55: ## %cond.store79
+; AVX2-NEXT:  LBB6_55: ## %cond.store27
 ; AVX2-NEXT:    vextractps $3, %xmm3, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
-; AVX2-NEXT:  LBB6_56: ## %else80
+; AVX2-NEXT:  LBB6_56: ## %else27
 ; AVX2-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX2-NEXT:    vextractf128 $1, %ymm3, %xmm0
 ; AVX2-NEXT:    jne LBB6_57
-; AVX2-NEXT:  ## %bb.58: ## %else83
+; AVX2-NEXT:  ## %bb.58: ## %else28
 ; AVX2-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX2-NEXT:    jne LBB6_59
-; AVX2-NEXT:  LBB6_60: ## %else86
+; AVX2-NEXT:  LBB6_60: ## %else29
 ; AVX2-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX2-NEXT:    jne LBB6_61
-; AVX2-NEXT:  LBB6_62: ## %else89
+; AVX2-NEXT:  LBB6_62: ## %else30
 ; AVX2-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX2-NEXT:    jne LBB6_63
-; AVX2-NEXT:  LBB6_64: ## %else92
+; AVX2-NEXT:  LBB6_64: ## %else31
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
 ; AVX2-NEXT:  LBB6_1: ## %cond.store
@@ -2293,136 +2293,136 @@ define void @compressstore_v32f32_v32i32(float* %base, <32 x float> %V, <32 x i3
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    je LBB6_6
-; AVX2-NEXT:  LBB6_5: ## %cond.store4
+; AVX2-NEXT:  LBB6_5: ## %cond.store2
 ; AVX2-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    jne LBB6_7
 ; AVX2-NEXT:    jmp LBB6_8
-; AVX2-NEXT:  LBB6_9: ## %cond.store10
+; AVX2-NEXT:  LBB6_9: ## %cond.store4
 ; AVX2-NEXT:    vmovss %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    je LBB6_12
-; AVX2-NEXT:  LBB6_11: ## %cond.store13
+; AVX2-NEXT:  LBB6_11: ## %cond.store5
 ; AVX2-NEXT:    vextractps $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    je LBB6_14
-; AVX2-NEXT:  LBB6_13: ## %cond.store16
+; AVX2-NEXT:  LBB6_13: ## %cond.store6
 ; AVX2-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    je LBB6_16
-; AVX2-NEXT:  LBB6_15: ## %cond.store19
+; AVX2-NEXT:  LBB6_15: ## %cond.store7
 ; AVX2-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX2-NEXT:    je LBB6_18
-; AVX2-NEXT:  LBB6_17: ## %cond.store22
+; AVX2-NEXT:  LBB6_17: ## %cond.store8
 ; AVX2-NEXT:    vmovss %xmm1, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX2-NEXT:    je LBB6_20
-; AVX2-NEXT:  LBB6_19: ## %cond.store25
+; AVX2-NEXT:  LBB6_19: ## %cond.store9
 ; AVX2-NEXT:    vextractps $1, %xmm1, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX2-NEXT:    je LBB6_22
-; AVX2-NEXT:  LBB6_21: ## %cond.store28
+; AVX2-NEXT:  LBB6_21: ## %cond.store10
 ; AVX2-NEXT:    vextractps $2, %xmm1, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX2-NEXT:    jne LBB6_23
 ; AVX2-NEXT:    jmp LBB6_24
-; AVX2-NEXT:  LBB6_25: ## %cond.store34
+; AVX2-NEXT:  LBB6_25: ## %cond.store12
 ; AVX2-NEXT:    vmovss %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX2-NEXT:    je LBB6_28
-; AVX2-NEXT:  LBB6_27: ## %cond.store37
+; AVX2-NEXT:  LBB6_27: ## %cond.store13
 ; AVX2-NEXT:    vextractps $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX2-NEXT:    je LBB6_30
-; AVX2-NEXT:  LBB6_29: ## %cond.store40
+; AVX2-NEXT:  LBB6_29: ## %cond.store14
 ; AVX2-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX2-NEXT:    je LBB6_32
-; AVX2-NEXT:  LBB6_31: ## %cond.store43
+; AVX2-NEXT:  LBB6_31: ## %cond.store15
 ; AVX2-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX2-NEXT:    je LBB6_34
-; AVX2-NEXT:  LBB6_33: ## %cond.store46
+; AVX2-NEXT:  LBB6_33: ## %cond.store16
 ; AVX2-NEXT:    vmovss %xmm2, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX2-NEXT:    je LBB6_36
-; AVX2-NEXT:  LBB6_35: ## %cond.store49
+; AVX2-NEXT:  LBB6_35: ## %cond.store17
 ; AVX2-NEXT:    vextractps $1, %xmm2, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX2-NEXT:    je LBB6_38
-; AVX2-NEXT:  LBB6_37: ## %cond.store52
+; AVX2-NEXT:  LBB6_37: ## %cond.store18
 ; AVX2-NEXT:    vextractps $2, %xmm2, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX2-NEXT:    jne LBB6_39
 ; AVX2-NEXT:    jmp LBB6_40
-; AVX2-NEXT:  LBB6_41: ## %cond.store58
+; AVX2-NEXT:  LBB6_41: ## %cond.store20
 ; AVX2-NEXT:    vmovss %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX2-NEXT:    je LBB6_44
-; AVX2-NEXT:  LBB6_43: ## %cond.store61
+; AVX2-NEXT:  LBB6_43: ## %cond.store21
 ; AVX2-NEXT:    vextractps $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX2-NEXT:    je LBB6_46
-; AVX2-NEXT:  LBB6_45: ## %cond.store64
+; AVX2-NEXT:  LBB6_45: ## %cond.store22
 ; AVX2-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX2-NEXT:    je LBB6_48
-; AVX2-NEXT:  LBB6_47: ## %cond.store67
+; AVX2-NEXT:  LBB6_47: ## %cond.store23
 ; AVX2-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX2-NEXT:    je LBB6_50
-; AVX2-NEXT:  LBB6_49: ## %cond.store70
+; AVX2-NEXT:  LBB6_49: ## %cond.store24
 ; AVX2-NEXT:    vmovss %xmm3, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX2-NEXT:    je LBB6_52
-; AVX2-NEXT:  LBB6_51: ## %cond.store73
+; AVX2-NEXT:  LBB6_51: ## %cond.store25
 ; AVX2-NEXT:    vextractps $1, %xmm3, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX2-NEXT:    je LBB6_54
-; AVX2-NEXT:  LBB6_53: ## %cond.store76
+; AVX2-NEXT:  LBB6_53: ## %cond.store26
 ; AVX2-NEXT:    vextractps $2, %xmm3, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX2-NEXT:    jne LBB6_55
 ; AVX2-NEXT:    jmp LBB6_56
-; AVX2-NEXT:  LBB6_57: ## %cond.store82
+; AVX2-NEXT:  LBB6_57: ## %cond.store28
 ; AVX2-NEXT:    vmovss %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX2-NEXT:    je LBB6_60
-; AVX2-NEXT:  LBB6_59: ## %cond.store85
+; AVX2-NEXT:  LBB6_59: ## %cond.store29
 ; AVX2-NEXT:    vextractps $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX2-NEXT:    je LBB6_62
-; AVX2-NEXT:  LBB6_61: ## %cond.store88
+; AVX2-NEXT:  LBB6_61: ## %cond.store30
 ; AVX2-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $4, %rdi
 ; AVX2-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX2-NEXT:    je LBB6_64
-; AVX2-NEXT:  LBB6_63: ## %cond.store91
+; AVX2-NEXT:  LBB6_63: ## %cond.store31
 ; AVX2-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
@@ -2470,7 +2470,7 @@ define void @compressstore_v2i64_v2i1(i64* %base, <2 x i64> %V, <2 x i1> %mask)
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB7_3
-; SSE2-NEXT:  LBB7_4: ## %else2
+; SSE2-NEXT:  LBB7_4: ## %else1
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB7_1: ## %cond.store
 ; SSE2-NEXT:    movq %xmm0, (%rdi)
@@ -2491,7 +2491,7 @@ define void @compressstore_v2i64_v2i1(i64* %base, <2 x i64> %V, <2 x i1> %mask)
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB7_3
-; SSE42-NEXT:  LBB7_4: ## %else2
+; SSE42-NEXT:  LBB7_4: ## %else1
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB7_1: ## %cond.store
 ; SSE42-NEXT:    movq %xmm0, (%rdi)
@@ -2511,7 +2511,7 @@ define void @compressstore_v2i64_v2i1(i64* %base, <2 x i64> %V, <2 x i1> %mask)
 ; AVX1OR2-NEXT:  ## %bb.2: ## %else
 ; AVX1OR2-NEXT:    testb $2, %al
 ; AVX1OR2-NEXT:    jne LBB7_3
-; AVX1OR2-NEXT:  LBB7_4: ## %else2
+; AVX1OR2-NEXT:  LBB7_4: ## %else1
 ; AVX1OR2-NEXT:    retq
 ; AVX1OR2-NEXT:  LBB7_1: ## %cond.store
 ; AVX1OR2-NEXT:    vmovq %xmm0, (%rdi)
@@ -2560,13 +2560,13 @@ define void @compressstore_v4i64_v4i1(i64* %base, <4 x i64> %V, <4 x i1> %mask)
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB8_3
-; SSE2-NEXT:  LBB8_4: ## %else2
+; SSE2-NEXT:  LBB8_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB8_5
-; SSE2-NEXT:  LBB8_6: ## %else5
+; SSE2-NEXT:  LBB8_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB8_7
-; SSE2-NEXT:  LBB8_8: ## %else8
+; SSE2-NEXT:  LBB8_8: ## %else3
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB8_1: ## %cond.store
 ; SSE2-NEXT:    movq %xmm0, (%rdi)
@@ -2579,12 +2579,12 @@ define void @compressstore_v4i64_v4i1(i64* %base, <4 x i64> %V, <4 x i1> %mask)
 ; SSE2-NEXT:    addq $8, %rdi
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB8_6
-; SSE2-NEXT:  LBB8_5: ## %cond.store4
+; SSE2-NEXT:  LBB8_5: ## %cond.store2
 ; SSE2-NEXT:    movq %xmm1, (%rdi)
 ; SSE2-NEXT:    addq $8, %rdi
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB8_8
-; SSE2-NEXT:  LBB8_7: ## %cond.store7
+; SSE2-NEXT:  LBB8_7: ## %cond.store3
 ; SSE2-NEXT:    pshufd {{.*#+}} xmm0 = xmm1[2,3,0,1]
 ; SSE2-NEXT:    movq %xmm0, (%rdi)
 ; SSE2-NEXT:    retq
@@ -2598,13 +2598,13 @@ define void @compressstore_v4i64_v4i1(i64* %base, <4 x i64> %V, <4 x i1> %mask)
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB8_3
-; SSE42-NEXT:  LBB8_4: ## %else2
+; SSE42-NEXT:  LBB8_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB8_5
-; SSE42-NEXT:  LBB8_6: ## %else5
+; SSE42-NEXT:  LBB8_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB8_7
-; SSE42-NEXT:  LBB8_8: ## %else8
+; SSE42-NEXT:  LBB8_8: ## %else3
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB8_1: ## %cond.store
 ; SSE42-NEXT:    movq %xmm0, (%rdi)
@@ -2616,12 +2616,12 @@ define void @compressstore_v4i64_v4i1(i64* %base, <4 x i64> %V, <4 x i1> %mask)
 ; SSE42-NEXT:    addq $8, %rdi
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB8_6
-; SSE42-NEXT:  LBB8_5: ## %cond.store4
+; SSE42-NEXT:  LBB8_5: ## %cond.store2
 ; SSE42-NEXT:    movq %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $8, %rdi
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB8_8
-; SSE42-NEXT:  LBB8_7: ## %cond.store7
+; SSE42-NEXT:  LBB8_7: ## %cond.store3
 ; SSE42-NEXT:    pextrq $1, %xmm1, (%rdi)
 ; SSE42-NEXT:    retq
 ;
@@ -2640,22 +2640,22 @@ define void @compressstore_v4i64_v4i1(i64* %base, <4 x i64> %V, <4 x i1> %mask)
 ; AVX1-NEXT:  ## %bb.3: ## %cond.store1
 ; AVX1-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
-; AVX1-NEXT:  LBB8_4: ## %else2
+; AVX1-NEXT:  LBB8_4: ## %else1
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    vextractf128 $1, %ymm0, %xmm0
 ; AVX1-NEXT:    jne LBB8_5
-; AVX1-NEXT:  ## %bb.6: ## %else5
+; AVX1-NEXT:  ## %bb.6: ## %else2
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    jne LBB8_7
-; AVX1-NEXT:  LBB8_8: ## %else8
+; AVX1-NEXT:  LBB8_8: ## %else3
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
-; AVX1-NEXT:  LBB8_5: ## %cond.store4
+; AVX1-NEXT:  LBB8_5: ## %cond.store2
 ; AVX1-NEXT:    vmovq %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    je LBB8_8
-; AVX1-NEXT:  LBB8_7: ## %cond.store7
+; AVX1-NEXT:  LBB8_7: ## %cond.store3
 ; AVX1-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
@@ -2675,22 +2675,22 @@ define void @compressstore_v4i64_v4i1(i64* %base, <4 x i64> %V, <4 x i1> %mask)
 ; AVX2-NEXT:  ## %bb.3: ## %cond.store1
 ; AVX2-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
-; AVX2-NEXT:  LBB8_4: ## %else2
+; AVX2-NEXT:  LBB8_4: ## %else1
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    vextracti128 $1, %ymm0, %xmm0
 ; AVX2-NEXT:    jne LBB8_5
-; AVX2-NEXT:  ## %bb.6: ## %else5
+; AVX2-NEXT:  ## %bb.6: ## %else2
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    jne LBB8_7
-; AVX2-NEXT:  LBB8_8: ## %else8
+; AVX2-NEXT:  LBB8_8: ## %else3
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
-; AVX2-NEXT:  LBB8_5: ## %cond.store4
+; AVX2-NEXT:  LBB8_5: ## %cond.store2
 ; AVX2-NEXT:    vmovq %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    je LBB8_8
-; AVX2-NEXT:  LBB8_7: ## %cond.store7
+; AVX2-NEXT:  LBB8_7: ## %cond.store3
 ; AVX2-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
@@ -2736,25 +2736,25 @@ define void @compressstore_v8i64_v8i1(i64* %base, <8 x i64> %V, <8 x i1> %mask)
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB9_3
-; SSE2-NEXT:  LBB9_4: ## %else2
+; SSE2-NEXT:  LBB9_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB9_5
-; SSE2-NEXT:  LBB9_6: ## %else5
+; SSE2-NEXT:  LBB9_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB9_7
-; SSE2-NEXT:  LBB9_8: ## %else8
+; SSE2-NEXT:  LBB9_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB9_9
-; SSE2-NEXT:  LBB9_10: ## %else11
+; SSE2-NEXT:  LBB9_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB9_11
-; SSE2-NEXT:  LBB9_12: ## %else14
+; SSE2-NEXT:  LBB9_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB9_13
-; SSE2-NEXT:  LBB9_14: ## %else17
+; SSE2-NEXT:  LBB9_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB9_15
-; SSE2-NEXT:  LBB9_16: ## %else20
+; SSE2-NEXT:  LBB9_16: ## %else7
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB9_1: ## %cond.store
 ; SSE2-NEXT:    movq %xmm0, (%rdi)
@@ -2767,34 +2767,34 @@ define void @compressstore_v8i64_v8i1(i64* %base, <8 x i64> %V, <8 x i1> %mask)
 ; SSE2-NEXT:    addq $8, %rdi
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB9_6
-; SSE2-NEXT:  LBB9_5: ## %cond.store4
+; SSE2-NEXT:  LBB9_5: ## %cond.store2
 ; SSE2-NEXT:    movq %xmm1, (%rdi)
 ; SSE2-NEXT:    addq $8, %rdi
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB9_8
-; SSE2-NEXT:  LBB9_7: ## %cond.store7
+; SSE2-NEXT:  LBB9_7: ## %cond.store3
 ; SSE2-NEXT:    pshufd {{.*#+}} xmm0 = xmm1[2,3,0,1]
 ; SSE2-NEXT:    movq %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $8, %rdi
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB9_10
-; SSE2-NEXT:  LBB9_9: ## %cond.store10
+; SSE2-NEXT:  LBB9_9: ## %cond.store4
 ; SSE2-NEXT:    movq %xmm2, (%rdi)
 ; SSE2-NEXT:    addq $8, %rdi
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB9_12
-; SSE2-NEXT:  LBB9_11: ## %cond.store13
+; SSE2-NEXT:  LBB9_11: ## %cond.store5
 ; SSE2-NEXT:    pshufd {{.*#+}} xmm0 = xmm2[2,3,0,1]
 ; SSE2-NEXT:    movq %xmm0, (%rdi)
 ; SSE2-NEXT:    addq $8, %rdi
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB9_14
-; SSE2-NEXT:  LBB9_13: ## %cond.store16
+; SSE2-NEXT:  LBB9_13: ## %cond.store6
 ; SSE2-NEXT:    movq %xmm3, (%rdi)
 ; SSE2-NEXT:    addq $8, %rdi
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB9_16
-; SSE2-NEXT:  LBB9_15: ## %cond.store19
+; SSE2-NEXT:  LBB9_15: ## %cond.store7
 ; SSE2-NEXT:    pshufd {{.*#+}} xmm0 = xmm3[2,3,0,1]
 ; SSE2-NEXT:    movq %xmm0, (%rdi)
 ; SSE2-NEXT:    retq
@@ -2809,25 +2809,25 @@ define void @compressstore_v8i64_v8i1(i64* %base, <8 x i64> %V, <8 x i1> %mask)
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB9_3
-; SSE42-NEXT:  LBB9_4: ## %else2
+; SSE42-NEXT:  LBB9_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB9_5
-; SSE42-NEXT:  LBB9_6: ## %else5
+; SSE42-NEXT:  LBB9_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB9_7
-; SSE42-NEXT:  LBB9_8: ## %else8
+; SSE42-NEXT:  LBB9_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB9_9
-; SSE42-NEXT:  LBB9_10: ## %else11
+; SSE42-NEXT:  LBB9_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB9_11
-; SSE42-NEXT:  LBB9_12: ## %else14
+; SSE42-NEXT:  LBB9_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB9_13
-; SSE42-NEXT:  LBB9_14: ## %else17
+; SSE42-NEXT:  LBB9_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB9_15
-; SSE42-NEXT:  LBB9_16: ## %else20
+; SSE42-NEXT:  LBB9_16: ## %else7
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB9_1: ## %cond.store
 ; SSE42-NEXT:    movq %xmm0, (%rdi)
@@ -2839,32 +2839,32 @@ define void @compressstore_v8i64_v8i1(i64* %base, <8 x i64> %V, <8 x i1> %mask)
 ; SSE42-NEXT:    addq $8, %rdi
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB9_6
-; SSE42-NEXT:  LBB9_5: ## %cond.store4
+; SSE42-NEXT:  LBB9_5: ## %cond.store2
 ; SSE42-NEXT:    movq %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $8, %rdi
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB9_8
-; SSE42-NEXT:  LBB9_7: ## %cond.store7
+; SSE42-NEXT:  LBB9_7: ## %cond.store3
 ; SSE42-NEXT:    pextrq $1, %xmm1, (%rdi)
 ; SSE42-NEXT:    addq $8, %rdi
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB9_10
-; SSE42-NEXT:  LBB9_9: ## %cond.store10
+; SSE42-NEXT:  LBB9_9: ## %cond.store4
 ; SSE42-NEXT:    movq %xmm2, (%rdi)
 ; SSE42-NEXT:    addq $8, %rdi
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB9_12
-; SSE42-NEXT:  LBB9_11: ## %cond.store13
+; SSE42-NEXT:  LBB9_11: ## %cond.store5
 ; SSE42-NEXT:    pextrq $1, %xmm2, (%rdi)
 ; SSE42-NEXT:    addq $8, %rdi
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB9_14
-; SSE42-NEXT:  LBB9_13: ## %cond.store16
+; SSE42-NEXT:  LBB9_13: ## %cond.store6
 ; SSE42-NEXT:    movq %xmm3, (%rdi)
 ; SSE42-NEXT:    addq $8, %rdi
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB9_16
-; SSE42-NEXT:  LBB9_15: ## %cond.store19
+; SSE42-NEXT:  LBB9_15: ## %cond.store7
 ; SSE42-NEXT:    pextrq $1, %xmm3, (%rdi)
 ; SSE42-NEXT:    retq
 ;
@@ -2884,54 +2884,54 @@ define void @compressstore_v8i64_v8i1(i64* %base, <8 x i64> %V, <8 x i1> %mask)
 ; AVX1-NEXT:  ## %bb.3: ## %cond.store1
 ; AVX1-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
-; AVX1-NEXT:  LBB9_4: ## %else2
+; AVX1-NEXT:  LBB9_4: ## %else1
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    vextractf128 $1, %ymm0, %xmm0
 ; AVX1-NEXT:    jne LBB9_5
-; AVX1-NEXT:  ## %bb.6: ## %else5
+; AVX1-NEXT:  ## %bb.6: ## %else2
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    jne LBB9_7
-; AVX1-NEXT:  LBB9_8: ## %else8
+; AVX1-NEXT:  LBB9_8: ## %else3
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    jne LBB9_9
-; AVX1-NEXT:  LBB9_10: ## %else11
+; AVX1-NEXT:  LBB9_10: ## %else4
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    je LBB9_12
-; AVX1-NEXT:  LBB9_11: ## %cond.store13
+; AVX1-NEXT:  LBB9_11: ## %cond.store5
 ; AVX1-NEXT:    vpextrq $1, %xmm1, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
-; AVX1-NEXT:  LBB9_12: ## %else14
+; AVX1-NEXT:  LBB9_12: ## %else5
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    jne LBB9_13
-; AVX1-NEXT:  ## %bb.14: ## %else17
+; AVX1-NEXT:  ## %bb.14: ## %else6
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    jne LBB9_15
-; AVX1-NEXT:  LBB9_16: ## %else20
+; AVX1-NEXT:  LBB9_16: ## %else7
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
-; AVX1-NEXT:  LBB9_5: ## %cond.store4
+; AVX1-NEXT:  LBB9_5: ## %cond.store2
 ; AVX1-NEXT:    vmovq %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    je LBB9_8
-; AVX1-NEXT:  LBB9_7: ## %cond.store7
+; AVX1-NEXT:  LBB9_7: ## %cond.store3
 ; AVX1-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    je LBB9_10
-; AVX1-NEXT:  LBB9_9: ## %cond.store10
+; AVX1-NEXT:  LBB9_9: ## %cond.store4
 ; AVX1-NEXT:    vmovq %xmm1, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    jne LBB9_11
 ; AVX1-NEXT:    jmp LBB9_12
-; AVX1-NEXT:  LBB9_13: ## %cond.store16
+; AVX1-NEXT:  LBB9_13: ## %cond.store6
 ; AVX1-NEXT:    vmovq %xmm0, (%rdi)
 ; AVX1-NEXT:    addq $8, %rdi
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    je LBB9_16
-; AVX1-NEXT:  LBB9_15: ## %cond.store19
+; AVX1-NEXT:  LBB9_15: ## %cond.store7
 ; AVX1-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX1-NEXT:    vzeroupper
 ; AVX1-NEXT:    retq
@@ -2952,54 +2952,54 @@ define void @compressstore_v8i64_v8i1(i64* %base, <8 x i64> %V, <8 x i1> %mask)
 ; AVX2-NEXT:  ## %bb.3: ## %cond.store1
 ; AVX2-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
-; AVX2-NEXT:  LBB9_4: ## %else2
+; AVX2-NEXT:  LBB9_4: ## %else1
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    vextracti128 $1, %ymm0, %xmm0
 ; AVX2-NEXT:    jne LBB9_5
-; AVX2-NEXT:  ## %bb.6: ## %else5
+; AVX2-NEXT:  ## %bb.6: ## %else2
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    jne LBB9_7
-; AVX2-NEXT:  LBB9_8: ## %else8
+; AVX2-NEXT:  LBB9_8: ## %else3
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    jne LBB9_9
-; AVX2-NEXT:  LBB9_10: ## %else11
+; AVX2-NEXT:  LBB9_10: ## %else4
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    je LBB9_12
-; AVX2-NEXT:  LBB9_11: ## %cond.store13
+; AVX2-NEXT:  LBB9_11: ## %cond.store5
 ; AVX2-NEXT:    vpextrq $1, %xmm1, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
-; AVX2-NEXT:  LBB9_12: ## %else14
+; AVX2-NEXT:  LBB9_12: ## %else5
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    jne LBB9_13
-; AVX2-NEXT:  ## %bb.14: ## %else17
+; AVX2-NEXT:  ## %bb.14: ## %else6
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    jne LBB9_15
-; AVX2-NEXT:  LBB9_16: ## %else20
+; AVX2-NEXT:  LBB9_16: ## %else7
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
-; AVX2-NEXT:  LBB9_5: ## %cond.store4
+; AVX2-NEXT:  LBB9_5: ## %cond.store2
 ; AVX2-NEXT:    vmovq %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    je LBB9_8
-; AVX2-NEXT:  LBB9_7: ## %cond.store7
+; AVX2-NEXT:  LBB9_7: ## %cond.store3
 ; AVX2-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    je LBB9_10
-; AVX2-NEXT:  LBB9_9: ## %cond.store10
+; AVX2-NEXT:  LBB9_9: ## %cond.store4
 ; AVX2-NEXT:    vmovq %xmm1, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    jne LBB9_11
 ; AVX2-NEXT:    jmp LBB9_12
-; AVX2-NEXT:  LBB9_13: ## %cond.store16
+; AVX2-NEXT:  LBB9_13: ## %cond.store6
 ; AVX2-NEXT:    vmovq %xmm0, (%rdi)
 ; AVX2-NEXT:    addq $8, %rdi
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    je LBB9_16
-; AVX2-NEXT:  LBB9_15: ## %cond.store19
+; AVX2-NEXT:  LBB9_15: ## %cond.store7
 ; AVX2-NEXT:    vpextrq $1, %xmm0, (%rdi)
 ; AVX2-NEXT:    vzeroupper
 ; AVX2-NEXT:    retq
@@ -3048,13 +3048,13 @@ define void @compressstore_v4i32_v4i32(i32* %base, <4 x i32> %V, <4 x i32> %trig
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB10_3
-; SSE2-NEXT:  LBB10_4: ## %else2
+; SSE2-NEXT:  LBB10_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB10_5
-; SSE2-NEXT:  LBB10_6: ## %else5
+; SSE2-NEXT:  LBB10_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB10_7
-; SSE2-NEXT:  LBB10_8: ## %else8
+; SSE2-NEXT:  LBB10_8: ## %else3
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB10_1: ## %cond.store
 ; SSE2-NEXT:    movd %xmm0, (%rdi)
@@ -3067,13 +3067,13 @@ define void @compressstore_v4i32_v4i32(i32* %base, <4 x i32> %V, <4 x i32> %trig
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB10_6
-; SSE2-NEXT:  LBB10_5: ## %cond.store4
+; SSE2-NEXT:  LBB10_5: ## %cond.store2
 ; SSE2-NEXT:    pshufd {{.*#+}} xmm1 = xmm0[2,3,0,1]
 ; SSE2-NEXT:    movd %xmm1, (%rdi)
 ; SSE2-NEXT:    addq $4, %rdi
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB10_8
-; SSE2-NEXT:  LBB10_7: ## %cond.store7
+; SSE2-NEXT:  LBB10_7: ## %cond.store3
 ; SSE2-NEXT:    pshufd {{.*#+}} xmm0 = xmm0[3,1,2,3]
 ; SSE2-NEXT:    movd %xmm0, (%rdi)
 ; SSE2-NEXT:    retq
@@ -3088,13 +3088,13 @@ define void @compressstore_v4i32_v4i32(i32* %base, <4 x i32> %V, <4 x i32> %trig
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB10_3
-; SSE42-NEXT:  LBB10_4: ## %else2
+; SSE42-NEXT:  LBB10_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB10_5
-; SSE42-NEXT:  LBB10_6: ## %else5
+; SSE42-NEXT:  LBB10_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB10_7
-; SSE42-NEXT:  LBB10_8: ## %else8
+; SSE42-NEXT:  LBB10_8: ## %else3
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB10_1: ## %cond.store
 ; SSE42-NEXT:    movss %xmm0, (%rdi)
@@ -3106,12 +3106,12 @@ define void @compressstore_v4i32_v4i32(i32* %base, <4 x i32> %V, <4 x i32> %trig
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB10_6
-; SSE42-NEXT:  LBB10_5: ## %cond.store4
+; SSE42-NEXT:  LBB10_5: ## %cond.store2
 ; SSE42-NEXT:    extractps $2, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $4, %rdi
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB10_8
-; SSE42-NEXT:  LBB10_7: ## %cond.store7
+; SSE42-NEXT:  LBB10_7: ## %cond.store3
 ; SSE42-NEXT:    extractps $3, %xmm0, (%rdi)
 ; SSE42-NEXT:    retq
 ;
@@ -3125,13 +3125,13 @@ define void @compressstore_v4i32_v4i32(i32* %base, <4 x i32> %V, <4 x i32> %trig
 ; AVX1OR2-NEXT:  ## %bb.2: ## %else
 ; AVX1OR2-NEXT:    testb $2, %al
 ; AVX1OR2-NEXT:    jne LBB10_3
-; AVX1OR2-NEXT:  LBB10_4: ## %else2
+; AVX1OR2-NEXT:  LBB10_4: ## %else1
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    jne LBB10_5
-; AVX1OR2-NEXT:  LBB10_6: ## %else5
+; AVX1OR2-NEXT:  LBB10_6: ## %else2
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    jne LBB10_7
-; AVX1OR2-NEXT:  LBB10_8: ## %else8
+; AVX1OR2-NEXT:  LBB10_8: ## %else3
 ; AVX1OR2-NEXT:    retq
 ; AVX1OR2-NEXT:  LBB10_1: ## %cond.store
 ; AVX1OR2-NEXT:    vmovss %xmm0, (%rdi)
@@ -3143,12 +3143,12 @@ define void @compressstore_v4i32_v4i32(i32* %base, <4 x i32> %V, <4 x i32> %trig
 ; AVX1OR2-NEXT:    addq $4, %rdi
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    je LBB10_6
-; AVX1OR2-NEXT:  LBB10_5: ## %cond.store4
+; AVX1OR2-NEXT:  LBB10_5: ## %cond.store2
 ; AVX1OR2-NEXT:    vextractps $2, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $4, %rdi
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    je LBB10_8
-; AVX1OR2-NEXT:  LBB10_7: ## %cond.store7
+; AVX1OR2-NEXT:  LBB10_7: ## %cond.store3
 ; AVX1OR2-NEXT:    vextractps $3, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    retq
 ;
@@ -3189,25 +3189,25 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB11_3
-; SSE2-NEXT:  LBB11_4: ## %else2
+; SSE2-NEXT:  LBB11_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB11_5
-; SSE2-NEXT:  LBB11_6: ## %else5
+; SSE2-NEXT:  LBB11_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB11_7
-; SSE2-NEXT:  LBB11_8: ## %else8
+; SSE2-NEXT:  LBB11_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB11_9
-; SSE2-NEXT:  LBB11_10: ## %else11
+; SSE2-NEXT:  LBB11_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB11_11
-; SSE2-NEXT:  LBB11_12: ## %else14
+; SSE2-NEXT:  LBB11_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB11_13
-; SSE2-NEXT:  LBB11_14: ## %else17
+; SSE2-NEXT:  LBB11_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB11_15
-; SSE2-NEXT:  LBB11_16: ## %else20
+; SSE2-NEXT:  LBB11_16: ## %else7
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB11_1: ## %cond.store
 ; SSE2-NEXT:    movd %xmm0, %ecx
@@ -3221,37 +3221,37 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; SSE2-NEXT:    addq $2, %rdi
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB11_6
-; SSE2-NEXT:  LBB11_5: ## %cond.store4
+; SSE2-NEXT:  LBB11_5: ## %cond.store2
 ; SSE2-NEXT:    pextrw $2, %xmm0, %ecx
 ; SSE2-NEXT:    movw %cx, (%rdi)
 ; SSE2-NEXT:    addq $2, %rdi
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB11_8
-; SSE2-NEXT:  LBB11_7: ## %cond.store7
+; SSE2-NEXT:  LBB11_7: ## %cond.store3
 ; SSE2-NEXT:    pextrw $3, %xmm0, %ecx
 ; SSE2-NEXT:    movw %cx, (%rdi)
 ; SSE2-NEXT:    addq $2, %rdi
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB11_10
-; SSE2-NEXT:  LBB11_9: ## %cond.store10
+; SSE2-NEXT:  LBB11_9: ## %cond.store4
 ; SSE2-NEXT:    pextrw $4, %xmm0, %ecx
 ; SSE2-NEXT:    movw %cx, (%rdi)
 ; SSE2-NEXT:    addq $2, %rdi
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB11_12
-; SSE2-NEXT:  LBB11_11: ## %cond.store13
+; SSE2-NEXT:  LBB11_11: ## %cond.store5
 ; SSE2-NEXT:    pextrw $5, %xmm0, %ecx
 ; SSE2-NEXT:    movw %cx, (%rdi)
 ; SSE2-NEXT:    addq $2, %rdi
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB11_14
-; SSE2-NEXT:  LBB11_13: ## %cond.store16
+; SSE2-NEXT:  LBB11_13: ## %cond.store6
 ; SSE2-NEXT:    pextrw $6, %xmm0, %ecx
 ; SSE2-NEXT:    movw %cx, (%rdi)
 ; SSE2-NEXT:    addq $2, %rdi
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB11_16
-; SSE2-NEXT:  LBB11_15: ## %cond.store19
+; SSE2-NEXT:  LBB11_15: ## %cond.store7
 ; SSE2-NEXT:    pextrw $7, %xmm0, %eax
 ; SSE2-NEXT:    movw %ax, (%rdi)
 ; SSE2-NEXT:    retq
@@ -3267,25 +3267,25 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB11_3
-; SSE42-NEXT:  LBB11_4: ## %else2
+; SSE42-NEXT:  LBB11_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB11_5
-; SSE42-NEXT:  LBB11_6: ## %else5
+; SSE42-NEXT:  LBB11_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB11_7
-; SSE42-NEXT:  LBB11_8: ## %else8
+; SSE42-NEXT:  LBB11_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB11_9
-; SSE42-NEXT:  LBB11_10: ## %else11
+; SSE42-NEXT:  LBB11_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB11_11
-; SSE42-NEXT:  LBB11_12: ## %else14
+; SSE42-NEXT:  LBB11_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB11_13
-; SSE42-NEXT:  LBB11_14: ## %else17
+; SSE42-NEXT:  LBB11_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB11_15
-; SSE42-NEXT:  LBB11_16: ## %else20
+; SSE42-NEXT:  LBB11_16: ## %else7
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB11_1: ## %cond.store
 ; SSE42-NEXT:    pextrw $0, %xmm0, (%rdi)
@@ -3297,32 +3297,32 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; SSE42-NEXT:    addq $2, %rdi
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB11_6
-; SSE42-NEXT:  LBB11_5: ## %cond.store4
+; SSE42-NEXT:  LBB11_5: ## %cond.store2
 ; SSE42-NEXT:    pextrw $2, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $2, %rdi
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB11_8
-; SSE42-NEXT:  LBB11_7: ## %cond.store7
+; SSE42-NEXT:  LBB11_7: ## %cond.store3
 ; SSE42-NEXT:    pextrw $3, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $2, %rdi
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB11_10
-; SSE42-NEXT:  LBB11_9: ## %cond.store10
+; SSE42-NEXT:  LBB11_9: ## %cond.store4
 ; SSE42-NEXT:    pextrw $4, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $2, %rdi
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB11_12
-; SSE42-NEXT:  LBB11_11: ## %cond.store13
+; SSE42-NEXT:  LBB11_11: ## %cond.store5
 ; SSE42-NEXT:    pextrw $5, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $2, %rdi
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB11_14
-; SSE42-NEXT:  LBB11_13: ## %cond.store16
+; SSE42-NEXT:  LBB11_13: ## %cond.store6
 ; SSE42-NEXT:    pextrw $6, %xmm0, (%rdi)
 ; SSE42-NEXT:    addq $2, %rdi
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB11_16
-; SSE42-NEXT:  LBB11_15: ## %cond.store19
+; SSE42-NEXT:  LBB11_15: ## %cond.store7
 ; SSE42-NEXT:    pextrw $7, %xmm0, (%rdi)
 ; SSE42-NEXT:    retq
 ;
@@ -3337,25 +3337,25 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; AVX1OR2-NEXT:  ## %bb.2: ## %else
 ; AVX1OR2-NEXT:    testb $2, %al
 ; AVX1OR2-NEXT:    jne LBB11_3
-; AVX1OR2-NEXT:  LBB11_4: ## %else2
+; AVX1OR2-NEXT:  LBB11_4: ## %else1
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    jne LBB11_5
-; AVX1OR2-NEXT:  LBB11_6: ## %else5
+; AVX1OR2-NEXT:  LBB11_6: ## %else2
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    jne LBB11_7
-; AVX1OR2-NEXT:  LBB11_8: ## %else8
+; AVX1OR2-NEXT:  LBB11_8: ## %else3
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    jne LBB11_9
-; AVX1OR2-NEXT:  LBB11_10: ## %else11
+; AVX1OR2-NEXT:  LBB11_10: ## %else4
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    jne LBB11_11
-; AVX1OR2-NEXT:  LBB11_12: ## %else14
+; AVX1OR2-NEXT:  LBB11_12: ## %else5
 ; AVX1OR2-NEXT:    testb $64, %al
 ; AVX1OR2-NEXT:    jne LBB11_13
-; AVX1OR2-NEXT:  LBB11_14: ## %else17
+; AVX1OR2-NEXT:  LBB11_14: ## %else6
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    jne LBB11_15
-; AVX1OR2-NEXT:  LBB11_16: ## %else20
+; AVX1OR2-NEXT:  LBB11_16: ## %else7
 ; AVX1OR2-NEXT:    retq
 ; AVX1OR2-NEXT:  LBB11_1: ## %cond.store
 ; AVX1OR2-NEXT:    vpextrw $0, %xmm0, (%rdi)
@@ -3367,32 +3367,32 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; AVX1OR2-NEXT:    addq $2, %rdi
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    je LBB11_6
-; AVX1OR2-NEXT:  LBB11_5: ## %cond.store4
+; AVX1OR2-NEXT:  LBB11_5: ## %cond.store2
 ; AVX1OR2-NEXT:    vpextrw $2, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $2, %rdi
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    je LBB11_8
-; AVX1OR2-NEXT:  LBB11_7: ## %cond.store7
+; AVX1OR2-NEXT:  LBB11_7: ## %cond.store3
 ; AVX1OR2-NEXT:    vpextrw $3, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $2, %rdi
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    je LBB11_10
-; AVX1OR2-NEXT:  LBB11_9: ## %cond.store10
+; AVX1OR2-NEXT:  LBB11_9: ## %cond.store4
 ; AVX1OR2-NEXT:    vpextrw $4, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $2, %rdi
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    je LBB11_12
-; AVX1OR2-NEXT:  LBB11_11: ## %cond.store13
+; AVX1OR2-NEXT:  LBB11_11: ## %cond.store5
 ; AVX1OR2-NEXT:    vpextrw $5, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $2, %rdi
 ; AVX1OR2-NEXT:    testb $64, %al
 ; AVX1OR2-NEXT:    je LBB11_14
-; AVX1OR2-NEXT:  LBB11_13: ## %cond.store16
+; AVX1OR2-NEXT:  LBB11_13: ## %cond.store6
 ; AVX1OR2-NEXT:    vpextrw $6, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    addq $2, %rdi
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    je LBB11_16
-; AVX1OR2-NEXT:  LBB11_15: ## %cond.store19
+; AVX1OR2-NEXT:  LBB11_15: ## %cond.store7
 ; AVX1OR2-NEXT:    vpextrw $7, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    retq
 ;
@@ -3408,25 +3408,25 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; AVX512F-NEXT:  ## %bb.2: ## %else
 ; AVX512F-NEXT:    testb $2, %al
 ; AVX512F-NEXT:    jne LBB11_3
-; AVX512F-NEXT:  LBB11_4: ## %else2
+; AVX512F-NEXT:  LBB11_4: ## %else1
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    jne LBB11_5
-; AVX512F-NEXT:  LBB11_6: ## %else5
+; AVX512F-NEXT:  LBB11_6: ## %else2
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    jne LBB11_7
-; AVX512F-NEXT:  LBB11_8: ## %else8
+; AVX512F-NEXT:  LBB11_8: ## %else3
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    jne LBB11_9
-; AVX512F-NEXT:  LBB11_10: ## %else11
+; AVX512F-NEXT:  LBB11_10: ## %else4
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    jne LBB11_11
-; AVX512F-NEXT:  LBB11_12: ## %else14
+; AVX512F-NEXT:  LBB11_12: ## %else5
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    jne LBB11_13
-; AVX512F-NEXT:  LBB11_14: ## %else17
+; AVX512F-NEXT:  LBB11_14: ## %else6
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    jne LBB11_15
-; AVX512F-NEXT:  LBB11_16: ## %else20
+; AVX512F-NEXT:  LBB11_16: ## %else7
 ; AVX512F-NEXT:    vzeroupper
 ; AVX512F-NEXT:    retq
 ; AVX512F-NEXT:  LBB11_1: ## %cond.store
@@ -3439,32 +3439,32 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; AVX512F-NEXT:    addq $2, %rdi
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    je LBB11_6
-; AVX512F-NEXT:  LBB11_5: ## %cond.store4
+; AVX512F-NEXT:  LBB11_5: ## %cond.store2
 ; AVX512F-NEXT:    vpextrw $2, %xmm0, (%rdi)
 ; AVX512F-NEXT:    addq $2, %rdi
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    je LBB11_8
-; AVX512F-NEXT:  LBB11_7: ## %cond.store7
+; AVX512F-NEXT:  LBB11_7: ## %cond.store3
 ; AVX512F-NEXT:    vpextrw $3, %xmm0, (%rdi)
 ; AVX512F-NEXT:    addq $2, %rdi
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    je LBB11_10
-; AVX512F-NEXT:  LBB11_9: ## %cond.store10
+; AVX512F-NEXT:  LBB11_9: ## %cond.store4
 ; AVX512F-NEXT:    vpextrw $4, %xmm0, (%rdi)
 ; AVX512F-NEXT:    addq $2, %rdi
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    je LBB11_12
-; AVX512F-NEXT:  LBB11_11: ## %cond.store13
+; AVX512F-NEXT:  LBB11_11: ## %cond.store5
 ; AVX512F-NEXT:    vpextrw $5, %xmm0, (%rdi)
 ; AVX512F-NEXT:    addq $2, %rdi
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    je LBB11_14
-; AVX512F-NEXT:  LBB11_13: ## %cond.store16
+; AVX512F-NEXT:  LBB11_13: ## %cond.store6
 ; AVX512F-NEXT:    vpextrw $6, %xmm0, (%rdi)
 ; AVX512F-NEXT:    addq $2, %rdi
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    je LBB11_16
-; AVX512F-NEXT:  LBB11_15: ## %cond.store19
+; AVX512F-NEXT:  LBB11_15: ## %cond.store7
 ; AVX512F-NEXT:    vpextrw $7, %xmm0, (%rdi)
 ; AVX512F-NEXT:    vzeroupper
 ; AVX512F-NEXT:    retq
@@ -3481,25 +3481,25 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; AVX512VLDQ-NEXT:  ## %bb.2: ## %else
 ; AVX512VLDQ-NEXT:    testb $2, %al
 ; AVX512VLDQ-NEXT:    jne LBB11_3
-; AVX512VLDQ-NEXT:  LBB11_4: ## %else2
+; AVX512VLDQ-NEXT:  LBB11_4: ## %else1
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    jne LBB11_5
-; AVX512VLDQ-NEXT:  LBB11_6: ## %else5
+; AVX512VLDQ-NEXT:  LBB11_6: ## %else2
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    jne LBB11_7
-; AVX512VLDQ-NEXT:  LBB11_8: ## %else8
+; AVX512VLDQ-NEXT:  LBB11_8: ## %else3
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    jne LBB11_9
-; AVX512VLDQ-NEXT:  LBB11_10: ## %else11
+; AVX512VLDQ-NEXT:  LBB11_10: ## %else4
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    jne LBB11_11
-; AVX512VLDQ-NEXT:  LBB11_12: ## %else14
+; AVX512VLDQ-NEXT:  LBB11_12: ## %else5
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    jne LBB11_13
-; AVX512VLDQ-NEXT:  LBB11_14: ## %else17
+; AVX512VLDQ-NEXT:  LBB11_14: ## %else6
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    jne LBB11_15
-; AVX512VLDQ-NEXT:  LBB11_16: ## %else20
+; AVX512VLDQ-NEXT:  LBB11_16: ## %else7
 ; AVX512VLDQ-NEXT:    vzeroupper
 ; AVX512VLDQ-NEXT:    retq
 ; AVX512VLDQ-NEXT:  LBB11_1: ## %cond.store
@@ -3512,32 +3512,32 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; AVX512VLDQ-NEXT:    addq $2, %rdi
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    je LBB11_6
-; AVX512VLDQ-NEXT:  LBB11_5: ## %cond.store4
+; AVX512VLDQ-NEXT:  LBB11_5: ## %cond.store2
 ; AVX512VLDQ-NEXT:    vpextrw $2, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    addq $2, %rdi
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    je LBB11_8
-; AVX512VLDQ-NEXT:  LBB11_7: ## %cond.store7
+; AVX512VLDQ-NEXT:  LBB11_7: ## %cond.store3
 ; AVX512VLDQ-NEXT:    vpextrw $3, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    addq $2, %rdi
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    je LBB11_10
-; AVX512VLDQ-NEXT:  LBB11_9: ## %cond.store10
+; AVX512VLDQ-NEXT:  LBB11_9: ## %cond.store4
 ; AVX512VLDQ-NEXT:    vpextrw $4, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    addq $2, %rdi
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    je LBB11_12
-; AVX512VLDQ-NEXT:  LBB11_11: ## %cond.store13
+; AVX512VLDQ-NEXT:  LBB11_11: ## %cond.store5
 ; AVX512VLDQ-NEXT:    vpextrw $5, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    addq $2, %rdi
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    je LBB11_14
-; AVX512VLDQ-NEXT:  LBB11_13: ## %cond.store16
+; AVX512VLDQ-NEXT:  LBB11_13: ## %cond.store6
 ; AVX512VLDQ-NEXT:    vpextrw $6, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    addq $2, %rdi
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    je LBB11_16
-; AVX512VLDQ-NEXT:  LBB11_15: ## %cond.store19
+; AVX512VLDQ-NEXT:  LBB11_15: ## %cond.store7
 ; AVX512VLDQ-NEXT:    vpextrw $7, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    vzeroupper
 ; AVX512VLDQ-NEXT:    retq
@@ -3551,25 +3551,25 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; AVX512VLBW-NEXT:  ## %bb.2: ## %else
 ; AVX512VLBW-NEXT:    testb $2, %al
 ; AVX512VLBW-NEXT:    jne LBB11_3
-; AVX512VLBW-NEXT:  LBB11_4: ## %else2
+; AVX512VLBW-NEXT:  LBB11_4: ## %else1
 ; AVX512VLBW-NEXT:    testb $4, %al
 ; AVX512VLBW-NEXT:    jne LBB11_5
-; AVX512VLBW-NEXT:  LBB11_6: ## %else5
+; AVX512VLBW-NEXT:  LBB11_6: ## %else2
 ; AVX512VLBW-NEXT:    testb $8, %al
 ; AVX512VLBW-NEXT:    jne LBB11_7
-; AVX512VLBW-NEXT:  LBB11_8: ## %else8
+; AVX512VLBW-NEXT:  LBB11_8: ## %else3
 ; AVX512VLBW-NEXT:    testb $16, %al
 ; AVX512VLBW-NEXT:    jne LBB11_9
-; AVX512VLBW-NEXT:  LBB11_10: ## %else11
+; AVX512VLBW-NEXT:  LBB11_10: ## %else4
 ; AVX512VLBW-NEXT:    testb $32, %al
 ; AVX512VLBW-NEXT:    jne LBB11_11
-; AVX512VLBW-NEXT:  LBB11_12: ## %else14
+; AVX512VLBW-NEXT:  LBB11_12: ## %else5
 ; AVX512VLBW-NEXT:    testb $64, %al
 ; AVX512VLBW-NEXT:    jne LBB11_13
-; AVX512VLBW-NEXT:  LBB11_14: ## %else17
+; AVX512VLBW-NEXT:  LBB11_14: ## %else6
 ; AVX512VLBW-NEXT:    testb $-128, %al
 ; AVX512VLBW-NEXT:    jne LBB11_15
-; AVX512VLBW-NEXT:  LBB11_16: ## %else20
+; AVX512VLBW-NEXT:  LBB11_16: ## %else7
 ; AVX512VLBW-NEXT:    retq
 ; AVX512VLBW-NEXT:  LBB11_1: ## %cond.store
 ; AVX512VLBW-NEXT:    vpextrw $0, %xmm0, (%rdi)
@@ -3581,32 +3581,32 @@ define void @compressstore_v8i16_v8i16(i16* %base, <8 x i16> %V, <8 x i16> %trig
 ; AVX512VLBW-NEXT:    addq $2, %rdi
 ; AVX512VLBW-NEXT:    testb $4, %al
 ; AVX512VLBW-NEXT:    je LBB11_6
-; AVX512VLBW-NEXT:  LBB11_5: ## %cond.store4
+; AVX512VLBW-NEXT:  LBB11_5: ## %cond.store2
 ; AVX512VLBW-NEXT:    vpextrw $2, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    addq $2, %rdi
 ; AVX512VLBW-NEXT:    testb $8, %al
 ; AVX512VLBW-NEXT:    je LBB11_8
-; AVX512VLBW-NEXT:  LBB11_7: ## %cond.store7
+; AVX512VLBW-NEXT:  LBB11_7: ## %cond.store3
 ; AVX512VLBW-NEXT:    vpextrw $3, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    addq $2, %rdi
 ; AVX512VLBW-NEXT:    testb $16, %al
 ; AVX512VLBW-NEXT:    je LBB11_10
-; AVX512VLBW-NEXT:  LBB11_9: ## %cond.store10
+; AVX512VLBW-NEXT:  LBB11_9: ## %cond.store4
 ; AVX512VLBW-NEXT:    vpextrw $4, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    addq $2, %rdi
 ; AVX512VLBW-NEXT:    testb $32, %al
 ; AVX512VLBW-NEXT:    je LBB11_12
-; AVX512VLBW-NEXT:  LBB11_11: ## %cond.store13
+; AVX512VLBW-NEXT:  LBB11_11: ## %cond.store5
 ; AVX512VLBW-NEXT:    vpextrw $5, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    addq $2, %rdi
 ; AVX512VLBW-NEXT:    testb $64, %al
 ; AVX512VLBW-NEXT:    je LBB11_14
-; AVX512VLBW-NEXT:  LBB11_13: ## %cond.store16
+; AVX512VLBW-NEXT:  LBB11_13: ## %cond.store6
 ; AVX512VLBW-NEXT:    vpextrw $6, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    addq $2, %rdi
 ; AVX512VLBW-NEXT:    testb $-128, %al
 ; AVX512VLBW-NEXT:    je LBB11_16
-; AVX512VLBW-NEXT:  LBB11_15: ## %cond.store19
+; AVX512VLBW-NEXT:  LBB11_15: ## %cond.store7
 ; AVX512VLBW-NEXT:    vpextrw $7, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    retq
   %mask = icmp eq <8 x i16> %trigger, zeroinitializer
@@ -3630,89 +3630,89 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB12_3
-; SSE2-NEXT:  LBB12_4: ## %else2
+; SSE2-NEXT:  LBB12_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB12_5
-; SSE2-NEXT:  LBB12_6: ## %else5
+; SSE2-NEXT:  LBB12_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB12_8
-; SSE2-NEXT:  LBB12_7: ## %cond.store7
+; SSE2-NEXT:  LBB12_7: ## %cond.store3
 ; SSE2-NEXT:    shrl $24, %ecx
 ; SSE2-NEXT:    movb %cl, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_8: ## %else8
+; SSE2-NEXT:  LBB12_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    pextrw $2, %xmm0, %ecx
 ; SSE2-NEXT:    je LBB12_10
-; SSE2-NEXT:  ## %bb.9: ## %cond.store10
+; SSE2-NEXT:  ## %bb.9: ## %cond.store4
 ; SSE2-NEXT:    movb %cl, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_10: ## %else11
+; SSE2-NEXT:  LBB12_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB12_12
-; SSE2-NEXT:  ## %bb.11: ## %cond.store13
+; SSE2-NEXT:  ## %bb.11: ## %cond.store5
 ; SSE2-NEXT:    movb %ch, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_12: ## %else14
+; SSE2-NEXT:  LBB12_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    pextrw $3, %xmm0, %ecx
 ; SSE2-NEXT:    je LBB12_14
-; SSE2-NEXT:  ## %bb.13: ## %cond.store16
+; SSE2-NEXT:  ## %bb.13: ## %cond.store6
 ; SSE2-NEXT:    movb %cl, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_14: ## %else17
+; SSE2-NEXT:  LBB12_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB12_16
-; SSE2-NEXT:  ## %bb.15: ## %cond.store19
+; SSE2-NEXT:  ## %bb.15: ## %cond.store7
 ; SSE2-NEXT:    movb %ch, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_16: ## %else20
+; SSE2-NEXT:  LBB12_16: ## %else7
 ; SSE2-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE2-NEXT:    pextrw $4, %xmm0, %ecx
 ; SSE2-NEXT:    je LBB12_18
-; SSE2-NEXT:  ## %bb.17: ## %cond.store22
+; SSE2-NEXT:  ## %bb.17: ## %cond.store8
 ; SSE2-NEXT:    movb %cl, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_18: ## %else23
+; SSE2-NEXT:  LBB12_18: ## %else8
 ; SSE2-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE2-NEXT:    je LBB12_20
-; SSE2-NEXT:  ## %bb.19: ## %cond.store25
+; SSE2-NEXT:  ## %bb.19: ## %cond.store9
 ; SSE2-NEXT:    movb %ch, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_20: ## %else26
+; SSE2-NEXT:  LBB12_20: ## %else9
 ; SSE2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE2-NEXT:    pextrw $5, %xmm0, %ecx
 ; SSE2-NEXT:    je LBB12_22
-; SSE2-NEXT:  ## %bb.21: ## %cond.store28
+; SSE2-NEXT:  ## %bb.21: ## %cond.store10
 ; SSE2-NEXT:    movb %cl, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_22: ## %else29
+; SSE2-NEXT:  LBB12_22: ## %else10
 ; SSE2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE2-NEXT:    je LBB12_24
-; SSE2-NEXT:  ## %bb.23: ## %cond.store31
+; SSE2-NEXT:  ## %bb.23: ## %cond.store11
 ; SSE2-NEXT:    movb %ch, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_24: ## %else32
+; SSE2-NEXT:  LBB12_24: ## %else11
 ; SSE2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE2-NEXT:    pextrw $6, %xmm0, %ecx
 ; SSE2-NEXT:    je LBB12_26
-; SSE2-NEXT:  ## %bb.25: ## %cond.store34
+; SSE2-NEXT:  ## %bb.25: ## %cond.store12
 ; SSE2-NEXT:    movb %cl, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_26: ## %else35
+; SSE2-NEXT:  LBB12_26: ## %else12
 ; SSE2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE2-NEXT:    je LBB12_28
-; SSE2-NEXT:  ## %bb.27: ## %cond.store37
+; SSE2-NEXT:  ## %bb.27: ## %cond.store13
 ; SSE2-NEXT:    movb %ch, (%rdi)
 ; SSE2-NEXT:    incq %rdi
-; SSE2-NEXT:  LBB12_28: ## %else38
+; SSE2-NEXT:  LBB12_28: ## %else13
 ; SSE2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE2-NEXT:    pextrw $7, %xmm0, %ecx
 ; SSE2-NEXT:    jne LBB12_29
-; SSE2-NEXT:  ## %bb.30: ## %else41
+; SSE2-NEXT:  ## %bb.30: ## %else14
 ; SSE2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE2-NEXT:    jne LBB12_31
-; SSE2-NEXT:  LBB12_32: ## %else44
+; SSE2-NEXT:  LBB12_32: ## %else15
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB12_1: ## %cond.store
 ; SSE2-NEXT:    movb %cl, (%rdi)
@@ -3724,7 +3724,7 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; SSE2-NEXT:    incq %rdi
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB12_6
-; SSE2-NEXT:  LBB12_5: ## %cond.store4
+; SSE2-NEXT:  LBB12_5: ## %cond.store2
 ; SSE2-NEXT:    movl %ecx, %edx
 ; SSE2-NEXT:    shrl $16, %edx
 ; SSE2-NEXT:    movb %dl, (%rdi)
@@ -3732,12 +3732,12 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB12_7
 ; SSE2-NEXT:    jmp LBB12_8
-; SSE2-NEXT:  LBB12_29: ## %cond.store40
+; SSE2-NEXT:  LBB12_29: ## %cond.store14
 ; SSE2-NEXT:    movb %cl, (%rdi)
 ; SSE2-NEXT:    incq %rdi
 ; SSE2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE2-NEXT:    je LBB12_32
-; SSE2-NEXT:  LBB12_31: ## %cond.store43
+; SSE2-NEXT:  LBB12_31: ## %cond.store15
 ; SSE2-NEXT:    movb %ch, (%rdi)
 ; SSE2-NEXT:    retq
 ;
@@ -3751,49 +3751,49 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB12_3
-; SSE42-NEXT:  LBB12_4: ## %else2
+; SSE42-NEXT:  LBB12_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB12_5
-; SSE42-NEXT:  LBB12_6: ## %else5
+; SSE42-NEXT:  LBB12_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB12_7
-; SSE42-NEXT:  LBB12_8: ## %else8
+; SSE42-NEXT:  LBB12_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB12_9
-; SSE42-NEXT:  LBB12_10: ## %else11
+; SSE42-NEXT:  LBB12_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB12_11
-; SSE42-NEXT:  LBB12_12: ## %else14
+; SSE42-NEXT:  LBB12_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB12_13
-; SSE42-NEXT:  LBB12_14: ## %else17
+; SSE42-NEXT:  LBB12_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB12_15
-; SSE42-NEXT:  LBB12_16: ## %else20
+; SSE42-NEXT:  LBB12_16: ## %else7
 ; SSE42-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE42-NEXT:    jne LBB12_17
-; SSE42-NEXT:  LBB12_18: ## %else23
+; SSE42-NEXT:  LBB12_18: ## %else8
 ; SSE42-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE42-NEXT:    jne LBB12_19
-; SSE42-NEXT:  LBB12_20: ## %else26
+; SSE42-NEXT:  LBB12_20: ## %else9
 ; SSE42-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE42-NEXT:    jne LBB12_21
-; SSE42-NEXT:  LBB12_22: ## %else29
+; SSE42-NEXT:  LBB12_22: ## %else10
 ; SSE42-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE42-NEXT:    jne LBB12_23
-; SSE42-NEXT:  LBB12_24: ## %else32
+; SSE42-NEXT:  LBB12_24: ## %else11
 ; SSE42-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE42-NEXT:    jne LBB12_25
-; SSE42-NEXT:  LBB12_26: ## %else35
+; SSE42-NEXT:  LBB12_26: ## %else12
 ; SSE42-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE42-NEXT:    jne LBB12_27
-; SSE42-NEXT:  LBB12_28: ## %else38
+; SSE42-NEXT:  LBB12_28: ## %else13
 ; SSE42-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE42-NEXT:    jne LBB12_29
-; SSE42-NEXT:  LBB12_30: ## %else41
+; SSE42-NEXT:  LBB12_30: ## %else14
 ; SSE42-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE42-NEXT:    jne LBB12_31
-; SSE42-NEXT:  LBB12_32: ## %else44
+; SSE42-NEXT:  LBB12_32: ## %else15
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB12_1: ## %cond.store
 ; SSE42-NEXT:    pextrb $0, %xmm0, (%rdi)
@@ -3805,72 +3805,72 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB12_6
-; SSE42-NEXT:  LBB12_5: ## %cond.store4
+; SSE42-NEXT:  LBB12_5: ## %cond.store2
 ; SSE42-NEXT:    pextrb $2, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB12_8
-; SSE42-NEXT:  LBB12_7: ## %cond.store7
+; SSE42-NEXT:  LBB12_7: ## %cond.store3
 ; SSE42-NEXT:    pextrb $3, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB12_10
-; SSE42-NEXT:  LBB12_9: ## %cond.store10
+; SSE42-NEXT:  LBB12_9: ## %cond.store4
 ; SSE42-NEXT:    pextrb $4, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB12_12
-; SSE42-NEXT:  LBB12_11: ## %cond.store13
+; SSE42-NEXT:  LBB12_11: ## %cond.store5
 ; SSE42-NEXT:    pextrb $5, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB12_14
-; SSE42-NEXT:  LBB12_13: ## %cond.store16
+; SSE42-NEXT:  LBB12_13: ## %cond.store6
 ; SSE42-NEXT:    pextrb $6, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB12_16
-; SSE42-NEXT:  LBB12_15: ## %cond.store19
+; SSE42-NEXT:  LBB12_15: ## %cond.store7
 ; SSE42-NEXT:    pextrb $7, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE42-NEXT:    je LBB12_18
-; SSE42-NEXT:  LBB12_17: ## %cond.store22
+; SSE42-NEXT:  LBB12_17: ## %cond.store8
 ; SSE42-NEXT:    pextrb $8, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE42-NEXT:    je LBB12_20
-; SSE42-NEXT:  LBB12_19: ## %cond.store25
+; SSE42-NEXT:  LBB12_19: ## %cond.store9
 ; SSE42-NEXT:    pextrb $9, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE42-NEXT:    je LBB12_22
-; SSE42-NEXT:  LBB12_21: ## %cond.store28
+; SSE42-NEXT:  LBB12_21: ## %cond.store10
 ; SSE42-NEXT:    pextrb $10, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE42-NEXT:    je LBB12_24
-; SSE42-NEXT:  LBB12_23: ## %cond.store31
+; SSE42-NEXT:  LBB12_23: ## %cond.store11
 ; SSE42-NEXT:    pextrb $11, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE42-NEXT:    je LBB12_26
-; SSE42-NEXT:  LBB12_25: ## %cond.store34
+; SSE42-NEXT:  LBB12_25: ## %cond.store12
 ; SSE42-NEXT:    pextrb $12, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE42-NEXT:    je LBB12_28
-; SSE42-NEXT:  LBB12_27: ## %cond.store37
+; SSE42-NEXT:  LBB12_27: ## %cond.store13
 ; SSE42-NEXT:    pextrb $13, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE42-NEXT:    je LBB12_30
-; SSE42-NEXT:  LBB12_29: ## %cond.store40
+; SSE42-NEXT:  LBB12_29: ## %cond.store14
 ; SSE42-NEXT:    pextrb $14, %xmm0, (%rdi)
 ; SSE42-NEXT:    incq %rdi
 ; SSE42-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE42-NEXT:    je LBB12_32
-; SSE42-NEXT:  LBB12_31: ## %cond.store43
+; SSE42-NEXT:  LBB12_31: ## %cond.store15
 ; SSE42-NEXT:    pextrb $15, %xmm0, (%rdi)
 ; SSE42-NEXT:    retq
 ;
@@ -3884,49 +3884,49 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; AVX1OR2-NEXT:  ## %bb.2: ## %else
 ; AVX1OR2-NEXT:    testb $2, %al
 ; AVX1OR2-NEXT:    jne LBB12_3
-; AVX1OR2-NEXT:  LBB12_4: ## %else2
+; AVX1OR2-NEXT:  LBB12_4: ## %else1
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    jne LBB12_5
-; AVX1OR2-NEXT:  LBB12_6: ## %else5
+; AVX1OR2-NEXT:  LBB12_6: ## %else2
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    jne LBB12_7
-; AVX1OR2-NEXT:  LBB12_8: ## %else8
+; AVX1OR2-NEXT:  LBB12_8: ## %else3
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    jne LBB12_9
-; AVX1OR2-NEXT:  LBB12_10: ## %else11
+; AVX1OR2-NEXT:  LBB12_10: ## %else4
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    jne LBB12_11
-; AVX1OR2-NEXT:  LBB12_12: ## %else14
+; AVX1OR2-NEXT:  LBB12_12: ## %else5
 ; AVX1OR2-NEXT:    testb $64, %al
 ; AVX1OR2-NEXT:    jne LBB12_13
-; AVX1OR2-NEXT:  LBB12_14: ## %else17
+; AVX1OR2-NEXT:  LBB12_14: ## %else6
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    jne LBB12_15
-; AVX1OR2-NEXT:  LBB12_16: ## %else20
+; AVX1OR2-NEXT:  LBB12_16: ## %else7
 ; AVX1OR2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1OR2-NEXT:    jne LBB12_17
-; AVX1OR2-NEXT:  LBB12_18: ## %else23
+; AVX1OR2-NEXT:  LBB12_18: ## %else8
 ; AVX1OR2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1OR2-NEXT:    jne LBB12_19
-; AVX1OR2-NEXT:  LBB12_20: ## %else26
+; AVX1OR2-NEXT:  LBB12_20: ## %else9
 ; AVX1OR2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1OR2-NEXT:    jne LBB12_21
-; AVX1OR2-NEXT:  LBB12_22: ## %else29
+; AVX1OR2-NEXT:  LBB12_22: ## %else10
 ; AVX1OR2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1OR2-NEXT:    jne LBB12_23
-; AVX1OR2-NEXT:  LBB12_24: ## %else32
+; AVX1OR2-NEXT:  LBB12_24: ## %else11
 ; AVX1OR2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1OR2-NEXT:    jne LBB12_25
-; AVX1OR2-NEXT:  LBB12_26: ## %else35
+; AVX1OR2-NEXT:  LBB12_26: ## %else12
 ; AVX1OR2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1OR2-NEXT:    jne LBB12_27
-; AVX1OR2-NEXT:  LBB12_28: ## %else38
+; AVX1OR2-NEXT:  LBB12_28: ## %else13
 ; AVX1OR2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1OR2-NEXT:    jne LBB12_29
-; AVX1OR2-NEXT:  LBB12_30: ## %else41
+; AVX1OR2-NEXT:  LBB12_30: ## %else14
 ; AVX1OR2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1OR2-NEXT:    jne LBB12_31
-; AVX1OR2-NEXT:  LBB12_32: ## %else44
+; AVX1OR2-NEXT:  LBB12_32: ## %else15
 ; AVX1OR2-NEXT:    retq
 ; AVX1OR2-NEXT:  LBB12_1: ## %cond.store
 ; AVX1OR2-NEXT:    vpextrb $0, %xmm0, (%rdi)
@@ -3938,72 +3938,72 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    je LBB12_6
-; AVX1OR2-NEXT:  LBB12_5: ## %cond.store4
+; AVX1OR2-NEXT:  LBB12_5: ## %cond.store2
 ; AVX1OR2-NEXT:    vpextrb $2, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    je LBB12_8
-; AVX1OR2-NEXT:  LBB12_7: ## %cond.store7
+; AVX1OR2-NEXT:  LBB12_7: ## %cond.store3
 ; AVX1OR2-NEXT:    vpextrb $3, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    je LBB12_10
-; AVX1OR2-NEXT:  LBB12_9: ## %cond.store10
+; AVX1OR2-NEXT:  LBB12_9: ## %cond.store4
 ; AVX1OR2-NEXT:    vpextrb $4, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    je LBB12_12
-; AVX1OR2-NEXT:  LBB12_11: ## %cond.store13
+; AVX1OR2-NEXT:  LBB12_11: ## %cond.store5
 ; AVX1OR2-NEXT:    vpextrb $5, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testb $64, %al
 ; AVX1OR2-NEXT:    je LBB12_14
-; AVX1OR2-NEXT:  LBB12_13: ## %cond.store16
+; AVX1OR2-NEXT:  LBB12_13: ## %cond.store6
 ; AVX1OR2-NEXT:    vpextrb $6, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    je LBB12_16
-; AVX1OR2-NEXT:  LBB12_15: ## %cond.store19
+; AVX1OR2-NEXT:  LBB12_15: ## %cond.store7
 ; AVX1OR2-NEXT:    vpextrb $7, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1OR2-NEXT:    je LBB12_18
-; AVX1OR2-NEXT:  LBB12_17: ## %cond.store22
+; AVX1OR2-NEXT:  LBB12_17: ## %cond.store8
 ; AVX1OR2-NEXT:    vpextrb $8, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1OR2-NEXT:    je LBB12_20
-; AVX1OR2-NEXT:  LBB12_19: ## %cond.store25
+; AVX1OR2-NEXT:  LBB12_19: ## %cond.store9
 ; AVX1OR2-NEXT:    vpextrb $9, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1OR2-NEXT:    je LBB12_22
-; AVX1OR2-NEXT:  LBB12_21: ## %cond.store28
+; AVX1OR2-NEXT:  LBB12_21: ## %cond.store10
 ; AVX1OR2-NEXT:    vpextrb $10, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1OR2-NEXT:    je LBB12_24
-; AVX1OR2-NEXT:  LBB12_23: ## %cond.store31
+; AVX1OR2-NEXT:  LBB12_23: ## %cond.store11
 ; AVX1OR2-NEXT:    vpextrb $11, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1OR2-NEXT:    je LBB12_26
-; AVX1OR2-NEXT:  LBB12_25: ## %cond.store34
+; AVX1OR2-NEXT:  LBB12_25: ## %cond.store12
 ; AVX1OR2-NEXT:    vpextrb $12, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1OR2-NEXT:    je LBB12_28
-; AVX1OR2-NEXT:  LBB12_27: ## %cond.store37
+; AVX1OR2-NEXT:  LBB12_27: ## %cond.store13
 ; AVX1OR2-NEXT:    vpextrb $13, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1OR2-NEXT:    je LBB12_30
-; AVX1OR2-NEXT:  LBB12_29: ## %cond.store40
+; AVX1OR2-NEXT:  LBB12_29: ## %cond.store14
 ; AVX1OR2-NEXT:    vpextrb $14, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    incq %rdi
 ; AVX1OR2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1OR2-NEXT:    je LBB12_32
-; AVX1OR2-NEXT:  LBB12_31: ## %cond.store43
+; AVX1OR2-NEXT:  LBB12_31: ## %cond.store15
 ; AVX1OR2-NEXT:    vpextrb $15, %xmm0, (%rdi)
 ; AVX1OR2-NEXT:    retq
 ;
@@ -4017,49 +4017,49 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; AVX512F-NEXT:  ## %bb.2: ## %else
 ; AVX512F-NEXT:    testb $2, %al
 ; AVX512F-NEXT:    jne LBB12_3
-; AVX512F-NEXT:  LBB12_4: ## %else2
+; AVX512F-NEXT:  LBB12_4: ## %else1
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    jne LBB12_5
-; AVX512F-NEXT:  LBB12_6: ## %else5
+; AVX512F-NEXT:  LBB12_6: ## %else2
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    jne LBB12_7
-; AVX512F-NEXT:  LBB12_8: ## %else8
+; AVX512F-NEXT:  LBB12_8: ## %else3
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    jne LBB12_9
-; AVX512F-NEXT:  LBB12_10: ## %else11
+; AVX512F-NEXT:  LBB12_10: ## %else4
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    jne LBB12_11
-; AVX512F-NEXT:  LBB12_12: ## %else14
+; AVX512F-NEXT:  LBB12_12: ## %else5
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    jne LBB12_13
-; AVX512F-NEXT:  LBB12_14: ## %else17
+; AVX512F-NEXT:  LBB12_14: ## %else6
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    jne LBB12_15
-; AVX512F-NEXT:  LBB12_16: ## %else20
+; AVX512F-NEXT:  LBB12_16: ## %else7
 ; AVX512F-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512F-NEXT:    jne LBB12_17
-; AVX512F-NEXT:  LBB12_18: ## %else23
+; AVX512F-NEXT:  LBB12_18: ## %else8
 ; AVX512F-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512F-NEXT:    jne LBB12_19
-; AVX512F-NEXT:  LBB12_20: ## %else26
+; AVX512F-NEXT:  LBB12_20: ## %else9
 ; AVX512F-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512F-NEXT:    jne LBB12_21
-; AVX512F-NEXT:  LBB12_22: ## %else29
+; AVX512F-NEXT:  LBB12_22: ## %else10
 ; AVX512F-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512F-NEXT:    jne LBB12_23
-; AVX512F-NEXT:  LBB12_24: ## %else32
+; AVX512F-NEXT:  LBB12_24: ## %else11
 ; AVX512F-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512F-NEXT:    jne LBB12_25
-; AVX512F-NEXT:  LBB12_26: ## %else35
+; AVX512F-NEXT:  LBB12_26: ## %else12
 ; AVX512F-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512F-NEXT:    jne LBB12_27
-; AVX512F-NEXT:  LBB12_28: ## %else38
+; AVX512F-NEXT:  LBB12_28: ## %else13
 ; AVX512F-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512F-NEXT:    jne LBB12_29
-; AVX512F-NEXT:  LBB12_30: ## %else41
+; AVX512F-NEXT:  LBB12_30: ## %else14
 ; AVX512F-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512F-NEXT:    jne LBB12_31
-; AVX512F-NEXT:  LBB12_32: ## %else44
+; AVX512F-NEXT:  LBB12_32: ## %else15
 ; AVX512F-NEXT:    retq
 ; AVX512F-NEXT:  LBB12_1: ## %cond.store
 ; AVX512F-NEXT:    vpextrb $0, %xmm0, (%rdi)
@@ -4071,72 +4071,72 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    je LBB12_6
-; AVX512F-NEXT:  LBB12_5: ## %cond.store4
+; AVX512F-NEXT:  LBB12_5: ## %cond.store2
 ; AVX512F-NEXT:    vpextrb $2, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    je LBB12_8
-; AVX512F-NEXT:  LBB12_7: ## %cond.store7
+; AVX512F-NEXT:  LBB12_7: ## %cond.store3
 ; AVX512F-NEXT:    vpextrb $3, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    je LBB12_10
-; AVX512F-NEXT:  LBB12_9: ## %cond.store10
+; AVX512F-NEXT:  LBB12_9: ## %cond.store4
 ; AVX512F-NEXT:    vpextrb $4, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    je LBB12_12
-; AVX512F-NEXT:  LBB12_11: ## %cond.store13
+; AVX512F-NEXT:  LBB12_11: ## %cond.store5
 ; AVX512F-NEXT:    vpextrb $5, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    je LBB12_14
-; AVX512F-NEXT:  LBB12_13: ## %cond.store16
+; AVX512F-NEXT:  LBB12_13: ## %cond.store6
 ; AVX512F-NEXT:    vpextrb $6, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    je LBB12_16
-; AVX512F-NEXT:  LBB12_15: ## %cond.store19
+; AVX512F-NEXT:  LBB12_15: ## %cond.store7
 ; AVX512F-NEXT:    vpextrb $7, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512F-NEXT:    je LBB12_18
-; AVX512F-NEXT:  LBB12_17: ## %cond.store22
+; AVX512F-NEXT:  LBB12_17: ## %cond.store8
 ; AVX512F-NEXT:    vpextrb $8, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512F-NEXT:    je LBB12_20
-; AVX512F-NEXT:  LBB12_19: ## %cond.store25
+; AVX512F-NEXT:  LBB12_19: ## %cond.store9
 ; AVX512F-NEXT:    vpextrb $9, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512F-NEXT:    je LBB12_22
-; AVX512F-NEXT:  LBB12_21: ## %cond.store28
+; AVX512F-NEXT:  LBB12_21: ## %cond.store10
 ; AVX512F-NEXT:    vpextrb $10, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512F-NEXT:    je LBB12_24
-; AVX512F-NEXT:  LBB12_23: ## %cond.store31
+; AVX512F-NEXT:  LBB12_23: ## %cond.store11
 ; AVX512F-NEXT:    vpextrb $11, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512F-NEXT:    je LBB12_26
-; AVX512F-NEXT:  LBB12_25: ## %cond.store34
+; AVX512F-NEXT:  LBB12_25: ## %cond.store12
 ; AVX512F-NEXT:    vpextrb $12, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512F-NEXT:    je LBB12_28
-; AVX512F-NEXT:  LBB12_27: ## %cond.store37
+; AVX512F-NEXT:  LBB12_27: ## %cond.store13
 ; AVX512F-NEXT:    vpextrb $13, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512F-NEXT:    je LBB12_30
-; AVX512F-NEXT:  LBB12_29: ## %cond.store40
+; AVX512F-NEXT:  LBB12_29: ## %cond.store14
 ; AVX512F-NEXT:    vpextrb $14, %xmm0, (%rdi)
 ; AVX512F-NEXT:    incq %rdi
 ; AVX512F-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512F-NEXT:    je LBB12_32
-; AVX512F-NEXT:  LBB12_31: ## %cond.store43
+; AVX512F-NEXT:  LBB12_31: ## %cond.store15
 ; AVX512F-NEXT:    vpextrb $15, %xmm0, (%rdi)
 ; AVX512F-NEXT:    retq
 ;
@@ -4150,49 +4150,49 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; AVX512VLDQ-NEXT:  ## %bb.2: ## %else
 ; AVX512VLDQ-NEXT:    testb $2, %al
 ; AVX512VLDQ-NEXT:    jne LBB12_3
-; AVX512VLDQ-NEXT:  LBB12_4: ## %else2
+; AVX512VLDQ-NEXT:  LBB12_4: ## %else1
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    jne LBB12_5
-; AVX512VLDQ-NEXT:  LBB12_6: ## %else5
+; AVX512VLDQ-NEXT:  LBB12_6: ## %else2
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    jne LBB12_7
-; AVX512VLDQ-NEXT:  LBB12_8: ## %else8
+; AVX512VLDQ-NEXT:  LBB12_8: ## %else3
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    jne LBB12_9
-; AVX512VLDQ-NEXT:  LBB12_10: ## %else11
+; AVX512VLDQ-NEXT:  LBB12_10: ## %else4
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    jne LBB12_11
-; AVX512VLDQ-NEXT:  LBB12_12: ## %else14
+; AVX512VLDQ-NEXT:  LBB12_12: ## %else5
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    jne LBB12_13
-; AVX512VLDQ-NEXT:  LBB12_14: ## %else17
+; AVX512VLDQ-NEXT:  LBB12_14: ## %else6
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    jne LBB12_15
-; AVX512VLDQ-NEXT:  LBB12_16: ## %else20
+; AVX512VLDQ-NEXT:  LBB12_16: ## %else7
 ; AVX512VLDQ-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLDQ-NEXT:    jne LBB12_17
-; AVX512VLDQ-NEXT:  LBB12_18: ## %else23
+; AVX512VLDQ-NEXT:  LBB12_18: ## %else8
 ; AVX512VLDQ-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLDQ-NEXT:    jne LBB12_19
-; AVX512VLDQ-NEXT:  LBB12_20: ## %else26
+; AVX512VLDQ-NEXT:  LBB12_20: ## %else9
 ; AVX512VLDQ-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLDQ-NEXT:    jne LBB12_21
-; AVX512VLDQ-NEXT:  LBB12_22: ## %else29
+; AVX512VLDQ-NEXT:  LBB12_22: ## %else10
 ; AVX512VLDQ-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLDQ-NEXT:    jne LBB12_23
-; AVX512VLDQ-NEXT:  LBB12_24: ## %else32
+; AVX512VLDQ-NEXT:  LBB12_24: ## %else11
 ; AVX512VLDQ-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLDQ-NEXT:    jne LBB12_25
-; AVX512VLDQ-NEXT:  LBB12_26: ## %else35
+; AVX512VLDQ-NEXT:  LBB12_26: ## %else12
 ; AVX512VLDQ-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLDQ-NEXT:    jne LBB12_27
-; AVX512VLDQ-NEXT:  LBB12_28: ## %else38
+; AVX512VLDQ-NEXT:  LBB12_28: ## %else13
 ; AVX512VLDQ-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLDQ-NEXT:    jne LBB12_29
-; AVX512VLDQ-NEXT:  LBB12_30: ## %else41
+; AVX512VLDQ-NEXT:  LBB12_30: ## %else14
 ; AVX512VLDQ-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLDQ-NEXT:    jne LBB12_31
-; AVX512VLDQ-NEXT:  LBB12_32: ## %else44
+; AVX512VLDQ-NEXT:  LBB12_32: ## %else15
 ; AVX512VLDQ-NEXT:    retq
 ; AVX512VLDQ-NEXT:  LBB12_1: ## %cond.store
 ; AVX512VLDQ-NEXT:    vpextrb $0, %xmm0, (%rdi)
@@ -4204,72 +4204,72 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    je LBB12_6
-; AVX512VLDQ-NEXT:  LBB12_5: ## %cond.store4
+; AVX512VLDQ-NEXT:  LBB12_5: ## %cond.store2
 ; AVX512VLDQ-NEXT:    vpextrb $2, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    je LBB12_8
-; AVX512VLDQ-NEXT:  LBB12_7: ## %cond.store7
+; AVX512VLDQ-NEXT:  LBB12_7: ## %cond.store3
 ; AVX512VLDQ-NEXT:    vpextrb $3, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    je LBB12_10
-; AVX512VLDQ-NEXT:  LBB12_9: ## %cond.store10
+; AVX512VLDQ-NEXT:  LBB12_9: ## %cond.store4
 ; AVX512VLDQ-NEXT:    vpextrb $4, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    je LBB12_12
-; AVX512VLDQ-NEXT:  LBB12_11: ## %cond.store13
+; AVX512VLDQ-NEXT:  LBB12_11: ## %cond.store5
 ; AVX512VLDQ-NEXT:    vpextrb $5, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    je LBB12_14
-; AVX512VLDQ-NEXT:  LBB12_13: ## %cond.store16
+; AVX512VLDQ-NEXT:  LBB12_13: ## %cond.store6
 ; AVX512VLDQ-NEXT:    vpextrb $6, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    je LBB12_16
-; AVX512VLDQ-NEXT:  LBB12_15: ## %cond.store19
+; AVX512VLDQ-NEXT:  LBB12_15: ## %cond.store7
 ; AVX512VLDQ-NEXT:    vpextrb $7, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLDQ-NEXT:    je LBB12_18
-; AVX512VLDQ-NEXT:  LBB12_17: ## %cond.store22
+; AVX512VLDQ-NEXT:  LBB12_17: ## %cond.store8
 ; AVX512VLDQ-NEXT:    vpextrb $8, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLDQ-NEXT:    je LBB12_20
-; AVX512VLDQ-NEXT:  LBB12_19: ## %cond.store25
+; AVX512VLDQ-NEXT:  LBB12_19: ## %cond.store9
 ; AVX512VLDQ-NEXT:    vpextrb $9, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLDQ-NEXT:    je LBB12_22
-; AVX512VLDQ-NEXT:  LBB12_21: ## %cond.store28
+; AVX512VLDQ-NEXT:  LBB12_21: ## %cond.store10
 ; AVX512VLDQ-NEXT:    vpextrb $10, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLDQ-NEXT:    je LBB12_24
-; AVX512VLDQ-NEXT:  LBB12_23: ## %cond.store31
+; AVX512VLDQ-NEXT:  LBB12_23: ## %cond.store11
 ; AVX512VLDQ-NEXT:    vpextrb $11, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLDQ-NEXT:    je LBB12_26
-; AVX512VLDQ-NEXT:  LBB12_25: ## %cond.store34
+; AVX512VLDQ-NEXT:  LBB12_25: ## %cond.store12
 ; AVX512VLDQ-NEXT:    vpextrb $12, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLDQ-NEXT:    je LBB12_28
-; AVX512VLDQ-NEXT:  LBB12_27: ## %cond.store37
+; AVX512VLDQ-NEXT:  LBB12_27: ## %cond.store13
 ; AVX512VLDQ-NEXT:    vpextrb $13, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLDQ-NEXT:    je LBB12_30
-; AVX512VLDQ-NEXT:  LBB12_29: ## %cond.store40
+; AVX512VLDQ-NEXT:  LBB12_29: ## %cond.store14
 ; AVX512VLDQ-NEXT:    vpextrb $14, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    incq %rdi
 ; AVX512VLDQ-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLDQ-NEXT:    je LBB12_32
-; AVX512VLDQ-NEXT:  LBB12_31: ## %cond.store43
+; AVX512VLDQ-NEXT:  LBB12_31: ## %cond.store15
 ; AVX512VLDQ-NEXT:    vpextrb $15, %xmm0, (%rdi)
 ; AVX512VLDQ-NEXT:    retq
 ;
@@ -4282,49 +4282,49 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; AVX512VLBW-NEXT:  ## %bb.2: ## %else
 ; AVX512VLBW-NEXT:    testb $2, %al
 ; AVX512VLBW-NEXT:    jne LBB12_3
-; AVX512VLBW-NEXT:  LBB12_4: ## %else2
+; AVX512VLBW-NEXT:  LBB12_4: ## %else1
 ; AVX512VLBW-NEXT:    testb $4, %al
 ; AVX512VLBW-NEXT:    jne LBB12_5
-; AVX512VLBW-NEXT:  LBB12_6: ## %else5
+; AVX512VLBW-NEXT:  LBB12_6: ## %else2
 ; AVX512VLBW-NEXT:    testb $8, %al
 ; AVX512VLBW-NEXT:    jne LBB12_7
-; AVX512VLBW-NEXT:  LBB12_8: ## %else8
+; AVX512VLBW-NEXT:  LBB12_8: ## %else3
 ; AVX512VLBW-NEXT:    testb $16, %al
 ; AVX512VLBW-NEXT:    jne LBB12_9
-; AVX512VLBW-NEXT:  LBB12_10: ## %else11
+; AVX512VLBW-NEXT:  LBB12_10: ## %else4
 ; AVX512VLBW-NEXT:    testb $32, %al
 ; AVX512VLBW-NEXT:    jne LBB12_11
-; AVX512VLBW-NEXT:  LBB12_12: ## %else14
+; AVX512VLBW-NEXT:  LBB12_12: ## %else5
 ; AVX512VLBW-NEXT:    testb $64, %al
 ; AVX512VLBW-NEXT:    jne LBB12_13
-; AVX512VLBW-NEXT:  LBB12_14: ## %else17
+; AVX512VLBW-NEXT:  LBB12_14: ## %else6
 ; AVX512VLBW-NEXT:    testb $-128, %al
 ; AVX512VLBW-NEXT:    jne LBB12_15
-; AVX512VLBW-NEXT:  LBB12_16: ## %else20
+; AVX512VLBW-NEXT:  LBB12_16: ## %else7
 ; AVX512VLBW-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLBW-NEXT:    jne LBB12_17
-; AVX512VLBW-NEXT:  LBB12_18: ## %else23
+; AVX512VLBW-NEXT:  LBB12_18: ## %else8
 ; AVX512VLBW-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLBW-NEXT:    jne LBB12_19
-; AVX512VLBW-NEXT:  LBB12_20: ## %else26
+; AVX512VLBW-NEXT:  LBB12_20: ## %else9
 ; AVX512VLBW-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLBW-NEXT:    jne LBB12_21
-; AVX512VLBW-NEXT:  LBB12_22: ## %else29
+; AVX512VLBW-NEXT:  LBB12_22: ## %else10
 ; AVX512VLBW-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLBW-NEXT:    jne LBB12_23
-; AVX512VLBW-NEXT:  LBB12_24: ## %else32
+; AVX512VLBW-NEXT:  LBB12_24: ## %else11
 ; AVX512VLBW-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLBW-NEXT:    jne LBB12_25
-; AVX512VLBW-NEXT:  LBB12_26: ## %else35
+; AVX512VLBW-NEXT:  LBB12_26: ## %else12
 ; AVX512VLBW-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLBW-NEXT:    jne LBB12_27
-; AVX512VLBW-NEXT:  LBB12_28: ## %else38
+; AVX512VLBW-NEXT:  LBB12_28: ## %else13
 ; AVX512VLBW-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLBW-NEXT:    jne LBB12_29
-; AVX512VLBW-NEXT:  LBB12_30: ## %else41
+; AVX512VLBW-NEXT:  LBB12_30: ## %else14
 ; AVX512VLBW-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLBW-NEXT:    jne LBB12_31
-; AVX512VLBW-NEXT:  LBB12_32: ## %else44
+; AVX512VLBW-NEXT:  LBB12_32: ## %else15
 ; AVX512VLBW-NEXT:    retq
 ; AVX512VLBW-NEXT:  LBB12_1: ## %cond.store
 ; AVX512VLBW-NEXT:    vpextrb $0, %xmm0, (%rdi)
@@ -4336,72 +4336,72 @@ define void @compressstore_v16i8_v16i8(i8* %base, <16 x i8> %V, <16 x i8> %trigg
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testb $4, %al
 ; AVX512VLBW-NEXT:    je LBB12_6
-; AVX512VLBW-NEXT:  LBB12_5: ## %cond.store4
+; AVX512VLBW-NEXT:  LBB12_5: ## %cond.store2
 ; AVX512VLBW-NEXT:    vpextrb $2, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testb $8, %al
 ; AVX512VLBW-NEXT:    je LBB12_8
-; AVX512VLBW-NEXT:  LBB12_7: ## %cond.store7
+; AVX512VLBW-NEXT:  LBB12_7: ## %cond.store3
 ; AVX512VLBW-NEXT:    vpextrb $3, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testb $16, %al
 ; AVX512VLBW-NEXT:    je LBB12_10
-; AVX512VLBW-NEXT:  LBB12_9: ## %cond.store10
+; AVX512VLBW-NEXT:  LBB12_9: ## %cond.store4
 ; AVX512VLBW-NEXT:    vpextrb $4, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testb $32, %al
 ; AVX512VLBW-NEXT:    je LBB12_12
-; AVX512VLBW-NEXT:  LBB12_11: ## %cond.store13
+; AVX512VLBW-NEXT:  LBB12_11: ## %cond.store5
 ; AVX512VLBW-NEXT:    vpextrb $5, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testb $64, %al
 ; AVX512VLBW-NEXT:    je LBB12_14
-; AVX512VLBW-NEXT:  LBB12_13: ## %cond.store16
+; AVX512VLBW-NEXT:  LBB12_13: ## %cond.store6
 ; AVX512VLBW-NEXT:    vpextrb $6, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testb $-128, %al
 ; AVX512VLBW-NEXT:    je LBB12_16
-; AVX512VLBW-NEXT:  LBB12_15: ## %cond.store19
+; AVX512VLBW-NEXT:  LBB12_15: ## %cond.store7
 ; AVX512VLBW-NEXT:    vpextrb $7, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLBW-NEXT:    je LBB12_18
-; AVX512VLBW-NEXT:  LBB12_17: ## %cond.store22
+; AVX512VLBW-NEXT:  LBB12_17: ## %cond.store8
 ; AVX512VLBW-NEXT:    vpextrb $8, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLBW-NEXT:    je LBB12_20
-; AVX512VLBW-NEXT:  LBB12_19: ## %cond.store25
+; AVX512VLBW-NEXT:  LBB12_19: ## %cond.store9
 ; AVX512VLBW-NEXT:    vpextrb $9, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLBW-NEXT:    je LBB12_22
-; AVX512VLBW-NEXT:  LBB12_21: ## %cond.store28
+; AVX512VLBW-NEXT:  LBB12_21: ## %cond.store10
 ; AVX512VLBW-NEXT:    vpextrb $10, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLBW-NEXT:    je LBB12_24
-; AVX512VLBW-NEXT:  LBB12_23: ## %cond.store31
+; AVX512VLBW-NEXT:  LBB12_23: ## %cond.store11
 ; AVX512VLBW-NEXT:    vpextrb $11, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLBW-NEXT:    je LBB12_26
-; AVX512VLBW-NEXT:  LBB12_25: ## %cond.store34
+; AVX512VLBW-NEXT:  LBB12_25: ## %cond.store12
 ; AVX512VLBW-NEXT:    vpextrb $12, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLBW-NEXT:    je LBB12_28
-; AVX512VLBW-NEXT:  LBB12_27: ## %cond.store37
+; AVX512VLBW-NEXT:  LBB12_27: ## %cond.store13
 ; AVX512VLBW-NEXT:    vpextrb $13, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLBW-NEXT:    je LBB12_30
-; AVX512VLBW-NEXT:  LBB12_29: ## %cond.store40
+; AVX512VLBW-NEXT:  LBB12_29: ## %cond.store14
 ; AVX512VLBW-NEXT:    vpextrb $14, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    incq %rdi
 ; AVX512VLBW-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLBW-NEXT:    je LBB12_32
-; AVX512VLBW-NEXT:  LBB12_31: ## %cond.store43
+; AVX512VLBW-NEXT:  LBB12_31: ## %cond.store15
 ; AVX512VLBW-NEXT:    vpextrb $15, %xmm0, (%rdi)
 ; AVX512VLBW-NEXT:    retq
   %mask = icmp eq <16 x i8> %trigger, zeroinitializer
@@ -71,7 +71,7 @@ declare <8 x i32> @llvm.masked.gather.v8i32.v8p0i32(<8 x i32*> , i32, <8 x i1> ,
 ; SCALAR-NEXT:  %res.phi.else = phi
 ; SCALAR-NEXT:  and i16 %{{.*}}, 2
 ; SCALAR-NEXT:  icmp ne i16 %{{.*}}, 0
-; SCALAR-NEXT:  br i1 %{{.*}}, label %cond.load1, label %else2
+; SCALAR-NEXT:  br i1 %{{.*}}, label %cond.load1, label %else1
 
 define <16 x float> @test2(float* %base, <16 x i32> %ind, i16 %mask) {
 ; KNL_64-LABEL: test2:
@@ -223,7 +223,7 @@ define <16 x i32> @test4(i32* %base, <16 x i32> %ind, i16 %mask) {
 ; SCALAR: else:
 ; SCALAR-NEXT:   and i16 %scalar_mask, 2
 ; SCALAR-NEXT:   icmp ne i16 %{{.*}}, 0
-; SCALAR-NEXT:  br i1 %{{.*}}, label %cond.store1, label %else2
+; SCALAR-NEXT:  br i1 %{{.*}}, label %cond.store1, label %else1
 
 define void @test5(i32* %base, <16 x i32> %ind, i16 %mask, <16 x i32>%val) {
 ; KNL_64-LABEL: test5:
@@ -281,11 +281,11 @@ declare void @llvm.masked.scatter.v16i32.v16p0i32(<16 x i32> , <16 x i32*> , i32
 ; SCALAR-LABEL: test6
 ; SCALAR:        store i32 %Elt0, i32* %Ptr01, align 4
 ; SCALAR-NEXT:   %Elt1 = extractelement <8 x i32> %a1, i64 1
-; SCALAR-NEXT:   %Ptr12 = extractelement <8 x i32*> %ptr, i64 1
-; SCALAR-NEXT:   store i32 %Elt1, i32* %Ptr12, align 4
+; SCALAR-NEXT:   %Ptr11 = extractelement <8 x i32*> %ptr, i64 1
+; SCALAR-NEXT:   store i32 %Elt1, i32* %Ptr11, align 4
 ; SCALAR-NEXT:   %Elt2 = extractelement <8 x i32> %a1, i64 2
-; SCALAR-NEXT:   %Ptr23 = extractelement <8 x i32*> %ptr, i64 2
-; SCALAR-NEXT:   store i32 %Elt2, i32* %Ptr23, align 4
+; SCALAR-NEXT:   %Ptr21 = extractelement <8 x i32*> %ptr, i64 2
+; SCALAR-NEXT:   store i32 %Elt2, i32* %Ptr21, align 4
 
 define <8 x i32> @test6(<8 x i32>%a1, <8 x i32*> %ptr) {
 ; KNL_64-LABEL: test6:
@@ -1641,10 +1641,10 @@ define <3 x i32> @test30(<3 x i32*> %base, <3 x i32> %ind, <3 x i1> %mask, <3 x
 ; KNL_64-NEXT:  # %bb.2: # %else
 ; KNL_64-NEXT:    testb $2, %dl
 ; KNL_64-NEXT:    jne .LBB31_3
-; KNL_64-NEXT:  .LBB31_4: # %else2
+; KNL_64-NEXT:  .LBB31_4: # %else1
 ; KNL_64-NEXT:    testb $4, %dl
 ; KNL_64-NEXT:    jne .LBB31_5
-; KNL_64-NEXT:  .LBB31_6: # %else5
+; KNL_64-NEXT:  .LBB31_6: # %else2
 ; KNL_64-NEXT:    vmovdqa %xmm2, %xmm0
 ; KNL_64-NEXT:    vzeroupper
 ; KNL_64-NEXT:    retq
@@ -1658,7 +1658,7 @@ define <3 x i32> @test30(<3 x i32*> %base, <3 x i32> %ind, <3 x i1> %mask, <3 x
 ; KNL_64-NEXT:    vpinsrd $1, (%rax), %xmm2, %xmm2
 ; KNL_64-NEXT:    testb $4, %dl
 ; KNL_64-NEXT:    je .LBB31_6
-; KNL_64-NEXT:  .LBB31_5: # %cond.load4
+; KNL_64-NEXT:  .LBB31_5: # %cond.load2
 ; KNL_64-NEXT:    vextracti128 $1, %ymm0, %xmm0
 ; KNL_64-NEXT:    vmovq %xmm0, %rax
 ; KNL_64-NEXT:    vpinsrd $2, (%rax), %xmm2, %xmm2
@@ -1687,13 +1687,13 @@ define <3 x i32> @test30(<3 x i32*> %base, <3 x i32> %ind, <3 x i1> %mask, <3 x
 ; KNL_32-NEXT:  # %bb.2: # %else
 ; KNL_32-NEXT:    testb $2, %al
 ; KNL_32-NEXT:    jne .LBB31_3
-; KNL_32-NEXT:  .LBB31_4: # %else2
+; KNL_32-NEXT:  .LBB31_4: # %else1
 ; KNL_32-NEXT:    testb $4, %al
 ; KNL_32-NEXT:    je .LBB31_6
-; KNL_32-NEXT:  .LBB31_5: # %cond.load4
+; KNL_32-NEXT:  .LBB31_5: # %cond.load2
 ; KNL_32-NEXT:    vpextrd $2, %xmm0, %eax
 ; KNL_32-NEXT:    vpinsrd $2, (%eax), %xmm2, %xmm2
-; KNL_32-NEXT:  .LBB31_6: # %else5
+; KNL_32-NEXT:  .LBB31_6: # %else2
 ; KNL_32-NEXT:    vmovdqa %xmm2, %xmm0
 ; KNL_32-NEXT:    popl %eax
 ; KNL_32-NEXT:    .cfi_def_cfa_offset 4
@@ -1728,10 +1728,10 @@ define <3 x i32> @test30(<3 x i32*> %base, <3 x i32> %ind, <3 x i1> %mask, <3 x
 ; SKX-NEXT:  # %bb.2: # %else
 ; SKX-NEXT:    testb $2, %dl
 ; SKX-NEXT:    jne .LBB31_3
-; SKX-NEXT:  .LBB31_4: # %else2
+; SKX-NEXT:  .LBB31_4: # %else1
 ; SKX-NEXT:    testb $4, %dl
 ; SKX-NEXT:    jne .LBB31_5
-; SKX-NEXT:  .LBB31_6: # %else5
+; SKX-NEXT:  .LBB31_6: # %else2
 ; SKX-NEXT:    vmovdqa %xmm2, %xmm0
 ; SKX-NEXT:    vzeroupper
 ; SKX-NEXT:    retq
@@ -1745,7 +1745,7 @@ define <3 x i32> @test30(<3 x i32*> %base, <3 x i32> %ind, <3 x i1> %mask, <3 x
 ; SKX-NEXT:    vpinsrd $1, (%rax), %xmm2, %xmm2
 ; SKX-NEXT:    testb $4, %dl
 ; SKX-NEXT:    je .LBB31_6
-; SKX-NEXT:  .LBB31_5: # %cond.load4
+; SKX-NEXT:  .LBB31_5: # %cond.load2
 ; SKX-NEXT:    vextracti128 $1, %ymm0, %xmm0
 ; SKX-NEXT:    vmovq %xmm0, %rax
 ; SKX-NEXT:    vpinsrd $2, (%rax), %xmm2, %xmm2
@@ -1774,13 +1774,13 @@ define <3 x i32> @test30(<3 x i32*> %base, <3 x i32> %ind, <3 x i1> %mask, <3 x
 ; SKX_32-NEXT:  # %bb.2: # %else
 ; SKX_32-NEXT:    testb $2, %al
 ; SKX_32-NEXT:    jne .LBB31_3
-; SKX_32-NEXT:  .LBB31_4: # %else2
+; SKX_32-NEXT:  .LBB31_4: # %else1
 ; SKX_32-NEXT:    testb $4, %al
 ; SKX_32-NEXT:    je .LBB31_6
-; SKX_32-NEXT:  .LBB31_5: # %cond.load4
+; SKX_32-NEXT:  .LBB31_5: # %cond.load2
 ; SKX_32-NEXT:    vpextrd $2, %xmm0, %eax
 ; SKX_32-NEXT:    vpinsrd $2, (%eax), %xmm2, %xmm2
-; SKX_32-NEXT:  .LBB31_6: # %else5
+; SKX_32-NEXT:  .LBB31_6: # %else2
 ; SKX_32-NEXT:    vmovdqa %xmm2, %xmm0
 ; SKX_32-NEXT:    popl %eax
 ; SKX_32-NEXT:    .cfi_def_cfa_offset 4
@@ -70,7 +70,7 @@ define void @test_scatter_v2i32_index(<2 x double> %a1, double* %base, <2 x i32>
 ; WIDEN_AVX2-NEXT:  # %bb.2: # %else
 ; WIDEN_AVX2-NEXT:    testb $2, %al
 ; WIDEN_AVX2-NEXT:    jne .LBB1_3
-; WIDEN_AVX2-NEXT:  .LBB1_4: # %else2
+; WIDEN_AVX2-NEXT:  .LBB1_4: # %else1
 ; WIDEN_AVX2-NEXT:    retq
 ; WIDEN_AVX2-NEXT:  .LBB1_1: # %cond.store
 ; WIDEN_AVX2-NEXT:    vmovq %xmm1, %rcx
@@ -148,7 +148,7 @@ define void @test_scatter_v2i32_data(<2 x i32>%a1, <2 x i32*> %ptr, <2 x i1>%mas
 ; WIDEN_AVX2-NEXT:  # %bb.2: # %else
 ; WIDEN_AVX2-NEXT:    testb $2, %al
 ; WIDEN_AVX2-NEXT:    jne .LBB3_3
-; WIDEN_AVX2-NEXT:  .LBB3_4: # %else2
+; WIDEN_AVX2-NEXT:  .LBB3_4: # %else1
 ; WIDEN_AVX2-NEXT:    retq
 ; WIDEN_AVX2-NEXT:  .LBB3_1: # %cond.store
 ; WIDEN_AVX2-NEXT:    vmovq %xmm1, %rcx
@@ -231,7 +231,7 @@ define void @test_scatter_v2i32_data_index(<2 x i32> %a1, i32* %base, <2 x i32>
 ; WIDEN_AVX2-NEXT:  # %bb.2: # %else
 ; WIDEN_AVX2-NEXT:    testb $2, %al
 ; WIDEN_AVX2-NEXT:    jne .LBB5_3
-; WIDEN_AVX2-NEXT:  .LBB5_4: # %else2
+; WIDEN_AVX2-NEXT:  .LBB5_4: # %else1
 ; WIDEN_AVX2-NEXT:    retq
 ; WIDEN_AVX2-NEXT:  .LBB5_1: # %cond.store
 ; WIDEN_AVX2-NEXT:    vmovq %xmm1, %rcx
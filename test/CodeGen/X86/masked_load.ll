@@ -47,7 +47,7 @@ define <2 x double> @load_v2f64_v2i64(<2 x i64> %trigger, <2 x double>* %addr, <
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB1_3
-; SSE2-NEXT:  LBB1_4: ## %else2
+; SSE2-NEXT:  LBB1_4: ## %else1
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB1_1: ## %cond.load
@@ -69,7 +69,7 @@ define <2 x double> @load_v2f64_v2i64(<2 x i64> %trigger, <2 x double>* %addr, <
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB1_3
-; SSE42-NEXT:  LBB1_4: ## %else2
+; SSE42-NEXT:  LBB1_4: ## %else1
 ; SSE42-NEXT:    movaps %xmm1, %xmm0
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB1_1: ## %cond.load
@@ -122,15 +122,15 @@ define <4 x double> @load_v4f64_v4i32(<4 x i32> %trigger, <4 x double>* %addr, <
 ; SSE-NEXT:  ## %bb.2: ## %else
 ; SSE-NEXT:    testb $2, %al
 ; SSE-NEXT:    jne LBB2_3
-; SSE-NEXT:  LBB2_4: ## %else2
+; SSE-NEXT:  LBB2_4: ## %else1
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    jne LBB2_5
-; SSE-NEXT:  LBB2_6: ## %else5
+; SSE-NEXT:  LBB2_6: ## %else2
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    je LBB2_8
-; SSE-NEXT:  LBB2_7: ## %cond.load7
+; SSE-NEXT:  LBB2_7: ## %cond.load3
 ; SSE-NEXT:    movhps {{.*#+}} xmm2 = xmm2[0,1],mem[0,1]
-; SSE-NEXT:  LBB2_8: ## %else8
+; SSE-NEXT:  LBB2_8: ## %else3
 ; SSE-NEXT:    movaps %xmm1, %xmm0
 ; SSE-NEXT:    movaps %xmm2, %xmm1
 ; SSE-NEXT:    retq
@@ -142,7 +142,7 @@ define <4 x double> @load_v4f64_v4i32(<4 x i32> %trigger, <4 x double>* %addr, <
 ; SSE-NEXT:    movhps {{.*#+}} xmm1 = xmm1[0,1],mem[0,1]
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    je LBB2_6
-; SSE-NEXT:  LBB2_5: ## %cond.load4
+; SSE-NEXT:  LBB2_5: ## %cond.load2
 ; SSE-NEXT:    movlps {{.*#+}} xmm2 = mem[0,1],xmm2[2,3]
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    jne LBB2_7
@@ -203,13 +203,13 @@ define <4 x double> @load_v4f64_v4i32_zero(<4 x i32> %trigger, <4 x double>* %ad
 ; SSE-NEXT:  ## %bb.2: ## %else
 ; SSE-NEXT:    testb $2, %al
 ; SSE-NEXT:    jne LBB3_3
-; SSE-NEXT:  LBB3_4: ## %else2
+; SSE-NEXT:  LBB3_4: ## %else1
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    jne LBB3_5
-; SSE-NEXT:  LBB3_6: ## %else5
+; SSE-NEXT:  LBB3_6: ## %else2
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    jne LBB3_7
-; SSE-NEXT:  LBB3_8: ## %else8
+; SSE-NEXT:  LBB3_8: ## %else3
 ; SSE-NEXT:    retq
 ; SSE-NEXT:  LBB3_1: ## %cond.load
 ; SSE-NEXT:    movq {{.*#+}} xmm0 = mem[0],zero
@@ -220,11 +220,11 @@ define <4 x double> @load_v4f64_v4i32_zero(<4 x i32> %trigger, <4 x double>* %ad
 ; SSE-NEXT:    movhps {{.*#+}} xmm0 = xmm0[0,1],mem[0,1]
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    je LBB3_6
-; SSE-NEXT:  LBB3_5: ## %cond.load4
+; SSE-NEXT:  LBB3_5: ## %cond.load2
 ; SSE-NEXT:    movlps {{.*#+}} xmm1 = mem[0,1],xmm1[2,3]
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    je LBB3_8
-; SSE-NEXT:  LBB3_7: ## %cond.load7
+; SSE-NEXT:  LBB3_7: ## %cond.load3
 ; SSE-NEXT:    movhps {{.*#+}} xmm1 = xmm1[0,1],mem[0,1]
 ; SSE-NEXT:    retq
 ;
@@ -284,15 +284,15 @@ define <4 x double> @load_v4f64_v4i64(<4 x i64> %trigger, <4 x double>* %addr, <
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB4_3
-; SSE2-NEXT:  LBB4_4: ## %else2
+; SSE2-NEXT:  LBB4_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB4_5
-; SSE2-NEXT:  LBB4_6: ## %else5
+; SSE2-NEXT:  LBB4_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB4_8
-; SSE2-NEXT:  LBB4_7: ## %cond.load7
+; SSE2-NEXT:  LBB4_7: ## %cond.load3
 ; SSE2-NEXT:    movhps {{.*#+}} xmm3 = xmm3[0,1],mem[0,1]
-; SSE2-NEXT:  LBB4_8: ## %else8
+; SSE2-NEXT:  LBB4_8: ## %else3
 ; SSE2-NEXT:    movaps %xmm2, %xmm0
 ; SSE2-NEXT:    movaps %xmm3, %xmm1
 ; SSE2-NEXT:    retq
@@ -304,7 +304,7 @@ define <4 x double> @load_v4f64_v4i64(<4 x i64> %trigger, <4 x double>* %addr, <
 ; SSE2-NEXT:    movhps {{.*#+}} xmm2 = xmm2[0,1],mem[0,1]
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB4_6
-; SSE2-NEXT:  LBB4_5: ## %cond.load4
+; SSE2-NEXT:  LBB4_5: ## %cond.load2
 ; SSE2-NEXT:    movlps {{.*#+}} xmm3 = mem[0,1],xmm3[2,3]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB4_7
@@ -322,15 +322,15 @@ define <4 x double> @load_v4f64_v4i64(<4 x i64> %trigger, <4 x double>* %addr, <
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB4_3
-; SSE42-NEXT:  LBB4_4: ## %else2
+; SSE42-NEXT:  LBB4_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB4_5
-; SSE42-NEXT:  LBB4_6: ## %else5
+; SSE42-NEXT:  LBB4_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB4_8
-; SSE42-NEXT:  LBB4_7: ## %cond.load7
+; SSE42-NEXT:  LBB4_7: ## %cond.load3
 ; SSE42-NEXT:    movhps {{.*#+}} xmm3 = xmm3[0,1],mem[0,1]
-; SSE42-NEXT:  LBB4_8: ## %else8
+; SSE42-NEXT:  LBB4_8: ## %else3
 ; SSE42-NEXT:    movaps %xmm2, %xmm0
 ; SSE42-NEXT:    movaps %xmm3, %xmm1
 ; SSE42-NEXT:    retq
@@ -342,7 +342,7 @@ define <4 x double> @load_v4f64_v4i64(<4 x i64> %trigger, <4 x double>* %addr, <
 ; SSE42-NEXT:    movhps {{.*#+}} xmm2 = xmm2[0,1],mem[0,1]
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB4_6
-; SSE42-NEXT:  LBB4_5: ## %cond.load4
+; SSE42-NEXT:  LBB4_5: ## %cond.load2
 ; SSE42-NEXT:    movlps {{.*#+}} xmm3 = mem[0,1],xmm3[2,3]
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB4_7
@@ -400,27 +400,27 @@ define <8 x double> @load_v8f64_v8i16(<8 x i16> %trigger, <8 x double>* %addr, <
 ; SSE-NEXT:  ## %bb.2: ## %else
 ; SSE-NEXT:    testb $2, %al
 ; SSE-NEXT:    jne LBB5_3
-; SSE-NEXT:  LBB5_4: ## %else2
+; SSE-NEXT:  LBB5_4: ## %else1
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    jne LBB5_5
-; SSE-NEXT:  LBB5_6: ## %else5
+; SSE-NEXT:  LBB5_6: ## %else2
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    jne LBB5_7
-; SSE-NEXT:  LBB5_8: ## %else8
+; SSE-NEXT:  LBB5_8: ## %else3
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    jne LBB5_9
-; SSE-NEXT:  LBB5_10: ## %else11
+; SSE-NEXT:  LBB5_10: ## %else4
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    jne LBB5_11
-; SSE-NEXT:  LBB5_12: ## %else14
+; SSE-NEXT:  LBB5_12: ## %else5
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    jne LBB5_13
-; SSE-NEXT:  LBB5_14: ## %else17
+; SSE-NEXT:  LBB5_14: ## %else6
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    je LBB5_16
-; SSE-NEXT:  LBB5_15: ## %cond.load19
+; SSE-NEXT:  LBB5_15: ## %cond.load7
 ; SSE-NEXT:    movhps {{.*#+}} xmm4 = xmm4[0,1],mem[0,1]
-; SSE-NEXT:  LBB5_16: ## %else20
+; SSE-NEXT:  LBB5_16: ## %else7
 ; SSE-NEXT:    movaps %xmm1, %xmm0
 ; SSE-NEXT:    movaps %xmm2, %xmm1
 ; SSE-NEXT:    movaps %xmm3, %xmm2
@@ -434,23 +434,23 @@ define <8 x double> @load_v8f64_v8i16(<8 x i16> %trigger, <8 x double>* %addr, <
 ; SSE-NEXT:    movhps {{.*#+}} xmm1 = xmm1[0,1],mem[0,1]
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    je LBB5_6
-; SSE-NEXT:  LBB5_5: ## %cond.load4
+; SSE-NEXT:  LBB5_5: ## %cond.load2
 ; SSE-NEXT:    movlps {{.*#+}} xmm2 = mem[0,1],xmm2[2,3]
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    je LBB5_8
-; SSE-NEXT:  LBB5_7: ## %cond.load7
+; SSE-NEXT:  LBB5_7: ## %cond.load3
 ; SSE-NEXT:    movhps {{.*#+}} xmm2 = xmm2[0,1],mem[0,1]
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    je LBB5_10
-; SSE-NEXT:  LBB5_9: ## %cond.load10
+; SSE-NEXT:  LBB5_9: ## %cond.load4
 ; SSE-NEXT:    movlps {{.*#+}} xmm3 = mem[0,1],xmm3[2,3]
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    je LBB5_12
-; SSE-NEXT:  LBB5_11: ## %cond.load13
+; SSE-NEXT:  LBB5_11: ## %cond.load5
 ; SSE-NEXT:    movhps {{.*#+}} xmm3 = xmm3[0,1],mem[0,1]
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    je LBB5_14
-; SSE-NEXT:  LBB5_13: ## %cond.load16
+; SSE-NEXT:  LBB5_13: ## %cond.load6
 ; SSE-NEXT:    movlps {{.*#+}} xmm4 = mem[0,1],xmm4[2,3]
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    jne LBB5_15
@@ -548,27 +548,27 @@ define <8 x double> @load_v8f64_v8i64(<8 x i64> %trigger, <8 x double>* %addr, <
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB6_3
-; SSE2-NEXT:  LBB6_4: ## %else2
+; SSE2-NEXT:  LBB6_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB6_5
-; SSE2-NEXT:  LBB6_6: ## %else5
+; SSE2-NEXT:  LBB6_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB6_7
-; SSE2-NEXT:  LBB6_8: ## %else8
+; SSE2-NEXT:  LBB6_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB6_9
-; SSE2-NEXT:  LBB6_10: ## %else11
+; SSE2-NEXT:  LBB6_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB6_11
-; SSE2-NEXT:  LBB6_12: ## %else14
+; SSE2-NEXT:  LBB6_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB6_13
-; SSE2-NEXT:  LBB6_14: ## %else17
+; SSE2-NEXT:  LBB6_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB6_16
-; SSE2-NEXT:  LBB6_15: ## %cond.load19
+; SSE2-NEXT:  LBB6_15: ## %cond.load7
 ; SSE2-NEXT:    movhps {{.*#+}} xmm8 = xmm8[0,1],mem[0,1]
-; SSE2-NEXT:  LBB6_16: ## %else20
+; SSE2-NEXT:  LBB6_16: ## %else7
 ; SSE2-NEXT:    movaps %xmm4, %xmm0
 ; SSE2-NEXT:    movaps %xmm5, %xmm1
 ; SSE2-NEXT:    movaps %xmm9, %xmm2
@@ -582,23 +582,23 @@ define <8 x double> @load_v8f64_v8i64(<8 x i64> %trigger, <8 x double>* %addr, <
 ; SSE2-NEXT:    movhps {{.*#+}} xmm4 = xmm4[0,1],mem[0,1]
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB6_6
-; SSE2-NEXT:  LBB6_5: ## %cond.load4
+; SSE2-NEXT:  LBB6_5: ## %cond.load2
 ; SSE2-NEXT:    movlps {{.*#+}} xmm5 = mem[0,1],xmm5[2,3]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB6_8
-; SSE2-NEXT:  LBB6_7: ## %cond.load7
+; SSE2-NEXT:  LBB6_7: ## %cond.load3
 ; SSE2-NEXT:    movhps {{.*#+}} xmm5 = xmm5[0,1],mem[0,1]
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB6_10
-; SSE2-NEXT:  LBB6_9: ## %cond.load10
+; SSE2-NEXT:  LBB6_9: ## %cond.load4
 ; SSE2-NEXT:    movlps {{.*#+}} xmm9 = mem[0,1],xmm9[2,3]
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB6_12
-; SSE2-NEXT:  LBB6_11: ## %cond.load13
+; SSE2-NEXT:  LBB6_11: ## %cond.load5
 ; SSE2-NEXT:    movhps {{.*#+}} xmm9 = xmm9[0,1],mem[0,1]
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB6_14
-; SSE2-NEXT:  LBB6_13: ## %cond.load16
+; SSE2-NEXT:  LBB6_13: ## %cond.load6
 ; SSE2-NEXT:    movlps {{.*#+}} xmm8 = mem[0,1],xmm8[2,3]
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB6_15
@@ -622,27 +622,27 @@ define <8 x double> @load_v8f64_v8i64(<8 x i64> %trigger, <8 x double>* %addr, <
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB6_3
-; SSE42-NEXT:  LBB6_4: ## %else2
+; SSE42-NEXT:  LBB6_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB6_5
-; SSE42-NEXT:  LBB6_6: ## %else5
+; SSE42-NEXT:  LBB6_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB6_7
-; SSE42-NEXT:  LBB6_8: ## %else8
+; SSE42-NEXT:  LBB6_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB6_9
-; SSE42-NEXT:  LBB6_10: ## %else11
+; SSE42-NEXT:  LBB6_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB6_11
-; SSE42-NEXT:  LBB6_12: ## %else14
+; SSE42-NEXT:  LBB6_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB6_13
-; SSE42-NEXT:  LBB6_14: ## %else17
+; SSE42-NEXT:  LBB6_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB6_16
-; SSE42-NEXT:  LBB6_15: ## %cond.load19
+; SSE42-NEXT:  LBB6_15: ## %cond.load7
 ; SSE42-NEXT:    movhps {{.*#+}} xmm8 = xmm8[0,1],mem[0,1]
-; SSE42-NEXT:  LBB6_16: ## %else20
+; SSE42-NEXT:  LBB6_16: ## %else7
 ; SSE42-NEXT:    movaps %xmm4, %xmm0
 ; SSE42-NEXT:    movaps %xmm5, %xmm1
 ; SSE42-NEXT:    movaps %xmm6, %xmm2
@@ -656,23 +656,23 @@ define <8 x double> @load_v8f64_v8i64(<8 x i64> %trigger, <8 x double>* %addr, <
 ; SSE42-NEXT:    movhps {{.*#+}} xmm4 = xmm4[0,1],mem[0,1]
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB6_6
-; SSE42-NEXT:  LBB6_5: ## %cond.load4
+; SSE42-NEXT:  LBB6_5: ## %cond.load2
 ; SSE42-NEXT:    movlps {{.*#+}} xmm5 = mem[0,1],xmm5[2,3]
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB6_8
-; SSE42-NEXT:  LBB6_7: ## %cond.load7
+; SSE42-NEXT:  LBB6_7: ## %cond.load3
 ; SSE42-NEXT:    movhps {{.*#+}} xmm5 = xmm5[0,1],mem[0,1]
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB6_10
-; SSE42-NEXT:  LBB6_9: ## %cond.load10
+; SSE42-NEXT:  LBB6_9: ## %cond.load4
 ; SSE42-NEXT:    movlps {{.*#+}} xmm6 = mem[0,1],xmm6[2,3]
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB6_12
-; SSE42-NEXT:  LBB6_11: ## %cond.load13
+; SSE42-NEXT:  LBB6_11: ## %cond.load5
 ; SSE42-NEXT:    movhps {{.*#+}} xmm6 = xmm6[0,1],mem[0,1]
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB6_14
-; SSE42-NEXT:  LBB6_13: ## %cond.load16
+; SSE42-NEXT:  LBB6_13: ## %cond.load6
 ; SSE42-NEXT:    movlps {{.*#+}} xmm8 = mem[0,1],xmm8[2,3]
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB6_15
@@ -732,7 +732,7 @@ define <2 x float> @load_v2f32_v2i32(<2 x i32> %trigger, <2 x float>* %addr, <2
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB7_3
-; SSE2-NEXT:  LBB7_4: ## %else2
+; SSE2-NEXT:  LBB7_4: ## %else1
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB7_1: ## %cond.load
@@ -759,7 +759,7 @@ define <2 x float> @load_v2f32_v2i32(<2 x i32> %trigger, <2 x float>* %addr, <2
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB7_3
-; SSE42-NEXT:  LBB7_4: ## %else2
+; SSE42-NEXT:  LBB7_4: ## %else1
 ; SSE42-NEXT:    movaps %xmm1, %xmm0
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB7_1: ## %cond.load
@@ -826,7 +826,7 @@ define <2 x float> @load_v2f32_v2i32_undef(<2 x i32> %trigger, <2 x float>* %add
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB8_3
-; SSE2-NEXT:  LBB8_4: ## %else2
+; SSE2-NEXT:  LBB8_4: ## %else1
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB8_1: ## %cond.load
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
@@ -851,7 +851,7 @@ define <2 x float> @load_v2f32_v2i32_undef(<2 x i32> %trigger, <2 x float>* %add
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB8_3
-; SSE42-NEXT:  LBB8_4: ## %else2
+; SSE42-NEXT:  LBB8_4: ## %else1
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB8_1: ## %cond.load
 ; SSE42-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
@@ -911,13 +911,13 @@ define <4 x float> @load_v4f32_v4i32(<4 x i32> %trigger, <4 x float>* %addr, <4
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB9_3
-; SSE2-NEXT:  LBB9_4: ## %else2
+; SSE2-NEXT:  LBB9_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB9_5
-; SSE2-NEXT:  LBB9_6: ## %else5
+; SSE2-NEXT:  LBB9_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB9_7
-; SSE2-NEXT:  LBB9_8: ## %else8
+; SSE2-NEXT:  LBB9_8: ## %else3
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB9_1: ## %cond.load
@@ -932,13 +932,13 @@ define <4 x float> @load_v4f32_v4i32(<4 x i32> %trigger, <4 x float>* %addr, <4
 ; SSE2-NEXT:    movaps %xmm0, %xmm1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB9_6
-; SSE2-NEXT:  LBB9_5: ## %cond.load4
+; SSE2-NEXT:  LBB9_5: ## %cond.load2
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm1[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm0[0,2]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB9_8
-; SSE2-NEXT:  LBB9_7: ## %cond.load7
+; SSE2-NEXT:  LBB9_7: ## %cond.load3
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm1[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm0[2,0]
@@ -955,13 +955,13 @@ define <4 x float> @load_v4f32_v4i32(<4 x i32> %trigger, <4 x float>* %addr, <4
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB9_3
-; SSE42-NEXT:  LBB9_4: ## %else2
+; SSE42-NEXT:  LBB9_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB9_5
-; SSE42-NEXT:  LBB9_6: ## %else5
+; SSE42-NEXT:  LBB9_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB9_7
-; SSE42-NEXT:  LBB9_8: ## %else8
+; SSE42-NEXT:  LBB9_8: ## %else3
 ; SSE42-NEXT:    movaps %xmm1, %xmm0
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB9_1: ## %cond.load
@@ -973,11 +973,11 @@ define <4 x float> @load_v4f32_v4i32(<4 x i32> %trigger, <4 x float>* %addr, <4
 ; SSE42-NEXT:    insertps {{.*#+}} xmm1 = xmm1[0],mem[0],xmm1[2,3]
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB9_6
-; SSE42-NEXT:  LBB9_5: ## %cond.load4
+; SSE42-NEXT:  LBB9_5: ## %cond.load2
 ; SSE42-NEXT:    insertps {{.*#+}} xmm1 = xmm1[0,1],mem[0],xmm1[3]
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB9_8
-; SSE42-NEXT:  LBB9_7: ## %cond.load7
+; SSE42-NEXT:  LBB9_7: ## %cond.load3
 ; SSE42-NEXT:    insertps {{.*#+}} xmm1 = xmm1[0,1,2],mem[0]
 ; SSE42-NEXT:    movaps %xmm1, %xmm0
 ; SSE42-NEXT:    retq
@@ -1025,25 +1025,25 @@ define <8 x float> @load_v8f32_v8i1_zero(<8 x i1> %mask, <8 x float>* %addr) {
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB10_3
-; SSE2-NEXT:  LBB10_4: ## %else2
+; SSE2-NEXT:  LBB10_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB10_5
-; SSE2-NEXT:  LBB10_6: ## %else5
+; SSE2-NEXT:  LBB10_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB10_7
-; SSE2-NEXT:  LBB10_8: ## %else8
+; SSE2-NEXT:  LBB10_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB10_9
-; SSE2-NEXT:  LBB10_10: ## %else11
+; SSE2-NEXT:  LBB10_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB10_11
-; SSE2-NEXT:  LBB10_12: ## %else14
+; SSE2-NEXT:  LBB10_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB10_13
-; SSE2-NEXT:  LBB10_14: ## %else17
+; SSE2-NEXT:  LBB10_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB10_15
-; SSE2-NEXT:  LBB10_16: ## %else20
+; SSE2-NEXT:  LBB10_16: ## %else7
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB10_1: ## %cond.load
 ; SSE2-NEXT:    movd {{.*#+}} xmm0 = mem[0],zero,zero,zero
@@ -1057,37 +1057,37 @@ define <8 x float> @load_v8f32_v8i1_zero(<8 x i1> %mask, <8 x float>* %addr) {
 ; SSE2-NEXT:    movaps %xmm2, %xmm0
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB10_6
-; SSE2-NEXT:  LBB10_5: ## %cond.load4
+; SSE2-NEXT:  LBB10_5: ## %cond.load2
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm0[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,1],xmm2[0,2]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB10_8
-; SSE2-NEXT:  LBB10_7: ## %cond.load7
+; SSE2-NEXT:  LBB10_7: ## %cond.load3
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm0[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,1],xmm2[2,0]
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB10_10
-; SSE2-NEXT:  LBB10_9: ## %cond.load10
+; SSE2-NEXT:  LBB10_9: ## %cond.load4
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    movss {{.*#+}} xmm1 = xmm2[0],xmm1[1,2,3]
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB10_12
-; SSE2-NEXT:  LBB10_11: ## %cond.load13
+; SSE2-NEXT:  LBB10_11: ## %cond.load5
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm1[0,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[2,0],xmm1[2,3]
 ; SSE2-NEXT:    movaps %xmm2, %xmm1
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB10_14
-; SSE2-NEXT:  LBB10_13: ## %cond.load16
+; SSE2-NEXT:  LBB10_13: ## %cond.load6
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm1[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm2[0,2]
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB10_16
-; SSE2-NEXT:  LBB10_15: ## %cond.load19
+; SSE2-NEXT:  LBB10_15: ## %cond.load7
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm1[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm2[2,0]
@@ -1105,25 +1105,25 @@ define <8 x float> @load_v8f32_v8i1_zero(<8 x i1> %mask, <8 x float>* %addr) {
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB10_3
-; SSE42-NEXT:  LBB10_4: ## %else2
+; SSE42-NEXT:  LBB10_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB10_5
-; SSE42-NEXT:  LBB10_6: ## %else5
+; SSE42-NEXT:  LBB10_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB10_7
-; SSE42-NEXT:  LBB10_8: ## %else8
+; SSE42-NEXT:  LBB10_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB10_9
-; SSE42-NEXT:  LBB10_10: ## %else11
+; SSE42-NEXT:  LBB10_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB10_11
-; SSE42-NEXT:  LBB10_12: ## %else14
+; SSE42-NEXT:  LBB10_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB10_13
-; SSE42-NEXT:  LBB10_14: ## %else17
+; SSE42-NEXT:  LBB10_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB10_15
-; SSE42-NEXT:  LBB10_16: ## %else20
+; SSE42-NEXT:  LBB10_16: ## %else7
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB10_1: ## %cond.load
 ; SSE42-NEXT:    movd {{.*#+}} xmm0 = mem[0],zero,zero,zero
@@ -1134,28 +1134,28 @@ define <8 x float> @load_v8f32_v8i1_zero(<8 x i1> %mask, <8 x float>* %addr) {
 ; SSE42-NEXT:    insertps {{.*#+}} xmm0 = xmm0[0],mem[0],xmm0[2,3]
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB10_6
-; SSE42-NEXT:  LBB10_5: ## %cond.load4
+; SSE42-NEXT:  LBB10_5: ## %cond.load2
 ; SSE42-NEXT:    insertps {{.*#+}} xmm0 = xmm0[0,1],mem[0],xmm0[3]
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB10_8
-; SSE42-NEXT:  LBB10_7: ## %cond.load7
+; SSE42-NEXT:  LBB10_7: ## %cond.load3
 ; SSE42-NEXT:    insertps {{.*#+}} xmm0 = xmm0[0,1,2],mem[0]
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB10_10
-; SSE42-NEXT:  LBB10_9: ## %cond.load10
+; SSE42-NEXT:  LBB10_9: ## %cond.load4
 ; SSE42-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE42-NEXT:    blendps {{.*#+}} xmm1 = xmm2[0],xmm1[1,2,3]
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB10_12
-; SSE42-NEXT:  LBB10_11: ## %cond.load13
+; SSE42-NEXT:  LBB10_11: ## %cond.load5
 ; SSE42-NEXT:    insertps {{.*#+}} xmm1 = xmm1[0],mem[0],xmm1[2,3]
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB10_14
-; SSE42-NEXT:  LBB10_13: ## %cond.load16
+; SSE42-NEXT:  LBB10_13: ## %cond.load6
 ; SSE42-NEXT:    insertps {{.*#+}} xmm1 = xmm1[0,1],mem[0],xmm1[3]
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB10_16
-; SSE42-NEXT:  LBB10_15: ## %cond.load19
+; SSE42-NEXT:  LBB10_15: ## %cond.load7
 ; SSE42-NEXT:    insertps {{.*#+}} xmm1 = xmm1[0,1,2],mem[0]
 ; SSE42-NEXT:    retq
 ;
@@ -1220,29 +1220,29 @@ define <8 x float> @load_v8f32_v8i32(<8 x i32> %trigger, <8 x float>* %addr, <8
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB11_3
-; SSE2-NEXT:  LBB11_4: ## %else2
+; SSE2-NEXT:  LBB11_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB11_5
-; SSE2-NEXT:  LBB11_6: ## %else5
+; SSE2-NEXT:  LBB11_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB11_7
-; SSE2-NEXT:  LBB11_8: ## %else8
+; SSE2-NEXT:  LBB11_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB11_9
-; SSE2-NEXT:  LBB11_10: ## %else11
+; SSE2-NEXT:  LBB11_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB11_11
-; SSE2-NEXT:  LBB11_12: ## %else14
+; SSE2-NEXT:  LBB11_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB11_13
-; SSE2-NEXT:  LBB11_14: ## %else17
+; SSE2-NEXT:  LBB11_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB11_16
-; SSE2-NEXT:  LBB11_15: ## %cond.load19
+; SSE2-NEXT:  LBB11_15: ## %cond.load7
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm3[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm3 = xmm3[0,1],xmm0[2,0]
-; SSE2-NEXT:  LBB11_16: ## %else20
+; SSE2-NEXT:  LBB11_16: ## %else7
 ; SSE2-NEXT:    movaps %xmm2, %xmm0
 ; SSE2-NEXT:    movaps %xmm3, %xmm1
 ; SSE2-NEXT:    retq
@@ -1258,31 +1258,31 @@ define <8 x float> @load_v8f32_v8i32(<8 x i32> %trigger, <8 x float>* %addr, <8
 ; SSE2-NEXT:    movaps %xmm0, %xmm2
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB11_6
-; SSE2-NEXT:  LBB11_5: ## %cond.load4
+; SSE2-NEXT:  LBB11_5: ## %cond.load2
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm2[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,1],xmm0[0,2]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB11_8
-; SSE2-NEXT:  LBB11_7: ## %cond.load7
+; SSE2-NEXT:  LBB11_7: ## %cond.load3
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm2[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,1],xmm0[2,0]
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB11_10
-; SSE2-NEXT:  LBB11_9: ## %cond.load10
+; SSE2-NEXT:  LBB11_9: ## %cond.load4
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    movss {{.*#+}} xmm3 = xmm0[0],xmm3[1,2,3]
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB11_12
-; SSE2-NEXT:  LBB11_11: ## %cond.load13
+; SSE2-NEXT:  LBB11_11: ## %cond.load5
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm3[0,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[2,0],xmm3[2,3]
 ; SSE2-NEXT:    movaps %xmm0, %xmm3
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB11_14
-; SSE2-NEXT:  LBB11_13: ## %cond.load16
+; SSE2-NEXT:  LBB11_13: ## %cond.load6
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm3[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm3 = xmm3[0,1],xmm0[0,2]
@@ -1303,27 +1303,27 @@ define <8 x float> @load_v8f32_v8i32(<8 x i32> %trigger, <8 x float>* %addr, <8
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB11_3
-; SSE42-NEXT:  LBB11_4: ## %else2
+; SSE42-NEXT:  LBB11_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB11_5
-; SSE42-NEXT:  LBB11_6: ## %else5
+; SSE42-NEXT:  LBB11_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB11_7
-; SSE42-NEXT:  LBB11_8: ## %else8
+; SSE42-NEXT:  LBB11_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB11_9
-; SSE42-NEXT:  LBB11_10: ## %else11
+; SSE42-NEXT:  LBB11_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB11_11
-; SSE42-NEXT:  LBB11_12: ## %else14
+; SSE42-NEXT:  LBB11_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB11_13
-; SSE42-NEXT:  LBB11_14: ## %else17
+; SSE42-NEXT:  LBB11_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB11_16
-; SSE42-NEXT:  LBB11_15: ## %cond.load19
+; SSE42-NEXT:  LBB11_15: ## %cond.load7
 ; SSE42-NEXT:    insertps {{.*#+}} xmm3 = xmm3[0,1,2],mem[0]
-; SSE42-NEXT:  LBB11_16: ## %else20
+; SSE42-NEXT:  LBB11_16: ## %else7
 ; SSE42-NEXT:    movaps %xmm2, %xmm0
 ; SSE42-NEXT:    movaps %xmm3, %xmm1
 ; SSE42-NEXT:    retq
@@ -1336,24 +1336,24 @@ define <8 x float> @load_v8f32_v8i32(<8 x i32> %trigger, <8 x float>* %addr, <8
 ; SSE42-NEXT:    insertps {{.*#+}} xmm2 = xmm2[0],mem[0],xmm2[2,3]
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB11_6
-; SSE42-NEXT:  LBB11_5: ## %cond.load4
+; SSE42-NEXT:  LBB11_5: ## %cond.load2
 ; SSE42-NEXT:    insertps {{.*#+}} xmm2 = xmm2[0,1],mem[0],xmm2[3]
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB11_8
-; SSE42-NEXT:  LBB11_7: ## %cond.load7
+; SSE42-NEXT:  LBB11_7: ## %cond.load3
 ; SSE42-NEXT:    insertps {{.*#+}} xmm2 = xmm2[0,1,2],mem[0]
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB11_10
-; SSE42-NEXT:  LBB11_9: ## %cond.load10
+; SSE42-NEXT:  LBB11_9: ## %cond.load4
 ; SSE42-NEXT:    movd {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE42-NEXT:    pblendw {{.*#+}} xmm3 = xmm0[0,1],xmm3[2,3,4,5,6,7]
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB11_12
-; SSE42-NEXT:  LBB11_11: ## %cond.load13
+; SSE42-NEXT:  LBB11_11: ## %cond.load5
 ; SSE42-NEXT:    insertps {{.*#+}} xmm3 = xmm3[0],mem[0],xmm3[2,3]
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB11_14
-; SSE42-NEXT:  LBB11_13: ## %cond.load16
+; SSE42-NEXT:  LBB11_13: ## %cond.load6
 ; SSE42-NEXT:    insertps {{.*#+}} xmm3 = xmm3[0,1],mem[0],xmm3[3]
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB11_15
@@ -1444,7 +1444,7 @@ define <2 x i64> @load_v2i64_v2i64(<2 x i64> %trigger, <2 x i64>* %addr, <2 x i6
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB13_3
-; SSE2-NEXT:  LBB13_4: ## %else2
+; SSE2-NEXT:  LBB13_4: ## %else1
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB13_1: ## %cond.load
@@ -1467,7 +1467,7 @@ define <2 x i64> @load_v2i64_v2i64(<2 x i64> %trigger, <2 x i64>* %addr, <2 x i6
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB13_3
-; SSE42-NEXT:  LBB13_4: ## %else2
+; SSE42-NEXT:  LBB13_4: ## %else1
 ; SSE42-NEXT:    movdqa %xmm1, %xmm0
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB13_1: ## %cond.load
@@ -1534,16 +1534,16 @@ define <4 x i64> @load_v4i64_v4i64(<4 x i64> %trigger, <4 x i64>* %addr, <4 x i6
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB14_3
-; SSE2-NEXT:  LBB14_4: ## %else2
+; SSE2-NEXT:  LBB14_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB14_5
-; SSE2-NEXT:  LBB14_6: ## %else5
+; SSE2-NEXT:  LBB14_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB14_8
-; SSE2-NEXT:  LBB14_7: ## %cond.load7
+; SSE2-NEXT:  LBB14_7: ## %cond.load3
 ; SSE2-NEXT:    movsd {{.*#+}} xmm0 = mem[0],zero
 ; SSE2-NEXT:    movlhps {{.*#+}} xmm3 = xmm3[0],xmm0[0]
-; SSE2-NEXT:  LBB14_8: ## %else8
+; SSE2-NEXT:  LBB14_8: ## %else3
 ; SSE2-NEXT:    movaps %xmm2, %xmm0
 ; SSE2-NEXT:    movaps %xmm3, %xmm1
 ; SSE2-NEXT:    retq
@@ -1556,7 +1556,7 @@ define <4 x i64> @load_v4i64_v4i64(<4 x i64> %trigger, <4 x i64>* %addr, <4 x i6
 ; SSE2-NEXT:    movlhps {{.*#+}} xmm2 = xmm2[0],xmm0[0]
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB14_6
-; SSE2-NEXT:  LBB14_5: ## %cond.load4
+; SSE2-NEXT:  LBB14_5: ## %cond.load2
 ; SSE2-NEXT:    movlps {{.*#+}} xmm3 = mem[0,1],xmm3[2,3]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB14_7
@@ -1574,15 +1574,15 @@ define <4 x i64> @load_v4i64_v4i64(<4 x i64> %trigger, <4 x i64>* %addr, <4 x i6
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB14_3
-; SSE42-NEXT:  LBB14_4: ## %else2
+; SSE42-NEXT:  LBB14_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB14_5
-; SSE42-NEXT:  LBB14_6: ## %else5
+; SSE42-NEXT:  LBB14_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB14_8
-; SSE42-NEXT:  LBB14_7: ## %cond.load7
+; SSE42-NEXT:  LBB14_7: ## %cond.load3
 ; SSE42-NEXT:    pinsrq $1, 24(%rdi), %xmm3
-; SSE42-NEXT:  LBB14_8: ## %else8
+; SSE42-NEXT:  LBB14_8: ## %else3
 ; SSE42-NEXT:    movdqa %xmm2, %xmm0
 ; SSE42-NEXT:    movdqa %xmm3, %xmm1
 ; SSE42-NEXT:    retq
@@ -1594,7 +1594,7 @@ define <4 x i64> @load_v4i64_v4i64(<4 x i64> %trigger, <4 x i64>* %addr, <4 x i6
 ; SSE42-NEXT:    pinsrq $1, 8(%rdi), %xmm2
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB14_6
-; SSE42-NEXT:  LBB14_5: ## %cond.load4
+; SSE42-NEXT:  LBB14_5: ## %cond.load2
 ; SSE42-NEXT:    pinsrq $0, 16(%rdi), %xmm3
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB14_7
@@ -1652,28 +1652,28 @@ define <8 x i64> @load_v8i64_v8i16(<8 x i16> %trigger, <8 x i64>* %addr, <8 x i6
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB15_3
-; SSE2-NEXT:  LBB15_4: ## %else2
+; SSE2-NEXT:  LBB15_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB15_5
-; SSE2-NEXT:  LBB15_6: ## %else5
+; SSE2-NEXT:  LBB15_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB15_7
-; SSE2-NEXT:  LBB15_8: ## %else8
+; SSE2-NEXT:  LBB15_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB15_9
-; SSE2-NEXT:  LBB15_10: ## %else11
+; SSE2-NEXT:  LBB15_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB15_11
-; SSE2-NEXT:  LBB15_12: ## %else14
+; SSE2-NEXT:  LBB15_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB15_13
-; SSE2-NEXT:  LBB15_14: ## %else17
+; SSE2-NEXT:  LBB15_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB15_16
-; SSE2-NEXT:  LBB15_15: ## %cond.load19
+; SSE2-NEXT:  LBB15_15: ## %cond.load7
 ; SSE2-NEXT:    movsd {{.*#+}} xmm0 = mem[0],zero
 ; SSE2-NEXT:    movlhps {{.*#+}} xmm4 = xmm4[0],xmm0[0]
-; SSE2-NEXT:  LBB15_16: ## %else20
+; SSE2-NEXT:  LBB15_16: ## %else7
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    movaps %xmm2, %xmm1
 ; SSE2-NEXT:    movaps %xmm3, %xmm2
@@ -1688,25 +1688,25 @@ define <8 x i64> @load_v8i64_v8i16(<8 x i16> %trigger, <8 x i64>* %addr, <8 x i6
 ; SSE2-NEXT:    movlhps {{.*#+}} xmm1 = xmm1[0],xmm0[0]
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB15_6
-; SSE2-NEXT:  LBB15_5: ## %cond.load4
+; SSE2-NEXT:  LBB15_5: ## %cond.load2
 ; SSE2-NEXT:    movlps {{.*#+}} xmm2 = mem[0,1],xmm2[2,3]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB15_8
-; SSE2-NEXT:  LBB15_7: ## %cond.load7
+; SSE2-NEXT:  LBB15_7: ## %cond.load3
 ; SSE2-NEXT:    movsd {{.*#+}} xmm0 = mem[0],zero
 ; SSE2-NEXT:    movlhps {{.*#+}} xmm2 = xmm2[0],xmm0[0]
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB15_10
-; SSE2-NEXT:  LBB15_9: ## %cond.load10
+; SSE2-NEXT:  LBB15_9: ## %cond.load4
 ; SSE2-NEXT:    movlps {{.*#+}} xmm3 = mem[0,1],xmm3[2,3]
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB15_12
-; SSE2-NEXT:  LBB15_11: ## %cond.load13
+; SSE2-NEXT:  LBB15_11: ## %cond.load5
 ; SSE2-NEXT:    movsd {{.*#+}} xmm0 = mem[0],zero
 ; SSE2-NEXT:    movlhps {{.*#+}} xmm3 = xmm3[0],xmm0[0]
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB15_14
-; SSE2-NEXT:  LBB15_13: ## %cond.load16
+; SSE2-NEXT:  LBB15_13: ## %cond.load6
 ; SSE2-NEXT:    movlps {{.*#+}} xmm4 = mem[0,1],xmm4[2,3]
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB15_15
@@ -1723,27 +1723,27 @@ define <8 x i64> @load_v8i64_v8i16(<8 x i16> %trigger, <8 x i64>* %addr, <8 x i6
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB15_3
-; SSE42-NEXT:  LBB15_4: ## %else2
+; SSE42-NEXT:  LBB15_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB15_5
-; SSE42-NEXT:  LBB15_6: ## %else5
+; SSE42-NEXT:  LBB15_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB15_7
-; SSE42-NEXT:  LBB15_8: ## %else8
+; SSE42-NEXT:  LBB15_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB15_9
-; SSE42-NEXT:  LBB15_10: ## %else11
+; SSE42-NEXT:  LBB15_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB15_11
-; SSE42-NEXT:  LBB15_12: ## %else14
+; SSE42-NEXT:  LBB15_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB15_13
-; SSE42-NEXT:  LBB15_14: ## %else17
+; SSE42-NEXT:  LBB15_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB15_16
-; SSE42-NEXT:  LBB15_15: ## %cond.load19
+; SSE42-NEXT:  LBB15_15: ## %cond.load7
 ; SSE42-NEXT:    pinsrq $1, 56(%rdi), %xmm4
-; SSE42-NEXT:  LBB15_16: ## %else20
+; SSE42-NEXT:  LBB15_16: ## %else7
 ; SSE42-NEXT:    movdqa %xmm1, %xmm0
 ; SSE42-NEXT:    movdqa %xmm2, %xmm1
 ; SSE42-NEXT:    movdqa %xmm3, %xmm2
@@ -1757,23 +1757,23 @@ define <8 x i64> @load_v8i64_v8i16(<8 x i16> %trigger, <8 x i64>* %addr, <8 x i6
 ; SSE42-NEXT:    pinsrq $1, 8(%rdi), %xmm1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB15_6
-; SSE42-NEXT:  LBB15_5: ## %cond.load4
+; SSE42-NEXT:  LBB15_5: ## %cond.load2
 ; SSE42-NEXT:    pinsrq $0, 16(%rdi), %xmm2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB15_8
-; SSE42-NEXT:  LBB15_7: ## %cond.load7
+; SSE42-NEXT:  LBB15_7: ## %cond.load3
 ; SSE42-NEXT:    pinsrq $1, 24(%rdi), %xmm2
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB15_10
-; SSE42-NEXT:  LBB15_9: ## %cond.load10
+; SSE42-NEXT:  LBB15_9: ## %cond.load4
 ; SSE42-NEXT:    pinsrq $0, 32(%rdi), %xmm3
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB15_12
-; SSE42-NEXT:  LBB15_11: ## %cond.load13
+; SSE42-NEXT:  LBB15_11: ## %cond.load5
 ; SSE42-NEXT:    pinsrq $1, 40(%rdi), %xmm3
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB15_14
-; SSE42-NEXT:  LBB15_13: ## %cond.load16
+; SSE42-NEXT:  LBB15_13: ## %cond.load6
 ; SSE42-NEXT:    pinsrq $0, 48(%rdi), %xmm4
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB15_15
@@ -1871,28 +1871,28 @@ define <8 x i64> @load_v8i64_v8i64(<8 x i64> %trigger, <8 x i64>* %addr, <8 x i6
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB16_3
-; SSE2-NEXT:  LBB16_4: ## %else2
+; SSE2-NEXT:  LBB16_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB16_5
-; SSE2-NEXT:  LBB16_6: ## %else5
+; SSE2-NEXT:  LBB16_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB16_7
-; SSE2-NEXT:  LBB16_8: ## %else8
+; SSE2-NEXT:  LBB16_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB16_9
-; SSE2-NEXT:  LBB16_10: ## %else11
+; SSE2-NEXT:  LBB16_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB16_11
-; SSE2-NEXT:  LBB16_12: ## %else14
+; SSE2-NEXT:  LBB16_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB16_13
-; SSE2-NEXT:  LBB16_14: ## %else17
+; SSE2-NEXT:  LBB16_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB16_16
-; SSE2-NEXT:  LBB16_15: ## %cond.load19
+; SSE2-NEXT:  LBB16_15: ## %cond.load7
 ; SSE2-NEXT:    movq {{.*#+}} xmm0 = mem[0],zero
 ; SSE2-NEXT:    punpcklqdq {{.*#+}} xmm8 = xmm8[0],xmm0[0]
-; SSE2-NEXT:  LBB16_16: ## %else20
+; SSE2-NEXT:  LBB16_16: ## %else7
 ; SSE2-NEXT:    movaps %xmm4, %xmm0
 ; SSE2-NEXT:    movaps %xmm5, %xmm1
 ; SSE2-NEXT:    movaps %xmm9, %xmm2
@@ -1907,25 +1907,25 @@ define <8 x i64> @load_v8i64_v8i64(<8 x i64> %trigger, <8 x i64>* %addr, <8 x i6
 ; SSE2-NEXT:    movlhps {{.*#+}} xmm4 = xmm4[0],xmm0[0]
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB16_6
-; SSE2-NEXT:  LBB16_5: ## %cond.load4
+; SSE2-NEXT:  LBB16_5: ## %cond.load2
 ; SSE2-NEXT:    movlps {{.*#+}} xmm5 = mem[0,1],xmm5[2,3]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB16_8
-; SSE2-NEXT:  LBB16_7: ## %cond.load7
+; SSE2-NEXT:  LBB16_7: ## %cond.load3
 ; SSE2-NEXT:    movsd {{.*#+}} xmm0 = mem[0],zero
 ; SSE2-NEXT:    movlhps {{.*#+}} xmm5 = xmm5[0],xmm0[0]
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB16_10
-; SSE2-NEXT:  LBB16_9: ## %cond.load10
+; SSE2-NEXT:  LBB16_9: ## %cond.load4
 ; SSE2-NEXT:    movlps {{.*#+}} xmm9 = mem[0,1],xmm9[2,3]
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB16_12
-; SSE2-NEXT:  LBB16_11: ## %cond.load13
+; SSE2-NEXT:  LBB16_11: ## %cond.load5
 ; SSE2-NEXT:    movsd {{.*#+}} xmm0 = mem[0],zero
 ; SSE2-NEXT:    movlhps {{.*#+}} xmm9 = xmm9[0],xmm0[0]
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB16_14
-; SSE2-NEXT:  LBB16_13: ## %cond.load16
+; SSE2-NEXT:  LBB16_13: ## %cond.load6
 ; SSE2-NEXT:    movlps {{.*#+}} xmm8 = mem[0,1],xmm8[2,3]
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB16_15
@@ -1949,27 +1949,27 @@ define <8 x i64> @load_v8i64_v8i64(<8 x i64> %trigger, <8 x i64>* %addr, <8 x i6
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB16_3
-; SSE42-NEXT:  LBB16_4: ## %else2
+; SSE42-NEXT:  LBB16_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB16_5
-; SSE42-NEXT:  LBB16_6: ## %else5
+; SSE42-NEXT:  LBB16_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB16_7
-; SSE42-NEXT:  LBB16_8: ## %else8
+; SSE42-NEXT:  LBB16_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB16_9
-; SSE42-NEXT:  LBB16_10: ## %else11
+; SSE42-NEXT:  LBB16_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB16_11
-; SSE42-NEXT:  LBB16_12: ## %else14
+; SSE42-NEXT:  LBB16_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB16_13
-; SSE42-NEXT:  LBB16_14: ## %else17
+; SSE42-NEXT:  LBB16_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB16_16
-; SSE42-NEXT:  LBB16_15: ## %cond.load19
+; SSE42-NEXT:  LBB16_15: ## %cond.load7
 ; SSE42-NEXT:    pinsrq $1, 56(%rdi), %xmm8
-; SSE42-NEXT:  LBB16_16: ## %else20
+; SSE42-NEXT:  LBB16_16: ## %else7
 ; SSE42-NEXT:    movdqa %xmm4, %xmm0
 ; SSE42-NEXT:    movdqa %xmm5, %xmm1
 ; SSE42-NEXT:    movdqa %xmm6, %xmm2
@@ -1983,23 +1983,23 @@ define <8 x i64> @load_v8i64_v8i64(<8 x i64> %trigger, <8 x i64>* %addr, <8 x i6
 ; SSE42-NEXT:    pinsrq $1, 8(%rdi), %xmm4
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB16_6
-; SSE42-NEXT:  LBB16_5: ## %cond.load4
+; SSE42-NEXT:  LBB16_5: ## %cond.load2
 ; SSE42-NEXT:    pinsrq $0, 16(%rdi), %xmm5
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB16_8
-; SSE42-NEXT:  LBB16_7: ## %cond.load7
+; SSE42-NEXT:  LBB16_7: ## %cond.load3
 ; SSE42-NEXT:    pinsrq $1, 24(%rdi), %xmm5
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB16_10
-; SSE42-NEXT:  LBB16_9: ## %cond.load10
+; SSE42-NEXT:  LBB16_9: ## %cond.load4
 ; SSE42-NEXT:    pinsrq $0, 32(%rdi), %xmm6
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB16_12
-; SSE42-NEXT:  LBB16_11: ## %cond.load13
+; SSE42-NEXT:  LBB16_11: ## %cond.load5
 ; SSE42-NEXT:    pinsrq $1, 40(%rdi), %xmm6
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB16_14
-; SSE42-NEXT:  LBB16_13: ## %cond.load16
+; SSE42-NEXT:  LBB16_13: ## %cond.load6
 ; SSE42-NEXT:    pinsrq $0, 48(%rdi), %xmm8
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB16_15
@@ -2059,7 +2059,7 @@ define <2 x i32> @load_v2i32_v2i32(<2 x i32> %trigger, <2 x i32>* %addr, <2 x i3
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB17_3
-; SSE2-NEXT:  LBB17_4: ## %else2
+; SSE2-NEXT:  LBB17_4: ## %else1
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB17_1: ## %cond.load
@@ -2086,7 +2086,7 @@ define <2 x i32> @load_v2i32_v2i32(<2 x i32> %trigger, <2 x i32>* %addr, <2 x i3
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB17_3
-; SSE42-NEXT:  LBB17_4: ## %else2
+; SSE42-NEXT:  LBB17_4: ## %else1
 ; SSE42-NEXT:    movdqa %xmm1, %xmm0
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB17_1: ## %cond.load
@@ -2159,13 +2159,13 @@ define <4 x i32> @load_v4i32_v4i32(<4 x i32> %trigger, <4 x i32>* %addr, <4 x i3
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB18_3
-; SSE2-NEXT:  LBB18_4: ## %else2
+; SSE2-NEXT:  LBB18_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB18_5
-; SSE2-NEXT:  LBB18_6: ## %else5
+; SSE2-NEXT:  LBB18_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB18_7
-; SSE2-NEXT:  LBB18_8: ## %else8
+; SSE2-NEXT:  LBB18_8: ## %else3
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB18_1: ## %cond.load
@@ -2180,13 +2180,13 @@ define <4 x i32> @load_v4i32_v4i32(<4 x i32> %trigger, <4 x i32>* %addr, <4 x i3
 ; SSE2-NEXT:    movaps %xmm0, %xmm1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB18_6
-; SSE2-NEXT:  LBB18_5: ## %cond.load4
+; SSE2-NEXT:  LBB18_5: ## %cond.load2
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm1[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm0[0,2]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB18_8
-; SSE2-NEXT:  LBB18_7: ## %cond.load7
+; SSE2-NEXT:  LBB18_7: ## %cond.load3
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm1[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm0[2,0]
@@ -2203,13 +2203,13 @@ define <4 x i32> @load_v4i32_v4i32(<4 x i32> %trigger, <4 x i32>* %addr, <4 x i3
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB18_3
-; SSE42-NEXT:  LBB18_4: ## %else2
+; SSE42-NEXT:  LBB18_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB18_5
-; SSE42-NEXT:  LBB18_6: ## %else5
+; SSE42-NEXT:  LBB18_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB18_7
-; SSE42-NEXT:  LBB18_8: ## %else8
+; SSE42-NEXT:  LBB18_8: ## %else3
 ; SSE42-NEXT:    movdqa %xmm1, %xmm0
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB18_1: ## %cond.load
@@ -2220,11 +2220,11 @@ define <4 x i32> @load_v4i32_v4i32(<4 x i32> %trigger, <4 x i32>* %addr, <4 x i3
 ; SSE42-NEXT:    pinsrd $1, 4(%rdi), %xmm1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB18_6
-; SSE42-NEXT:  LBB18_5: ## %cond.load4
+; SSE42-NEXT:  LBB18_5: ## %cond.load2
 ; SSE42-NEXT:    pinsrd $2, 8(%rdi), %xmm1
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB18_8
-; SSE42-NEXT:  LBB18_7: ## %cond.load7
+; SSE42-NEXT:  LBB18_7: ## %cond.load3
 ; SSE42-NEXT:    pinsrd $3, 12(%rdi), %xmm1
 ; SSE42-NEXT:    movdqa %xmm1, %xmm0
 ; SSE42-NEXT:    retq
@@ -2278,29 +2278,29 @@ define <8 x i32> @load_v8i32_v8i1(<8 x i1> %mask, <8 x i32>* %addr, <8 x i32> %d
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB19_3
-; SSE2-NEXT:  LBB19_4: ## %else2
+; SSE2-NEXT:  LBB19_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB19_5
-; SSE2-NEXT:  LBB19_6: ## %else5
+; SSE2-NEXT:  LBB19_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB19_7
-; SSE2-NEXT:  LBB19_8: ## %else8
+; SSE2-NEXT:  LBB19_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB19_9
-; SSE2-NEXT:  LBB19_10: ## %else11
+; SSE2-NEXT:  LBB19_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB19_11
-; SSE2-NEXT:  LBB19_12: ## %else14
+; SSE2-NEXT:  LBB19_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB19_13
-; SSE2-NEXT:  LBB19_14: ## %else17
+; SSE2-NEXT:  LBB19_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB19_16
-; SSE2-NEXT:  LBB19_15: ## %cond.load19
+; SSE2-NEXT:  LBB19_15: ## %cond.load7
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm2[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,1],xmm0[2,0]
-; SSE2-NEXT:  LBB19_16: ## %else20
+; SSE2-NEXT:  LBB19_16: ## %else7
 ; SSE2-NEXT:    movaps %xmm1, %xmm0
 ; SSE2-NEXT:    movaps %xmm2, %xmm1
 ; SSE2-NEXT:    retq
@@ -2316,31 +2316,31 @@ define <8 x i32> @load_v8i32_v8i1(<8 x i1> %mask, <8 x i32>* %addr, <8 x i32> %d
 ; SSE2-NEXT:    movaps %xmm0, %xmm1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB19_6
-; SSE2-NEXT:  LBB19_5: ## %cond.load4
+; SSE2-NEXT:  LBB19_5: ## %cond.load2
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm1[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm0[0,2]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB19_8
-; SSE2-NEXT:  LBB19_7: ## %cond.load7
+; SSE2-NEXT:  LBB19_7: ## %cond.load3
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm1[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm0[2,0]
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB19_10
-; SSE2-NEXT:  LBB19_9: ## %cond.load10
+; SSE2-NEXT:  LBB19_9: ## %cond.load4
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = xmm0[0],xmm2[1,2,3]
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB19_12
-; SSE2-NEXT:  LBB19_11: ## %cond.load13
+; SSE2-NEXT:  LBB19_11: ## %cond.load5
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm2[0,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[2,0],xmm2[2,3]
 ; SSE2-NEXT:    movaps %xmm0, %xmm2
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB19_14
-; SSE2-NEXT:  LBB19_13: ## %cond.load16
+; SSE2-NEXT:  LBB19_13: ## %cond.load6
 ; SSE2-NEXT:    movss {{.*#+}} xmm0 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,0],xmm2[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,1],xmm0[0,2]
@@ -2358,27 +2358,27 @@ define <8 x i32> @load_v8i32_v8i1(<8 x i1> %mask, <8 x i32>* %addr, <8 x i32> %d
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB19_3
-; SSE42-NEXT:  LBB19_4: ## %else2
+; SSE42-NEXT:  LBB19_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB19_5
-; SSE42-NEXT:  LBB19_6: ## %else5
+; SSE42-NEXT:  LBB19_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB19_7
-; SSE42-NEXT:  LBB19_8: ## %else8
+; SSE42-NEXT:  LBB19_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB19_9
-; SSE42-NEXT:  LBB19_10: ## %else11
+; SSE42-NEXT:  LBB19_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB19_11
-; SSE42-NEXT:  LBB19_12: ## %else14
+; SSE42-NEXT:  LBB19_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB19_13
-; SSE42-NEXT:  LBB19_14: ## %else17
+; SSE42-NEXT:  LBB19_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB19_16
-; SSE42-NEXT:  LBB19_15: ## %cond.load19
+; SSE42-NEXT:  LBB19_15: ## %cond.load7
 ; SSE42-NEXT:    pinsrd $3, 28(%rdi), %xmm2
-; SSE42-NEXT:  LBB19_16: ## %else20
+; SSE42-NEXT:  LBB19_16: ## %else7
 ; SSE42-NEXT:    movdqa %xmm1, %xmm0
 ; SSE42-NEXT:    movdqa %xmm2, %xmm1
 ; SSE42-NEXT:    retq
@@ -2390,23 +2390,23 @@ define <8 x i32> @load_v8i32_v8i1(<8 x i1> %mask, <8 x i32>* %addr, <8 x i32> %d
 ; SSE42-NEXT:    pinsrd $1, 4(%rdi), %xmm1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB19_6
-; SSE42-NEXT:  LBB19_5: ## %cond.load4
+; SSE42-NEXT:  LBB19_5: ## %cond.load2
 ; SSE42-NEXT:    pinsrd $2, 8(%rdi), %xmm1
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB19_8
-; SSE42-NEXT:  LBB19_7: ## %cond.load7
+; SSE42-NEXT:  LBB19_7: ## %cond.load3
 ; SSE42-NEXT:    pinsrd $3, 12(%rdi), %xmm1
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB19_10
-; SSE42-NEXT:  LBB19_9: ## %cond.load10
+; SSE42-NEXT:  LBB19_9: ## %cond.load4
 ; SSE42-NEXT:    pinsrd $0, 16(%rdi), %xmm2
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB19_12
-; SSE42-NEXT:  LBB19_11: ## %cond.load13
+; SSE42-NEXT:  LBB19_11: ## %cond.load5
 ; SSE42-NEXT:    pinsrd $1, 20(%rdi), %xmm2
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB19_14
-; SSE42-NEXT:  LBB19_13: ## %cond.load16
+; SSE42-NEXT:  LBB19_13: ## %cond.load6
 ; SSE42-NEXT:    pinsrd $2, 24(%rdi), %xmm2
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB19_15
@@ -2475,25 +2475,25 @@ define <8 x i32> @load_v8i32_v8i1_zero(<8 x i1> %mask, <8 x i32>* %addr) {
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB20_3
-; SSE2-NEXT:  LBB20_4: ## %else2
+; SSE2-NEXT:  LBB20_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB20_5
-; SSE2-NEXT:  LBB20_6: ## %else5
+; SSE2-NEXT:  LBB20_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB20_7
-; SSE2-NEXT:  LBB20_8: ## %else8
+; SSE2-NEXT:  LBB20_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB20_9
-; SSE2-NEXT:  LBB20_10: ## %else11
+; SSE2-NEXT:  LBB20_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB20_11
-; SSE2-NEXT:  LBB20_12: ## %else14
+; SSE2-NEXT:  LBB20_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB20_13
-; SSE2-NEXT:  LBB20_14: ## %else17
+; SSE2-NEXT:  LBB20_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB20_15
-; SSE2-NEXT:  LBB20_16: ## %else20
+; SSE2-NEXT:  LBB20_16: ## %else7
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB20_1: ## %cond.load
 ; SSE2-NEXT:    movd {{.*#+}} xmm0 = mem[0],zero,zero,zero
@@ -2507,37 +2507,37 @@ define <8 x i32> @load_v8i32_v8i1_zero(<8 x i1> %mask, <8 x i32>* %addr) {
 ; SSE2-NEXT:    movaps %xmm2, %xmm0
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB20_6
-; SSE2-NEXT:  LBB20_5: ## %cond.load4
+; SSE2-NEXT:  LBB20_5: ## %cond.load2
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm0[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,1],xmm2[0,2]
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB20_8
-; SSE2-NEXT:  LBB20_7: ## %cond.load7
+; SSE2-NEXT:  LBB20_7: ## %cond.load3
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm0[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm0 = xmm0[0,1],xmm2[2,0]
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB20_10
-; SSE2-NEXT:  LBB20_9: ## %cond.load10
+; SSE2-NEXT:  LBB20_9: ## %cond.load4
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    movss {{.*#+}} xmm1 = xmm2[0],xmm1[1,2,3]
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB20_12
-; SSE2-NEXT:  LBB20_11: ## %cond.load13
+; SSE2-NEXT:  LBB20_11: ## %cond.load5
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm1[0,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[2,0],xmm1[2,3]
 ; SSE2-NEXT:    movaps %xmm2, %xmm1
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB20_14
-; SSE2-NEXT:  LBB20_13: ## %cond.load16
+; SSE2-NEXT:  LBB20_13: ## %cond.load6
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm1[3,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm2[0,2]
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB20_16
-; SSE2-NEXT:  LBB20_15: ## %cond.load19
+; SSE2-NEXT:  LBB20_15: ## %cond.load7
 ; SSE2-NEXT:    movss {{.*#+}} xmm2 = mem[0],zero,zero,zero
 ; SSE2-NEXT:    shufps {{.*#+}} xmm2 = xmm2[0,0],xmm1[2,0]
 ; SSE2-NEXT:    shufps {{.*#+}} xmm1 = xmm1[0,1],xmm2[2,0]
@@ -2555,25 +2555,25 @@ define <8 x i32> @load_v8i32_v8i1_zero(<8 x i1> %mask, <8 x i32>* %addr) {
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB20_3
-; SSE42-NEXT:  LBB20_4: ## %else2
+; SSE42-NEXT:  LBB20_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB20_5
-; SSE42-NEXT:  LBB20_6: ## %else5
+; SSE42-NEXT:  LBB20_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB20_7
-; SSE42-NEXT:  LBB20_8: ## %else8
+; SSE42-NEXT:  LBB20_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB20_9
-; SSE42-NEXT:  LBB20_10: ## %else11
+; SSE42-NEXT:  LBB20_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB20_11
-; SSE42-NEXT:  LBB20_12: ## %else14
+; SSE42-NEXT:  LBB20_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB20_13
-; SSE42-NEXT:  LBB20_14: ## %else17
+; SSE42-NEXT:  LBB20_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB20_15
-; SSE42-NEXT:  LBB20_16: ## %else20
+; SSE42-NEXT:  LBB20_16: ## %else7
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB20_1: ## %cond.load
 ; SSE42-NEXT:    movd {{.*#+}} xmm0 = mem[0],zero,zero,zero
@@ -2584,27 +2584,27 @@ define <8 x i32> @load_v8i32_v8i1_zero(<8 x i1> %mask, <8 x i32>* %addr) {
 ; SSE42-NEXT:    pinsrd $1, 4(%rdi), %xmm0
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB20_6
-; SSE42-NEXT:  LBB20_5: ## %cond.load4
+; SSE42-NEXT:  LBB20_5: ## %cond.load2
 ; SSE42-NEXT:    pinsrd $2, 8(%rdi), %xmm0
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB20_8
-; SSE42-NEXT:  LBB20_7: ## %cond.load7
+; SSE42-NEXT:  LBB20_7: ## %cond.load3
 ; SSE42-NEXT:    pinsrd $3, 12(%rdi), %xmm0
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB20_10
-; SSE42-NEXT:  LBB20_9: ## %cond.load10
+; SSE42-NEXT:  LBB20_9: ## %cond.load4
 ; SSE42-NEXT:    pinsrd $0, 16(%rdi), %xmm1
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB20_12
-; SSE42-NEXT:  LBB20_11: ## %cond.load13
+; SSE42-NEXT:  LBB20_11: ## %cond.load5
 ; SSE42-NEXT:    pinsrd $1, 20(%rdi), %xmm1
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB20_14
-; SSE42-NEXT:  LBB20_13: ## %cond.load16
+; SSE42-NEXT:  LBB20_13: ## %cond.load6
 ; SSE42-NEXT:    pinsrd $2, 24(%rdi), %xmm1
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB20_16
-; SSE42-NEXT:  LBB20_15: ## %cond.load19
+; SSE42-NEXT:  LBB20_15: ## %cond.load7
 ; SSE42-NEXT:    pinsrd $3, 28(%rdi), %xmm1
 ; SSE42-NEXT:    retq
 ;
@@ -2669,25 +2669,25 @@ define <8 x i16> @load_v8i16_v8i16(<8 x i16> %trigger, <8 x i16>* %addr, <8 x i1
 ; SSE-NEXT:  ## %bb.2: ## %else
 ; SSE-NEXT:    testb $2, %al
 ; SSE-NEXT:    jne LBB21_3
-; SSE-NEXT:  LBB21_4: ## %else2
+; SSE-NEXT:  LBB21_4: ## %else1
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    jne LBB21_5
-; SSE-NEXT:  LBB21_6: ## %else5
+; SSE-NEXT:  LBB21_6: ## %else2
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    jne LBB21_7
-; SSE-NEXT:  LBB21_8: ## %else8
+; SSE-NEXT:  LBB21_8: ## %else3
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    jne LBB21_9
-; SSE-NEXT:  LBB21_10: ## %else11
+; SSE-NEXT:  LBB21_10: ## %else4
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    jne LBB21_11
-; SSE-NEXT:  LBB21_12: ## %else14
+; SSE-NEXT:  LBB21_12: ## %else5
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    jne LBB21_13
-; SSE-NEXT:  LBB21_14: ## %else17
+; SSE-NEXT:  LBB21_14: ## %else6
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    jne LBB21_15
-; SSE-NEXT:  LBB21_16: ## %else20
+; SSE-NEXT:  LBB21_16: ## %else7
 ; SSE-NEXT:    movdqa %xmm1, %xmm0
 ; SSE-NEXT:    retq
 ; SSE-NEXT:  LBB21_1: ## %cond.load
@@ -2698,27 +2698,27 @@ define <8 x i16> @load_v8i16_v8i16(<8 x i16> %trigger, <8 x i16>* %addr, <8 x i1
 ; SSE-NEXT:    pinsrw $1, 2(%rdi), %xmm1
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    je LBB21_6
-; SSE-NEXT:  LBB21_5: ## %cond.load4
+; SSE-NEXT:  LBB21_5: ## %cond.load2
 ; SSE-NEXT:    pinsrw $2, 4(%rdi), %xmm1
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    je LBB21_8
-; SSE-NEXT:  LBB21_7: ## %cond.load7
+; SSE-NEXT:  LBB21_7: ## %cond.load3
 ; SSE-NEXT:    pinsrw $3, 6(%rdi), %xmm1
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    je LBB21_10
-; SSE-NEXT:  LBB21_9: ## %cond.load10
+; SSE-NEXT:  LBB21_9: ## %cond.load4
 ; SSE-NEXT:    pinsrw $4, 8(%rdi), %xmm1
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    je LBB21_12
-; SSE-NEXT:  LBB21_11: ## %cond.load13
+; SSE-NEXT:  LBB21_11: ## %cond.load5
 ; SSE-NEXT:    pinsrw $5, 10(%rdi), %xmm1
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    je LBB21_14
-; SSE-NEXT:  LBB21_13: ## %cond.load16
+; SSE-NEXT:  LBB21_13: ## %cond.load6
 ; SSE-NEXT:    pinsrw $6, 12(%rdi), %xmm1
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    je LBB21_16
-; SSE-NEXT:  LBB21_15: ## %cond.load19
+; SSE-NEXT:  LBB21_15: ## %cond.load7
 ; SSE-NEXT:    pinsrw $7, 14(%rdi), %xmm1
 ; SSE-NEXT:    movdqa %xmm1, %xmm0
 ; SSE-NEXT:    retq
@@ -2732,25 +2732,25 @@ define <8 x i16> @load_v8i16_v8i16(<8 x i16> %trigger, <8 x i16>* %addr, <8 x i1
 ; AVX1OR2-NEXT:  ## %bb.2: ## %else
 ; AVX1OR2-NEXT:    testb $2, %al
 ; AVX1OR2-NEXT:    jne LBB21_3
-; AVX1OR2-NEXT:  LBB21_4: ## %else2
+; AVX1OR2-NEXT:  LBB21_4: ## %else1
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    jne LBB21_5
-; AVX1OR2-NEXT:  LBB21_6: ## %else5
+; AVX1OR2-NEXT:  LBB21_6: ## %else2
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    jne LBB21_7
-; AVX1OR2-NEXT:  LBB21_8: ## %else8
+; AVX1OR2-NEXT:  LBB21_8: ## %else3
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    jne LBB21_9
-; AVX1OR2-NEXT:  LBB21_10: ## %else11
+; AVX1OR2-NEXT:  LBB21_10: ## %else4
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    jne LBB21_11
-; AVX1OR2-NEXT:  LBB21_12: ## %else14
+; AVX1OR2-NEXT:  LBB21_12: ## %else5
 ; AVX1OR2-NEXT:    testb $64, %al
 ; AVX1OR2-NEXT:    jne LBB21_13
-; AVX1OR2-NEXT:  LBB21_14: ## %else17
+; AVX1OR2-NEXT:  LBB21_14: ## %else6
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    jne LBB21_15
-; AVX1OR2-NEXT:  LBB21_16: ## %else20
+; AVX1OR2-NEXT:  LBB21_16: ## %else7
 ; AVX1OR2-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX1OR2-NEXT:    retq
 ; AVX1OR2-NEXT:  LBB21_1: ## %cond.load
@@ -2761,27 +2761,27 @@ define <8 x i16> @load_v8i16_v8i16(<8 x i16> %trigger, <8 x i16>* %addr, <8 x i1
 ; AVX1OR2-NEXT:    vpinsrw $1, 2(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    je LBB21_6
-; AVX1OR2-NEXT:  LBB21_5: ## %cond.load4
+; AVX1OR2-NEXT:  LBB21_5: ## %cond.load2
 ; AVX1OR2-NEXT:    vpinsrw $2, 4(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    je LBB21_8
-; AVX1OR2-NEXT:  LBB21_7: ## %cond.load7
+; AVX1OR2-NEXT:  LBB21_7: ## %cond.load3
 ; AVX1OR2-NEXT:    vpinsrw $3, 6(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    je LBB21_10
-; AVX1OR2-NEXT:  LBB21_9: ## %cond.load10
+; AVX1OR2-NEXT:  LBB21_9: ## %cond.load4
 ; AVX1OR2-NEXT:    vpinsrw $4, 8(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    je LBB21_12
-; AVX1OR2-NEXT:  LBB21_11: ## %cond.load13
+; AVX1OR2-NEXT:  LBB21_11: ## %cond.load5
 ; AVX1OR2-NEXT:    vpinsrw $5, 10(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $64, %al
 ; AVX1OR2-NEXT:    je LBB21_14
-; AVX1OR2-NEXT:  LBB21_13: ## %cond.load16
+; AVX1OR2-NEXT:  LBB21_13: ## %cond.load6
 ; AVX1OR2-NEXT:    vpinsrw $6, 12(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    je LBB21_16
-; AVX1OR2-NEXT:  LBB21_15: ## %cond.load19
+; AVX1OR2-NEXT:  LBB21_15: ## %cond.load7
 ; AVX1OR2-NEXT:    vpinsrw $7, 14(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX1OR2-NEXT:    retq
@@ -2798,25 +2798,25 @@ define <8 x i16> @load_v8i16_v8i16(<8 x i16> %trigger, <8 x i16>* %addr, <8 x i1
 ; AVX512F-NEXT:  ## %bb.2: ## %else
 ; AVX512F-NEXT:    testb $2, %al
 ; AVX512F-NEXT:    jne LBB21_3
-; AVX512F-NEXT:  LBB21_4: ## %else2
+; AVX512F-NEXT:  LBB21_4: ## %else1
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    jne LBB21_5
-; AVX512F-NEXT:  LBB21_6: ## %else5
+; AVX512F-NEXT:  LBB21_6: ## %else2
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    jne LBB21_7
-; AVX512F-NEXT:  LBB21_8: ## %else8
+; AVX512F-NEXT:  LBB21_8: ## %else3
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    jne LBB21_9
-; AVX512F-NEXT:  LBB21_10: ## %else11
+; AVX512F-NEXT:  LBB21_10: ## %else4
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    jne LBB21_11
-; AVX512F-NEXT:  LBB21_12: ## %else14
+; AVX512F-NEXT:  LBB21_12: ## %else5
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    jne LBB21_13
-; AVX512F-NEXT:  LBB21_14: ## %else17
+; AVX512F-NEXT:  LBB21_14: ## %else6
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    jne LBB21_15
-; AVX512F-NEXT:  LBB21_16: ## %else20
+; AVX512F-NEXT:  LBB21_16: ## %else7
 ; AVX512F-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX512F-NEXT:    vzeroupper
 ; AVX512F-NEXT:    retq
@@ -2828,27 +2828,27 @@ define <8 x i16> @load_v8i16_v8i16(<8 x i16> %trigger, <8 x i16>* %addr, <8 x i1
 ; AVX512F-NEXT:    vpinsrw $1, 2(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    je LBB21_6
-; AVX512F-NEXT:  LBB21_5: ## %cond.load4
+; AVX512F-NEXT:  LBB21_5: ## %cond.load2
 ; AVX512F-NEXT:    vpinsrw $2, 4(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    je LBB21_8
-; AVX512F-NEXT:  LBB21_7: ## %cond.load7
+; AVX512F-NEXT:  LBB21_7: ## %cond.load3
 ; AVX512F-NEXT:    vpinsrw $3, 6(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    je LBB21_10
-; AVX512F-NEXT:  LBB21_9: ## %cond.load10
+; AVX512F-NEXT:  LBB21_9: ## %cond.load4
 ; AVX512F-NEXT:    vpinsrw $4, 8(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    je LBB21_12
-; AVX512F-NEXT:  LBB21_11: ## %cond.load13
+; AVX512F-NEXT:  LBB21_11: ## %cond.load5
 ; AVX512F-NEXT:    vpinsrw $5, 10(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    je LBB21_14
-; AVX512F-NEXT:  LBB21_13: ## %cond.load16
+; AVX512F-NEXT:  LBB21_13: ## %cond.load6
 ; AVX512F-NEXT:    vpinsrw $6, 12(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    je LBB21_16
-; AVX512F-NEXT:  LBB21_15: ## %cond.load19
+; AVX512F-NEXT:  LBB21_15: ## %cond.load7
 ; AVX512F-NEXT:    vpinsrw $7, 14(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX512F-NEXT:    vzeroupper
@@ -2866,25 +2866,25 @@ define <8 x i16> @load_v8i16_v8i16(<8 x i16> %trigger, <8 x i16>* %addr, <8 x i1
 ; AVX512VLDQ-NEXT:  ## %bb.2: ## %else
 ; AVX512VLDQ-NEXT:    testb $2, %al
 ; AVX512VLDQ-NEXT:    jne LBB21_3
-; AVX512VLDQ-NEXT:  LBB21_4: ## %else2
+; AVX512VLDQ-NEXT:  LBB21_4: ## %else1
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    jne LBB21_5
-; AVX512VLDQ-NEXT:  LBB21_6: ## %else5
+; AVX512VLDQ-NEXT:  LBB21_6: ## %else2
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    jne LBB21_7
-; AVX512VLDQ-NEXT:  LBB21_8: ## %else8
+; AVX512VLDQ-NEXT:  LBB21_8: ## %else3
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    jne LBB21_9
-; AVX512VLDQ-NEXT:  LBB21_10: ## %else11
+; AVX512VLDQ-NEXT:  LBB21_10: ## %else4
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    jne LBB21_11
-; AVX512VLDQ-NEXT:  LBB21_12: ## %else14
+; AVX512VLDQ-NEXT:  LBB21_12: ## %else5
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    jne LBB21_13
-; AVX512VLDQ-NEXT:  LBB21_14: ## %else17
+; AVX512VLDQ-NEXT:  LBB21_14: ## %else6
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    jne LBB21_15
-; AVX512VLDQ-NEXT:  LBB21_16: ## %else20
+; AVX512VLDQ-NEXT:  LBB21_16: ## %else7
 ; AVX512VLDQ-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vzeroupper
 ; AVX512VLDQ-NEXT:    retq
@@ -2896,27 +2896,27 @@ define <8 x i16> @load_v8i16_v8i16(<8 x i16> %trigger, <8 x i16>* %addr, <8 x i1
 ; AVX512VLDQ-NEXT:    vpinsrw $1, 2(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    je LBB21_6
-; AVX512VLDQ-NEXT:  LBB21_5: ## %cond.load4
+; AVX512VLDQ-NEXT:  LBB21_5: ## %cond.load2
 ; AVX512VLDQ-NEXT:    vpinsrw $2, 4(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    je LBB21_8
-; AVX512VLDQ-NEXT:  LBB21_7: ## %cond.load7
+; AVX512VLDQ-NEXT:  LBB21_7: ## %cond.load3
 ; AVX512VLDQ-NEXT:    vpinsrw $3, 6(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    je LBB21_10
-; AVX512VLDQ-NEXT:  LBB21_9: ## %cond.load10
+; AVX512VLDQ-NEXT:  LBB21_9: ## %cond.load4
 ; AVX512VLDQ-NEXT:    vpinsrw $4, 8(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    je LBB21_12
-; AVX512VLDQ-NEXT:  LBB21_11: ## %cond.load13
+; AVX512VLDQ-NEXT:  LBB21_11: ## %cond.load5
 ; AVX512VLDQ-NEXT:    vpinsrw $5, 10(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    je LBB21_14
-; AVX512VLDQ-NEXT:  LBB21_13: ## %cond.load16
+; AVX512VLDQ-NEXT:  LBB21_13: ## %cond.load6
 ; AVX512VLDQ-NEXT:    vpinsrw $6, 12(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    je LBB21_16
-; AVX512VLDQ-NEXT:  LBB21_15: ## %cond.load19
+; AVX512VLDQ-NEXT:  LBB21_15: ## %cond.load7
 ; AVX512VLDQ-NEXT:    vpinsrw $7, 14(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vzeroupper
@@ -2942,51 +2942,51 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; SSE-NEXT:  ## %bb.2: ## %else
 ; SSE-NEXT:    testb $2, %al
 ; SSE-NEXT:    jne LBB22_3
-; SSE-NEXT:  LBB22_4: ## %else2
+; SSE-NEXT:  LBB22_4: ## %else1
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    jne LBB22_5
-; SSE-NEXT:  LBB22_6: ## %else5
+; SSE-NEXT:  LBB22_6: ## %else2
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    jne LBB22_7
-; SSE-NEXT:  LBB22_8: ## %else8
+; SSE-NEXT:  LBB22_8: ## %else3
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    jne LBB22_9
-; SSE-NEXT:  LBB22_10: ## %else11
+; SSE-NEXT:  LBB22_10: ## %else4
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    jne LBB22_11
-; SSE-NEXT:  LBB22_12: ## %else14
+; SSE-NEXT:  LBB22_12: ## %else5
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    jne LBB22_13
-; SSE-NEXT:  LBB22_14: ## %else17
+; SSE-NEXT:  LBB22_14: ## %else6
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    jne LBB22_15
-; SSE-NEXT:  LBB22_16: ## %else20
+; SSE-NEXT:  LBB22_16: ## %else7
 ; SSE-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE-NEXT:    jne LBB22_17
-; SSE-NEXT:  LBB22_18: ## %else23
+; SSE-NEXT:  LBB22_18: ## %else8
 ; SSE-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE-NEXT:    jne LBB22_19
-; SSE-NEXT:  LBB22_20: ## %else26
+; SSE-NEXT:  LBB22_20: ## %else9
 ; SSE-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE-NEXT:    jne LBB22_21
-; SSE-NEXT:  LBB22_22: ## %else29
+; SSE-NEXT:  LBB22_22: ## %else10
 ; SSE-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE-NEXT:    jne LBB22_23
-; SSE-NEXT:  LBB22_24: ## %else32
+; SSE-NEXT:  LBB22_24: ## %else11
 ; SSE-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE-NEXT:    jne LBB22_25
-; SSE-NEXT:  LBB22_26: ## %else35
+; SSE-NEXT:  LBB22_26: ## %else12
 ; SSE-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE-NEXT:    jne LBB22_27
-; SSE-NEXT:  LBB22_28: ## %else38
+; SSE-NEXT:  LBB22_28: ## %else13
 ; SSE-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE-NEXT:    jne LBB22_29
-; SSE-NEXT:  LBB22_30: ## %else41
+; SSE-NEXT:  LBB22_30: ## %else14
 ; SSE-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE-NEXT:    je LBB22_32
-; SSE-NEXT:  LBB22_31: ## %cond.load43
+; SSE-NEXT:  LBB22_31: ## %cond.load15
 ; SSE-NEXT:    pinsrw $7, 30(%rdi), %xmm3
-; SSE-NEXT:  LBB22_32: ## %else44
+; SSE-NEXT:  LBB22_32: ## %else15
 ; SSE-NEXT:    movdqa %xmm2, %xmm0
 ; SSE-NEXT:    movdqa %xmm3, %xmm1
 ; SSE-NEXT:    retq
@@ -2998,55 +2998,55 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; SSE-NEXT:    pinsrw $1, 2(%rdi), %xmm2
 ; SSE-NEXT:    testb $4, %al
 ; SSE-NEXT:    je LBB22_6
-; SSE-NEXT:  LBB22_5: ## %cond.load4
+; SSE-NEXT:  LBB22_5: ## %cond.load2
 ; SSE-NEXT:    pinsrw $2, 4(%rdi), %xmm2
 ; SSE-NEXT:    testb $8, %al
 ; SSE-NEXT:    je LBB22_8
-; SSE-NEXT:  LBB22_7: ## %cond.load7
+; SSE-NEXT:  LBB22_7: ## %cond.load3
 ; SSE-NEXT:    pinsrw $3, 6(%rdi), %xmm2
 ; SSE-NEXT:    testb $16, %al
 ; SSE-NEXT:    je LBB22_10
-; SSE-NEXT:  LBB22_9: ## %cond.load10
+; SSE-NEXT:  LBB22_9: ## %cond.load4
 ; SSE-NEXT:    pinsrw $4, 8(%rdi), %xmm2
 ; SSE-NEXT:    testb $32, %al
 ; SSE-NEXT:    je LBB22_12
-; SSE-NEXT:  LBB22_11: ## %cond.load13
+; SSE-NEXT:  LBB22_11: ## %cond.load5
 ; SSE-NEXT:    pinsrw $5, 10(%rdi), %xmm2
 ; SSE-NEXT:    testb $64, %al
 ; SSE-NEXT:    je LBB22_14
-; SSE-NEXT:  LBB22_13: ## %cond.load16
+; SSE-NEXT:  LBB22_13: ## %cond.load6
 ; SSE-NEXT:    pinsrw $6, 12(%rdi), %xmm2
 ; SSE-NEXT:    testb $-128, %al
 ; SSE-NEXT:    je LBB22_16
-; SSE-NEXT:  LBB22_15: ## %cond.load19
+; SSE-NEXT:  LBB22_15: ## %cond.load7
 ; SSE-NEXT:    pinsrw $7, 14(%rdi), %xmm2
 ; SSE-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE-NEXT:    je LBB22_18
-; SSE-NEXT:  LBB22_17: ## %cond.load22
+; SSE-NEXT:  LBB22_17: ## %cond.load8
 ; SSE-NEXT:    pinsrw $0, 16(%rdi), %xmm3
 ; SSE-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE-NEXT:    je LBB22_20
-; SSE-NEXT:  LBB22_19: ## %cond.load25
+; SSE-NEXT:  LBB22_19: ## %cond.load9
 ; SSE-NEXT:    pinsrw $1, 18(%rdi), %xmm3
 ; SSE-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE-NEXT:    je LBB22_22
-; SSE-NEXT:  LBB22_21: ## %cond.load28
+; SSE-NEXT:  LBB22_21: ## %cond.load10
 ; SSE-NEXT:    pinsrw $2, 20(%rdi), %xmm3
 ; SSE-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE-NEXT:    je LBB22_24
-; SSE-NEXT:  LBB22_23: ## %cond.load31
+; SSE-NEXT:  LBB22_23: ## %cond.load11
 ; SSE-NEXT:    pinsrw $3, 22(%rdi), %xmm3
 ; SSE-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE-NEXT:    je LBB22_26
-; SSE-NEXT:  LBB22_25: ## %cond.load34
+; SSE-NEXT:  LBB22_25: ## %cond.load12
 ; SSE-NEXT:    pinsrw $4, 24(%rdi), %xmm3
 ; SSE-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE-NEXT:    je LBB22_28
-; SSE-NEXT:  LBB22_27: ## %cond.load37
+; SSE-NEXT:  LBB22_27: ## %cond.load13
 ; SSE-NEXT:    pinsrw $5, 26(%rdi), %xmm3
 ; SSE-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE-NEXT:    je LBB22_30
-; SSE-NEXT:  LBB22_29: ## %cond.load40
+; SSE-NEXT:  LBB22_29: ## %cond.load14
 ; SSE-NEXT:    pinsrw $6, 28(%rdi), %xmm3
 ; SSE-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE-NEXT:    jne LBB22_31
@@ -3062,49 +3062,49 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; AVX1-NEXT:  ## %bb.2: ## %else
 ; AVX1-NEXT:    testb $2, %al
 ; AVX1-NEXT:    jne LBB22_3
-; AVX1-NEXT:  LBB22_4: ## %else2
+; AVX1-NEXT:  LBB22_4: ## %else1
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    jne LBB22_5
-; AVX1-NEXT:  LBB22_6: ## %else5
+; AVX1-NEXT:  LBB22_6: ## %else2
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    jne LBB22_7
-; AVX1-NEXT:  LBB22_8: ## %else8
+; AVX1-NEXT:  LBB22_8: ## %else3
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    jne LBB22_9
-; AVX1-NEXT:  LBB22_10: ## %else11
+; AVX1-NEXT:  LBB22_10: ## %else4
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    jne LBB22_11
-; AVX1-NEXT:  LBB22_12: ## %else14
+; AVX1-NEXT:  LBB22_12: ## %else5
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    jne LBB22_13
-; AVX1-NEXT:  LBB22_14: ## %else17
+; AVX1-NEXT:  LBB22_14: ## %else6
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    jne LBB22_15
-; AVX1-NEXT:  LBB22_16: ## %else20
+; AVX1-NEXT:  LBB22_16: ## %else7
 ; AVX1-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1-NEXT:    jne LBB22_17
-; AVX1-NEXT:  LBB22_18: ## %else23
+; AVX1-NEXT:  LBB22_18: ## %else8
 ; AVX1-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1-NEXT:    jne LBB22_19
-; AVX1-NEXT:  LBB22_20: ## %else26
+; AVX1-NEXT:  LBB22_20: ## %else9
 ; AVX1-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1-NEXT:    jne LBB22_21
-; AVX1-NEXT:  LBB22_22: ## %else29
+; AVX1-NEXT:  LBB22_22: ## %else10
 ; AVX1-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1-NEXT:    jne LBB22_23
-; AVX1-NEXT:  LBB22_24: ## %else32
+; AVX1-NEXT:  LBB22_24: ## %else11
 ; AVX1-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1-NEXT:    jne LBB22_25
-; AVX1-NEXT:  LBB22_26: ## %else35
+; AVX1-NEXT:  LBB22_26: ## %else12
 ; AVX1-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1-NEXT:    jne LBB22_27
-; AVX1-NEXT:  LBB22_28: ## %else38
+; AVX1-NEXT:  LBB22_28: ## %else13
 ; AVX1-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1-NEXT:    jne LBB22_29
-; AVX1-NEXT:  LBB22_30: ## %else41
+; AVX1-NEXT:  LBB22_30: ## %else14
 ; AVX1-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1-NEXT:    jne LBB22_31
-; AVX1-NEXT:  LBB22_32: ## %else44
+; AVX1-NEXT:  LBB22_32: ## %else15
 ; AVX1-NEXT:    vmovaps %ymm1, %ymm0
 ; AVX1-NEXT:    retq
 ; AVX1-NEXT:  LBB22_1: ## %cond.load
@@ -3117,79 +3117,79 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    je LBB22_6
-; AVX1-NEXT:  LBB22_5: ## %cond.load4
+; AVX1-NEXT:  LBB22_5: ## %cond.load2
 ; AVX1-NEXT:    vpinsrw $2, 4(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    je LBB22_8
-; AVX1-NEXT:  LBB22_7: ## %cond.load7
+; AVX1-NEXT:  LBB22_7: ## %cond.load3
 ; AVX1-NEXT:    vpinsrw $3, 6(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    je LBB22_10
-; AVX1-NEXT:  LBB22_9: ## %cond.load10
+; AVX1-NEXT:  LBB22_9: ## %cond.load4
 ; AVX1-NEXT:    vpinsrw $4, 8(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    je LBB22_12
-; AVX1-NEXT:  LBB22_11: ## %cond.load13
+; AVX1-NEXT:  LBB22_11: ## %cond.load5
 ; AVX1-NEXT:    vpinsrw $5, 10(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    je LBB22_14
-; AVX1-NEXT:  LBB22_13: ## %cond.load16
+; AVX1-NEXT:  LBB22_13: ## %cond.load6
 ; AVX1-NEXT:    vpinsrw $6, 12(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    je LBB22_16
-; AVX1-NEXT:  LBB22_15: ## %cond.load19
+; AVX1-NEXT:  LBB22_15: ## %cond.load7
 ; AVX1-NEXT:    vpinsrw $7, 14(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1-NEXT:    je LBB22_18
-; AVX1-NEXT:  LBB22_17: ## %cond.load22
+; AVX1-NEXT:  LBB22_17: ## %cond.load8
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrw $0, 16(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1-NEXT:    je LBB22_20
-; AVX1-NEXT:  LBB22_19: ## %cond.load25
+; AVX1-NEXT:  LBB22_19: ## %cond.load9
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrw $1, 18(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1-NEXT:    je LBB22_22
-; AVX1-NEXT:  LBB22_21: ## %cond.load28
+; AVX1-NEXT:  LBB22_21: ## %cond.load10
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrw $2, 20(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1-NEXT:    je LBB22_24
-; AVX1-NEXT:  LBB22_23: ## %cond.load31
+; AVX1-NEXT:  LBB22_23: ## %cond.load11
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrw $3, 22(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1-NEXT:    je LBB22_26
-; AVX1-NEXT:  LBB22_25: ## %cond.load34
+; AVX1-NEXT:  LBB22_25: ## %cond.load12
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrw $4, 24(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1-NEXT:    je LBB22_28
-; AVX1-NEXT:  LBB22_27: ## %cond.load37
+; AVX1-NEXT:  LBB22_27: ## %cond.load13
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrw $5, 26(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1-NEXT:    je LBB22_30
-; AVX1-NEXT:  LBB22_29: ## %cond.load40
+; AVX1-NEXT:  LBB22_29: ## %cond.load14
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrw $6, 28(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1-NEXT:    je LBB22_32
-; AVX1-NEXT:  LBB22_31: ## %cond.load43
+; AVX1-NEXT:  LBB22_31: ## %cond.load15
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrw $7, 30(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
@@ -3208,49 +3208,49 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; AVX2-NEXT:  ## %bb.2: ## %else
 ; AVX2-NEXT:    testb $2, %al
 ; AVX2-NEXT:    jne LBB22_3
-; AVX2-NEXT:  LBB22_4: ## %else2
+; AVX2-NEXT:  LBB22_4: ## %else1
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    jne LBB22_5
-; AVX2-NEXT:  LBB22_6: ## %else5
+; AVX2-NEXT:  LBB22_6: ## %else2
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    jne LBB22_7
-; AVX2-NEXT:  LBB22_8: ## %else8
+; AVX2-NEXT:  LBB22_8: ## %else3
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    jne LBB22_9
-; AVX2-NEXT:  LBB22_10: ## %else11
+; AVX2-NEXT:  LBB22_10: ## %else4
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    jne LBB22_11
-; AVX2-NEXT:  LBB22_12: ## %else14
+; AVX2-NEXT:  LBB22_12: ## %else5
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    jne LBB22_13
-; AVX2-NEXT:  LBB22_14: ## %else17
+; AVX2-NEXT:  LBB22_14: ## %else6
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    jne LBB22_15
-; AVX2-NEXT:  LBB22_16: ## %else20
+; AVX2-NEXT:  LBB22_16: ## %else7
 ; AVX2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX2-NEXT:    jne LBB22_17
-; AVX2-NEXT:  LBB22_18: ## %else23
+; AVX2-NEXT:  LBB22_18: ## %else8
 ; AVX2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX2-NEXT:    jne LBB22_19
-; AVX2-NEXT:  LBB22_20: ## %else26
+; AVX2-NEXT:  LBB22_20: ## %else9
 ; AVX2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX2-NEXT:    jne LBB22_21
-; AVX2-NEXT:  LBB22_22: ## %else29
+; AVX2-NEXT:  LBB22_22: ## %else10
 ; AVX2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX2-NEXT:    jne LBB22_23
-; AVX2-NEXT:  LBB22_24: ## %else32
+; AVX2-NEXT:  LBB22_24: ## %else11
 ; AVX2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX2-NEXT:    jne LBB22_25
-; AVX2-NEXT:  LBB22_26: ## %else35
+; AVX2-NEXT:  LBB22_26: ## %else12
 ; AVX2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX2-NEXT:    jne LBB22_27
-; AVX2-NEXT:  LBB22_28: ## %else38
+; AVX2-NEXT:  LBB22_28: ## %else13
 ; AVX2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX2-NEXT:    jne LBB22_29
-; AVX2-NEXT:  LBB22_30: ## %else41
+; AVX2-NEXT:  LBB22_30: ## %else14
 ; AVX2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX2-NEXT:    jne LBB22_31
-; AVX2-NEXT:  LBB22_32: ## %else44
+; AVX2-NEXT:  LBB22_32: ## %else15
 ; AVX2-NEXT:    vmovdqa %ymm1, %ymm0
 ; AVX2-NEXT:    retq
 ; AVX2-NEXT:  LBB22_1: ## %cond.load
@@ -3263,79 +3263,79 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    je LBB22_6
-; AVX2-NEXT:  LBB22_5: ## %cond.load4
+; AVX2-NEXT:  LBB22_5: ## %cond.load2
 ; AVX2-NEXT:    vpinsrw $2, 4(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    je LBB22_8
-; AVX2-NEXT:  LBB22_7: ## %cond.load7
+; AVX2-NEXT:  LBB22_7: ## %cond.load3
 ; AVX2-NEXT:    vpinsrw $3, 6(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    je LBB22_10
-; AVX2-NEXT:  LBB22_9: ## %cond.load10
+; AVX2-NEXT:  LBB22_9: ## %cond.load4
 ; AVX2-NEXT:    vpinsrw $4, 8(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    je LBB22_12
-; AVX2-NEXT:  LBB22_11: ## %cond.load13
+; AVX2-NEXT:  LBB22_11: ## %cond.load5
 ; AVX2-NEXT:    vpinsrw $5, 10(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    je LBB22_14
-; AVX2-NEXT:  LBB22_13: ## %cond.load16
+; AVX2-NEXT:  LBB22_13: ## %cond.load6
 ; AVX2-NEXT:    vpinsrw $6, 12(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    je LBB22_16
-; AVX2-NEXT:  LBB22_15: ## %cond.load19
+; AVX2-NEXT:  LBB22_15: ## %cond.load7
 ; AVX2-NEXT:    vpinsrw $7, 14(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX2-NEXT:    je LBB22_18
-; AVX2-NEXT:  LBB22_17: ## %cond.load22
+; AVX2-NEXT:  LBB22_17: ## %cond.load8
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrw $0, 16(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX2-NEXT:    je LBB22_20
-; AVX2-NEXT:  LBB22_19: ## %cond.load25
+; AVX2-NEXT:  LBB22_19: ## %cond.load9
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrw $1, 18(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX2-NEXT:    je LBB22_22
-; AVX2-NEXT:  LBB22_21: ## %cond.load28
+; AVX2-NEXT:  LBB22_21: ## %cond.load10
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrw $2, 20(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX2-NEXT:    je LBB22_24
-; AVX2-NEXT:  LBB22_23: ## %cond.load31
+; AVX2-NEXT:  LBB22_23: ## %cond.load11
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrw $3, 22(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX2-NEXT:    je LBB22_26
-; AVX2-NEXT:  LBB22_25: ## %cond.load34
+; AVX2-NEXT:  LBB22_25: ## %cond.load12
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrw $4, 24(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX2-NEXT:    je LBB22_28
-; AVX2-NEXT:  LBB22_27: ## %cond.load37
+; AVX2-NEXT:  LBB22_27: ## %cond.load13
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrw $5, 26(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX2-NEXT:    je LBB22_30
-; AVX2-NEXT:  LBB22_29: ## %cond.load40
+; AVX2-NEXT:  LBB22_29: ## %cond.load14
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrw $6, 28(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX2-NEXT:    je LBB22_32
-; AVX2-NEXT:  LBB22_31: ## %cond.load43
+; AVX2-NEXT:  LBB22_31: ## %cond.load15
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrw $7, 30(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
@@ -3354,49 +3354,49 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; AVX512F-NEXT:  ## %bb.2: ## %else
 ; AVX512F-NEXT:    testb $2, %al
 ; AVX512F-NEXT:    jne LBB22_3
-; AVX512F-NEXT:  LBB22_4: ## %else2
+; AVX512F-NEXT:  LBB22_4: ## %else1
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    jne LBB22_5
-; AVX512F-NEXT:  LBB22_6: ## %else5
+; AVX512F-NEXT:  LBB22_6: ## %else2
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    jne LBB22_7
-; AVX512F-NEXT:  LBB22_8: ## %else8
+; AVX512F-NEXT:  LBB22_8: ## %else3
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    jne LBB22_9
-; AVX512F-NEXT:  LBB22_10: ## %else11
+; AVX512F-NEXT:  LBB22_10: ## %else4
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    jne LBB22_11
-; AVX512F-NEXT:  LBB22_12: ## %else14
+; AVX512F-NEXT:  LBB22_12: ## %else5
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    jne LBB22_13
-; AVX512F-NEXT:  LBB22_14: ## %else17
+; AVX512F-NEXT:  LBB22_14: ## %else6
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    jne LBB22_15
-; AVX512F-NEXT:  LBB22_16: ## %else20
+; AVX512F-NEXT:  LBB22_16: ## %else7
 ; AVX512F-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512F-NEXT:    jne LBB22_17
-; AVX512F-NEXT:  LBB22_18: ## %else23
+; AVX512F-NEXT:  LBB22_18: ## %else8
 ; AVX512F-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512F-NEXT:    jne LBB22_19
-; AVX512F-NEXT:  LBB22_20: ## %else26
+; AVX512F-NEXT:  LBB22_20: ## %else9
 ; AVX512F-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512F-NEXT:    jne LBB22_21
-; AVX512F-NEXT:  LBB22_22: ## %else29
+; AVX512F-NEXT:  LBB22_22: ## %else10
 ; AVX512F-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512F-NEXT:    jne LBB22_23
-; AVX512F-NEXT:  LBB22_24: ## %else32
+; AVX512F-NEXT:  LBB22_24: ## %else11
 ; AVX512F-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512F-NEXT:    jne LBB22_25
-; AVX512F-NEXT:  LBB22_26: ## %else35
+; AVX512F-NEXT:  LBB22_26: ## %else12
 ; AVX512F-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512F-NEXT:    jne LBB22_27
-; AVX512F-NEXT:  LBB22_28: ## %else38
+; AVX512F-NEXT:  LBB22_28: ## %else13
 ; AVX512F-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512F-NEXT:    jne LBB22_29
-; AVX512F-NEXT:  LBB22_30: ## %else41
+; AVX512F-NEXT:  LBB22_30: ## %else14
 ; AVX512F-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512F-NEXT:    jne LBB22_31
-; AVX512F-NEXT:  LBB22_32: ## %else44
+; AVX512F-NEXT:  LBB22_32: ## %else15
 ; AVX512F-NEXT:    vmovdqa %ymm1, %ymm0
 ; AVX512F-NEXT:    retq
 ; AVX512F-NEXT:  LBB22_1: ## %cond.load
@@ -3409,79 +3409,79 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    je LBB22_6
-; AVX512F-NEXT:  LBB22_5: ## %cond.load4
+; AVX512F-NEXT:  LBB22_5: ## %cond.load2
 ; AVX512F-NEXT:    vpinsrw $2, 4(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    je LBB22_8
-; AVX512F-NEXT:  LBB22_7: ## %cond.load7
+; AVX512F-NEXT:  LBB22_7: ## %cond.load3
 ; AVX512F-NEXT:    vpinsrw $3, 6(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    je LBB22_10
-; AVX512F-NEXT:  LBB22_9: ## %cond.load10
+; AVX512F-NEXT:  LBB22_9: ## %cond.load4
 ; AVX512F-NEXT:    vpinsrw $4, 8(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    je LBB22_12
-; AVX512F-NEXT:  LBB22_11: ## %cond.load13
+; AVX512F-NEXT:  LBB22_11: ## %cond.load5
 ; AVX512F-NEXT:    vpinsrw $5, 10(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    je LBB22_14
-; AVX512F-NEXT:  LBB22_13: ## %cond.load16
+; AVX512F-NEXT:  LBB22_13: ## %cond.load6
 ; AVX512F-NEXT:    vpinsrw $6, 12(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    je LBB22_16
-; AVX512F-NEXT:  LBB22_15: ## %cond.load19
+; AVX512F-NEXT:  LBB22_15: ## %cond.load7
 ; AVX512F-NEXT:    vpinsrw $7, 14(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512F-NEXT:    je LBB22_18
-; AVX512F-NEXT:  LBB22_17: ## %cond.load22
+; AVX512F-NEXT:  LBB22_17: ## %cond.load8
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrw $0, 16(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512F-NEXT:    je LBB22_20
-; AVX512F-NEXT:  LBB22_19: ## %cond.load25
+; AVX512F-NEXT:  LBB22_19: ## %cond.load9
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrw $1, 18(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512F-NEXT:    je LBB22_22
-; AVX512F-NEXT:  LBB22_21: ## %cond.load28
+; AVX512F-NEXT:  LBB22_21: ## %cond.load10
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrw $2, 20(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512F-NEXT:    je LBB22_24
-; AVX512F-NEXT:  LBB22_23: ## %cond.load31
+; AVX512F-NEXT:  LBB22_23: ## %cond.load11
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrw $3, 22(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512F-NEXT:    je LBB22_26
-; AVX512F-NEXT:  LBB22_25: ## %cond.load34
+; AVX512F-NEXT:  LBB22_25: ## %cond.load12
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrw $4, 24(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512F-NEXT:    je LBB22_28
-; AVX512F-NEXT:  LBB22_27: ## %cond.load37
+; AVX512F-NEXT:  LBB22_27: ## %cond.load13
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrw $5, 26(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512F-NEXT:    je LBB22_30
-; AVX512F-NEXT:  LBB22_29: ## %cond.load40
+; AVX512F-NEXT:  LBB22_29: ## %cond.load14
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrw $6, 28(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512F-NEXT:    je LBB22_32
-; AVX512F-NEXT:  LBB22_31: ## %cond.load43
+; AVX512F-NEXT:  LBB22_31: ## %cond.load15
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrw $7, 30(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
@@ -3500,49 +3500,49 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; AVX512VLDQ-NEXT:  ## %bb.2: ## %else
 ; AVX512VLDQ-NEXT:    testb $2, %al
 ; AVX512VLDQ-NEXT:    jne LBB22_3
-; AVX512VLDQ-NEXT:  LBB22_4: ## %else2
+; AVX512VLDQ-NEXT:  LBB22_4: ## %else1
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    jne LBB22_5
-; AVX512VLDQ-NEXT:  LBB22_6: ## %else5
+; AVX512VLDQ-NEXT:  LBB22_6: ## %else2
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    jne LBB22_7
-; AVX512VLDQ-NEXT:  LBB22_8: ## %else8
+; AVX512VLDQ-NEXT:  LBB22_8: ## %else3
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    jne LBB22_9
-; AVX512VLDQ-NEXT:  LBB22_10: ## %else11
+; AVX512VLDQ-NEXT:  LBB22_10: ## %else4
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    jne LBB22_11
-; AVX512VLDQ-NEXT:  LBB22_12: ## %else14
+; AVX512VLDQ-NEXT:  LBB22_12: ## %else5
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    jne LBB22_13
-; AVX512VLDQ-NEXT:  LBB22_14: ## %else17
+; AVX512VLDQ-NEXT:  LBB22_14: ## %else6
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    jne LBB22_15
-; AVX512VLDQ-NEXT:  LBB22_16: ## %else20
+; AVX512VLDQ-NEXT:  LBB22_16: ## %else7
 ; AVX512VLDQ-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLDQ-NEXT:    jne LBB22_17
-; AVX512VLDQ-NEXT:  LBB22_18: ## %else23
+; AVX512VLDQ-NEXT:  LBB22_18: ## %else8
 ; AVX512VLDQ-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLDQ-NEXT:    jne LBB22_19
-; AVX512VLDQ-NEXT:  LBB22_20: ## %else26
+; AVX512VLDQ-NEXT:  LBB22_20: ## %else9
 ; AVX512VLDQ-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLDQ-NEXT:    jne LBB22_21
-; AVX512VLDQ-NEXT:  LBB22_22: ## %else29
+; AVX512VLDQ-NEXT:  LBB22_22: ## %else10
 ; AVX512VLDQ-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLDQ-NEXT:    jne LBB22_23
-; AVX512VLDQ-NEXT:  LBB22_24: ## %else32
+; AVX512VLDQ-NEXT:  LBB22_24: ## %else11
 ; AVX512VLDQ-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLDQ-NEXT:    jne LBB22_25
-; AVX512VLDQ-NEXT:  LBB22_26: ## %else35
+; AVX512VLDQ-NEXT:  LBB22_26: ## %else12
 ; AVX512VLDQ-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLDQ-NEXT:    jne LBB22_27
-; AVX512VLDQ-NEXT:  LBB22_28: ## %else38
+; AVX512VLDQ-NEXT:  LBB22_28: ## %else13
 ; AVX512VLDQ-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLDQ-NEXT:    jne LBB22_29
-; AVX512VLDQ-NEXT:  LBB22_30: ## %else41
+; AVX512VLDQ-NEXT:  LBB22_30: ## %else14
 ; AVX512VLDQ-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLDQ-NEXT:    jne LBB22_31
-; AVX512VLDQ-NEXT:  LBB22_32: ## %else44
+; AVX512VLDQ-NEXT:  LBB22_32: ## %else15
 ; AVX512VLDQ-NEXT:    vmovdqa %ymm1, %ymm0
 ; AVX512VLDQ-NEXT:    retq
 ; AVX512VLDQ-NEXT:  LBB22_1: ## %cond.load
@@ -3555,79 +3555,79 @@ define <16 x i16> @load_v16i16_v16i16(<16 x i16> %trigger, <16 x i16>* %addr, <1
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    je LBB22_6
-; AVX512VLDQ-NEXT:  LBB22_5: ## %cond.load4
+; AVX512VLDQ-NEXT:  LBB22_5: ## %cond.load2
 ; AVX512VLDQ-NEXT:    vpinsrw $2, 4(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    je LBB22_8
-; AVX512VLDQ-NEXT:  LBB22_7: ## %cond.load7
+; AVX512VLDQ-NEXT:  LBB22_7: ## %cond.load3
 ; AVX512VLDQ-NEXT:    vpinsrw $3, 6(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    je LBB22_10
-; AVX512VLDQ-NEXT:  LBB22_9: ## %cond.load10
+; AVX512VLDQ-NEXT:  LBB22_9: ## %cond.load4
 ; AVX512VLDQ-NEXT:    vpinsrw $4, 8(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    je LBB22_12
-; AVX512VLDQ-NEXT:  LBB22_11: ## %cond.load13
+; AVX512VLDQ-NEXT:  LBB22_11: ## %cond.load5
 ; AVX512VLDQ-NEXT:    vpinsrw $5, 10(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    je LBB22_14
-; AVX512VLDQ-NEXT:  LBB22_13: ## %cond.load16
+; AVX512VLDQ-NEXT:  LBB22_13: ## %cond.load6
 ; AVX512VLDQ-NEXT:    vpinsrw $6, 12(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    je LBB22_16
-; AVX512VLDQ-NEXT:  LBB22_15: ## %cond.load19
+; AVX512VLDQ-NEXT:  LBB22_15: ## %cond.load7
 ; AVX512VLDQ-NEXT:    vpinsrw $7, 14(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLDQ-NEXT:    je LBB22_18
-; AVX512VLDQ-NEXT:  LBB22_17: ## %cond.load22
+; AVX512VLDQ-NEXT:  LBB22_17: ## %cond.load8
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrw $0, 16(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLDQ-NEXT:    je LBB22_20
-; AVX512VLDQ-NEXT:  LBB22_19: ## %cond.load25
+; AVX512VLDQ-NEXT:  LBB22_19: ## %cond.load9
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrw $1, 18(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLDQ-NEXT:    je LBB22_22
-; AVX512VLDQ-NEXT:  LBB22_21: ## %cond.load28
+; AVX512VLDQ-NEXT:  LBB22_21: ## %cond.load10
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrw $2, 20(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLDQ-NEXT:    je LBB22_24
-; AVX512VLDQ-NEXT:  LBB22_23: ## %cond.load31
+; AVX512VLDQ-NEXT:  LBB22_23: ## %cond.load11
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrw $3, 22(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLDQ-NEXT:    je LBB22_26
-; AVX512VLDQ-NEXT:  LBB22_25: ## %cond.load34
+; AVX512VLDQ-NEXT:  LBB22_25: ## %cond.load12
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrw $4, 24(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLDQ-NEXT:    je LBB22_28
-; AVX512VLDQ-NEXT:  LBB22_27: ## %cond.load37
+; AVX512VLDQ-NEXT:  LBB22_27: ## %cond.load13
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrw $5, 26(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLDQ-NEXT:    je LBB22_30
-; AVX512VLDQ-NEXT:  LBB22_29: ## %cond.load40
+; AVX512VLDQ-NEXT:  LBB22_29: ## %cond.load14
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrw $6, 28(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLDQ-NEXT:    je LBB22_32
-; AVX512VLDQ-NEXT:  LBB22_31: ## %cond.load43
+; AVX512VLDQ-NEXT:  LBB22_31: ## %cond.load15
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrw $7, 30(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
@@ -3657,49 +3657,49 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB23_3
-; SSE2-NEXT:  LBB23_4: ## %else2
+; SSE2-NEXT:  LBB23_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB23_5
-; SSE2-NEXT:  LBB23_6: ## %else5
+; SSE2-NEXT:  LBB23_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB23_7
-; SSE2-NEXT:  LBB23_8: ## %else8
+; SSE2-NEXT:  LBB23_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB23_9
-; SSE2-NEXT:  LBB23_10: ## %else11
+; SSE2-NEXT:  LBB23_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB23_11
-; SSE2-NEXT:  LBB23_12: ## %else14
+; SSE2-NEXT:  LBB23_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB23_13
-; SSE2-NEXT:  LBB23_14: ## %else17
+; SSE2-NEXT:  LBB23_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB23_15
-; SSE2-NEXT:  LBB23_16: ## %else20
+; SSE2-NEXT:  LBB23_16: ## %else7
 ; SSE2-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE2-NEXT:    jne LBB23_17
-; SSE2-NEXT:  LBB23_18: ## %else23
+; SSE2-NEXT:  LBB23_18: ## %else8
 ; SSE2-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE2-NEXT:    jne LBB23_19
-; SSE2-NEXT:  LBB23_20: ## %else26
+; SSE2-NEXT:  LBB23_20: ## %else9
 ; SSE2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE2-NEXT:    jne LBB23_21
-; SSE2-NEXT:  LBB23_22: ## %else29
+; SSE2-NEXT:  LBB23_22: ## %else10
 ; SSE2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE2-NEXT:    jne LBB23_23
-; SSE2-NEXT:  LBB23_24: ## %else32
+; SSE2-NEXT:  LBB23_24: ## %else11
 ; SSE2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE2-NEXT:    jne LBB23_25
-; SSE2-NEXT:  LBB23_26: ## %else35
+; SSE2-NEXT:  LBB23_26: ## %else12
 ; SSE2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE2-NEXT:    jne LBB23_27
-; SSE2-NEXT:  LBB23_28: ## %else38
+; SSE2-NEXT:  LBB23_28: ## %else13
 ; SSE2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE2-NEXT:    jne LBB23_29
-; SSE2-NEXT:  LBB23_30: ## %else41
+; SSE2-NEXT:  LBB23_30: ## %else14
 ; SSE2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE2-NEXT:    jne LBB23_31
-; SSE2-NEXT:  LBB23_32: ## %else44
+; SSE2-NEXT:  LBB23_32: ## %else15
 ; SSE2-NEXT:    movdqa %xmm1, %xmm0
 ; SSE2-NEXT:    retq
 ; SSE2-NEXT:  LBB23_1: ## %cond.load
@@ -3721,7 +3721,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB23_6
-; SSE2-NEXT:  LBB23_5: ## %cond.load4
+; SSE2-NEXT:  LBB23_5: ## %cond.load2
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,0,255,255,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 2(%rdi), %ecx
@@ -3731,7 +3731,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB23_8
-; SSE2-NEXT:  LBB23_7: ## %cond.load7
+; SSE2-NEXT:  LBB23_7: ## %cond.load3
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,0,255,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 3(%rdi), %ecx
@@ -3741,7 +3741,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB23_10
-; SSE2-NEXT:  LBB23_9: ## %cond.load10
+; SSE2-NEXT:  LBB23_9: ## %cond.load4
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,0,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 4(%rdi), %ecx
@@ -3751,7 +3751,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB23_12
-; SSE2-NEXT:  LBB23_11: ## %cond.load13
+; SSE2-NEXT:  LBB23_11: ## %cond.load5
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,0,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 5(%rdi), %ecx
@@ -3761,7 +3761,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB23_14
-; SSE2-NEXT:  LBB23_13: ## %cond.load16
+; SSE2-NEXT:  LBB23_13: ## %cond.load6
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,0,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 6(%rdi), %ecx
@@ -3771,7 +3771,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB23_16
-; SSE2-NEXT:  LBB23_15: ## %cond.load19
+; SSE2-NEXT:  LBB23_15: ## %cond.load7
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,0,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 7(%rdi), %ecx
@@ -3781,7 +3781,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE2-NEXT:    je LBB23_18
-; SSE2-NEXT:  LBB23_17: ## %cond.load22
+; SSE2-NEXT:  LBB23_17: ## %cond.load8
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,0,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 8(%rdi), %ecx
@@ -3791,7 +3791,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE2-NEXT:    je LBB23_20
-; SSE2-NEXT:  LBB23_19: ## %cond.load25
+; SSE2-NEXT:  LBB23_19: ## %cond.load9
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,0,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 9(%rdi), %ecx
@@ -3801,7 +3801,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE2-NEXT:    je LBB23_22
-; SSE2-NEXT:  LBB23_21: ## %cond.load28
+; SSE2-NEXT:  LBB23_21: ## %cond.load10
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,0,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 10(%rdi), %ecx
@@ -3811,7 +3811,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE2-NEXT:    je LBB23_24
-; SSE2-NEXT:  LBB23_23: ## %cond.load31
+; SSE2-NEXT:  LBB23_23: ## %cond.load11
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,0,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 11(%rdi), %ecx
@@ -3821,7 +3821,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE2-NEXT:    je LBB23_26
-; SSE2-NEXT:  LBB23_25: ## %cond.load34
+; SSE2-NEXT:  LBB23_25: ## %cond.load12
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,255,0,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 12(%rdi), %ecx
@@ -3831,7 +3831,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE2-NEXT:    je LBB23_28
-; SSE2-NEXT:  LBB23_27: ## %cond.load37
+; SSE2-NEXT:  LBB23_27: ## %cond.load13
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,255,255,0,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 13(%rdi), %ecx
@@ -3841,7 +3841,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE2-NEXT:    je LBB23_30
-; SSE2-NEXT:  LBB23_29: ## %cond.load40
+; SSE2-NEXT:  LBB23_29: ## %cond.load14
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm1
 ; SSE2-NEXT:    movzbl 14(%rdi), %ecx
@@ -3851,7 +3851,7 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE2-NEXT:    por %xmm0, %xmm1
 ; SSE2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE2-NEXT:    je LBB23_32
-; SSE2-NEXT:  LBB23_31: ## %cond.load43
+; SSE2-NEXT:  LBB23_31: ## %cond.load15
 ; SSE2-NEXT:    pand {{.*}}(%rip), %xmm1
 ; SSE2-NEXT:    movzbl 15(%rdi), %eax
 ; SSE2-NEXT:    movd %eax, %xmm0
@@ -3868,49 +3868,49 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB23_3
-; SSE42-NEXT:  LBB23_4: ## %else2
+; SSE42-NEXT:  LBB23_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB23_5
-; SSE42-NEXT:  LBB23_6: ## %else5
+; SSE42-NEXT:  LBB23_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB23_7
-; SSE42-NEXT:  LBB23_8: ## %else8
+; SSE42-NEXT:  LBB23_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB23_9
-; SSE42-NEXT:  LBB23_10: ## %else11
+; SSE42-NEXT:  LBB23_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB23_11
-; SSE42-NEXT:  LBB23_12: ## %else14
+; SSE42-NEXT:  LBB23_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB23_13
-; SSE42-NEXT:  LBB23_14: ## %else17
+; SSE42-NEXT:  LBB23_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB23_15
-; SSE42-NEXT:  LBB23_16: ## %else20
+; SSE42-NEXT:  LBB23_16: ## %else7
 ; SSE42-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE42-NEXT:    jne LBB23_17
-; SSE42-NEXT:  LBB23_18: ## %else23
+; SSE42-NEXT:  LBB23_18: ## %else8
 ; SSE42-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE42-NEXT:    jne LBB23_19
-; SSE42-NEXT:  LBB23_20: ## %else26
+; SSE42-NEXT:  LBB23_20: ## %else9
 ; SSE42-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE42-NEXT:    jne LBB23_21
-; SSE42-NEXT:  LBB23_22: ## %else29
+; SSE42-NEXT:  LBB23_22: ## %else10
 ; SSE42-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE42-NEXT:    jne LBB23_23
-; SSE42-NEXT:  LBB23_24: ## %else32
+; SSE42-NEXT:  LBB23_24: ## %else11
 ; SSE42-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE42-NEXT:    jne LBB23_25
-; SSE42-NEXT:  LBB23_26: ## %else35
+; SSE42-NEXT:  LBB23_26: ## %else12
 ; SSE42-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE42-NEXT:    jne LBB23_27
-; SSE42-NEXT:  LBB23_28: ## %else38
+; SSE42-NEXT:  LBB23_28: ## %else13
 ; SSE42-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE42-NEXT:    jne LBB23_29
-; SSE42-NEXT:  LBB23_30: ## %else41
+; SSE42-NEXT:  LBB23_30: ## %else14
 ; SSE42-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE42-NEXT:    jne LBB23_31
-; SSE42-NEXT:  LBB23_32: ## %else44
+; SSE42-NEXT:  LBB23_32: ## %else15
 ; SSE42-NEXT:    movdqa %xmm1, %xmm0
 ; SSE42-NEXT:    retq
 ; SSE42-NEXT:  LBB23_1: ## %cond.load
@@ -3921,59 +3921,59 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; SSE42-NEXT:    pinsrb $1, 1(%rdi), %xmm1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB23_6
-; SSE42-NEXT:  LBB23_5: ## %cond.load4
+; SSE42-NEXT:  LBB23_5: ## %cond.load2
 ; SSE42-NEXT:    pinsrb $2, 2(%rdi), %xmm1
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB23_8
-; SSE42-NEXT:  LBB23_7: ## %cond.load7
+; SSE42-NEXT:  LBB23_7: ## %cond.load3
 ; SSE42-NEXT:    pinsrb $3, 3(%rdi), %xmm1
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB23_10
-; SSE42-NEXT:  LBB23_9: ## %cond.load10
+; SSE42-NEXT:  LBB23_9: ## %cond.load4
 ; SSE42-NEXT:    pinsrb $4, 4(%rdi), %xmm1
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB23_12
-; SSE42-NEXT:  LBB23_11: ## %cond.load13
+; SSE42-NEXT:  LBB23_11: ## %cond.load5
 ; SSE42-NEXT:    pinsrb $5, 5(%rdi), %xmm1
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB23_14
-; SSE42-NEXT:  LBB23_13: ## %cond.load16
+; SSE42-NEXT:  LBB23_13: ## %cond.load6
 ; SSE42-NEXT:    pinsrb $6, 6(%rdi), %xmm1
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB23_16
-; SSE42-NEXT:  LBB23_15: ## %cond.load19
+; SSE42-NEXT:  LBB23_15: ## %cond.load7
 ; SSE42-NEXT:    pinsrb $7, 7(%rdi), %xmm1
 ; SSE42-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE42-NEXT:    je LBB23_18
-; SSE42-NEXT:  LBB23_17: ## %cond.load22
+; SSE42-NEXT:  LBB23_17: ## %cond.load8
 ; SSE42-NEXT:    pinsrb $8, 8(%rdi), %xmm1
 ; SSE42-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE42-NEXT:    je LBB23_20
-; SSE42-NEXT:  LBB23_19: ## %cond.load25
+; SSE42-NEXT:  LBB23_19: ## %cond.load9
 ; SSE42-NEXT:    pinsrb $9, 9(%rdi), %xmm1
 ; SSE42-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE42-NEXT:    je LBB23_22
-; SSE42-NEXT:  LBB23_21: ## %cond.load28
+; SSE42-NEXT:  LBB23_21: ## %cond.load10
 ; SSE42-NEXT:    pinsrb $10, 10(%rdi), %xmm1
 ; SSE42-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE42-NEXT:    je LBB23_24
-; SSE42-NEXT:  LBB23_23: ## %cond.load31
+; SSE42-NEXT:  LBB23_23: ## %cond.load11
 ; SSE42-NEXT:    pinsrb $11, 11(%rdi), %xmm1
 ; SSE42-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE42-NEXT:    je LBB23_26
-; SSE42-NEXT:  LBB23_25: ## %cond.load34
+; SSE42-NEXT:  LBB23_25: ## %cond.load12
 ; SSE42-NEXT:    pinsrb $12, 12(%rdi), %xmm1
 ; SSE42-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE42-NEXT:    je LBB23_28
-; SSE42-NEXT:  LBB23_27: ## %cond.load37
+; SSE42-NEXT:  LBB23_27: ## %cond.load13
 ; SSE42-NEXT:    pinsrb $13, 13(%rdi), %xmm1
 ; SSE42-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE42-NEXT:    je LBB23_30
-; SSE42-NEXT:  LBB23_29: ## %cond.load40
+; SSE42-NEXT:  LBB23_29: ## %cond.load14
 ; SSE42-NEXT:    pinsrb $14, 14(%rdi), %xmm1
 ; SSE42-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE42-NEXT:    je LBB23_32
-; SSE42-NEXT:  LBB23_31: ## %cond.load43
+; SSE42-NEXT:  LBB23_31: ## %cond.load15
 ; SSE42-NEXT:    pinsrb $15, 15(%rdi), %xmm1
 ; SSE42-NEXT:    movdqa %xmm1, %xmm0
 ; SSE42-NEXT:    retq
@@ -3986,49 +3986,49 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; AVX1OR2-NEXT:  ## %bb.2: ## %else
 ; AVX1OR2-NEXT:    testb $2, %al
 ; AVX1OR2-NEXT:    jne LBB23_3
-; AVX1OR2-NEXT:  LBB23_4: ## %else2
+; AVX1OR2-NEXT:  LBB23_4: ## %else1
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    jne LBB23_5
-; AVX1OR2-NEXT:  LBB23_6: ## %else5
+; AVX1OR2-NEXT:  LBB23_6: ## %else2
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    jne LBB23_7
-; AVX1OR2-NEXT:  LBB23_8: ## %else8
+; AVX1OR2-NEXT:  LBB23_8: ## %else3
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    jne LBB23_9
-; AVX1OR2-NEXT:  LBB23_10: ## %else11
+; AVX1OR2-NEXT:  LBB23_10: ## %else4
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    jne LBB23_11
-; AVX1OR2-NEXT:  LBB23_12: ## %else14
+; AVX1OR2-NEXT:  LBB23_12: ## %else5
 ; AVX1OR2-NEXT:    testb $64, %al
 ; AVX1OR2-NEXT:    jne LBB23_13
-; AVX1OR2-NEXT:  LBB23_14: ## %else17
+; AVX1OR2-NEXT:  LBB23_14: ## %else6
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    jne LBB23_15
-; AVX1OR2-NEXT:  LBB23_16: ## %else20
+; AVX1OR2-NEXT:  LBB23_16: ## %else7
 ; AVX1OR2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1OR2-NEXT:    jne LBB23_17
-; AVX1OR2-NEXT:  LBB23_18: ## %else23
+; AVX1OR2-NEXT:  LBB23_18: ## %else8
 ; AVX1OR2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1OR2-NEXT:    jne LBB23_19
-; AVX1OR2-NEXT:  LBB23_20: ## %else26
+; AVX1OR2-NEXT:  LBB23_20: ## %else9
 ; AVX1OR2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1OR2-NEXT:    jne LBB23_21
-; AVX1OR2-NEXT:  LBB23_22: ## %else29
+; AVX1OR2-NEXT:  LBB23_22: ## %else10
 ; AVX1OR2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1OR2-NEXT:    jne LBB23_23
-; AVX1OR2-NEXT:  LBB23_24: ## %else32
+; AVX1OR2-NEXT:  LBB23_24: ## %else11
 ; AVX1OR2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1OR2-NEXT:    jne LBB23_25
-; AVX1OR2-NEXT:  LBB23_26: ## %else35
+; AVX1OR2-NEXT:  LBB23_26: ## %else12
 ; AVX1OR2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1OR2-NEXT:    jne LBB23_27
-; AVX1OR2-NEXT:  LBB23_28: ## %else38
+; AVX1OR2-NEXT:  LBB23_28: ## %else13
 ; AVX1OR2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1OR2-NEXT:    jne LBB23_29
-; AVX1OR2-NEXT:  LBB23_30: ## %else41
+; AVX1OR2-NEXT:  LBB23_30: ## %else14
 ; AVX1OR2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1OR2-NEXT:    jne LBB23_31
-; AVX1OR2-NEXT:  LBB23_32: ## %else44
+; AVX1OR2-NEXT:  LBB23_32: ## %else15
 ; AVX1OR2-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX1OR2-NEXT:    retq
 ; AVX1OR2-NEXT:  LBB23_1: ## %cond.load
@@ -4039,59 +4039,59 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; AVX1OR2-NEXT:    vpinsrb $1, 1(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $4, %al
 ; AVX1OR2-NEXT:    je LBB23_6
-; AVX1OR2-NEXT:  LBB23_5: ## %cond.load4
+; AVX1OR2-NEXT:  LBB23_5: ## %cond.load2
 ; AVX1OR2-NEXT:    vpinsrb $2, 2(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $8, %al
 ; AVX1OR2-NEXT:    je LBB23_8
-; AVX1OR2-NEXT:  LBB23_7: ## %cond.load7
+; AVX1OR2-NEXT:  LBB23_7: ## %cond.load3
 ; AVX1OR2-NEXT:    vpinsrb $3, 3(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $16, %al
 ; AVX1OR2-NEXT:    je LBB23_10
-; AVX1OR2-NEXT:  LBB23_9: ## %cond.load10
+; AVX1OR2-NEXT:  LBB23_9: ## %cond.load4
 ; AVX1OR2-NEXT:    vpinsrb $4, 4(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $32, %al
 ; AVX1OR2-NEXT:    je LBB23_12
-; AVX1OR2-NEXT:  LBB23_11: ## %cond.load13
+; AVX1OR2-NEXT:  LBB23_11: ## %cond.load5
 ; AVX1OR2-NEXT:    vpinsrb $5, 5(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $64, %al
 ; AVX1OR2-NEXT:    je LBB23_14
-; AVX1OR2-NEXT:  LBB23_13: ## %cond.load16
+; AVX1OR2-NEXT:  LBB23_13: ## %cond.load6
 ; AVX1OR2-NEXT:    vpinsrb $6, 6(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testb $-128, %al
 ; AVX1OR2-NEXT:    je LBB23_16
-; AVX1OR2-NEXT:  LBB23_15: ## %cond.load19
+; AVX1OR2-NEXT:  LBB23_15: ## %cond.load7
 ; AVX1OR2-NEXT:    vpinsrb $7, 7(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1OR2-NEXT:    je LBB23_18
-; AVX1OR2-NEXT:  LBB23_17: ## %cond.load22
+; AVX1OR2-NEXT:  LBB23_17: ## %cond.load8
 ; AVX1OR2-NEXT:    vpinsrb $8, 8(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1OR2-NEXT:    je LBB23_20
-; AVX1OR2-NEXT:  LBB23_19: ## %cond.load25
+; AVX1OR2-NEXT:  LBB23_19: ## %cond.load9
 ; AVX1OR2-NEXT:    vpinsrb $9, 9(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1OR2-NEXT:    je LBB23_22
-; AVX1OR2-NEXT:  LBB23_21: ## %cond.load28
+; AVX1OR2-NEXT:  LBB23_21: ## %cond.load10
 ; AVX1OR2-NEXT:    vpinsrb $10, 10(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1OR2-NEXT:    je LBB23_24
-; AVX1OR2-NEXT:  LBB23_23: ## %cond.load31
+; AVX1OR2-NEXT:  LBB23_23: ## %cond.load11
 ; AVX1OR2-NEXT:    vpinsrb $11, 11(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1OR2-NEXT:    je LBB23_26
-; AVX1OR2-NEXT:  LBB23_25: ## %cond.load34
+; AVX1OR2-NEXT:  LBB23_25: ## %cond.load12
 ; AVX1OR2-NEXT:    vpinsrb $12, 12(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1OR2-NEXT:    je LBB23_28
-; AVX1OR2-NEXT:  LBB23_27: ## %cond.load37
+; AVX1OR2-NEXT:  LBB23_27: ## %cond.load13
 ; AVX1OR2-NEXT:    vpinsrb $13, 13(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1OR2-NEXT:    je LBB23_30
-; AVX1OR2-NEXT:  LBB23_29: ## %cond.load40
+; AVX1OR2-NEXT:  LBB23_29: ## %cond.load14
 ; AVX1OR2-NEXT:    vpinsrb $14, 14(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1OR2-NEXT:    je LBB23_32
-; AVX1OR2-NEXT:  LBB23_31: ## %cond.load43
+; AVX1OR2-NEXT:  LBB23_31: ## %cond.load15
 ; AVX1OR2-NEXT:    vpinsrb $15, 15(%rdi), %xmm1, %xmm1
 ; AVX1OR2-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX1OR2-NEXT:    retq
@@ -4104,49 +4104,49 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; AVX512F-NEXT:  ## %bb.2: ## %else
 ; AVX512F-NEXT:    testb $2, %al
 ; AVX512F-NEXT:    jne LBB23_3
-; AVX512F-NEXT:  LBB23_4: ## %else2
+; AVX512F-NEXT:  LBB23_4: ## %else1
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    jne LBB23_5
-; AVX512F-NEXT:  LBB23_6: ## %else5
+; AVX512F-NEXT:  LBB23_6: ## %else2
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    jne LBB23_7
-; AVX512F-NEXT:  LBB23_8: ## %else8
+; AVX512F-NEXT:  LBB23_8: ## %else3
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    jne LBB23_9
-; AVX512F-NEXT:  LBB23_10: ## %else11
+; AVX512F-NEXT:  LBB23_10: ## %else4
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    jne LBB23_11
-; AVX512F-NEXT:  LBB23_12: ## %else14
+; AVX512F-NEXT:  LBB23_12: ## %else5
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    jne LBB23_13
-; AVX512F-NEXT:  LBB23_14: ## %else17
+; AVX512F-NEXT:  LBB23_14: ## %else6
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    jne LBB23_15
-; AVX512F-NEXT:  LBB23_16: ## %else20
+; AVX512F-NEXT:  LBB23_16: ## %else7
 ; AVX512F-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512F-NEXT:    jne LBB23_17
-; AVX512F-NEXT:  LBB23_18: ## %else23
+; AVX512F-NEXT:  LBB23_18: ## %else8
 ; AVX512F-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512F-NEXT:    jne LBB23_19
-; AVX512F-NEXT:  LBB23_20: ## %else26
+; AVX512F-NEXT:  LBB23_20: ## %else9
 ; AVX512F-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512F-NEXT:    jne LBB23_21
-; AVX512F-NEXT:  LBB23_22: ## %else29
+; AVX512F-NEXT:  LBB23_22: ## %else10
 ; AVX512F-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512F-NEXT:    jne LBB23_23
-; AVX512F-NEXT:  LBB23_24: ## %else32
+; AVX512F-NEXT:  LBB23_24: ## %else11
 ; AVX512F-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512F-NEXT:    jne LBB23_25
-; AVX512F-NEXT:  LBB23_26: ## %else35
+; AVX512F-NEXT:  LBB23_26: ## %else12
 ; AVX512F-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512F-NEXT:    jne LBB23_27
-; AVX512F-NEXT:  LBB23_28: ## %else38
+; AVX512F-NEXT:  LBB23_28: ## %else13
 ; AVX512F-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512F-NEXT:    jne LBB23_29
-; AVX512F-NEXT:  LBB23_30: ## %else41
+; AVX512F-NEXT:  LBB23_30: ## %else14
 ; AVX512F-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512F-NEXT:    jne LBB23_31
-; AVX512F-NEXT:  LBB23_32: ## %else44
+; AVX512F-NEXT:  LBB23_32: ## %else15
 ; AVX512F-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX512F-NEXT:    retq
 ; AVX512F-NEXT:  LBB23_1: ## %cond.load
@@ -4157,59 +4157,59 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; AVX512F-NEXT:    vpinsrb $1, 1(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    je LBB23_6
-; AVX512F-NEXT:  LBB23_5: ## %cond.load4
+; AVX512F-NEXT:  LBB23_5: ## %cond.load2
 ; AVX512F-NEXT:    vpinsrb $2, 2(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    je LBB23_8
-; AVX512F-NEXT:  LBB23_7: ## %cond.load7
+; AVX512F-NEXT:  LBB23_7: ## %cond.load3
 ; AVX512F-NEXT:    vpinsrb $3, 3(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    je LBB23_10
-; AVX512F-NEXT:  LBB23_9: ## %cond.load10
+; AVX512F-NEXT:  LBB23_9: ## %cond.load4
 ; AVX512F-NEXT:    vpinsrb $4, 4(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    je LBB23_12
-; AVX512F-NEXT:  LBB23_11: ## %cond.load13
+; AVX512F-NEXT:  LBB23_11: ## %cond.load5
 ; AVX512F-NEXT:    vpinsrb $5, 5(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    je LBB23_14
-; AVX512F-NEXT:  LBB23_13: ## %cond.load16
+; AVX512F-NEXT:  LBB23_13: ## %cond.load6
 ; AVX512F-NEXT:    vpinsrb $6, 6(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    je LBB23_16
-; AVX512F-NEXT:  LBB23_15: ## %cond.load19
+; AVX512F-NEXT:  LBB23_15: ## %cond.load7
 ; AVX512F-NEXT:    vpinsrb $7, 7(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512F-NEXT:    je LBB23_18
-; AVX512F-NEXT:  LBB23_17: ## %cond.load22
+; AVX512F-NEXT:  LBB23_17: ## %cond.load8
 ; AVX512F-NEXT:    vpinsrb $8, 8(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512F-NEXT:    je LBB23_20
-; AVX512F-NEXT:  LBB23_19: ## %cond.load25
+; AVX512F-NEXT:  LBB23_19: ## %cond.load9
 ; AVX512F-NEXT:    vpinsrb $9, 9(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512F-NEXT:    je LBB23_22
-; AVX512F-NEXT:  LBB23_21: ## %cond.load28
+; AVX512F-NEXT:  LBB23_21: ## %cond.load10
 ; AVX512F-NEXT:    vpinsrb $10, 10(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512F-NEXT:    je LBB23_24
-; AVX512F-NEXT:  LBB23_23: ## %cond.load31
+; AVX512F-NEXT:  LBB23_23: ## %cond.load11
 ; AVX512F-NEXT:    vpinsrb $11, 11(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512F-NEXT:    je LBB23_26
-; AVX512F-NEXT:  LBB23_25: ## %cond.load34
+; AVX512F-NEXT:  LBB23_25: ## %cond.load12
 ; AVX512F-NEXT:    vpinsrb $12, 12(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512F-NEXT:    je LBB23_28
-; AVX512F-NEXT:  LBB23_27: ## %cond.load37
+; AVX512F-NEXT:  LBB23_27: ## %cond.load13
 ; AVX512F-NEXT:    vpinsrb $13, 13(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512F-NEXT:    je LBB23_30
-; AVX512F-NEXT:  LBB23_29: ## %cond.load40
+; AVX512F-NEXT:  LBB23_29: ## %cond.load14
 ; AVX512F-NEXT:    vpinsrb $14, 14(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512F-NEXT:    je LBB23_32
-; AVX512F-NEXT:  LBB23_31: ## %cond.load43
+; AVX512F-NEXT:  LBB23_31: ## %cond.load15
 ; AVX512F-NEXT:    vpinsrb $15, 15(%rdi), %xmm1, %xmm1
 ; AVX512F-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX512F-NEXT:    retq
@@ -4222,49 +4222,49 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; AVX512VLDQ-NEXT:  ## %bb.2: ## %else
 ; AVX512VLDQ-NEXT:    testb $2, %al
 ; AVX512VLDQ-NEXT:    jne LBB23_3
-; AVX512VLDQ-NEXT:  LBB23_4: ## %else2
+; AVX512VLDQ-NEXT:  LBB23_4: ## %else1
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    jne LBB23_5
-; AVX512VLDQ-NEXT:  LBB23_6: ## %else5
+; AVX512VLDQ-NEXT:  LBB23_6: ## %else2
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    jne LBB23_7
-; AVX512VLDQ-NEXT:  LBB23_8: ## %else8
+; AVX512VLDQ-NEXT:  LBB23_8: ## %else3
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    jne LBB23_9
-; AVX512VLDQ-NEXT:  LBB23_10: ## %else11
+; AVX512VLDQ-NEXT:  LBB23_10: ## %else4
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    jne LBB23_11
-; AVX512VLDQ-NEXT:  LBB23_12: ## %else14
+; AVX512VLDQ-NEXT:  LBB23_12: ## %else5
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    jne LBB23_13
-; AVX512VLDQ-NEXT:  LBB23_14: ## %else17
+; AVX512VLDQ-NEXT:  LBB23_14: ## %else6
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    jne LBB23_15
-; AVX512VLDQ-NEXT:  LBB23_16: ## %else20
+; AVX512VLDQ-NEXT:  LBB23_16: ## %else7
 ; AVX512VLDQ-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLDQ-NEXT:    jne LBB23_17
-; AVX512VLDQ-NEXT:  LBB23_18: ## %else23
+; AVX512VLDQ-NEXT:  LBB23_18: ## %else8
 ; AVX512VLDQ-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLDQ-NEXT:    jne LBB23_19
-; AVX512VLDQ-NEXT:  LBB23_20: ## %else26
+; AVX512VLDQ-NEXT:  LBB23_20: ## %else9
 ; AVX512VLDQ-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLDQ-NEXT:    jne LBB23_21
-; AVX512VLDQ-NEXT:  LBB23_22: ## %else29
+; AVX512VLDQ-NEXT:  LBB23_22: ## %else10
 ; AVX512VLDQ-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLDQ-NEXT:    jne LBB23_23
-; AVX512VLDQ-NEXT:  LBB23_24: ## %else32
+; AVX512VLDQ-NEXT:  LBB23_24: ## %else11
 ; AVX512VLDQ-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLDQ-NEXT:    jne LBB23_25
-; AVX512VLDQ-NEXT:  LBB23_26: ## %else35
+; AVX512VLDQ-NEXT:  LBB23_26: ## %else12
 ; AVX512VLDQ-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLDQ-NEXT:    jne LBB23_27
-; AVX512VLDQ-NEXT:  LBB23_28: ## %else38
+; AVX512VLDQ-NEXT:  LBB23_28: ## %else13
 ; AVX512VLDQ-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLDQ-NEXT:    jne LBB23_29
-; AVX512VLDQ-NEXT:  LBB23_30: ## %else41
+; AVX512VLDQ-NEXT:  LBB23_30: ## %else14
 ; AVX512VLDQ-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLDQ-NEXT:    jne LBB23_31
-; AVX512VLDQ-NEXT:  LBB23_32: ## %else44
+; AVX512VLDQ-NEXT:  LBB23_32: ## %else15
 ; AVX512VLDQ-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    retq
 ; AVX512VLDQ-NEXT:  LBB23_1: ## %cond.load
@@ -4275,59 +4275,59 @@ define <16 x i8> @load_v16i8_v16i8(<16 x i8> %trigger, <16 x i8>* %addr, <16 x i
 ; AVX512VLDQ-NEXT:    vpinsrb $1, 1(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    je LBB23_6
-; AVX512VLDQ-NEXT:  LBB23_5: ## %cond.load4
+; AVX512VLDQ-NEXT:  LBB23_5: ## %cond.load2
 ; AVX512VLDQ-NEXT:    vpinsrb $2, 2(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    je LBB23_8
-; AVX512VLDQ-NEXT:  LBB23_7: ## %cond.load7
+; AVX512VLDQ-NEXT:  LBB23_7: ## %cond.load3
 ; AVX512VLDQ-NEXT:    vpinsrb $3, 3(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    je LBB23_10
-; AVX512VLDQ-NEXT:  LBB23_9: ## %cond.load10
+; AVX512VLDQ-NEXT:  LBB23_9: ## %cond.load4
 ; AVX512VLDQ-NEXT:    vpinsrb $4, 4(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    je LBB23_12
-; AVX512VLDQ-NEXT:  LBB23_11: ## %cond.load13
+; AVX512VLDQ-NEXT:  LBB23_11: ## %cond.load5
 ; AVX512VLDQ-NEXT:    vpinsrb $5, 5(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    je LBB23_14
-; AVX512VLDQ-NEXT:  LBB23_13: ## %cond.load16
+; AVX512VLDQ-NEXT:  LBB23_13: ## %cond.load6
 ; AVX512VLDQ-NEXT:    vpinsrb $6, 6(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    je LBB23_16
-; AVX512VLDQ-NEXT:  LBB23_15: ## %cond.load19
+; AVX512VLDQ-NEXT:  LBB23_15: ## %cond.load7
 ; AVX512VLDQ-NEXT:    vpinsrb $7, 7(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLDQ-NEXT:    je LBB23_18
-; AVX512VLDQ-NEXT:  LBB23_17: ## %cond.load22
+; AVX512VLDQ-NEXT:  LBB23_17: ## %cond.load8
 ; AVX512VLDQ-NEXT:    vpinsrb $8, 8(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLDQ-NEXT:    je LBB23_20
-; AVX512VLDQ-NEXT:  LBB23_19: ## %cond.load25
+; AVX512VLDQ-NEXT:  LBB23_19: ## %cond.load9
 ; AVX512VLDQ-NEXT:    vpinsrb $9, 9(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLDQ-NEXT:    je LBB23_22
-; AVX512VLDQ-NEXT:  LBB23_21: ## %cond.load28
+; AVX512VLDQ-NEXT:  LBB23_21: ## %cond.load10
 ; AVX512VLDQ-NEXT:    vpinsrb $10, 10(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLDQ-NEXT:    je LBB23_24
-; AVX512VLDQ-NEXT:  LBB23_23: ## %cond.load31
+; AVX512VLDQ-NEXT:  LBB23_23: ## %cond.load11
 ; AVX512VLDQ-NEXT:    vpinsrb $11, 11(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLDQ-NEXT:    je LBB23_26
-; AVX512VLDQ-NEXT:  LBB23_25: ## %cond.load34
+; AVX512VLDQ-NEXT:  LBB23_25: ## %cond.load12
 ; AVX512VLDQ-NEXT:    vpinsrb $12, 12(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLDQ-NEXT:    je LBB23_28
-; AVX512VLDQ-NEXT:  LBB23_27: ## %cond.load37
+; AVX512VLDQ-NEXT:  LBB23_27: ## %cond.load13
 ; AVX512VLDQ-NEXT:    vpinsrb $13, 13(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLDQ-NEXT:    je LBB23_30
-; AVX512VLDQ-NEXT:  LBB23_29: ## %cond.load40
+; AVX512VLDQ-NEXT:  LBB23_29: ## %cond.load14
 ; AVX512VLDQ-NEXT:    vpinsrb $14, 14(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLDQ-NEXT:    je LBB23_32
-; AVX512VLDQ-NEXT:  LBB23_31: ## %cond.load43
+; AVX512VLDQ-NEXT:  LBB23_31: ## %cond.load15
 ; AVX512VLDQ-NEXT:    vpinsrb $15, 15(%rdi), %xmm1, %xmm1
 ; AVX512VLDQ-NEXT:    vmovdqa %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    retq
@@ -4354,103 +4354,103 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:  ## %bb.2: ## %else
 ; SSE2-NEXT:    testb $2, %al
 ; SSE2-NEXT:    jne LBB24_3
-; SSE2-NEXT:  LBB24_4: ## %else2
+; SSE2-NEXT:  LBB24_4: ## %else1
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    jne LBB24_5
-; SSE2-NEXT:  LBB24_6: ## %else5
+; SSE2-NEXT:  LBB24_6: ## %else2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    jne LBB24_7
-; SSE2-NEXT:  LBB24_8: ## %else8
+; SSE2-NEXT:  LBB24_8: ## %else3
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    jne LBB24_9
-; SSE2-NEXT:  LBB24_10: ## %else11
+; SSE2-NEXT:  LBB24_10: ## %else4
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    jne LBB24_11
-; SSE2-NEXT:  LBB24_12: ## %else14
+; SSE2-NEXT:  LBB24_12: ## %else5
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    jne LBB24_13
-; SSE2-NEXT:  LBB24_14: ## %else17
+; SSE2-NEXT:  LBB24_14: ## %else6
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    jne LBB24_15
-; SSE2-NEXT:  LBB24_16: ## %else20
+; SSE2-NEXT:  LBB24_16: ## %else7
 ; SSE2-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE2-NEXT:    jne LBB24_17
-; SSE2-NEXT:  LBB24_18: ## %else23
+; SSE2-NEXT:  LBB24_18: ## %else8
 ; SSE2-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE2-NEXT:    jne LBB24_19
-; SSE2-NEXT:  LBB24_20: ## %else26
+; SSE2-NEXT:  LBB24_20: ## %else9
 ; SSE2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE2-NEXT:    jne LBB24_21
-; SSE2-NEXT:  LBB24_22: ## %else29
+; SSE2-NEXT:  LBB24_22: ## %else10
 ; SSE2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE2-NEXT:    jne LBB24_23
-; SSE2-NEXT:  LBB24_24: ## %else32
+; SSE2-NEXT:  LBB24_24: ## %else11
 ; SSE2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE2-NEXT:    jne LBB24_25
-; SSE2-NEXT:  LBB24_26: ## %else35
+; SSE2-NEXT:  LBB24_26: ## %else12
 ; SSE2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE2-NEXT:    jne LBB24_27
-; SSE2-NEXT:  LBB24_28: ## %else38
+; SSE2-NEXT:  LBB24_28: ## %else13
 ; SSE2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE2-NEXT:    jne LBB24_29
-; SSE2-NEXT:  LBB24_30: ## %else41
+; SSE2-NEXT:  LBB24_30: ## %else14
 ; SSE2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE2-NEXT:    jne LBB24_31
-; SSE2-NEXT:  LBB24_32: ## %else44
+; SSE2-NEXT:  LBB24_32: ## %else15
 ; SSE2-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; SSE2-NEXT:    jne LBB24_33
-; SSE2-NEXT:  LBB24_34: ## %else47
+; SSE2-NEXT:  LBB24_34: ## %else16
 ; SSE2-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; SSE2-NEXT:    jne LBB24_35
-; SSE2-NEXT:  LBB24_36: ## %else50
+; SSE2-NEXT:  LBB24_36: ## %else17
 ; SSE2-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; SSE2-NEXT:    jne LBB24_37
-; SSE2-NEXT:  LBB24_38: ## %else53
+; SSE2-NEXT:  LBB24_38: ## %else18
 ; SSE2-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; SSE2-NEXT:    jne LBB24_39
-; SSE2-NEXT:  LBB24_40: ## %else56
+; SSE2-NEXT:  LBB24_40: ## %else19
 ; SSE2-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; SSE2-NEXT:    jne LBB24_41
-; SSE2-NEXT:  LBB24_42: ## %else59
+; SSE2-NEXT:  LBB24_42: ## %else20
 ; SSE2-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; SSE2-NEXT:    jne LBB24_43
-; SSE2-NEXT:  LBB24_44: ## %else62
+; SSE2-NEXT:  LBB24_44: ## %else21
 ; SSE2-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; SSE2-NEXT:    jne LBB24_45
-; SSE2-NEXT:  LBB24_46: ## %else65
+; SSE2-NEXT:  LBB24_46: ## %else22
 ; SSE2-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; SSE2-NEXT:    jne LBB24_47
-; SSE2-NEXT:  LBB24_48: ## %else68
+; SSE2-NEXT:  LBB24_48: ## %else23
 ; SSE2-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; SSE2-NEXT:    jne LBB24_49
-; SSE2-NEXT:  LBB24_50: ## %else71
+; SSE2-NEXT:  LBB24_50: ## %else24
 ; SSE2-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; SSE2-NEXT:    jne LBB24_51
-; SSE2-NEXT:  LBB24_52: ## %else74
+; SSE2-NEXT:  LBB24_52: ## %else25
 ; SSE2-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; SSE2-NEXT:    jne LBB24_53
-; SSE2-NEXT:  LBB24_54: ## %else77
+; SSE2-NEXT:  LBB24_54: ## %else26
 ; SSE2-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; SSE2-NEXT:    jne LBB24_55
-; SSE2-NEXT:  LBB24_56: ## %else80
+; SSE2-NEXT:  LBB24_56: ## %else27
 ; SSE2-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; SSE2-NEXT:    jne LBB24_57
-; SSE2-NEXT:  LBB24_58: ## %else83
+; SSE2-NEXT:  LBB24_58: ## %else28
 ; SSE2-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; SSE2-NEXT:    jne LBB24_59
-; SSE2-NEXT:  LBB24_60: ## %else86
+; SSE2-NEXT:  LBB24_60: ## %else29
 ; SSE2-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; SSE2-NEXT:    jne LBB24_61
-; SSE2-NEXT:  LBB24_62: ## %else89
+; SSE2-NEXT:  LBB24_62: ## %else30
 ; SSE2-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; SSE2-NEXT:    je LBB24_64
-; SSE2-NEXT:  LBB24_63: ## %cond.load91
+; SSE2-NEXT:  LBB24_63: ## %cond.load31
 ; SSE2-NEXT:    pand {{.*}}(%rip), %xmm3
 ; SSE2-NEXT:    movzbl 31(%rdi), %eax
 ; SSE2-NEXT:    movd %eax, %xmm0
 ; SSE2-NEXT:    pslldq {{.*#+}} xmm0 = zero,zero,zero,zero,zero,zero,zero,zero,zero,zero,zero,zero,zero,zero,zero,xmm0[0]
 ; SSE2-NEXT:    por %xmm0, %xmm3
-; SSE2-NEXT:  LBB24_64: ## %else92
+; SSE2-NEXT:  LBB24_64: ## %else31
 ; SSE2-NEXT:    movdqa %xmm2, %xmm0
 ; SSE2-NEXT:    movdqa %xmm3, %xmm1
 ; SSE2-NEXT:    retq
@@ -4473,7 +4473,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testb $4, %al
 ; SSE2-NEXT:    je LBB24_6
-; SSE2-NEXT:  LBB24_5: ## %cond.load4
+; SSE2-NEXT:  LBB24_5: ## %cond.load2
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,0,255,255,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 2(%rdi), %ecx
@@ -4483,7 +4483,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testb $8, %al
 ; SSE2-NEXT:    je LBB24_8
-; SSE2-NEXT:  LBB24_7: ## %cond.load7
+; SSE2-NEXT:  LBB24_7: ## %cond.load3
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,0,255,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 3(%rdi), %ecx
@@ -4493,7 +4493,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testb $16, %al
 ; SSE2-NEXT:    je LBB24_10
-; SSE2-NEXT:  LBB24_9: ## %cond.load10
+; SSE2-NEXT:  LBB24_9: ## %cond.load4
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,0,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 4(%rdi), %ecx
@@ -4503,7 +4503,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testb $32, %al
 ; SSE2-NEXT:    je LBB24_12
-; SSE2-NEXT:  LBB24_11: ## %cond.load13
+; SSE2-NEXT:  LBB24_11: ## %cond.load5
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,0,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 5(%rdi), %ecx
@@ -4513,7 +4513,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testb $64, %al
 ; SSE2-NEXT:    je LBB24_14
-; SSE2-NEXT:  LBB24_13: ## %cond.load16
+; SSE2-NEXT:  LBB24_13: ## %cond.load6
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,0,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 6(%rdi), %ecx
@@ -4523,7 +4523,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testb $-128, %al
 ; SSE2-NEXT:    je LBB24_16
-; SSE2-NEXT:  LBB24_15: ## %cond.load19
+; SSE2-NEXT:  LBB24_15: ## %cond.load7
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,0,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 7(%rdi), %ecx
@@ -4533,7 +4533,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE2-NEXT:    je LBB24_18
-; SSE2-NEXT:  LBB24_17: ## %cond.load22
+; SSE2-NEXT:  LBB24_17: ## %cond.load8
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,0,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 8(%rdi), %ecx
@@ -4543,7 +4543,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE2-NEXT:    je LBB24_20
-; SSE2-NEXT:  LBB24_19: ## %cond.load25
+; SSE2-NEXT:  LBB24_19: ## %cond.load9
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,0,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 9(%rdi), %ecx
@@ -4553,7 +4553,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE2-NEXT:    je LBB24_22
-; SSE2-NEXT:  LBB24_21: ## %cond.load28
+; SSE2-NEXT:  LBB24_21: ## %cond.load10
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,0,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 10(%rdi), %ecx
@@ -4563,7 +4563,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE2-NEXT:    je LBB24_24
-; SSE2-NEXT:  LBB24_23: ## %cond.load31
+; SSE2-NEXT:  LBB24_23: ## %cond.load11
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,0,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 11(%rdi), %ecx
@@ -4573,7 +4573,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE2-NEXT:    je LBB24_26
-; SSE2-NEXT:  LBB24_25: ## %cond.load34
+; SSE2-NEXT:  LBB24_25: ## %cond.load12
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,255,0,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 12(%rdi), %ecx
@@ -4583,7 +4583,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE2-NEXT:    je LBB24_28
-; SSE2-NEXT:  LBB24_27: ## %cond.load37
+; SSE2-NEXT:  LBB24_27: ## %cond.load13
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,255,255,0,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 13(%rdi), %ecx
@@ -4593,7 +4593,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE2-NEXT:    je LBB24_30
-; SSE2-NEXT:  LBB24_29: ## %cond.load40
+; SSE2-NEXT:  LBB24_29: ## %cond.load14
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm2
 ; SSE2-NEXT:    movzbl 14(%rdi), %ecx
@@ -4603,7 +4603,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE2-NEXT:    je LBB24_32
-; SSE2-NEXT:  LBB24_31: ## %cond.load43
+; SSE2-NEXT:  LBB24_31: ## %cond.load15
 ; SSE2-NEXT:    pand {{.*}}(%rip), %xmm2
 ; SSE2-NEXT:    movzbl 15(%rdi), %ecx
 ; SSE2-NEXT:    movd %ecx, %xmm0
@@ -4611,7 +4611,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm2
 ; SSE2-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; SSE2-NEXT:    je LBB24_34
-; SSE2-NEXT:  LBB24_33: ## %cond.load46
+; SSE2-NEXT:  LBB24_33: ## %cond.load16
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 16(%rdi), %ecx
@@ -4620,7 +4620,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; SSE2-NEXT:    je LBB24_36
-; SSE2-NEXT:  LBB24_35: ## %cond.load49
+; SSE2-NEXT:  LBB24_35: ## %cond.load17
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 17(%rdi), %ecx
@@ -4630,7 +4630,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; SSE2-NEXT:    je LBB24_38
-; SSE2-NEXT:  LBB24_37: ## %cond.load52
+; SSE2-NEXT:  LBB24_37: ## %cond.load18
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,0,255,255,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 18(%rdi), %ecx
@@ -4640,7 +4640,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; SSE2-NEXT:    je LBB24_40
-; SSE2-NEXT:  LBB24_39: ## %cond.load55
+; SSE2-NEXT:  LBB24_39: ## %cond.load19
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,0,255,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 19(%rdi), %ecx
@@ -4650,7 +4650,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; SSE2-NEXT:    je LBB24_42
-; SSE2-NEXT:  LBB24_41: ## %cond.load58
+; SSE2-NEXT:  LBB24_41: ## %cond.load20
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,0,255,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 20(%rdi), %ecx
@@ -4660,7 +4660,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; SSE2-NEXT:    je LBB24_44
-; SSE2-NEXT:  LBB24_43: ## %cond.load61
+; SSE2-NEXT:  LBB24_43: ## %cond.load21
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,0,255,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 21(%rdi), %ecx
@@ -4670,7 +4670,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; SSE2-NEXT:    je LBB24_46
-; SSE2-NEXT:  LBB24_45: ## %cond.load64
+; SSE2-NEXT:  LBB24_45: ## %cond.load22
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,0,255,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 22(%rdi), %ecx
@@ -4680,7 +4680,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; SSE2-NEXT:    je LBB24_48
-; SSE2-NEXT:  LBB24_47: ## %cond.load67
+; SSE2-NEXT:  LBB24_47: ## %cond.load23
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,0,255,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 23(%rdi), %ecx
@@ -4690,7 +4690,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; SSE2-NEXT:    je LBB24_50
-; SSE2-NEXT:  LBB24_49: ## %cond.load70
+; SSE2-NEXT:  LBB24_49: ## %cond.load24
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,0,255,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 24(%rdi), %ecx
@@ -4700,7 +4700,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; SSE2-NEXT:    je LBB24_52
-; SSE2-NEXT:  LBB24_51: ## %cond.load73
+; SSE2-NEXT:  LBB24_51: ## %cond.load25
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,0,255,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 25(%rdi), %ecx
@@ -4710,7 +4710,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; SSE2-NEXT:    je LBB24_54
-; SSE2-NEXT:  LBB24_53: ## %cond.load76
+; SSE2-NEXT:  LBB24_53: ## %cond.load26
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,0,255,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 26(%rdi), %ecx
@@ -4720,7 +4720,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; SSE2-NEXT:    je LBB24_56
-; SSE2-NEXT:  LBB24_55: ## %cond.load79
+; SSE2-NEXT:  LBB24_55: ## %cond.load27
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,0,255,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 27(%rdi), %ecx
@@ -4730,7 +4730,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; SSE2-NEXT:    je LBB24_58
-; SSE2-NEXT:  LBB24_57: ## %cond.load82
+; SSE2-NEXT:  LBB24_57: ## %cond.load28
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,255,0,255,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 28(%rdi), %ecx
@@ -4740,7 +4740,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; SSE2-NEXT:    je LBB24_60
-; SSE2-NEXT:  LBB24_59: ## %cond.load85
+; SSE2-NEXT:  LBB24_59: ## %cond.load29
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,255,255,0,255,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 29(%rdi), %ecx
@@ -4750,7 +4750,7 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE2-NEXT:    por %xmm0, %xmm3
 ; SSE2-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; SSE2-NEXT:    je LBB24_62
-; SSE2-NEXT:  LBB24_61: ## %cond.load88
+; SSE2-NEXT:  LBB24_61: ## %cond.load30
 ; SSE2-NEXT:    movdqa {{.*#+}} xmm0 = [255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,255]
 ; SSE2-NEXT:    pand %xmm0, %xmm3
 ; SSE2-NEXT:    movzbl 30(%rdi), %ecx
@@ -4773,99 +4773,99 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE42-NEXT:  ## %bb.2: ## %else
 ; SSE42-NEXT:    testb $2, %al
 ; SSE42-NEXT:    jne LBB24_3
-; SSE42-NEXT:  LBB24_4: ## %else2
+; SSE42-NEXT:  LBB24_4: ## %else1
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    jne LBB24_5
-; SSE42-NEXT:  LBB24_6: ## %else5
+; SSE42-NEXT:  LBB24_6: ## %else2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    jne LBB24_7
-; SSE42-NEXT:  LBB24_8: ## %else8
+; SSE42-NEXT:  LBB24_8: ## %else3
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    jne LBB24_9
-; SSE42-NEXT:  LBB24_10: ## %else11
+; SSE42-NEXT:  LBB24_10: ## %else4
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    jne LBB24_11
-; SSE42-NEXT:  LBB24_12: ## %else14
+; SSE42-NEXT:  LBB24_12: ## %else5
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    jne LBB24_13
-; SSE42-NEXT:  LBB24_14: ## %else17
+; SSE42-NEXT:  LBB24_14: ## %else6
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    jne LBB24_15
-; SSE42-NEXT:  LBB24_16: ## %else20
+; SSE42-NEXT:  LBB24_16: ## %else7
 ; SSE42-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE42-NEXT:    jne LBB24_17
-; SSE42-NEXT:  LBB24_18: ## %else23
+; SSE42-NEXT:  LBB24_18: ## %else8
 ; SSE42-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE42-NEXT:    jne LBB24_19
-; SSE42-NEXT:  LBB24_20: ## %else26
+; SSE42-NEXT:  LBB24_20: ## %else9
 ; SSE42-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE42-NEXT:    jne LBB24_21
-; SSE42-NEXT:  LBB24_22: ## %else29
+; SSE42-NEXT:  LBB24_22: ## %else10
 ; SSE42-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE42-NEXT:    jne LBB24_23
-; SSE42-NEXT:  LBB24_24: ## %else32
+; SSE42-NEXT:  LBB24_24: ## %else11
 ; SSE42-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE42-NEXT:    jne LBB24_25
-; SSE42-NEXT:  LBB24_26: ## %else35
+; SSE42-NEXT:  LBB24_26: ## %else12
 ; SSE42-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE42-NEXT:    jne LBB24_27
-; SSE42-NEXT:  LBB24_28: ## %else38
+; SSE42-NEXT:  LBB24_28: ## %else13
 ; SSE42-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE42-NEXT:    jne LBB24_29
-; SSE42-NEXT:  LBB24_30: ## %else41
+; SSE42-NEXT:  LBB24_30: ## %else14
 ; SSE42-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE42-NEXT:    jne LBB24_31
-; SSE42-NEXT:  LBB24_32: ## %else44
+; SSE42-NEXT:  LBB24_32: ## %else15
 ; SSE42-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; SSE42-NEXT:    jne LBB24_33
-; SSE42-NEXT:  LBB24_34: ## %else47
+; SSE42-NEXT:  LBB24_34: ## %else16
 ; SSE42-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; SSE42-NEXT:    jne LBB24_35
-; SSE42-NEXT:  LBB24_36: ## %else50
+; SSE42-NEXT:  LBB24_36: ## %else17
 ; SSE42-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; SSE42-NEXT:    jne LBB24_37
-; SSE42-NEXT:  LBB24_38: ## %else53
+; SSE42-NEXT:  LBB24_38: ## %else18
 ; SSE42-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; SSE42-NEXT:    jne LBB24_39
-; SSE42-NEXT:  LBB24_40: ## %else56
+; SSE42-NEXT:  LBB24_40: ## %else19
 ; SSE42-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; SSE42-NEXT:    jne LBB24_41
-; SSE42-NEXT:  LBB24_42: ## %else59
+; SSE42-NEXT:  LBB24_42: ## %else20
 ; SSE42-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; SSE42-NEXT:    jne LBB24_43
-; SSE42-NEXT:  LBB24_44: ## %else62
+; SSE42-NEXT:  LBB24_44: ## %else21
 ; SSE42-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; SSE42-NEXT:    jne LBB24_45
-; SSE42-NEXT:  LBB24_46: ## %else65
+; SSE42-NEXT:  LBB24_46: ## %else22
 ; SSE42-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; SSE42-NEXT:    jne LBB24_47
-; SSE42-NEXT:  LBB24_48: ## %else68
+; SSE42-NEXT:  LBB24_48: ## %else23
 ; SSE42-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; SSE42-NEXT:    jne LBB24_49
-; SSE42-NEXT:  LBB24_50: ## %else71
+; SSE42-NEXT:  LBB24_50: ## %else24
 ; SSE42-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; SSE42-NEXT:    jne LBB24_51
-; SSE42-NEXT:  LBB24_52: ## %else74
+; SSE42-NEXT:  LBB24_52: ## %else25
 ; SSE42-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; SSE42-NEXT:    jne LBB24_53
-; SSE42-NEXT:  LBB24_54: ## %else77
+; SSE42-NEXT:  LBB24_54: ## %else26
 ; SSE42-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; SSE42-NEXT:    jne LBB24_55
-; SSE42-NEXT:  LBB24_56: ## %else80
+; SSE42-NEXT:  LBB24_56: ## %else27
 ; SSE42-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; SSE42-NEXT:    jne LBB24_57
-; SSE42-NEXT:  LBB24_58: ## %else83
+; SSE42-NEXT:  LBB24_58: ## %else28
 ; SSE42-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; SSE42-NEXT:    jne LBB24_59
-; SSE42-NEXT:  LBB24_60: ## %else86
+; SSE42-NEXT:  LBB24_60: ## %else29
 ; SSE42-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; SSE42-NEXT:    jne LBB24_61
-; SSE42-NEXT:  LBB24_62: ## %else89
+; SSE42-NEXT:  LBB24_62: ## %else30
 ; SSE42-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; SSE42-NEXT:    je LBB24_64
-; SSE42-NEXT:  LBB24_63: ## %cond.load91
+; SSE42-NEXT:  LBB24_63: ## %cond.load31
 ; SSE42-NEXT:    pinsrb $15, 31(%rdi), %xmm3
-; SSE42-NEXT:  LBB24_64: ## %else92
+; SSE42-NEXT:  LBB24_64: ## %else31
 ; SSE42-NEXT:    movdqa %xmm2, %xmm0
 ; SSE42-NEXT:    movdqa %xmm3, %xmm1
 ; SSE42-NEXT:    retq
@@ -4877,119 +4877,119 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; SSE42-NEXT:    pinsrb $1, 1(%rdi), %xmm2
 ; SSE42-NEXT:    testb $4, %al
 ; SSE42-NEXT:    je LBB24_6
-; SSE42-NEXT:  LBB24_5: ## %cond.load4
+; SSE42-NEXT:  LBB24_5: ## %cond.load2
 ; SSE42-NEXT:    pinsrb $2, 2(%rdi), %xmm2
 ; SSE42-NEXT:    testb $8, %al
 ; SSE42-NEXT:    je LBB24_8
-; SSE42-NEXT:  LBB24_7: ## %cond.load7
+; SSE42-NEXT:  LBB24_7: ## %cond.load3
 ; SSE42-NEXT:    pinsrb $3, 3(%rdi), %xmm2
 ; SSE42-NEXT:    testb $16, %al
 ; SSE42-NEXT:    je LBB24_10
-; SSE42-NEXT:  LBB24_9: ## %cond.load10
+; SSE42-NEXT:  LBB24_9: ## %cond.load4
 ; SSE42-NEXT:    pinsrb $4, 4(%rdi), %xmm2
 ; SSE42-NEXT:    testb $32, %al
 ; SSE42-NEXT:    je LBB24_12
-; SSE42-NEXT:  LBB24_11: ## %cond.load13
+; SSE42-NEXT:  LBB24_11: ## %cond.load5
 ; SSE42-NEXT:    pinsrb $5, 5(%rdi), %xmm2
 ; SSE42-NEXT:    testb $64, %al
 ; SSE42-NEXT:    je LBB24_14
-; SSE42-NEXT:  LBB24_13: ## %cond.load16
+; SSE42-NEXT:  LBB24_13: ## %cond.load6
 ; SSE42-NEXT:    pinsrb $6, 6(%rdi), %xmm2
 ; SSE42-NEXT:    testb $-128, %al
 ; SSE42-NEXT:    je LBB24_16
-; SSE42-NEXT:  LBB24_15: ## %cond.load19
+; SSE42-NEXT:  LBB24_15: ## %cond.load7
 ; SSE42-NEXT:    pinsrb $7, 7(%rdi), %xmm2
 ; SSE42-NEXT:    testl $256, %eax ## imm = 0x100
 ; SSE42-NEXT:    je LBB24_18
-; SSE42-NEXT:  LBB24_17: ## %cond.load22
+; SSE42-NEXT:  LBB24_17: ## %cond.load8
 ; SSE42-NEXT:    pinsrb $8, 8(%rdi), %xmm2
 ; SSE42-NEXT:    testl $512, %eax ## imm = 0x200
 ; SSE42-NEXT:    je LBB24_20
-; SSE42-NEXT:  LBB24_19: ## %cond.load25
+; SSE42-NEXT:  LBB24_19: ## %cond.load9
 ; SSE42-NEXT:    pinsrb $9, 9(%rdi), %xmm2
 ; SSE42-NEXT:    testl $1024, %eax ## imm = 0x400
 ; SSE42-NEXT:    je LBB24_22
-; SSE42-NEXT:  LBB24_21: ## %cond.load28
+; SSE42-NEXT:  LBB24_21: ## %cond.load10
 ; SSE42-NEXT:    pinsrb $10, 10(%rdi), %xmm2
 ; SSE42-NEXT:    testl $2048, %eax ## imm = 0x800
 ; SSE42-NEXT:    je LBB24_24
-; SSE42-NEXT:  LBB24_23: ## %cond.load31
+; SSE42-NEXT:  LBB24_23: ## %cond.load11
 ; SSE42-NEXT:    pinsrb $11, 11(%rdi), %xmm2
 ; SSE42-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; SSE42-NEXT:    je LBB24_26
-; SSE42-NEXT:  LBB24_25: ## %cond.load34
+; SSE42-NEXT:  LBB24_25: ## %cond.load12
 ; SSE42-NEXT:    pinsrb $12, 12(%rdi), %xmm2
 ; SSE42-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; SSE42-NEXT:    je LBB24_28
-; SSE42-NEXT:  LBB24_27: ## %cond.load37
+; SSE42-NEXT:  LBB24_27: ## %cond.load13
 ; SSE42-NEXT:    pinsrb $13, 13(%rdi), %xmm2
 ; SSE42-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; SSE42-NEXT:    je LBB24_30
-; SSE42-NEXT:  LBB24_29: ## %cond.load40
+; SSE42-NEXT:  LBB24_29: ## %cond.load14
 ; SSE42-NEXT:    pinsrb $14, 14(%rdi), %xmm2
 ; SSE42-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; SSE42-NEXT:    je LBB24_32
-; SSE42-NEXT:  LBB24_31: ## %cond.load43
+; SSE42-NEXT:  LBB24_31: ## %cond.load15
 ; SSE42-NEXT:    pinsrb $15, 15(%rdi), %xmm2
 ; SSE42-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; SSE42-NEXT:    je LBB24_34
-; SSE42-NEXT:  LBB24_33: ## %cond.load46
+; SSE42-NEXT:  LBB24_33: ## %cond.load16
 ; SSE42-NEXT:    pinsrb $0, 16(%rdi), %xmm3
 ; SSE42-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; SSE42-NEXT:    je LBB24_36
-; SSE42-NEXT:  LBB24_35: ## %cond.load49
+; SSE42-NEXT:  LBB24_35: ## %cond.load17
 ; SSE42-NEXT:    pinsrb $1, 17(%rdi), %xmm3
 ; SSE42-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; SSE42-NEXT:    je LBB24_38
-; SSE42-NEXT:  LBB24_37: ## %cond.load52
+; SSE42-NEXT:  LBB24_37: ## %cond.load18
 ; SSE42-NEXT:    pinsrb $2, 18(%rdi), %xmm3
 ; SSE42-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; SSE42-NEXT:    je LBB24_40
-; SSE42-NEXT:  LBB24_39: ## %cond.load55
+; SSE42-NEXT:  LBB24_39: ## %cond.load19
 ; SSE42-NEXT:    pinsrb $3, 19(%rdi), %xmm3
 ; SSE42-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; SSE42-NEXT:    je LBB24_42
-; SSE42-NEXT:  LBB24_41: ## %cond.load58
+; SSE42-NEXT:  LBB24_41: ## %cond.load20
 ; SSE42-NEXT:    pinsrb $4, 20(%rdi), %xmm3
 ; SSE42-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; SSE42-NEXT:    je LBB24_44
-; SSE42-NEXT:  LBB24_43: ## %cond.load61
+; SSE42-NEXT:  LBB24_43: ## %cond.load21
 ; SSE42-NEXT:    pinsrb $5, 21(%rdi), %xmm3
 ; SSE42-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; SSE42-NEXT:    je LBB24_46
-; SSE42-NEXT:  LBB24_45: ## %cond.load64
+; SSE42-NEXT:  LBB24_45: ## %cond.load22
 ; SSE42-NEXT:    pinsrb $6, 22(%rdi), %xmm3
 ; SSE42-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; SSE42-NEXT:    je LBB24_48
-; SSE42-NEXT:  LBB24_47: ## %cond.load67
+; SSE42-NEXT:  LBB24_47: ## %cond.load23
 ; SSE42-NEXT:    pinsrb $7, 23(%rdi), %xmm3
 ; SSE42-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; SSE42-NEXT:    je LBB24_50
-; SSE42-NEXT:  LBB24_49: ## %cond.load70
+; SSE42-NEXT:  LBB24_49: ## %cond.load24
 ; SSE42-NEXT:    pinsrb $8, 24(%rdi), %xmm3
 ; SSE42-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; SSE42-NEXT:    je LBB24_52
-; SSE42-NEXT:  LBB24_51: ## %cond.load73
+; SSE42-NEXT:  LBB24_51: ## %cond.load25
 ; SSE42-NEXT:    pinsrb $9, 25(%rdi), %xmm3
 ; SSE42-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; SSE42-NEXT:    je LBB24_54
-; SSE42-NEXT:  LBB24_53: ## %cond.load76
+; SSE42-NEXT:  LBB24_53: ## %cond.load26
 ; SSE42-NEXT:    pinsrb $10, 26(%rdi), %xmm3
 ; SSE42-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; SSE42-NEXT:    je LBB24_56
-; SSE42-NEXT:  LBB24_55: ## %cond.load79
+; SSE42-NEXT:  LBB24_55: ## %cond.load27
 ; SSE42-NEXT:    pinsrb $11, 27(%rdi), %xmm3
 ; SSE42-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; SSE42-NEXT:    je LBB24_58
-; SSE42-NEXT:  LBB24_57: ## %cond.load82
+; SSE42-NEXT:  LBB24_57: ## %cond.load28
 ; SSE42-NEXT:    pinsrb $12, 28(%rdi), %xmm3
 ; SSE42-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; SSE42-NEXT:    je LBB24_60
-; SSE42-NEXT:  LBB24_59: ## %cond.load85
+; SSE42-NEXT:  LBB24_59: ## %cond.load29
 ; SSE42-NEXT:    pinsrb $13, 29(%rdi), %xmm3
 ; SSE42-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; SSE42-NEXT:    je LBB24_62
-; SSE42-NEXT:  LBB24_61: ## %cond.load88
+; SSE42-NEXT:  LBB24_61: ## %cond.load30
 ; SSE42-NEXT:    pinsrb $14, 30(%rdi), %xmm3
 ; SSE42-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; SSE42-NEXT:    jne LBB24_63
@@ -5007,97 +5007,97 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; AVX1-NEXT:  ## %bb.2: ## %else
 ; AVX1-NEXT:    testb $2, %al
 ; AVX1-NEXT:    jne LBB24_3
-; AVX1-NEXT:  LBB24_4: ## %else2
+; AVX1-NEXT:  LBB24_4: ## %else1
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    jne LBB24_5
-; AVX1-NEXT:  LBB24_6: ## %else5
+; AVX1-NEXT:  LBB24_6: ## %else2
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    jne LBB24_7
-; AVX1-NEXT:  LBB24_8: ## %else8
+; AVX1-NEXT:  LBB24_8: ## %else3
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    jne LBB24_9
-; AVX1-NEXT:  LBB24_10: ## %else11
+; AVX1-NEXT:  LBB24_10: ## %else4
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    jne LBB24_11
-; AVX1-NEXT:  LBB24_12: ## %else14
+; AVX1-NEXT:  LBB24_12: ## %else5
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    jne LBB24_13
-; AVX1-NEXT:  LBB24_14: ## %else17
+; AVX1-NEXT:  LBB24_14: ## %else6
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    jne LBB24_15
-; AVX1-NEXT:  LBB24_16: ## %else20
+; AVX1-NEXT:  LBB24_16: ## %else7
 ; AVX1-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1-NEXT:    jne LBB24_17
-; AVX1-NEXT:  LBB24_18: ## %else23
+; AVX1-NEXT:  LBB24_18: ## %else8
 ; AVX1-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1-NEXT:    jne LBB24_19
-; AVX1-NEXT:  LBB24_20: ## %else26
+; AVX1-NEXT:  LBB24_20: ## %else9
 ; AVX1-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1-NEXT:    jne LBB24_21
-; AVX1-NEXT:  LBB24_22: ## %else29
+; AVX1-NEXT:  LBB24_22: ## %else10
 ; AVX1-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1-NEXT:    jne LBB24_23
-; AVX1-NEXT:  LBB24_24: ## %else32
+; AVX1-NEXT:  LBB24_24: ## %else11
 ; AVX1-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1-NEXT:    jne LBB24_25
-; AVX1-NEXT:  LBB24_26: ## %else35
+; AVX1-NEXT:  LBB24_26: ## %else12
 ; AVX1-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1-NEXT:    jne LBB24_27
-; AVX1-NEXT:  LBB24_28: ## %else38
+; AVX1-NEXT:  LBB24_28: ## %else13
 ; AVX1-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1-NEXT:    jne LBB24_29
-; AVX1-NEXT:  LBB24_30: ## %else41
+; AVX1-NEXT:  LBB24_30: ## %else14
 ; AVX1-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1-NEXT:    jne LBB24_31
-; AVX1-NEXT:  LBB24_32: ## %else44
+; AVX1-NEXT:  LBB24_32: ## %else15
 ; AVX1-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX1-NEXT:    jne LBB24_33
-; AVX1-NEXT:  LBB24_34: ## %else47
+; AVX1-NEXT:  LBB24_34: ## %else16
 ; AVX1-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX1-NEXT:    jne LBB24_35
-; AVX1-NEXT:  LBB24_36: ## %else50
+; AVX1-NEXT:  LBB24_36: ## %else17
 ; AVX1-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX1-NEXT:    jne LBB24_37
-; AVX1-NEXT:  LBB24_38: ## %else53
+; AVX1-NEXT:  LBB24_38: ## %else18
 ; AVX1-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX1-NEXT:    jne LBB24_39
-; AVX1-NEXT:  LBB24_40: ## %else56
+; AVX1-NEXT:  LBB24_40: ## %else19
 ; AVX1-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX1-NEXT:    jne LBB24_41
-; AVX1-NEXT:  LBB24_42: ## %else59
+; AVX1-NEXT:  LBB24_42: ## %else20
 ; AVX1-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX1-NEXT:    jne LBB24_43
-; AVX1-NEXT:  LBB24_44: ## %else62
+; AVX1-NEXT:  LBB24_44: ## %else21
 ; AVX1-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX1-NEXT:    jne LBB24_45
-; AVX1-NEXT:  LBB24_46: ## %else65
+; AVX1-NEXT:  LBB24_46: ## %else22
 ; AVX1-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX1-NEXT:    jne LBB24_47
-; AVX1-NEXT:  LBB24_48: ## %else68
+; AVX1-NEXT:  LBB24_48: ## %else23
 ; AVX1-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX1-NEXT:    jne LBB24_49
-; AVX1-NEXT:  LBB24_50: ## %else71
+; AVX1-NEXT:  LBB24_50: ## %else24
 ; AVX1-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX1-NEXT:    jne LBB24_51
-; AVX1-NEXT:  LBB24_52: ## %else74
+; AVX1-NEXT:  LBB24_52: ## %else25
 ; AVX1-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX1-NEXT:    jne LBB24_53
-; AVX1-NEXT:  LBB24_54: ## %else77
+; AVX1-NEXT:  LBB24_54: ## %else26
 ; AVX1-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX1-NEXT:    jne LBB24_55
-; AVX1-NEXT:  LBB24_56: ## %else80
+; AVX1-NEXT:  LBB24_56: ## %else27
 ; AVX1-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX1-NEXT:    jne LBB24_57
-; AVX1-NEXT:  LBB24_58: ## %else83
+; AVX1-NEXT:  LBB24_58: ## %else28
 ; AVX1-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX1-NEXT:    jne LBB24_59
-; AVX1-NEXT:  LBB24_60: ## %else86
+; AVX1-NEXT:  LBB24_60: ## %else29
 ; AVX1-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX1-NEXT:    jne LBB24_61
-; AVX1-NEXT:  LBB24_62: ## %else89
+; AVX1-NEXT:  LBB24_62: ## %else30
 ; AVX1-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX1-NEXT:    jne LBB24_63
-; AVX1-NEXT:  LBB24_64: ## %else92
+; AVX1-NEXT:  LBB24_64: ## %else31
 ; AVX1-NEXT:    vmovaps %ymm1, %ymm0
 ; AVX1-NEXT:    retq
 ; AVX1-NEXT:  LBB24_1: ## %cond.load
@@ -5110,167 +5110,167 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $4, %al
 ; AVX1-NEXT:    je LBB24_6
-; AVX1-NEXT:  LBB24_5: ## %cond.load4
+; AVX1-NEXT:  LBB24_5: ## %cond.load2
 ; AVX1-NEXT:    vpinsrb $2, 2(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $8, %al
 ; AVX1-NEXT:    je LBB24_8
-; AVX1-NEXT:  LBB24_7: ## %cond.load7
+; AVX1-NEXT:  LBB24_7: ## %cond.load3
 ; AVX1-NEXT:    vpinsrb $3, 3(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $16, %al
 ; AVX1-NEXT:    je LBB24_10
-; AVX1-NEXT:  LBB24_9: ## %cond.load10
+; AVX1-NEXT:  LBB24_9: ## %cond.load4
 ; AVX1-NEXT:    vpinsrb $4, 4(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $32, %al
 ; AVX1-NEXT:    je LBB24_12
-; AVX1-NEXT:  LBB24_11: ## %cond.load13
+; AVX1-NEXT:  LBB24_11: ## %cond.load5
 ; AVX1-NEXT:    vpinsrb $5, 5(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $64, %al
 ; AVX1-NEXT:    je LBB24_14
-; AVX1-NEXT:  LBB24_13: ## %cond.load16
+; AVX1-NEXT:  LBB24_13: ## %cond.load6
 ; AVX1-NEXT:    vpinsrb $6, 6(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testb $-128, %al
 ; AVX1-NEXT:    je LBB24_16
-; AVX1-NEXT:  LBB24_15: ## %cond.load19
+; AVX1-NEXT:  LBB24_15: ## %cond.load7
 ; AVX1-NEXT:    vpinsrb $7, 7(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX1-NEXT:    je LBB24_18
-; AVX1-NEXT:  LBB24_17: ## %cond.load22
+; AVX1-NEXT:  LBB24_17: ## %cond.load8
 ; AVX1-NEXT:    vpinsrb $8, 8(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX1-NEXT:    je LBB24_20
-; AVX1-NEXT:  LBB24_19: ## %cond.load25
+; AVX1-NEXT:  LBB24_19: ## %cond.load9
 ; AVX1-NEXT:    vpinsrb $9, 9(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX1-NEXT:    je LBB24_22
-; AVX1-NEXT:  LBB24_21: ## %cond.load28
+; AVX1-NEXT:  LBB24_21: ## %cond.load10
 ; AVX1-NEXT:    vpinsrb $10, 10(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX1-NEXT:    je LBB24_24
-; AVX1-NEXT:  LBB24_23: ## %cond.load31
+; AVX1-NEXT:  LBB24_23: ## %cond.load11
 ; AVX1-NEXT:    vpinsrb $11, 11(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX1-NEXT:    je LBB24_26
-; AVX1-NEXT:  LBB24_25: ## %cond.load34
+; AVX1-NEXT:  LBB24_25: ## %cond.load12
 ; AVX1-NEXT:    vpinsrb $12, 12(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX1-NEXT:    je LBB24_28
-; AVX1-NEXT:  LBB24_27: ## %cond.load37
+; AVX1-NEXT:  LBB24_27: ## %cond.load13
 ; AVX1-NEXT:    vpinsrb $13, 13(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX1-NEXT:    je LBB24_30
-; AVX1-NEXT:  LBB24_29: ## %cond.load40
+; AVX1-NEXT:  LBB24_29: ## %cond.load14
 ; AVX1-NEXT:    vpinsrb $14, 14(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX1-NEXT:    je LBB24_32
-; AVX1-NEXT:  LBB24_31: ## %cond.load43
+; AVX1-NEXT:  LBB24_31: ## %cond.load15
 ; AVX1-NEXT:    vpinsrb $15, 15(%rdi), %xmm1, %xmm0
 ; AVX1-NEXT:    vblendps {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX1-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX1-NEXT:    je LBB24_34
-; AVX1-NEXT:  LBB24_33: ## %cond.load46
+; AVX1-NEXT:  LBB24_33: ## %cond.load16
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $0, 16(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX1-NEXT:    je LBB24_36
-; AVX1-NEXT:  LBB24_35: ## %cond.load49
+; AVX1-NEXT:  LBB24_35: ## %cond.load17
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $1, 17(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX1-NEXT:    je LBB24_38
-; AVX1-NEXT:  LBB24_37: ## %cond.load52
+; AVX1-NEXT:  LBB24_37: ## %cond.load18
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $2, 18(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX1-NEXT:    je LBB24_40
-; AVX1-NEXT:  LBB24_39: ## %cond.load55
+; AVX1-NEXT:  LBB24_39: ## %cond.load19
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $3, 19(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX1-NEXT:    je LBB24_42
-; AVX1-NEXT:  LBB24_41: ## %cond.load58
+; AVX1-NEXT:  LBB24_41: ## %cond.load20
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $4, 20(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX1-NEXT:    je LBB24_44
-; AVX1-NEXT:  LBB24_43: ## %cond.load61
+; AVX1-NEXT:  LBB24_43: ## %cond.load21
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $5, 21(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX1-NEXT:    je LBB24_46
-; AVX1-NEXT:  LBB24_45: ## %cond.load64
+; AVX1-NEXT:  LBB24_45: ## %cond.load22
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $6, 22(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX1-NEXT:    je LBB24_48
-; AVX1-NEXT:  LBB24_47: ## %cond.load67
+; AVX1-NEXT:  LBB24_47: ## %cond.load23
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $7, 23(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX1-NEXT:    je LBB24_50
-; AVX1-NEXT:  LBB24_49: ## %cond.load70
+; AVX1-NEXT:  LBB24_49: ## %cond.load24
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $8, 24(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX1-NEXT:    je LBB24_52
-; AVX1-NEXT:  LBB24_51: ## %cond.load73
+; AVX1-NEXT:  LBB24_51: ## %cond.load25
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $9, 25(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX1-NEXT:    je LBB24_54
-; AVX1-NEXT:  LBB24_53: ## %cond.load76
+; AVX1-NEXT:  LBB24_53: ## %cond.load26
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $10, 26(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX1-NEXT:    je LBB24_56
-; AVX1-NEXT:  LBB24_55: ## %cond.load79
+; AVX1-NEXT:  LBB24_55: ## %cond.load27
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $11, 27(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX1-NEXT:    je LBB24_58
-; AVX1-NEXT:  LBB24_57: ## %cond.load82
+; AVX1-NEXT:  LBB24_57: ## %cond.load28
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $12, 28(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX1-NEXT:    je LBB24_60
-; AVX1-NEXT:  LBB24_59: ## %cond.load85
+; AVX1-NEXT:  LBB24_59: ## %cond.load29
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $13, 29(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX1-NEXT:    je LBB24_62
-; AVX1-NEXT:  LBB24_61: ## %cond.load88
+; AVX1-NEXT:  LBB24_61: ## %cond.load30
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $14, 30(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
 ; AVX1-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX1-NEXT:    je LBB24_64
-; AVX1-NEXT:  LBB24_63: ## %cond.load91
+; AVX1-NEXT:  LBB24_63: ## %cond.load31
 ; AVX1-NEXT:    vextractf128 $1, %ymm1, %xmm0
 ; AVX1-NEXT:    vpinsrb $15, 31(%rdi), %xmm0, %xmm0
 ; AVX1-NEXT:    vinsertf128 $1, %xmm0, %ymm1, %ymm1
@@ -5285,97 +5285,97 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; AVX2-NEXT:  ## %bb.2: ## %else
 ; AVX2-NEXT:    testb $2, %al
 ; AVX2-NEXT:    jne LBB24_3
-; AVX2-NEXT:  LBB24_4: ## %else2
+; AVX2-NEXT:  LBB24_4: ## %else1
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    jne LBB24_5
-; AVX2-NEXT:  LBB24_6: ## %else5
+; AVX2-NEXT:  LBB24_6: ## %else2
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    jne LBB24_7
-; AVX2-NEXT:  LBB24_8: ## %else8
+; AVX2-NEXT:  LBB24_8: ## %else3
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    jne LBB24_9
-; AVX2-NEXT:  LBB24_10: ## %else11
+; AVX2-NEXT:  LBB24_10: ## %else4
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    jne LBB24_11
-; AVX2-NEXT:  LBB24_12: ## %else14
+; AVX2-NEXT:  LBB24_12: ## %else5
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    jne LBB24_13
-; AVX2-NEXT:  LBB24_14: ## %else17
+; AVX2-NEXT:  LBB24_14: ## %else6
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    jne LBB24_15
-; AVX2-NEXT:  LBB24_16: ## %else20
+; AVX2-NEXT:  LBB24_16: ## %else7
 ; AVX2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX2-NEXT:    jne LBB24_17
-; AVX2-NEXT:  LBB24_18: ## %else23
+; AVX2-NEXT:  LBB24_18: ## %else8
 ; AVX2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX2-NEXT:    jne LBB24_19
-; AVX2-NEXT:  LBB24_20: ## %else26
+; AVX2-NEXT:  LBB24_20: ## %else9
 ; AVX2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX2-NEXT:    jne LBB24_21
-; AVX2-NEXT:  LBB24_22: ## %else29
+; AVX2-NEXT:  LBB24_22: ## %else10
 ; AVX2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX2-NEXT:    jne LBB24_23
-; AVX2-NEXT:  LBB24_24: ## %else32
+; AVX2-NEXT:  LBB24_24: ## %else11
 ; AVX2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX2-NEXT:    jne LBB24_25
-; AVX2-NEXT:  LBB24_26: ## %else35
+; AVX2-NEXT:  LBB24_26: ## %else12
 ; AVX2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX2-NEXT:    jne LBB24_27
-; AVX2-NEXT:  LBB24_28: ## %else38
+; AVX2-NEXT:  LBB24_28: ## %else13
 ; AVX2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX2-NEXT:    jne LBB24_29
-; AVX2-NEXT:  LBB24_30: ## %else41
+; AVX2-NEXT:  LBB24_30: ## %else14
 ; AVX2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX2-NEXT:    jne LBB24_31
-; AVX2-NEXT:  LBB24_32: ## %else44
+; AVX2-NEXT:  LBB24_32: ## %else15
 ; AVX2-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX2-NEXT:    jne LBB24_33
-; AVX2-NEXT:  LBB24_34: ## %else47
+; AVX2-NEXT:  LBB24_34: ## %else16
 ; AVX2-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX2-NEXT:    jne LBB24_35
-; AVX2-NEXT:  LBB24_36: ## %else50
+; AVX2-NEXT:  LBB24_36: ## %else17
 ; AVX2-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX2-NEXT:    jne LBB24_37
-; AVX2-NEXT:  LBB24_38: ## %else53
+; AVX2-NEXT:  LBB24_38: ## %else18
 ; AVX2-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX2-NEXT:    jne LBB24_39
-; AVX2-NEXT:  LBB24_40: ## %else56
+; AVX2-NEXT:  LBB24_40: ## %else19
 ; AVX2-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX2-NEXT:    jne LBB24_41
-; AVX2-NEXT:  LBB24_42: ## %else59
+; AVX2-NEXT:  LBB24_42: ## %else20
 ; AVX2-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX2-NEXT:    jne LBB24_43
-; AVX2-NEXT:  LBB24_44: ## %else62
+; AVX2-NEXT:  LBB24_44: ## %else21
 ; AVX2-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX2-NEXT:    jne LBB24_45
-; AVX2-NEXT:  LBB24_46: ## %else65
+; AVX2-NEXT:  LBB24_46: ## %else22
 ; AVX2-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX2-NEXT:    jne LBB24_47
-; AVX2-NEXT:  LBB24_48: ## %else68
+; AVX2-NEXT:  LBB24_48: ## %else23
 ; AVX2-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX2-NEXT:    jne LBB24_49
-; AVX2-NEXT:  LBB24_50: ## %else71
+; AVX2-NEXT:  LBB24_50: ## %else24
 ; AVX2-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX2-NEXT:    jne LBB24_51
-; AVX2-NEXT:  LBB24_52: ## %else74
+; AVX2-NEXT:  LBB24_52: ## %else25
 ; AVX2-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX2-NEXT:    jne LBB24_53
-; AVX2-NEXT:  LBB24_54: ## %else77
+; AVX2-NEXT:  LBB24_54: ## %else26
 ; AVX2-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX2-NEXT:    jne LBB24_55
-; AVX2-NEXT:  LBB24_56: ## %else80
+; AVX2-NEXT:  LBB24_56: ## %else27
 ; AVX2-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX2-NEXT:    jne LBB24_57
-; AVX2-NEXT:  LBB24_58: ## %else83
+; AVX2-NEXT:  LBB24_58: ## %else28
 ; AVX2-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX2-NEXT:    jne LBB24_59
-; AVX2-NEXT:  LBB24_60: ## %else86
+; AVX2-NEXT:  LBB24_60: ## %else29
 ; AVX2-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX2-NEXT:    jne LBB24_61
-; AVX2-NEXT:  LBB24_62: ## %else89
+; AVX2-NEXT:  LBB24_62: ## %else30
 ; AVX2-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX2-NEXT:    jne LBB24_63
-; AVX2-NEXT:  LBB24_64: ## %else92
+; AVX2-NEXT:  LBB24_64: ## %else31
 ; AVX2-NEXT:    vmovdqa %ymm1, %ymm0
 ; AVX2-NEXT:    retq
 ; AVX2-NEXT:  LBB24_1: ## %cond.load
@@ -5388,167 +5388,167 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $4, %al
 ; AVX2-NEXT:    je LBB24_6
-; AVX2-NEXT:  LBB24_5: ## %cond.load4
+; AVX2-NEXT:  LBB24_5: ## %cond.load2
 ; AVX2-NEXT:    vpinsrb $2, 2(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $8, %al
 ; AVX2-NEXT:    je LBB24_8
-; AVX2-NEXT:  LBB24_7: ## %cond.load7
+; AVX2-NEXT:  LBB24_7: ## %cond.load3
 ; AVX2-NEXT:    vpinsrb $3, 3(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $16, %al
 ; AVX2-NEXT:    je LBB24_10
-; AVX2-NEXT:  LBB24_9: ## %cond.load10
+; AVX2-NEXT:  LBB24_9: ## %cond.load4
 ; AVX2-NEXT:    vpinsrb $4, 4(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $32, %al
 ; AVX2-NEXT:    je LBB24_12
-; AVX2-NEXT:  LBB24_11: ## %cond.load13
+; AVX2-NEXT:  LBB24_11: ## %cond.load5
 ; AVX2-NEXT:    vpinsrb $5, 5(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $64, %al
 ; AVX2-NEXT:    je LBB24_14
-; AVX2-NEXT:  LBB24_13: ## %cond.load16
+; AVX2-NEXT:  LBB24_13: ## %cond.load6
 ; AVX2-NEXT:    vpinsrb $6, 6(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testb $-128, %al
 ; AVX2-NEXT:    je LBB24_16
-; AVX2-NEXT:  LBB24_15: ## %cond.load19
+; AVX2-NEXT:  LBB24_15: ## %cond.load7
 ; AVX2-NEXT:    vpinsrb $7, 7(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX2-NEXT:    je LBB24_18
-; AVX2-NEXT:  LBB24_17: ## %cond.load22
+; AVX2-NEXT:  LBB24_17: ## %cond.load8
 ; AVX2-NEXT:    vpinsrb $8, 8(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX2-NEXT:    je LBB24_20
-; AVX2-NEXT:  LBB24_19: ## %cond.load25
+; AVX2-NEXT:  LBB24_19: ## %cond.load9
 ; AVX2-NEXT:    vpinsrb $9, 9(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX2-NEXT:    je LBB24_22
-; AVX2-NEXT:  LBB24_21: ## %cond.load28
+; AVX2-NEXT:  LBB24_21: ## %cond.load10
 ; AVX2-NEXT:    vpinsrb $10, 10(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX2-NEXT:    je LBB24_24
-; AVX2-NEXT:  LBB24_23: ## %cond.load31
+; AVX2-NEXT:  LBB24_23: ## %cond.load11
 ; AVX2-NEXT:    vpinsrb $11, 11(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX2-NEXT:    je LBB24_26
-; AVX2-NEXT:  LBB24_25: ## %cond.load34
+; AVX2-NEXT:  LBB24_25: ## %cond.load12
 ; AVX2-NEXT:    vpinsrb $12, 12(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX2-NEXT:    je LBB24_28
-; AVX2-NEXT:  LBB24_27: ## %cond.load37
+; AVX2-NEXT:  LBB24_27: ## %cond.load13
 ; AVX2-NEXT:    vpinsrb $13, 13(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX2-NEXT:    je LBB24_30
-; AVX2-NEXT:  LBB24_29: ## %cond.load40
+; AVX2-NEXT:  LBB24_29: ## %cond.load14
 ; AVX2-NEXT:    vpinsrb $14, 14(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX2-NEXT:    je LBB24_32
-; AVX2-NEXT:  LBB24_31: ## %cond.load43
+; AVX2-NEXT:  LBB24_31: ## %cond.load15
 ; AVX2-NEXT:    vpinsrb $15, 15(%rdi), %xmm1, %xmm0
 ; AVX2-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX2-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX2-NEXT:    je LBB24_34
-; AVX2-NEXT:  LBB24_33: ## %cond.load46
+; AVX2-NEXT:  LBB24_33: ## %cond.load16
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $0, 16(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX2-NEXT:    je LBB24_36
-; AVX2-NEXT:  LBB24_35: ## %cond.load49
+; AVX2-NEXT:  LBB24_35: ## %cond.load17
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $1, 17(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX2-NEXT:    je LBB24_38
-; AVX2-NEXT:  LBB24_37: ## %cond.load52
+; AVX2-NEXT:  LBB24_37: ## %cond.load18
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $2, 18(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX2-NEXT:    je LBB24_40
-; AVX2-NEXT:  LBB24_39: ## %cond.load55
+; AVX2-NEXT:  LBB24_39: ## %cond.load19
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $3, 19(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX2-NEXT:    je LBB24_42
-; AVX2-NEXT:  LBB24_41: ## %cond.load58
+; AVX2-NEXT:  LBB24_41: ## %cond.load20
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $4, 20(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX2-NEXT:    je LBB24_44
-; AVX2-NEXT:  LBB24_43: ## %cond.load61
+; AVX2-NEXT:  LBB24_43: ## %cond.load21
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $5, 21(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX2-NEXT:    je LBB24_46
-; AVX2-NEXT:  LBB24_45: ## %cond.load64
+; AVX2-NEXT:  LBB24_45: ## %cond.load22
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $6, 22(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX2-NEXT:    je LBB24_48
-; AVX2-NEXT:  LBB24_47: ## %cond.load67
+; AVX2-NEXT:  LBB24_47: ## %cond.load23
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $7, 23(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX2-NEXT:    je LBB24_50
-; AVX2-NEXT:  LBB24_49: ## %cond.load70
+; AVX2-NEXT:  LBB24_49: ## %cond.load24
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $8, 24(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX2-NEXT:    je LBB24_52
-; AVX2-NEXT:  LBB24_51: ## %cond.load73
+; AVX2-NEXT:  LBB24_51: ## %cond.load25
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $9, 25(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX2-NEXT:    je LBB24_54
-; AVX2-NEXT:  LBB24_53: ## %cond.load76
+; AVX2-NEXT:  LBB24_53: ## %cond.load26
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $10, 26(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX2-NEXT:    je LBB24_56
-; AVX2-NEXT:  LBB24_55: ## %cond.load79
+; AVX2-NEXT:  LBB24_55: ## %cond.load27
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $11, 27(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX2-NEXT:    je LBB24_58
-; AVX2-NEXT:  LBB24_57: ## %cond.load82
+; AVX2-NEXT:  LBB24_57: ## %cond.load28
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $12, 28(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX2-NEXT:    je LBB24_60
-; AVX2-NEXT:  LBB24_59: ## %cond.load85
+; AVX2-NEXT:  LBB24_59: ## %cond.load29
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $13, 29(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX2-NEXT:    je LBB24_62
-; AVX2-NEXT:  LBB24_61: ## %cond.load88
+; AVX2-NEXT:  LBB24_61: ## %cond.load30
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $14, 30(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX2-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX2-NEXT:    je LBB24_64
-; AVX2-NEXT:  LBB24_63: ## %cond.load91
+; AVX2-NEXT:  LBB24_63: ## %cond.load31
 ; AVX2-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX2-NEXT:    vpinsrb $15, 31(%rdi), %xmm0, %xmm0
 ; AVX2-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
@@ -5563,97 +5563,97 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; AVX512F-NEXT:  ## %bb.2: ## %else
 ; AVX512F-NEXT:    testb $2, %al
 ; AVX512F-NEXT:    jne LBB24_3
-; AVX512F-NEXT:  LBB24_4: ## %else2
+; AVX512F-NEXT:  LBB24_4: ## %else1
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    jne LBB24_5
-; AVX512F-NEXT:  LBB24_6: ## %else5
+; AVX512F-NEXT:  LBB24_6: ## %else2
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    jne LBB24_7
-; AVX512F-NEXT:  LBB24_8: ## %else8
+; AVX512F-NEXT:  LBB24_8: ## %else3
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    jne LBB24_9
-; AVX512F-NEXT:  LBB24_10: ## %else11
+; AVX512F-NEXT:  LBB24_10: ## %else4
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    jne LBB24_11
-; AVX512F-NEXT:  LBB24_12: ## %else14
+; AVX512F-NEXT:  LBB24_12: ## %else5
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    jne LBB24_13
-; AVX512F-NEXT:  LBB24_14: ## %else17
+; AVX512F-NEXT:  LBB24_14: ## %else6
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    jne LBB24_15
-; AVX512F-NEXT:  LBB24_16: ## %else20
+; AVX512F-NEXT:  LBB24_16: ## %else7
 ; AVX512F-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512F-NEXT:    jne LBB24_17
-; AVX512F-NEXT:  LBB24_18: ## %else23
+; AVX512F-NEXT:  LBB24_18: ## %else8
 ; AVX512F-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512F-NEXT:    jne LBB24_19
-; AVX512F-NEXT:  LBB24_20: ## %else26
+; AVX512F-NEXT:  LBB24_20: ## %else9
 ; AVX512F-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512F-NEXT:    jne LBB24_21
-; AVX512F-NEXT:  LBB24_22: ## %else29
+; AVX512F-NEXT:  LBB24_22: ## %else10
 ; AVX512F-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512F-NEXT:    jne LBB24_23
-; AVX512F-NEXT:  LBB24_24: ## %else32
+; AVX512F-NEXT:  LBB24_24: ## %else11
 ; AVX512F-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512F-NEXT:    jne LBB24_25
-; AVX512F-NEXT:  LBB24_26: ## %else35
+; AVX512F-NEXT:  LBB24_26: ## %else12
 ; AVX512F-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512F-NEXT:    jne LBB24_27
-; AVX512F-NEXT:  LBB24_28: ## %else38
+; AVX512F-NEXT:  LBB24_28: ## %else13
 ; AVX512F-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512F-NEXT:    jne LBB24_29
-; AVX512F-NEXT:  LBB24_30: ## %else41
+; AVX512F-NEXT:  LBB24_30: ## %else14
 ; AVX512F-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512F-NEXT:    jne LBB24_31
-; AVX512F-NEXT:  LBB24_32: ## %else44
+; AVX512F-NEXT:  LBB24_32: ## %else15
 ; AVX512F-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX512F-NEXT:    jne LBB24_33
-; AVX512F-NEXT:  LBB24_34: ## %else47
+; AVX512F-NEXT:  LBB24_34: ## %else16
 ; AVX512F-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX512F-NEXT:    jne LBB24_35
-; AVX512F-NEXT:  LBB24_36: ## %else50
+; AVX512F-NEXT:  LBB24_36: ## %else17
 ; AVX512F-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX512F-NEXT:    jne LBB24_37
-; AVX512F-NEXT:  LBB24_38: ## %else53
+; AVX512F-NEXT:  LBB24_38: ## %else18
 ; AVX512F-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX512F-NEXT:    jne LBB24_39
-; AVX512F-NEXT:  LBB24_40: ## %else56
+; AVX512F-NEXT:  LBB24_40: ## %else19
 ; AVX512F-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX512F-NEXT:    jne LBB24_41
-; AVX512F-NEXT:  LBB24_42: ## %else59
+; AVX512F-NEXT:  LBB24_42: ## %else20
 ; AVX512F-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX512F-NEXT:    jne LBB24_43
-; AVX512F-NEXT:  LBB24_44: ## %else62
+; AVX512F-NEXT:  LBB24_44: ## %else21
 ; AVX512F-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX512F-NEXT:    jne LBB24_45
-; AVX512F-NEXT:  LBB24_46: ## %else65
+; AVX512F-NEXT:  LBB24_46: ## %else22
 ; AVX512F-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX512F-NEXT:    jne LBB24_47
-; AVX512F-NEXT:  LBB24_48: ## %else68
+; AVX512F-NEXT:  LBB24_48: ## %else23
 ; AVX512F-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX512F-NEXT:    jne LBB24_49
-; AVX512F-NEXT:  LBB24_50: ## %else71
+; AVX512F-NEXT:  LBB24_50: ## %else24
 ; AVX512F-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX512F-NEXT:    jne LBB24_51
-; AVX512F-NEXT:  LBB24_52: ## %else74
+; AVX512F-NEXT:  LBB24_52: ## %else25
 ; AVX512F-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX512F-NEXT:    jne LBB24_53
-; AVX512F-NEXT:  LBB24_54: ## %else77
+; AVX512F-NEXT:  LBB24_54: ## %else26
 ; AVX512F-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX512F-NEXT:    jne LBB24_55
-; AVX512F-NEXT:  LBB24_56: ## %else80
+; AVX512F-NEXT:  LBB24_56: ## %else27
 ; AVX512F-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX512F-NEXT:    jne LBB24_57
-; AVX512F-NEXT:  LBB24_58: ## %else83
+; AVX512F-NEXT:  LBB24_58: ## %else28
 ; AVX512F-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX512F-NEXT:    jne LBB24_59
-; AVX512F-NEXT:  LBB24_60: ## %else86
+; AVX512F-NEXT:  LBB24_60: ## %else29
 ; AVX512F-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX512F-NEXT:    jne LBB24_61
-; AVX512F-NEXT:  LBB24_62: ## %else89
+; AVX512F-NEXT:  LBB24_62: ## %else30
 ; AVX512F-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX512F-NEXT:    jne LBB24_63
-; AVX512F-NEXT:  LBB24_64: ## %else92
+; AVX512F-NEXT:  LBB24_64: ## %else31
 ; AVX512F-NEXT:    vmovdqa %ymm1, %ymm0
 ; AVX512F-NEXT:    retq
 ; AVX512F-NEXT:  LBB24_1: ## %cond.load
@@ -5666,167 +5666,167 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $4, %al
 ; AVX512F-NEXT:    je LBB24_6
-; AVX512F-NEXT:  LBB24_5: ## %cond.load4
+; AVX512F-NEXT:  LBB24_5: ## %cond.load2
 ; AVX512F-NEXT:    vpinsrb $2, 2(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $8, %al
 ; AVX512F-NEXT:    je LBB24_8
-; AVX512F-NEXT:  LBB24_7: ## %cond.load7
+; AVX512F-NEXT:  LBB24_7: ## %cond.load3
 ; AVX512F-NEXT:    vpinsrb $3, 3(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $16, %al
 ; AVX512F-NEXT:    je LBB24_10
-; AVX512F-NEXT:  LBB24_9: ## %cond.load10
+; AVX512F-NEXT:  LBB24_9: ## %cond.load4
 ; AVX512F-NEXT:    vpinsrb $4, 4(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $32, %al
 ; AVX512F-NEXT:    je LBB24_12
-; AVX512F-NEXT:  LBB24_11: ## %cond.load13
+; AVX512F-NEXT:  LBB24_11: ## %cond.load5
 ; AVX512F-NEXT:    vpinsrb $5, 5(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $64, %al
 ; AVX512F-NEXT:    je LBB24_14
-; AVX512F-NEXT:  LBB24_13: ## %cond.load16
+; AVX512F-NEXT:  LBB24_13: ## %cond.load6
 ; AVX512F-NEXT:    vpinsrb $6, 6(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testb $-128, %al
 ; AVX512F-NEXT:    je LBB24_16
-; AVX512F-NEXT:  LBB24_15: ## %cond.load19
+; AVX512F-NEXT:  LBB24_15: ## %cond.load7
 ; AVX512F-NEXT:    vpinsrb $7, 7(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512F-NEXT:    je LBB24_18
-; AVX512F-NEXT:  LBB24_17: ## %cond.load22
+; AVX512F-NEXT:  LBB24_17: ## %cond.load8
 ; AVX512F-NEXT:    vpinsrb $8, 8(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512F-NEXT:    je LBB24_20
-; AVX512F-NEXT:  LBB24_19: ## %cond.load25
+; AVX512F-NEXT:  LBB24_19: ## %cond.load9
 ; AVX512F-NEXT:    vpinsrb $9, 9(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512F-NEXT:    je LBB24_22
-; AVX512F-NEXT:  LBB24_21: ## %cond.load28
+; AVX512F-NEXT:  LBB24_21: ## %cond.load10
 ; AVX512F-NEXT:    vpinsrb $10, 10(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512F-NEXT:    je LBB24_24
-; AVX512F-NEXT:  LBB24_23: ## %cond.load31
+; AVX512F-NEXT:  LBB24_23: ## %cond.load11
 ; AVX512F-NEXT:    vpinsrb $11, 11(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512F-NEXT:    je LBB24_26
-; AVX512F-NEXT:  LBB24_25: ## %cond.load34
+; AVX512F-NEXT:  LBB24_25: ## %cond.load12
 ; AVX512F-NEXT:    vpinsrb $12, 12(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512F-NEXT:    je LBB24_28
-; AVX512F-NEXT:  LBB24_27: ## %cond.load37
+; AVX512F-NEXT:  LBB24_27: ## %cond.load13
 ; AVX512F-NEXT:    vpinsrb $13, 13(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512F-NEXT:    je LBB24_30
-; AVX512F-NEXT:  LBB24_29: ## %cond.load40
+; AVX512F-NEXT:  LBB24_29: ## %cond.load14
 ; AVX512F-NEXT:    vpinsrb $14, 14(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512F-NEXT:    je LBB24_32
-; AVX512F-NEXT:  LBB24_31: ## %cond.load43
+; AVX512F-NEXT:  LBB24_31: ## %cond.load15
 ; AVX512F-NEXT:    vpinsrb $15, 15(%rdi), %xmm1, %xmm0
 ; AVX512F-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512F-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX512F-NEXT:    je LBB24_34
-; AVX512F-NEXT:  LBB24_33: ## %cond.load46
+; AVX512F-NEXT:  LBB24_33: ## %cond.load16
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $0, 16(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX512F-NEXT:    je LBB24_36
-; AVX512F-NEXT:  LBB24_35: ## %cond.load49
+; AVX512F-NEXT:  LBB24_35: ## %cond.load17
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $1, 17(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX512F-NEXT:    je LBB24_38
-; AVX512F-NEXT:  LBB24_37: ## %cond.load52
+; AVX512F-NEXT:  LBB24_37: ## %cond.load18
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $2, 18(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX512F-NEXT:    je LBB24_40
-; AVX512F-NEXT:  LBB24_39: ## %cond.load55
+; AVX512F-NEXT:  LBB24_39: ## %cond.load19
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $3, 19(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX512F-NEXT:    je LBB24_42
-; AVX512F-NEXT:  LBB24_41: ## %cond.load58
+; AVX512F-NEXT:  LBB24_41: ## %cond.load20
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $4, 20(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX512F-NEXT:    je LBB24_44
-; AVX512F-NEXT:  LBB24_43: ## %cond.load61
+; AVX512F-NEXT:  LBB24_43: ## %cond.load21
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $5, 21(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX512F-NEXT:    je LBB24_46
-; AVX512F-NEXT:  LBB24_45: ## %cond.load64
+; AVX512F-NEXT:  LBB24_45: ## %cond.load22
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $6, 22(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX512F-NEXT:    je LBB24_48
-; AVX512F-NEXT:  LBB24_47: ## %cond.load67
+; AVX512F-NEXT:  LBB24_47: ## %cond.load23
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $7, 23(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX512F-NEXT:    je LBB24_50
-; AVX512F-NEXT:  LBB24_49: ## %cond.load70
+; AVX512F-NEXT:  LBB24_49: ## %cond.load24
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $8, 24(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX512F-NEXT:    je LBB24_52
-; AVX512F-NEXT:  LBB24_51: ## %cond.load73
+; AVX512F-NEXT:  LBB24_51: ## %cond.load25
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $9, 25(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX512F-NEXT:    je LBB24_54
-; AVX512F-NEXT:  LBB24_53: ## %cond.load76
+; AVX512F-NEXT:  LBB24_53: ## %cond.load26
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $10, 26(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX512F-NEXT:    je LBB24_56
-; AVX512F-NEXT:  LBB24_55: ## %cond.load79
+; AVX512F-NEXT:  LBB24_55: ## %cond.load27
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $11, 27(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX512F-NEXT:    je LBB24_58
-; AVX512F-NEXT:  LBB24_57: ## %cond.load82
+; AVX512F-NEXT:  LBB24_57: ## %cond.load28
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $12, 28(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX512F-NEXT:    je LBB24_60
-; AVX512F-NEXT:  LBB24_59: ## %cond.load85
+; AVX512F-NEXT:  LBB24_59: ## %cond.load29
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $13, 29(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX512F-NEXT:    je LBB24_62
-; AVX512F-NEXT:  LBB24_61: ## %cond.load88
+; AVX512F-NEXT:  LBB24_61: ## %cond.load30
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $14, 30(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512F-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX512F-NEXT:    je LBB24_64
-; AVX512F-NEXT:  LBB24_63: ## %cond.load91
+; AVX512F-NEXT:  LBB24_63: ## %cond.load31
 ; AVX512F-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512F-NEXT:    vpinsrb $15, 31(%rdi), %xmm0, %xmm0
 ; AVX512F-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
@@ -5841,97 +5841,97 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; AVX512VLDQ-NEXT:  ## %bb.2: ## %else
 ; AVX512VLDQ-NEXT:    testb $2, %al
 ; AVX512VLDQ-NEXT:    jne LBB24_3
-; AVX512VLDQ-NEXT:  LBB24_4: ## %else2
+; AVX512VLDQ-NEXT:  LBB24_4: ## %else1
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    jne LBB24_5
-; AVX512VLDQ-NEXT:  LBB24_6: ## %else5
+; AVX512VLDQ-NEXT:  LBB24_6: ## %else2
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    jne LBB24_7
-; AVX512VLDQ-NEXT:  LBB24_8: ## %else8
+; AVX512VLDQ-NEXT:  LBB24_8: ## %else3
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    jne LBB24_9
-; AVX512VLDQ-NEXT:  LBB24_10: ## %else11
+; AVX512VLDQ-NEXT:  LBB24_10: ## %else4
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    jne LBB24_11
-; AVX512VLDQ-NEXT:  LBB24_12: ## %else14
+; AVX512VLDQ-NEXT:  LBB24_12: ## %else5
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    jne LBB24_13
-; AVX512VLDQ-NEXT:  LBB24_14: ## %else17
+; AVX512VLDQ-NEXT:  LBB24_14: ## %else6
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    jne LBB24_15
-; AVX512VLDQ-NEXT:  LBB24_16: ## %else20
+; AVX512VLDQ-NEXT:  LBB24_16: ## %else7
 ; AVX512VLDQ-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLDQ-NEXT:    jne LBB24_17
-; AVX512VLDQ-NEXT:  LBB24_18: ## %else23
+; AVX512VLDQ-NEXT:  LBB24_18: ## %else8
 ; AVX512VLDQ-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLDQ-NEXT:    jne LBB24_19
-; AVX512VLDQ-NEXT:  LBB24_20: ## %else26
+; AVX512VLDQ-NEXT:  LBB24_20: ## %else9
 ; AVX512VLDQ-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLDQ-NEXT:    jne LBB24_21
-; AVX512VLDQ-NEXT:  LBB24_22: ## %else29
+; AVX512VLDQ-NEXT:  LBB24_22: ## %else10
 ; AVX512VLDQ-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLDQ-NEXT:    jne LBB24_23
-; AVX512VLDQ-NEXT:  LBB24_24: ## %else32
+; AVX512VLDQ-NEXT:  LBB24_24: ## %else11
 ; AVX512VLDQ-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLDQ-NEXT:    jne LBB24_25
-; AVX512VLDQ-NEXT:  LBB24_26: ## %else35
+; AVX512VLDQ-NEXT:  LBB24_26: ## %else12
 ; AVX512VLDQ-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLDQ-NEXT:    jne LBB24_27
-; AVX512VLDQ-NEXT:  LBB24_28: ## %else38
+; AVX512VLDQ-NEXT:  LBB24_28: ## %else13
 ; AVX512VLDQ-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLDQ-NEXT:    jne LBB24_29
-; AVX512VLDQ-NEXT:  LBB24_30: ## %else41
+; AVX512VLDQ-NEXT:  LBB24_30: ## %else14
 ; AVX512VLDQ-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLDQ-NEXT:    jne LBB24_31
-; AVX512VLDQ-NEXT:  LBB24_32: ## %else44
+; AVX512VLDQ-NEXT:  LBB24_32: ## %else15
 ; AVX512VLDQ-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX512VLDQ-NEXT:    jne LBB24_33
-; AVX512VLDQ-NEXT:  LBB24_34: ## %else47
+; AVX512VLDQ-NEXT:  LBB24_34: ## %else16
 ; AVX512VLDQ-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX512VLDQ-NEXT:    jne LBB24_35
-; AVX512VLDQ-NEXT:  LBB24_36: ## %else50
+; AVX512VLDQ-NEXT:  LBB24_36: ## %else17
 ; AVX512VLDQ-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX512VLDQ-NEXT:    jne LBB24_37
-; AVX512VLDQ-NEXT:  LBB24_38: ## %else53
+; AVX512VLDQ-NEXT:  LBB24_38: ## %else18
 ; AVX512VLDQ-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX512VLDQ-NEXT:    jne LBB24_39
-; AVX512VLDQ-NEXT:  LBB24_40: ## %else56
+; AVX512VLDQ-NEXT:  LBB24_40: ## %else19
 ; AVX512VLDQ-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX512VLDQ-NEXT:    jne LBB24_41
-; AVX512VLDQ-NEXT:  LBB24_42: ## %else59
+; AVX512VLDQ-NEXT:  LBB24_42: ## %else20
 ; AVX512VLDQ-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX512VLDQ-NEXT:    jne LBB24_43
-; AVX512VLDQ-NEXT:  LBB24_44: ## %else62
+; AVX512VLDQ-NEXT:  LBB24_44: ## %else21
 ; AVX512VLDQ-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX512VLDQ-NEXT:    jne LBB24_45
-; AVX512VLDQ-NEXT:  LBB24_46: ## %else65
+; AVX512VLDQ-NEXT:  LBB24_46: ## %else22
 ; AVX512VLDQ-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX512VLDQ-NEXT:    jne LBB24_47
-; AVX512VLDQ-NEXT:  LBB24_48: ## %else68
+; AVX512VLDQ-NEXT:  LBB24_48: ## %else23
 ; AVX512VLDQ-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX512VLDQ-NEXT:    jne LBB24_49
-; AVX512VLDQ-NEXT:  LBB24_50: ## %else71
+; AVX512VLDQ-NEXT:  LBB24_50: ## %else24
 ; AVX512VLDQ-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX512VLDQ-NEXT:    jne LBB24_51
-; AVX512VLDQ-NEXT:  LBB24_52: ## %else74
+; AVX512VLDQ-NEXT:  LBB24_52: ## %else25
 ; AVX512VLDQ-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX512VLDQ-NEXT:    jne LBB24_53
-; AVX512VLDQ-NEXT:  LBB24_54: ## %else77
+; AVX512VLDQ-NEXT:  LBB24_54: ## %else26
 ; AVX512VLDQ-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX512VLDQ-NEXT:    jne LBB24_55
-; AVX512VLDQ-NEXT:  LBB24_56: ## %else80
+; AVX512VLDQ-NEXT:  LBB24_56: ## %else27
 ; AVX512VLDQ-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX512VLDQ-NEXT:    jne LBB24_57
-; AVX512VLDQ-NEXT:  LBB24_58: ## %else83
+; AVX512VLDQ-NEXT:  LBB24_58: ## %else28
 ; AVX512VLDQ-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX512VLDQ-NEXT:    jne LBB24_59
-; AVX512VLDQ-NEXT:  LBB24_60: ## %else86
+; AVX512VLDQ-NEXT:  LBB24_60: ## %else29
 ; AVX512VLDQ-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX512VLDQ-NEXT:    jne LBB24_61
-; AVX512VLDQ-NEXT:  LBB24_62: ## %else89
+; AVX512VLDQ-NEXT:  LBB24_62: ## %else30
 ; AVX512VLDQ-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX512VLDQ-NEXT:    jne LBB24_63
-; AVX512VLDQ-NEXT:  LBB24_64: ## %else92
+; AVX512VLDQ-NEXT:  LBB24_64: ## %else31
 ; AVX512VLDQ-NEXT:    vmovdqa %ymm1, %ymm0
 ; AVX512VLDQ-NEXT:    retq
 ; AVX512VLDQ-NEXT:  LBB24_1: ## %cond.load
@@ -5944,167 +5944,167 @@ define <32 x i8> @load_v32i8_v32i8(<32 x i8> %trigger, <32 x i8>* %addr, <32 x i
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $4, %al
 ; AVX512VLDQ-NEXT:    je LBB24_6
-; AVX512VLDQ-NEXT:  LBB24_5: ## %cond.load4
+; AVX512VLDQ-NEXT:  LBB24_5: ## %cond.load2
 ; AVX512VLDQ-NEXT:    vpinsrb $2, 2(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $8, %al
 ; AVX512VLDQ-NEXT:    je LBB24_8
-; AVX512VLDQ-NEXT:  LBB24_7: ## %cond.load7
+; AVX512VLDQ-NEXT:  LBB24_7: ## %cond.load3
 ; AVX512VLDQ-NEXT:    vpinsrb $3, 3(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $16, %al
 ; AVX512VLDQ-NEXT:    je LBB24_10
-; AVX512VLDQ-NEXT:  LBB24_9: ## %cond.load10
+; AVX512VLDQ-NEXT:  LBB24_9: ## %cond.load4
 ; AVX512VLDQ-NEXT:    vpinsrb $4, 4(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $32, %al
 ; AVX512VLDQ-NEXT:    je LBB24_12
-; AVX512VLDQ-NEXT:  LBB24_11: ## %cond.load13
+; AVX512VLDQ-NEXT:  LBB24_11: ## %cond.load5
 ; AVX512VLDQ-NEXT:    vpinsrb $5, 5(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $64, %al
 ; AVX512VLDQ-NEXT:    je LBB24_14
-; AVX512VLDQ-NEXT:  LBB24_13: ## %cond.load16
+; AVX512VLDQ-NEXT:  LBB24_13: ## %cond.load6
 ; AVX512VLDQ-NEXT:    vpinsrb $6, 6(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testb $-128, %al
 ; AVX512VLDQ-NEXT:    je LBB24_16
-; AVX512VLDQ-NEXT:  LBB24_15: ## %cond.load19
+; AVX512VLDQ-NEXT:  LBB24_15: ## %cond.load7
 ; AVX512VLDQ-NEXT:    vpinsrb $7, 7(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $256, %eax ## imm = 0x100
 ; AVX512VLDQ-NEXT:    je LBB24_18
-; AVX512VLDQ-NEXT:  LBB24_17: ## %cond.load22
+; AVX512VLDQ-NEXT:  LBB24_17: ## %cond.load8
 ; AVX512VLDQ-NEXT:    vpinsrb $8, 8(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $512, %eax ## imm = 0x200
 ; AVX512VLDQ-NEXT:    je LBB24_20
-; AVX512VLDQ-NEXT:  LBB24_19: ## %cond.load25
+; AVX512VLDQ-NEXT:  LBB24_19: ## %cond.load9
 ; AVX512VLDQ-NEXT:    vpinsrb $9, 9(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $1024, %eax ## imm = 0x400
 ; AVX512VLDQ-NEXT:    je LBB24_22
-; AVX512VLDQ-NEXT:  LBB24_21: ## %cond.load28
+; AVX512VLDQ-NEXT:  LBB24_21: ## %cond.load10
 ; AVX512VLDQ-NEXT:    vpinsrb $10, 10(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $2048, %eax ## imm = 0x800
 ; AVX512VLDQ-NEXT:    je LBB24_24
-; AVX512VLDQ-NEXT:  LBB24_23: ## %cond.load31
+; AVX512VLDQ-NEXT:  LBB24_23: ## %cond.load11
 ; AVX512VLDQ-NEXT:    vpinsrb $11, 11(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $4096, %eax ## imm = 0x1000
 ; AVX512VLDQ-NEXT:    je LBB24_26
-; AVX512VLDQ-NEXT:  LBB24_25: ## %cond.load34
+; AVX512VLDQ-NEXT:  LBB24_25: ## %cond.load12
 ; AVX512VLDQ-NEXT:    vpinsrb $12, 12(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $8192, %eax ## imm = 0x2000
 ; AVX512VLDQ-NEXT:    je LBB24_28
-; AVX512VLDQ-NEXT:  LBB24_27: ## %cond.load37
+; AVX512VLDQ-NEXT:  LBB24_27: ## %cond.load13
 ; AVX512VLDQ-NEXT:    vpinsrb $13, 13(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $16384, %eax ## imm = 0x4000
 ; AVX512VLDQ-NEXT:    je LBB24_30
-; AVX512VLDQ-NEXT:  LBB24_29: ## %cond.load40
+; AVX512VLDQ-NEXT:  LBB24_29: ## %cond.load14
 ; AVX512VLDQ-NEXT:    vpinsrb $14, 14(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $32768, %eax ## imm = 0x8000
 ; AVX512VLDQ-NEXT:    je LBB24_32
-; AVX512VLDQ-NEXT:  LBB24_31: ## %cond.load43
+; AVX512VLDQ-NEXT:  LBB24_31: ## %cond.load15
 ; AVX512VLDQ-NEXT:    vpinsrb $15, 15(%rdi), %xmm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpblendd {{.*#+}} ymm1 = ymm0[0,1,2,3],ymm1[4,5,6,7]
 ; AVX512VLDQ-NEXT:    testl $65536, %eax ## imm = 0x10000
 ; AVX512VLDQ-NEXT:    je LBB24_34
-; AVX512VLDQ-NEXT:  LBB24_33: ## %cond.load46
+; AVX512VLDQ-NEXT:  LBB24_33: ## %cond.load16
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $0, 16(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $131072, %eax ## imm = 0x20000
 ; AVX512VLDQ-NEXT:    je LBB24_36
-; AVX512VLDQ-NEXT:  LBB24_35: ## %cond.load49
+; AVX512VLDQ-NEXT:  LBB24_35: ## %cond.load17
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $1, 17(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $262144, %eax ## imm = 0x40000
 ; AVX512VLDQ-NEXT:    je LBB24_38
-; AVX512VLDQ-NEXT:  LBB24_37: ## %cond.load52
+; AVX512VLDQ-NEXT:  LBB24_37: ## %cond.load18
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $2, 18(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $524288, %eax ## imm = 0x80000
 ; AVX512VLDQ-NEXT:    je LBB24_40
-; AVX512VLDQ-NEXT:  LBB24_39: ## %cond.load55
+; AVX512VLDQ-NEXT:  LBB24_39: ## %cond.load19
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $3, 19(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $1048576, %eax ## imm = 0x100000
 ; AVX512VLDQ-NEXT:    je LBB24_42
-; AVX512VLDQ-NEXT:  LBB24_41: ## %cond.load58
+; AVX512VLDQ-NEXT:  LBB24_41: ## %cond.load20
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $4, 20(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $2097152, %eax ## imm = 0x200000
 ; AVX512VLDQ-NEXT:    je LBB24_44
-; AVX512VLDQ-NEXT:  LBB24_43: ## %cond.load61
+; AVX512VLDQ-NEXT:  LBB24_43: ## %cond.load21
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $5, 21(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $4194304, %eax ## imm = 0x400000
 ; AVX512VLDQ-NEXT:    je LBB24_46
-; AVX512VLDQ-NEXT:  LBB24_45: ## %cond.load64
+; AVX512VLDQ-NEXT:  LBB24_45: ## %cond.load22
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $6, 22(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $8388608, %eax ## imm = 0x800000
 ; AVX512VLDQ-NEXT:    je LBB24_48
-; AVX512VLDQ-NEXT:  LBB24_47: ## %cond.load67
+; AVX512VLDQ-NEXT:  LBB24_47: ## %cond.load23
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $7, 23(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $16777216, %eax ## imm = 0x1000000
 ; AVX512VLDQ-NEXT:    je LBB24_50
-; AVX512VLDQ-NEXT:  LBB24_49: ## %cond.load70
+; AVX512VLDQ-NEXT:  LBB24_49: ## %cond.load24
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $8, 24(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $33554432, %eax ## imm = 0x2000000
 ; AVX512VLDQ-NEXT:    je LBB24_52
-; AVX512VLDQ-NEXT:  LBB24_51: ## %cond.load73
+; AVX512VLDQ-NEXT:  LBB24_51: ## %cond.load25
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $9, 25(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $67108864, %eax ## imm = 0x4000000
 ; AVX512VLDQ-NEXT:    je LBB24_54
-; AVX512VLDQ-NEXT:  LBB24_53: ## %cond.load76
+; AVX512VLDQ-NEXT:  LBB24_53: ## %cond.load26
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $10, 26(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $134217728, %eax ## imm = 0x8000000
 ; AVX512VLDQ-NEXT:    je LBB24_56
-; AVX512VLDQ-NEXT:  LBB24_55: ## %cond.load79
+; AVX512VLDQ-NEXT:  LBB24_55: ## %cond.load27
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $11, 27(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $268435456, %eax ## imm = 0x10000000
 ; AVX512VLDQ-NEXT:    je LBB24_58
-; AVX512VLDQ-NEXT:  LBB24_57: ## %cond.load82
+; AVX512VLDQ-NEXT:  LBB24_57: ## %cond.load28
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $12, 28(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $536870912, %eax ## imm = 0x20000000
 ; AVX512VLDQ-NEXT:    je LBB24_60
-; AVX512VLDQ-NEXT:  LBB24_59: ## %cond.load85
+; AVX512VLDQ-NEXT:  LBB24_59: ## %cond.load29
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $13, 29(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $1073741824, %eax ## imm = 0x40000000
 ; AVX512VLDQ-NEXT:    je LBB24_62
-; AVX512VLDQ-NEXT:  LBB24_61: ## %cond.load88
+; AVX512VLDQ-NEXT:  LBB24_61: ## %cond.load30
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $14, 30(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
 ; AVX512VLDQ-NEXT:    testl $-2147483648, %eax ## imm = 0x80000000
 ; AVX512VLDQ-NEXT:    je LBB24_64
-; AVX512VLDQ-NEXT:  LBB24_63: ## %cond.load91
+; AVX512VLDQ-NEXT:  LBB24_63: ## %cond.load31
 ; AVX512VLDQ-NEXT:    vextracti128 $1, %ymm1, %xmm0
 ; AVX512VLDQ-NEXT:    vpinsrb $15, 31(%rdi), %xmm0, %xmm0
 ; AVX512VLDQ-NEXT:    vinserti128 $1, %xmm0, %ymm1, %ymm1
@@ -21,7 +21,7 @@ define void @test11(i64* %base, <2 x i64> %V, <2 x i1> %mask) {
 ; CHECK-NEXT:  # %bb.2: # %else
 ; CHECK-NEXT:    testb $2, %al
 ; CHECK-NEXT:    jne .LBB1_3
-; CHECK-NEXT:  .LBB1_4: # %else2
+; CHECK-NEXT:  .LBB1_4: # %else1
 ; CHECK-NEXT:    retq
 ; CHECK-NEXT:  .LBB1_1: # %cond.store
 ; CHECK-NEXT:    vmovq %xmm0, (%rdi)
@@ -19,7 +19,7 @@ define void @atomic_maxmin_i8() {
 ; CHECK-NEXT:  # %bb.2: # %atomicrmw.end
 ; CHECK-NEXT:    movb {{.*}}(%rip), %al
 ; CHECK-NEXT:    .p2align 4, 0x90
-; CHECK-NEXT:  .LBB0_3: # %atomicrmw.start2
+; CHECK-NEXT:  .LBB0_3: # %atomicrmw.start1
 ; CHECK-NEXT:    # =>This Inner Loop Header: Depth=1
 ; CHECK-NEXT:    cmpb $7, %al
 ; CHECK-NEXT:    movzbl %al, %eax
@@ -31,7 +31,7 @@ define void @atomic_maxmin_i8() {
 ; CHECK-NEXT:  # %bb.4: # %atomicrmw.end1
 ; CHECK-NEXT:    movb {{.*}}(%rip), %al
 ; CHECK-NEXT:    .p2align 4, 0x90
-; CHECK-NEXT:  .LBB0_5: # %atomicrmw.start8
+; CHECK-NEXT:  .LBB0_5: # %atomicrmw.start2
 ; CHECK-NEXT:    # =>This Inner Loop Header: Depth=1
 ; CHECK-NEXT:    cmpb $7, %al
 ; CHECK-NEXT:    movzbl %al, %eax
@@ -40,10 +40,10 @@ define void @atomic_maxmin_i8() {
 ; CHECK-NEXT:    # kill: def $al killed $al killed $eax
 ; CHECK-NEXT:    lock cmpxchgb %cl, {{.*}}(%rip)
 ; CHECK-NEXT:    jne .LBB0_5
-; CHECK-NEXT:  # %bb.6: # %atomicrmw.end7
+; CHECK-NEXT:  # %bb.6: # %atomicrmw.end2
 ; CHECK-NEXT:    movb {{.*}}(%rip), %al
 ; CHECK-NEXT:    .p2align 4, 0x90
-; CHECK-NEXT:  .LBB0_7: # %atomicrmw.start14
+; CHECK-NEXT:  .LBB0_7: # %atomicrmw.start3
 ; CHECK-NEXT:    # =>This Inner Loop Header: Depth=1
 ; CHECK-NEXT:    cmpb $9, %al
 ; CHECK-NEXT:    movzbl %al, %eax
@@ -52,7 +52,7 @@ define void @atomic_maxmin_i8() {
 ; CHECK-NEXT:    # kill: def $al killed $al killed $eax
 ; CHECK-NEXT:    lock cmpxchgb %cl, {{.*}}(%rip)
 ; CHECK-NEXT:    jne .LBB0_7
-; CHECK-NEXT:  # %bb.8: # %atomicrmw.end13
+; CHECK-NEXT:  # %bb.8: # %atomicrmw.end3
 ; CHECK-NEXT:    retq
   %1 = atomicrmw max  i8* @sc8, i8 5 acquire
   %2 = atomicrmw min  i8* @sc8, i8 6 acquire
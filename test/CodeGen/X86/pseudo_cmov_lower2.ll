@@ -181,15 +181,15 @@ define double @foo6(float %p1, double %p2, double %p3) nounwind {
 ; CHECK-NEXT:    ucomiss {{.*}}(%rip), %xmm3
 ; CHECK-NEXT:    movapd %xmm0, %xmm4
 ; CHECK-NEXT:    jae .LBB5_5
-; CHECK-NEXT:  # %bb.4: # %select.false2
+; CHECK-NEXT:  # %bb.4: # %select.false1
 ; CHECK-NEXT:    movapd %xmm1, %xmm4
 ; CHECK-NEXT:  .LBB5_5: # %select.end1
 ; CHECK-NEXT:    ucomiss {{.*}}(%rip), %xmm3
 ; CHECK-NEXT:    movapd %xmm4, %xmm1
 ; CHECK-NEXT:    jae .LBB5_7
-; CHECK-NEXT:  # %bb.6: # %select.false4
+; CHECK-NEXT:  # %bb.6: # %select.false2
 ; CHECK-NEXT:    movapd %xmm2, %xmm1
-; CHECK-NEXT:  .LBB5_7: # %select.end3
+; CHECK-NEXT:  .LBB5_7: # %select.end2
 ; CHECK-NEXT:    subsd %xmm4, %xmm0
 ; CHECK-NEXT:    addsd %xmm1, %xmm0
 ; CHECK-NEXT:    retq
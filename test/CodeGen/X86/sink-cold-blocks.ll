@@ -0,0 +1,68 @@
+; RUN: llc < %s -mtriple=x86_64-unknown-linux-gnu | FileCheck %s
+; RUN: llc < %s -mtriple=x86_64-unknown-linux-gnu -sink-cold-blocks=false | FileCheck %s --check-prefix=NOSINK
+
+; Block placement sinks blocks the profile summary classifies as cold behind
+; every block that executes. %cold runs twice out of 2000 entries (below the
+; summary's cold count threshold of 5), so it must not extend the hot chain
+; even though it is %bb's only viable layout successor: %h prefers %p as
+; layout predecessor, and without cold sinking %bb falls through into %cold.
+
+declare void @sink()
+declare void @use(i32)
+
+define i32 @sink_cold(i32 %x, i32 %y, i32* %q) !prof !15 {
+; CHECK-LABEL: sink_cold:
+; CHECK: # %bb{{$}}
+; CHECK: # %p{{$}}
+; CHECK: # %h{{$}}
+; CHECK: # %cold{{$}}
+;
+; NOSINK-LABEL: sink_cold:
+; NOSINK: # %bb{{$}}
+; NOSINK: # %cold{{$}}
+; NOSINK: # %p{{$}}
+; NOSINK: # %h{{$}}
+entry:
+  %c0 = icmp eq i32 %x, 0
+  br i1 %c0, label %bb, label %p, !prof !16
+
+bb:
+  %c1 = icmp eq i32 %y, 0
+  br i1 %c1, label %cold, label %h, !prof !17
+
+cold:
+  call void @sink()
+  br label %h
+
+p:
+  %v = add i32 %x, %y
+  call void @use(i32 %v)
+  br label %h
+
+h:
+  %r = add i32 %x, 7
+  %s = mul i32 %r, %y
+  store volatile i32 %r, i32* %q
+  store volatile i32 %s, i32* %q
+  call void @use(i32 %s)
+  ret i32 %s
+}
+
+!llvm.module.flags = !{!1}
+!1 = !{i32 1, !"ProfileSummary", !2}
+!2 = !{!3, !4, !5, !6, !7, !8, !9, !10}
+!3 = !{!"ProfileFormat", !"InstrProf"}
+!4 = !{!"TotalCount", i64 10000}
+!5 = !{!"MaxCount", i64 2000}
+!6 = !{!"MaxInternalCount", i64 1}
+!7 = !{!"MaxFunctionCount", i64 2000}
+!8 = !{!"NumCounts", i64 3}
+!9 = !{!"NumFunctions", i64 3}
+!10 = !{!"DetailedSummary", !11}
+!11 = !{!12, !13, !14}
+!12 = !{i32 10000, i64 2000, i32 1}
+!13 = !{i32 999000, i64 2000, i32 3}
+!14 = !{i32 999999, i64 5, i32 3}
+!15 = !{!"function_entry_count", i64 2000}
+!16 = !{!"branch_weights", i32 1010, i32 990}
+!17 = !{!"branch_weights", i32 1, i32 399}
@@ -1,14 +1,14 @@
-; RUN: llc < %s -mtriple=x86_64 -enable-unsafe-fp-math \
+; RUN: llc < %s -mtriple=x86_64 -merge-constant-pool-entries=false -enable-unsafe-fp-math \
 ; RUN:   | FileCheck %s --check-prefix=CHECK --check-prefix=CST --check-prefix=SSE --check-prefix=SSE2
-; RUN: llc < %s -mtriple=x86_64 -enable-unsafe-fp-math -mattr=+sse4.1 \
+; RUN: llc < %s -mtriple=x86_64 -merge-constant-pool-entries=false -enable-unsafe-fp-math -mattr=+sse4.1 \
 ; RUN:   | FileCheck %s --check-prefix=CHECK --check-prefix=CST --check-prefix=SSE --check-prefix=SSE41
-; RUN: llc < %s -mtriple=x86_64 -enable-unsafe-fp-math -mattr=+avx \
+; RUN: llc < %s -mtriple=x86_64 -merge-constant-pool-entries=false -enable-unsafe-fp-math -mattr=+avx \
 ; RUN:   | FileCheck %s --check-prefix=CHECK --check-prefix=CST --check-prefix=AVX
-; RUN: llc < %s -mtriple=x86_64 -enable-unsafe-fp-math -mattr=+avx2 \
+; RUN: llc < %s -mtriple=x86_64 -merge-constant-pool-entries=false -enable-unsafe-fp-math -mattr=+avx2 \
 ; RUN:   | FileCheck %s --check-prefix=CHECK --check-prefix=AVX2
-; RUN: llc < %s -mtriple=x86_64 -enable-unsafe-fp-math -mattr=+avx512f \
+; RUN: llc < %s -mtriple=x86_64 -merge-constant-pool-entries=false -enable-unsafe-fp-math -mattr=+avx512f \
 ; RUN:   | FileCheck %s --check-prefix=CHECK --check-prefix=AVX512F
-; RUN: llc < %s -mtriple=x86_64 -enable-unsafe-fp-math -mattr=+avx512vl \
+; RUN: llc < %s -mtriple=x86_64 -merge-constant-pool-entries=false -enable-unsafe-fp-math -mattr=+avx512vl \
 ; RUN:   | FileCheck %s --check-prefix=CHECK --check-prefix=AVX512VL
 
 ; SSE2: [[MASKCSTADDR:.LCPI[0-9_]+]]:
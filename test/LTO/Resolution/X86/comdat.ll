@@ -67,8 +67,8 @@ bb11:
 ; CHECK-DAG: @a21 = alias i32, i32* @v1.1{{$}}
 ; CHECK-DAG: @a22 = alias i16, bitcast (i32* @v1.1 to i16*)
 
-; CHECK-DAG: @a23 = alias i32 (i8*), i32 (i8*)* @f1.2{{$}}
-; CHECK-DAG: @a24 = alias i16, bitcast (i32 (i8*)* @f1.2 to i16*)
+; CHECK-DAG: @a23 = alias i32 (i8*), i32 (i8*)* @f1.1{{$}}
+; CHECK-DAG: @a24 = alias i16, bitcast (i32 (i8*)* @f1.1 to i16*)
 
 ; CHECK:      define weak_odr dso_local i32 @f1(i8* %0) comdat($c1) {
 ; CHECK-NEXT: bb10:
@@ -77,7 +77,7 @@ bb11:
 ; CHECK-NEXT:   ret i32 42
 ; CHECK-NEXT: }
 
-; CHECK:      define internal i32 @f1.2(i8* %this) comdat($c2) {
+; CHECK:      define internal i32 @f1.1(i8* %this) comdat($c2) {
 ; CHECK-NEXT: bb20:
 ; CHECK-NEXT:   store i8* %this, i8** null
 ; CHECK-NEXT:   br label %bb21
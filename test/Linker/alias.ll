@@ -30,8 +30,8 @@
 @bar2 = alias i32, i32* @foo2
 ; C1-DAG: @bar2 = alias i32, bitcast (i16* @foo2 to i32*)
 
-; C2-DAG: @foo2.2 = internal global i32 0
-; C2-DAG: @bar2 = alias i32, i32* @foo2.2
+; C2-DAG: @foo2.1 = internal global i32 0
+; C2-DAG: @bar2 = alias i32, i32* @foo2.1
 
 ; C1-DAG: @zed = global i32 42
 ; C2-DAG: @zed = global i32 42
@@ -21,5 +21,5 @@ CU-LABEL:define i32 @unused() {
 CI-LABEL:define internal i32 @unused() {
 CN-NOT:@unused()
 
-DI-LABEL: define internal i32 @foo.6()
+DI-LABEL: define internal i32 @foo.4()
 DI-LABEL: define i64 @foo()
@@ -17,7 +17,7 @@ define internal void @ctor1() {
     {i32, void() *, i8 * } { i32 4, void() *@ctor1, i8 *null}]
 
 
-; CHECK:           @llvm.global_ctors = appending global [3 x { i32, void ()*, i8* }] [{ i32, void ()*, i8* } { i32 4, void ()* @ctor1, i8* null }, { i32, void ()*, i8* } { i32 2, void ()* @ctor1.2, i8* null }, { i32, void ()*, i8* } { i32 7, void ()* @ctor2, i8* null }]
+; CHECK:           @llvm.global_ctors = appending global [3 x { i32, void ()*, i8* }] [{ i32, void ()*, i8* } { i32 4, void ()* @ctor1, i8* null }, { i32, void ()*, i8* } { i32 2, void ()* @ctor1.1, i8* null }, { i32, void ()*, i8* } { i32 7, void ()* @ctor2, i8* null }]
 ; CHECK:           define internal void @ctor1()
 ; CHECK:           define void @foo()
 ; CHECK:           define internal void @ctor1.{{[0-9]+}}()
@@ -17,7 +17,7 @@ define internal void @dtor1() {
     {i32, void() *, i8 * } { i32 4, void() *@dtor1, i8 *null}]
 
 
-; CHECK:           @llvm.global_dtors = appending global [3 x { i32, void ()*, i8* }] [{ i32, void ()*, i8* } { i32 4, void ()* @dtor1, i8* null }, { i32, void ()*, i8* } { i32 2, void ()* @dtor1.2, i8* null }, { i32, void ()*, i8* } { i32 7, void ()* @dtor2, i8* null }]
+; CHECK:           @llvm.global_dtors = appending global [3 x { i32, void ()*, i8* }] [{ i32, void ()*, i8* } { i32 4, void ()* @dtor1, i8* null }, { i32, void ()*, i8* } { i32 2, void ()* @dtor1.1, i8* null }, { i32, void ()*, i8* } { i32 7, void ()* @dtor2, i8* null }]
 ; CHECK:           define internal void @dtor1()
 ; CHECK:           define void @foo()
 ; CHECK:           define internal void @dtor1.{{[0-9]+}}()
@@ -0,0 +1,13 @@
+; Binary concatenation straight out of an archive's members.
+; RUN: llvm-as -o %t.bc %s
+; RUN: llvm-as -o %t2.bc %S/Inputs/multi-module.ll
+; RUN: rm -f %t.a
+; RUN: llvm-ar rc %t.a %t.bc %t2.bc
+; RUN: llvm-cat -b -o - %t.a | llvm-nm - | FileCheck %s
+
+; CHECK: T f1
+; CHECK: T f2
+
+define void @f1() {
+  ret void
+}
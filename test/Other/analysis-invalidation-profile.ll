@@ -0,0 +1,19 @@
+; RUN: opt -disable-output -profile-analysis-invalidation \
+; RUN:     -passes='require<domtree>,invalidate<domtree>,require<domtree>' %s 2>&1 \
+; RUN:   | FileCheck %s
+
+; The second require<domtree> recomputes the result dropped by
+; invalidate<domtree>.  Invalidations are attributed to the pass on the
+; instrumentation stack when the invalidation sweep runs: the function pass
+; manager for the invalidate<domtree> sweep, and the module-to-function
+; adaptor when the aggregated preserved set is processed.  Type names are
+; host-compiler dependent, so only match their stable parts.
+
+; CHECK: Analysis Invalidation Profile
+; CHECK: wasted 1 recomputed 2 invalidated 2 runs {{(llvm::)?}}DominatorTreeAnalysis
+; CHECK-NEXT: invalidated 1 time(s) by {{.*}}ModuleToFunctionPassAdaptor
+; CHECK-NEXT: invalidated 1 time(s) by {{.*}}PassManager<
+
+define void @f() {
+  ret void
+}
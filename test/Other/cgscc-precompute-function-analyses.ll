@@ -0,0 +1,28 @@
+; RUN: opt -disable-output -debug-pass-manager -cgscc-precompute-function-analyses \
+; RUN:     -passes='cgscc(function(require<domtree>,require<loops>))' %s 2>&1 \
+; RUN:     | FileCheck %s --check-prefix=PRECOMPUTE --allow-empty
+; RUN: opt -disable-output -debug-pass-manager \
+; RUN:     -passes='cgscc(function(require<domtree>,require<loops>))' %s 2>&1 \
+; RUN:     | FileCheck %s --check-prefix=DEFAULT
+
+; With precomputation the traversal finds the dominator trees and loop info
+; already cached, so the manager never reports running them.
+; PRECOMPUTE-NOT: Running analysis: DominatorTreeAnalysis
+; PRECOMPUTE-NOT: Running analysis: LoopAnalysis
+
+; DEFAULT: Running analysis: DominatorTreeAnalysis
+; DEFAULT: Running analysis: LoopAnalysis
+
+define void @a() {
+entry:
+  call void @b()
+  ret void
+}
+
+define void @b() {
+entry:
+  br label %loop
+
+loop:
+  br label %loop
+}
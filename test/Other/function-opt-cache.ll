@@ -0,0 +1,64 @@
+; RUN: opt -S -passes='cached-function(instcombine)' < %s | FileCheck %s
+
+; @b is identical to @a before optimization, so it receives a clone of @a's
+; optimized body instead of being run through the pipeline again.
+
+define i32 @a(i32 %x) {
+; CHECK-LABEL: define i32 @a(i32 %x)
+; CHECK-NEXT:    ret i32 %x
+  %y = or i32 %x, 0
+  ret i32 %y
+}
+
+define i32 @b(i32 %x) {
+; CHECK-LABEL: define i32 @b(i32 %x)
+; CHECK-NEXT:    ret i32 %x
+  %y = or i32 %x, 0
+  ret i32 %y
+}
+
+; A function with a different body is optimized on its own.
+
+define i32 @c(i32 %x) {
+; CHECK-LABEL: define i32 @c(i32 %x)
+; CHECK-NEXT:    %y = shl i32 %x, 1
+; CHECK-NEXT:    ret i32 %y
+  %y = mul i32 %x, 2
+  ret i32 %y
+}
+
+; Recursive references must be remapped to the function receiving the body.
+
+define i32 @ra(i32 %x) {
+; CHECK-LABEL: define i32 @ra(i32 %x)
+; CHECK: call i32 @ra(
+entry:
+  %c = icmp eq i32 %x, 0
+  br i1 %c, label %done, label %rec
+
+rec:
+  %s = sub i32 %x, 1
+  %r = call i32 @ra(i32 %s)
+  br label %done
+
+done:
+  %p = phi i32 [ 0, %entry ], [ %r, %rec ]
+  ret i32 %p
+}
+
+define i32 @rb(i32 %x) {
+; CHECK-LABEL: define i32 @rb(i32 %x)
+; CHECK: call i32 @rb(
+entry:
+  %c = icmp eq i32 %x, 0
+  br i1 %c, label %done, label %rec
+
+rec:
+  %s = sub i32 %x, 1
+  %r = call i32 @rb(i32 %s)
+  br label %done
+
+done:
+  %p = phi i32 [ 0, %entry ], [ %r, %rec ]
+  ret i32 %p
+}
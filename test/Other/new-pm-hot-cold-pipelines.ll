@@ -0,0 +1,37 @@
+; RUN: opt -disable-output -passes='default<O2>' -enable-npm-hot-cold-pipelines \
+; RUN:     -debug-pass-manager %s 2>&1 | FileCheck %s
+
+; With -enable-npm-hot-cold-pipelines the optimization phase runs the full
+; pipeline only on functions that are not cold in the call graph; @cold only
+; gets the cheap cleanup pipeline.
+
+; CHECK-NOT: Running pass: LoopVectorizePass on cold
+; CHECK: Running pass: LoopVectorizePass on hot
+; CHECK-NOT: Running pass: LoopVectorizePass on cold
+
+define void @hot() !prof !20 {
+  ret void
+}
+
+define void @cold() !prof !21 {
+  ret void
+}
+
+!llvm.module.flags = !{!1}
+!20 = !{!"function_entry_count", i64 400}
+!21 = !{!"function_entry_count", i64 1}
+
+!1 = !{i32 1, !"ProfileSummary", !2}
+!2 = !{!3, !4, !5, !6, !7, !8, !9, !10}
+!3 = !{!"ProfileFormat", !"InstrProf"}
+!4 = !{!"TotalCount", i64 10000}
+!5 = !{!"MaxCount", i64 10}
+!6 = !{!"MaxInternalCount", i64 1}
+!7 = !{!"MaxFunctionCount", i64 1000}
+!8 = !{!"NumCounts", i64 2}
+!9 = !{!"NumFunctions", i64 2}
+!10 = !{!"DetailedSummary", !11}
+!11 = !{!12, !13, !14}
+!12 = !{i32 10000, i64 100, i32 1}
+!13 = !{i32 999000, i64 100, i32 1}
+!14 = !{i32 999999, i64 1, i32 2}
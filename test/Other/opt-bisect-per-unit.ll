@@ -0,0 +1,30 @@
+; Test the -opt-bisect-per-unit mode, in which every IR unit gets its own
+; deterministic bisect number stream.
+
+; RUN: opt -disable-output -opt-bisect-limit=-1 -opt-bisect-per-unit \
+; RUN:     -instcombine -gvn %s 2>&1 | FileCheck %s
+
+; Each function's stream starts at 1 regardless of what ran on other units.
+; CHECK-DAG: BISECT: running pass (1) Combine redundant instructions on function (f1)
+; CHECK-DAG: BISECT: running pass (2) Global Value Numbering on function (f1)
+; CHECK-DAG: BISECT: running pass (1) Combine redundant instructions on function (f2)
+; CHECK-DAG: BISECT: running pass (2) Global Value Numbering on function (f2)
+
+; The limit applies within each stream.
+; RUN: opt -disable-output -opt-bisect-limit=1 -opt-bisect-per-unit \
+; RUN:     -instcombine -gvn %s 2>&1 | FileCheck --check-prefix=LIMIT %s
+
+; LIMIT-DAG: BISECT: running pass (1) Combine redundant instructions on function (f1)
+; LIMIT-DAG: BISECT: NOT running pass (2) Global Value Numbering on function (f1)
+; LIMIT-DAG: BISECT: running pass (1) Combine redundant instructions on function (f2)
+; LIMIT-DAG: BISECT: NOT running pass (2) Global Value Numbering on function (f2)
+
+define i32 @f1(i32 %x) {
+  %y = or i32 %x, 0
+  ret i32 %y
+}
+
+define i32 @f2(i32 %x) {
+  %y = and i32 %x, -1
+  ret i32 %y
+}
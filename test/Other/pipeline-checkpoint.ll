@@ -0,0 +1,23 @@
+; Checkpoint the module after instcombine; the snapshot must contain the
+; combined IR.
+; RUN: opt %s -disable-output -passes=instcombine \
+; RUN:     -checkpoint-after=InstCombinePass -checkpoint-file=%t.bc
+; RUN: opt %t.bc -S | FileCheck --check-prefix=SNAPSHOT %s
+
+; SNAPSHOT-LABEL: define i32 @f(i32 %x)
+; SNAPSHOT-NOT: or i32
+; SNAPSHOT: ret i32 %x
+
+; Resuming from the instcombine checkpoint skips instcombine itself, so the
+; input is left untouched.
+; RUN: opt %s -S -passes=instcombine -resume-from=InstCombinePass \
+; RUN:   | FileCheck --check-prefix=RESUME %s
+
+; RESUME-LABEL: define i32 @f(i32 %x)
+; RESUME: %y = or i32 %x, 0
+; RESUME: ret i32 %y
+
+define i32 @f(i32 %x) {
+  %y = or i32 %x, 0
+  ret i32 %y
+}
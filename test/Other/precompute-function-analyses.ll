@@ -0,0 +1,29 @@
+; RUN: opt -disable-output -debug-pass-manager \
+; RUN:     -passes='precompute-function-analyses,function(require<domtree>,require<loops>)' %s 2>&1 \
+; RUN:     | FileCheck %s --check-prefix=PRECOMPUTE
+; RUN: opt -disable-output -debug-pass-manager \
+; RUN:     -passes='function(require<domtree>,require<loops>)' %s 2>&1 \
+; RUN:     | FileCheck %s --check-prefix=DEFAULT
+
+; The explicitly requested pass seeds the analyses regardless of the
+; -cgscc-precompute-function-analyses flag, so the subsequent function
+; pipeline finds them cached and never reports running them.
+; PRECOMPUTE: Running pass: PrecomputeFunctionAnalysesPass
+; PRECOMPUTE-NOT: Running analysis: DominatorTreeAnalysis
+; PRECOMPUTE-NOT: Running analysis: LoopAnalysis
+
+; DEFAULT: Running analysis: DominatorTreeAnalysis
+; DEFAULT: Running analysis: LoopAnalysis
+
+define void @a() {
+entry:
+  ret void
+}
+
+define void @b() {
+entry:
+  br label %loop
+
+loop:
+  br label %loop
+}
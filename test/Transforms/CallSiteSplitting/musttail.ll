@@ -3,12 +3,12 @@
 ;CHECK-LABEL: @caller
 ;CHECK-LABEL: Top.split:
 ;CHECK: %ca1 = musttail call i8* @callee(i8* null, i8* %b)
-;CHECK: %cb2 = bitcast i8* %ca1 to i8*
-;CHECK: ret i8* %cb2
+;CHECK: %cb1 = bitcast i8* %ca1 to i8*
+;CHECK: ret i8* %cb1
 ;CHECK-LABEL: TBB.split
-;CHECK: %ca3 = musttail call i8* @callee(i8* nonnull %a, i8* null)
-;CHECK: %cb4 = bitcast i8* %ca3 to i8*
-;CHECK: ret i8* %cb4
+;CHECK: %ca2 = musttail call i8* @callee(i8* nonnull %a, i8* null)
+;CHECK: %cb2 = bitcast i8* %ca2 to i8*
+;CHECK: ret i8* %cb2
 define i8* @caller(i8* %a, i8* %b) {
 Top:
   %c = icmp eq i8* %a, null
@@ -0,0 +1,65 @@
+; Check that spilled allocas are laid out in the frame by decreasing
+; alignment, regardless of the order in which they were discovered, and that
+; the frame size remark is emitted.
+; RUN: opt < %s -coro-split -pass-remarks=coro-frame -S 2>%t.remarks | FileCheck %s
+; RUN: FileCheck --check-prefix=REMARK %s < %t.remarks
+
+target datalayout = "e-i64:64-n8:16:32:64"
+
+declare void @consume.i8.ptr(i8*)
+declare void @consume.i32.ptr(i32*)
+declare void @consume.i64.ptr(i64*)
+
+define i8* @f() "coroutine.presplit"="1" {
+entry:
+  %small = alloca i8
+  %mid = alloca i32
+  %big = alloca i64
+  %id = call token @llvm.coro.id(i32 0, i8* null, i8* null, i8* null)
+  %size = call i32 @llvm.coro.size.i32()
+  %alloc = call i8* @malloc(i32 %size)
+  %hdl = call i8* @llvm.coro.begin(token %id, i8* %alloc)
+  call void @consume.i8.ptr(i8* %small)
+  call void @consume.i32.ptr(i32* %mid)
+  call void @consume.i64.ptr(i64* %big)
+  %0 = call i8 @llvm.coro.suspend(token none, i1 false)
+  switch i8 %0, label %suspend [i8 0, label %resume
+                                i8 1, label %cleanup]
+resume:
+  call void @consume.i8.ptr(i8* %small)
+  call void @consume.i32.ptr(i32* %mid)
+  call void @consume.i64.ptr(i64* %big)
+  br label %cleanup
+
+cleanup:
+  %mem = call i8* @llvm.coro.free(token %id, i8* %hdl)
+  call void @free(i8* %mem)
+  br label %suspend
+suspend:
+  call i1 @llvm.coro.end(i8* %hdl, i1 0)
+  ret i8* %hdl
+}
+
+; The i64 comes first even though the i8 was discovered first.
+; CHECK-LABEL: %f.Frame = type { void (%f.Frame*)*, void (%f.Frame*)*, i1, i1, i64, i32, i8 }
+
+; CHECK-LABEL: @f(
+; CHECK:       %small = getelementptr inbounds %f.Frame, %f.Frame* %FramePtr, i32 0, i32 6
+; CHECK-NEXT:  %mid = getelementptr inbounds %f.Frame, %f.Frame* %FramePtr, i32 0, i32 5
+; CHECK-NEXT:  %big = getelementptr inbounds %f.Frame, %f.Frame* %FramePtr, i32 0, i32 4
+
+; REMARK: remark: {{.*}}coroutine frame is 40 bytes with alignment 8
+
+declare i8* @llvm.coro.free(token, i8*)
+declare i32 @llvm.coro.size.i32()
+declare i8  @llvm.coro.suspend(token, i1)
+declare void @llvm.coro.resume(i8*)
+declare void @llvm.coro.destroy(i8*)
+
+declare token @llvm.coro.id(i32, i8*, i8*, i8*)
+declare i1 @llvm.coro.alloc(token)
+declare i8* @llvm.coro.begin(token, i8*)
+declare i1 @llvm.coro.end(i8*, i1)
+
+declare noalias i8* @malloc(i32)
+declare void @free(i8*)
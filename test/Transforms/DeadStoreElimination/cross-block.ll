@@ -0,0 +1,90 @@
+; RUN: opt < %s -basicaa -dse -enable-dse-cross-block -S | FileCheck %s
+; RUN: opt < %s -aa-pipeline=basic-aa -passes=dse -enable-dse-cross-block -S | FileCheck %s
+
+declare void @llvm.memset.p0i8.i64(i8* nocapture, i8, i64, i1) nounwind
+declare void @escape(i32*)
+
+; The store in the entry block is overwritten in the join block before any
+; read, on every path.
+define i32 @overwritten_in_later_block(i1 %c) {
+; CHECK-LABEL: @overwritten_in_later_block(
+; CHECK-NOT: store i32 1
+; CHECK: store i32 2
+entry:
+  %a = alloca i32
+  store i32 1, i32* %a
+  br i1 %c, label %then, label %else
+
+then:
+  br label %merge
+
+else:
+  br label %merge
+
+merge:
+  store i32 2, i32* %a
+  %v = load i32, i32* %a
+  ret i32 %v
+}
+
+; A memset covering the whole alloca kills the store as well.
+define i32 @overwritten_by_memset(i1 %c) {
+; CHECK-LABEL: @overwritten_by_memset(
+; CHECK-NOT: store i32 1
+; CHECK: call void @llvm.memset
+entry:
+  %a = alloca i32
+  store i32 1, i32* %a
+  br i1 %c, label %then, label %merge
+
+then:
+  br label %merge
+
+merge:
+  %p = bitcast i32* %a to i8*
+  call void @llvm.memset.p0i8.i64(i8* %p, i8 0, i64 4, i1 false)
+  %v = load i32, i32* %a
+  ret i32 %v
+}
+
+; A read on one path keeps the store alive.
+define i32 @read_on_one_path(i1 %c) {
+; CHECK-LABEL: @read_on_one_path(
+; CHECK: store i32 1
+; CHECK: store i32 2
+entry:
+  %a = alloca i32
+  store i32 1, i32* %a
+  br i1 %c, label %then, label %merge
+
+then:
+  %early = load i32, i32* %a
+  br label %merge
+
+merge:
+  %phi = phi i32 [ %early, %then ], [ 0, %entry ]
+  store i32 2, i32* %a
+  %v = load i32, i32* %a
+  %r = add i32 %phi, %v
+  ret i32 %r
+}
+
+; An escaped alloca may be observed on paths that bypass the overwrite.
+define i32 @escaped_alloca(i1 %c) {
+; CHECK-LABEL: @escaped_alloca(
+; CHECK: store i32 1
+; CHECK: store i32 2
+entry:
+  %a = alloca i32
+  call void @escape(i32* %a)
+  store i32 1, i32* %a
+  br i1 %c, label %then, label %merge
+
+then:
+  br label %merge
+
+merge:
+  store i32 2, i32* %a
+  %v = load i32, i32* %a
+  ret i32 %v
+}
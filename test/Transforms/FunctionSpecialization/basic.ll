@@ -0,0 +1,71 @@
+; RUN: opt < %s -function-specialize -S | FileCheck %s
+; RUN: opt < %s -passes=function-specialize -S | FileCheck %s
+
+; Three call sites pass 7 for %f, so @compute is specialized for it.  The
+; fourth call site passes a non-constant argument and keeps calling the
+; original function.
+
+define i32 @compute(i32 %x, i32 %f) {
+; CHECK-LABEL: define i32 @compute(i32 %x, i32 %f)
+entry:
+  %mul = mul i32 %x, %f
+  %add = add i32 %mul, %f
+  ret i32 %add
+}
+
+define i32 @caller1(i32 %x) {
+; CHECK-LABEL: define i32 @caller1(
+; CHECK: call i32 @compute.specialized(i32 %x, i32 7)
+  %r = call i32 @compute(i32 %x, i32 7)
+  ret i32 %r
+}
+
+define i32 @caller2(i32 %x) {
+; CHECK-LABEL: define i32 @caller2(
+; CHECK: call i32 @compute.specialized(i32 %x, i32 7)
+  %r = call i32 @compute(i32 %x, i32 7)
+  ret i32 %r
+}
+
+define i32 @caller3(i32 %x) {
+; CHECK-LABEL: define i32 @caller3(
+; CHECK: call i32 @compute.specialized(i32 %x, i32 7)
+  %r = call i32 @compute(i32 %x, i32 7)
+  ret i32 %r
+}
+
+define i32 @caller4(i32 %x, i32 %f) {
+; CHECK-LABEL: define i32 @caller4(
+; CHECK: call i32 @compute(i32 %x, i32 %f)
+  %r = call i32 @compute(i32 %x, i32 %f)
+  ret i32 %r
+}
+
+; Only two call sites agree on a constant for @twice, which is below the
+; default threshold of three.
+
+define i32 @twice(i32 %x, i32 %f) {
+; CHECK-LABEL: define i32 @twice(
+  %mul = mul i32 %x, %f
+  ret i32 %mul
+}
+
+define i32 @tcaller1(i32 %x) {
+; CHECK-LABEL: define i32 @tcaller1(
+; CHECK: call i32 @twice(i32 %x, i32 3)
+  %r = call i32 @twice(i32 %x, i32 3)
+  ret i32 %r
+}
+
+define i32 @tcaller2(i32 %x) {
+; CHECK-LABEL: define i32 @tcaller2(
+; CHECK: call i32 @twice(i32 %x, i32 3)
+  %r = call i32 @twice(i32 %x, i32 3)
+  ret i32 %r
+}
+
+; The clone is internal and has the argument folded to the constant.
+
+; CHECK-LABEL: define internal i32 @compute.specialized(i32 %x, i32 %f)
+; CHECK: %mul = mul i32 %x, 7
+; CHECK: %add = add i32 %mul, 7
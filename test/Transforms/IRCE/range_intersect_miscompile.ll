@@ -233,7 +233,7 @@ define void @test_05(i32* %p) {
 ; CHECK-NEXT:      br i1 [[CMP_2]], label %loop_header.preheader, label %main.pseudo.exit
 ; CHECK:         range_check_block:                                ; preds = %inner_loop
 ; CHECK-NEXT:      %range_check = icmp slt i32 %iv, %n
-; CHECK-NEXT:      br i1 true, label %loop_latch, label %deopt.loopexit2
+; CHECK-NEXT:      br i1 true, label %loop_latch, label %deopt.loopexit1
 ; CHECK:         loop_latch:                                       ; preds = %range_check_block
 ; CHECK-NEXT:      %iv_next = add i32 %iv, 1
 ; CHECK-NEXT:      %loop_cond = icmp ult i32 %iv_next, 400
@@ -203,8 +203,8 @@ define [2000 x %B] @loadLargeArrayOfB([2000 x %B]* %ab.ptr) {
 define i32 @packed_alignment(%struct.S* dereferenceable(9) %s) {
 ; CHECK-LABEL: packed_alignment
 ; CHECK-NEXT: %tv.elt1 = getelementptr inbounds %struct.S, %struct.S* %s, i64 0, i32 1, i32 1
-; CHECK-NEXT: %tv.unpack2 = load i32, i32* %tv.elt1, align 1
-; CHECK-NEXT: ret i32 %tv.unpack2
+; CHECK-NEXT: %tv.unpack1 = load i32, i32* %tv.elt1, align 1
+; CHECK-NEXT: ret i32 %tv.unpack1
   %t = getelementptr inbounds %struct.S, %struct.S* %s, i32 0, i32 1
   %tv = load %struct.T, %struct.T* %t, align 1
   %v = extractvalue %struct.T %tv, 1
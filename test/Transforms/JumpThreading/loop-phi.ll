@@ -4,12 +4,12 @@
 ; body2.
 
 ; CHECK:      body2.thread:
-; CHECK-NEXT: %tmp163 = add i32 %tmp165, 1
+; CHECK-NEXT: %tmp161 = add i32 %tmp162, 1
 ; CHECK-NEXT: br label %latch1
 
 ; CHECK:      latch1:
-; CHECK-NEXT: %tmp165 = phi i32 [ %tmp163, %body2.thread ], [ %tmp16, %body2 ]
-; CHECK-NEXT: %tmp154 = phi i32 [ %tmp165, %body2.thread ], [ %tmp15, %body2 ]
+; CHECK-NEXT: %tmp162 = phi i32 [ %tmp161, %body2.thread ], [ %tmp16, %body2 ]
+; CHECK-NEXT: %tmp152 = phi i32 [ %tmp162, %body2.thread ], [ %tmp15, %body2 ]
 
 define i32 @test(i1 %ARG1, i1 %ARG2, i32 %n) {
 entry:
@@ -0,0 +1,45 @@
+; RUN: opt < %s -jump-threading -S | FileCheck %s --check-prefix=DEFAULT
+; RUN: opt < %s -jump-threading -jump-threading-total-threshold=1 -S \
+; RUN:     | FileCheck %s --check-prefix=BUDGET
+
+; With no budget both merge blocks get threaded away.  Each thread duplicates
+; one add (cost 1), so with a one-unit budget the second thread must be
+; rejected even though it is individually profitable and Merge2 survives.
+
+define i32 @test(i1 %cond, i32 %a) {
+; DEFAULT-LABEL: @test(
+; DEFAULT-NOT: Merge
+; BUDGET-LABEL: @test(
+; BUDGET-NOT: Merge1
+; BUDGET: Merge2:
+entry:
+  br i1 %cond, label %T1, label %F1
+
+T1:
+  br label %Merge1
+
+F1:
+  br label %Merge1
+
+Merge1:
+  %B = phi i1 [ true, %T1 ], [ false, %F1 ]
+  %x = add i32 %a, 1
+  br i1 %B, label %T2, label %F2
+
+T2:
+  br label %Merge2
+
+F2:
+  br label %Merge2
+
+Merge2:
+  %C = phi i1 [ true, %T2 ], [ false, %F2 ]
+  %y = add i32 %x, 2
+  br i1 %C, label %T3, label %F3
+
+T3:
+  ret i32 %y
+
+F3:
+  ret i32 %x
+}
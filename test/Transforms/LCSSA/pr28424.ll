@@ -38,17 +38,17 @@ loopexit3:
   br label %loop_with_insert_point
 
 ; CHECK: loop_with_insert_point:
-; CHECK:   %x4 = phi i32 [ %x4, %loop_with_insert_point ], [ %x.lcssa2, %loopexit3 ], [ %x.lcssa, %loopexit1 ]
+; CHECK:   %x2 = phi i32 [ %x2, %loop_with_insert_point ], [ %x.lcssa2, %loopexit3 ], [ %x.lcssa, %loopexit1 ]
 loop_with_insert_point:
   br i1 undef, label %loop_with_insert_point, label %bb
 
 ; CHECK: bb:
-; CHECK:   %x4.lcssa = phi i32 [ %x4, %loop_with_insert_point ]
+; CHECK:   %x2.lcssa = phi i32 [ %x2, %loop_with_insert_point ]
 bb:
   br label %exit
 
 ; CHECK: exit:
-; CHECK:   %x3 = phi i32 [ %x4.lcssa, %bb ], [ %x.lcssa1, %loopexit2 ]
+; CHECK:   %x1 = phi i32 [ %x2.lcssa, %bb ], [ %x.lcssa1, %loopexit2 ]
 exit:
   ret i32 %x
 }
@@ -76,12 +76,12 @@ loopexit2:
   br label %loop_with_insert_point
 
 ; CHECK: loop_with_insert_point:
-; CHECK:   %x2 = phi i32 [ %x2, %loop_with_insert_point ], [ %x.lcssa1, %loopexit2 ], [ %x.lcssa, %loopexit1 ]
+; CHECK:   %x1 = phi i32 [ %x1, %loop_with_insert_point ], [ %x.lcssa1, %loopexit2 ], [ %x.lcssa, %loopexit1 ]
 loop_with_insert_point:
   br i1 undef, label %loop_with_insert_point, label %exit
 
 ; CHECK: exit:
-; CHECK:   %x2.lcssa = phi i32 [ %x2, %loop_with_insert_point ]
+; CHECK:   %x1.lcssa = phi i32 [ %x1, %loop_with_insert_point ]
 exit:
   ret i32 %x
 }
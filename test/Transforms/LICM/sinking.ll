@@ -196,7 +196,7 @@ Out2:		; preds = %ContLoop
 ; CHECK:     Out2:
 ; CHECK-NEXT:  %[[LCSSAPHI:.*]] = phi i32 [ %N_addr.0.pn
 ; CHECK-NEXT:  mul i32 %N, %[[LCSSAPHI]]
-; CHECK-NEXT:  sub i32 %tmp.6.le4, %N
+; CHECK-NEXT:  sub i32 %tmp.6.le1, %N
 ; CHECK-NEXT:  ret
 }
 
@@ -0,0 +1,78 @@
+; RUN: opt -basicaa -loop-idiom < %s -S | FileCheck %s
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v64:64:64-v128:128:128-a0:0:64-s0:64:64-f80:128:128-n8:16:32:64"
+
+; A forward copy whose destination lies below its source reads each element
+; before any store can clobber it, so it can become a memmove.
+;   for (i = 0; i < 64; i++) p[i] = p[i + 2];
+define void @forward_overlap(i32* nocapture %p) {
+; CHECK-LABEL: @forward_overlap(
+; CHECK: call void @llvm.memmove.p0i8.p0i8.i64(i8* align 4 %{{.*}}, i8* align 4 %{{.*}}, i64 256, i1 false)
+; CHECK-NOT: store i32
+entry:
+  br label %for.body
+
+for.body:
+  %i = phi i64 [ 0, %entry ], [ %inc, %for.body ]
+  %add = add nuw nsw i64 %i, 2
+  %src = getelementptr inbounds i32, i32* %p, i64 %add
+  %v = load i32, i32* %src, align 4
+  %dst = getelementptr inbounds i32, i32* %p, i64 %i
+  store i32 %v, i32* %dst, align 4
+  %inc = add nuw nsw i64 %i, 1
+  %cmp = icmp ult i64 %inc, 64
+  br i1 %cmp, label %for.body, label %exit
+
+exit:
+  ret void
+}
+
+; Here each load reads bytes an earlier iteration already stored, which
+; memmove does not emulate.  The loop must stay scalar.
+;   for (i = 0; i < 64; i++) p[i + 2] = p[i];
+define void @forward_clobber(i32* nocapture %p) {
+; CHECK-LABEL: @forward_clobber(
+; CHECK-NOT: call void @llvm.memmove
+; CHECK-NOT: call void @llvm.memcpy
+; CHECK: store i32
+entry:
+  br label %for.body
+
+for.body:
+  %i = phi i64 [ 0, %entry ], [ %inc, %for.body ]
+  %src = getelementptr inbounds i32, i32* %p, i64 %i
+  %v = load i32, i32* %src, align 4
+  %add = add nuw nsw i64 %i, 2
+  %dst = getelementptr inbounds i32, i32* %p, i64 %add
+  store i32 %v, i32* %dst, align 4
+  %inc = add nuw nsw i64 %i, 1
+  %cmp = icmp ult i64 %inc, 64
+  br i1 %cmp, label %for.body, label %exit
+
+exit:
+  ret void
+}
+
+; The backward equivalent of @forward_overlap: a descending copy whose
+; destination lies above its source.
+;   for (i = 63; i >= 0; i--) p[i + 2] = p[i];
+define void @backward_overlap(i32* nocapture %p) {
+; CHECK-LABEL: @backward_overlap(
+; CHECK: call void @llvm.memmove.p0i8.p0i8.i64(i8* align 4 %{{.*}}, i8* align 4 %{{.*}}, i64 256, i1 false)
+; CHECK-NOT: store i32
+entry:
+  br label %for.body
+
+for.body:
+  %i = phi i64 [ 63, %entry ], [ %dec, %for.body ]
+  %src = getelementptr inbounds i32, i32* %p, i64 %i
+  %v = load i32, i32* %src, align 4
+  %add = add nuw nsw i64 %i, 2
+  %dst = getelementptr inbounds i32, i32* %p, i64 %add
+  store i32 %v, i32* %dst, align 4
+  %dec = add nsw i64 %i, -1
+  %cmp = icmp sgt i64 %i, 0
+  br i1 %cmp, label %for.body, label %exit
+
+exit:
+  ret void
+}
@@ -14,10 +14,11 @@ define i32 @o() #0 {
 ; CHECK-NEXT:    [[TMP2:%.*]] = load i8*, i8** bitcast (i64* @d to i8**), align 8
 ; CHECK-NEXT:    [[TMP3:%.*]] = load i32, i32* @f, align 4
 ; CHECK-NEXT:    [[TMP4:%.*]] = icmp eq i32 [[TMP3]], 0
-; CHECK-NEXT:    br i1 [[TMP4]], label [[TMP17:%.*]], label [[DOTLR_PH2:%.*]]
-; CHECK:       .lr.ph2:
+; CHECK-NEXT:    br i1 [[TMP4]], label [[TMP17:%.*]], label [[DOTLR_PH1:%.*]]
+; CHECK:       .lr.ph1:
 ; CHECK-NEXT:    br label [[TMP5:%.*]]
-; CHECK:         [[TMP6:%.*]] = phi i32 [ [[TMP3]], [[DOTLR_PH2]] ], [ [[TMP15:%.*]], [[M_EXIT:%.*]] ]
+; CHECK:       5:
+; CHECK-NEXT:    [[TMP6:%.*]] = phi i32 [ [[TMP3]], [[DOTLR_PH1]] ], [ [[TMP15:%.*]], [[M_EXIT:%.*]] ]
 ; CHECK-NEXT:    [[TMP7:%.*]] = icmp ult i32 [[TMP6]], 4
 ; CHECK-NEXT:    [[TMP8:%.*]] = zext i1 [[TMP7]] to i32
 ; CHECK-NEXT:    store i32 [[TMP8]], i32* @g, align 4
@@ -31,7 +32,8 @@ define i32 @o() #0 {
 ; CHECK-NEXT:    br i1 [[TMP12]], label [[M_EXIT]], label [[DOTLR_PH:%.*]]
 ; CHECK:       .lr.ph:
 ; CHECK-NEXT:    br label [[TMP13:%.*]]
-; CHECK:         [[DOT11:%.*]] = phi i32 [ undef, [[DOTLR_PH]] ], [ [[TMP14:%.*]], [[J_EXIT_I:%.*]] ]
+; CHECK:       13:
+; CHECK-NEXT:    [[DOT11:%.*]] = phi i32 [ undef, [[DOTLR_PH]] ], [ [[TMP14:%.*]], [[J_EXIT_I:%.*]] ]
 ; CHECK-NEXT:    callbr void asm sideeffect "", "X,~{dirflag},~{fpsr},~{flags}"(i8* blockaddress(@o, [[M_EXIT]])) #1
 ; CHECK-NEXT:    to label [[J_EXIT_I]] [label %m.exit]
 ; CHECK:       j.exit.i:
@@ -45,12 +47,13 @@ define i32 @o() #0 {
 ; CHECK-NEXT:    store i32 [[DOT1_LCSSA]], i32* @h, align 4
 ; CHECK-NEXT:    [[TMP15]] = load i32, i32* @f, align 4
 ; CHECK-NEXT:    [[TMP16:%.*]] = icmp eq i32 [[TMP15]], 0
-; CHECK-NEXT:    br i1 [[TMP16]], label [[DOT_CRIT_EDGE3:%.*]], label [[TMP5]]
+; CHECK-NEXT:    br i1 [[TMP16]], label [[DOT_CRIT_EDGE1:%.*]], label [[TMP5]]
 ; CHECK:       ._crit_edge:
 ; CHECK-NEXT:    br label [[TMP17]]
-; CHECK:       ._crit_edge3:
+; CHECK:       ._crit_edge1:
 ; CHECK-NEXT:    br label [[TMP17]]
-; CHECK:         ret i32 undef
+; CHECK:       17:
+; CHECK-NEXT:    ret i32 undef
 ;
   %1 = alloca [1 x i32], align 4
   %2 = load i8*, i8** bitcast (i64* @d to i8**), align 8
@@ -16,7 +16,7 @@ entry:
   br label %for.cond, !dbg !24
 
 for.cond:                                         ; preds = %for.body, %entry
-  ; CHECK: %i.02 = phi i64 [ 0, %for.body.lr.ph ], [ %add, %for.body ]
+  ; CHECK: %i.01 = phi i64 [ 0, %for.body.lr.ph ], [ %add, %for.body ]
   %i.0 = phi i64 [ 0, %entry ], [ %add, %for.body ]
   call void @llvm.dbg.value(metadata i64 %i.0, metadata !18, metadata !DIExpression()), !dbg !23
   %cmp = icmp slt i64 %i.0, %n, !dbg !25
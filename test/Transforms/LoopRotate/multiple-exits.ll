@@ -35,11 +35,11 @@ return:                                           ; preds = %for.cond, %land.rhs
 
 ; CHECK-LABEL: @test1(
 ; CHECK: for.cond1.preheader:
-; CHECK: %sum.04 = phi i32 [ 0, %entry ], [ %sum.1.lcssa, %for.cond.loopexit ]
+; CHECK: %sum.01 = phi i32 [ 0, %entry ], [ %sum.1.lcssa, %for.cond.loopexit ]
 ; CHECK: br label %for.cond1
 
 ; CHECK: for.cond1:
-; CHECK: %sum.1 = phi i32 [ %add, %land.rhs ], [ %sum.04, %for.cond1.preheader ]
+; CHECK: %sum.1 = phi i32 [ %add, %land.rhs ], [ %sum.01, %for.cond1.preheader ]
 ; CHECK: %i.1 = phi i32 [ %inc, %land.rhs ], [ 0, %for.cond1.preheader ]
 ; CHECK: %cmp2 = icmp ult i32 %i.1, 100
 ; CHECK: br i1 %cmp2, label %land.rhs, label %for.cond.loopexit
@@ -76,7 +76,7 @@ return:                                           ; preds = %return.loopexit, %a
 
 ; CHECK-LABEL: @test2(
 ; CHECK: if.end:
-; CHECK: %inc = add i32 %i.02, 1
+; CHECK: %inc = add i32 %i.01, 1
 ; CHECK: %cmp = icmp eq i32 %inc, %x
 ; CHECK: br i1 %cmp, label %for.cond.return.loopexit_crit_edge, label %for.body
 }
@@ -17,7 +17,7 @@ target triple = "i386-unknown-freebsd10.0"
 ;   Outer step (relative to inner recurrence):
 ; CHECK: %scevgep = getelementptr i1, i1* %{{.*}}, i32 %lsr.iv
 ;   Outer use:
-; CHECK: %lsr.iv3 = phi [121 x i32]* [ %lsr.iv1, %for.body43.preheader ]
+; CHECK: %lsr.iv2 = phi [121 x i32]* [ %lsr.iv1, %for.body43.preheader ]
 define void @vb() nounwind {
 for.cond.preheader:
   br label %for.body7
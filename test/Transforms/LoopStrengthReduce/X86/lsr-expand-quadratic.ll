@@ -21,17 +21,17 @@ target triple = "x86_64-apple-macosx"
 ;
 ; CHECK-LABEL: @test2
 ; CHECK-LABEL: test2.loop:
-; CHECK:  %lsr.iv1 = phi i32 [ %lsr.iv.next2, %test2.loop ], [ -16777216, %entry ]
+; CHECK:  %lsr.iv1 = phi i32 [ %lsr.iv.next1, %test2.loop ], [ -16777216, %entry ]
 ; CHECK:  %lsr.iv = phi i32 [ %lsr.iv.next, %test2.loop ], [ 1, %entry ]
 ; CHECK:  %lsr.iv.next = add nsw i32 %lsr.iv, -1
-; CHECK:  %lsr.iv.next2 = add nsw i32 %lsr.iv1, 16777216
+; CHECK:  %lsr.iv.next1 = add nsw i32 %lsr.iv1, 16777216
 ;
 ; CHECK-LABEL: for.end:
 ; CHECK:  %tobool.us = icmp eq i32 %lsr.iv.next, 0
 ; CHECK:  %sub.us = select i1 %tobool.us, i32 0, i32 0
 ; CHECK:  %0 = sub i32 0, %sub.us
 ; CHECK:  %1 = sub i32 %0, %lsr.iv.next
-; CHECK:  %sext.us = mul i32 %lsr.iv.next2, %1
+; CHECK:  %sext.us = mul i32 %lsr.iv.next1, %1
 ; CHECK:  %f = ashr i32 %sext.us, 24
 ; CHECK: ret i32 %f
 define i32 @test2() {
@@ -10,12 +10,12 @@
 ; INSN:   getelementptr i32, i32* %x, i64 %indvars.iv
 ; INSN:   getelementptr i32, i32* %y, i64 %indvars.iv
 ; INSN:   getelementptr i32, i32* %q, i64 %indvars.iv
-; REGS    %lsr.iv4 = phi
+; REGS    %lsr.iv3 = phi
 ; REGS    %lsr.iv2 = phi
 ; REGS    %lsr.iv1 = phi
 ; REGS:   getelementptr i32, i32* %lsr.iv1, i64 1
 ; REGS:   getelementptr i32, i32* %lsr.iv2, i64 1
-; REGS:   getelementptr i32, i32* %lsr.iv4, i64 1
+; REGS:   getelementptr i32, i32* %lsr.iv3, i64 1
 
 ; LLC checks that LSR prefers less instructions to less registers.
 ; LSR should prefer complicated address to additonal add instructions.
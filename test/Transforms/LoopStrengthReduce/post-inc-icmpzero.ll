@@ -11,10 +11,10 @@
 ; CHECK:   [[r4:%[a-z0-9]+]] = shl nuw i64 [[r3]], 1
 ; CHECK:   br label %for.body
 ; CHECK: for.body:
-; CHECK:   %lsr.iv2 = phi i64 [ %lsr.iv.next, %for.body ], [ [[r4]], %for.body.lr.ph ]
-; CHECK:   %lsr.iv.next = add i64 %lsr.iv2, -2
-; CHECK:   %lsr.iv.next3 = inttoptr i64 %lsr.iv.next to i16*
-; CHECK:   %cmp27 = icmp eq i16* %lsr.iv.next3, null
+; CHECK:   %lsr.iv1 = phi i64 [ %lsr.iv.next, %for.body ], [ [[r4]], %for.body.lr.ph ]
+; CHECK:   %lsr.iv.next = add i64 %lsr.iv1, -2
+; CHECK:   %lsr.iv.next1 = inttoptr i64 %lsr.iv.next to i16*
+; CHECK:   %cmp27 = icmp eq i16* %lsr.iv.next1, null
 
 target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v64:64:64-v128:128:128-a0:0:64-s0:64:64-f80:128:128-n8:16:32:64"
 
@@ -23,34 +23,30 @@ define void @test1(i32 %k) {
 ; CHECK:       for.inc.peel:
 ; CHECK-NEXT:    [[INC_PEEL:%.*]] = add nsw i32 0, 1
 ; CHECK-NEXT:    [[CMP_PEEL:%.*]] = icmp slt i32 [[INC_PEEL]], [[K:%.*]]
-; CHECK-NEXT:    br i1 [[CMP_PEEL]], label [[FOR_BODY_PEEL_NEXT:%.*]], label [[FOR_END:%[^,]*]]
-; Verify that MD_loop metadata is dropped.
-; CHECK-NOT:   , !llvm.loop !{{[0-9]*}}
+; CHECK-NEXT:    br i1 [[CMP_PEEL]], label [[FOR_BODY_PEEL_NEXT:%.*]], label [[FOR_END:%.*]]
 ; CHECK:       for.body.peel.next:
-; CHECK-NEXT:    br label [[FOR_BODY_PEEL2:%.*]]
-; CHECK:       for.body.peel2:
-; CHECK-NEXT:    [[CMP1_PEEL3:%.*]] = icmp ult i32 [[INC_PEEL]], 2
-; CHECK-NEXT:    br i1 [[CMP1_PEEL3]], label [[IF_THEN_PEEL5:%.*]], label [[IF_ELSE_PEEL4:%.*]]
-; CHECK:       if.else.peel4:
+; CHECK-NEXT:    br label [[FOR_BODY_PEEL1:%.*]]
+; CHECK:       for.body.peel1:
+; CHECK-NEXT:    [[CMP1_PEEL1:%.*]] = icmp ult i32 [[INC_PEEL]], 2
+; CHECK-NEXT:    br i1 [[CMP1_PEEL1]], label [[IF_THEN_PEEL1:%.*]], label [[IF_ELSE_PEEL1:%.*]]
+; CHECK:       if.else.peel1:
 ; CHECK-NEXT:    call void @f2()
-; CHECK-NEXT:    br label [[FOR_INC_PEEL6:%.*]]
-; CHECK:       if.then.peel5:
+; CHECK-NEXT:    br label [[FOR_INC_PEEL1:%.*]]
+; CHECK:       if.then.peel1:
 ; CHECK-NEXT:    call void @f1()
-; CHECK-NEXT:    br label [[FOR_INC_PEEL6]]
-; CHECK:       for.inc.peel6:
-; CHECK-NEXT:    [[INC_PEEL7:%.*]] = add nsw i32 [[INC_PEEL]], 1
-; CHECK-NEXT:    [[CMP_PEEL8:%.*]] = icmp slt i32 [[INC_PEEL7]], [[K]]
-; CHECK-NEXT:    br i1 [[CMP_PEEL8]], label [[FOR_BODY_PEEL_NEXT1:%.*]], label [[FOR_END]]
-; Verify that MD_loop metadata is dropped.
-; CHECK-NOT:   , !llvm.loop !{{[0-9]*}}
+; CHECK-NEXT:    br label [[FOR_INC_PEEL1]]
+; CHECK:       for.inc.peel1:
+; CHECK-NEXT:    [[INC_PEEL1:%.*]] = add nsw i32 [[INC_PEEL]], 1
+; CHECK-NEXT:    [[CMP_PEEL1:%.*]] = icmp slt i32 [[INC_PEEL1]], [[K]]
+; CHECK-NEXT:    br i1 [[CMP_PEEL1]], label [[FOR_BODY_PEEL_NEXT1:%.*]], label [[FOR_END]]
 ; CHECK:       for.body.peel.next1:
-; CHECK-NEXT:    br label [[FOR_BODY_PEEL_NEXT9:%.*]]
-; CHECK:       for.body.peel.next9:
+; CHECK-NEXT:    br label [[FOR_BODY_PEEL_NEXT2:%.*]]
+; CHECK:       for.body.peel.next2:
 ; CHECK-NEXT:    br label [[FOR_BODY_LR_PH_PEEL_NEWPH:%.*]]
 ; CHECK:       for.body.lr.ph.peel.newph:
 ; CHECK-NEXT:    br label [[FOR_BODY:%.*]]
 ; CHECK:       for.body:
-; CHECK-NEXT:    [[I_05:%.*]] = phi i32 [ [[INC_PEEL7]], [[FOR_BODY_LR_PH_PEEL_NEWPH]] ], [ [[INC:%.*]], [[FOR_INC:%.*]] ]
+; CHECK-NEXT:    [[I_05:%.*]] = phi i32 [ [[INC_PEEL1]], [[FOR_BODY_LR_PH_PEEL_NEWPH]] ], [ [[INC:%.*]], [[FOR_INC:%.*]] ]
 ; CHECK-NEXT:    br i1 false, label [[IF_THEN:%.*]], label [[IF_ELSE:%.*]]
 ; CHECK:       if.then:
 ; CHECK-NEXT:    call void @f1()
@@ -61,12 +57,14 @@ define void @test1(i32 %k) {
 ; CHECK:       for.inc:
 ; CHECK-NEXT:    [[INC]] = add nuw nsw i32 [[I_05]], 1
 ; CHECK-NEXT:    [[CMP:%.*]] = icmp slt i32 [[INC]], [[K]]
-; CHECK-NEXT:    br i1 [[CMP]], label [[FOR_BODY]], label [[FOR_END_LOOPEXIT:%.*]], !llvm.loop !{{.*}}
+; CHECK-NEXT:    br i1 [[CMP]], label [[FOR_BODY]], label [[FOR_END_LOOPEXIT:%.*]], !llvm.loop !0
 ; CHECK:       for.end.loopexit:
 ; CHECK-NEXT:    br label [[FOR_END]]
 ; CHECK:       for.end:
 ; CHECK-NEXT:    ret void
 ;
+; Verify that MD_loop metadata is dropped.
+; Verify that MD_loop metadata is dropped.
 for.body.lr.ph:
   br label %for.body
 
@@ -119,86 +117,78 @@ define void @test2(i32 %k) {
 ; CHECK:       for.inc.peel:
 ; CHECK-NEXT:    [[INC_PEEL:%.*]] = add nsw i32 0, 1
 ; CHECK-NEXT:    [[CMP_PEEL:%.*]] = icmp slt i32 [[INC_PEEL]], [[K:%.*]]
-; CHECK-NEXT:    br i1 [[CMP_PEEL]], label [[FOR_BODY_PEEL_NEXT:%.*]], label [[FOR_END:%[^,]*]]
-; Verify that MD_loop metadata is dropped.
-; CHECK-NOT:   , !llvm.loop !{{[0-9]*}}
+; CHECK-NEXT:    br i1 [[CMP_PEEL]], label [[FOR_BODY_PEEL_NEXT:%.*]], label [[FOR_END:%.*]]
 ; CHECK:       for.body.peel.next:
-; CHECK-NEXT:    br label [[FOR_BODY_PEEL2:%.*]]
-; CHECK:       for.body.peel2:
-; CHECK-NEXT:    [[CMP1_PEEL3:%.*]] = icmp ult i32 [[INC_PEEL]], 2
-; CHECK-NEXT:    br i1 [[CMP1_PEEL3]], label [[IF_THEN_PEEL5:%.*]], label [[IF_ELSE_PEEL4:%.*]]
-; CHECK:       if.else.peel4:
+; CHECK-NEXT:    br label [[FOR_BODY_PEEL1:%.*]]
+; CHECK:       for.body.peel1:
+; CHECK-NEXT:    [[CMP1_PEEL1:%.*]] = icmp ult i32 [[INC_PEEL]], 2
+; CHECK-NEXT:    br i1 [[CMP1_PEEL1]], label [[IF_THEN_PEEL1:%.*]], label [[IF_ELSE_PEEL1:%.*]]
+; CHECK:       if.else.peel1:
 ; CHECK-NEXT:    call void @f2()
-; CHECK-NEXT:    br label [[IF2_PEEL6:%.*]]
-; CHECK:       if.then.peel5:
+; CHECK-NEXT:    br label [[IF2_PEEL1:%.*]]
+; CHECK:       if.then.peel1:
 ; CHECK-NEXT:    call void @f1()
-; CHECK-NEXT:    br label [[IF2_PEEL6]]
-; CHECK:       if2.peel6:
-; CHECK-NEXT:    [[CMP2_PEEL7:%.*]] = icmp ult i32 [[INC_PEEL]], 4
-; CHECK-NEXT:    br i1 [[CMP2_PEEL7]], label [[IF_THEN2_PEEL8:%.*]], label [[FOR_INC_PEEL9:%.*]]
-; CHECK:       if.then2.peel8:
+; CHECK-NEXT:    br label [[IF2_PEEL1]]
+; CHECK:       if2.peel1:
+; CHECK-NEXT:    [[CMP2_PEEL1:%.*]] = icmp ult i32 [[INC_PEEL]], 4
+; CHECK-NEXT:    br i1 [[CMP2_PEEL1]], label [[IF_THEN2_PEEL1:%.*]], label [[FOR_INC_PEEL1:%.*]]
+; CHECK:       if.then2.peel1:
 ; CHECK-NEXT:    call void @f1()
-; CHECK-NEXT:    br label [[FOR_INC_PEEL9]]
-; CHECK:       for.inc.peel9:
-; CHECK-NEXT:    [[INC_PEEL10:%.*]] = add nsw i32 [[INC_PEEL]], 1
-; CHECK-NEXT:    [[CMP_PEEL11:%.*]] = icmp slt i32 [[INC_PEEL10]], [[K]]
-; CHECK-NEXT:    br i1 [[CMP_PEEL11]], label [[FOR_BODY_PEEL_NEXT1:%.*]], label [[FOR_END]]
-; Verify that MD_loop metadata is dropped.
-; CHECK-NOT:   , !llvm.loop !{{[0-9]*}}
+; CHECK-NEXT:    br label [[FOR_INC_PEEL1]]
+; CHECK:       for.inc.peel1:
+; CHECK-NEXT:    [[INC_PEEL1:%.*]] = add nsw i32 [[INC_PEEL]], 1
+; CHECK-NEXT:    [[CMP_PEEL1:%.*]] = icmp slt i32 [[INC_PEEL1]], [[K]]
+; CHECK-NEXT:    br i1 [[CMP_PEEL1]], label [[FOR_BODY_PEEL_NEXT1:%.*]], label [[FOR_END]]
 ; CHECK:       for.body.peel.next1:
-; CHECK-NEXT:    br label [[FOR_BODY_PEEL13:%.*]]
-; CHECK:       for.body.peel13:
-; CHECK-NEXT:    [[CMP1_PEEL14:%.*]] = icmp ult i32 [[INC_PEEL10]], 2
-; CHECK-NEXT:    br i1 [[CMP1_PEEL14]], label [[IF_THEN_PEEL16:%.*]], label [[IF_ELSE_PEEL15:%.*]]
-; CHECK:       if.else.peel15:
+; CHECK-NEXT:    br label [[FOR_BODY_PEEL2:%.*]]
+; CHECK:       for.body.peel2:
+; CHECK-NEXT:    [[CMP1_PEEL2:%.*]] = icmp ult i32 [[INC_PEEL1]], 2
+; CHECK-NEXT:    br i1 [[CMP1_PEEL2]], label [[IF_THEN_PEEL2:%.*]], label [[IF_ELSE_PEEL2:%.*]]
+; CHECK:       if.else.peel2:
 ; CHECK-NEXT:    call void @f2()
-; CHECK-NEXT:    br label [[IF2_PEEL17:%.*]]
-; CHECK:       if.then.peel16:
+; CHECK-NEXT:    br label [[IF2_PEEL2:%.*]]
+; CHECK:       if.then.peel2:
 ; CHECK-NEXT:    call void @f1()
-; CHECK-NEXT:    br label [[IF2_PEEL17]]
-; CHECK:       if2.peel17:
-; CHECK-NEXT:    [[CMP2_PEEL18:%.*]] = icmp ult i32 [[INC_PEEL10]], 4
-; CHECK-NEXT:    br i1 [[CMP2_PEEL18]], label [[IF_THEN2_PEEL19:%.*]], label [[FOR_INC_PEEL20:%.*]]
-; CHECK:       if.then2.peel19:
+; CHECK-NEXT:    br label [[IF2_PEEL2]]
+; CHECK:       if2.peel2:
+; CHECK-NEXT:    [[CMP2_PEEL2:%.*]] = icmp ult i32 [[INC_PEEL1]], 4
+; CHECK-NEXT:    br i1 [[CMP2_PEEL2]], label [[IF_THEN2_PEEL2:%.*]], label [[FOR_INC_PEEL2:%.*]]
+; CHECK:       if.then2.peel2:
 ; CHECK-NEXT:    call void @f1()
-; CHECK-NEXT:    br label [[FOR_INC_PEEL20]]
-; CHECK:       for.inc.peel20:
-; CHECK-NEXT:    [[INC_PEEL21:%.*]] = add nsw i32 [[INC_PEEL10]], 1
-; CHECK-NEXT:    [[CMP_PEEL22:%.*]] = icmp slt i32 [[INC_PEEL21]], [[K]]
-; CHECK-NEXT:    br i1 [[CMP_PEEL22]], label [[FOR_BODY_PEEL_NEXT12:%.*]], label [[FOR_END]]
-; Verify that MD_loop metadata is dropped.
-; CHECK-NOT:   , !llvm.loop !{{[0-9]*}}
-; CHECK:       for.body.peel.next12:
-; CHECK-NEXT:    br label [[FOR_BODY_PEEL24:%.*]]
-; CHECK:       for.body.peel24:
-; CHECK-NEXT:    [[CMP1_PEEL25:%.*]] = icmp ult i32 [[INC_PEEL21]], 2
-; CHECK-NEXT:    br i1 [[CMP1_PEEL25]], label [[IF_THEN_PEEL27:%.*]], label [[IF_ELSE_PEEL26:%.*]]
-; CHECK:       if.else.peel26:
+; CHECK-NEXT:    br label [[FOR_INC_PEEL2]]
+; CHECK:       for.inc.peel2:
+; CHECK-NEXT:    [[INC_PEEL2:%.*]] = add nsw i32 [[INC_PEEL1]], 1
+; CHECK-NEXT:    [[CMP_PEEL2:%.*]] = icmp slt i32 [[INC_PEEL2]], [[K]]
+; CHECK-NEXT:    br i1 [[CMP_PEEL2]], label [[FOR_BODY_PEEL_NEXT2:%.*]], label [[FOR_END]]
+; CHECK:       for.body.peel.next2:
+; CHECK-NEXT:    br label [[FOR_BODY_PEEL3:%.*]]
+; CHECK:       for.body.peel3:
+; CHECK-NEXT:    [[CMP1_PEEL3:%.*]] = icmp ult i32 [[INC_PEEL2]], 2
+; CHECK-NEXT:    br i1 [[CMP1_PEEL3]], label [[IF_THEN_PEEL3:%.*]], label [[IF_ELSE_PEEL3:%.*]]
+; CHECK:       if.else.peel3:
 ; CHECK-NEXT:    call void @f2()
-; CHECK-NEXT:    br label [[IF2_PEEL28:%.*]]
-; CHECK:       if.then.peel27:
+; CHECK-NEXT:    br label [[IF2_PEEL3:%.*]]
+; CHECK:       if.then.peel3:
 ; CHECK-NEXT:    call void @f1()
-; CHECK-NEXT:    br label [[IF2_PEEL28]]
-; CHECK:       if2.peel28:
-; CHECK-NEXT:    [[CMP2_PEEL29:%.*]] = icmp ult i32 [[INC_PEEL21]], 4
-; CHECK-NEXT:    br i1 [[CMP2_PEEL29]], label [[IF_THEN2_PEEL30:%.*]], label [[FOR_INC_PEEL31:%.*]]
-; CHECK:       if.then2.peel30:
+; CHECK-NEXT:    br label [[IF2_PEEL3]]
+; CHECK:       if2.peel3:
+; CHECK-NEXT:    [[CMP2_PEEL3:%.*]] = icmp ult i32 [[INC_PEEL2]], 4
+; CHECK-NEXT:    br i1 [[CMP2_PEEL3]], label [[IF_THEN2_PEEL3:%.*]], label [[FOR_INC_PEEL3:%.*]]
+; CHECK:       if.then2.peel3:
 ; CHECK-NEXT:    call void @f1()
-; CHECK-NEXT:    br label [[FOR_INC_PEEL31]]
-; CHECK:       for.inc.peel31:
-; CHECK-NEXT:    [[INC_PEEL32:%.*]] = add nsw i32 [[INC_PEEL21]], 1
-; CHECK-NEXT:    [[CMP_PEEL33:%.*]] = icmp slt i32 [[INC_PEEL32]], [[K]]
-; CHECK-NEXT:    br i1 [[CMP_PEEL33]], label [[FOR_BODY_PEEL_NEXT23:%.*]], label [[FOR_END]]
-; Verify that MD_loop metadata is dropped.
-; CHECK-NOT:   , !llvm.loop !{{[0-9]*}}
-; CHECK:       for.body.peel.next23:
-; CHECK-NEXT:    br label [[FOR_BODY_PEEL_NEXT34:%.*]]
-; CHECK:       for.body.peel.next34:
+; CHECK-NEXT:    br label [[FOR_INC_PEEL3]]
+; CHECK:       for.inc.peel3:
+; CHECK-NEXT:    [[INC_PEEL3:%.*]] = add nsw i32 [[INC_PEEL2]], 1
+; CHECK-NEXT:    [[CMP_PEEL3:%.*]] = icmp slt i32 [[INC_PEEL3]], [[K]]
+; CHECK-NEXT:    br i1 [[CMP_PEEL3]], label [[FOR_BODY_PEEL_NEXT3:%.*]], label [[FOR_END]]
+; CHECK:       for.body.peel.next3:
+; CHECK-NEXT:    br label [[FOR_BODY_PEEL_NEXT4:%.*]]
+; CHECK:       for.body.peel.next4:
 ; CHECK-NEXT:    br label [[FOR_BODY_LR_PH_PEEL_NEWPH:%.*]]
 ; CHECK:       for.body.lr.ph.peel.newph:
 ; CHECK-NEXT:    br label [[FOR_BODY:%.*]]
 ; CHECK:       for.body:
-; CHECK-NEXT:    [[I_05:%.*]] = phi i32 [ [[INC_PEEL32]], [[FOR_BODY_LR_PH_PEEL_NEWPH]] ], [ [[INC:%.*]], [[FOR_INC:%.*]] ]
+; CHECK-NEXT:    [[I_05:%.*]] = phi i32 [ [[INC_PEEL3]], [[FOR_BODY_LR_PH_PEEL_NEWPH]] ], [ [[INC:%.*]], [[FOR_INC:%.*]] ]
 ; CHECK-NEXT:    br i1 false, label [[IF_THEN:%.*]], label [[IF_ELSE:%.*]]
 ; CHECK:       if.then:
 ; CHECK-NEXT:    call void @f1()
@@ -214,12 +204,16 @@ define void @test2(i32 %k) {
 ; CHECK:       for.inc:
 ; CHECK-NEXT:    [[INC]] = add nuw nsw i32 [[I_05]], 1
 ; CHECK-NEXT:    [[CMP:%.*]] = icmp slt i32 [[INC]], [[K]]
-; CHECK-NEXT:    br i1 [[CMP]], label [[FOR_BODY]], label [[FOR_END_LOOPEXIT:%.*]], !llvm.loop !{{.*}}
+; CHECK-NEXT:    br i1 [[CMP]], label [[FOR_BODY]], label [[FOR_END_LOOPEXIT:%.*]], !llvm.loop !2
 ; CHECK:       for.end.loopexit:
 ; CHECK-NEXT:    br label [[FOR_END]]
 ; CHECK:       for.end:
 ; CHECK-NEXT:    ret void
 ;
+; Verify that MD_loop metadata is dropped.
+; Verify that MD_loop metadata is dropped.
+; Verify that MD_loop metadata is dropped.
+; Verify that MD_loop metadata is dropped.
 for.body.lr.ph:
   br label %for.body
 
@@ -274,51 +268,45 @@ define void @test3(i32 %k) {
 ; CHECK:       for.inc.peel:
 ; CHECK-NEXT:    [[INC_PEEL:%.*]] = add nsw i32 0, 1
 ; CHECK-NEXT:    [[CMP_PEEL:%.*]] = icmp slt i32 [[INC_PEEL]], [[K:%.*]]
-; CHECK-NEXT:    br i1 [[CMP_PEEL]], label [[FOR_BODY_PEEL_NEXT:%.*]], label [[FOR_END:%[^,]*]]
-; Verify that MD_loop metadata is dropped.
-; CHECK-NOT:   , !llvm.loop !{{[0-9]*}}
+; CHECK-NEXT:    br i1 [[CMP_PEEL]], label [[FOR_BODY_PEEL_NEXT:%.*]], label [[FOR_END:%.*]]
 ; CHECK:       for.body.peel.next:
-; CHECK-NEXT:    br label [[FOR_BODY_PEEL2:%.*]]
-; CHECK:       for.body.peel2:
-; CHECK-NEXT:    [[CMP1_PEEL3:%.*]] = icmp ugt i32 [[INC_PEEL]], 2
-; CHECK-NEXT:    br i1 [[CMP1_PEEL3]], label [[IF_THEN_PEEL5:%.*]], label [[IF_ELSE_PEEL4:%.*]]
-; CHECK:       if.else.peel4:
+; CHECK-NEXT:    br label [[FOR_BODY_PEEL1:%.*]]
+; CHECK:       for.body.peel1:
+; CHECK-NEXT:    [[CMP1_PEEL1:%.*]] = icmp ugt i32 [[INC_PEEL]], 2
+; CHECK-NEXT:    br i1 [[CMP1_PEEL1]], label [[IF_THEN_PEEL1:%.*]], label [[IF_ELSE_PEEL1:%.*]]
+; CHECK:       if.else.peel1:
 ; CHECK-NEXT:    call void @f2()
-; CHECK-NEXT:    br label [[FOR_INC_PEEL6:%.*]]
-; CHECK:       if.then.peel5:
+; CHECK-NEXT:    br label [[FOR_INC_PEEL1:%.*]]
+; CHECK:       if.then.peel1:
 ; CHECK-NEXT:    call void @f1()
-; CHECK-NEXT:    br label [[FOR_INC_PEEL6]]
-; CHECK:       for.inc.peel6:
-; CHECK-NEXT:    [[INC_PEEL7:%.*]] = add nsw i32 [[INC_PEEL]], 1
-; CHECK-NEXT:    [[CMP_PEEL8:%.*]] = icmp slt i32 [[INC_PEEL7]], [[K]]
-; CHECK-NEXT:    br i1 [[CMP_PEEL8]], label [[FOR_BODY_PEEL_NEXT1:%.*]], label [[FOR_END]]
-; Verify that MD_loop metadata is dropped.
-; CHECK-NOT:   , !llvm.loop !{{[0-9]*}}
+; CHECK-NEXT:    br label [[FOR_INC_PEEL1]]
+; CHECK:       for.inc.peel1:
+; CHECK-NEXT:    [[INC_PEEL1:%.*]] = add nsw i32 [[INC_PEEL]], 1
+; CHECK-NEXT:    [[CMP_PEEL1:%.*]] = icmp slt i32 [[INC_PEEL1]], [[K]]
+; CHECK-NEXT:    br i1 [[CMP_PEEL1]], label [[FOR_BODY_PEEL_NEXT1:%.*]], label [[FOR_END]]
 ; CHECK:       for.body.peel.next1:
-; CHECK-NEXT:    br label [[FOR_BODY_PEEL10:%.*]]
-; CHECK:       for.body.peel10:
-; CHECK-NEXT:    [[CMP1_PEEL11:%.*]] = icmp ugt i32 [[INC_PEEL7]], 2
-; CHECK-NEXT:    br i1 [[CMP1_PEEL11]], label [[IF_THEN_PEEL13:%.*]], label [[IF_ELSE_PEEL12:%.*]]
-; CHECK:       if.else.peel12:
+; CHECK-NEXT:    br label [[FOR_BODY_PEEL2:%.*]]
+; CHECK:       for.body.peel2:
+; CHECK-NEXT:    [[CMP1_PEEL2:%.*]] = icmp ugt i32 [[INC_PEEL1]], 2
+; CHECK-NEXT:    br i1 [[CMP1_PEEL2]], label [[IF_THEN_PEEL2:%.*]], label [[IF_ELSE_PEEL2:%.*]]
+; CHECK:       if.else.peel2:
 ; CHECK-NEXT:    call void @f2()
-; CHECK-NEXT:    br label [[FOR_INC_PEEL14:%.*]]
-; CHECK:       if.then.peel13:
+; CHECK-NEXT:    br label [[FOR_INC_PEEL2:%.*]]
+; CHECK:       if.then.peel2:
 ; CHECK-NEXT:    call void @f1()
-; CHECK-NEXT:    br label [[FOR_INC_PEEL14]]
-; CHECK:       for.inc.peel14:
-; CHECK-NEXT:    [[INC_PEEL15:%.*]] = add nsw i32 [[INC_PEEL7]], 1
-; CHECK-NEXT:    [[CMP_PEEL16:%.*]] = icmp slt i32 [[INC_PEEL15]], [[K]]
-; CHECK-NEXT:    br i1 [[CMP_PEEL16]], label [[FOR_BODY_PEEL_NEXT9:%.*]], label [[FOR_END]]
-; Verify that MD_loop metadata is dropped.
-; CHECK-NOT:   , !llvm.loop !{{[0-9]*}}
-; CHECK:       for.body.peel.next9:
-; CHECK-NEXT:    br label [[FOR_BODY_PEEL_NEXT17:%.*]]
-; CHECK:       for.body.peel.next17:
+; CHECK-NEXT:    br label [[FOR_INC_PEEL2]]
+; CHECK:       for.inc.peel2:
+; CHECK-NEXT:    [[INC_PEEL2:%.*]] = add nsw i32 [[INC_PEEL1]], 1
+; CHECK-NEXT:    [[CMP_PEEL2:%.*]] = icmp slt i32 [[INC_PEEL2]], [[K]]
+; CHECK-NEXT:    br i1 [[CMP_PEEL2]], label [[FOR_BODY_PEEL_NEXT2:%.*]], label [[FOR_END]]
+; CHECK:       for.body.peel.next2:
+; CHECK-NEXT:    br label [[FOR_BODY_PEEL_NEXT3:%.*]]
+; CHECK:       for.body.peel.next3:
 ; CHECK-NEXT:    br label [[FOR_BODY_LR_PH_PEEL_NEWPH:%.*]]
 ; CHECK:       for.body.lr.ph.peel.newph:
 ; CHECK-NEXT:    br label [[FOR_BODY:%.*]]
 ; CHECK:       for.body:
-; CHECK-NEXT:    [[I_05:%.*]] = phi i32 [ [[INC_PEEL15]], [[FOR_BODY_LR_PH_PEEL_NEWPH]] ], [ [[INC:%.*]], [[FOR_INC:%.*]] ]
+; CHECK-NEXT:    [[I_05:%.*]] = phi i32 [ [[INC_PEEL2]], [[FOR_BODY_LR_PH_PEEL_NEWPH]] ], [ [[INC:%.*]], [[FOR_INC:%.*]] ]
 ; CHECK-NEXT:    br i1 true, label [[IF_THEN:%.*]], label [[IF_ELSE:%.*]]
 ; CHECK:       if.then:
 ; CHECK-NEXT:    call void @f1()
@@ -329,12 +317,15 @@ define void @test3(i32 %k) {
 ; CHECK:       for.inc:
 ; CHECK-NEXT:    [[INC]] = add nuw nsw i32 [[I_05]], 1
 ; CHECK-NEXT:    [[CMP:%.*]] = icmp slt i32 [[INC]], [[K]]
-; CHECK-NEXT:    br i1 [[CMP]], label [[FOR_BODY]], label [[FOR_END_LOOPEXIT:%.*]], !llvm.loop !{{.*}}
+; CHECK-NEXT:    br i1 [[CMP]], label [[FOR_BODY]], label [[FOR_END_LOOPEXIT:%.*]], !llvm.loop !4
 ; CHECK:       for.end.loopexit:
 ; CHECK-NEXT:    br label [[FOR_END]]
 ; CHECK:       for.end:
 ; CHECK-NEXT:    ret void
 ;
+; Verify that MD_loop metadata is dropped.
+; Verify that MD_loop metadata is dropped.
+; Verify that MD_loop metadata is dropped.
 for.body.lr.ph:
   br label %for.body
 
@@ -643,4 +634,4 @@ for.inc:
 for.end:
   ret void
 }
-; CHECK-NOT: llvm.loop.unroll.disable
\ No newline at end of file
+; CHECK-NOT: llvm.loop.unroll.disable
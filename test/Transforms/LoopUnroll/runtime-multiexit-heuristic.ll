@@ -11,10 +11,10 @@ define i32 @test1(i32* nocapture %a, i64 %n) {
 ; CHECK-LABEL:  otherexit.loopexit:
 ; CHECK-NEXT:     %sum.02.lcssa.ph = phi i32 [ %sum.02, %for.exiting_block ], [ %add, %for.exiting_block.1 ], [ %add.1, %for.exiting_block.2 ], [ %add.2, %for.exiting_block.3 ], [ %add.3, %for.exiting_block.4 ], [ %add.4, %for.exiting_block.5 ], [ %add.5, %for.exiting_block.6 ],
 ; CHECK-NEXT:     br label %otherexit
-; CHECK-LABEL:  otherexit.loopexit3:
+; CHECK-LABEL:  otherexit.loopexit1:
 ; CHECK-NEXT:     br label %otherexit
 ; CHECK-LABEL:  otherexit:
-; CHECK-NEXT:     %sum.02.lcssa = phi i32 [ %sum.02.lcssa.ph, %otherexit.loopexit ], [ %sum.02.epil, %otherexit.loopexit3 ]
+; CHECK-NEXT:     %sum.02.lcssa = phi i32 [ %sum.02.lcssa.ph, %otherexit.loopexit ], [ %sum.02.epil, %otherexit.loopexit1 ]
 ; CHECK-NEXT:     %rval = call i32 (...) @llvm.experimental.deoptimize.i32() [ "deopt"(i32 %sum.02.lcssa) ]
 ; CHECK-NEXT:     ret i32 %rval
 ; CHECK-LABEL:  latch.7:
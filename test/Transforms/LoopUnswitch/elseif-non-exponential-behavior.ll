@@ -5,7 +5,7 @@
 ;CHECK: [[Loop1:for\.end.*]]:                              ; preds = %for.cond.us
 ;CHECK-NEXT:  %[[PhiVar1:pdt.*]] = phi i32 [ %pdt.0.us, %for.cond.us ]
 ;CHECK: [[Loop2:for\.end.*]]:                     ; preds = %for.cond.us1
-;CHECK-NEXT:  %[[PhiVar2:pdt.*]] = phi i32 [ %pdt.0.us2, %for.cond.us1 ]
+;CHECK-NEXT:  %[[PhiVar2:pdt.*]] = phi i32 [ %pdt.0.us1, %for.cond.us1 ]
 ;CHECK: [[Loop3:for\.end.*]]:                        ; preds = %for.cond
 ;CHECK-NEXT:  %[[PhiVar3:pdt.*]] = phi i32 [ %pdt.0, %for.cond ]
 ;CHECK: [[Join1:for\.end.*]]:                                 ; preds = %[[Loop2]], %[[Loop3]]
@@ -4,49 +4,49 @@
 ; On output we should got binary comparison tree. Check that all is fine.
 
 ;CHECK:     entry:
-;CHECK-NEXT:  br label %NodeBlock19
+;CHECK-NEXT:  br label %NodeBlock9
 
-;CHECK:     NodeBlock19:                                      ; preds = %entry
-;CHECK-NEXT:  %Pivot20 = icmp slt i32 %tmp158, 10
-;CHECK-NEXT:  br i1 %Pivot20, label %NodeBlock5, label %NodeBlock17
+;CHECK:     NodeBlock9:                                      ; preds = %entry
+;CHECK-NEXT:  %Pivot9 = icmp slt i32 %tmp158, 10
+;CHECK-NEXT:  br i1 %Pivot9, label %NodeBlock3, label %NodeBlock8
 
-;CHECK:     NodeBlock17:                                      ; preds = %NodeBlock19
-;CHECK-NEXT:  %Pivot18 = icmp slt i32 %tmp158, 13
-;CHECK-NEXT:  br i1 %Pivot18, label %NodeBlock9, label %NodeBlock15
+;CHECK:     NodeBlock8:                                      ; preds = %NodeBlock9
+;CHECK-NEXT:  %Pivot8 = icmp slt i32 %tmp158, 13
+;CHECK-NEXT:  br i1 %Pivot8, label %NodeBlock5, label %NodeBlock7
 
-;CHECK:     NodeBlock15:                                      ; preds = %NodeBlock17
-;CHECK-NEXT:  %Pivot16 = icmp slt i32 %tmp158, 14
-;CHECK-NEXT:  br i1 %Pivot16, label %bb330, label %NodeBlock13
+;CHECK:     NodeBlock7:                                      ; preds = %NodeBlock8
+;CHECK-NEXT:  %Pivot7 = icmp slt i32 %tmp158, 14
+;CHECK-NEXT:  br i1 %Pivot7, label %bb330, label %NodeBlock6
 
-;CHECK:     NodeBlock13:                                      ; preds = %NodeBlock15
-;CHECK-NEXT:  %Pivot14 = icmp slt i32 %tmp158, 15
-;CHECK-NEXT:  br i1 %Pivot14, label %bb332, label %LeafBlock11
+;CHECK:     NodeBlock6:                                      ; preds = %NodeBlock7
+;CHECK-NEXT:  %Pivot6 = icmp slt i32 %tmp158, 15
+;CHECK-NEXT:  br i1 %Pivot6, label %bb332, label %LeafBlock1
 
-;CHECK:     LeafBlock11:                                      ; preds = %NodeBlock13
-;CHECK-NEXT:  %SwitchLeaf12 = icmp eq i32 %tmp158, 15
-;CHECK-NEXT:  br i1 %SwitchLeaf12, label %bb334, label %NewDefault
+;CHECK:     LeafBlock1:                                      ; preds = %NodeBlock6
+;CHECK-NEXT:  %SwitchLeaf1 = icmp eq i32 %tmp158, 15
+;CHECK-NEXT:  br i1 %SwitchLeaf1, label %bb334, label %NewDefault
 
-;CHECK:     NodeBlock9:                                       ; preds = %NodeBlock17
-;CHECK-NEXT:  %Pivot10 = icmp slt i32 %tmp158, 11
-;CHECK-NEXT:  br i1 %Pivot10, label %bb324, label %NodeBlock7
+;CHECK:     NodeBlock5:                                       ; preds = %NodeBlock8
+;CHECK-NEXT:  %Pivot5 = icmp slt i32 %tmp158, 11
+;CHECK-NEXT:  br i1 %Pivot5, label %bb324, label %NodeBlock4
 
-;CHECK:     NodeBlock7:                                       ; preds = %NodeBlock9
-;CHECK-NEXT:  %Pivot8 = icmp slt i32 %tmp158, 12
-;CHECK-NEXT:  br i1 %Pivot8, label %bb326, label %bb328
+;CHECK:     NodeBlock4:                                       ; preds = %NodeBlock5
+;CHECK-NEXT:  %Pivot4 = icmp slt i32 %tmp158, 12
+;CHECK-NEXT:  br i1 %Pivot4, label %bb326, label %bb328
 
-;CHECK:     NodeBlock5:                                       ; preds = %NodeBlock19
-;CHECK-NEXT:  %Pivot6 = icmp slt i32 %tmp158, 7
-;CHECK-NEXT:  br i1 %Pivot6, label %NodeBlock, label %NodeBlock3
+;CHECK:     NodeBlock3:                                       ; preds = %NodeBlock9
+;CHECK-NEXT:  %Pivot3 = icmp slt i32 %tmp158, 7
+;CHECK-NEXT:  br i1 %Pivot3, label %NodeBlock, label %NodeBlock2
 
-;CHECK:     NodeBlock3:                                       ; preds = %NodeBlock5
-;CHECK-NEXT:  %Pivot4 = icmp slt i32 %tmp158, 8
-;CHECK-NEXT:  br i1 %Pivot4, label %bb, label %NodeBlock1
+;CHECK:     NodeBlock2:                                       ; preds = %NodeBlock3
+;CHECK-NEXT:  %Pivot2 = icmp slt i32 %tmp158, 8
+;CHECK-NEXT:  br i1 %Pivot2, label %bb, label %NodeBlock1
 
-;CHECK:     NodeBlock1:                                       ; preds = %NodeBlock3
-;CHECK-NEXT:  %Pivot2 = icmp slt i32 %tmp158, 9
-;CHECK-NEXT:  br i1 %Pivot2, label %bb338, label %bb322
+;CHECK:     NodeBlock1:                                       ; preds = %NodeBlock2
+;CHECK-NEXT:  %Pivot1 = icmp slt i32 %tmp158, 9
+;CHECK-NEXT:  br i1 %Pivot1, label %bb338, label %bb322
 
-;CHECK:     NodeBlock:                                        ; preds = %NodeBlock5
+;CHECK:     NodeBlock:                                        ; preds = %NodeBlock3
 ;CHECK-NEXT:  %Pivot = icmp slt i32 %tmp158, 0
 ;CHECK-NEXT:  br i1 %Pivot, label %LeafBlock, label %bb338
 
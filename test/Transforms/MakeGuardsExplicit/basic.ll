@@ -33,20 +33,20 @@ define void @trivial_guard_sequence(i1 %cond1, i1 %cond2, i1 %cond3) {
 ; CHECK-NEXT:    call void (...) @llvm.experimental.deoptimize.isVoid() [ "deopt"(i32 123, i64 456) ]
 ; CHECK-NEXT:    ret void
 ; CHECK:       guarded:
-; CHECK-NEXT:    [[WIDENABLE_COND3:%.*]] = call i1 @llvm.experimental.widenable.condition()
-; CHECK-NEXT:    [[EXIPLICIT_GUARD_COND4:%.*]] = and i1 [[COND2:%.*]], [[WIDENABLE_COND3]]
-; CHECK-NEXT:    br i1 [[EXIPLICIT_GUARD_COND4]], label [[GUARDED1:%.*]], label [[DEOPT2:%.*]], !prof !0
-; CHECK:       deopt2:
+; CHECK-NEXT:    [[WIDENABLE_COND1:%.*]] = call i1 @llvm.experimental.widenable.condition()
+; CHECK-NEXT:    [[EXIPLICIT_GUARD_COND1:%.*]] = and i1 [[COND2:%.*]], [[WIDENABLE_COND1]]
+; CHECK-NEXT:    br i1 [[EXIPLICIT_GUARD_COND1]], label [[GUARDED1:%.*]], label [[DEOPT1:%.*]], !prof !0
+; CHECK:       deopt1:
 ; CHECK-NEXT:    call void (...) @llvm.experimental.deoptimize.isVoid() [ "deopt"(i32 789, i64 123) ]
 ; CHECK-NEXT:    ret void
 ; CHECK:       guarded1:
-; CHECK-NEXT:    [[WIDENABLE_COND7:%.*]] = call i1 @llvm.experimental.widenable.condition()
-; CHECK-NEXT:    [[EXIPLICIT_GUARD_COND8:%.*]] = and i1 [[COND3:%.*]], [[WIDENABLE_COND7]]
-; CHECK-NEXT:    br i1 [[EXIPLICIT_GUARD_COND8]], label [[GUARDED5:%.*]], label [[DEOPT6:%.*]], !prof !0
-; CHECK:       deopt6:
+; CHECK-NEXT:    [[WIDENABLE_COND2:%.*]] = call i1 @llvm.experimental.widenable.condition()
+; CHECK-NEXT:    [[EXIPLICIT_GUARD_COND2:%.*]] = and i1 [[COND3:%.*]], [[WIDENABLE_COND2]]
+; CHECK-NEXT:    br i1 [[EXIPLICIT_GUARD_COND2]], label [[GUARDED2:%.*]], label [[DEOPT2:%.*]], !prof !0
+; CHECK:       deopt2:
 ; CHECK-NEXT:    call void (...) @llvm.experimental.deoptimize.isVoid() [ "deopt"(i32 456, i64 789) ]
 ; CHECK-NEXT:    ret void
-; CHECK:       guarded5:
+; CHECK:       guarded2:
 ; CHECK-NEXT:    ret void
 ;
 entry:
@@ -69,21 +69,21 @@ define void @split_block_contents(i1 %cond1, i1 %cond2, i1 %cond3, i32* %p) {
 ; CHECK-NEXT:    ret void
 ; CHECK:       guarded:
 ; CHECK-NEXT:    store i32 1, i32* [[P]]
-; CHECK-NEXT:    [[WIDENABLE_COND3:%.*]] = call i1 @llvm.experimental.widenable.condition()
-; CHECK-NEXT:    [[EXIPLICIT_GUARD_COND4:%.*]] = and i1 [[COND2:%.*]], [[WIDENABLE_COND3]]
-; CHECK-NEXT:    br i1 [[EXIPLICIT_GUARD_COND4]], label [[GUARDED1:%.*]], label [[DEOPT2:%.*]], !prof !0
-; CHECK:       deopt2:
+; CHECK-NEXT:    [[WIDENABLE_COND1:%.*]] = call i1 @llvm.experimental.widenable.condition()
+; CHECK-NEXT:    [[EXIPLICIT_GUARD_COND1:%.*]] = and i1 [[COND2:%.*]], [[WIDENABLE_COND1]]
+; CHECK-NEXT:    br i1 [[EXIPLICIT_GUARD_COND1]], label [[GUARDED1:%.*]], label [[DEOPT1:%.*]], !prof !0
+; CHECK:       deopt1:
 ; CHECK-NEXT:    call void (...) @llvm.experimental.deoptimize.isVoid() [ "deopt"(i32 789, i64 123) ]
 ; CHECK-NEXT:    ret void
 ; CHECK:       guarded1:
 ; CHECK-NEXT:    store i32 2, i32* [[P]]
-; CHECK-NEXT:    [[WIDENABLE_COND7:%.*]] = call i1 @llvm.experimental.widenable.condition()
-; CHECK-NEXT:    [[EXIPLICIT_GUARD_COND8:%.*]] = and i1 [[COND3:%.*]], [[WIDENABLE_COND7]]
-; CHECK-NEXT:    br i1 [[EXIPLICIT_GUARD_COND8]], label [[GUARDED5:%.*]], label [[DEOPT6:%.*]], !prof !0
-; CHECK:       deopt6:
+; CHECK-NEXT:    [[WIDENABLE_COND2:%.*]] = call i1 @llvm.experimental.widenable.condition()
+; CHECK-NEXT:    [[EXIPLICIT_GUARD_COND2:%.*]] = and i1 [[COND3:%.*]], [[WIDENABLE_COND2]]
+; CHECK-NEXT:    br i1 [[EXIPLICIT_GUARD_COND2]], label [[GUARDED2:%.*]], label [[DEOPT2:%.*]], !prof !0
+; CHECK:       deopt2:
 ; CHECK-NEXT:    call void (...) @llvm.experimental.deoptimize.isVoid() [ "deopt"(i32 456, i64 789) ]
 ; CHECK-NEXT:    ret void
-; CHECK:       guarded5:
+; CHECK:       guarded2:
 ; CHECK-NEXT:    store i32 3, i32* [[P]]
 ; CHECK-NEXT:    ret void
 ;
@@ -23,7 +23,7 @@ taken:                                            ; preds = %entry
 untaken:                                          ; preds = %entry
 ; CHECK-LABEL: untaken:
 ; CHECK-NEXT: gc.statepoint
-; CHECK-NEXT: %obj.relocated2 = call coldcc i8 addrspace(1)*
+; CHECK-NEXT: %obj.relocated1 = call coldcc i8 addrspace(1)*
 ; CHECK-NEXT: bitcast
 ; CHECK-NEXT: br label %merge
   call void @foo() [ "deopt"() ]
@@ -31,7 +31,7 @@ untaken:                                          ; preds = %entry
 
 merge:                                            ; preds = %untaken, %taken
 ; CHECK-LABEL: merge:
-; CHECK-NEXT: %.0 = phi i64 addrspace(1)* [ %obj.relocated.casted, %taken ], [ %obj.relocated2.casted, %untaken ]
+; CHECK-NEXT: %.0 = phi i64 addrspace(1)* [ %obj.relocated.casted, %taken ], [ %obj.relocated1.casted, %untaken ]
 ; CHECK-NEXT: ret i64 addrspace(1)* %.0
 ; A local kill should not effect liveness in predecessor block
   ret i64 addrspace(1)* %obj
@@ -106,13 +106,13 @@ entry:
 ; CHECK-NEXT:  %obj.relocated =
 ; CHECK-NEXT:  bitcast
 ; CHECK-NEXT:  gc.statepoint
-; CHECK-NEXT:  %derived.relocated2 =
+; CHECK-NEXT:  %derived.relocated1 =
 ; CHECK-NEXT:  bitcast 
 
 ; Note: It's legal to relocate obj again, but not strictly needed
-; CHECK-NEXT:  %obj.relocated3 =
+; CHECK-NEXT:  %obj.relocated1 =
 ; CHECK-NEXT:  bitcast
-; CHECK-NEXT:  ret i64 addrspace(1)* %derived.relocated2.casted
+; CHECK-NEXT:  ret i64 addrspace(1)* %derived.relocated1.casted
 ; 
 ; Make sure that a phi def visited during iteration is considered a kill.
 ; Also, liveness after base pointer analysis can change based on new uses,
@@ -97,7 +97,7 @@ join:                                             ; preds = %else_branch, %if_br
 ; CHECK-LABEL: join:
 ; CHECK: phi i8 addrspace(1)*
 ; CHECK-DAG: [ %arg.relocated, %if_branch ]
-; CHECK-DAG: [ %arg.relocated2, %else_branch ]
+; CHECK-DAG: [ %arg.relocated1, %else_branch ]
 ; CHECK-NOT: phi
   call void @some_call(i8 addrspace(1)* %arg)
   ret void
@@ -20,7 +20,7 @@ normal_return:                                    ; preds = %second_invoke
   ret i64 addrspace(1)* %obj
 
 ; CHECK: exceptional_return1:
-; CHECK-NEXT: %lpad2 = landingpad token
+; CHECK-NEXT: %lpad1 = landingpad token
 
 ; CHECK: exceptional_return.split-lp:
 ; CHECK-NEXT: %lpad.split-lp = landingpad token
@@ -26,7 +26,7 @@ define void @test_inline(i64* (i32*)*, i32* %x) !dbg !6 {
 ; CHECK: br {{.*}} !prof ![[BR2:[0-9]+]]
 ; CHECK: if.true.direct_targ1:
 ; CHECK-NOT: call
-; CHECK: if.false.orig_indirect2:
+; CHECK: if.false.orig_indirect1:
 ; CHECK: call {{.*}} !prof ![[VP:[0-9]+]]
   call i64* %3(i32* %x), !dbg !7
   ret void
@@ -185,9 +185,9 @@ loop_b_a:
 ;
 ; CHECK:       loop_b_a.us:
 ; CHECK-NEXT:    call i32 @b()
-; CHECK-NEXT:    br label %latch.us2
+; CHECK-NEXT:    br label %latch.us1
 ;
-; CHECK:       latch.us2:
+; CHECK:       latch.us1:
 ; CHECK-NEXT:    %[[V:.*]] = load i1, i1* %ptr
 ; CHECK-NEXT:    br i1 %[[V]], label %loop_begin.us1, label %loop_exit.split.split.us
 ;
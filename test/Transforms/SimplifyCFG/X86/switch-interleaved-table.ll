@@ -0,0 +1,87 @@
+; RUN: opt < %s -simplifycfg -switch-to-lookup=true -keep-loops=false \
+; RUN:     -simplifycfg-interleave-lookup-tables -S \
+; RUN:     -mtriple=x86_64-unknown-linux-gnu | FileCheck %s
+; RUN: opt < %s -passes='simplify-cfg<no-keep-loops;switch-to-lookup>' \
+; RUN:     -simplifycfg-interleave-lookup-tables -S \
+; RUN:     -mtriple=x86_64-unknown-linux-gnu | FileCheck %s
+
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v64:64:64-v128:128:128-a0:0:64-s0:64:64-f80:128:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+; In @two_results both results need in-memory tables (non-linear values, too
+; wide for a bitmap), so they are interleaved into a single array of structs
+; and fetched with field loads off one row pointer.  @one_result has nothing
+; to interleave and keeps the plain per-result table.
+
+; CHECK: @switch.interleaved.two_results = private unnamed_addr constant [4 x { i32, i32 }] [{ i32, i32 } { i32 7, i32 2 }, { i32, i32 } { i32 3, i32 9 }, { i32, i32 } { i32 11, i32 4 }, { i32, i32 } { i32 5, i32 13 }]
+; CHECK-NOT: @switch.table.two_results
+; CHECK: @switch.table.one_result = private unnamed_addr constant [4 x i32]
+
+define i32 @two_results(i32 %x) {
+; CHECK-LABEL: @two_results(
+; CHECK: switch.lookup:
+; CHECK: getelementptr inbounds [4 x { i32, i32 }], [4 x { i32, i32 }]* @switch.interleaved.two_results, i32 0, i32 %switch.tableidx
+; CHECK: getelementptr inbounds { i32, i32 }, { i32, i32 }* %switch.gep, i32 0, i32 0
+; CHECK: load i32
+; CHECK: getelementptr inbounds { i32, i32 }, { i32, i32 }* %switch.gep, i32 0, i32 1
+; CHECK: load i32
+entry:
+  switch i32 %x, label %sw.default [
+    i32 1, label %sw.bb
+    i32 2, label %sw.bb1
+    i32 3, label %sw.bb2
+    i32 4, label %sw.bb3
+  ]
+
+sw.bb:
+  br label %return
+
+sw.bb1:
+  br label %return
+
+sw.bb2:
+  br label %return
+
+sw.bb3:
+  br label %return
+
+sw.default:
+  br label %return
+
+return:
+  %a = phi i32 [ 1, %sw.default ], [ 5, %sw.bb3 ], [ 11, %sw.bb2 ], [ 3, %sw.bb1 ], [ 7, %sw.bb ]
+  %b = phi i32 [ 6, %sw.default ], [ 13, %sw.bb3 ], [ 4, %sw.bb2 ], [ 9, %sw.bb1 ], [ 2, %sw.bb ]
+  %r = add i32 %a, %b
+  ret i32 %r
+}
+
+define i32 @one_result(i32 %x) {
+; CHECK-LABEL: @one_result(
+; CHECK: @switch.table.one_result
+entry:
+  switch i32 %x, label %sw.default [
+    i32 1, label %sw.bb
+    i32 2, label %sw.bb1
+    i32 3, label %sw.bb2
+    i32 4, label %sw.bb3
+  ]
+
+sw.bb:
+  br label %return
+
+sw.bb1:
+  br label %return
+
+sw.bb2:
+  br label %return
+
+sw.bb3:
+  br label %return
+
+sw.default:
+  br label %return
+
+return:
+  %a = phi i32 [ 1, %sw.default ], [ 5, %sw.bb3 ], [ 11, %sw.bb2 ], [ 3, %sw.bb1 ], [ 7, %sw.bb ]
+  ret i32 %a
+}
@@ -0,0 +1,16 @@
+; REQUIRES: x86-registered-target
+; RUN: llc -mtriple=x86_64-unknown-linux-gnu -split-codegen=2 -filetype=asm \
+; RUN:     -o %t.s %s
+; RUN: cat %t.s %t.s.1 | FileCheck %s
+
+; Both functions must be emitted across the two partition outputs.
+; CHECK-DAG: foo:
+; CHECK-DAG: bar:
+
+define void @foo() {
+  ret void
+}
+
+define void @bar() {
+  ret void
+}
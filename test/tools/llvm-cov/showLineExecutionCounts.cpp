@@ -35,6 +35,15 @@ int main() {                              // TEXT: [[@LINE]]|   161|int main(
 // RUN: FileCheck -check-prefixes=TEXT,WHOLE-FILE -input-file %t.dir/coverage/tmp/showLineExecutionCounts.cpp.txt %s
 // RUN: FileCheck -check-prefixes=TEXT,FILTER -input-file %t.filtered.dir/coverage/tmp/showLineExecutionCounts.cpp.txt %s
 //
+// Test -incremental: a view file newer than all inputs is not re-rendered,
+// while a plain re-run overwrites it.
+// RUN: llvm-cov show %S/Inputs/lineExecutionCounts.covmapping -o %t.inc.dir -incremental -instr-profile %t.profdata -path-equivalence=/tmp,%S %s
+// RUN: echo stale > %t.inc.dir/coverage/tmp/showLineExecutionCounts.cpp.txt
+// RUN: llvm-cov show %S/Inputs/lineExecutionCounts.covmapping -o %t.inc.dir -incremental -instr-profile %t.profdata -path-equivalence=/tmp,%S %s
+// RUN: not grep -q "int main" %t.inc.dir/coverage/tmp/showLineExecutionCounts.cpp.txt
+// RUN: llvm-cov show %S/Inputs/lineExecutionCounts.covmapping -o %t.inc.dir -instr-profile %t.profdata -path-equivalence=/tmp,%S %s
+// RUN: grep -q "int main" %t.inc.dir/coverage/tmp/showLineExecutionCounts.cpp.txt
+//
 // RUN: llvm-cov export %S/Inputs/lineExecutionCounts.covmapping -instr-profile %t.profdata 2>/dev/null -summary-only > %t.export-summary.json
 // RUN: not grep '"name":"main"' %t.export-summary.json
 //
@@ -0,0 +1,31 @@
+; Test that -split-module-by-callgraph keeps direct caller/callee pairs in
+; the same partition instead of scattering them by symbol hash.
+
+; RUN: llvm-split -split-module-by-callgraph -j2 -o %t %s
+; RUN: llvm-dis -o - %t0 | FileCheck --check-prefix=CHECK0 %s
+; RUN: llvm-dis -o - %t1 | FileCheck --check-prefix=CHECK1 %s
+
+; CHECK0: define void @c
+; CHECK0: define void @d
+; CHECK1: define void @a
+; CHECK1: define void @b
+
+define void @a() {
+  call void @b(), !prof !0
+  ret void
+}
+
+define void @b() {
+  ret void
+}
+
+define void @c() {
+  call void @d(), !prof !0
+  ret void
+}
+
+define void @d() {
+  ret void
+}
+
+!0 = !{!"branch_weights", i32 1000}
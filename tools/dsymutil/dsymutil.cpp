@@ -86,6 +86,7 @@ struct DsymutilOptions {
   bool DumpDebugMap = false;
   bool DumpStab = false;
   bool Flat = false;
+  bool Incremental = false;
   bool InputIsYAMLDebugMap = false;
   bool PaperTrailWarnings = false;
   bool Verify = false;
@@ -182,6 +183,11 @@ static Error verifyOptions(const DsymutilOptions &Options) {
         "paper trail warnings are not supported for YAML input.",
         errc::invalid_argument);
 
+  if (Options.Incremental && Options.LinkOpts.Update)
+    return make_error<StringError>(
+        "--incremental cannot be used when updating a dSYM in place.",
+        errc::invalid_argument);
+
   return Error::success();
 }
 
@@ -210,6 +216,7 @@ static Expected<DsymutilOptions> getOptions(opt::InputArgList &Args) {
   Options.DumpDebugMap = Args.hasArg(OPT_dump_debug_map);
   Options.DumpStab = Args.hasArg(OPT_symtab);
   Options.Flat = Args.hasArg(OPT_flat);
+  Options.Incremental = Args.hasArg(OPT_incremental);
   Options.InputIsYAMLDebugMap = Args.hasArg(OPT_yaml_input);
   Options.PaperTrailWarnings = Args.hasArg(OPT_papertrail);
   Options.Verify = Args.hasArg(OPT_verify);
@@ -374,6 +381,39 @@ static bool verify(StringRef OutputFile, StringRef Arch, bool Verbose) {
   return false;
 }
 
+/// Returns true when the dSYM at \p OutputFile is already newer than the
+/// input binary and every object file recorded in the debug maps, in which
+/// case relinking it would reproduce the same output. The object timestamps
+/// come from the debug map itself (the N_OSO entries), so an object that was
+/// modified after the binary was linked still triggers a relink.
+static bool isUpToDate(StringRef OutputFile, StringRef InputFile,
+                       const std::vector<std::unique_ptr<DebugMap>> &Maps) {
+  if (OutputFile == "-")
+    return false;
+
+  sys::fs::file_status OutStat;
+  if (sys::fs::status(OutputFile, OutStat))
+    return false;
+  sys::fs::file_status InStat;
+  if (sys::fs::status(InputFile, InStat))
+    return false;
+
+  // The debug map timestamps only have second precision, so compare
+  // everything at that granularity.
+  auto OutTime = std::chrono::time_point_cast<std::chrono::seconds>(
+      OutStat.getLastModificationTime());
+  if (OutTime < std::chrono::time_point_cast<std::chrono::seconds>(
+                    InStat.getLastModificationTime()))
+    return false;
+
+  for (const auto &Map : Maps)
+    for (const auto &Obj : Map->objects())
+      if (OutTime < Obj->getTimestamp())
+        return false;
+
+  return true;
+}
+
 namespace {
 struct OutputLocation {
   OutputLocation(std::string DWARFFile, Optional<std::string> ResourceDir = {})
@@ -521,6 +561,24 @@ int main(int argc, char **argv) {
       return 1;
     }
 
+    // With --incremental, skip the link entirely when the existing output
+    // already covers the current inputs.
+    if (Options.Incremental && !Options.DumpDebugMap &&
+        !Options.LinkOpts.NoOutput) {
+      Expected<OutputLocation> OutputLocationOrErr =
+          getOutputFileName(InputFile, Options);
+      if (!OutputLocationOrErr) {
+        WithColor::error() << toString(OutputLocationOrErr.takeError());
+        return 1;
+      }
+      if (isUpToDate(OutputLocationOrErr->DWARFFile, InputFile,
+                     *DebugMapPtrsOrErr)) {
+        if (Options.LinkOpts.Verbose)
+          outs() << "Skipping " << InputFile << ": dSYM is up to date.\n";
+        continue;
+      }
+    }
+
     // Shared a single binary holder for all the link steps.
     BinaryHolder BinHolder;
 
@@ -21,6 +21,7 @@
 #include "llvm/CodeGen/MIRParser/MIRParser.h"
 #include "llvm/CodeGen/MachineFunctionPass.h"
 #include "llvm/CodeGen/MachineModuleInfo.h"
+#include "llvm/CodeGen/ParallelCG.h"
 #include "llvm/CodeGen/TargetPassConfig.h"
 #include "llvm/CodeGen/TargetSubtargetInfo.h"
 #include "llvm/IR/AutoUpgrade.h"
@@ -77,6 +78,12 @@ TimeCompilations("time-compilations", cl::Hidden, cl::init(1u),
                  cl::value_desc("N"),
                  cl::desc("Repeat compilation N times for timing"));
 
+static cl::opt<unsigned> SplitCodeGenParallelism(
+    "split-codegen", cl::init(1u), cl::value_desc("N"),
+    cl::desc("Split the module into N partitions and run code generation for "
+             "them in parallel; partition 0 is written to the output file and "
+             "partition I to <output file>.<I>"));
+
 static cl::opt<bool>
 NoIntegratedAssembler("no-integrated-as", cl::Hidden,
                       cl::desc("Disable integrated assembler"));
@@ -523,6 +530,60 @@ static int compileModule(char **argv, LLVMContext &Context) {
     WithColor::warning(errs(), argv[0])
         << ": warning: ignoring -mc-relax-all because filetype != obj";
 
+  // In split codegen mode, partition the module and run code generation for
+  // each partition on its own thread; linking the outputs together is
+  // intended to be equivalent to the single output file. Only final emission
+  // runs concurrently - each partition gets its own context, TargetMachine,
+  // and output stream.
+  if (SplitCodeGenParallelism > 1) {
+    if (MIR || !RunPassNames->empty() || CompileTwice || DwoOut ||
+        OutputFilename == "-") {
+      WithColor::error(errs(), argv[0])
+          << "-split-codegen cannot be combined with MIR input, -run-pass, "
+             "-compile-twice, -split-dwarf-output, or output to stdout.\n";
+      return 1;
+    }
+
+    sys::fs::OpenFlags OpenFlags = FileType == TargetMachine::CGFT_AssemblyFile
+                                       ? sys::fs::OF_Text
+                                       : sys::fs::OF_None;
+    SmallVector<std::unique_ptr<ToolOutputFile>, 4> ExtraOuts;
+    SmallVector<raw_pwrite_stream *, 4> OSs;
+    OSs.push_back(&Out->os());
+    for (unsigned I = 1; I != SplitCodeGenParallelism; ++I) {
+      std::error_code EC;
+      std::string PartFilename =
+          (Twine(OutputFilename.getValue()) + "." + Twine(I)).str();
+      auto PartOut =
+          std::make_unique<ToolOutputFile>(PartFilename, EC, OpenFlags);
+      if (EC) {
+        WithColor::error(errs(), argv[0]) << EC.message() << '\n';
+        return 1;
+      }
+      OSs.push_back(&PartOut->os());
+      ExtraOuts.push_back(std::move(PartOut));
+    }
+
+    splitCodeGen(std::move(M), OSs, {},
+                 [&]() {
+                   return std::unique_ptr<TargetMachine>(
+                       TheTarget->createTargetMachine(
+                           TheTriple.getTriple(), CPUStr, FeaturesStr, Options,
+                           getRelocModel(), getCodeModel(), OLvl));
+                 },
+                 FileType);
+
+    auto HasError =
+        ((const LLCDiagnosticHandler *)(Context.getDiagHandlerPtr()))->HasError;
+    if (*HasError)
+      return 1;
+
+    Out->keep();
+    for (std::unique_ptr<ToolOutputFile> &PartOut : ExtraOuts)
+      PartOut->keep();
+    return 0;
+  }
+
   {
     raw_pwrite_stream *OS = &Out->os();
 
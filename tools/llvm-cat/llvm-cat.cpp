@@ -13,11 +13,14 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/BinaryFormat/Magic.h"
 #include "llvm/Bitcode/BitcodeReader.h"
 #include "llvm/Bitcode/BitcodeWriter.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IRReader/IRReader.h"
+#include "llvm/Object/Archive.h"
+#include "llvm/Object/IRObjectFile.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/FileSystem.h"
@@ -60,7 +63,17 @@ int main(int argc, char **argv) {
     for (const auto &InputFilename : InputFilenames) {
       std::unique_ptr<MemoryBuffer> MB = ExitOnErr(
           errorOrToExpected(MemoryBuffer::getFileOrSTDIN(InputFilename)));
-      std::vector<BitcodeModule> Mods = ExitOnErr(getBitcodeModuleList(*MB));
+      // Archive members and embedded bitcode sections are concatenated
+      // straight out of the mapped input; nothing is copied before the
+      // output buffer.
+      std::vector<BitcodeModule> Mods;
+      if (identify_magic(MB->getBuffer()) == file_magic::archive) {
+        std::unique_ptr<object::Archive> A = ExitOnErr(
+            object::Archive::create(MB->getMemBufferRef()));
+        Mods = ExitOnErr(object::IRObjectFile::findBitcodeInArchive(*A));
+      } else {
+        Mods = ExitOnErr(getBitcodeModuleList(*MB));
+      }
       for (auto &BitcodeMod : Mods) {
         Buffer.insert(Buffer.end(), BitcodeMod.getBuffer().begin(),
                       BitcodeMod.getBuffer().end());
@@ -145,6 +145,14 @@ private:
   /// The architecture the coverage mapping data targets.
   std::vector<StringRef> CoverageArches;
 
+  /// In -incremental mode, skip re-rendering view files that are newer than
+  /// every input (profile, objects, and the source file itself).
+  bool IncrementalRender = false;
+
+  /// The modification time of the newest profile or object input, used to
+  /// decide whether an existing view file is up to date in -incremental mode.
+  sys::TimePoint<> NewestInputTime = sys::TimePoint<>::min();
+
   /// A cache for demangled symbols.
   DemangleCache DC;
 
@@ -351,8 +359,13 @@ std::unique_ptr<CoverageMapping> CodeCoverageTool::load() {
     if (modifiedTimeGT(ObjectFilename, PGOFilename))
       warning("profile data may be out of date - object is newer",
               ObjectFilename);
-  auto CoverageOrErr =
-      CoverageMapping::load(ObjectFilenames, PGOFilename, CoverageArches);
+  // Restrict loading to the requested sources (if any), so reporting on a
+  // few files of a large binary does not decode the whole coverage mapping.
+  SmallVector<StringRef, 8> SourceFileRefs;
+  for (const std::string &File : SourceFiles)
+    SourceFileRefs.push_back(File);
+  auto CoverageOrErr = CoverageMapping::load(ObjectFilenames, PGOFilename,
+                                             CoverageArches, SourceFileRefs);
   if (Error E = CoverageOrErr.takeError()) {
     error("Failed to load coverage: " + toString(std::move(E)),
           join(ObjectFilenames.begin(), ObjectFilenames.end(), ", "));
@@ -516,6 +529,29 @@ void CodeCoverageTool::writeSourceFileView(StringRef SourceFile,
                                            CoverageMapping *Coverage,
                                            CoveragePrinter *Printer,
                                            bool ShowFilenames) {
+  if (IncrementalRender) {
+    StringRef Extension =
+        ViewOpts.Format == CoverageViewOptions::OutputFormat::HTML ? "html"
+                                                                   : "txt";
+    std::string ViewPath = Printer->getOutputPath(
+        SourceFile, Extension, /*InToplevel=*/false, /*Relative=*/false);
+    // Stat the on-disk source the same way getSourceFile() resolves it for
+    // rendering; a source we cannot stat must be re-rendered.
+    StringRef DiskSourceFile = SourceFile;
+    if (!RemappedFilenames.empty()) {
+      auto Loc = RemappedFilenames.find(SourceFile);
+      if (Loc != RemappedFilenames.end())
+        DiskSourceFile = Loc->second;
+    }
+    sys::fs::file_status ViewStatus, SourceStatus;
+    if (!sys::fs::status(ViewPath, ViewStatus) &&
+        !sys::fs::status(DiskSourceFile, SourceStatus) &&
+        ViewStatus.getLastModificationTime() >= NewestInputTime &&
+        ViewStatus.getLastModificationTime() >=
+            SourceStatus.getLastModificationTime())
+      return;
+  }
+
   auto View = createSourceFileView(SourceFile, *Coverage);
   if (!View) {
     warning("The file '" + SourceFile + "' isn't covered.");
@@ -827,6 +863,11 @@ int CodeCoverageTool::doShow(int argc, const char **argv,
   cl::alias ShowOutputDirectoryA("o", cl::desc("Alias for --output-dir"),
                                  cl::aliasopt(ShowOutputDirectory));
 
+  cl::opt<bool> Incremental(
+      "incremental", cl::Optional, cl::init(false),
+      cl::desc("In -output-dir mode, only re-render view files that are older "
+               "than the profile, the objects, or their source file"));
+
   cl::opt<uint32_t> TabSize(
       "tab-size", cl::init(2),
       cl::desc(
@@ -869,6 +910,20 @@ int CodeCoverageTool::doShow(int argc, const char **argv,
   }
 
   auto ModifiedTime = Status.getLastModificationTime();
+  if (Incremental) {
+    if (!ViewOpts.hasOutputDirectory()) {
+      warning("-incremental requires -output-dir; ignoring.");
+    } else {
+      // An existing view file is stale if any profile or object input is
+      // newer than it. Source file times are checked per file when rendering.
+      NewestInputTime = ModifiedTime;
+      for (StringRef ObjectFilename : ObjectFilenames)
+        if (!sys::fs::status(ObjectFilename, Status))
+          NewestInputTime =
+              std::max(NewestInputTime, Status.getLastModificationTime());
+      IncrementalRender = true;
+    }
+  }
   std::string ModifiedTimeStr = to_string(ModifiedTime);
   size_t found = ModifiedTimeStr.rfind(':');
   ViewOpts.CreatedTimeStr = (found != std::string::npos)
@@ -55,31 +55,46 @@ Decorated(cl::Positional, cl::desc("<mangled>"), cl::ZeroOrMore);
 static cl::extrahelp
     HelpResponse("\nPass @FILE as argument to read options from FILE.\n");
 
-static std::string demangle(llvm::raw_ostream &OS, const std::string &Mangled) {
-  int Status;
+// Demangle 'MangledName' with a context that persists across calls: the
+// parser recycles its node arena on each reset and the output buffer only
+// ever grows, so filtering millions of symbols does not pay the
+// itaniumDemangle setup/teardown cost per symbol. Returns null on failure;
+// the returned string is owned by the context and valid until the next call.
+static const char *demangleWithContext(const char *MangledName) {
+  static ItaniumPartialDemangler Context;
+  static char *Buf = nullptr;
+  static size_t BufSize = 0;
+
+  if (Context.partialDemangle(MangledName))
+    return nullptr;
+  if (char *Demangled = Context.finishDemangle(Buf, &BufSize)) {
+    Buf = Demangled;
+    return Demangled;
+  }
+  return nullptr;
+}
 
+static std::string demangle(llvm::raw_ostream &OS, const std::string &Mangled) {
   const char *DecoratedStr = Mangled.c_str();
   if (StripUnderscore)
     if (DecoratedStr[0] == '_')
       ++DecoratedStr;
   size_t DecoratedLength = strlen(DecoratedStr);
 
-  char *Undecorated = nullptr;
+  const char *Undecorated = nullptr;
 
   if (Types ||
       ((DecoratedLength >= 2 && strncmp(DecoratedStr, "_Z", 2) == 0) ||
        (DecoratedLength >= 4 && strncmp(DecoratedStr, "___Z", 4) == 0)))
-    Undecorated = itaniumDemangle(DecoratedStr, nullptr, nullptr, &Status);
+    Undecorated = demangleWithContext(DecoratedStr);
 
   if (!Undecorated &&
       (DecoratedLength > 6 && strncmp(DecoratedStr, "__imp_", 6) == 0)) {
     OS << "import thunk for ";
-    Undecorated = itaniumDemangle(DecoratedStr + 6, nullptr, nullptr, &Status);
+    Undecorated = demangleWithContext(DecoratedStr + 6);
   }
 
-  std::string Result(Undecorated ? Undecorated : Mangled);
-  free(Undecorated);
-  return Result;
+  return Undecorated ? std::string(Undecorated) : Mangled;
 }
 
 // Split 'Source' on any character that fails to pass 'IsLegalChar'.  The
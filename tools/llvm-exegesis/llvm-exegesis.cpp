@@ -38,7 +38,14 @@
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/TargetSelect.h"
 #include <algorithm>
+#include <atomic>
 #include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace llvm {
 namespace exegesis {
@@ -154,6 +161,12 @@ static cl::opt<std::string> CpuName(
     cl::desc("cpu name to use for pfm counters, leave empty to autodetect"),
     cl::cat(Options), cl::init(""));
 
+static cl::opt<unsigned> BenchmarkThreads(
+    "benchmark-threads",
+    cl::desc("number of worker threads measuring snippets in parallel, each "
+             "pinned to its own core; 0 (the default) measures sequentially"),
+    cl::cat(BenchmarkOptions), cl::init(0));
+
 static cl::opt<bool>
     DumpObjectToDisk("dump-object-to-disk",
                      cl::desc("dumps the generated benchmark object to disk "
@@ -227,6 +240,52 @@ generateSnippets(const LLVMState &State, unsigned Opcode,
   return Generator->generateConfigurations(Instr, ForbiddenRegs);
 }
 
+// Best-effort: pin the calling thread to core `Core` so workers measuring in
+// parallel do not migrate onto each other's cores mid-snippet.
+static void pinThreadToCore(unsigned Core) {
+#ifdef __linux__
+  const unsigned NumCores = std::thread::hardware_concurrency();
+  cpu_set_t Set;
+  CPU_ZERO(&Set);
+  CPU_SET(NumCores ? Core % NumCores : Core, &Set);
+  (void)pthread_setaffinity_np(pthread_self(), sizeof(Set), &Set);
+#else
+  (void)Core;
+#endif
+}
+
+// Measures `Configurations` on BenchmarkThreads worker threads.  Each worker
+// is pinned to its own core and keeps a single BenchmarkRunner (and thus the
+// scratch space and target setup) alive across all the snippets it measures,
+// so per-snippet cost is just assembly and execution.  Results are collected
+// by configuration index and written out in the sequential order.
+static void runParallelBenchmarks(const LLVMState &State,
+                                  const std::vector<BenchmarkCode> &Configurations,
+                                  const SnippetRepetitor &Repetitor) {
+  std::vector<InstructionBenchmark> Results(Configurations.size());
+  std::atomic<size_t> NextConf{0};
+  const unsigned NumThreads =
+      std::min<size_t>(BenchmarkThreads, Configurations.size());
+  std::vector<std::thread> Workers;
+  Workers.reserve(NumThreads);
+  for (unsigned T = 0; T != NumThreads; ++T)
+    Workers.emplace_back([&, T] {
+      pinThreadToCore(T);
+      const std::unique_ptr<BenchmarkRunner> Runner =
+          State.getExegesisTarget().createBenchmarkRunner(BenchmarkMode, State);
+      if (!Runner)
+        report_fatal_error("cannot create benchmark runner");
+      for (size_t I = NextConf++; I < Configurations.size(); I = NextConf++)
+        Results[I] = Runner->runConfiguration(Configurations[I], NumRepetitions,
+                                              Repetitor,
+                                              /*DumpObjectToDisk=*/false);
+    });
+  for (std::thread &Worker : Workers)
+    Worker.join();
+  for (InstructionBenchmark &Result : Results)
+    ExitOnErr(Result.writeYaml(State, BenchmarkFile));
+}
+
 void benchmarkMain() {
 #ifndef HAVE_LIBPFM
   report_fatal_error(
@@ -272,12 +331,6 @@ void benchmarkMain() {
     Configurations = ExitOnErr(readSnippets(State, SnippetsFile));
   }
 
-  const std::unique_ptr<BenchmarkRunner> Runner =
-      State.getExegesisTarget().createBenchmarkRunner(BenchmarkMode, State);
-  if (!Runner) {
-    report_fatal_error("cannot create benchmark runner");
-  }
-
   if (NumRepetitions == 0)
     report_fatal_error("--num-repetitions must be greater than zero");
 
@@ -285,10 +338,24 @@ void benchmarkMain() {
   if (BenchmarkFile.empty())
     BenchmarkFile = "-";
 
-  for (const BenchmarkCode &Conf : Configurations) {
-    InstructionBenchmark Result = Runner->runConfiguration(
-        Conf, NumRepetitions, *Repetitor, DumpObjectToDisk);
-    ExitOnErr(Result.writeYaml(State, BenchmarkFile));
+  if (BenchmarkThreads > 0) {
+    // Parallel workers cannot interleave the per-snippet object dumps.
+    if (DumpObjectToDisk.getNumOccurrences() && DumpObjectToDisk)
+      report_fatal_error(
+          "--dump-object-to-disk is incompatible with --benchmark-threads");
+    runParallelBenchmarks(State, Configurations, *Repetitor);
+  } else {
+    const std::unique_ptr<BenchmarkRunner> Runner =
+        State.getExegesisTarget().createBenchmarkRunner(BenchmarkMode, State);
+    if (!Runner) {
+      report_fatal_error("cannot create benchmark runner");
+    }
+
+    for (const BenchmarkCode &Conf : Configurations) {
+      InstructionBenchmark Result = Runner->runConfiguration(
+          Conf, NumRepetitions, *Repetitor, DumpObjectToDisk);
+      ExitOnErr(Result.writeYaml(State, BenchmarkFile));
+    }
   }
   exegesis::pfm::pfmTerminate();
 }
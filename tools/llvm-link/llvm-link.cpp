@@ -26,8 +26,10 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/SystemUtils.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/WithColor.h"
@@ -139,6 +141,35 @@ static std::unique_ptr<Module> loadFile(const char *argv0,
   return Result;
 }
 
+// Variant of loadFile for inputs whose bytes have already been read, so the
+// (thread-safe) file I/O can be overlapped across inputs while parsing stays
+// on the linking thread.
+static std::unique_ptr<Module> loadModuleFromBuffer(
+    const char *argv0, std::unique_ptr<MemoryBuffer> Buffer,
+    LLVMContext &Context, bool MaterializeMetadata = true) {
+  SMDiagnostic Err;
+  if (Verbose)
+    errs() << "Loading '" << Buffer->getBufferIdentifier() << "'\n";
+  std::unique_ptr<Module> Result;
+  if (DisableLazyLoad)
+    Result = parseIR(Buffer->getMemBufferRef(), Err, Context);
+  else
+    Result =
+        getLazyIRModule(std::move(Buffer), Err, Context, !MaterializeMetadata);
+
+  if (!Result) {
+    Err.print(argv0, errs());
+    return nullptr;
+  }
+
+  if (MaterializeMetadata) {
+    ExitOnErr(Result->materializeMetadata());
+    UpgradeDebugInfo(*Result);
+  }
+
+  return Result;
+}
+
 namespace {
 
 /// Helper to load on demand a Module from file and cache it for subsequent
@@ -279,8 +310,56 @@ static bool linkFiles(const char *argv0, LLVMContext &Context, Linker &L,
   unsigned ApplicableFlags = Flags & Linker::Flags::OverrideFromSrc;
   // Similar to some flags, internalization doesn't apply to the first file.
   bool InternalizeLinkedSymbols = false;
-  for (const auto &File : Files) {
-    std::unique_ptr<Module> M = loadFile(argv0, File, Context);
+
+  // Read all inputs up front on a thread pool. Parsing and linking have to
+  // stay on this thread because every module is created in the destination
+  // context, but with many small inputs the file I/O dominates and overlaps
+  // cleanly.
+  std::vector<std::unique_ptr<MemoryBuffer>> Buffers(Files.size());
+  std::vector<std::string> ReadErrors(Files.size());
+  auto ReadFile = [&Files, &Buffers, &ReadErrors](size_t I) {
+    ErrorOr<std::unique_ptr<MemoryBuffer>> BufferOrErr =
+        MemoryBuffer::getFileOrSTDIN(Files[I]);
+    if (BufferOrErr)
+      Buffers[I] = std::move(*BufferOrErr);
+    else
+      ReadErrors[I] = BufferOrErr.getError().message();
+  };
+  if (Files.size() < 2) {
+    for (size_t I = 0, E = Files.size(); I != E; ++I)
+      ReadFile(I);
+  } else {
+    ThreadPool Pool;
+    for (size_t I = 0, E = Files.size(); I != E; ++I)
+      Pool.async(ReadFile, I);
+    Pool.wait();
+  }
+
+  // If a module summary index is supplied, load it once so linkInModule can
+  // treat local functions/variables as exported and promote if necessary.
+  std::unique_ptr<ModuleSummaryIndex> Index;
+  if (!SummaryIndex.empty()) {
+    Index = ExitOnErr(llvm::getModuleSummaryIndexForFile(SummaryIndex));
+
+    // Conservatively mark all internal values as promoted, since this tool
+    // does not do the ThinLink that would normally determine what values to
+    // promote.
+    for (auto &I : *Index) {
+      for (auto &S : I.second.SummaryList) {
+        if (GlobalValue::isLocalLinkage(S->linkage()))
+          S->setLinkage(GlobalValue::ExternalLinkage);
+      }
+    }
+  }
+
+  for (size_t FileIdx = 0, FileEnd = Files.size(); FileIdx != FileEnd;
+       ++FileIdx) {
+    const std::string &File = Files[FileIdx];
+    std::unique_ptr<Module> M;
+    if (Buffers[FileIdx])
+      M = loadModuleFromBuffer(argv0, std::move(Buffers[FileIdx]), Context);
+    else
+      errs() << argv0 << ": " << File << ": " << ReadErrors[FileIdx] << "\n";
     if (!M.get()) {
       errs() << argv0 << ": ";
       WithColor::error() << " loading file '" << File << "'\n";
@@ -296,26 +375,9 @@ static bool linkFiles(const char *argv0, LLVMContext &Context, Linker &L,
       return false;
     }
 
-    // If a module summary index is supplied, load it so linkInModule can treat
-    // local functions/variables as exported and promote if necessary.
-    if (!SummaryIndex.empty()) {
-      std::unique_ptr<ModuleSummaryIndex> Index =
-          ExitOnErr(llvm::getModuleSummaryIndexForFile(SummaryIndex));
-
-      // Conservatively mark all internal values as promoted, since this tool
-      // does not do the ThinLink that would normally determine what values to
-      // promote.
-      for (auto &I : *Index) {
-        for (auto &S : I.second.SummaryList) {
-          if (GlobalValue::isLocalLinkage(S->linkage()))
-            S->setLinkage(GlobalValue::ExternalLinkage);
-        }
-      }
-
-      // Promotion
-      if (renameModuleForThinLTO(*M, *Index))
-        return true;
-    }
+    // Promotion
+    if (Index && renameModuleForThinLTO(*M, *Index))
+      return true;
 
     if (Verbose)
       errs() << "Linking in '" << File << "'\n";
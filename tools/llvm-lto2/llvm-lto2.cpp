@@ -49,6 +49,16 @@ static cl::opt<std::string> OutputFilename("o", cl::Required,
 static cl::opt<std::string> CacheDir("cache-dir", cl::desc("Cache Directory"),
                                      cl::value_desc("directory"));
 
+static cl::opt<bool>
+    CacheCompression("cache-compression",
+                     cl::desc("Compress cache entries on disk"),
+                     cl::init(false));
+
+static cl::opt<std::string>
+    IRCacheDir("ir-cache-dir",
+               cl::desc("Post-import optimized IR cache directory"),
+               cl::value_desc("directory"));
+
 static cl::opt<std::string> OptPipeline("opt-pipeline",
                                         cl::desc("Optimizer Pipeline"),
                                         cl::value_desc("pipeline"));
@@ -243,6 +253,7 @@ static int run(int argc, char **argv) {
   // Run a custom pipeline, if asked for.
   Conf.OptPipeline = OptPipeline;
   Conf.AAPipeline = AAPipeline;
+  Conf.IRCacheDir = IRCacheDir;
 
   Conf.OptLevel = OptLevel - '0';
   Conf.UseNewPM = UseNewPM;
@@ -344,7 +355,8 @@ static int run(int argc, char **argv) {
 
   NativeObjectCache Cache;
   if (!CacheDir.empty())
-    Cache = check(localCache(CacheDir, AddBuffer), "failed to create cache");
+    Cache = check(localCache(CacheDir, AddBuffer, CacheCompression),
+                  "failed to create cache");
 
   check(Lto.run(AddStream, Cache), "LTO::run failed");
   return 0;
@@ -38,38 +38,30 @@ static bool PrintInsts(const MCDisassembler &DisAsm,
                        const MCSubtargetInfo &STI) {
   ArrayRef<uint8_t> Data(Bytes.first.data(), Bytes.first.size());
 
-  // Disassemble it to strings.
-  uint64_t Size;
-  uint64_t Index;
+  // Disassemble the whole range in one pass; the base address of 0 makes
+  // each entry's address double as its index into the input bytes.
+  std::vector<MCDisassembler::DecodedInst> Insts;
+  DisAsm.decodeRange(Data, 0, Insts);
 
-  for (Index = 0; Index < Bytes.first.size(); Index += Size) {
-    MCInst Inst;
-
-    MCDisassembler::DecodeStatus S;
-    S = DisAsm.getInstruction(Inst, Size, Data.slice(Index), Index,
-                              /*REMOVE*/ nulls(), nulls());
-    switch (S) {
+  for (const MCDisassembler::DecodedInst &DI : Insts) {
+    switch (DI.Status) {
     case MCDisassembler::Fail:
-      SM.PrintMessage(SMLoc::getFromPointer(Bytes.second[Index]),
+      SM.PrintMessage(SMLoc::getFromPointer(Bytes.second[DI.Address]),
                       SourceMgr::DK_Warning,
                       "invalid instruction encoding");
       // Don't try to resynchronise the stream in a block
       if (InAtomicBlock)
         return true;
-
-      if (Size == 0)
-        Size = 1; // skip illegible bytes
-
       break;
 
     case MCDisassembler::SoftFail:
-      SM.PrintMessage(SMLoc::getFromPointer(Bytes.second[Index]),
+      SM.PrintMessage(SMLoc::getFromPointer(Bytes.second[DI.Address]),
                       SourceMgr::DK_Warning,
                       "potentially undefined instruction encoding");
       LLVM_FALLTHROUGH;
 
     case MCDisassembler::Success:
-      Streamer.EmitInstruction(Inst, STI);
+      Streamer.EmitInstruction(DI.Inst, STI);
       break;
     }
   }
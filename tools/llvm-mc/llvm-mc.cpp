@@ -170,6 +170,12 @@ static cl::opt<bool> LexMasmIntegers(
 static cl::opt<bool> NoExecStack("no-exec-stack",
                                  cl::desc("File doesn't need an exec stack"));
 
+static cl::opt<bool> FastParse(
+    "fast-parse",
+    cl::desc("Restrict the input to the machine-generated assembly dialect "
+             "(no macros, no conditional assembly) and skip the associated "
+             "parser machinery"));
+
 enum ActionType {
   AC_AsLex,
   AC_Assemble,
@@ -296,6 +302,7 @@ static int AssembleInput(const char *ProgName, const Target *TheTarget,
   if(SymbolResult)
     return SymbolResult;
   Parser->setShowParsedOperands(ShowInstOperands);
+  Parser->setFastParse(FastParse);
   Parser->setTargetParser(*TAP);
   Parser->getLexer().setLexMasmIntegers(LexMasmIntegers);
 
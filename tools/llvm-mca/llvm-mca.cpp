@@ -32,6 +32,7 @@
 #include "Views/SchedulerStatistics.h"
 #include "Views/SummaryView.h"
 #include "Views/TimelineView.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/MC/MCAsmBackend.h"
 #include "llvm/MC/MCAsmInfo.h"
 #include "llvm/MC/MCCodeEmitter.h"
@@ -59,6 +60,7 @@
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/WithColor.h"
+#include <cstdio>
 
 using namespace llvm;
 
@@ -213,6 +215,13 @@ static cl::opt<bool> ShowEncoding(
     cl::desc("Print encoding information in the instruction info view"),
     cl::cat(ViewOptions), cl::init(false));
 
+static cl::opt<bool> ServerMode(
+    "server",
+    cl::desc("Serve analysis requests read from stdin, delimited by lines "
+             "containing only '---', until EOF. Target setup and instruction "
+             "descriptors stay warm across requests"),
+    cl::cat(ToolOptions), cl::init(false));
+
 namespace {
 
 const Target *getTarget(const char *ProgName) {
@@ -284,6 +293,20 @@ static bool runPipeline(mca::Pipeline &P) {
   return true;
 }
 
+// Reads the next server mode analysis request from stdin into Request.
+// Requests are delimited by a line containing only "---"; the last request may
+// be terminated by EOF instead. Returns false once stdin is exhausted.
+static bool readAnalysisRequest(std::string &Request) {
+  Request.clear();
+  char Line[4096];
+  while (std::fgets(Line, sizeof(Line), stdin)) {
+    if (StringRef(Line).rtrim() == "---")
+      return true;
+    Request += Line;
+  }
+  return !Request.empty();
+}
+
 int main(int argc, char **argv) {
   InitLLVM X(argc, argv);
 
@@ -313,10 +336,18 @@ int main(int argc, char **argv) {
   // For safety, reconstruct the Triple object.
   Triple TheTriple(TripleName);
 
-  ErrorOr<std::unique_ptr<MemoryBuffer>> BufferPtr =
-      MemoryBuffer::getFileOrSTDIN(InputFilename);
-  if (std::error_code EC = BufferPtr.getError()) {
-    WithColor::error() << InputFilename << ": " << EC.message() << '\n';
+  // In server mode the input is read one request at a time from stdin, after
+  // the target has been set up.
+  ErrorOr<std::unique_ptr<MemoryBuffer>> BufferPtr = std::error_code();
+  if (!ServerMode) {
+    BufferPtr = MemoryBuffer::getFileOrSTDIN(InputFilename);
+    if (std::error_code EC = BufferPtr.getError()) {
+      WithColor::error() << InputFilename << ": " << EC.message() << '\n';
+      return 1;
+    }
+  } else if (InputFilename != "-") {
+    WithColor::error() << "-server reads requests from stdin and cannot be "
+                          "combined with an input file.\n";
     return 1;
   }
 
@@ -356,75 +387,24 @@ int main(int argc, char **argv) {
   std::unique_ptr<MCAsmInfo> MAI(TheTarget->createMCAsmInfo(*MRI, TripleName));
   assert(MAI && "Unable to create target asm info!");
 
-  MCObjectFileInfo MOFI;
-  SourceMgr SrcMgr;
-
-  // Tell SrcMgr about this buffer, which is what the parser will pick up.
-  SrcMgr.AddNewSourceBuffer(std::move(*BufferPtr), SMLoc());
-
-  MCContext Ctx(MAI.get(), MRI.get(), &MOFI, &SrcMgr);
-
-  MOFI.InitMCObjectFileInfo(TheTriple, /* PIC= */ false, Ctx);
-
-  std::unique_ptr<buffer_ostream> BOS;
-
   std::unique_ptr<MCInstrInfo> MCII(TheTarget->createMCInstrInfo());
 
   std::unique_ptr<MCInstrAnalysis> MCIA(
       TheTarget->createMCInstrAnalysis(MCII.get()));
 
-  // Parse the input and create CodeRegions that llvm-mca can analyze.
-  mca::AsmCodeRegionGenerator CRG(*TheTarget, SrcMgr, Ctx, *MAI, *STI, *MCII);
-  Expected<const mca::CodeRegions &> RegionsOrErr = CRG.parseCodeRegions();
-  if (!RegionsOrErr) {
-    if (auto Err =
-            handleErrors(RegionsOrErr.takeError(), [](const StringError &E) {
-              WithColor::error() << E.getMessage() << '\n';
-            })) {
-      // Default case.
-      WithColor::error() << toString(std::move(Err)) << '\n';
-    }
-    return 1;
-  }
-  const mca::CodeRegions &Regions = *RegionsOrErr;
-
-  // Early exit if errors were found by the code region parsing logic.
-  if (!Regions.isValid())
-    return 1;
-
-  if (Regions.empty()) {
-    WithColor::error() << "no assembly instructions found.\n";
-    return 1;
-  }
-
   // Now initialize the output file.
   auto OF = getOutputStream();
   if (std::error_code EC = OF.getError()) {
     WithColor::error() << EC.message() << '\n';
     return 1;
   }
-
-  unsigned AssemblerDialect = CRG.getAssemblerDialect();
-  if (OutputAsmVariant >= 0)
-    AssemblerDialect = static_cast<unsigned>(OutputAsmVariant);
-  std::unique_ptr<MCInstPrinter> IP(TheTarget->createMCInstPrinter(
-      Triple(TripleName), AssemblerDialect, *MAI, *MCII, *MRI));
-  if (!IP) {
-    WithColor::error()
-        << "unable to create instruction printer for target triple '"
-        << TheTriple.normalize() << "' with assembly variant "
-        << AssemblerDialect << ".\n";
-    return 1;
-  }
-
-  // Set the display preference for hex vs. decimal immediates.
-  IP->setPrintImmHex(PrintImmHex);
-
   std::unique_ptr<ToolOutputFile> TOF = std::move(*OF);
 
   const MCSchedModel &SM = STI->getSchedModel();
 
-  // Create an instruction builder.
+  // Create an instruction builder. It outlives any one input buffer so that,
+  // in server mode, instruction descriptors computed for one request are
+  // reused by later requests.
   mca::InstrBuilder IB(*STI, *MCII, *MRI, MCIA.get());
 
   // Create a context to control ownership of the pipeline hardware.
@@ -434,132 +414,212 @@ int main(int argc, char **argv) {
                           RegisterFileSize, LoadQueueSize, StoreQueueSize,
                           AssumeNoAlias, EnableBottleneckAnalysis);
 
-  // Number each region in the sequence.
-  unsigned RegionIdx = 0;
+  // Parse and simulate a single input buffer. State constructed above is
+  // shared across calls; state tied to the lifetime of the parsed MCInsts
+  // lives inside.
+  auto AnalyzeBuffer = [&](std::unique_ptr<MemoryBuffer> Buffer) -> int {
+    // Variant descriptors are keyed by MCInst address; they must not survive
+    // the buffer that owns those instructions.
+    IB.clear();
 
-  std::unique_ptr<MCCodeEmitter> MCE(
-      TheTarget->createMCCodeEmitter(*MCII, *MRI, Ctx));
+    MCObjectFileInfo MOFI;
+    SourceMgr SrcMgr;
 
-  std::unique_ptr<MCAsmBackend> MAB(TheTarget->createMCAsmBackend(
-      *STI, *MRI, InitMCTargetOptionsFromFlags()));
+    // Tell SrcMgr about this buffer, which is what the parser will pick up.
+    SrcMgr.AddNewSourceBuffer(std::move(Buffer), SMLoc());
 
-  for (const std::unique_ptr<mca::CodeRegion> &Region : Regions) {
-    // Skip empty code regions.
-    if (Region->empty())
-      continue;
+    MCContext Ctx(MAI.get(), MRI.get(), &MOFI, &SrcMgr);
 
-    // Don't print the header of this region if it is the default region, and
-    // it doesn't have an end location.
-    if (Region->startLoc().isValid() || Region->endLoc().isValid()) {
-      TOF->os() << "\n[" << RegionIdx++ << "] Code Region";
-      StringRef Desc = Region->getDescription();
-      if (!Desc.empty())
-        TOF->os() << " - " << Desc;
-      TOF->os() << "\n\n";
-    }
+    MOFI.InitMCObjectFileInfo(TheTriple, /* PIC= */ false, Ctx);
 
-    // Lower the MCInst sequence into an mca::Instruction sequence.
-    ArrayRef<MCInst> Insts = Region->getInstructions();
-    mca::CodeEmitter CE(*STI, *MAB, *MCE, Insts);
-    std::vector<std::unique_ptr<mca::Instruction>> LoweredSequence;
-    for (const MCInst &MCI : Insts) {
-      Expected<std::unique_ptr<mca::Instruction>> Inst =
-          IB.createInstruction(MCI);
-      if (!Inst) {
-        if (auto NewE = handleErrors(
-                Inst.takeError(),
-                [&IP, &STI](const mca::InstructionError<MCInst> &IE) {
-                  std::string InstructionStr;
-                  raw_string_ostream SS(InstructionStr);
-                  WithColor::error() << IE.Message << '\n';
-                  IP->printInst(&IE.Inst, SS, "", *STI);
-                  SS.flush();
-                  WithColor::note()
-                      << "instruction: " << InstructionStr << '\n';
-                })) {
-          // Default case.
-          WithColor::error() << toString(std::move(NewE));
-        }
-        return 1;
+    std::unique_ptr<buffer_ostream> BOS;
+
+    // Parse the input and create CodeRegions that llvm-mca can analyze.
+    mca::AsmCodeRegionGenerator CRG(*TheTarget, SrcMgr, Ctx, *MAI, *STI, *MCII);
+    Expected<const mca::CodeRegions &> RegionsOrErr = CRG.parseCodeRegions();
+    if (!RegionsOrErr) {
+      if (auto Err =
+              handleErrors(RegionsOrErr.takeError(), [](const StringError &E) {
+                WithColor::error() << E.getMessage() << '\n';
+              })) {
+        // Default case.
+        WithColor::error() << toString(std::move(Err)) << '\n';
       }
+      return 1;
+    }
+    const mca::CodeRegions &Regions = *RegionsOrErr;
+
+    // Early exit if errors were found by the code region parsing logic.
+    if (!Regions.isValid())
+      return 1;
+
+    if (Regions.empty()) {
+      WithColor::error() << "no assembly instructions found.\n";
+      return 1;
+    }
 
-      LoweredSequence.emplace_back(std::move(Inst.get()));
+    unsigned AssemblerDialect = CRG.getAssemblerDialect();
+    if (OutputAsmVariant >= 0)
+      AssemblerDialect = static_cast<unsigned>(OutputAsmVariant);
+    std::unique_ptr<MCInstPrinter> IP(TheTarget->createMCInstPrinter(
+        Triple(TripleName), AssemblerDialect, *MAI, *MCII, *MRI));
+    if (!IP) {
+      WithColor::error()
+          << "unable to create instruction printer for target triple '"
+          << TheTriple.normalize() << "' with assembly variant "
+          << AssemblerDialect << ".\n";
+      return 1;
     }
 
-    mca::SourceMgr S(LoweredSequence, PrintInstructionTables ? 1 : Iterations);
+    // Set the display preference for hex vs. decimal immediates.
+    IP->setPrintImmHex(PrintImmHex);
 
-    if (PrintInstructionTables) {
-      //  Create a pipeline, stages, and a printer.
-      auto P = std::make_unique<mca::Pipeline>();
-      P->appendStage(std::make_unique<mca::EntryStage>(S));
-      P->appendStage(std::make_unique<mca::InstructionTables>(SM));
-      mca::PipelinePrinter Printer(*P);
+    // Number each region in the sequence.
+    unsigned RegionIdx = 0;
 
-      // Create the views for this pipeline, execute, and emit a report.
-      if (PrintInstructionInfoView) {
-        Printer.addView(std::make_unique<mca::InstructionInfoView>(
-            *STI, *MCII, CE, ShowEncoding, Insts, *IP));
+    std::unique_ptr<MCCodeEmitter> MCE(
+        TheTarget->createMCCodeEmitter(*MCII, *MRI, Ctx));
+
+    std::unique_ptr<MCAsmBackend> MAB(TheTarget->createMCAsmBackend(
+        *STI, *MRI, InitMCTargetOptionsFromFlags()));
+
+    for (const std::unique_ptr<mca::CodeRegion> &Region : Regions) {
+      // Skip empty code regions.
+      if (Region->empty())
+        continue;
+
+      // Don't print the header of this region if it is the default region, and
+      // it doesn't have an end location.
+      if (Region->startLoc().isValid() || Region->endLoc().isValid()) {
+        TOF->os() << "\n[" << RegionIdx++ << "] Code Region";
+        StringRef Desc = Region->getDescription();
+        if (!Desc.empty())
+          TOF->os() << " - " << Desc;
+        TOF->os() << "\n\n";
       }
-      Printer.addView(
-          std::make_unique<mca::ResourcePressureView>(*STI, *IP, Insts));
 
-      if (!runPipeline(*P))
-        return 1;
+      // Lower the MCInst sequence into an mca::Instruction sequence.
+      ArrayRef<MCInst> Insts = Region->getInstructions();
+      mca::CodeEmitter CE(*STI, *MAB, *MCE, Insts);
+      std::vector<std::unique_ptr<mca::Instruction>> LoweredSequence;
+      for (const MCInst &MCI : Insts) {
+        Expected<std::unique_ptr<mca::Instruction>> Inst =
+            IB.createInstruction(MCI);
+        if (!Inst) {
+          if (auto NewE = handleErrors(
+                  Inst.takeError(),
+                  [&IP, &STI](const mca::InstructionError<MCInst> &IE) {
+                    std::string InstructionStr;
+                    raw_string_ostream SS(InstructionStr);
+                    WithColor::error() << IE.Message << '\n';
+                    IP->printInst(&IE.Inst, SS, "", *STI);
+                    SS.flush();
+                    WithColor::note()
+                        << "instruction: " << InstructionStr << '\n';
+                  })) {
+            // Default case.
+            WithColor::error() << toString(std::move(NewE));
+          }
+          return 1;
+        }
 
-      Printer.printReport(TOF->os());
-      continue;
-    }
+        LoweredSequence.emplace_back(std::move(Inst.get()));
+      }
 
-    // Create a basic pipeline simulating an out-of-order backend.
-    auto P = MCA.createDefaultPipeline(PO, S);
-    mca::PipelinePrinter Printer(*P);
+      mca::SourceMgr S(LoweredSequence, PrintInstructionTables ? 1 : Iterations);
 
-    if (PrintSummaryView)
-      Printer.addView(
-          std::make_unique<mca::SummaryView>(SM, Insts, DispatchWidth));
+      if (PrintInstructionTables) {
+        //  Create a pipeline, stages, and a printer.
+        auto P = std::make_unique<mca::Pipeline>();
+        P->appendStage(std::make_unique<mca::EntryStage>(S));
+        P->appendStage(std::make_unique<mca::InstructionTables>(SM));
+        mca::PipelinePrinter Printer(*P);
 
-    if (EnableBottleneckAnalysis) {
-      Printer.addView(std::make_unique<mca::BottleneckAnalysis>(
-          *STI, *IP, Insts, S.getNumIterations()));
-    }
+        // Create the views for this pipeline, execute, and emit a report.
+        if (PrintInstructionInfoView) {
+          Printer.addView(std::make_unique<mca::InstructionInfoView>(
+              *STI, *MCII, CE, ShowEncoding, Insts, *IP));
+        }
+        Printer.addView(
+            std::make_unique<mca::ResourcePressureView>(*STI, *IP, Insts));
 
-    if (PrintInstructionInfoView)
-      Printer.addView(std::make_unique<mca::InstructionInfoView>(
-          *STI, *MCII, CE, ShowEncoding, Insts, *IP));
+        if (!runPipeline(*P))
+          return 1;
 
-    if (PrintDispatchStats)
-      Printer.addView(std::make_unique<mca::DispatchStatistics>());
+        Printer.printReport(TOF->os());
+        continue;
+      }
 
-    if (PrintSchedulerStats)
-      Printer.addView(std::make_unique<mca::SchedulerStatistics>(*STI));
+      // Create a basic pipeline simulating an out-of-order backend.
+      auto P = MCA.createDefaultPipeline(PO, S);
+      mca::PipelinePrinter Printer(*P);
 
-    if (PrintRetireStats)
-      Printer.addView(std::make_unique<mca::RetireControlUnitStatistics>(SM));
+      if (PrintSummaryView)
+        Printer.addView(
+            std::make_unique<mca::SummaryView>(SM, Insts, DispatchWidth));
 
-    if (PrintRegisterFileStats)
-      Printer.addView(std::make_unique<mca::RegisterFileStatistics>(*STI));
+      if (EnableBottleneckAnalysis) {
+        Printer.addView(std::make_unique<mca::BottleneckAnalysis>(
+            *STI, *IP, Insts, S.getNumIterations()));
+      }
 
-    if (PrintResourcePressureView)
-      Printer.addView(
-          std::make_unique<mca::ResourcePressureView>(*STI, *IP, Insts));
+      if (PrintInstructionInfoView)
+        Printer.addView(std::make_unique<mca::InstructionInfoView>(
+            *STI, *MCII, CE, ShowEncoding, Insts, *IP));
 
-    if (PrintTimelineView) {
-      unsigned TimelineIterations =
-          TimelineMaxIterations ? TimelineMaxIterations : 10;
-      Printer.addView(std::make_unique<mca::TimelineView>(
-          *STI, *IP, Insts, std::min(TimelineIterations, S.getNumIterations()),
-          TimelineMaxCycles));
-    }
+      if (PrintDispatchStats)
+        Printer.addView(std::make_unique<mca::DispatchStatistics>());
 
-    if (!runPipeline(*P))
-      return 1;
+      if (PrintSchedulerStats)
+        Printer.addView(std::make_unique<mca::SchedulerStatistics>(*STI));
 
-    Printer.printReport(TOF->os());
+      if (PrintRetireStats)
+        Printer.addView(std::make_unique<mca::RetireControlUnitStatistics>(SM));
 
-    // Clear the InstrBuilder internal state in preparation for another round.
-    IB.clear();
+      if (PrintRegisterFileStats)
+        Printer.addView(std::make_unique<mca::RegisterFileStatistics>(*STI));
+
+      if (PrintResourcePressureView)
+        Printer.addView(
+            std::make_unique<mca::ResourcePressureView>(*STI, *IP, Insts));
+
+      if (PrintTimelineView) {
+        unsigned TimelineIterations =
+            TimelineMaxIterations ? TimelineMaxIterations : 10;
+        Printer.addView(std::make_unique<mca::TimelineView>(
+            *STI, *IP, Insts, std::min(TimelineIterations, S.getNumIterations()),
+            TimelineMaxCycles));
+      }
+
+      if (!runPipeline(*P))
+        return 1;
+
+      Printer.printReport(TOF->os());
+
+      // Clear the InstrBuilder internal state in preparation for another round.
+      IB.clear();
+    }
+
+    return 0;
+  };
+
+  if (ServerMode) {
+    // Serve requests until stdin is exhausted. Each report is followed by a
+    // "---" line and a flush so that a driving process can detect completion.
+    // A malformed request only fails that request, not the server.
+    std::string Request;
+    while (readAnalysisRequest(Request)) {
+      AnalyzeBuffer(MemoryBuffer::getMemBufferCopy(Request, "<request>"));
+      TOF->os() << "---\n";
+      TOF->os().flush();
+    }
+    TOF->keep();
+    return 0;
   }
 
+  if (int Result = AnalyzeBuffer(std::move(*BufferPtr)))
+    return Result;
+
   TOF->keep();
   return 0;
 }
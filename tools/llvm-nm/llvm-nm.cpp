@@ -34,11 +34,15 @@
 #include "llvm/Support/Format.h"
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Program.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/WithColor.h"
 #include "llvm/Support/raw_ostream.h"
+#include <atomic>
 #include <vector>
 
 using namespace llvm;
@@ -156,6 +160,12 @@ bool MachOPrintSizeWarning = false;
 cl::opt<bool> SizeSort("size-sort", cl::desc("Sort symbols by size"),
                        cl::cat(NMCat));
 
+cl::opt<unsigned>
+    NumThreads("threads",
+               cl::desc("Process this many input files in parallel, keeping "
+                        "the output in input order (0 or 1 = sequential)"),
+               cl::init(1), cl::cat(NMCat));
+
 cl::opt<bool> WithoutAliases("without-aliases", cl::Hidden,
                              cl::desc("Exclude aliases from output"),
                              cl::cat(NMCat));
@@ -216,11 +226,16 @@ bool PrintAddress = true;
 
 bool MultipleFiles = false;
 
-bool HadError = false;
+std::atomic<bool> HadError{false};
 
 std::string ToolName;
 } // anonymous namespace
 
+// All symbol listing output goes through nmOuts() so that worker threads in
+// parallel mode can capture it per input file and emit it in input order.
+static LLVM_THREAD_LOCAL raw_ostream *OutStream = nullptr;
+static raw_ostream &nmOuts() { return OutStream ? *OutStream : outs(); }
+
 static void error(Twine Message, Twine Path = Twine()) {
   HadError = true;
   WithColor::error(errs(), ToolName) << Path << ": " << Message << ".\n";
@@ -341,8 +356,12 @@ static char isSymbolList64Bit(SymbolicFile &Obj) {
   return cast<ELFObjectFileBase>(Obj).getBytesInAddress() == 8;
 }
 
-static StringRef CurrentFilename;
-static std::vector<NMSymbol> SymbolList;
+static LLVM_THREAD_LOCAL StringRef CurrentFilename;
+// The symbols of the file currently being dumped. LLVM_THREAD_LOCAL only
+// supports POD types, so dumpSymbolNamesFromFile owns the actual list and
+// binds it here; each worker thread then accumulates, sorts and prints the
+// symbols of its own input file, like the state above.
+static LLVM_THREAD_LOCAL std::vector<NMSymbol> *SymbolListPtr = nullptr;
 
 static char getSymbolNMTypeChar(IRObjectFile &Obj, basic_symbol_iterator I);
 
@@ -430,22 +449,22 @@ static void darwinPrintSymbol(SymbolicFile &Obj, const NMSymbol &S,
 
   // If we are printing Mach-O symbols in hex do that and return.
   if (FormatMachOasHex) {
-    outs() << format(printFormat, NValue) << ' '
+    nmOuts() << format(printFormat, NValue) << ' '
            << format("%02x %02x %04x %08x", NType, NSect, NDesc, NStrx) << ' '
            << S.Name;
     if ((NType & MachO::N_TYPE) == MachO::N_INDR) {
-      outs() << " (indirect for ";
-      outs() << format(printFormat, NValue) << ' ';
+      nmOuts() << " (indirect for ";
+      nmOuts() << format(printFormat, NValue) << ' ';
       StringRef IndirectName;
       if (S.Sym.getRawDataRefImpl().p) {
         if (MachO->getIndirectName(S.Sym.getRawDataRefImpl(), IndirectName))
-          outs() << "?)";
+          nmOuts() << "?)";
         else
-          outs() << IndirectName << ")";
+          nmOuts() << IndirectName << ")";
       } else
-        outs() << S.IndirectName << ")";
+        nmOuts() << S.IndirectName << ")";
     }
-    outs() << "\n";
+    nmOuts() << "\n";
     return;
   }
 
@@ -454,51 +473,51 @@ static void darwinPrintSymbol(SymbolicFile &Obj, const NMSymbol &S,
       strcpy(SymbolAddrStr, printBlanks);
     if (Obj.isIR() && (NType & MachO::N_TYPE) == MachO::N_TYPE)
       strcpy(SymbolAddrStr, printDashes);
-    outs() << SymbolAddrStr << ' ';
+    nmOuts() << SymbolAddrStr << ' ';
   }
 
   switch (NType & MachO::N_TYPE) {
   case MachO::N_UNDF:
     if (NValue != 0) {
-      outs() << "(common) ";
+      nmOuts() << "(common) ";
       if (MachO::GET_COMM_ALIGN(NDesc) != 0)
-        outs() << "(alignment 2^" << (int)MachO::GET_COMM_ALIGN(NDesc) << ") ";
+        nmOuts() << "(alignment 2^" << (int)MachO::GET_COMM_ALIGN(NDesc) << ") ";
     } else {
       if ((NType & MachO::N_TYPE) == MachO::N_PBUD)
-        outs() << "(prebound ";
+        nmOuts() << "(prebound ";
       else
-        outs() << "(";
+        nmOuts() << "(";
       if ((NDesc & MachO::REFERENCE_TYPE) ==
           MachO::REFERENCE_FLAG_UNDEFINED_LAZY)
-        outs() << "undefined [lazy bound]) ";
+        nmOuts() << "undefined [lazy bound]) ";
       else if ((NDesc & MachO::REFERENCE_TYPE) ==
                MachO::REFERENCE_FLAG_PRIVATE_UNDEFINED_LAZY)
-        outs() << "undefined [private lazy bound]) ";
+        nmOuts() << "undefined [private lazy bound]) ";
       else if ((NDesc & MachO::REFERENCE_TYPE) ==
                MachO::REFERENCE_FLAG_PRIVATE_UNDEFINED_NON_LAZY)
-        outs() << "undefined [private]) ";
+        nmOuts() << "undefined [private]) ";
       else
-        outs() << "undefined) ";
+        nmOuts() << "undefined) ";
     }
     break;
   case MachO::N_ABS:
-    outs() << "(absolute) ";
+    nmOuts() << "(absolute) ";
     break;
   case MachO::N_INDR:
-    outs() << "(indirect) ";
+    nmOuts() << "(indirect) ";
     break;
   case MachO::N_SECT: {
     if (Obj.isIR()) {
       // For llvm bitcode files print out a fake section name using the values
       // use 1, 2 and 3 for section numbers as set above.
       if (NSect == 1)
-        outs() << "(LTO,CODE) ";
+        nmOuts() << "(LTO,CODE) ";
       else if (NSect == 2)
-        outs() << "(LTO,DATA) ";
+        nmOuts() << "(LTO,DATA) ";
       else if (NSect == 3)
-        outs() << "(LTO,RODATA) ";
+        nmOuts() << "(LTO,RODATA) ";
       else
-        outs() << "(?,?) ";
+        nmOuts() << "(?,?) ";
       break;
     }
     section_iterator Sec = SectionRef();
@@ -507,12 +526,12 @@ static void darwinPrintSymbol(SymbolicFile &Obj, const NMSymbol &S,
           MachO->getSymbolSection(S.Sym.getRawDataRefImpl());
       if (!SecOrErr) {
         consumeError(SecOrErr.takeError());
-        outs() << "(?,?) ";
+        nmOuts() << "(?,?) ";
         break;
       }
       Sec = *SecOrErr;
       if (Sec == MachO->section_end()) {
-        outs() << "(?,?) ";
+        nmOuts() << "(?,?) ";
         break;
       }
     } else {
@@ -523,70 +542,70 @@ static void darwinPrintSymbol(SymbolicFile &Obj, const NMSymbol &S,
     if (Expected<StringRef> NameOrErr = MachO->getSectionName(Ref))
       SectionName = *NameOrErr;
     StringRef SegmentName = MachO->getSectionFinalSegmentName(Ref);
-    outs() << "(" << SegmentName << "," << SectionName << ") ";
+    nmOuts() << "(" << SegmentName << "," << SectionName << ") ";
     break;
   }
   default:
-    outs() << "(?) ";
+    nmOuts() << "(?) ";
     break;
   }
 
   if (NType & MachO::N_EXT) {
     if (NDesc & MachO::REFERENCED_DYNAMICALLY)
-      outs() << "[referenced dynamically] ";
+      nmOuts() << "[referenced dynamically] ";
     if (NType & MachO::N_PEXT) {
       if ((NDesc & MachO::N_WEAK_DEF) == MachO::N_WEAK_DEF)
-        outs() << "weak private external ";
+        nmOuts() << "weak private external ";
       else
-        outs() << "private external ";
+        nmOuts() << "private external ";
     } else {
       if ((NDesc & MachO::N_WEAK_REF) == MachO::N_WEAK_REF ||
           (NDesc & MachO::N_WEAK_DEF) == MachO::N_WEAK_DEF) {
         if ((NDesc & (MachO::N_WEAK_REF | MachO::N_WEAK_DEF)) ==
             (MachO::N_WEAK_REF | MachO::N_WEAK_DEF))
-          outs() << "weak external automatically hidden ";
+          nmOuts() << "weak external automatically hidden ";
         else
-          outs() << "weak external ";
+          nmOuts() << "weak external ";
       } else
-        outs() << "external ";
+        nmOuts() << "external ";
     }
   } else {
     if (NType & MachO::N_PEXT)
-      outs() << "non-external (was a private external) ";
+      nmOuts() << "non-external (was a private external) ";
     else
-      outs() << "non-external ";
+      nmOuts() << "non-external ";
   }
 
   if (Filetype == MachO::MH_OBJECT) {
     if (NDesc & MachO::N_NO_DEAD_STRIP)
-      outs() << "[no dead strip] ";
+      nmOuts() << "[no dead strip] ";
     if ((NType & MachO::N_TYPE) != MachO::N_UNDF &&
         NDesc & MachO::N_SYMBOL_RESOLVER)
-      outs() << "[symbol resolver] ";
+      nmOuts() << "[symbol resolver] ";
     if ((NType & MachO::N_TYPE) != MachO::N_UNDF && NDesc & MachO::N_ALT_ENTRY)
-      outs() << "[alt entry] ";
+      nmOuts() << "[alt entry] ";
     if ((NType & MachO::N_TYPE) != MachO::N_UNDF && NDesc & MachO::N_COLD_FUNC)
-      outs() << "[cold func] ";
+      nmOuts() << "[cold func] ";
   }
 
   if ((NDesc & MachO::N_ARM_THUMB_DEF) == MachO::N_ARM_THUMB_DEF)
-    outs() << "[Thumb] ";
+    nmOuts() << "[Thumb] ";
 
   if ((NType & MachO::N_TYPE) == MachO::N_INDR) {
-    outs() << S.Name << " (for ";
+    nmOuts() << S.Name << " (for ";
     StringRef IndirectName;
     if (MachO) {
       if (S.Sym.getRawDataRefImpl().p) {
         if (MachO->getIndirectName(S.Sym.getRawDataRefImpl(), IndirectName))
-          outs() << "?)";
+          nmOuts() << "?)";
         else
-          outs() << IndirectName << ")";
+          nmOuts() << IndirectName << ")";
       } else
-        outs() << S.IndirectName << ")";
+        nmOuts() << S.IndirectName << ")";
     } else
-      outs() << "?)";
+      nmOuts() << "?)";
   } else
-    outs() << S.Name;
+    nmOuts() << S.Name;
 
   if ((Flags & MachO::MH_TWOLEVEL) == MachO::MH_TWOLEVEL &&
       (((NType & MachO::N_TYPE) == MachO::N_UNDF && NValue == 0) ||
@@ -594,21 +613,21 @@ static void darwinPrintSymbol(SymbolicFile &Obj, const NMSymbol &S,
     uint32_t LibraryOrdinal = MachO::GET_LIBRARY_ORDINAL(NDesc);
     if (LibraryOrdinal != 0) {
       if (LibraryOrdinal == MachO::EXECUTABLE_ORDINAL)
-        outs() << " (from executable)";
+        nmOuts() << " (from executable)";
       else if (LibraryOrdinal == MachO::DYNAMIC_LOOKUP_ORDINAL)
-        outs() << " (dynamically looked up)";
+        nmOuts() << " (dynamically looked up)";
       else {
         StringRef LibraryName;
         if (!MachO ||
             MachO->getLibraryShortNameByIndex(LibraryOrdinal - 1, LibraryName))
-          outs() << " (from bad library ordinal " << LibraryOrdinal << ")";
+          nmOuts() << " (from bad library ordinal " << LibraryOrdinal << ")";
         else
-          outs() << " (from " << LibraryName << ")";
+          nmOuts() << " (from " << LibraryName << ")";
       }
     }
   }
 
-  outs() << "\n";
+  nmOuts() << "\n";
 }
 
 // Table that maps Darwin's Mach-O stab constants to strings to allow printing.
@@ -678,11 +697,11 @@ static void darwinPrintStab(MachOObjectFile *MachO, const NMSymbol &S) {
     NDesc = STE.n_desc;
   }
 
-  outs() << format(" %02x %04x ", NSect, NDesc);
+  nmOuts() << format(" %02x %04x ", NSect, NDesc);
   if (const char *stabString = getDarwinStabString(NType))
-    outs() << format("%5.5s", stabString);
+    nmOuts() << format("%5.5s", stabString);
   else
-    outs() << format("   %02x", NType);
+    nmOuts() << format("   %02x", NType);
 }
 
 static Optional<std::string> demangle(StringRef Name, bool StripUnderscore) {
@@ -710,6 +729,7 @@ static bool symbolIsDefined(const NMSymbol &Sym) {
 static void sortAndPrintSymbolList(SymbolicFile &Obj, bool printName,
                                    const std::string &ArchiveName,
                                    const std::string &ArchitectureName) {
+  std::vector<NMSymbol> &SymbolList = *SymbolListPtr;
   if (!NoSort) {
     using Comparator = bool (*)(const NMSymbol &, const NMSymbol &);
     Comparator Cmp;
@@ -720,26 +740,30 @@ static void sortAndPrintSymbolList(SymbolicFile &Obj, bool printName,
     else
       Cmp = &compareSymbolName;
 
+    // The comparators only read the gathered symbols, so sort in parallel;
+    // the partitioning is deterministic, giving the same output as the
+    // sequential sort.
     if (ReverseSort)
-      llvm::sort(SymbolList, [=](const NMSymbol &A, const NMSymbol &B) -> bool {
-        return Cmp(B, A);
-      });
+      parallel::sort(parallel::par, SymbolList.begin(), SymbolList.end(),
+                     [=](const NMSymbol &A, const NMSymbol &B) -> bool {
+                       return Cmp(B, A);
+                     });
     else
-      llvm::sort(SymbolList, Cmp);
+      parallel::sort(parallel::par, SymbolList.begin(), SymbolList.end(), Cmp);
   }
 
   if (!PrintFileName) {
     if (OutputFormat == posix && MultipleFiles && printName) {
-      outs() << '\n' << CurrentFilename << ":\n";
+      nmOuts() << '\n' << CurrentFilename << ":\n";
     } else if (OutputFormat == bsd && MultipleFiles && printName) {
-      outs() << "\n" << CurrentFilename << ":\n";
+      nmOuts() << "\n" << CurrentFilename << ":\n";
     } else if (OutputFormat == sysv) {
-      outs() << "\n\nSymbols from " << CurrentFilename << ":\n\n";
+      nmOuts() << "\n\nSymbols from " << CurrentFilename << ":\n\n";
       if (isSymbolList64Bit(Obj))
-        outs() << "Name                  Value           Class        Type"
+        nmOuts() << "Name                  Value           Class        Type"
                << "         Size             Line  Section\n";
       else
-        outs() << "Name                  Value   Class        Type"
+        nmOuts() << "Name                  Value   Class        Type"
                << "         Size     Line  Section\n";
     }
   }
@@ -811,11 +835,11 @@ static void sortAndPrintSymbolList(SymbolicFile &Obj, bool printName,
         (!Global && ExternalOnly) || (Weak && NoWeakSymbols))
       continue;
     if (PrintFileName)
-      writeFileName(outs());
+      writeFileName(nmOuts());
     if ((JustSymbolName ||
          (UndefinedOnly && MachO && OutputFormat != darwin)) &&
         OutputFormat != posix) {
-      outs() << Name << "\n";
+      nmOuts() << Name << "\n";
       continue;
     }
 
@@ -854,31 +878,31 @@ static void sortAndPrintSymbolList(SymbolicFile &Obj, bool printName,
       darwinPrintSymbol(Obj, S, SymbolAddrStr, printBlanks, printDashes,
                         printFormat);
     } else if (OutputFormat == posix) {
-      outs() << Name << " " << S.TypeChar << " " << SymbolAddrStr << " "
+      nmOuts() << Name << " " << S.TypeChar << " " << SymbolAddrStr << " "
              << (MachO ? "0" : SymbolSizeStr) << "\n";
     } else if (OutputFormat == bsd || (OutputFormat == darwin && !MachO)) {
       if (PrintAddress)
-        outs() << SymbolAddrStr << ' ';
+        nmOuts() << SymbolAddrStr << ' ';
       if (PrintSize)
-        outs() << SymbolSizeStr << ' ';
-      outs() << S.TypeChar;
+        nmOuts() << SymbolSizeStr << ' ';
+      nmOuts() << S.TypeChar;
       if (S.TypeChar == '-' && MachO)
         darwinPrintStab(MachO, S);
-      outs() << " " << Name;
+      nmOuts() << " " << Name;
       if (S.TypeChar == 'I' && MachO) {
-        outs() << " (indirect for ";
+        nmOuts() << " (indirect for ";
         if (S.Sym.getRawDataRefImpl().p) {
           StringRef IndirectName;
           if (MachO->getIndirectName(S.Sym.getRawDataRefImpl(), IndirectName))
-            outs() << "?)";
+            nmOuts() << "?)";
           else
-            outs() << IndirectName << ")";
+            nmOuts() << IndirectName << ")";
         } else
-          outs() << S.IndirectName << ")";
+          nmOuts() << S.IndirectName << ")";
       }
-      outs() << "\n";
+      nmOuts() << "\n";
     } else if (OutputFormat == sysv) {
-      outs() << left_justify(Name, 20) << "|" << SymbolAddrStr << "|   "
+      nmOuts() << left_justify(Name, 20) << "|" << SymbolAddrStr << "|   "
              << S.TypeChar << "  |" << right_justify(S.TypeName, 18) << "|"
              << SymbolSizeStr << "|     |" << S.SectionName << "\n";
     }
@@ -1185,6 +1209,7 @@ static void
 dumpSymbolNamesFromObject(SymbolicFile &Obj, bool printName,
                           const std::string &ArchiveName = std::string(),
                           const std::string &ArchitectureName = std::string()) {
+  std::vector<NMSymbol> &SymbolList = *SymbolListPtr;
   auto Symbols = Obj.symbols();
   if (DynamicSyms) {
     const auto *E = dyn_cast<ELFObjectFileBase>(&Obj);
@@ -1774,6 +1799,9 @@ static bool checkMachOAndArchFlags(SymbolicFile *O, std::string &Filename) {
 }
 
 static void dumpSymbolNamesFromFile(std::string &Filename) {
+  std::vector<NMSymbol> FileSymbols;
+  SymbolListPtr = &FileSymbols;
+
   ErrorOr<std::unique_ptr<MemoryBuffer>> BufferOrErr =
       MemoryBuffer::getFileOrSTDIN(Filename);
   if (error(BufferOrErr.getError(), Filename))
@@ -1794,7 +1822,7 @@ static void dumpSymbolNamesFromFile(std::string &Filename) {
       Archive::symbol_iterator I = A->symbol_begin();
       Archive::symbol_iterator E = A->symbol_end();
       if (I != E) {
-        outs() << "Archive map\n";
+        nmOuts() << "Archive map\n";
         for (; I != E; ++I) {
           Expected<Archive::Child> C = I->getMember();
           if (!C) {
@@ -1807,9 +1835,9 @@ static void dumpSymbolNamesFromFile(std::string &Filename) {
             break;
           }
           StringRef SymName = I->getName();
-          outs() << SymName << " in " << FileNameOrErr.get() << "\n";
+          nmOuts() << SymName << " in " << FileNameOrErr.get() << "\n";
         }
-        outs() << "\n";
+        nmOuts() << "\n";
       }
     }
 
@@ -1832,12 +1860,12 @@ static void dumpSymbolNamesFromFile(std::string &Filename) {
           if (!checkMachOAndArchFlags(O, Filename))
             return;
           if (!PrintFileName) {
-            outs() << "\n";
+            nmOuts() << "\n";
             if (isa<MachOObjectFile>(O)) {
-              outs() << Filename << "(" << O->getFileName() << ")";
+              nmOuts() << Filename << "(" << O->getFileName() << ")";
             } else
-              outs() << O->getFileName();
-            outs() << ":\n";
+              nmOuts() << O->getFileName();
+            nmOuts() << ":\n";
           }
           dumpSymbolNamesFromObject(*O, false, Filename);
         }
@@ -1871,7 +1899,7 @@ static void dumpSymbolNamesFromFile(std::string &Filename) {
                 if (PrintFileName)
                   ArchitectureName = I->getArchFlagName();
                 else
-                  outs() << "\n" << Obj.getFileName() << " (for architecture "
+                  nmOuts() << "\n" << Obj.getFileName() << " (for architecture "
                          << I->getArchFlagName() << ")"
                          << ":\n";
               }
@@ -1904,13 +1932,13 @@ static void dumpSymbolNamesFromFile(std::string &Filename) {
                     if (ArchFlags.size() > 1)
                       ArchitectureName = I->getArchFlagName();
                   } else {
-                    outs() << "\n" << A->getFileName();
-                    outs() << "(" << O->getFileName() << ")";
+                    nmOuts() << "\n" << A->getFileName();
+                    nmOuts() << "(" << O->getFileName() << ")";
                     if (ArchFlags.size() > 1) {
-                      outs() << " (for architecture " << I->getArchFlagName()
+                      nmOuts() << " (for architecture " << I->getArchFlagName()
                              << ")";
                     }
-                    outs() << ":\n";
+                    nmOuts() << ":\n";
                   }
                   dumpSymbolNamesFromObject(*O, false, ArchiveName,
                                             ArchitectureName);
@@ -1971,7 +1999,7 @@ static void dumpSymbolNamesFromFile(std::string &Filename) {
                 if (PrintFileName)
                   ArchiveName = A->getFileName();
                 else
-                  outs() << "\n" << A->getFileName() << "(" << O->getFileName()
+                  nmOuts() << "\n" << A->getFileName() << "(" << O->getFileName()
                          << ")"
                          << ":\n";
                 dumpSymbolNamesFromObject(*O, false, ArchiveName);
@@ -2006,11 +2034,11 @@ static void dumpSymbolNamesFromFile(std::string &Filename) {
             ArchitectureName = O.getArchFlagName();
         } else {
           if (moreThanOneArch)
-            outs() << "\n";
-          outs() << Obj.getFileName();
+            nmOuts() << "\n";
+          nmOuts() << Obj.getFileName();
           if (isa<MachOObjectFile>(Obj) && moreThanOneArch)
-            outs() << " (for architecture " << O.getArchFlagName() << ")";
-          outs() << ":\n";
+            nmOuts() << " (for architecture " << O.getArchFlagName() << ")";
+          nmOuts() << ":\n";
         }
         dumpSymbolNamesFromObject(Obj, false, ArchiveName, ArchitectureName);
       } else if (auto E = isNotObjectErrorInvalidFileType(
@@ -2038,15 +2066,15 @@ static void dumpSymbolNamesFromFile(std::string &Filename) {
               if (isa<MachOObjectFile>(F) && moreThanOneArch)
                 ArchitectureName = O.getArchFlagName();
             } else {
-              outs() << "\n" << A->getFileName();
+              nmOuts() << "\n" << A->getFileName();
               if (isa<MachOObjectFile>(F)) {
-                outs() << "(" << F->getFileName() << ")";
+                nmOuts() << "(" << F->getFileName() << ")";
                 if (moreThanOneArch)
-                  outs() << " (for architecture " << O.getArchFlagName()
+                  nmOuts() << " (for architecture " << O.getArchFlagName()
                          << ")";
               } else
-                outs() << ":" << F->getFileName();
-              outs() << ":\n";
+                nmOuts() << ":" << F->getFileName();
+              nmOuts() << ":\n";
             }
             dumpSymbolNamesFromObject(*F, false, ArchiveName, ArchitectureName);
           }
@@ -2130,7 +2158,27 @@ int main(int argc, char **argv) {
   if (NoDyldInfo && (AddDyldInfo || DyldInfoOnly))
     error("--no-dyldinfo can't be used with --add-dyldinfo or --dyldinfo-only");
 
-  llvm::for_each(InputFilenames, dumpSymbolNamesFromFile);
+  if (NumThreads <= 1 || InputFilenames.size() <= 1) {
+    llvm::for_each(InputFilenames, dumpSymbolNamesFromFile);
+  } else {
+    // Target registration and option parsing have already been paid for once;
+    // fan the files out over a pool, capture each file's listing in its own
+    // buffer, and emit the buffers in input order.  Diagnostics still go to
+    // stderr as each worker hits them.
+    std::vector<std::string> Listings(InputFilenames.size());
+    ThreadPool Pool(std::min<unsigned>(NumThreads, InputFilenames.size()));
+    for (size_t I = 0, E = InputFilenames.size(); I != E; ++I)
+      Pool.async([I, &Listings] {
+        raw_string_ostream OS(Listings[I]);
+        OutStream = &OS;
+        dumpSymbolNamesFromFile(*(InputFilenames.begin() + I));
+        OutStream = nullptr;
+        OS.flush();
+      });
+    Pool.wait();
+    for (const std::string &Listing : Listings)
+      outs() << Listing;
+  }
 
   if (HadError)
     return 1;
@@ -32,6 +32,8 @@
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/ErrorOr.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/Memory.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
@@ -53,9 +55,13 @@ using namespace object;
 using namespace ELF;
 using SectionPred = std::function<bool(const SectionBase &Sec)>;
 
+static bool isDebugSection(StringRef Name) {
+  return Name.startswith(".debug") || Name.startswith(".zdebug") ||
+         Name == ".gdb_index";
+}
+
 static bool isDebugSection(const SectionBase &Sec) {
-  return StringRef(Sec.Name).startswith(".debug") ||
-         StringRef(Sec.Name).startswith(".zdebug") || Sec.Name == ".gdb_index";
+  return isDebugSection(StringRef(Sec.Name));
 }
 
 static bool isDWOSection(const SectionBase &Sec) {
@@ -731,6 +737,281 @@ static Error handleArgs(const CopyConfig &Config, Object &Obj,
   return Error::success();
 }
 
+// The streaming fast path below writes the stripped output to a file without
+// materializing the whole image, so removing debug info from very large
+// binaries needs memory proportional to the section header table rather than
+// the file.  It only understands configurations that do nothing but remove
+// whole sections.
+static bool isPureRemovalConfig(const CopyConfig &Config) {
+  return (Config.OutputFormat == FileFormat::Unspecified ||
+          Config.OutputFormat == FileFormat::ELF) &&
+         !Config.OutputArch && Config.AddGnuDebugLink.empty() &&
+         Config.BuildIdLinkDir.empty() && !Config.ExtractPartition &&
+         Config.SplitDWO.empty() && Config.SymbolsPrefix.empty() &&
+         Config.AllocSectionsPrefix.empty() &&
+         Config.DiscardMode == DiscardType::None &&
+         !Config.NewSymbolVisibility && Config.AddSection.empty() &&
+         Config.DumpSection.empty() && Config.SymbolsToAdd.empty() &&
+         Config.KeepSection.empty() && Config.OnlySection.empty() &&
+         Config.SymbolsToGlobalize.empty() && Config.SymbolsToKeep.empty() &&
+         Config.SymbolsToLocalize.empty() && Config.SymbolsToRemove.empty() &&
+         Config.UnneededSymbolsToRemove.empty() &&
+         Config.SymbolsToWeaken.empty() &&
+         Config.SymbolsToKeepGlobal.empty() &&
+         Config.SectionsToRename.empty() &&
+         Config.SetSectionAlignment.empty() &&
+         Config.SetSectionFlags.empty() && Config.SymbolsToRename.empty() &&
+         !Config.EntryExpr && !Config.ExtractDWO &&
+         !Config.ExtractMainPartition && !Config.LocalizeHidden &&
+         !Config.OnlyKeepDebug && !Config.StripAll && !Config.StripAllGNU &&
+         !Config.StripDWO && !Config.StripNonAlloc && !Config.StripSections &&
+         !Config.StripUnneeded && !Config.Weaken &&
+         !Config.DecompressDebugSections &&
+         Config.CompressionType == DebugCompressionType::None &&
+         (Config.StripDebug || !Config.ToRemove.empty());
+}
+
+// Attempts to write the section-removal result of Config for In directly to
+// Config.OutputFilename, copying unmodified byte ranges straight from the
+// input mapping and materializing only the section header table and sections
+// whose contents must change (currently the symbol tables, whose st_shndx
+// fields are remapped).  Returns false without writing anything when the
+// input's shape is outside what the fast path handles, in which case the
+// caller falls back to the buffered writer.  The bulk ranges are written
+// sequentially through a raw_fd_ostream; copy_file_range does not apply here
+// because the input is an mmapped MemoryBuffer with no retained descriptor.
+template <class ELFT>
+static Expected<bool>
+streamSectionRemoval(const CopyConfig &Config,
+                     const object::ELFObjectFile<ELFT> &In) {
+  using Elf_Ehdr = typename ELFT::Ehdr;
+  using Elf_Shdr = typename ELFT::Shdr;
+  using Elf_Phdr = typename ELFT::Phdr;
+  using Elf_Sym = typename ELFT::Sym;
+
+  const ELFFile<ELFT> &EF = *In.getELFFile();
+  const uint8_t *Base = EF.base();
+  const Elf_Ehdr &Ehdr = *EF.getHeader();
+
+  // Extended section numbering keeps indices in the null section header;
+  // leave those rare files to the buffered path.
+  if (Ehdr.e_shoff == 0 || Ehdr.e_shnum == 0 ||
+      Ehdr.e_shstrndx == SHN_XINDEX)
+    return false;
+
+  Expected<typename ELFT::ShdrRange> SectionsOrErr = EF.sections();
+  if (!SectionsOrErr)
+    return SectionsOrErr.takeError();
+  ArrayRef<Elf_Shdr> Sections(SectionsOrErr->begin(), SectionsOrErr->end());
+
+  // Decide which sections go, by the same criteria handleArgs uses for pure
+  // removal configs.
+  std::vector<bool> Removed(Sections.size(), false);
+  for (size_t I = 1, E = Sections.size(); I != E; ++I) {
+    Expected<StringRef> NameOrErr = EF.getSectionName(&Sections[I]);
+    if (!NameOrErr)
+      return NameOrErr.takeError();
+    if (Config.ToRemove.matches(*NameOrErr) ||
+        (Config.StripDebug && isDebugSection(*NameOrErr)))
+      Removed[I] = true;
+  }
+  if (std::find(Removed.begin(), Removed.end(), true) == Removed.end())
+    return false;
+  // The buffered path owns the error for removing the section name table.
+  if (Removed[Ehdr.e_shstrndx])
+    return false;
+
+  // Every removed section must be unallocated file content past the end of
+  // all segments, so that no byte covered by a program header moves.
+  uint64_t SegmentsEnd = 0;
+  Expected<typename ELFT::PhdrRange> PhdrsOrErr = EF.program_headers();
+  if (!PhdrsOrErr)
+    return PhdrsOrErr.takeError();
+  for (const Elf_Phdr &Phdr : *PhdrsOrErr)
+    SegmentsEnd = std::max(SegmentsEnd,
+                           uint64_t(Phdr.p_offset) + uint64_t(Phdr.p_filesz));
+
+  uint64_t FirstMovedOffset = UINT64_MAX;
+  for (size_t I = 1, E = Sections.size(); I != E; ++I)
+    if (Removed[I] && Sections[I].sh_type != SHT_NOBITS)
+      FirstMovedOffset = std::min(FirstMovedOffset,
+                                  uint64_t(Sections[I].sh_offset));
+  if (FirstMovedOffset == UINT64_MAX) {
+    // Only SHT_NOBITS sections go away, so no file content moves at all;
+    // copy everything up to the end of the section content and append the
+    // renumbered header table there.
+    FirstMovedOffset = SegmentsEnd;
+    for (size_t I = 1, E = Sections.size(); I != E; ++I)
+      if (!Removed[I] && Sections[I].sh_type != SHT_NOBITS)
+        FirstMovedOffset =
+            std::max(FirstMovedOffset, uint64_t(Sections[I].sh_offset) +
+                                           uint64_t(Sections[I].sh_size));
+  }
+  if (FirstMovedOffset < SegmentsEnd ||
+      FirstMovedOffset > EF.getBufSize() ||
+      FirstMovedOffset < sizeof(Elf_Ehdr))
+    return false;
+
+  // Kept sections that would shift must be safe to move: not allocated, not
+  // groups (whose contents hold section indices we do not rewrite).
+  for (size_t I = 1, E = Sections.size(); I != E; ++I) {
+    const Elf_Shdr &Sec = Sections[I];
+    if (Removed[I]) {
+      if (Sec.sh_flags & SHF_ALLOC)
+        return false;
+      continue;
+    }
+    if (Sec.sh_type == SHT_GROUP)
+      return false;
+    if (Sec.sh_offset >= FirstMovedOffset && (Sec.sh_flags & SHF_ALLOC))
+      return false;
+    if (Sec.sh_type != SHT_NOBITS &&
+        uint64_t(Sec.sh_offset) + uint64_t(Sec.sh_size) > EF.getBufSize())
+      return false;
+    // Links into removed (or out-of-range) sections would dangle.
+    if (Sec.sh_link != SHN_UNDEF &&
+        (Sec.sh_link >= Sections.size() || Removed[Sec.sh_link]))
+      return false;
+    if ((Sec.sh_type == SHT_REL || Sec.sh_type == SHT_RELA) &&
+        Sec.sh_info != SHN_UNDEF &&
+        (Sec.sh_info >= Sections.size() || Removed[Sec.sh_info]))
+      return false;
+  }
+
+  // Map old section indices to new ones.
+  std::vector<uint32_t> NewIndex(Sections.size(), 0);
+  uint32_t NextIndex = 0;
+  for (size_t I = 0, E = Sections.size(); I != E; ++I)
+    if (!Removed[I])
+      NewIndex[I] = NextIndex++;
+
+  // Symbol tables hold section indices and are the one kind of section whose
+  // contents we rewrite.  A symbol defined relative to a removed section
+  // would need to be dropped, which is symbol surgery the buffered path does.
+  SmallVector<size_t, 2> SymTabIndices;
+  for (size_t I = 1, E = Sections.size(); I != E; ++I) {
+    if (Removed[I] || (Sections[I].sh_type != SHT_SYMTAB &&
+                       Sections[I].sh_type != SHT_DYNSYM))
+      continue;
+    Expected<typename ELFT::SymRange> SymsOrErr = EF.symbols(&Sections[I]);
+    if (!SymsOrErr)
+      return SymsOrErr.takeError();
+    // A symbol table before the first removed byte is emitted by the bulk
+    // copy, so it must not need any remapping at all.
+    const bool BulkCopied = Sections[I].sh_offset < FirstMovedOffset;
+    for (const Elf_Sym &Sym : *SymsOrErr) {
+      if (Sym.st_shndx == SHN_UNDEF || Sym.st_shndx >= SHN_LORESERVE)
+        continue;
+      if (Sym.st_shndx >= Sections.size() || Removed[Sym.st_shndx])
+        return false;
+      if (BulkCopied && NewIndex[Sym.st_shndx] != Sym.st_shndx)
+        return false;
+    }
+    if (!BulkCopied)
+      SymTabIndices.push_back(I);
+  }
+
+  // Lay out the kept sections: everything before the first removed byte keeps
+  // its offset, file content after it packs downward honoring alignment.
+  std::vector<uint64_t> NewOffset(Sections.size(), 0);
+  SmallVector<size_t, 16> MovedOrder;
+  for (size_t I = 1, E = Sections.size(); I != E; ++I) {
+    if (Removed[I])
+      continue;
+    if (Sections[I].sh_offset < FirstMovedOffset ||
+        Sections[I].sh_type == SHT_NOBITS)
+      NewOffset[I] = Sections[I].sh_offset;
+    else
+      MovedOrder.push_back(I);
+  }
+  llvm::sort(MovedOrder, [&](size_t A, size_t B) {
+    return Sections[A].sh_offset < Sections[B].sh_offset;
+  });
+  uint64_t CurOffset = FirstMovedOffset;
+  for (size_t I : MovedOrder) {
+    CurOffset = alignTo(CurOffset, std::max<uint64_t>(
+                                       1, Sections[I].sh_addralign));
+    NewOffset[I] = CurOffset;
+    CurOffset += Sections[I].sh_size;
+  }
+  const uint64_t NewShOff = alignTo(CurOffset, sizeof(typename ELFT::Addr));
+
+  std::error_code EC;
+  raw_fd_ostream OS(Config.OutputFilename, EC, sys::fs::OF_None);
+  if (EC)
+    return createFileError(Config.OutputFilename, EC);
+  const auto PadTo = [&OS](uint64_t Offset) {
+    assert(OS.tell() <= Offset && "Padding would overwrite data");
+    OS.write_zeros(Offset - OS.tell());
+  };
+
+  // Header with the section header table relocated.
+  Elf_Ehdr NewEhdr = Ehdr;
+  NewEhdr.e_shoff = NewShOff;
+  NewEhdr.e_shnum = NextIndex;
+  NewEhdr.e_shstrndx = NewIndex[Ehdr.e_shstrndx];
+  OS.write(reinterpret_cast<const char *>(&NewEhdr), sizeof(NewEhdr));
+
+  // Bulk-copy the unchanged region: program headers, all segment-covered
+  // content and every section that keeps its offset.
+  OS.write(reinterpret_cast<const char *>(Base) + sizeof(NewEhdr),
+           FirstMovedOffset - sizeof(NewEhdr));
+
+  const auto WriteSymTab = [&](size_t I) {
+    // Materialize the one kind of touched section: symbols with their
+    // st_shndx remapped to the new section numbering.
+    const Elf_Shdr &Sec = Sections[I];
+    std::vector<Elf_Sym> Syms(
+        reinterpret_cast<const Elf_Sym *>(Base + Sec.sh_offset),
+        reinterpret_cast<const Elf_Sym *>(Base + Sec.sh_offset + Sec.sh_size));
+    for (Elf_Sym &Sym : Syms)
+      if (Sym.st_shndx != SHN_UNDEF && Sym.st_shndx < SHN_LORESERVE)
+        Sym.st_shndx = NewIndex[Sym.st_shndx];
+    OS.write(reinterpret_cast<const char *>(Syms.data()),
+             Syms.size() * sizeof(Elf_Sym));
+  };
+  for (size_t I : MovedOrder) {
+    PadTo(NewOffset[I]);
+    if (llvm::is_contained(SymTabIndices, I))
+      WriteSymTab(I);
+    else
+      OS.write(reinterpret_cast<const char *>(Base) + Sections[I].sh_offset,
+               Sections[I].sh_size);
+  }
+
+  // Section header table over the new numbering and layout.
+  PadTo(NewShOff);
+  for (size_t I = 0, E = Sections.size(); I != E; ++I) {
+    if (Removed[I])
+      continue;
+    Elf_Shdr NewShdr = Sections[I];
+    NewShdr.sh_offset = NewOffset[I];
+    if (NewShdr.sh_link != SHN_UNDEF)
+      NewShdr.sh_link = NewIndex[NewShdr.sh_link];
+    if ((NewShdr.sh_type == SHT_REL || NewShdr.sh_type == SHT_RELA) &&
+        NewShdr.sh_info != SHN_UNDEF)
+      NewShdr.sh_info = NewIndex[NewShdr.sh_info];
+    OS.write(reinterpret_cast<const char *>(&NewShdr), sizeof(NewShdr));
+  }
+
+  if (OS.has_error())
+    return createFileError(Config.OutputFilename, OS.error());
+  return true;
+}
+
+static Expected<bool> tryStreamSectionRemoval(const CopyConfig &Config,
+                                              object::ELFObjectFileBase &In) {
+  if (auto *O = dyn_cast<ELFObjectFile<ELF32LE>>(&In))
+    return streamSectionRemoval(Config, *O);
+  if (auto *O = dyn_cast<ELFObjectFile<ELF64LE>>(&In))
+    return streamSectionRemoval(Config, *O);
+  if (auto *O = dyn_cast<ELFObjectFile<ELF32BE>>(&In))
+    return streamSectionRemoval(Config, *O);
+  if (auto *O = dyn_cast<ELFObjectFile<ELF64BE>>(&In))
+    return streamSectionRemoval(Config, *O);
+  return false;
+}
+
 static Error writeOutput(const CopyConfig &Config, Object &Obj, Buffer &Out,
                          ElfType OutputElfType) {
   std::unique_ptr<Writer> Writer =
@@ -769,6 +1050,19 @@ Error executeObjcopyOnRawBinary(const CopyConfig &Config, MemoryBuffer &In,
 
 Error executeObjcopyOnBinary(const CopyConfig &Config,
                              object::ELFObjectFileBase &In, Buffer &Out) {
+  // Pure section-removal requests against a real output file can usually be
+  // streamed instead of materialized; fall through to the buffered writer
+  // when the fast path declines.  Out names the final file only when we are
+  // not writing an archive member or stdout.
+  if (isPureRemovalConfig(Config) && Config.OutputFilename != "-" &&
+      Out.getName() == Config.OutputFilename) {
+    Expected<bool> Streamed = tryStreamSectionRemoval(Config, In);
+    if (!Streamed)
+      return createFileError(Config.InputFilename, Streamed.takeError());
+    if (*Streamed)
+      return Error::success();
+  }
+
   ELFReader Reader(&In, Config.ExtractPartition);
   std::unique_ptr<Object> Obj = Reader.create(!Config.SymbolsToAdd.empty());
   // Prefer OutputArch (-O<format>) if set, otherwise infer it from the input.
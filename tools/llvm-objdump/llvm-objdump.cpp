@@ -56,6 +56,7 @@
 #include "llvm/Support/Host.h"
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/StringSaver.h"
 #include "llvm/Support/TargetRegistry.h"
@@ -1009,9 +1010,18 @@ getRelocsMap(object::ObjectFile const &Obj) {
     std::vector<RelocationRef> &V = Ret[*Relocated];
     for (const RelocationRef &R : Sec.relocations())
       V.push_back(R);
-    // Sort relocations by address.
-    llvm::stable_sort(V, isRelocAddressLess);
   }
+  // Sort relocations by address. The per-section sorts are independent and
+  // only read mapped data, so run them concurrently; on large debug binaries
+  // they dominate the setup time.
+  std::vector<std::vector<RelocationRef> *> RelocVecs;
+  RelocVecs.reserve(Ret.size());
+  for (auto &KV : Ret)
+    RelocVecs.push_back(&KV.second);
+  parallel::for_each(parallel::par, RelocVecs.begin(), RelocVecs.end(),
+                     [](std::vector<RelocationRef> *V) {
+                       llvm::stable_sort(*V, isRelocAddressLess);
+                     });
   return Ret;
 }
 
@@ -1194,10 +1204,17 @@ static void disassembleObject(const Target *TheTarget, const ObjectFile *Obj,
   }
 
   // Sort all the symbols, this allows us to use a simple binary search to find
-  // a symbol near an address.
+  // a symbol near an address. The per-section sorts are independent, so run
+  // them concurrently.
   StringSet<> FoundDisasmFuncsSet;
+  std::vector<SectionSymbolsTy *> SymVecs;
+  SymVecs.reserve(AllSymbols.size());
   for (std::pair<const SectionRef, SectionSymbolsTy> &SecSyms : AllSymbols)
-    array_pod_sort(SecSyms.second.begin(), SecSyms.second.end());
+    SymVecs.push_back(&SecSyms.second);
+  parallel::for_each(parallel::par, SymVecs.begin(), SymVecs.end(),
+                     [](SectionSymbolsTy *Syms) {
+                       array_pod_sort(Syms->begin(), Syms->end());
+                     });
   array_pod_sort(AbsoluteSymbols.begin(), AbsoluteSymbols.end());
 
   for (const SectionRef &Section : ToolSectionFilter(*Obj)) {
@@ -24,9 +24,12 @@
 #include "llvm/Support/Format.h"
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/WithColor.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include <system_error>
 
@@ -50,12 +53,12 @@ static cl::opt<OutputFormatTy>
                                  clEnumValN(darwin, "m", "Darwin -m format")),
                       cl::init(berkeley), cl::cat(SizeCat));
 
-static bool BerkeleyHeaderPrinted = false;
+static LLVM_THREAD_LOCAL bool BerkeleyHeaderPrinted = false;
 static bool MoreThanOneFile = false;
-static uint64_t TotalObjectText = 0;
-static uint64_t TotalObjectData = 0;
-static uint64_t TotalObjectBss = 0;
-static uint64_t TotalObjectTotal = 0;
+static std::atomic<uint64_t> TotalObjectText{0};
+static std::atomic<uint64_t> TotalObjectData{0};
+static std::atomic<uint64_t> TotalObjectBss{0};
+static std::atomic<uint64_t> TotalObjectTotal{0};
 
 cl::opt<bool>
     DarwinLongFormat("l",
@@ -97,16 +100,27 @@ static cl::opt<bool>
 static cl::alias TotalSizesShort("t", cl::desc("Short for --totals"),
                                  cl::aliasopt(TotalSizes));
 
+static cl::opt<unsigned>
+    NumThreads("threads",
+               cl::desc("Process this many input files in parallel, keeping "
+                        "the output in input order (0 or 1 = sequential)"),
+               cl::init(1), cl::cat(SizeCat));
+
 static cl::list<std::string>
     InputFilenames(cl::Positional, cl::desc("<input files>"), cl::ZeroOrMore);
 
 static cl::extrahelp
     HelpResponse("\nPass @FILE as argument to read options from FILE.\n");
 
-static bool HadError = false;
+static std::atomic<bool> HadError{false};
 
 static std::string ToolName;
 
+// All size listing output goes through sizeOuts() so that worker threads in
+// parallel mode can capture it per input file and emit it in input order.
+static LLVM_THREAD_LOCAL raw_ostream *OutStream = nullptr;
+static raw_ostream &sizeOuts() { return OutStream ? *OutStream : outs(); }
+
 static void error(const Twine &Message, StringRef File) {
   HadError = true;
   WithColor::error(errs(), ToolName) << "'" << File << "': " << Message << "\n";
@@ -222,61 +236,61 @@ static void printDarwinSectionSizes(MachOObjectFile *MachO) {
   for (const auto &Load : MachO->load_commands()) {
     if (Load.C.cmd == MachO::LC_SEGMENT_64) {
       MachO::segment_command_64 Seg = MachO->getSegment64LoadCommand(Load);
-      outs() << "Segment " << Seg.segname << ": "
+      sizeOuts() << "Segment " << Seg.segname << ": "
              << format(fmt.str().c_str(), Seg.vmsize);
       if (DarwinLongFormat)
-        outs() << " (vmaddr 0x" << format("%" PRIx64, Seg.vmaddr) << " fileoff "
+        sizeOuts() << " (vmaddr 0x" << format("%" PRIx64, Seg.vmaddr) << " fileoff "
                << Seg.fileoff << ")";
-      outs() << "\n";
+      sizeOuts() << "\n";
       total += Seg.vmsize;
       uint64_t sec_total = 0;
       for (unsigned J = 0; J < Seg.nsects; ++J) {
         MachO::section_64 Sec = MachO->getSection64(Load, J);
         if (Filetype == MachO::MH_OBJECT)
-          outs() << "\tSection (" << format("%.16s", &Sec.segname) << ", "
+          sizeOuts() << "\tSection (" << format("%.16s", &Sec.segname) << ", "
                  << format("%.16s", &Sec.sectname) << "): ";
         else
-          outs() << "\tSection " << format("%.16s", &Sec.sectname) << ": ";
-        outs() << format(fmt.str().c_str(), Sec.size);
+          sizeOuts() << "\tSection " << format("%.16s", &Sec.sectname) << ": ";
+        sizeOuts() << format(fmt.str().c_str(), Sec.size);
         if (DarwinLongFormat)
-          outs() << " (addr 0x" << format("%" PRIx64, Sec.addr) << " offset "
+          sizeOuts() << " (addr 0x" << format("%" PRIx64, Sec.addr) << " offset "
                  << Sec.offset << ")";
-        outs() << "\n";
+        sizeOuts() << "\n";
         sec_total += Sec.size;
       }
       if (Seg.nsects != 0)
-        outs() << "\ttotal " << format(fmt.str().c_str(), sec_total) << "\n";
+        sizeOuts() << "\ttotal " << format(fmt.str().c_str(), sec_total) << "\n";
     } else if (Load.C.cmd == MachO::LC_SEGMENT) {
       MachO::segment_command Seg = MachO->getSegmentLoadCommand(Load);
       uint64_t Seg_vmsize = Seg.vmsize;
-      outs() << "Segment " << Seg.segname << ": "
+      sizeOuts() << "Segment " << Seg.segname << ": "
              << format(fmt.str().c_str(), Seg_vmsize);
       if (DarwinLongFormat)
-        outs() << " (vmaddr 0x" << format("%" PRIx32, Seg.vmaddr) << " fileoff "
+        sizeOuts() << " (vmaddr 0x" << format("%" PRIx32, Seg.vmaddr) << " fileoff "
                << Seg.fileoff << ")";
-      outs() << "\n";
+      sizeOuts() << "\n";
       total += Seg.vmsize;
       uint64_t sec_total = 0;
       for (unsigned J = 0; J < Seg.nsects; ++J) {
         MachO::section Sec = MachO->getSection(Load, J);
         if (Filetype == MachO::MH_OBJECT)
-          outs() << "\tSection (" << format("%.16s", &Sec.segname) << ", "
+          sizeOuts() << "\tSection (" << format("%.16s", &Sec.segname) << ", "
                  << format("%.16s", &Sec.sectname) << "): ";
         else
-          outs() << "\tSection " << format("%.16s", &Sec.sectname) << ": ";
+          sizeOuts() << "\tSection " << format("%.16s", &Sec.sectname) << ": ";
         uint64_t Sec_size = Sec.size;
-        outs() << format(fmt.str().c_str(), Sec_size);
+        sizeOuts() << format(fmt.str().c_str(), Sec_size);
         if (DarwinLongFormat)
-          outs() << " (addr 0x" << format("%" PRIx32, Sec.addr) << " offset "
+          sizeOuts() << " (addr 0x" << format("%" PRIx32, Sec.addr) << " offset "
                  << Sec.offset << ")";
-        outs() << "\n";
+        sizeOuts() << "\n";
         sec_total += Sec.size;
       }
       if (Seg.nsects != 0)
-        outs() << "\ttotal " << format(fmt.str().c_str(), sec_total) << "\n";
+        sizeOuts() << "\ttotal " << format(fmt.str().c_str(), sec_total) << "\n";
     }
   }
-  outs() << "total " << format(fmt.str().c_str(), total) << "\n";
+  sizeOuts() << "total " << format(fmt.str().c_str(), total) << "\n";
 }
 
 /// Print the summary sizes of the standard Mach-O segments in @p MachO.
@@ -346,10 +360,10 @@ static void printDarwinSegmentSizes(MachOObjectFile *MachO) {
   uint64_t total = total_text + total_data + total_objc + total_others;
 
   if (!BerkeleyHeaderPrinted) {
-    outs() << "__TEXT\t__DATA\t__OBJC\tothers\tdec\thex\n";
+    sizeOuts() << "__TEXT\t__DATA\t__OBJC\tothers\tdec\thex\n";
     BerkeleyHeaderPrinted = true;
   }
-  outs() << total_text << "\t" << total_data << "\t" << total_objc << "\t"
+  sizeOuts() << total_text << "\t" << total_data << "\t" << total_objc << "\t"
          << total_others << "\t" << total << "\t" << format("%" PRIx64, total)
          << "\t";
 }
@@ -408,7 +422,7 @@ static void printObjectSectionSizes(ObjectFile *Obj) {
         << "%" << max_addr_len << "s\n";
 
     // Print header
-    outs() << format(fmt.str().c_str(), static_cast<const char *>("section"),
+    sizeOuts() << format(fmt.str().c_str(), static_cast<const char *>("section"),
                      static_cast<const char *>("size"),
                      static_cast<const char *>("addr"));
     fmtbuf.clear();
@@ -431,13 +445,13 @@ static void printObjectSectionSizes(ObjectFile *Obj) {
 
       uint64_t size = Section.getSize();
       uint64_t addr = Section.getAddress();
-      outs() << format(fmt.str().c_str(), name_or_err->str().c_str(), size, addr);
+      sizeOuts() << format(fmt.str().c_str(), name_or_err->str().c_str(), size, addr);
     }
 
     if (ELFCommons) {
       uint64_t CommonSize = getCommonSize(Obj);
       total += CommonSize;
-      outs() << format(fmt.str().c_str(), std::string("*COM*").c_str(),
+      sizeOuts() << format(fmt.str().c_str(), std::string("*COM*").c_str(),
                        CommonSize, static_cast<uint64_t>(0));
     }
 
@@ -445,7 +459,7 @@ static void printObjectSectionSizes(ObjectFile *Obj) {
     fmtbuf.clear();
     fmt << "%-" << max_name_len << "s "
         << "%#" << max_size_len << radix_fmt << "\n";
-    outs() << format(fmt.str().c_str(), static_cast<const char *>("Total"),
+    sizeOuts() << format(fmt.str().c_str(), static_cast<const char *>("Total"),
                      total);
   } else {
     // The Berkeley format does not display individual section sizes. It
@@ -481,7 +495,7 @@ static void printObjectSectionSizes(ObjectFile *Obj) {
     }
 
     if (!BerkeleyHeaderPrinted) {
-      outs() << "   text\t"
+      sizeOuts() << "   text\t"
                 "   data\t"
                 "    bss\t"
                 "    "
@@ -496,11 +510,11 @@ static void printObjectSectionSizes(ObjectFile *Obj) {
     fmt << "%#7" << radix_fmt << "\t"
         << "%#7" << radix_fmt << "\t"
         << "%#7" << radix_fmt << "\t";
-    outs() << format(fmt.str().c_str(), total_text, total_data, total_bss);
+    sizeOuts() << format(fmt.str().c_str(), total_text, total_data, total_bss);
     fmtbuf.clear();
     fmt << "%7" << (Radix == octal ? PRIo64 : PRIu64) << "\t"
         << "%7" PRIx64 "\t";
-    outs() << format(fmt.str().c_str(), total, total);
+    sizeOuts() << format(fmt.str().c_str(), total, total);
   }
 }
 
@@ -561,15 +575,15 @@ static void printFileSectionSizes(StringRef file) {
         if (!checkMachOAndArchFlags(o, file))
           return;
         if (OutputFormat == sysv)
-          outs() << o->getFileName() << "   (ex " << a->getFileName() << "):\n";
+          sizeOuts() << o->getFileName() << "   (ex " << a->getFileName() << "):\n";
         else if (MachO && OutputFormat == darwin)
-          outs() << a->getFileName() << "(" << o->getFileName() << "):\n";
+          sizeOuts() << a->getFileName() << "(" << o->getFileName() << "):\n";
         printObjectSectionSizes(o);
         if (OutputFormat == berkeley) {
           if (MachO)
-            outs() << a->getFileName() << "(" << o->getFileName() << ")\n";
+            sizeOuts() << a->getFileName() << "(" << o->getFileName() << ")\n";
           else
-            outs() << o->getFileName() << " (ex " << a->getFileName() << ")\n";
+            sizeOuts() << o->getFileName() << " (ex " << a->getFileName() << ")\n";
         }
       }
     }
@@ -593,18 +607,18 @@ static void printFileSectionSizes(StringRef file) {
               if (ObjectFile *o = dyn_cast<ObjectFile>(&*UO.get())) {
                 MachOObjectFile *MachO = dyn_cast<MachOObjectFile>(o);
                 if (OutputFormat == sysv)
-                  outs() << o->getFileName() << "  :\n";
+                  sizeOuts() << o->getFileName() << "  :\n";
                 else if (MachO && OutputFormat == darwin) {
                   if (MoreThanOneFile || ArchFlags.size() > 1)
-                    outs() << o->getFileName() << " (for architecture "
+                    sizeOuts() << o->getFileName() << " (for architecture "
                            << I->getArchFlagName() << "): \n";
                 }
                 printObjectSectionSizes(o);
                 if (OutputFormat == berkeley) {
                   if (!MachO || MoreThanOneFile || ArchFlags.size() > 1)
-                    outs() << o->getFileName() << " (for architecture "
+                    sizeOuts() << o->getFileName() << " (for architecture "
                            << I->getArchFlagName() << ")";
-                  outs() << "\n";
+                  sizeOuts() << "\n";
                 }
               }
             } else if (auto E = isNotObjectErrorInvalidFileType(
@@ -631,24 +645,24 @@ static void printFileSectionSizes(StringRef file) {
                 if (ObjectFile *o = dyn_cast<ObjectFile>(&*ChildOrErr.get())) {
                   MachOObjectFile *MachO = dyn_cast<MachOObjectFile>(o);
                   if (OutputFormat == sysv)
-                    outs() << o->getFileName() << "   (ex " << UA->getFileName()
+                    sizeOuts() << o->getFileName() << "   (ex " << UA->getFileName()
                            << "):\n";
                   else if (MachO && OutputFormat == darwin)
-                    outs() << UA->getFileName() << "(" << o->getFileName()
+                    sizeOuts() << UA->getFileName() << "(" << o->getFileName()
                            << ")"
                            << " (for architecture " << I->getArchFlagName()
                            << "):\n";
                   printObjectSectionSizes(o);
                   if (OutputFormat == berkeley) {
                     if (MachO) {
-                      outs() << UA->getFileName() << "(" << o->getFileName()
+                      sizeOuts() << UA->getFileName() << "(" << o->getFileName()
                              << ")";
                       if (ArchFlags.size() > 1)
-                        outs() << " (for architecture " << I->getArchFlagName()
+                        sizeOuts() << " (for architecture " << I->getArchFlagName()
                                << ")";
-                      outs() << "\n";
+                      sizeOuts() << "\n";
                     } else
-                      outs() << o->getFileName() << " (ex " << UA->getFileName()
+                      sizeOuts() << o->getFileName() << " (ex " << UA->getFileName()
                              << ")\n";
                   }
                 }
@@ -684,18 +698,18 @@ static void printFileSectionSizes(StringRef file) {
             if (ObjectFile *o = dyn_cast<ObjectFile>(&*UO.get())) {
               MachOObjectFile *MachO = dyn_cast<MachOObjectFile>(o);
               if (OutputFormat == sysv)
-                outs() << o->getFileName() << "  :\n";
+                sizeOuts() << o->getFileName() << "  :\n";
               else if (MachO && OutputFormat == darwin) {
                 if (MoreThanOneFile)
-                  outs() << o->getFileName() << " (for architecture "
+                  sizeOuts() << o->getFileName() << " (for architecture "
                          << I->getArchFlagName() << "):\n";
               }
               printObjectSectionSizes(o);
               if (OutputFormat == berkeley) {
                 if (!MachO || MoreThanOneFile)
-                  outs() << o->getFileName() << " (for architecture "
+                  sizeOuts() << o->getFileName() << " (for architecture "
                          << I->getArchFlagName() << ")";
-                outs() << "\n";
+                sizeOuts() << "\n";
               }
             }
           } else if (auto E = isNotObjectErrorInvalidFileType(UO.takeError())) {
@@ -718,19 +732,19 @@ static void printFileSectionSizes(StringRef file) {
               if (ObjectFile *o = dyn_cast<ObjectFile>(&*ChildOrErr.get())) {
                 MachOObjectFile *MachO = dyn_cast<MachOObjectFile>(o);
                 if (OutputFormat == sysv)
-                  outs() << o->getFileName() << "   (ex " << UA->getFileName()
+                  sizeOuts() << o->getFileName() << "   (ex " << UA->getFileName()
                          << "):\n";
                 else if (MachO && OutputFormat == darwin)
-                  outs() << UA->getFileName() << "(" << o->getFileName() << ")"
+                  sizeOuts() << UA->getFileName() << "(" << o->getFileName() << ")"
                          << " (for architecture " << I->getArchFlagName()
                          << "):\n";
                 printObjectSectionSizes(o);
                 if (OutputFormat == berkeley) {
                   if (MachO)
-                    outs() << UA->getFileName() << "(" << o->getFileName()
+                    sizeOuts() << UA->getFileName() << "(" << o->getFileName()
                            << ")\n";
                   else
-                    outs() << o->getFileName() << " (ex " << UA->getFileName()
+                    sizeOuts() << o->getFileName() << " (ex " << UA->getFileName()
                            << ")\n";
                 }
               }
@@ -759,19 +773,19 @@ static void printFileSectionSizes(StringRef file) {
         if (ObjectFile *o = dyn_cast<ObjectFile>(&*UO.get())) {
           MachOObjectFile *MachO = dyn_cast<MachOObjectFile>(o);
           if (OutputFormat == sysv)
-            outs() << o->getFileName() << "  :\n";
+            sizeOuts() << o->getFileName() << "  :\n";
           else if (MachO && OutputFormat == darwin) {
             if (MoreThanOneFile || MoreThanOneArch)
-              outs() << o->getFileName() << " (for architecture "
+              sizeOuts() << o->getFileName() << " (for architecture "
                      << I->getArchFlagName() << "):";
-            outs() << "\n";
+            sizeOuts() << "\n";
           }
           printObjectSectionSizes(o);
           if (OutputFormat == berkeley) {
             if (!MachO || MoreThanOneFile || MoreThanOneArch)
-              outs() << o->getFileName() << " (for architecture "
+              sizeOuts() << o->getFileName() << " (for architecture "
                      << I->getArchFlagName() << ")";
-            outs() << "\n";
+            sizeOuts() << "\n";
           }
         }
       } else if (auto E = isNotObjectErrorInvalidFileType(UO.takeError())) {
@@ -795,19 +809,19 @@ static void printFileSectionSizes(StringRef file) {
           if (ObjectFile *o = dyn_cast<ObjectFile>(&*ChildOrErr.get())) {
             MachOObjectFile *MachO = dyn_cast<MachOObjectFile>(o);
             if (OutputFormat == sysv)
-              outs() << o->getFileName() << "   (ex " << UA->getFileName()
+              sizeOuts() << o->getFileName() << "   (ex " << UA->getFileName()
                      << "):\n";
             else if (MachO && OutputFormat == darwin)
-              outs() << UA->getFileName() << "(" << o->getFileName() << ")"
+              sizeOuts() << UA->getFileName() << "(" << o->getFileName() << ")"
                      << " (for architecture " << I->getArchFlagName() << "):\n";
             printObjectSectionSizes(o);
             if (OutputFormat == berkeley) {
               if (MachO)
-                outs() << UA->getFileName() << "(" << o->getFileName() << ")"
+                sizeOuts() << UA->getFileName() << "(" << o->getFileName() << ")"
                        << " (for architecture " << I->getArchFlagName()
                        << ")\n";
               else
-                outs() << o->getFileName() << " (ex " << UA->getFileName()
+                sizeOuts() << o->getFileName() << " (ex " << UA->getFileName()
                        << ")\n";
             }
           }
@@ -827,21 +841,21 @@ static void printFileSectionSizes(StringRef file) {
       return;
     MachOObjectFile *MachO = dyn_cast<MachOObjectFile>(o);
     if (OutputFormat == sysv)
-      outs() << o->getFileName() << "  :\n";
+      sizeOuts() << o->getFileName() << "  :\n";
     else if (MachO && OutputFormat == darwin && MoreThanOneFile)
-      outs() << o->getFileName() << ":\n";
+      sizeOuts() << o->getFileName() << ":\n";
     printObjectSectionSizes(o);
     if (OutputFormat == berkeley) {
       if (!MachO || MoreThanOneFile)
-        outs() << o->getFileName();
-      outs() << "\n";
+        sizeOuts() << o->getFileName();
+      sizeOuts() << "\n";
     }
   } else {
     error("unsupported file type", file);
   }
   // System V adds an extra newline at the end of each file.
   if (OutputFormat == sysv)
-    outs() << "\n";
+    sizeOuts() << "\n";
 }
 
 static void printBerkeleyTotals() {
@@ -851,12 +865,13 @@ static void printBerkeleyTotals() {
   fmt << "%#7" << radix_fmt << "\t"
       << "%#7" << radix_fmt << "\t"
       << "%#7" << radix_fmt << "\t";
-  outs() << format(fmt.str().c_str(), TotalObjectText, TotalObjectData,
-                   TotalObjectBss);
+  sizeOuts() << format(fmt.str().c_str(), TotalObjectText.load(),
+                   TotalObjectData.load(), TotalObjectBss.load());
   fmtbuf.clear();
   fmt << "%7" << (Radix == octal ? PRIo64 : PRIu64) << "\t"
       << "%7" PRIx64 "\t";
-  outs() << format(fmt.str().c_str(), TotalObjectTotal, TotalObjectTotal)
+  sizeOuts() << format(fmt.str().c_str(), TotalObjectTotal.load(),
+                   TotalObjectTotal.load())
          << "(TOTALS)\n";
 }
 
@@ -876,7 +891,7 @@ int main(int argc, char **argv) {
       ArchAll = true;
     } else {
       if (!MachOObjectFile::isValidArch(Arch)) {
-        outs() << ToolName << ": for the -arch option: Unknown architecture "
+        sizeOuts() << ToolName << ": for the -arch option: Unknown architecture "
                << "named '" << Arch << "'";
         return 1;
       }
@@ -887,7 +902,37 @@ int main(int argc, char **argv) {
     InputFilenames.push_back("a.out");
 
   MoreThanOneFile = InputFilenames.size() > 1;
-  llvm::for_each(InputFilenames, printFileSectionSizes);
+  if (NumThreads <= 1 || InputFilenames.size() <= 1) {
+    llvm::for_each(InputFilenames, printFileSectionSizes);
+  } else {
+    // Fan the files out over a pool and capture each file's listing in its
+    // own buffer so the output stays in input order.  The berkeley-style
+    // headers are printed once per process; each worker notes whether its
+    // buffer starts with one, and all but the first such header line are
+    // dropped when the buffers are stitched together.
+    std::vector<std::string> Listings(InputFilenames.size());
+    std::vector<char> PrintedHeader(InputFilenames.size(), 0);
+    ThreadPool Pool(std::min<unsigned>(NumThreads, InputFilenames.size()));
+    for (size_t I = 0, E = InputFilenames.size(); I != E; ++I)
+      Pool.async([I, &Listings, &PrintedHeader] {
+        raw_string_ostream OS(Listings[I]);
+        OutStream = &OS;
+        BerkeleyHeaderPrinted = false;
+        printFileSectionSizes(*(InputFilenames.begin() + I));
+        PrintedHeader[I] = BerkeleyHeaderPrinted;
+        OutStream = nullptr;
+        OS.flush();
+      });
+    Pool.wait();
+    bool HeaderEmitted = false;
+    for (size_t I = 0, E = Listings.size(); I != E; ++I) {
+      StringRef Listing = Listings[I];
+      if (PrintedHeader[I] && HeaderEmitted)
+        Listing = Listing.drop_front(Listing.find('\n') + 1);
+      HeaderEmitted |= PrintedHeader[I] != 0;
+      outs() << Listing;
+    }
+  }
   if (OutputFormat == berkeley && TotalSizes)
     printBerkeleyTotals();
 
@@ -15,19 +15,33 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/StringRef.h"
+#include "llvm/DebugInfo/DWARF/DWARFContext.h"
+#include "llvm/DebugInfo/GSYM/DwarfTransformer.h"
+#include "llvm/DebugInfo/GSYM/GsymCreator.h"
+#include "llvm/DebugInfo/GSYM/GsymReader.h"
 #include "llvm/DebugInfo/Symbolize/DIPrinter.h"
 #include "llvm/DebugInfo/Symbolize/Symbolize.h"
+#include "llvm/Object/Binary.h"
+#include "llvm/Object/ObjectFile.h"
 #include "llvm/Support/COM.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cstdio>
 #include <cstring>
 #include <string>
 
+#ifdef LLVM_ON_UNIX
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
 using namespace llvm;
 using namespace symbolize;
 
@@ -102,10 +116,40 @@ static cl::alias ClBinaryNameAliasE("e", cl::desc("Alias for -obj"),
                                     cl::NotHidden, cl::Grouping, cl::Prefix,
                                     cl::aliasopt(ClBinaryName));
 
+// -gsym-file, -write-gsym
+static cl::opt<std::string> ClGsymFile(
+    "gsym-file", cl::init(""), cl::value_desc("path"),
+    cl::desc("Answer CODE queries from the given GSYM file instead of the "
+             "binary's DWARF. GSYM lookups are binary searches with no line "
+             "program execution. Requires -obj"));
+
+static cl::opt<std::string> ClWriteGsym(
+    "write-gsym", cl::init(""), cl::value_desc("path"),
+    cl::desc("Convert the debug info of the -obj binary into a GSYM file at "
+             "the given path and exit"));
+
 static cl::opt<std::string>
     ClDwpName("dwp", cl::init(""),
               cl::desc("Path to DWP file to be use for any split CUs"));
 
+static cl::opt<bool> ClUseArangesCache(
+    "use-aranges-cache", cl::init(false),
+    cl::desc("Cache the DWARF address-range index in a <binary>.aranges-cache "
+             "sidecar file and reuse it across invocations"));
+
+// -daemon
+static cl::opt<std::string> ClDaemonSocket(
+    "daemon", cl::init(""), cl::value_desc("socket path"),
+    cl::desc("Run as a daemon listening on a Unix socket, keeping the object "
+             "file and debug info caches warm across clients. Each client "
+             "connection carries one batch of queries, one per line, using "
+             "the same format as standard input"));
+
+static cl::opt<uint64_t> ClMaxCacheMemory(
+    "max-cache-memory", cl::init(0), cl::value_desc("MB"),
+    cl::desc("In daemon mode, flush the symbolizer caches whenever allocated "
+             "memory exceeds this many MB (0 = unbounded)"));
+
 static cl::list<std::string>
 ClDsymHint("dsym-hint", cl::ZeroOrMore,
            cl::desc("Path to .dSYM bundles to search for debug info for the "
@@ -216,23 +260,79 @@ static bool parseCommand(StringRef InputString, Command &Cmd,
   return !StringRef(pos, offset_length).getAsInteger(0, ModuleOffset);
 }
 
+/// Answer a CODE query from a GSYM file. GSYM stores pre-baked, sorted
+/// function and line tables, so a lookup is a pair of binary searches with no
+/// line program execution. Columns are not stored in GSYM and print as 0.
+static void symbolizeAddressGsym(uint64_t Addr, gsym::GsymReader &Gsym,
+                                 raw_ostream &OS) {
+  auto FI = Gsym.getFunctionInfo(Addr);
+  if (!FI) {
+    consumeError(FI.takeError());
+    if (ClPrintFunctions != FunctionNameKind::None)
+      OS << "??\n";
+    OS << "??:0:0\n";
+    return;
+  }
+
+  if (ClPrintFunctions != FunctionNameKind::None) {
+    StringRef Name = Gsym.getString(FI->Name);
+    if (ClDemangle)
+      OS << LLVMSymbolizer::DemangleName(Name.str(), nullptr) << "\n";
+    else
+      OS << Name << "\n";
+  }
+
+  uint32_t File = 0;
+  uint32_t Line = 0;
+  if (FI->OptLineTable) {
+    // Line entries are sorted by address; take the last one at or before the
+    // query address.
+    for (const gsym::LineEntry &LE : *FI->OptLineTable) {
+      if (LE.Addr > Addr)
+        break;
+      File = LE.File;
+      Line = LE.Line;
+    }
+  }
+
+  Optional<gsym::FileEntry> FE = File ? Gsym.getFile(File) : None;
+  if (FE) {
+    StringRef Dir = Gsym.getString(FE->Dir);
+    StringRef Base = Gsym.getString(FE->Base);
+    if (!Dir.empty())
+      OS << Dir << "/";
+    OS << (Base.empty() ? "??" : Base);
+  } else {
+    OS << "??";
+  }
+  OS << ":" << Line << ":0\n";
+}
+
 static void symbolizeInput(StringRef InputString, LLVMSymbolizer &Symbolizer,
-                           DIPrinter &Printer) {
+                           DIPrinter &Printer, gsym::GsymReader *Gsym,
+                           raw_ostream &OS) {
   Command Cmd;
   std::string ModuleName;
   uint64_t Offset = 0;
   if (!parseCommand(StringRef(InputString), Cmd, ModuleName, Offset)) {
-    outs() << InputString;
+    OS << InputString;
     return;
   }
 
   if (ClPrintAddress) {
-    outs() << "0x";
-    outs().write_hex(Offset);
+    OS << "0x";
+    OS.write_hex(Offset);
     StringRef Delimiter = ClPrettyPrint ? ": " : "\n";
-    outs() << Delimiter;
+    OS << Delimiter;
   }
   Offset -= ClAdjustVMA;
+
+  if (Gsym && Cmd == Command::Code) {
+    symbolizeAddressGsym(Offset, *Gsym, OS);
+    if (ClOutputStyle == DIPrinter::OutputStyle::LLVM)
+      OS << "\n";
+    return;
+  }
   if (Cmd == Command::Data) {
     auto ResOrErr = Symbolizer.symbolizeData(
         ModuleName, {Offset, object::SectionedAddress::UndefSection});
@@ -244,7 +344,7 @@ static void symbolizeInput(StringRef InputString, LLVMSymbolizer &Symbolizer,
       for (DILocal Local : *ResOrErr)
         Printer << Local;
       if (ResOrErr->empty())
-        outs() << "??\n";
+        OS << "??\n";
     }
   } else if (ClPrintInlining) {
     auto ResOrErr = Symbolizer.symbolizeInlinedCode(
@@ -266,7 +366,120 @@ static void symbolizeInput(StringRef InputString, LLVMSymbolizer &Symbolizer,
     Printer << (error(ResOrErr) ? DILineInfo() : ResOrErr.get());
   }
   if (ClOutputStyle == DIPrinter::OutputStyle::LLVM)
-    outs() << "\n";
+    OS << "\n";
+}
+
+/// Flush the symbolizer caches if the amount of allocated memory went over
+/// the -max-cache-memory limit. The caches have no per-module usage tracking,
+/// so the bound is enforced by dropping everything and letting the hot
+/// modules get re-parsed on the next batch.
+static void enforceCacheMemoryLimit(LLVMSymbolizer &Symbolizer) {
+  if (!ClMaxCacheMemory)
+    return;
+  if (sys::Process::GetMallocUsage() > ClMaxCacheMemory * 1024 * 1024)
+    Symbolizer.flush();
+}
+
+#ifdef LLVM_ON_UNIX
+/// Serve symbolization queries over a Unix socket until the process is
+/// killed. Each accepted connection is one batch: queries are read one per
+/// line exactly like standard input, and each answer is flushed back on the
+/// same connection as soon as it is produced.
+static int runDaemon(StringRef SocketPath, LLVMSymbolizer &Symbolizer,
+                     gsym::GsymReader *Gsym) {
+  int ListenFD = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (ListenFD < 0) {
+    errs() << "error: cannot create socket: " << strerror(errno) << "\n";
+    return 1;
+  }
+
+  struct sockaddr_un Addr;
+  memset(&Addr, 0, sizeof(Addr));
+  Addr.sun_family = AF_UNIX;
+  if (SocketPath.size() >= sizeof(Addr.sun_path)) {
+    errs() << "error: socket path is too long: " << SocketPath << "\n";
+    return 1;
+  }
+  memcpy(Addr.sun_path, SocketPath.data(), SocketPath.size());
+
+  if (::bind(ListenFD, reinterpret_cast<struct sockaddr *>(&Addr),
+             sizeof(Addr)) < 0) {
+    errs() << "error: cannot bind to " << SocketPath << ": " << strerror(errno)
+           << "\n";
+    return 1;
+  }
+  if (::listen(ListenFD, /*backlog=*/16) < 0) {
+    errs() << "error: cannot listen on " << SocketPath << ": "
+           << strerror(errno) << "\n";
+    return 1;
+  }
+
+  const int kMaxInputStringLength = 1024;
+  char InputString[kMaxInputStringLength];
+
+  while (true) {
+    int ConnFD = ::accept(ListenFD, nullptr, nullptr);
+    if (ConnFD < 0) {
+      if (errno == EINTR)
+        continue;
+      errs() << "error: accept failed: " << strerror(errno) << "\n";
+      return 1;
+    }
+
+    // The reading FILE and the writing stream need separate descriptors
+    // because both close the one they own.
+    raw_fd_ostream OS(::dup(ConnFD), /*shouldClose=*/true);
+    DIPrinter Printer(OS, ClPrintFunctions != FunctionNameKind::None,
+                      ClPrettyPrint, ClPrintSourceContextLines, ClVerbose,
+                      ClBasenames, ClOutputStyle);
+    if (FILE *In = ::fdopen(ConnFD, "r")) {
+      while (fgets(InputString, sizeof(InputString), In)) {
+        symbolizeInput(InputString, Symbolizer, Printer, Gsym, OS);
+        OS.flush();
+      }
+      fclose(In);
+    } else {
+      ::close(ConnFD);
+    }
+
+    enforceCacheMemoryLimit(Symbolizer);
+  }
+}
+#endif
+
+/// Convert the DWARF in \p BinaryPath into a GSYM file at \p OutPath.
+static int writeGsym(StringRef BinaryPath, StringRef OutPath) {
+  Expected<object::OwningBinary<object::Binary>> BinOrErr =
+      object::createBinary(BinaryPath);
+  if (!BinOrErr) {
+    logAllUnhandledErrors(BinOrErr.takeError(), errs(),
+                          "error: " + BinaryPath + ": ");
+    return 1;
+  }
+  auto *Obj = dyn_cast<object::ObjectFile>(BinOrErr->getBinary());
+  if (!Obj) {
+    errs() << "error: " << BinaryPath << " is not an object file.\n";
+    return 1;
+  }
+
+  std::unique_ptr<DWARFContext> DICtx = DWARFContext::create(*Obj);
+  gsym::GsymCreator Gsym;
+  gsym::DwarfTransformer DT(*DICtx, errs(), Gsym);
+  if (Error E = DT.convert()) {
+    logAllUnhandledErrors(std::move(E), errs(), "error: ");
+    return 1;
+  }
+  if (Error E = Gsym.finalize(ClVerbose ? errs() : nulls())) {
+    logAllUnhandledErrors(std::move(E), errs(), "error: ");
+    return 1;
+  }
+  support::endianness Endian =
+      Obj->isLittleEndian() ? support::little : support::big;
+  if (Error E = Gsym.save(OutPath, Endian)) {
+    logAllUnhandledErrors(std::move(E), errs(), "error: ");
+    return 1;
+  }
+  return 0;
 }
 
 int main(int argc, char **argv) {
@@ -299,6 +512,7 @@ int main(int argc, char **argv) {
   Opts.DefaultArch = ClDefaultArch;
   Opts.FallbackDebugPath = ClFallbackDebugPath;
   Opts.DWPName = ClDwpName;
+  Opts.UseArangesCache = ClUseArangesCache;
 
   for (const auto &hint : ClDsymHint) {
     if (sys::path::extension(hint) == ".dSYM") {
@@ -308,23 +522,57 @@ int main(int argc, char **argv) {
                 "\" (must have the '.dSYM' extension).\n";
     }
   }
+  if (!ClWriteGsym.empty()) {
+    if (ClBinaryName.empty()) {
+      errs() << "error: -write-gsym requires -obj.\n";
+      return 1;
+    }
+    return writeGsym(ClBinaryName, ClWriteGsym);
+  }
+
+  Optional<gsym::GsymReader> Gsym;
+  if (!ClGsymFile.empty()) {
+    if (ClBinaryName.empty()) {
+      errs() << "error: -gsym-file requires -obj.\n";
+      return 1;
+    }
+    Expected<gsym::GsymReader> ReaderOrErr =
+        gsym::GsymReader::openFile(ClGsymFile);
+    if (!ReaderOrErr) {
+      logAllUnhandledErrors(ReaderOrErr.takeError(), errs(),
+                            "error: " + ClGsymFile + ": ");
+      return 1;
+    }
+    Gsym.emplace(std::move(*ReaderOrErr));
+  }
+  gsym::GsymReader *GsymPtr = Gsym ? Gsym.getPointer() : nullptr;
+
   LLVMSymbolizer Symbolizer(Opts);
 
   DIPrinter Printer(outs(), ClPrintFunctions != FunctionNameKind::None,
                     ClPrettyPrint, ClPrintSourceContextLines, ClVerbose,
                     ClBasenames, ClOutputStyle);
 
+  if (!ClDaemonSocket.empty()) {
+#ifdef LLVM_ON_UNIX
+    return runDaemon(ClDaemonSocket, Symbolizer, GsymPtr);
+#else
+    errs() << "error: daemon mode is only supported on Unix.\n";
+    return 1;
+#endif
+  }
+
   if (ClInputAddresses.empty()) {
     const int kMaxInputStringLength = 1024;
     char InputString[kMaxInputStringLength];
 
     while (fgets(InputString, sizeof(InputString), stdin)) {
-      symbolizeInput(InputString, Symbolizer, Printer);
+      symbolizeInput(InputString, Symbolizer, Printer, GsymPtr, outs());
       outs().flush();
     }
   } else {
     for (StringRef Address : ClInputAddresses)
-      symbolizeInput(Address, Symbolizer, Printer);
+      symbolizeInput(Address, Symbolizer, Printer, GsymPtr, outs());
   }
 
   return 0;
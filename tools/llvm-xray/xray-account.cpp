@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
 #include <numeric>
 #include <system_error>
 #include <utility>
@@ -20,6 +21,7 @@
 #include "xray-registry.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/XRay/InstrumentationMap.h"
 #include "llvm/XRay/Trace.h"
 
@@ -218,6 +220,29 @@ bool LatencyAccountant::accountRecord(const XRayRecord &Record) {
   return true;
 }
 
+void LatencyAccountant::mergeFrom(LatencyAccountant &&O) {
+  for (auto &FT : O.FunctionLatencies) {
+    auto &Timings = FunctionLatencies[FT.first];
+    Timings.insert(Timings.end(), FT.second.begin(), FT.second.end());
+  }
+  // Threads are disjoint between the two accountants, so the per-thread data
+  // can be adopted wholesale.
+  for (const auto &TT : O.PerThreadMinMaxTSC)
+    PerThreadMinMaxTSC[TT.first] = TT.second;
+  for (auto &TS : O.PerThreadFunctionStack)
+    PerThreadFunctionStack[TS.first] = std::move(TS.second);
+  // Different threads may have run on the same CPU, so combine the ranges.
+  for (const auto &CT : O.PerCPUMinMaxTSC) {
+    auto &MM = PerCPUMinMaxTSC[CT.first];
+    if (MM.first == 0 && MM.second == 0) {
+      MM = CT.second;
+    } else {
+      MM.first = std::min(MM.first, CT.second.first);
+      MM.second = std::max(MM.second, CT.second.second);
+    }
+  }
+}
+
 namespace {
 
 // We consolidate the data into a struct which we can output in various forms.
@@ -440,33 +465,91 @@ static CommandRegistration Unused(&Account, []() -> Error {
         TraceOrErr.takeError());
 
   auto &T = *TraceOrErr;
-  for (const auto &Record : T) {
-    if (FCA.accountRecord(Record))
-      continue;
-    errs()
-        << "Error processing record: "
-        << llvm::formatv(
-               R"({{type: {0}; cpu: {1}; record-type: {2}; function-id: {3}; tsc: {4}; thread-id: {5}; process-id: {6}}})",
-               Record.RecordType, Record.CPU, Record.Type, Record.FuncId,
-               Record.TSC, Record.TId, Record.PId)
-        << '\n';
-    for (const auto &ThreadStack : FCA.getPerThreadFunctionStack()) {
-      errs() << "Thread ID: " << ThreadStack.first << "\n";
-      if (ThreadStack.second.empty()) {
-        errs() << "  (empty stack)\n";
+
+  // Function call accounting is stateful only within a single thread: both
+  // the shadow stack and the TSC monotonicity check apply per thread. We
+  // partition the trace by thread id and account the threads concurrently,
+  // then merge the per-thread results in thread id order so that the output
+  // stays deterministic.
+  std::map<uint32_t, std::vector<const XRayRecord *>> RecordsByThread;
+  for (const auto &Record : T)
+    RecordsByThread[Record.TId].push_back(&Record);
+
+  struct ThreadAccounting {
+    std::unique_ptr<LatencyAccountant> Accountant;
+    const std::vector<const XRayRecord *> *Records;
+    // Records we failed to account, along with a snapshot of the thread's
+    // function stack at the time of the failure. Symbolizing the stacks is
+    // not thread-safe, so it is deferred until after the accounting is done.
+    std::vector<std::pair<const XRayRecord *, LatencyAccountant::FunctionStack>>
+        Failures;
+    bool Fatal = false;
+  };
+  std::vector<ThreadAccounting> Threads;
+  Threads.reserve(RecordsByThread.size());
+  for (auto &TR : RecordsByThread) {
+    Threads.emplace_back();
+    Threads.back().Accountant = std::make_unique<LatencyAccountant>(
+        FuncIdHelper, AccountDeduceSiblingCalls);
+    Threads.back().Records = &TR.second;
+  }
+
+  auto AccountThread = [](ThreadAccounting &TA) {
+    for (const auto *Record : *TA.Records) {
+      if (TA.Accountant->accountRecord(*Record))
         continue;
+      const auto &Stacks = TA.Accountant->getPerThreadFunctionStack();
+      auto StackIt = Stacks.find(Record->TId);
+      TA.Failures.emplace_back(Record,
+                               StackIt != Stacks.end()
+                                   ? StackIt->second
+                                   : LatencyAccountant::FunctionStack());
+      if (!AccountKeepGoing) {
+        TA.Fatal = true;
+        return;
       }
-      auto Level = ThreadStack.second.size();
-      for (const auto &Entry : llvm::reverse(ThreadStack.second))
-        errs() << "  #" << Level-- << "\t"
-               << FuncIdHelper.SymbolOrNumber(Entry.first) << '\n';
     }
-    if (!AccountKeepGoing)
-      return make_error<StringError>(
-          Twine("Failed accounting function calls in file '") + AccountInput +
-              "'.",
-          std::make_error_code(std::errc::executable_format_error));
+  };
+
+  if (Threads.size() < 2) {
+    for (auto &TA : Threads)
+      AccountThread(TA);
+  } else {
+    ThreadPool Pool;
+    for (auto &TA : Threads)
+      Pool.async(AccountThread, std::ref(TA));
+    Pool.wait();
   }
+
+  bool Fatal = false;
+  for (auto &TA : Threads) {
+    for (const auto &Failure : TA.Failures) {
+      const auto &Record = *Failure.first;
+      errs()
+          << "Error processing record: "
+          << llvm::formatv(
+                 R"({{type: {0}; cpu: {1}; record-type: {2}; function-id: {3}; tsc: {4}; thread-id: {5}; process-id: {6}}})",
+                 Record.RecordType, Record.CPU, Record.Type, Record.FuncId,
+                 Record.TSC, Record.TId, Record.PId)
+          << '\n';
+      errs() << "Thread ID: " << Record.TId << "\n";
+      if (Failure.second.empty()) {
+        errs() << "  (empty stack)\n";
+      } else {
+        auto Level = Failure.second.size();
+        for (const auto &Entry : llvm::reverse(Failure.second))
+          errs() << "  #" << Level-- << "\t"
+                 << FuncIdHelper.SymbolOrNumber(Entry.first) << '\n';
+      }
+    }
+    Fatal |= TA.Fatal;
+    FCA.mergeFrom(std::move(*TA.Accountant));
+  }
+  if (Fatal)
+    return make_error<StringError>(
+        Twine("Failed accounting function calls in file '") + AccountInput +
+            "'.",
+        std::make_error_code(std::errc::executable_format_error));
   switch (AccountOutputFormat) {
   case AccountOutputFormats::TEXT:
     FCA.exportStatsAsText(OS, T.getFileHeader());
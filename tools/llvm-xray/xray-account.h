@@ -76,6 +76,12 @@ public:
   ///
   bool accountRecord(const XRayRecord &Record);
 
+  /// Fold the data accumulated by \p O into this accountant. The two
+  /// accountants must have processed records for disjoint sets of threads;
+  /// this is used to merge the results of accountants that ran concurrently,
+  /// one per thread in the trace.
+  void mergeFrom(LatencyAccountant &&O);
+
   const PerThreadFunctionStackMap &getPerThreadFunctionStack() const {
     return PerThreadFunctionStack;
   }
@@ -452,6 +452,22 @@ bool lto_codegen_compile_to_file(lto_code_gen_t cg, const char **name) {
       DisableLTOVectorization);
 }
 
+void lto_codegen_set_parallelism(lto_code_gen_t cg, unsigned parallelism) {
+  unwrap(cg)->setParallelismLevel(parallelism);
+}
+
+unsigned int lto_codegen_get_num_object_files(lto_code_gen_t cg) {
+  return unwrap(cg)->getNativeObjectPaths().size();
+}
+
+const char *lto_codegen_get_object_file(lto_code_gen_t cg,
+                                        unsigned int index) {
+  ArrayRef<std::string> Paths = unwrap(cg)->getNativeObjectPaths();
+  if (index >= Paths.size())
+    return nullptr;
+  return Paths[index].c_str();
+}
+
 void lto_codegen_debug_options(lto_code_gen_t cg, const char *opt) {
   unwrap(cg)->setCodeGenDebugOptions(opt);
 }
@@ -18,6 +18,7 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Analysis/AliasAnalysis.h"
 #include "llvm/Analysis/CGSCCPassManager.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
 #include "llvm/Bitcode/BitcodeWriterPass.h"
 #include "llvm/Config/llvm-config.h"
 #include "llvm/IR/Dominators.h"
@@ -31,6 +32,7 @@
 #include "llvm/Passes/StandardInstrumentations.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Transforms/IPO/ThinLTOBitcodeWriter.h"
@@ -114,6 +116,33 @@ static cl::opt<bool> DebugInfoForProfiling(
     cl::desc("Emit special debug info to enable PGO profile generation."));
 /// @}}
 
+/// {{@ These options implement pipeline checkpointing: snapshot the module
+/// after a named pass and later resume a pipeline from such a snapshot
+/// without re-running the earlier passes.
+static cl::opt<std::string> CheckpointAfter(
+    "checkpoint-after", cl::Hidden,
+    cl::desc("Write a bitcode snapshot of the module to the file given by "
+             "-checkpoint-file after the first execution of the named pass"));
+static cl::opt<std::string>
+    CheckpointFile("checkpoint-file", cl::Hidden, cl::init("opt.checkpoint.bc"),
+                   cl::desc("File the -checkpoint-after snapshot is written "
+                            "to (default: opt.checkpoint.bc)"));
+static cl::opt<std::string> ResumeFrom(
+    "resume-from", cl::Hidden,
+    cl::desc("Skip every pass up to and including the first execution of the "
+             "named pass; the input module is expected to be a "
+             "-checkpoint-after snapshot taken at that point"));
+/// @}}
+
+/// Match a pass name from the instrumentation callbacks against a
+/// user-provided name; the llvm:: prefix of the type name may be omitted.
+static bool passNameMatches(StringRef PassID, StringRef UserName) {
+  PassID.consume_front("llvm::");
+  StringRef Name = UserName;
+  Name.consume_front("llvm::");
+  return PassID == Name;
+}
+
 template <typename PassManagerT>
 bool tryParsePipelineText(PassBuilder &PB,
                           const cl::opt<std::string> &PipelineOpt) {
@@ -261,6 +290,43 @@ bool llvm::runPassPipeline(StringRef Arg0, Module &M, TargetMachine *TM,
   StandardInstrumentations SI;
   SI.registerCallbacks(PIC);
 
+  // Write a snapshot of the module once the named pass has finished. The
+  // module is in a consistent state at any AfterPass point, including after
+  // function and loop passes. Preserved-analysis state is deliberately not
+  // serialized; analyses are recomputed on demand when resuming, which is
+  // always safe.
+  bool CheckpointWritten = false;
+  if (!CheckpointAfter.empty())
+    PIC.registerAfterPassCallback([&](StringRef P, Any) {
+      if (CheckpointWritten || !passNameMatches(P, CheckpointAfter))
+        return;
+      std::error_code EC;
+      raw_fd_ostream OS(CheckpointFile, EC, sys::fs::OF_None);
+      if (EC) {
+        errs() << "could not open checkpoint file '" << CheckpointFile
+               << "': " << EC.message() << "\n";
+        return;
+      }
+      WriteBitcodeToFile(M, OS);
+      CheckpointWritten = true;
+    });
+
+  // When resuming, skip each pass until the named one has been reached (and
+  // skip that one too; its effect is already in the snapshot). Pass managers
+  // and adaptors must still run or the passes nested in them would never be
+  // visited.
+  bool ResumeReached = ResumeFrom.empty();
+  if (!ResumeFrom.empty())
+    PIC.registerBeforePassCallback([&ResumeReached](StringRef P, Any) {
+      if (ResumeReached)
+        return true;
+      if (P.contains("PassManager<") || P.contains("PassAdaptor<"))
+        return true;
+      if (passNameMatches(P, ResumeFrom))
+        ResumeReached = true;
+      return false;
+    });
+
   PassBuilder PB(TM, PipelineTuningOptions(), P, &PIC);
   registerEPCallbacks(PB, VerifyEachPass, DebugPM);
 
@@ -358,6 +424,13 @@ bool llvm::runPassPipeline(StringRef Arg0, Module &M, TargetMachine *TM,
   // Now that we have all of the passes ready, run them.
   MPM.run(M, MAM);
 
+  if (!CheckpointAfter.empty() && !CheckpointWritten)
+    errs() << "warning: -checkpoint-after pass '" << CheckpointAfter
+           << "' never ran; no checkpoint written\n";
+  if (!ResumeFrom.empty() && !ResumeReached)
+    errs() << "warning: -resume-from pass '" << ResumeFrom
+           << "' never reached; every pass was skipped\n";
+
   // Declare success.
   if (OK != OK_NoOutput) {
     Out->keep();
@@ -33,6 +33,7 @@
 #include "llvm/IR/LegacyPassManager.h"
 #include "llvm/IR/LegacyPassNameParser.h"
 #include "llvm/IR/Module.h"
+#include "llvm/IR/PassTimingInfo.h"
 #include "llvm/IR/RemarkStreamer.h"
 #include "llvm/IR/Verifier.h"
 #include "llvm/IRReader/IRReader.h"
@@ -49,6 +50,7 @@
 #include "llvm/Support/SystemUtils.h"
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/Timer.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/YAMLTraits.h"
 #include "llvm/Target/TargetMachine.h"
@@ -58,6 +60,14 @@
 #include "llvm/Transforms/Utils/Cloning.h"
 #include <algorithm>
 #include <memory>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 using namespace llvm;
 using namespace opt_tool;
 
@@ -241,6 +251,24 @@ static cl::opt<bool>
              cl::desc("Run all passes twice, re-using the same pass manager."),
              cl::init(false), cl::Hidden);
 
+static cl::opt<unsigned> BenchmarkRuns(
+    "benchmark-runs",
+    cl::desc("Run the pass pipeline this many times on clones of the input "
+             "module and report per-pass timing as JSON (0 = disabled)."),
+    cl::init(0), cl::Hidden);
+
+static cl::opt<unsigned> BenchmarkWarmupRuns(
+    "benchmark-warmup-runs",
+    cl::desc("Number of unmeasured pipeline runs before -benchmark-runs "
+             "measurement starts."),
+    cl::init(1), cl::Hidden);
+
+static cl::opt<std::string> BenchmarkOutput(
+    "benchmark-output",
+    cl::desc("File to write the -benchmark-runs JSON report to. '-' means "
+             "stdout."),
+    cl::init("-"), cl::Hidden);
+
 static cl::opt<bool> DiscardValueNames(
     "discard-value-names",
     cl::desc("Discard names from Value (other than GlobalValue)."),
@@ -476,6 +504,81 @@ static TargetMachine* GetTargetMachine(Triple TheTriple, StringRef CPUStr,
                                         getCodeModel(), GetCodeGenOptLevel());
 }
 
+namespace {
+/// Counts retired instructions across a region via perf_event_open.  Readings
+/// are -1 when the counter is unavailable (non-Linux hosts, a restrictive
+/// perf_event_paranoid setting, or no PMU).
+class InstructionCounter {
+public:
+  InstructionCounter() {
+#ifdef __linux__
+    perf_event_attr Attr;
+    memset(&Attr, 0, sizeof(Attr));
+    Attr.type = PERF_TYPE_HARDWARE;
+    Attr.size = sizeof(Attr);
+    Attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    Attr.disabled = 1;
+    Attr.exclude_kernel = 1;
+    Attr.exclude_hv = 1;
+    FD = syscall(__NR_perf_event_open, &Attr, 0, -1, -1, 0);
+#endif
+  }
+
+  ~InstructionCounter() {
+#ifdef __linux__
+    if (FD != -1)
+      close(FD);
+#endif
+  }
+
+  void start() {
+#ifdef __linux__
+    if (FD != -1) {
+      ioctl(FD, PERF_EVENT_IOC_RESET, 0);
+      ioctl(FD, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  int64_t stop() {
+#ifdef __linux__
+    if (FD != -1) {
+      ioctl(FD, PERF_EVENT_IOC_DISABLE, 0);
+      int64_t Count = 0;
+      if (read(FD, &Count, sizeof(Count)) == sizeof(Count))
+        return Count;
+    }
+#endif
+    return -1;
+  }
+
+private:
+  int FD = -1;
+};
+} // end anonymous namespace
+
+/// Emits the per-pass timers accumulated over all measured runs plus the
+/// per-run retired-instruction counts as one flat JSON object, so CI can diff
+/// reports across commits.
+static bool writeBenchmarkReport(ArrayRef<int64_t> InstrCounts) {
+  std::error_code EC;
+  raw_fd_ostream OS(BenchmarkOutput, EC, sys::fs::OF_Text);
+  if (EC) {
+    errs() << "error opening '" << BenchmarkOutput
+           << "' for the benchmark report: " << EC.message() << '\n';
+    return false;
+  }
+  OS << "{";
+  const char *Delim = TimerGroup::printAllJSONValues(OS, "\n");
+  OS << Delim << "\t\"benchmark.runs\": " << InstrCounts.size();
+  Delim = ",\n";
+  for (unsigned I = 0, E = InstrCounts.size(); I != E; ++I)
+    OS << Delim << "\t\"benchmark.instructions." << I
+       << "\": " << InstrCounts[I];
+  OS << "\n}\n";
+  return true;
+}
+
 #ifdef LINK_POLLY_INTO_TOOLS
 namespace polly {
 void initializePollyPasses(llvm::PassRegistry &Registry);
@@ -661,6 +764,16 @@ int main(int argc, char **argv) {
   if (OutputThinLTOBC)
     M->addModuleFlag(Module::Error, "EnableSplitLTOUnit", SplitLTOUnit);
 
+  if (BenchmarkRuns != 0) {
+    if (PassPipeline.getNumOccurrences() > 0)
+      report_fatal_error("-benchmark-runs requires the legacy pass manager; "
+                         "it cannot be combined with -passes");
+    if (RunTwice)
+      report_fatal_error("-benchmark-runs is incompatible with -run-twice");
+    // The per-pass timers are what the benchmark reports.
+    TimePassesIsEnabled = true;
+  }
+
   if (PassPipeline.getNumOccurrences() > 0) {
     OutputKind OK = OK_NoOutput;
     if (!NoOutput)
@@ -867,7 +980,7 @@ int main(int argc, char **argv) {
   if (!NoOutput && !AnalyzeOnly) {
     assert(Out);
     OS = &Out->os();
-    if (RunTwice) {
+    if (RunTwice || BenchmarkRuns != 0) {
       BOS = std::make_unique<raw_svector_ostream>(Buffer);
       OS = BOS.get();
     }
@@ -888,7 +1001,33 @@ int main(int argc, char **argv) {
   // Before executing passes, print the final values of the LLVM options.
   cl::PrintOptionValues();
 
-  if (!RunTwice) {
+  if (BenchmarkRuns != 0) {
+    // Warm up, then measure.  Every iteration runs the pipeline on a pristine
+    // clone of the module so each run optimizes the same input; the buffered
+    // output of the last measured run is what gets written.
+    for (unsigned I = 0, E = BenchmarkWarmupRuns; I != E; ++I) {
+      std::unique_ptr<Module> MClone(CloneModule(*M));
+      Buffer.clear();
+      Passes.run(*MClone);
+    }
+    // Warm-up timings are not part of the report.
+    TimerGroup::clearAll();
+
+    InstructionCounter Counter;
+    SmallVector<int64_t, 8> InstrCounts;
+    for (unsigned I = 0, E = BenchmarkRuns; I != E; ++I) {
+      std::unique_ptr<Module> MClone(CloneModule(*M));
+      Buffer.clear();
+      Counter.start();
+      Passes.run(*MClone);
+      InstrCounts.push_back(Counter.stop());
+    }
+
+    if (BOS)
+      Out->os() << BOS->str();
+    if (!writeBenchmarkReport(InstrCounts))
+      return 1;
+  } else if (!RunTwice) {
     // Now that we have all of the passes ready, run them.
     Passes.run(*M);
   } else {
@@ -953,6 +953,16 @@ TEST(APIntTest, divrem_big1) {
           {256, 0});
 }
 
+TEST(APIntTest, divrem_two_words) {
+  // Exercises the two-word native division fast path in divide().
+  testDiv({128, "1ffffffffffffffff", 16},
+          {128, "ffffffffffffff", 16},
+          {128, 4219});
+  testDiv(APInt{128, 19}.shl(100),
+          APInt{128, 4356013},
+          {128, 1});
+}
+
 TEST(APIntTest, divrem_big2) {
   // Tests KnuthDiv rare step D6
   testDiv({1024,                       "112233ceff"
@@ -0,0 +1,84 @@
+//===- llvm/unittest/ADT/ConcurrentDenseMapTest.cpp - Tests --------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ADT/ConcurrentDenseMap.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace llvm;
+
+namespace {
+
+TEST(ConcurrentDenseMapTest, Basics) {
+  ConcurrentDenseMap<int, int> Map;
+  EXPECT_TRUE(Map.empty());
+  EXPECT_FALSE(Map.lookup(1).hasValue());
+
+  EXPECT_TRUE(Map.try_emplace(1, 10).second);
+  EXPECT_FALSE(Map.try_emplace(1, 20).second);
+  EXPECT_EQ(10, Map.try_emplace(1, 20).first);
+  EXPECT_EQ(10, *Map.lookup(1));
+  EXPECT_EQ(1u, Map.count(1));
+  EXPECT_EQ(1u, Map.size());
+
+  Map.insert_or_assign(1, 30);
+  EXPECT_EQ(30, *Map.lookup(1));
+
+  EXPECT_TRUE(Map.erase(1));
+  EXPECT_FALSE(Map.erase(1));
+  EXPECT_TRUE(Map.empty());
+}
+
+TEST(ConcurrentDenseMapTest, GetOrCreate) {
+  ConcurrentDenseMap<int, int> Map;
+  int Calls = 0;
+  auto Create = [&Calls] { return ++Calls; };
+  EXPECT_EQ(1, Map.getOrCreate(7, Create));
+  EXPECT_EQ(1, Map.getOrCreate(7, Create));
+  EXPECT_EQ(1, Calls);
+}
+
+TEST(ConcurrentDenseMapTest, ForEach) {
+  ConcurrentDenseMap<int, int> Map;
+  for (int I = 0; I < 100; ++I)
+    Map.try_emplace(I, I * 2);
+  int Sum = 0;
+  Map.forEach([&Sum](int K, int V) {
+    EXPECT_EQ(K * 2, V);
+    ++Sum;
+  });
+  EXPECT_EQ(100, Sum);
+  Map.clear();
+  EXPECT_EQ(0u, Map.size());
+}
+
+TEST(ConcurrentDenseMapTest, ConcurrentInsert) {
+  ConcurrentDenseMap<int, int> Map;
+  const int NumThreads = 4;
+  const int PerThread = 1000;
+  std::atomic<int> Inserts(0);
+  std::vector<std::thread> Threads;
+  for (int T = 0; T < NumThreads; ++T)
+    Threads.emplace_back([&Map, &Inserts, PerThread] {
+      for (int I = 0; I < PerThread; ++I)
+        if (Map.try_emplace(I, I).second)
+          ++Inserts;
+    });
+  for (std::thread &T : Threads)
+    T.join();
+
+  // Every key was inserted by exactly one thread.
+  EXPECT_EQ(PerThread, Inserts.load());
+  EXPECT_EQ((size_t)PerThread, Map.size());
+  for (int I = 0; I < PerThread; ++I)
+    EXPECT_EQ(I, *Map.lookup(I));
+}
+
+} // end anonymous namespace
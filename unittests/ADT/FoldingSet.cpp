@@ -188,5 +188,22 @@ TEST(FoldingSetTest, SmallReserveChangesNothing) {
   EXPECT_EQ(Trivial.capacity(), OldCapacity);
 }
 
+TEST(FoldingSetTest, ArenaFoldingSet) {
+  BumpPtrAllocator Arena;
+  ArenaFoldingSet<TrivialPair> Set(Arena);
+
+  TrivialPair *A = Set.createNode(1, 2);
+  EXPECT_EQ(A, Set.GetOrInsertNode(A));
+  // A duplicate folds to the existing node.
+  TrivialPair *B = Set.createNode(1, 2);
+  EXPECT_EQ(A, Set.GetOrInsertNode(B));
+  EXPECT_EQ(1U, Set.size());
+
+  // Bulk teardown: drop the buckets, then recycle the arena.
+  Set.clear();
+  EXPECT_TRUE(Set.empty());
+  Arena.Reset();
+}
+
 }
 
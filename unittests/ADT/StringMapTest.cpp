@@ -195,6 +195,40 @@ TEST_F(StringMapTest, CopyCtorTest) {
   EXPECT_EQ(5, Map2.lookup("funf"));
 }
 
+TEST_F(StringMapTest, ReserveTest) {
+  llvm::StringMap<int> Map;
+  Map["eins"] = 1;
+  Map["zwei"] = 2;
+
+  // Reserving for a large batch must keep the existing entries intact and
+  // leave enough headroom that the batch itself triggers no rehash.
+  Map.reserve(2 + 100);
+  unsigned Buckets = Map.getNumBuckets();
+  for (int i = 0; i < 100; ++i) {
+    std::stringstream ss;
+    ss << "key_" << i;
+    Map[ss.str()] = i;
+  }
+  EXPECT_EQ(Buckets, Map.getNumBuckets());
+  EXPECT_EQ(102u, Map.size());
+  EXPECT_EQ(1, Map.lookup("eins"));
+  EXPECT_EQ(2, Map.lookup("zwei"));
+  EXPECT_EQ(42, Map.lookup("key_42"));
+}
+
+TEST_F(StringMapTest, InsertRangeTest) {
+  std::vector<std::pair<StringRef, int>> Pairs;
+  Pairs.push_back(std::make_pair("a", 1));
+  Pairs.push_back(std::make_pair("b", 2));
+  Pairs.push_back(std::make_pair("a", 3)); // Duplicate key is ignored.
+
+  llvm::StringMap<int> Map;
+  Map.insert(Pairs.begin(), Pairs.end());
+  EXPECT_EQ(2u, Map.size());
+  EXPECT_EQ(1, Map.lookup("a"));
+  EXPECT_EQ(2, Map.lookup("b"));
+}
+
 // A more complex iteration test.
 TEST_F(StringMapTest, IterationTest) {
   bool visited[100];
@@ -505,6 +505,14 @@ TEST(StringRefTest, Count) {
   EXPECT_EQ(1U, Str.count("hello"));
   EXPECT_EQ(1U, Str.count("ello"));
   EXPECT_EQ(0U, Str.count("zz"));
+  EXPECT_EQ(0U, Str.count(""));
+
+  StringRef LongStr("abababababababab");
+  EXPECT_EQ(8U, LongStr.count('a'));
+  EXPECT_EQ(8U, LongStr.count("ab"));
+  // Non-overlapped occurrences only.
+  EXPECT_EQ(4U, LongStr.count("abab"));
+  EXPECT_EQ(0U, StringRef().count('a'));
 }
 
 TEST(StringRefTest, EditDistance) {
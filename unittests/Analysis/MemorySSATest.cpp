@@ -581,6 +581,46 @@ TEST_F(MemorySSATest, RemoveMemoryAccess) {
   EXPECT_TRUE(MSSA.isLiveOnEntryDef(LoadAccess->getDefiningAccess()));
 }
 
+TEST_F(MemorySSATest, RemoveMemoryAccessesBatch) {
+  // Same diamond as RemoveMemoryAccess, but the store and the load are
+  // removed in one batch with phi optimization enabled; the phi that becomes
+  // trivial once the store is gone must be cleaned up at the end of the batch.
+  F = Function::Create(
+      FunctionType::get(B.getVoidTy(), {B.getInt8PtrTy()}, false),
+      GlobalValue::ExternalLinkage, "F", &M);
+  BasicBlock *Entry(BasicBlock::Create(C, "", F));
+  BasicBlock *Left(BasicBlock::Create(C, "", F));
+  BasicBlock *Right(BasicBlock::Create(C, "", F));
+  BasicBlock *Merge(BasicBlock::Create(C, "", F));
+  B.SetInsertPoint(Entry);
+  B.CreateCondBr(B.getTrue(), Left, Right);
+  B.SetInsertPoint(Left);
+  Argument *PointerArg = &*F->arg_begin();
+  StoreInst *StoreInst = B.CreateStore(B.getInt8(16), PointerArg);
+  BranchInst::Create(Merge, Left);
+  BranchInst::Create(Merge, Right);
+  B.SetInsertPoint(Merge);
+  LoadInst *LoadInst = B.CreateLoad(B.getInt8Ty(), PointerArg);
+
+  setupAnalyses();
+  MemorySSA &MSSA = *Analyses->MSSA;
+  MemorySSAUpdater Updater(&MSSA);
+
+  MemoryUse *LoadAccess = cast<MemoryUse>(MSSA.getMemoryAccess(LoadInst));
+  MemoryDef *StoreAccess = cast<MemoryDef>(MSSA.getMemoryAccess(StoreInst));
+  EXPECT_TRUE(isa<MemoryPhi>(LoadAccess->getDefiningAccess()));
+
+  MemoryAccess *Batch[] = {StoreAccess, LoadAccess};
+  Updater.removeMemoryAccesses(Batch, /*OptimizePhis=*/true);
+  MSSA.verifyMemorySSA();
+  // With the store and the load gone, the phi was trivial and should have
+  // been removed by the batched phi optimization.
+  EXPECT_EQ(MSSA.getMemoryAccess(Merge), nullptr);
+  LoadInst->eraseFromParent();
+  StoreInst->eraseFromParent();
+  MSSA.verifyMemorySSA();
+}
+
 // We had a bug with caching where the walker would report MemoryDef#3's clobber
 // (below) was MemoryDef#1.
 //
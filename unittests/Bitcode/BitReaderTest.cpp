@@ -11,8 +11,11 @@
 #include "llvm/AsmParser/Parser.h"
 #include "llvm/Bitcode/BitcodeReader.h"
 #include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/Bitcode/SummaryGUIDTable.h"
 #include "llvm/IR/LLVMContext.h"
+#include "llvm/MC/StringTableBuilder.h"
 #include "llvm/IR/Module.h"
+#include "llvm/IR/ModuleSummaryIndex.h"
 #include "llvm/IR/Verifier.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Error.h"
@@ -121,6 +124,32 @@ TEST(BitReaderTest, MaterializeFunctionsOutOfOrder) {
   EXPECT_FALSE(verifyModule(*M, &dbgs()));
 }
 
+// Tests that a body prefetch hint neither materializes anything nor disturbs
+// later materialization.
+TEST(BitReaderTest, PrefetchFunctionBodies) {
+  SmallString<1024> Mem;
+  LLVMContext Context;
+  std::unique_ptr<Module> M = getLazyModuleFromAssembly(
+      Context, Mem, "define void @f() {\n"
+                    "  unreachable\n"
+                    "}\n"
+                    "define void @g() {\n"
+                    "  unreachable\n"
+                    "}\n");
+  Function *F = M->getFunction("f");
+  Function *G = M->getFunction("g");
+
+  Function *Order[] = {G, F};
+  M->prefetchFunctions(Order);
+  EXPECT_TRUE(F->empty());
+  EXPECT_TRUE(G->empty());
+
+  ASSERT_FALSE(M->materializeAll());
+  EXPECT_FALSE(F->empty());
+  EXPECT_FALSE(G->empty());
+  EXPECT_FALSE(verifyModule(*M, &dbgs()));
+}
+
 TEST(BitReaderTest, MaterializeFunctionsForBlockAddr) { // PR11677
   SmallString<1024> Mem;
 
@@ -190,4 +219,70 @@ TEST(BitReaderTest, MaterializeFunctionsForBlockAddrInFunctionAfter) {
   EXPECT_FALSE(verifyModule(*M, &dbgs()));
 }
 
+// Write two modules against one shared string table plus a
+// string-table-only file, then read them back by attaching the shared table.
+TEST(BitReaderTest, SharedStringTable) {
+  LLVMContext Context;
+  StringTableBuilder SharedStrtab(StringTableBuilder::RAW);
+
+  SmallString<1024> Buf1, Buf2, TabBuf;
+  {
+    BitcodeWriter W1(Buf1, SharedStrtab);
+    W1.writeModule(*parseAssembly(Context, "define void @foo() {\n"
+                                           "  ret void\n"
+                                           "}\n"));
+    BitcodeWriter W2(Buf2, SharedStrtab);
+    W2.writeModule(*parseAssembly(Context, "define void @foo() {\n"
+                                           "  ret void\n"
+                                           "}\n"
+                                           "define void @bar() {\n"
+                                           "  ret void\n"
+                                           "}\n"));
+    // The designated writer emits the accumulated table exactly once.
+    BitcodeWriter WTab(TabBuf, SharedStrtab);
+    WTab.writeStrtab();
+  }
+
+  Expected<BitcodeFileContents> TabContents =
+      getBitcodeFileContents(MemoryBufferRef(TabBuf.str(), "strtab"));
+  ASSERT_TRUE((bool)TabContents);
+  StringRef Strtab = TabContents->Strtab;
+  EXPECT_FALSE(Strtab.empty());
+
+  Expected<BitcodeFileContents> Contents =
+      getBitcodeFileContents(MemoryBufferRef(Buf2.str(), "mod2"));
+  ASSERT_TRUE((bool)Contents);
+  ASSERT_EQ(Contents->Mods.size(), 1u);
+  EXPECT_TRUE(Contents->Mods[0].getStrtab().empty());
+  Contents->Mods[0].setStrtab(Strtab);
+  Expected<std::unique_ptr<Module>> M = Contents->Mods[0].parseModule(Context);
+  ASSERT_TRUE((bool)M);
+  EXPECT_NE((*M)->getFunction("foo"), nullptr);
+  EXPECT_NE((*M)->getFunction("bar"), nullptr);
+  EXPECT_FALSE(verifyModule(**M, &dbgs()));
+}
+
+TEST(BitReaderTest, SummaryGUIDTable) {
+  ModuleSummaryIndex Index(/*HaveGVs=*/false);
+  GlobalValue::GUID Foo = GlobalValue::getGUID("foo");
+  GlobalValue::GUID Bar = GlobalValue::getGUID("bar");
+  Index.getOrInsertValueInfo(Foo);
+  Index.getOrInsertValueInfo(Bar);
+
+  SmallString<64> Buf;
+  raw_svector_ostream OS(Buf);
+  writeSummaryGUIDTable(Index, OS);
+
+  SummaryGUIDTableRef Table;
+  ASSERT_TRUE(Table.init(Buf.str()));
+  EXPECT_EQ(Table.size(), 2u);
+  EXPECT_TRUE(Table.contains(Foo));
+  EXPECT_TRUE(Table.contains(Bar));
+  EXPECT_FALSE(Table.contains(GlobalValue::getGUID("baz")));
+
+  // A truncated or misaligned buffer is rejected.
+  SummaryGUIDTableRef Bad;
+  EXPECT_FALSE(Bad.init(Buf.str().substr(1)));
+}
+
 } // end namespace
@@ -346,6 +346,26 @@ TEST_F(RandomAccessVisitorTest, InnerChunk) {
     EXPECT_TRUE(ValidateVisitedRecord(I.index(), I.value()));
 }
 
+TEST_F(RandomAccessVisitorTest, VisitAllRecords) {
+  // Visit a chunk in the middle of the stream through the random access
+  // interface first, then bulk materialize everything.  All records should be
+  // present afterwards, and none should be double counted.
+  TestState->Offsets = createPartialOffsets(GlobalState->Stream, {0, 4, 9});
+
+  LazyRandomTypeCollection Types(GlobalState->TypeArray,
+                                 GlobalState->TypeVector.size(),
+                                 TestState->Offsets);
+
+  Types.getType(TypeIndex::fromArrayIndex(5));
+  EXPECT_EQ(5u, Types.size());
+
+  Types.visitAllRecords();
+
+  EXPECT_EQ(11u, Types.size());
+  for (uint32_t I = 0; I < 11; ++I)
+    EXPECT_TRUE(ValidateDatabaseRecord(Types, I));
+}
+
 TEST_F(RandomAccessVisitorTest, CrossChunkName) {
   AppendingTypeTableBuilder Builder(GlobalState->Allocator);
 
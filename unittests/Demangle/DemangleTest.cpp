@@ -22,3 +22,23 @@ TEST(Demangle, demangleTest) {
   EXPECT_EQ(demangle("?foo@@YAXH@Z"), "void __cdecl foo(int)");
   EXPECT_EQ(demangle("foo"), "foo");
 }
+
+TEST(Demangle, itaniumDemangleBatchTest) {
+  const char *Names[] = {"_Z3fooi", "not_mangled", "_Z3barv",
+                         "_ZN1a1bIiE3fooEv"};
+  std::vector<std::string> Demangled;
+  EXPECT_EQ(itaniumDemangleBatch(Names, 4, Demangled), 3u);
+  ASSERT_EQ(Demangled.size(), 4u);
+  EXPECT_EQ(Demangled[0], "foo(int)");
+  EXPECT_EQ(Demangled[1], "not_mangled");
+  EXPECT_EQ(Demangled[2], "bar()");
+  EXPECT_EQ(Demangled[3], "a::b<int>::foo()");
+
+  // Appends to whatever is already in the output vector.
+  EXPECT_EQ(itaniumDemangleBatch(Names, 1, Demangled), 1u);
+  ASSERT_EQ(Demangled.size(), 5u);
+  EXPECT_EQ(Demangled[4], "foo(int)");
+
+  EXPECT_EQ(itaniumDemangleBatch(nullptr, 0, Demangled), 0u);
+  EXPECT_EQ(Demangled.size(), 5u);
+}
@@ -186,4 +186,42 @@ TEST(Attributes, StringRepresentation) {
   EXPECT_EQ(A.getAsString(), "byval(i32)");
 }
 
+TEST(Attributes, TargetDependentAttributes) {
+  AttrBuilder B;
+  B.addAttribute("zzz", "1");
+  B.addAttribute("aaa", "2");
+  B.addAttribute("mmm");
+  EXPECT_TRUE(B.contains("aaa"));
+  EXPECT_TRUE(B.contains("mmm"));
+  EXPECT_FALSE(B.contains("nnn"));
+
+  // Re-adding overwrites the value; attributes iterate sorted by name.
+  B.addAttribute("zzz", "3");
+  SmallVector<std::string, 4> Names;
+  for (const auto &TDA : B.td_attrs())
+    Names.push_back(TDA.first);
+  EXPECT_EQ(Names, (SmallVector<std::string, 4>{"aaa", "mmm", "zzz"}));
+
+  AttrBuilder B2;
+  B2.addAttribute("mmm");
+  B.remove(B2);
+  EXPECT_FALSE(B.contains("mmm"));
+  B.removeAttribute("aaa");
+  EXPECT_FALSE(B.contains("aaa"));
+  EXPECT_TRUE(B.contains("zzz"));
+
+  B2.clear();
+  B2.merge(B);
+  EXPECT_TRUE(B2.contains("zzz"));
+
+  // Function-only attribute lists built through different paths unique to
+  // the same list.
+  LLVMContext C;
+  AttributeList AL1 =
+      AttributeList::get(C, AttributeList::FunctionIndex, B2);
+  AttributeList AL2 =
+      AttributeList::get(C, AttributeList::FunctionIndex, B2);
+  EXPECT_EQ(AL1, AL2);
+}
+
 } // end anonymous namespace
@@ -129,5 +129,27 @@ TEST(BasicBlockTest, TestInstructionsWithoutDebug) {
   delete V;
 }
 
+TEST(BasicBlockTest, ArenaRecycling) {
+  LLVMContext Ctx;
+
+  // Deleted blocks are recycled by later creations within the same context.
+  BasicBlock *BB = BasicBlock::Create(Ctx, "first");
+  void *Storage = BB;
+  delete BB;
+  BasicBlock *Recycled = BasicBlock::Create(Ctx, "second");
+  EXPECT_EQ(static_cast<void *>(Recycled), Storage);
+  EXPECT_EQ(Recycled->getName(), "second");
+  delete Recycled;
+
+  // Blocks owned by a function are released through the same path when the
+  // function goes away.
+  Module M("MyModule", Ctx);
+  FunctionType *FT = FunctionType::get(Type::getVoidTy(Ctx), false);
+  Function *F = Function::Create(FT, Function::ExternalLinkage, "f", M);
+  for (unsigned I = 0; I != 8; ++I)
+    BasicBlock::Create(Ctx, "", F);
+  F->eraseFromParent();
+}
+
 } // End anonymous namespace.
 } // End llvm namespace.
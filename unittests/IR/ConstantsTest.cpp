@@ -9,6 +9,7 @@
 #include "llvm/IR/Constants.h"
 #include "llvm-c/Core.h"
 #include "llvm/AsmParser/Parser.h"
+#include "llvm/Config/llvm-config.h"
 #include "llvm/IR/DerivedTypes.h"
 #include "llvm/IR/InstrTypes.h"
 #include "llvm/IR/Instruction.h"
@@ -16,6 +17,8 @@
 #include "llvm/IR/Module.h"
 #include "llvm/Support/SourceMgr.h"
 #include "gtest/gtest.h"
+#include <thread>
+#include <vector>
 
 namespace llvm {
 namespace {
@@ -585,5 +588,32 @@ TEST(ConstantsTest, FoldGlobalVariablePtr) {
       Instruction::And, TheConstantExpr, TheConstant)->isNullValue());
 }
 
+#if LLVM_ENABLE_THREADS
+TEST(ConstantsTest, ConcurrentUniquing) {
+  LLVMContext Context;
+
+  // Several threads uniquing the same values through one shared context must
+  // all get the same ConstantInt/ConstantFP objects back.
+  const unsigned NumThreads = 4;
+  const unsigned NumValues = 256;
+  std::vector<std::vector<Constant *>> Seen(NumThreads);
+
+  std::vector<std::thread> Threads;
+  for (unsigned T = 0; T != NumThreads; ++T)
+    Threads.emplace_back([T, &Seen, &Context] {
+      for (unsigned I = 0; I != NumValues; ++I) {
+        Seen[T].push_back(ConstantInt::get(Context, APInt(33, I)));
+        Seen[T].push_back(
+            ConstantFP::get(Context, APFloat(double(I) + 0.5)));
+      }
+    });
+  for (std::thread &Thread : Threads)
+    Thread.join();
+
+  for (unsigned T = 1; T != NumThreads; ++T)
+    EXPECT_EQ(Seen[T], Seen[0]);
+}
+#endif
+
 }  // end anonymous namespace
 }  // end namespace llvm
@@ -56,4 +56,16 @@ TEST(DataLayoutTest, ValueOrABITypeAlignment) {
             DL.getValueOrABITypeAlignment(MaybeAlign(), FourByteAlignType));
 }
 
+TEST(DataLayoutTest, SharedParsedInstance) {
+  const DataLayout &A = DataLayout::get("e-p:64:64");
+  const DataLayout &B = DataLayout::get("e-p:64:64");
+  EXPECT_EQ(&A, &B);
+  EXPECT_NE(&A, &DataLayout::get("E-p:32:32"));
+  EXPECT_EQ(A.getStringRepresentation(), "e-p:64:64");
+
+  // Copies made from the shared instance behave like freshly parsed ones.
+  DataLayout Copy = A;
+  EXPECT_EQ(Copy, DataLayout("e-p:64:64"));
+}
+
 }  // anonymous namespace
@@ -10,6 +10,7 @@
 #include "llvm/Analysis/PostDominators.h"
 #include "llvm/Analysis/IteratedDominanceFrontier.h"
 #include "llvm/AsmParser/Parser.h"
+#include "llvm/IR/CFGUpdateJournal.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Dominators.h"
 #include "llvm/IR/Instructions.h"
@@ -989,3 +990,45 @@ TEST(DominatorTree, InsertIntoIrreducible) {
   EXPECT_TRUE(DT.verify());
 }
 
+
+TEST(DominatorTree, CFGUpdateJournal) {
+  StringRef ModuleString = "define void @f(i1 %cond) {\n"
+                           "Entry:\n"
+                           "  br i1 %cond, label %A, label %B\n"
+                           "A:\n"
+                           "  br label %C\n"
+                           "B:\n"
+                           "  br label %C\n"
+                           "C:\n"
+                           "  ret void\n"
+                           "}\n";
+
+  LLVMContext Context;
+  std::unique_ptr<Module> M = makeLLVMModule(Context, ModuleString);
+
+  runWithDomTree(
+      *M, "f", [&](Function &F, DominatorTree *DT, PostDominatorTree *PDT) {
+        Function::iterator FI = F.begin();
+        BasicBlock *Entry = &*FI++;
+        BasicBlock *A = &*FI++;
+        BasicBlock *B = &*FI++;
+        BasicBlock *C = &*FI++;
+
+        // While the journal is attached, redirecting Entry's false edge from
+        // B to A is recorded by the IR utilities themselves.
+        CFGUpdateJournal Journal;
+        F.setCFGUpdateJournal(&Journal);
+        B->removePredecessor(Entry);
+        Entry->getTerminator()->replaceSuccessorWith(B, A);
+        F.setCFGUpdateJournal(nullptr);
+
+        EXPECT_FALSE(Journal.empty());
+        DT->applyUpdates(Journal.updates());
+        PDT->applyUpdates(Journal.updates());
+        Journal.clear();
+
+        EXPECT_TRUE(DT->verify());
+        EXPECT_TRUE(PDT->verify());
+        EXPECT_TRUE(DT->dominates(DT->getNode(A), DT->getNode(C)));
+      });
+}
@@ -207,6 +207,21 @@ TEST_F(MDNodeTest, Simple) {
   EXPECT_EQ(n1, n2->getOperand(0));
 }
 
+TEST_F(MDNodeTest, ReserveUniquingCapacity) {
+  // Uniquing still returns identical nodes after pre-sizing the stores.
+  MDNode *Before = getNode(MDString::get(Context, "reserved"));
+  MDNode::reserveUniquingCapacity(Context, Metadata::MDTupleKind, 1024);
+  MDNode::reserveUniquingCapacity(Context, Metadata::DILocationKind, 512);
+  EXPECT_EQ(Before, getNode(MDString::get(Context, "reserved")));
+
+  DISubprogram *SP = getSubprogram();
+  DILocation *L1 = DILocation::get(Context, 2, 7, SP);
+  EXPECT_EQ(L1, DILocation::get(Context, 2, 7, SP));
+
+  // Kinds without a uniquing store are ignored.
+  MDNode::reserveUniquingCapacity(Context, Metadata::MDStringKind, 16);
+}
+
 TEST_F(MDNodeTest, Delete) {
   Constant *C = ConstantInt::get(Type::getInt32Ty(Context), 1);
   Instruction *I = new BitCastInst(C, Type::getInt32Ty(Context));
@@ -8,6 +8,7 @@
 
 #include "llvm/IR/Value.h"
 #include "llvm/AsmParser/Parser.h"
+#include "llvm/IR/Constants.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Module.h"
@@ -43,6 +44,64 @@ TEST(ValueTest, UsedInBasicBlock) {
   EXPECT_TRUE(F->arg_begin()->isUsedInBasicBlock(&F->front()));
 }
 
+TEST(ValueTest, UniqueNameSuffixesPerBase) {
+  LLVMContext C;
+
+  const char *ModuleString = "define void @f(i32 %x, i32 %y) {\n"
+                             "bb0:\n"
+                             "  ret void\n"
+                             "}\n";
+  SMDiagnostic Err;
+  std::unique_ptr<Module> M = parseAssemblyString(ModuleString, Err, C);
+  Function *F = M->getFunction("f");
+  Argument *X = F->arg_begin();
+  Argument *Y = std::next(F->arg_begin());
+
+  // Suffix counters are kept per base name, so each colliding base counts up
+  // independently.  Local values get a bare numeric suffix; only globals get
+  // the "." separator.
+  X->setName("x");
+  Y->setName("x");
+  EXPECT_EQ(Y->getName(), "x1");
+  Y->setName("x");
+  EXPECT_EQ(Y->getName(), "x2");
+  Y->setName("y");
+  X->setName("y");
+  EXPECT_EQ(X->getName(), "y1");
+}
+
+TEST(ValueTest, DiscardConstantDataUseLists) {
+  LLVMContext C;
+  C.setDiscardConstantDataUseLists(true);
+
+  const char *ModuleString = "define i32 @f(i32 %x) {\n"
+                             "  %a = add i32 %x, 42\n"
+                             "  %b = add i32 %a, 42\n"
+                             "  ret i32 %b\n"
+                             "}\n";
+  SMDiagnostic Err;
+  std::unique_ptr<Module> M = parseAssemblyString(ModuleString, Err, C);
+  ASSERT_TRUE(M);
+  Function *F = M->getFunction("f");
+  BasicBlock &BB = F->front();
+  auto It = BB.begin();
+  Instruction &A = *It++;
+  Instruction &B = *It;
+
+  // Both adds reference i32 42, but the shared constant records no uses.
+  Constant *C42 = cast<Constant>(A.getOperand(1));
+  EXPECT_EQ(C42, B.getOperand(1));
+  EXPECT_TRUE(C42->use_empty());
+
+  // Non-ConstantData values still track their uses.
+  EXPECT_FALSE(A.use_empty());
+  EXPECT_TRUE(F->arg_begin()->hasOneUse());
+
+  // Overwriting an operand that held such a constant is still safe.
+  B.setOperand(1, ConstantInt::get(Type::getInt32Ty(C), 7));
+  EXPECT_TRUE(C42->use_empty());
+}
+
 TEST(GlobalTest, CreateAddressSpace) {
   LLVMContext Ctx;
   std::unique_ptr<Module> M(new Module("TestModule", Ctx));
@@ -45,6 +45,38 @@ TEST(VerifierTest, Branch_i1) {
   EXPECT_TRUE(verifyFunction(*F));
 }
 
+TEST(VerifierTest, IncrementalVerification) {
+  LLVMContext C;
+  Module M("M", C);
+  FunctionType *FTy = FunctionType::get(Type::getVoidTy(C), /*isVarArg=*/false);
+  Function *F = Function::Create(FTy, Function::ExternalLinkage, "foo", M);
+
+  // Attaching blocks and instructions moves the modification epoch.
+  uint64_t DeclEpoch = F->getModificationEpoch();
+  BasicBlock *Entry = BasicBlock::Create(C, "entry", F);
+  BasicBlock *Exit = BasicBlock::Create(C, "exit", F);
+  ReturnInst::Create(C, Exit);
+  BranchInst *BI =
+      BranchInst::Create(Exit, Exit, ConstantInt::getFalse(C), Entry);
+  EXPECT_GT(F->getModificationEpoch(), DeclEpoch);
+
+  IncrementalVerifier IV;
+  EXPECT_FALSE(IV.verifyModule(M));
+
+  // Redirecting the branch condition in place breaks the function without
+  // moving its epoch; the incremental driver keeps trusting the last clean
+  // verification until the change is noted.
+  BI->setOperand(0, ConstantInt::get(IntegerType::get(C, 32), 0));
+  EXPECT_TRUE(verifyModule(M));
+  EXPECT_FALSE(IV.verifyModule(M));
+
+  F->noteModification();
+  EXPECT_TRUE(IV.verifyModule(M));
+
+  // Broken functions stay dirty and are re-checked on the next run.
+  EXPECT_TRUE(IV.verifyModule(M));
+}
+
 TEST(VerifierTest, InvalidRetAttribute) {
   LLVMContext C;
   Module M("M", C);
@@ -76,6 +76,39 @@ TEST(StringTableBuilderTest, BasicWinCOFF) {
   EXPECT_EQ(23U, B.getOffset("river horse"));
 }
 
+TEST(StringTableBuilderTest, ELFIncremental) {
+  StringTableBuilder B(StringTableBuilder::ELF);
+
+  B.add("foo");
+  B.add("foobar");
+
+  B.finalize();
+
+  // Existing strings keep their offsets; new ones are appended without
+  // suffix merging.
+  size_t OldFoobar = B.getOffset("foobar");
+  size_t OldFoo = B.getOffset("foo");
+  EXPECT_EQ(OldFoobar, B.addIncremental("foobar"));
+  EXPECT_EQ(OldFoo, B.addIncremental("foo"));
+  EXPECT_EQ(12U, B.addIncremental("bar"));
+  EXPECT_EQ(12U, B.getOffset("bar"));
+
+  std::string Expected;
+  Expected += '\x00';
+  Expected += "foobar";
+  Expected += '\x00';
+  Expected += "foo";
+  Expected += '\x00';
+  Expected += "bar";
+  Expected += '\x00';
+
+  SmallString<64> Data;
+  raw_svector_ostream OS(Data);
+  B.write(OS);
+
+  EXPECT_EQ(Expected, Data);
+}
+
 TEST(StringTableBuilderTest, ELFInOrder) {
   StringTableBuilder B(StringTableBuilder::ELF);
   EXPECT_EQ(1U, B.add("foo"));
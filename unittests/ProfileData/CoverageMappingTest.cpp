@@ -228,7 +228,8 @@ struct CoverageMappingTest : ::testing::TestWithParam<std::pair<bool, bool>> {
     ProfileReader = std::move(ReaderOrErr.get());
   }
 
-  Expected<std::unique_ptr<CoverageMapping>> readOutputFunctions() {
+  Expected<std::unique_ptr<CoverageMapping>>
+  readOutputFunctions(ArrayRef<StringRef> SourceFiles = None) {
     std::vector<std::unique_ptr<CoverageMappingReader>> CoverageReaders;
     if (UseMultipleReaders) {
       for (const auto &OF : OutputFunctions) {
@@ -241,13 +242,14 @@ struct CoverageMappingTest : ::testing::TestWithParam<std::pair<bool, bool>> {
       CoverageReaders.push_back(
           std::make_unique<CoverageMappingReaderMock>(Funcs));
     }
-    return CoverageMapping::load(CoverageReaders, *ProfileReader);
+    return CoverageMapping::load(CoverageReaders, *ProfileReader, SourceFiles);
   }
 
-  Error loadCoverageMapping(bool EmitFilenames = true) {
+  Error loadCoverageMapping(bool EmitFilenames = true,
+                            ArrayRef<StringRef> SourceFiles = None) {
     readProfCounts();
     writeAndReadCoverageRegions(EmitFilenames);
-    auto CoverageOrErr = readOutputFunctions();
+    auto CoverageOrErr = readOutputFunctions(SourceFiles);
     if (!CoverageOrErr)
       return CoverageOrErr.takeError();
     LoadedCoverage = std::move(CoverageOrErr.get());
@@ -364,6 +366,29 @@ TEST_P(CoverageMappingTest, load_coverage_for_several_functions) {
   }
 }
 
+TEST_P(CoverageMappingTest, load_coverage_only_for_requested_files) {
+  ProfileWriter.addRecord({"func1", 0x1234, {10}}, Err);
+  ProfileWriter.addRecord({"func2", 0x2345, {20}}, Err);
+
+  startFunction("func1", 0x1234);
+  addCMR(Counter::getCounter(0), "foo", 1, 1, 5, 5);
+
+  startFunction("func2", 0x2345);
+  addCMR(Counter::getCounter(0), "bar", 2, 2, 6, 6);
+
+  // Requested files are matched by their last path component.
+  StringRef SourceFiles[] = {"some/dir/foo"};
+  EXPECT_THAT_ERROR(loadCoverageMapping(/*EmitFilenames=*/true, SourceFiles),
+                    Succeeded());
+
+  unsigned NumRecords = 0;
+  for (const auto &FunctionRecord : LoadedCoverage->getCoveredFunctions()) {
+    ++NumRecords;
+    EXPECT_EQ("func1", FunctionRecord.Name);
+  }
+  EXPECT_EQ(1U, NumRecords);
+}
+
 TEST_P(CoverageMappingTest, create_combined_regions) {
   ProfileWriter.addRecord({"func1", 0x1234, {1, 2, 3}}, Err);
   startFunction("func1", 0x1234);
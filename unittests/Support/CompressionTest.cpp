@@ -65,6 +65,39 @@ TEST(CompressionTest, Zlib) {
   TestZlibCompression(BinaryDataStr, zlib::DefaultCompression);
 }
 
+void TestZlibParallelCompression(StringRef Input, int Level,
+                                 size_t ChunkSize) {
+  SmallString<32> Compressed;
+  SmallString<32> Uncompressed;
+
+  Error E = zlib::compressParallel(Input, Compressed, Level, ChunkSize);
+  EXPECT_FALSE(E);
+  consumeError(std::move(E));
+
+  // The stitched stream must inflate with the ordinary serial path.
+  E = zlib::uncompress(Compressed, Uncompressed, Input.size());
+  EXPECT_FALSE(E);
+  consumeError(std::move(E));
+
+  EXPECT_EQ(Input, Uncompressed);
+}
+
+TEST(CompressionTest, ZlibParallel) {
+  // Repetitive input spanning several chunks; a small chunk size exercises
+  // the stitched multi-chunk path without needing megabytes of test data.
+  std::string Input;
+  while (Input.size() < 10 * 4096)
+    Input += "The quick brown fox jumps over the lazy dog. ";
+
+  for (int Level : {zlib::NoCompression, zlib::BestSpeedCompression,
+                    zlib::DefaultCompression, zlib::BestSizeCompression})
+    TestZlibParallelCompression(Input, Level, /*ChunkSize=*/4096);
+
+  // Inputs no larger than a chunk take the serial fallback.
+  TestZlibParallelCompression("hello, world!", zlib::DefaultCompression, 4096);
+  TestZlibParallelCompression("", zlib::DefaultCompression, 4096);
+}
+
 TEST(CompressionTest, ZlibCRC32) {
   EXPECT_EQ(
       0x414FA339U,
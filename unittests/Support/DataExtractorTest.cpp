@@ -117,6 +117,25 @@ TEST(DataExtractorTest, LEB128) {
   EXPECT_EQ(8U, offset);
 }
 
+TEST(DataExtractorTest, ULEB128Array) {
+  DataExtractor DE(StringRef("\x01\xa6\x49\x7f\x02", 5), false, 8);
+  uint64_t Offset = 0;
+  uint64_t Values[4];
+  EXPECT_EQ(4u, DE.getULEB128Array(&Offset, Values));
+  EXPECT_EQ(5u, Offset);
+  EXPECT_EQ(1u, Values[0]);
+  EXPECT_EQ(9382u, Values[1]);
+  EXPECT_EQ(0x7fu, Values[2]);
+  EXPECT_EQ(2u, Values[3]);
+
+  // Truncated input sets the error and reports a short count.
+  DataExtractor Bad(StringRef("\x01\x81", 2), false, 8);
+  Offset = 0;
+  Error Err = Error::success();
+  EXPECT_EQ(1u, Bad.getULEB128Array(&Offset, Values, &Err));
+  EXPECT_THAT_ERROR(std::move(Err), Failed());
+}
+
 TEST(DataExtractorTest, LEB128_error) {
   DataExtractor DE(StringRef("\x81"), false, 8);
   uint64_t Offset = 0;
@@ -194,6 +194,59 @@ TEST(JSONTest, ParseErrors) {
   ExpectErr("Invalid UTF-8 sequence", "\"\xC0\x80\""); // WTF-8 null
 }
 
+// Records each event as a compact token so whole parses compare as strings.
+struct EventRecorder : public ParseHandler {
+  std::string Events;
+  bool onNull() override { return log("null"); }
+  bool onBool(bool V) override { return log(V ? "true" : "false"); }
+  bool onInteger(int64_t V) override { return log("int:" + std::to_string(V)); }
+  bool onNumber(double V) override { return log("num:" + std::to_string(V)); }
+  bool onString(StringRef V) override { return log(("str:" + V).str()); }
+  bool onObjectBegin() override { return log("{"); }
+  bool onObjectKey(StringRef K) override { return log(("key:" + K).str()); }
+  bool onObjectEnd() override { return log("}"); }
+  bool onArrayBegin() override { return log("["); }
+  bool onArrayEnd() override { return log("]"); }
+
+  bool log(StringRef Event) {
+    if (!Events.empty())
+      Events += " ";
+    Events += Event;
+    return true;
+  }
+};
+
+TEST(JSONTest, SAXParse) {
+  EventRecorder Recorder;
+  ASSERT_FALSE(bool(parse(
+      R"({"a": [1, 2.5, "x\n", true], "b": null, "c": {}})", Recorder)));
+  EXPECT_EQ("{ key:a [ int:1 num:2.500000 str:x\n true ] key:b null "
+            "key:c { } }",
+            Recorder.Events);
+
+  // Syntax errors surface in the same way as the DOM parser's.
+  EventRecorder Recorder2;
+  llvm::Error E = parse("[1,]", Recorder2);
+  ASSERT_TRUE(bool(E));
+  handleAllErrors(std::move(E), [](const llvm::ErrorInfoBase &EI) {
+    EXPECT_THAT(EI.message(), testing::HasSubstr("Invalid JSON value"));
+  });
+}
+
+TEST(JSONTest, SAXParseAbort) {
+  // Returning false from a callback stops the parse with an error.
+  struct : public ParseHandler {
+    unsigned Ints = 0;
+    bool onInteger(int64_t) override { return ++Ints < 2; }
+  } Handler;
+  llvm::Error E = parse("[1, 2, 3]", Handler);
+  ASSERT_TRUE(bool(E));
+  handleAllErrors(std::move(E), [](const llvm::ErrorInfoBase &EI) {
+    EXPECT_THAT(EI.message(), testing::HasSubstr("aborted by handler"));
+  });
+  EXPECT_EQ(2u, Handler.Ints);
+}
+
 // Direct tests of isUTF8 and fixUTF8. Internal uses are also tested elsewhere.
 TEST(JSONTest, UTF8) {
   for (const char *Valid : {
@@ -78,6 +78,40 @@ TEST(KnownBitsTest, AddCarryExhaustive) {
   });
 }
 
+TEST(KnownBitsTest, AddCarryWideWidths) {
+  // computeForAddCarry has one-word and two-word fast paths. Replay a small
+  // exhaustive pattern in the top bits of wider integers and check that the
+  // wide result agrees with the narrow one validated exhaustively above.
+  const unsigned Small = 4;
+  KnownBits NoCarry(1);
+  NoCarry.Zero.setAllBits();
+  for (unsigned Bits : {64u, 100u, 128u}) {
+    unsigned Shift = Bits - Small;
+    ForeachKnownBits(Small, [&](const KnownBits &Known1) {
+      ForeachKnownBits(Small, [&](const KnownBits &Known2) {
+        KnownBits Wide1(Bits), Wide2(Bits);
+        Wide1.Zero = Known1.Zero.zext(Bits).shl(Shift);
+        Wide1.One = Known1.One.zext(Bits).shl(Shift);
+        Wide2.Zero = Known2.Zero.zext(Bits).shl(Shift);
+        Wide2.One = Known2.One.zext(Bits).shl(Shift);
+        // The low bits are known zero, so no carry reaches the top nibble
+        // and the wide sum is exactly the narrow sum shifted up.
+        Wide1.Zero.setLowBits(Shift);
+        Wide2.Zero.setLowBits(Shift);
+
+        KnownBits Narrow =
+            KnownBits::computeForAddCarry(Known1, Known2, NoCarry);
+        KnownBits Wide = KnownBits::computeForAddCarry(Wide1, Wide2, NoCarry);
+
+        APInt ExpectedZero = Narrow.Zero.zext(Bits).shl(Shift);
+        ExpectedZero.setLowBits(Shift);
+        EXPECT_EQ(ExpectedZero, Wide.Zero);
+        EXPECT_EQ(Narrow.One.zext(Bits).shl(Shift), Wide.One);
+      });
+    });
+  }
+}
+
 static void TestAddSubExhaustive(bool IsAdd) {
   unsigned Bits = 4;
   ForeachKnownBits(Bits, [&](const KnownBits &Known1) {
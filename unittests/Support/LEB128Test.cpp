@@ -138,6 +138,46 @@ TEST(LEB128Test, DecodeULEB128) {
 #undef EXPECT_DECODE_ULEB128_EQ
 }
 
+TEST(LEB128Test, DecodeULEB128Array) {
+  // A mix of single-byte and multi-byte values, with a long buffer so the
+  // unchecked middle path is taken, then values near the end so the checked
+  // tail path runs too.
+  const char Input[] = "\x00\x7f\x80\x01\x80\xc1\x80\x80\x10\x01\x02\x03"
+                       "\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01\x3f";
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(Input);
+  const uint8_t *End = p + sizeof(Input) - 1;
+  uint64_t Values[9];
+  const char *Error = nullptr;
+  EXPECT_EQ(9u, decodeULEB128Array(p, End, Values, &Error));
+  EXPECT_EQ(nullptr, Error);
+  EXPECT_EQ(End, p);
+  EXPECT_EQ(0u, Values[0]);
+  EXPECT_EQ(0x7fu, Values[1]);
+  EXPECT_EQ(0x80u, Values[2]);
+  EXPECT_EQ(4294975616ULL, Values[3]);
+  EXPECT_EQ(1u, Values[4]);
+  EXPECT_EQ(2u, Values[5]);
+  EXPECT_EQ(3u, Values[6]);
+  EXPECT_EQ(0xffffffffffffffffULL, Values[7]);
+  EXPECT_EQ(0x3fu, Values[8]);
+
+  // Input that runs out mid-array stops short without error text.
+  const char Short[] = "\x01\x80";
+  p = reinterpret_cast<const uint8_t *>(Short);
+  End = p + sizeof(Short) - 1;
+  Error = nullptr;
+  EXPECT_EQ(1u, decodeULEB128Array(p, End, Values, &Error));
+  EXPECT_NE(nullptr, Error);
+
+  // An over-long encoding reports an error.
+  const char TooBig[] = "\x80\x80\x80\x80\x80\x80\x80\x80\x80\x80\x02\x00";
+  p = reinterpret_cast<const uint8_t *>(TooBig);
+  End = p + sizeof(TooBig) - 1;
+  Error = nullptr;
+  EXPECT_EQ(0u, decodeULEB128Array(p, End, Values, &Error));
+  EXPECT_NE(nullptr, Error);
+}
+
 TEST(LEB128Test, DecodeSLEB128) {
 #define EXPECT_DECODE_SLEB128_EQ(EXPECTED, VALUE) \
   do { \
@@ -148,6 +148,31 @@ TEST_F(MemoryBufferTest, NullTerminator4K) {
   EXPECT_EQ('\0', BufData[4096]);
 }
 
+TEST_F(MemoryBufferTest, getFileWithReadahead) {
+  // Write out a file large enough to be mmap'ed rather than read.
+  int TestFD;
+  SmallString<64> TestPath;
+  sys::fs::createTemporaryFile("MemoryBufferTest_Readahead", "temp", TestFD,
+                               TestPath);
+  FileRemover Cleanup(TestPath);
+  raw_fd_ostream OF(TestFD, true, /*unbuffered=*/true);
+  for (unsigned i = 0; i < 8 * 4096 / 16; ++i)
+    OF << "0123456789abcdef";
+  OF.close();
+
+  ErrorOr<OwningBuffer> MB = MemoryBuffer::getFileWithReadahead(TestPath);
+  ASSERT_NO_ERROR(MB.getError());
+  EXPECT_EQ(8u * 4096u, MB.get()->getBufferSize());
+  EXPECT_EQ('f', MB.get()->getBufferStart()[8 * 4096 - 1]);
+
+  // The hints are best effort: they must be safe to apply to any buffer,
+  // including ones that are not mmap'ed at all.
+  MB.get()->adviseAccessPattern(MemoryBuffer::AccessPattern::Normal);
+  OwningBuffer Copy(MemoryBuffer::getMemBufferCopy(data));
+  EXPECT_FALSE(
+      Copy->adviseAccessPattern(MemoryBuffer::AccessPattern::Sequential));
+}
+
 TEST_F(MemoryBufferTest, copy) {
   // copy with no name
   OwningBuffer MBC1(MemoryBuffer::getMemBufferCopy(data));
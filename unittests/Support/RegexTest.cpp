@@ -126,6 +126,26 @@ TEST_F(RegexTest, IsLiteralERE) {
   EXPECT_FALSE(Regex::isLiteralERE("abc{1,2}"));
 }
 
+TEST_F(RegexTest, GetCached) {
+  const Regex &R1 = Regex::getCached("^[0-9]+$");
+  EXPECT_TRUE(R1.match("916"));
+  EXPECT_FALSE(R1.match("9a6"));
+
+  // Same pattern and flags share one compiled form.
+  EXPECT_EQ(&R1, &Regex::getCached("^[0-9]+$"));
+
+  // Different flags get their own compiled form.
+  const Regex &R2 = Regex::getCached("^ab$", Regex::IgnoreCase);
+  EXPECT_NE(&R2, &Regex::getCached("^ab$"));
+  EXPECT_TRUE(R2.match("AB"));
+  EXPECT_FALSE(Regex::getCached("^ab$").match("AB"));
+
+  // Invalid patterns are cached as-is and report their error.
+  std::string Error;
+  EXPECT_FALSE(Regex::getCached("(foo").isValid(Error));
+  EXPECT_EQ("parentheses not balanced", Error);
+}
+
 TEST_F(RegexTest, Escape) {
   EXPECT_EQ("a\\[bc\\]", Regex::escape("a[bc]"));
   EXPECT_EQ("abc\\{1\\\\,2\\}", Regex::escape("abc{1\\,2}"));
@@ -16,6 +16,8 @@
 
 #include "gtest/gtest.h"
 
+#include <thread>
+
 using namespace llvm;
 
 // Fixture for the unittests, allowing to *temporarily* disable the unittests
@@ -115,6 +117,33 @@ TEST_F(ThreadPoolTest, AsyncBarrierArgs) {
   ASSERT_EQ(10, checked_in);
 }
 
+TEST_F(ThreadPoolTest, AsyncWeighted) {
+  CHECK_UNSUPPORTED();
+  // Heavier tasks must be dispatched before lighter ones. Use a single-thread
+  // pool gated on the main thread so all tasks are queued before any runs.
+  ThreadPool Pool{1};
+  std::mutex OrderLock;
+  std::vector<int> Order;
+  std::atomic_bool GateRunning{false};
+  Pool.async([this, &GateRunning] {
+    GateRunning = true;
+    waitForMainThread();
+  });
+  // Don't queue the weighted tasks until the worker is parked in the gate
+  // task, or one of them could be dispatched ahead of it.
+  while (!GateRunning)
+    std::this_thread::yield();
+  for (int i = 0; i < 4; ++i) {
+    Pool.asyncWeighted(i, [i, &OrderLock, &Order] {
+      std::lock_guard<std::mutex> Guard(OrderLock);
+      Order.push_back(i);
+    });
+  }
+  setMainThreadReady();
+  Pool.wait();
+  ASSERT_EQ(std::vector<int>({3, 2, 1, 0}), Order);
+}
+
 TEST_F(ThreadPoolTest, Async) {
   CHECK_UNSUPPORTED();
   ThreadPool Pool;
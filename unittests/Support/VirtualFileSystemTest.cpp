@@ -223,6 +223,44 @@ TEST(VirtualFileSystemTest, StatusQueries) {
   EXPECT_FALSE(Status->equivalent(*Status2));
 }
 
+namespace {
+// Counts the status() calls that reach the underlying file system.
+struct StatCountingFileSystem : public DummyFileSystem {
+  unsigned StatCalls = 0;
+  ErrorOr<vfs::Status> status(const Twine &Path) override {
+    ++StatCalls;
+    return DummyFileSystem::status(Path);
+  }
+};
+} // end anonymous namespace
+
+TEST(VirtualFileSystemTest, StatCache) {
+  IntrusiveRefCntPtr<StatCountingFileSystem> Counting(
+      new StatCountingFileSystem());
+  Counting->addRegularFile("/foo");
+  vfs::StatCachingFileSystem Cache(Counting);
+
+  // Positive results are cached.
+  EXPECT_TRUE(Cache.status("/foo"));
+  EXPECT_TRUE(Cache.status("/foo"));
+  EXPECT_EQ(1u, Counting->StatCalls);
+
+  // Negative results are cached too.
+  EXPECT_FALSE(Cache.status("/missing"));
+  EXPECT_FALSE(Cache.status("/missing"));
+  EXPECT_EQ(2u, Counting->StatCalls);
+
+  // Invalidation makes all entries stale at once.
+  Cache.invalidateStatCache();
+  EXPECT_TRUE(Cache.status("/foo"));
+  EXPECT_EQ(3u, Counting->StatCalls);
+
+  // Changing the working directory invalidates as well.
+  Cache.setCurrentWorkingDirectory("/elsewhere");
+  EXPECT_FALSE(Cache.status("/missing"));
+  EXPECT_EQ(4u, Counting->StatCalls);
+}
+
 TEST(VirtualFileSystemTest, BaseOnlyOverlay) {
   IntrusiveRefCntPtr<DummyFileSystem> D(new DummyFileSystem());
   ErrorOr<vfs::Status> Status((std::error_code()));
@@ -0,0 +1,89 @@
+//===- llvm/unittest/Support/raw_mmap_ostream_test.cpp --------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/raw_mmap_ostream.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Testing/Support/Error.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+#define ASSERT_NO_ERROR(x)                                                     \
+  if (std::error_code ASSERT_NO_ERROR_ec = x) {                                \
+    SmallString<128> MessageStorage;                                           \
+    raw_svector_ostream Message(MessageStorage);                               \
+    Message << #x ": did not return errc::success.\n"                         \
+            << "error number: " << ASSERT_NO_ERROR_ec.value() << "\n"         \
+            << "error message: " << ASSERT_NO_ERROR_ec.message() << "\n";     \
+    GTEST_FATAL_FAILURE_(MessageStorage.c_str());                              \
+  } else {                                                                     \
+  }
+
+namespace {
+
+TEST(raw_mmap_ostreamTest, WriteGrowAndCommit) {
+  SmallString<128> Dir;
+  ASSERT_NO_ERROR(sys::fs::createUniqueDirectory("mmap-ostream-test", Dir));
+  SmallString<128> Path(Dir);
+  sys::path::append(Path, "out.bin");
+
+  {
+    // A tiny hint forces at least one ftruncate+remap growth cycle.
+    auto OSOrErr = raw_mmap_ostream::create(Path, /*SizeHint=*/16);
+    ASSERT_THAT_EXPECTED(OSOrErr, Succeeded());
+    raw_mmap_ostream &OS = **OSOrErr;
+
+    std::string Line = "0123456789abcdef";
+    for (int I = 0; I < 1024; ++I)
+      OS << Line;
+    EXPECT_EQ(Line.size() * 1024, OS.tell());
+
+    // Patch the first bytes through the pwrite interface.
+    OS.pwrite("XXXX", 4, 0);
+    ASSERT_THAT_ERROR(OS.commit(), Succeeded());
+  }
+
+  auto BufOrErr = MemoryBuffer::getFile(Path);
+  ASSERT_NO_ERROR(BufOrErr.getError());
+  StringRef Data = (*BufOrErr)->getBuffer();
+  EXPECT_EQ(16u * 1024, Data.size());
+  EXPECT_TRUE(Data.startswith("XXXX456789abcdef"));
+  EXPECT_TRUE(Data.endswith("0123456789abcdef"));
+
+  ASSERT_NO_ERROR(sys::fs::remove(Path));
+  ASSERT_NO_ERROR(sys::fs::remove(Dir));
+}
+
+TEST(raw_mmap_ostreamTest, DiscardWithoutCommit) {
+  SmallString<128> Dir;
+  ASSERT_NO_ERROR(sys::fs::createUniqueDirectory("mmap-ostream-test", Dir));
+  SmallString<128> Path(Dir);
+  sys::path::append(Path, "out.bin");
+
+  {
+    auto OSOrErr = raw_mmap_ostream::create(Path);
+    ASSERT_THAT_EXPECTED(OSOrErr, Succeeded());
+    **OSOrErr << "discarded";
+  }
+
+  // No commit(): the destination must not exist and the temporary is gone.
+  EXPECT_FALSE(sys::fs::exists(Path));
+  std::error_code EC;
+  int NumFiles = 0;
+  for (sys::fs::directory_iterator I(Dir, EC), E; I != E && !EC;
+       I.increment(EC))
+    ++NumFiles;
+  EXPECT_EQ(0, NumFiles);
+
+  ASSERT_NO_ERROR(sys::fs::remove(Dir));
+}
+
+} // end anonymous namespace
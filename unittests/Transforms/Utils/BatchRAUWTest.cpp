@@ -0,0 +1,83 @@
+//===- BatchRAUWTest.cpp - Unit tests for BatchRAUW -----------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Transforms/Utils/BatchRAUW.h"
+#include "llvm/AsmParser/Parser.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/ValueHandle.h"
+#include "llvm/Support/SourceMgr.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+namespace {
+
+/// A CallbackVH that records how often its value is RAUW'd and with what.
+class CountingVH final : public CallbackVH {
+public:
+  unsigned Replacements = 0;
+  Value *LastReplacement = nullptr;
+
+  CountingVH(Value *V) : CallbackVH(V) {}
+
+  void allUsesReplacedWith(Value *New) override {
+    ++Replacements;
+    LastReplacement = New;
+  }
+};
+
+TEST(BatchRAUW, ChainedReplacements) {
+  LLVMContext C;
+
+  const char *ModuleString = "define i32 @f(i32 %x) {\n"
+                             "  %a = add i32 %x, 1\n"
+                             "  %b = add i32 %x, 2\n"
+                             "  %c = add i32 %x, 3\n"
+                             "  %use = add i32 %a, %b\n"
+                             "  ret i32 %use\n"
+                             "}\n";
+  SMDiagnostic Err;
+  std::unique_ptr<Module> M = parseAssemblyString(ModuleString, Err, C);
+  ASSERT_TRUE(M);
+  Function *F = M->getFunction("f");
+  BasicBlock &BB = F->getEntryBlock();
+  auto It = BB.begin();
+  Instruction *A = &*It++;
+  Instruction *B = &*It++;
+  Instruction *CInst = &*It++;
+  Instruction *Use = &*It;
+
+  CountingVH AHandle(A);
+
+  // a -> b and b -> c chain; every use must end up on c, and the handle on a
+  // must see a single replacement with the final value.
+  BatchRAUW Batch;
+  EXPECT_TRUE(Batch.empty());
+  Batch.addReplacement(A, B);
+  Batch.addReplacement(B, CInst);
+  EXPECT_FALSE(Batch.empty());
+  Batch.execute();
+
+  EXPECT_EQ(Use->getOperand(0), CInst);
+  EXPECT_EQ(Use->getOperand(1), CInst);
+  EXPECT_TRUE(A->use_empty());
+  EXPECT_TRUE(B->use_empty());
+  EXPECT_EQ(AHandle.Replacements, 1u);
+  EXPECT_EQ(AHandle.LastReplacement, CInst);
+
+  // The object is reusable after execute().
+  EXPECT_TRUE(Batch.empty());
+  Batch.addReplacement(Use, CInst);
+  Batch.execute();
+  EXPECT_EQ(cast<ReturnInst>(BB.getTerminator())->getReturnValue(), CInst);
+}
+
+} // end anonymous namespace
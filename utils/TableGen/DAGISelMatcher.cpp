@@ -192,6 +192,12 @@ void SwitchTypeMatcher::printImpl(raw_ostream &OS, unsigned indent) const {
   OS.indent(indent) << "}\n";
 }
 
+void CheckOpcodeAndTypeMatcher::printImpl(raw_ostream &OS,
+                                          unsigned indent) const {
+  OS.indent(indent) << "CheckOpcodeAndType " << Opcode.getEnumName() << ", "
+    << getEnumName(Type) << '\n';
+}
+
 void CheckChildTypeMatcher::printImpl(raw_ostream &OS, unsigned indent) const {
   OS.indent(indent) << "CheckChildType " << ChildNo << " "
     << getEnumName(Type) << '\n';
@@ -313,6 +319,14 @@ bool CheckOpcodeMatcher::isEqualImpl(const Matcher *M) const {
           Opcode.getEnumName();
 }
 
+bool CheckOpcodeAndTypeMatcher::isEqualImpl(const Matcher *M) const {
+  // As with CheckOpcodeMatcher, compare enum names rather than SDNodeInfo
+  // pointers to ensure the nodes are for the same opcode.
+  const CheckOpcodeAndTypeMatcher *COT = cast<CheckOpcodeAndTypeMatcher>(M);
+  return COT->Opcode.getEnumName() == Opcode.getEnumName() &&
+         COT->Type == Type;
+}
+
 bool EmitNodeMatcherCommon::isEqualImpl(const Matcher *m) const {
   const EmitNodeMatcherCommon *M = cast<EmitNodeMatcherCommon>(m);
   return M->OpcodeName == OpcodeName && M->VTs == VTs &&
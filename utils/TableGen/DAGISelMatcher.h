@@ -62,6 +62,7 @@ public:
     SwitchOpcode,         // Dispatch based on opcode.
     CheckType,            // Fail if not correct type.
     SwitchType,           // Dispatch based on type.
+    CheckOpcodeAndType,   // Fail if not opcode or if result #0 has wrong type.
     CheckChildType,       // Fail if child has wrong type.
     CheckInteger,         // Fail if wrong val.
     CheckChildInteger,    // Fail if child is wrong val.
@@ -120,6 +121,7 @@ public:
     case CheckPredicate:
     case CheckOpcode:
     case CheckType:
+    case CheckOpcodeAndType:
     case CheckChildType:
     case CheckInteger:
     case CheckChildInteger:
@@ -480,6 +482,13 @@ public:
   const SDNodeInfo &getCaseOpcode(unsigned i) const { return *Cases[i].first; }
   Matcher *getCaseMatcher(unsigned i) { return Cases[i].second; }
   const Matcher *getCaseMatcher(unsigned i) const { return Cases[i].second; }
+  void setCaseMatcher(unsigned i, Matcher *N) { Cases[i].second = N; }
+
+  // Opcodes are mutually exclusive, so case order is free to choose; this
+  // lets the optimizer reorder cases for faster scanning.
+  MutableArrayRef<std::pair<const SDNodeInfo *, Matcher *>> getCases() {
+    return Cases;
+  }
 
 private:
   void printImpl(raw_ostream &OS, unsigned indent) const override;
@@ -530,12 +539,37 @@ public:
   MVT::SimpleValueType getCaseType(unsigned i) const { return Cases[i].first; }
   Matcher *getCaseMatcher(unsigned i) { return Cases[i].second; }
   const Matcher *getCaseMatcher(unsigned i) const { return Cases[i].second; }
+  void setCaseMatcher(unsigned i, Matcher *N) { Cases[i].second = N; }
 
 private:
   void printImpl(raw_ostream &OS, unsigned indent) const override;
   bool isEqualImpl(const Matcher *M) const override { return false; }
 };
 
+/// CheckOpcodeAndTypeMatcher - This fused predicate checks the opcode of the
+/// current node and the type of its result #0 in one step.  It is formed from
+/// adjacent CheckOpcode/CheckType pairs that survive switch formation, saving
+/// one trip through the interpreter loop.
+class CheckOpcodeAndTypeMatcher : public Matcher {
+  const SDNodeInfo &Opcode;
+  MVT::SimpleValueType Type;
+public:
+  CheckOpcodeAndTypeMatcher(const SDNodeInfo &opcode,
+                            MVT::SimpleValueType type)
+    : Matcher(CheckOpcodeAndType), Opcode(opcode), Type(type) {}
+
+  const SDNodeInfo &getOpcode() const { return Opcode; }
+  MVT::SimpleValueType getType() const { return Type; }
+
+  static bool classof(const Matcher *N) {
+    return N->getKind() == CheckOpcodeAndType;
+  }
+
+private:
+  void printImpl(raw_ostream &OS, unsigned indent) const override;
+  bool isEqualImpl(const Matcher *M) const override;
+};
+
 
 /// CheckChildTypeMatcher - This checks to see if a child node has the
 /// specified type, if not it fails to match.
@@ -13,6 +13,7 @@
 #include "CodeGenDAGPatterns.h"
 #include "DAGISelMatcher.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/SmallString.h"
@@ -68,6 +69,25 @@ class MatcherTableEmitter {
   std::vector<std::string> VecIncludeStrings;
   MapVector<std::string, unsigned, StringMap<unsigned> > VecPatterns;
 
+  // Subtree deduplication state.  Scope children and switch case bodies are
+  // always terminal (they end in a completion or a failure that unwinds
+  // through the scope stack), so a subtree that emits byte-for-byte the same
+  // as one already in the table can be replaced by an OPC_Jump to the first
+  // copy.  SubtreeKeys maps a subtree's emitted bytes to the first matcher
+  // that produced them, DupRoots maps each later duplicate to that
+  // representative, and EntryIdx records where each representative landed in
+  // the table.  Matchers are emitted in the same pre-order that
+  // AnalyzeSharedSubtrees visits them, so a representative is always emitted
+  // before any jump that targets it.
+  StringMap<const Matcher *> SubtreeKeys;
+  DenseMap<const Matcher *, const Matcher *> DupRoots;
+  DenseMap<const Matcher *, unsigned> EntryIdx;
+  DenseSet<const Matcher *> SharedReps;
+  bool EnableSharing = false;
+
+  // Don't bother sharing tiny subtrees: the jump itself costs several bytes.
+  enum { MinSharedSubtreeSize = 8 };
+
   unsigned getPatternIdxFromTable(std::string &&P, std::string &&include_loc) {
     const auto It = VecPatterns.find(P);
     if (It == VecPatterns.end()) {
@@ -85,6 +105,8 @@ public:
   unsigned EmitMatcherList(const Matcher *N, unsigned Indent,
                            unsigned StartIdx, raw_ostream &OS);
 
+  void AnalyzeSharedSubtrees(const Matcher *N);
+
   void EmitPredicateFunctions(raw_ostream &OS);
 
   void EmitHistogram(const Matcher *N, raw_ostream &OS);
@@ -98,6 +120,9 @@ private:
   unsigned EmitMatcher(const Matcher *N, unsigned Indent, unsigned CurrentIdx,
                        raw_ostream &OS);
 
+  void registerSharedSubtree(const Matcher *N);
+  void analyzeSharedSubtreesImpl(const Matcher *N);
+
   unsigned getNodePredicate(TreePredicateFn Pred) {
     TreePattern *TP = Pred.getOrigPatFragRecord();
     unsigned &Entry = NodePredicateMap[TP];
@@ -276,6 +301,60 @@ void MatcherTableEmitter::EmitPatternMatchTable(raw_ostream &OS) {
   EndEmitFunction(OS);
 }
 
+/// registerSharedSubtree - Key the subtree rooted at N by a trial emission of
+/// its bytes.  Comments are off and sharing is disabled during analysis, so
+/// the key depends only on the subtree's content, not on where it lands in
+/// the table.
+void MatcherTableEmitter::registerSharedSubtree(const Matcher *N) {
+  SmallString<128> KeyBuf;
+  raw_svector_ostream KeyOS(KeyBuf);
+  unsigned Size = EmitMatcherList(N, 0, 0, KeyOS);
+  if (Size < MinSharedSubtreeSize)
+    return;
+
+  auto Insertion = SubtreeKeys.try_emplace(KeyBuf.str(), N);
+  if (!Insertion.second) {
+    const Matcher *Rep = Insertion.first->second;
+    DupRoots[N] = Rep;
+    SharedReps.insert(Rep);
+  }
+}
+
+void MatcherTableEmitter::analyzeSharedSubtreesImpl(const Matcher *N) {
+  for (; N; N = N->getNext()) {
+    if (const ScopeMatcher *SM = dyn_cast<ScopeMatcher>(N)) {
+      for (unsigned i = 0, e = SM->getNumChildren(); i != e; ++i) {
+        registerSharedSubtree(SM->getChild(i));
+        analyzeSharedSubtreesImpl(SM->getChild(i));
+      }
+    } else if (const SwitchOpcodeMatcher *SOM =
+                   dyn_cast<SwitchOpcodeMatcher>(N)) {
+      for (unsigned i = 0, e = SOM->getNumCases(); i != e; ++i) {
+        registerSharedSubtree(SOM->getCaseMatcher(i));
+        analyzeSharedSubtreesImpl(SOM->getCaseMatcher(i));
+      }
+    } else if (const SwitchTypeMatcher *STM = dyn_cast<SwitchTypeMatcher>(N)) {
+      for (unsigned i = 0, e = STM->getNumCases(); i != e; ++i) {
+        registerSharedSubtree(STM->getCaseMatcher(i));
+        analyzeSharedSubtreesImpl(STM->getCaseMatcher(i));
+      }
+    }
+  }
+}
+
+/// AnalyzeSharedSubtrees - Find scope children and switch case bodies that
+/// emit identical bytes so the real emission pass can replace all but the
+/// first copy with an OPC_Jump to it.  This visits subtrees in the same
+/// pre-order as emission, so every duplicate's representative is emitted
+/// before the jump that targets it.
+void MatcherTableEmitter::AnalyzeSharedSubtrees(const Matcher *N) {
+  bool SavedOmitComments = OmitComments;
+  OmitComments = true;
+  analyzeSharedSubtreesImpl(N);
+  OmitComments = SavedOmitComments;
+  EnableSharing = true;
+}
+
 /// EmitMatcher - Emit bytes for the specified matcher and return
 /// the number of bytes emitted.
 unsigned MatcherTableEmitter::
@@ -292,6 +371,7 @@ EmitMatcher(const Matcher *N, unsigned Indent, unsigned CurrentIdx,
 
     // Emit all of the children.
     for (unsigned i = 0, e = SM->getNumChildren(); i != e; ++i) {
+      const Matcher *Child = SM->getChild(i);
       if (i == 0) {
         OS << "OPC_Scope, ";
         ++CurrentIdx;
@@ -303,6 +383,29 @@ EmitMatcher(const Matcher *N, unsigned Indent, unsigned CurrentIdx,
           OS.indent(Indent*2);
       }
 
+      // If this child is a duplicate of a subtree already in the table,
+      // emit a jump to the first copy instead of the child itself.
+      if (EnableSharing && DupRoots.count(Child)) {
+        unsigned Target = EntryIdx.lookup(DupRoots[Child]);
+        unsigned JumpSize = 1 + GetVBRSize(Target);
+        CurrentIdx += EmitVBRValue(JumpSize, OS);
+        if (!OmitComments) {
+          OS << "/*->" << CurrentIdx+JumpSize << "*/";
+          if (i == 0)
+            OS << " // " << SM->getNumChildren() << " children in Scope";
+        }
+        OS << '\n';
+        if (!OmitComments)
+          OS << "/*" << format_decimal(CurrentIdx, IndexWidth) << "*/";
+        OS.indent((Indent+1)*2) << "OPC_Jump, ";
+        ++CurrentIdx;
+        CurrentIdx += EmitVBRValue(Target, OS);
+        if (!OmitComments)
+          OS << "// shared subtree";
+        OS << '\n';
+        continue;
+      }
+
       // We need to encode the child and the offset of the failure code before
       // emitting either of them.  Handle this by buffering the output into a
       // string while we get the size.  Unfortunately, the offset of the
@@ -314,9 +417,13 @@ EmitMatcher(const Matcher *N, unsigned Indent, unsigned CurrentIdx,
       do {
         VBRSize = GetVBRSize(ChildSize);
 
+        // Record where the child will land so later duplicates can jump here.
+        if (EnableSharing && SharedReps.count(Child))
+          EntryIdx[Child] = CurrentIdx + VBRSize;
+
         TmpBuf.clear();
         raw_svector_ostream OS(TmpBuf);
-        ChildSize = EmitMatcherList(SM->getChild(i), Indent+1,
+        ChildSize = EmitMatcherList(Child, Indent+1,
                                     CurrentIdx+VBRSize, OS);
       } while (GetVBRSize(ChildSize) != VBRSize);
 
@@ -461,6 +568,39 @@ EmitMatcher(const Matcher *N, unsigned Indent, unsigned CurrentIdx,
         IdxSize = 1;  // size of type in table is 1 byte.
       }
 
+      // If this case body duplicates a subtree already in the table, emit a
+      // jump to the first copy instead of the body itself.
+      if (EnableSharing && DupRoots.count(Child)) {
+        unsigned Target = EntryIdx.lookup(DupRoots[Child]);
+        unsigned JumpSize = 1 + GetVBRSize(Target);
+        if (i != 0) {
+          if (!OmitComments)
+            OS << "/*" << format_decimal(CurrentIdx, IndexWidth) << "*/";
+          OS.indent(Indent*2);
+          if (!OmitComments)
+            OS << (isa<SwitchOpcodeMatcher>(N) ?
+                       "/*SwitchOpcode*/ " : "/*SwitchType*/ ");
+        }
+        CurrentIdx += EmitVBRValue(JumpSize, OS);
+        if (const SwitchOpcodeMatcher *SOM = dyn_cast<SwitchOpcodeMatcher>(N))
+          OS << "TARGET_VAL(" << SOM->getCaseOpcode(i).getEnumName() << "),";
+        else
+          OS << getEnumName(cast<SwitchTypeMatcher>(N)->getCaseType(i)) << ',';
+        CurrentIdx += IdxSize;
+        if (!OmitComments)
+          OS << "// ->" << CurrentIdx+JumpSize;
+        OS << '\n';
+        if (!OmitComments)
+          OS << "/*" << format_decimal(CurrentIdx, IndexWidth) << "*/";
+        OS.indent((Indent+1)*2) << "OPC_Jump, ";
+        ++CurrentIdx;
+        CurrentIdx += EmitVBRValue(Target, OS);
+        if (!OmitComments)
+          OS << "// shared subtree";
+        OS << '\n';
+        continue;
+      }
+
       // We need to encode the opcode and the offset of the case code before
       // emitting the case code.  Handle this by buffering the output into a
       // string while we get the size.  Unfortunately, the offset of the
@@ -472,6 +612,10 @@ EmitMatcher(const Matcher *N, unsigned Indent, unsigned CurrentIdx,
       do {
         VBRSize = GetVBRSize(ChildSize);
 
+        // Record where the case body will land so duplicates can jump here.
+        if (EnableSharing && SharedReps.count(Child))
+          EntryIdx[Child] = CurrentIdx + VBRSize + IdxSize;
+
         TmpBuf.clear();
         raw_svector_ostream OS(TmpBuf);
         ChildSize = EmitMatcherList(Child, Indent+1, CurrentIdx+VBRSize+IdxSize,
@@ -529,6 +673,12 @@ EmitMatcher(const Matcher *N, unsigned Indent, unsigned CurrentIdx,
        << ", " << getEnumName(cast<CheckTypeMatcher>(N)->getType()) << ",\n";
     return 3;
 
+  case Matcher::CheckOpcodeAndType:
+    OS << "OPC_CheckOpcodeAndType, TARGET_VAL("
+       << cast<CheckOpcodeAndTypeMatcher>(N)->getOpcode().getEnumName() << "), "
+       << getEnumName(cast<CheckOpcodeAndTypeMatcher>(N)->getType()) << ",\n";
+    return 4;
+
   case Matcher::CheckChildType:
     OS << "OPC_CheckChild"
        << cast<CheckChildTypeMatcher>(N)->getChildNo() << "Type, "
@@ -1014,6 +1164,7 @@ static StringRef getOpcodeString(Matcher::KindTy Kind) {
   case Matcher::SwitchOpcode: return "OPC_SwitchOpcode"; break;
   case Matcher::CheckType: return "OPC_CheckType"; break;
   case Matcher::SwitchType: return "OPC_SwitchType"; break;
+  case Matcher::CheckOpcodeAndType: return "OPC_CheckOpcodeAndType"; break;
   case Matcher::CheckChildType: return "OPC_CheckChildType"; break;
   case Matcher::CheckInteger: return "OPC_CheckInteger"; break;
   case Matcher::CheckChildInteger: return "OPC_CheckChildInteger"; break;
@@ -1100,6 +1251,7 @@ void llvm::EmitMatcherTable(const Matcher *TheMatcher,
   OS << "  // this.\n";
   OS << "  #define TARGET_VAL(X) X & 255, unsigned(X) >> 8\n";
   OS << "  static const unsigned char MatcherTable[] = {\n";
+  MatcherEmitter.AnalyzeSharedSubtrees(TheMatcher);
   unsigned TotalSize = MatcherEmitter.EmitMatcherList(TheMatcher, 1, 0, OS);
   OS << "    0\n  }; // Total Array size is " << (TotalSize+1) << " bytes\n\n";
 
@@ -463,9 +463,118 @@ static void FactorNodes(std::unique_ptr<Matcher> &InputMatcherPtr) {
     Scope->resetChild(i, NewOptionsToMatch[i]);
 }
 
+/// CountLeafPatterns - Return the number of pattern completions reachable
+/// from M.  This is a static stand-in for opcode frequency data: opcodes
+/// with many patterns behind them are the ones ISel dispatches to most in
+/// practice, so they make a reasonable "hot" set.
+static unsigned CountLeafPatterns(const Matcher *M) {
+  unsigned Count = 0;
+  for (; M; M = M->getNext()) {
+    if (isa<CompleteMatchMatcher>(M) || isa<MorphNodeToMatcher>(M))
+      ++Count;
+    else if (const ScopeMatcher *SM = dyn_cast<ScopeMatcher>(M))
+      for (unsigned i = 0, e = SM->getNumChildren(); i != e; ++i)
+        Count += CountLeafPatterns(SM->getChild(i));
+    else if (const SwitchOpcodeMatcher *SOM = dyn_cast<SwitchOpcodeMatcher>(M))
+      for (unsigned i = 0, e = SOM->getNumCases(); i != e; ++i)
+        Count += CountLeafPatterns(SOM->getCaseMatcher(i));
+    else if (const SwitchTypeMatcher *STM = dyn_cast<SwitchTypeMatcher>(M))
+      for (unsigned i = 0, e = STM->getNumCases(); i != e; ++i)
+        Count += CountLeafPatterns(STM->getCaseMatcher(i));
+  }
+  return Count;
+}
+
+/// SortSwitchCases - Order SwitchOpcode cases hottest-first.  The opcode
+/// cases are mutually exclusive so any order is legal; SelectCodeCommon
+/// scans them linearly, so putting pattern-dense cases first keeps the
+/// common dispatches in the front (hot) part of the table and pushes rare
+/// opcodes toward the cold tail.
+static void SortSwitchCases(Matcher *M) {
+  for (; M; M = M->getNext()) {
+    if (ScopeMatcher *SM = dyn_cast<ScopeMatcher>(M)) {
+      for (unsigned i = 0, e = SM->getNumChildren(); i != e; ++i)
+        SortSwitchCases(SM->getChild(i));
+    } else if (SwitchOpcodeMatcher *SOM = dyn_cast<SwitchOpcodeMatcher>(M)) {
+      MutableArrayRef<std::pair<const SDNodeInfo *, Matcher *>> Cases =
+          SOM->getCases();
+      SmallVector<std::pair<unsigned, std::pair<const SDNodeInfo *, Matcher *>>,
+                  8> Weighted;
+      Weighted.reserve(Cases.size());
+      for (const auto &C : Cases)
+        Weighted.push_back(std::make_pair(CountLeafPatterns(C.second), C));
+      std::stable_sort(Weighted.begin(), Weighted.end(),
+                       [](const decltype(Weighted)::value_type &A,
+                          const decltype(Weighted)::value_type &B) {
+                         return A.first > B.first;
+                       });
+      for (unsigned i = 0, e = Cases.size(); i != e; ++i)
+        Cases[i] = Weighted[i].second;
+      for (unsigned i = 0, e = SOM->getNumCases(); i != e; ++i)
+        SortSwitchCases(SOM->getCaseMatcher(i));
+    } else if (SwitchTypeMatcher *STM = dyn_cast<SwitchTypeMatcher>(M)) {
+      for (unsigned i = 0, e = STM->getNumCases(); i != e; ++i)
+        SortSwitchCases(STM->getCaseMatcher(i));
+    }
+  }
+}
+
+/// FuseOpcodeTypeChecks - Turn a CheckOpcode immediately followed by a
+/// CheckType on result #0 into a single CheckOpcodeAndType superop, saving a
+/// trip through the matcher interpreter loop.  This runs after FactorNodes:
+/// fusing earlier would hide the CheckOpcode prefixes that factoring turns
+/// into SwitchOpcode dispatch, so only pairs that survived switch formation
+/// get fused here.
+static void FuseOpcodeTypeChecks(std::unique_ptr<Matcher> &MatcherPtr) {
+  Matcher *N = MatcherPtr.get();
+  if (!N) return;
+
+  // Walk down all children of scope and switch nodes.
+  if (ScopeMatcher *Scope = dyn_cast<ScopeMatcher>(N)) {
+    for (unsigned i = 0, e = Scope->getNumChildren(); i != e; ++i) {
+      std::unique_ptr<Matcher> Child(Scope->takeChild(i));
+      FuseOpcodeTypeChecks(Child);
+      Scope->resetChild(i, Child.release());
+    }
+    return;
+  }
+
+  if (SwitchOpcodeMatcher *SOM = dyn_cast<SwitchOpcodeMatcher>(N)) {
+    for (unsigned i = 0, e = SOM->getNumCases(); i != e; ++i) {
+      std::unique_ptr<Matcher> Child(SOM->getCaseMatcher(i));
+      FuseOpcodeTypeChecks(Child);
+      SOM->setCaseMatcher(i, Child.release());
+    }
+    return;
+  }
+
+  if (SwitchTypeMatcher *STM = dyn_cast<SwitchTypeMatcher>(N)) {
+    for (unsigned i = 0, e = STM->getNumCases(); i != e; ++i) {
+      std::unique_ptr<Matcher> Child(STM->getCaseMatcher(i));
+      FuseOpcodeTypeChecks(Child);
+      STM->setCaseMatcher(i, Child.release());
+    }
+    return;
+  }
+
+  if (CheckOpcodeMatcher *CO = dyn_cast<CheckOpcodeMatcher>(N))
+    if (CheckTypeMatcher *CT = dyn_cast_or_null<CheckTypeMatcher>(N->getNext()))
+      if (CT->getResNo() == 0) {
+        Matcher *Fused =
+          new CheckOpcodeAndTypeMatcher(CO->getOpcode(), CT->getType());
+        Fused->setNext(CT->takeNext());
+        MatcherPtr.reset(Fused);
+        return FuseOpcodeTypeChecks(MatcherPtr->getNextPtr());
+      }
+
+  FuseOpcodeTypeChecks(N->getNextPtr());
+}
+
 void
 llvm::OptimizeMatcher(std::unique_ptr<Matcher> &MatcherPtr,
                       const CodeGenDAGPatterns &CGP) {
   ContractNodes(MatcherPtr, CGP);
   FactorNodes(MatcherPtr);
+  SortSwitchCases(MatcherPtr.get());
+  FuseOpcodeTypeChecks(MatcherPtr);
 }
@@ -11,6 +11,7 @@
 ///
 //===----------------------------------------------------------------------===//
 
+#include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Timer.h"
@@ -70,6 +71,11 @@ protected:
   /// A block of arbitrary C++ to finish testing the match.
   /// FIXME: This is a temporary measure until we have actual pattern matching
   const CodeInit *MatchingFixupCode = nullptr;
+
+  /// The opcodes the root instruction may have, if declared by the rule. When
+  /// non-empty, the rule is dispatched through an opcode switch instead of
+  /// being tried on every instruction.
+  std::vector<Record *> RootOpcodes;
 public:
   CombineRule(const CodeGenTarget &Target, RuleID ID, const Record &R)
       : ID(ID), TheDef(R) {}
@@ -81,6 +87,7 @@ public:
   const Record &getDef() const { return TheDef; }
   const CodeInit *getMatchingFixupCode() const { return MatchingFixupCode; }
   size_t getNumRoots() const { return Roots.size(); }
+  ArrayRef<Record *> getRootOpcodes() const { return RootOpcodes; }
 
   using const_root_iterator = std::vector<RootInfo>::const_iterator;
   const_root_iterator roots_begin() const { return Roots.begin(); }
@@ -146,6 +153,16 @@ bool CombineRule::parseDefs() {
     PrintError(TheDef.getLoc(), "Combine rules must have at least one root");
     return false;
   }
+
+  // Collect the declared root opcodes, if any.
+  for (Record *Opcode : TheDef.getValueAsListOfDefs("RootOpcodes")) {
+    if (!Opcode->isSubClassOf("Instruction")) {
+      PrintError(TheDef.getLoc(), "Expected an instruction in RootOpcodes "
+                                  "but got `" + Opcode->getName() + "'");
+      return false;
+    }
+    RootOpcodes.push_back(Opcode);
+  }
   return true;
 }
 
@@ -422,8 +439,36 @@ void GICombinerEmitter::run(raw_ostream &OS) {
      << "  MachineRegisterInfo &MRI = MF->getRegInfo();\n"
      << "  (void)MBB; (void)MF; (void)MRI;\n\n";
 
-  for (const auto &Rule : Rules)
-    generateCodeForRule(OS, Rule.get(), "  ");
+  // Rules that declare their root opcodes are dispatched through a switch on
+  // the instruction's opcode; the remaining rules are tried linearly on every
+  // instruction afterwards.
+  MapVector<Record *, std::vector<const CombineRule *>> RulesByOpcode;
+  std::vector<const CombineRule *> LinearRules;
+  for (const auto &Rule : Rules) {
+    if (Rule->getRootOpcodes().empty()) {
+      LinearRules.push_back(Rule.get());
+      continue;
+    }
+    for (Record *Opcode : Rule->getRootOpcodes())
+      RulesByOpcode[Opcode].push_back(Rule.get());
+  }
+
+  if (!RulesByOpcode.empty()) {
+    OS << "  switch (MI.getOpcode()) {\n"
+       << "  default: break;\n";
+    for (const auto &I : RulesByOpcode) {
+      OS << "  case " << I.first->getValueAsString("Namespace")
+         << "::" << I.first->getName() << ": {\n";
+      for (const CombineRule *Rule : I.second)
+        generateCodeForRule(OS, Rule, "    ");
+      OS << "    break;\n"
+         << "  }\n";
+    }
+    OS << "  }\n\n";
+  }
+
+  for (const CombineRule *Rule : LinearRules)
+    generateCodeForRule(OS, Rule, "  ");
   OS << "\n  return false;\n"
      << "}\n"
      << "#endif // ifdef " << Name.upper() << "_GENCOMBINERHELPER_CPP\n";